@@ -27,11 +27,26 @@
 #include "cfe_platform_cfg.h"
 #include "cfe_sb.h"
 
+/**
+ * Number of downlink priority levels.  The Priority field of the
+ * subscription QoS selects the queue; values beyond the last level
+ * are clamped to the highest priority.  Higher values are sent first.
+ */
+#define TO_LAB_MAX_PRIORITY_LEVELS 4
+
+/**
+ * Action taken when a packet arrives and its priority queue is full
+ */
+#define TO_LAB_DROP_NEWEST 0 /**< Discard the arriving packet (default) */
+#define TO_LAB_DROP_OLDEST 1 /**< Discard the oldest queued packets to make room */
+
 typedef struct
 {
     CFE_SB_MsgId_t Stream;
     CFE_SB_Qos_t   Flags;
     uint16         BufLimit;
+    uint8          DropPolicy; /**< TO_LAB_DROP_xxx, action when the priority queue is full */
+    uint8          Decimation; /**< Forward 1 of every N packets, 0 or 1 forwards all */
 } TO_LAB_Sub_t;
 
 typedef struct
@@ -28,6 +28,7 @@
 #include "to_lab_perfids.h"
 #include "to_lab_version.h"
 #include "to_lab_sub_table.h"
+#include "to_lab_downlink.h"
 
 /*
 ** Global Data Section
@@ -70,6 +71,7 @@ int32 TO_LAB_RemovePacket(const TO_LAB_RemovePacketCmd_t *data);
 int32 TO_LAB_ResetCounters(const TO_LAB_ResetCountersCmd_t *data);
 int32 TO_LAB_SendDataTypes(const TO_LAB_SendDataTypesCmd_t *data);
 int32 TO_LAB_SendHousekeeping(const CFE_MSG_CommandHeader_t *data);
+int32 TO_LAB_SetRate(const TO_LAB_SetRateCmd_t *data);
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                   */
@@ -153,6 +155,8 @@ int32 TO_LAB_init(void)
     CFE_MSG_Init(CFE_MSG_PTR(TO_LAB_Global.HkTlm.TelemetryHeader), CFE_SB_ValueToMsgId(TO_LAB_HK_TLM_MID),
                  sizeof(TO_LAB_Global.HkTlm));
 
+    TO_LAB_DownlinkInit();
+
     status = CFE_TBL_Register(&TO_SubTblHandle, "TO_LAB_Subs", sizeof(*TO_LAB_Subs), CFE_TBL_OPT_DEFAULT, NULL);
 
     if (status != CFE_SUCCESS)
@@ -211,6 +215,12 @@ int32 TO_LAB_init(void)
         {
             status = CFE_SB_SubscribeEx(TO_LAB_Subs->Subs[i].Stream, TO_LAB_Global.Tlm_pipe, TO_LAB_Subs->Subs[i].Flags,
                                         TO_LAB_Subs->Subs[i].BufLimit);
+
+            if (status == CFE_SUCCESS)
+            {
+                TO_LAB_DownlinkSetStreamPolicy(TO_LAB_Subs->Subs[i].Stream, &TO_LAB_Subs->Subs[i].Flags,
+                                               TO_LAB_Subs->Subs[i].DropPolicy, TO_LAB_Subs->Subs[i].Decimation);
+            }
         }
 
         if (status != CFE_SUCCESS)
@@ -339,6 +349,10 @@ void TO_LAB_exec_local_command(CFE_SB_Buffer_t *SBBufPtr)
             TO_LAB_EnableOutput((const TO_LAB_EnableOutputCmd_t *)SBBufPtr);
             break;
 
+        case TO_LAB_SET_RATE_CC:
+            TO_LAB_SetRate((const TO_LAB_SetRateCmd_t *)SBBufPtr);
+            break;
+
         default:
             CFE_EVS_SendEvent(TO_LAB_FNCODE_ERR_EID, CFE_EVS_EventType_ERROR,
                               "L%d TO: Invalid Function Code Rcvd In Ground Command 0x%x", __LINE__,
@@ -368,6 +382,7 @@ int32 TO_LAB_ResetCounters(const TO_LAB_ResetCountersCmd_t *data)
 {
     TO_LAB_Global.HkTlm.Payload.CommandErrorCounter = 0;
     TO_LAB_Global.HkTlm.Payload.CommandCounter      = 0;
+    TO_LAB_DownlinkResetStats();
     return CFE_SUCCESS;
 }
 
@@ -429,11 +444,40 @@ int32 TO_LAB_SendDataTypes(const TO_LAB_SendDataTypesCmd_t *data)
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 int32 TO_LAB_SendHousekeeping(const CFE_MSG_CommandHeader_t *data)
 {
+    TO_LAB_DownlinkReportStats(&TO_LAB_Global.HkTlm.Payload);
     CFE_SB_TimeStampMsg(CFE_MSG_PTR(TO_LAB_Global.HkTlm.TelemetryHeader));
     CFE_SB_TransmitMsg(CFE_MSG_PTR(TO_LAB_Global.HkTlm.TelemetryHeader), true);
     return CFE_SUCCESS;
 }
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* TO_LAB_SetRate() -- Set downlink byte-rate limit                */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+int32 TO_LAB_SetRate(const TO_LAB_SetRateCmd_t *data)
+{
+    const TO_LAB_SetRate_Payload_t *pCmd = &data->Payload;
+    int32                           status;
+
+    status = TO_LAB_DownlinkSetRate(pCmd->BytesPerSec, pCmd->BurstBytes);
+    if (status != CFE_SUCCESS)
+    {
+        CFE_EVS_SendEvent(TO_LAB_SETRATE_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "L%d TO Invalid rate %lu bytes/sec with burst %lu", __LINE__,
+                          (unsigned long)pCmd->BytesPerSec, (unsigned long)pCmd->BurstBytes);
+        ++TO_LAB_Global.HkTlm.Payload.CommandErrorCounter;
+        return status;
+    }
+
+    CFE_EVS_SendEvent(TO_LAB_SETRATE_INF_EID, CFE_EVS_EventType_INFORMATION,
+                      "TO downlink rate set to %lu bytes/sec, burst %lu", (unsigned long)pCmd->BytesPerSec,
+                      (unsigned long)pCmd->BurstBytes);
+
+    ++TO_LAB_Global.HkTlm.Payload.CommandCounter;
+    return CFE_SUCCESS;
+}
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* TO_LAB_openTLM() -- Open TLM                                    */
@@ -469,10 +513,13 @@ int32 TO_LAB_AddPacket(const TO_LAB_AddPacketCmd_t *data)
         CFE_EVS_SendEvent(TO_LAB_ADDPKT_ERR_EID, CFE_EVS_EventType_ERROR, "L%d TO Can't subscribe 0x%x status %i",
                           __LINE__, (unsigned int)CFE_SB_MsgIdToValue(pCmd->Stream), (int)status);
     else
+    {
+        TO_LAB_DownlinkSetStreamPolicy(pCmd->Stream, &pCmd->Flags, TO_LAB_DROP_NEWEST, 0);
         CFE_EVS_SendEvent(TO_LAB_ADDPKT_INF_EID, CFE_EVS_EventType_INFORMATION,
                           "L%d TO AddPkt 0x%x, QoS %d.%d, limit %d", __LINE__,
                           (unsigned int)CFE_SB_MsgIdToValue(pCmd->Stream), pCmd->Flags.Priority,
                           pCmd->Flags.Reliability, pCmd->BufLimit);
+    }
 
     ++TO_LAB_Global.HkTlm.Payload.CommandCounter;
     return CFE_SUCCESS;
@@ -494,8 +541,11 @@ int32 TO_LAB_RemovePacket(const TO_LAB_RemovePacketCmd_t *data)
                           "L%d TO Can't Unsubscribe to Stream 0x%x, status %i", __LINE__,
                           (unsigned int)CFE_SB_MsgIdToValue(pCmd->Stream), (int)status);
     else
+    {
+        TO_LAB_DownlinkClearStreamPolicy(pCmd->Stream);
         CFE_EVS_SendEvent(TO_LAB_REMOVEPKT_INF_EID, CFE_EVS_EventType_INFORMATION, "L%d TO RemovePkt 0x%x", __LINE__,
                           (unsigned int)CFE_SB_MsgIdToValue(pCmd->Stream));
+    }
     ++TO_LAB_Global.HkTlm.Payload.CommandCounter;
     return CFE_SUCCESS;
 }
@@ -523,6 +573,8 @@ int32 TO_LAB_RemoveAll(const TO_LAB_RemoveAllCmd_t *data)
         }
     }
 
+    TO_LAB_DownlinkClearAllStreamPolicies();
+
     CFE_EVS_SendEvent(TO_LAB_REMOVEALLPKTS_INF_EID, CFE_EVS_EventType_INFORMATION,
                       "L%d TO Unsubscribed to all Commands and Telemetry", __LINE__);
 
@@ -543,40 +595,42 @@ void TO_LAB_forward_telemetry(void)
     size_t           size;
     CFE_SB_Buffer_t *SBBufPtr;
 
-    OS_SocketAddrInit(&d_addr, OS_SocketDomain_INET);
-    OS_SocketAddrSetPort(&d_addr, cfgTLM_PORT);
-    OS_SocketAddrFromString(&d_addr, TO_LAB_Global.tlm_dest_IP);
-    status = 0;
-
+    /*
+     * Drain the pipe completely into the priority queues so that SB never
+     * backs up while the output is rate limited.  Packets received while
+     * the output is off or suppressed are discarded, as before.
+     */
     do
     {
         CFE_SB_status = CFE_SB_ReceiveBuffer(&SBBufPtr, TO_LAB_Global.Tlm_pipe, CFE_SB_POLL);
 
-        if ((CFE_SB_status == CFE_SUCCESS) && (TO_LAB_Global.suppress_sendto == false))
+        if ((CFE_SB_status == CFE_SUCCESS) && (TO_LAB_Global.suppress_sendto == false) &&
+            (TO_LAB_Global.downlink_on == true))
         {
             CFE_MSG_GetSize(&SBBufPtr->Msg, &size);
-
-            if (TO_LAB_Global.downlink_on == true)
-            {
-                CFE_ES_PerfLogEntry(TO_LAB_SOCKET_SEND_PERF_ID);
-
-                status = OS_SocketSendTo(TO_LAB_Global.TLMsockid, SBBufPtr, size, &d_addr);
-
-                CFE_ES_PerfLogExit(TO_LAB_SOCKET_SEND_PERF_ID);
-            }
-            else
-            {
-                status = 0;
-            }
-            if (status < 0)
-            {
-                CFE_EVS_SendEvent(TO_LAB_TLMOUTSTOP_ERR_EID, CFE_EVS_EventType_ERROR,
-                                  "L%d TO sendto error %d. Tlm output suppressed\n", __LINE__, (int)status);
-                TO_LAB_Global.suppress_sendto = true;
-            }
+            TO_LAB_DownlinkEnqueue(SBBufPtr, size);
         }
         /* If CFE_SB_status != CFE_SUCCESS, then no packet was received from CFE_SB_ReceiveBuffer() */
     } while (CFE_SB_status == CFE_SUCCESS);
+
+    if ((TO_LAB_Global.suppress_sendto == true) || (TO_LAB_Global.downlink_on == false))
+    {
+        TO_LAB_DownlinkFlush();
+        return;
+    }
+
+    OS_SocketAddrInit(&d_addr, OS_SocketDomain_INET);
+    OS_SocketAddrSetPort(&d_addr, cfgTLM_PORT);
+    OS_SocketAddrFromString(&d_addr, TO_LAB_Global.tlm_dest_IP);
+
+    status = TO_LAB_DownlinkService(TO_LAB_Global.TLMsockid, &d_addr);
+    if (status < 0)
+    {
+        CFE_EVS_SendEvent(TO_LAB_TLMOUTSTOP_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "L%d TO sendto error %d. Tlm output suppressed\n", __LINE__, (int)status);
+        TO_LAB_Global.suppress_sendto = true;
+        TO_LAB_DownlinkFlush();
+    }
 }
 
 /************************/
@@ -48,6 +48,20 @@
  */
 #define TO_LAB_TLM_PIPE_DEPTH OS_QUEUE_MAX_DEPTH
 
+/**
+ * Size in bytes of each downlink priority queue.  Packets are copied out
+ * of the telemetry pipe into these queues so the pipe never backs up
+ * while the output is rate limited.
+ */
+#define TO_LAB_PRIORITY_QUEUE_SIZE 32768
+
+/**
+ * Default downlink token bucket settings.  A rate of 0 leaves the
+ * output unlimited until a TO_LAB_SET_RATE_CC command is received.
+ */
+#define TO_LAB_DEFAULT_BYTES_PER_SEC 0
+#define TO_LAB_DEFAULT_BURST_BYTES   16384
+
 #define cfgTLM_ADDR        "192.168.1.81"
 #define cfgTLM_PORT        1235
 #define TO_LAB_VERSION_NUM "5.1.0"
@@ -0,0 +1,540 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * \file
+ *  This file contains the downlink scheduler for the TO lab application
+ */
+
+#include "to_lab_app.h"
+#include "to_lab_downlink.h"
+#include "to_lab_perfids.h"
+
+/*
+ * Each queued packet is preceded by a length word.  A length of
+ * TO_LAB_QUEUE_WRAP marks unused space at the end of the ring; the
+ * reader skips back to offset 0 when it sees it.  Entries are padded
+ * to keep the length words aligned.
+ */
+#define TO_LAB_QUEUE_WRAP       0xFFFFFFFF
+#define TO_LAB_QUEUE_ALIGN(x)   (((x) + sizeof(uint32) - 1) & ~(sizeof(uint32) - 1))
+#define TO_LAB_QUEUE_ENTRY(len) TO_LAB_QUEUE_ALIGN(sizeof(uint32) + (len))
+
+/*
+ * Longest interval credited by a single token bucket refill, in microseconds
+ */
+#define TO_LAB_REFILL_MAX_USEC 1000000000
+
+typedef struct
+{
+    uint32 Head;  /* offset of oldest entry */
+    uint32 Tail;  /* offset at which the next entry is written */
+    uint32 Used;  /* bytes in use, including wrap padding */
+    uint16 Count; /* number of packets held */
+    uint32 Data[TO_LAB_PRIORITY_QUEUE_SIZE / sizeof(uint32)];
+} TO_LAB_PriorityQueue_t;
+
+typedef struct
+{
+    CFE_SB_MsgId_t MsgId;
+    uint8          Priority;
+    uint8          DropPolicy;
+    uint8          Decimation;
+    uint8          DecimationCount;
+} TO_LAB_StreamPolicy_t;
+
+typedef struct
+{
+    uint32    BytesPerSec;
+    uint32    BurstBytes;
+    uint32    Tokens;
+    OS_time_t LastRefill;
+} TO_LAB_TokenBucket_t;
+
+typedef struct
+{
+    TO_LAB_PriorityQueue_t Queue[TO_LAB_MAX_PRIORITY_LEVELS];
+    TO_LAB_StreamPolicy_t  Stream[CFE_PLATFORM_SB_MAX_MSG_IDS];
+    uint32                 NumStreams;
+    TO_LAB_TokenBucket_t   Bucket;
+
+    uint32 PacketsSent;
+    uint32 PacketsDropped;
+    uint32 PacketsDecimated;
+    uint32 RateLimitHolds;
+} TO_LAB_DownlinkData_t;
+
+TO_LAB_DownlinkData_t TO_LAB_Downlink;
+
+/*----------------------------------------------------------------
+ * Local helper: locate the policy of a stream, NULL if unknown
+ *-----------------------------------------------------------------*/
+static TO_LAB_StreamPolicy_t *TO_LAB_DownlinkFindStream(CFE_SB_MsgId_t MsgId)
+{
+    uint32 i;
+
+    for (i = 0; i < TO_LAB_Downlink.NumStreams; ++i)
+    {
+        if (CFE_SB_MsgId_Equal(TO_LAB_Downlink.Stream[i].MsgId, MsgId))
+        {
+            return &TO_LAB_Downlink.Stream[i];
+        }
+    }
+
+    return NULL;
+}
+
+/*----------------------------------------------------------------
+ * Local helper: pointer to the byte at an offset in a queue
+ *-----------------------------------------------------------------*/
+static inline uint8 *TO_LAB_QueueAddr(TO_LAB_PriorityQueue_t *Queue, uint32 Offset)
+{
+    return (uint8 *)Queue->Data + Offset;
+}
+
+/*----------------------------------------------------------------
+ * Local helper: find the oldest entry in a queue, skipping a wrap marker
+ * Returns the entry length, or 0 if the queue is empty
+ *-----------------------------------------------------------------*/
+static uint32 TO_LAB_QueuePeek(TO_LAB_PriorityQueue_t *Queue, uint8 **DataPtr)
+{
+    uint32 Length;
+
+    if (Queue->Count == 0)
+    {
+        return 0;
+    }
+
+    if (Queue->Head >= sizeof(Queue->Data))
+    {
+        Queue->Head = 0;
+    }
+
+    memcpy(&Length, TO_LAB_QueueAddr(Queue, Queue->Head), sizeof(Length));
+    if (Length == TO_LAB_QUEUE_WRAP)
+    {
+        Queue->Used -= sizeof(Queue->Data) - Queue->Head;
+        Queue->Head = 0;
+        memcpy(&Length, TO_LAB_QueueAddr(Queue, 0), sizeof(Length));
+    }
+
+    *DataPtr = TO_LAB_QueueAddr(Queue, Queue->Head + sizeof(uint32));
+    return Length;
+}
+
+/*----------------------------------------------------------------
+ * Local helper: remove the oldest entry of a queue
+ *-----------------------------------------------------------------*/
+static void TO_LAB_QueuePop(TO_LAB_PriorityQueue_t *Queue)
+{
+    uint8 *DataPtr;
+    uint32 EntrySize;
+
+    EntrySize = TO_LAB_QUEUE_ENTRY(TO_LAB_QueuePeek(Queue, &DataPtr));
+
+    Queue->Head += EntrySize;
+    Queue->Used -= EntrySize;
+    --Queue->Count;
+
+    if (Queue->Count == 0)
+    {
+        Queue->Head = 0;
+        Queue->Tail = 0;
+        Queue->Used = 0;
+    }
+}
+
+/*----------------------------------------------------------------
+ * Local helper: append a packet to a queue
+ * Returns false if there is not enough contiguous space
+ *-----------------------------------------------------------------*/
+static bool TO_LAB_QueuePush(TO_LAB_PriorityQueue_t *Queue, const void *Packet, uint32 Length)
+{
+    uint32 EntrySize  = TO_LAB_QUEUE_ENTRY(Length);
+    uint32 WrapMarker = TO_LAB_QUEUE_WRAP;
+    uint32 EndSpace;
+    uint32 Offset;
+
+    if (Queue->Count == 0)
+    {
+        Queue->Head = 0;
+        Queue->Tail = 0;
+        Queue->Used = 0;
+    }
+
+    if (Queue->Count == 0 || Queue->Tail > Queue->Head)
+    {
+        /* free space is at the end of the buffer and before the head */
+        EndSpace = sizeof(Queue->Data) - Queue->Tail;
+        if (EntrySize <= EndSpace)
+        {
+            Offset = Queue->Tail;
+        }
+        else if (EntrySize <= Queue->Head)
+        {
+            if (EndSpace > 0)
+            {
+                memcpy(TO_LAB_QueueAddr(Queue, Queue->Tail), &WrapMarker, sizeof(WrapMarker));
+            }
+            Queue->Used += EndSpace;
+            Offset = 0;
+        }
+        else
+        {
+            return false;
+        }
+    }
+    else if (EntrySize <= (Queue->Head - Queue->Tail))
+    {
+        /* queue has wrapped, free space is between tail and head */
+        Offset = Queue->Tail;
+    }
+    else
+    {
+        return false;
+    }
+
+    memcpy(TO_LAB_QueueAddr(Queue, Offset), &Length, sizeof(Length));
+    memcpy(TO_LAB_QueueAddr(Queue, Offset + sizeof(uint32)), Packet, Length);
+
+    Queue->Tail = Offset + EntrySize;
+    Queue->Used += EntrySize;
+    ++Queue->Count;
+
+    return true;
+}
+
+/*----------------------------------------------------------------
+ * Local helper: top up the token bucket for the time elapsed
+ *-----------------------------------------------------------------*/
+static void TO_LAB_DownlinkRefill(TO_LAB_TokenBucket_t *Bucket)
+{
+    OS_time_t Now;
+    int64     ElapsedUsec;
+    uint64    NewTokens;
+    uint64    GrantedUsec;
+
+    OS_GetLocalTime(&Now);
+    ElapsedUsec = OS_TimeGetTotalMicroseconds(OS_TimeSubtract(Now, Bucket->LastRefill));
+
+    if (ElapsedUsec <= 0)
+    {
+        return;
+    }
+
+    /* avoid overflow after a long idle period, this is already enough to fill any bucket */
+    if (ElapsedUsec > TO_LAB_REFILL_MAX_USEC)
+    {
+        ElapsedUsec = TO_LAB_REFILL_MAX_USEC;
+    }
+
+    NewTokens = ((uint64)Bucket->BytesPerSec * (uint64)ElapsedUsec) / 1000000;
+    if (NewTokens == 0)
+    {
+        /* keep the fraction accruing rather than discarding it */
+        return;
+    }
+
+    NewTokens += Bucket->Tokens;
+    if (NewTokens >= Bucket->BurstBytes)
+    {
+        /* bucket is full, any time beyond what fills it is not carried over */
+        Bucket->Tokens     = Bucket->BurstBytes;
+        Bucket->LastRefill = Now;
+        return;
+    }
+
+    /*
+     * Only advance by the time the granted tokens account for (rounded up, so
+     * the configured rate is never exceeded), the remainder carries over to
+     * the next refill.
+     */
+    GrantedUsec = (((NewTokens - Bucket->Tokens) * 1000000) + Bucket->BytesPerSec - 1) / Bucket->BytesPerSec;
+
+    Bucket->Tokens     = (uint32)NewTokens;
+    Bucket->LastRefill = OS_TimeAdd(Bucket->LastRefill, OS_TimeFromTotalMicroseconds((int64)GrantedUsec));
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* TO_LAB_DownlinkInit() -- Reset scheduler state                  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void TO_LAB_DownlinkInit(void)
+{
+    memset(&TO_LAB_Downlink, 0, sizeof(TO_LAB_Downlink));
+
+    TO_LAB_DownlinkSetRate(TO_LAB_DEFAULT_BYTES_PER_SEC, TO_LAB_DEFAULT_BURST_BYTES);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* TO_LAB_DownlinkSetStreamPolicy() -- Add or update a stream      */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void TO_LAB_DownlinkSetStreamPolicy(CFE_SB_MsgId_t MsgId, const CFE_SB_Qos_t *Flags, uint8 DropPolicy,
+                                    uint8 Decimation)
+{
+    TO_LAB_StreamPolicy_t *Policy;
+
+    Policy = TO_LAB_DownlinkFindStream(MsgId);
+    if (Policy == NULL)
+    {
+        if (TO_LAB_Downlink.NumStreams >= CFE_PLATFORM_SB_MAX_MSG_IDS)
+        {
+            return;
+        }
+
+        Policy        = &TO_LAB_Downlink.Stream[TO_LAB_Downlink.NumStreams];
+        Policy->MsgId = MsgId;
+        ++TO_LAB_Downlink.NumStreams;
+    }
+
+    Policy->Priority = Flags->Priority;
+    if (Policy->Priority >= TO_LAB_MAX_PRIORITY_LEVELS)
+    {
+        Policy->Priority = TO_LAB_MAX_PRIORITY_LEVELS - 1;
+    }
+
+    Policy->DropPolicy      = DropPolicy;
+    Policy->Decimation      = Decimation;
+    Policy->DecimationCount = 0;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* TO_LAB_DownlinkClearStreamPolicy() -- Remove a stream           */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void TO_LAB_DownlinkClearStreamPolicy(CFE_SB_MsgId_t MsgId)
+{
+    TO_LAB_StreamPolicy_t *Policy;
+
+    Policy = TO_LAB_DownlinkFindStream(MsgId);
+    if (Policy != NULL)
+    {
+        /* keep the list dense by moving the last entry into the hole */
+        --TO_LAB_Downlink.NumStreams;
+        *Policy = TO_LAB_Downlink.Stream[TO_LAB_Downlink.NumStreams];
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* TO_LAB_DownlinkClearAllStreamPolicies() -- Remove all streams   */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void TO_LAB_DownlinkClearAllStreamPolicies(void)
+{
+    TO_LAB_Downlink.NumStreams = 0;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* TO_LAB_DownlinkEnqueue() -- Queue one packet for output         */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void TO_LAB_DownlinkEnqueue(const CFE_SB_Buffer_t *SBBufPtr, size_t Size)
+{
+    TO_LAB_StreamPolicy_t * Policy;
+    TO_LAB_PriorityQueue_t *Queue;
+    CFE_SB_MsgId_t          MsgId      = CFE_SB_INVALID_MSG_ID;
+    uint8                   Priority   = 0;
+    uint8                   DropPolicy = TO_LAB_DROP_NEWEST;
+
+    CFE_MSG_GetMsgId(&SBBufPtr->Msg, &MsgId);
+
+    Policy = TO_LAB_DownlinkFindStream(MsgId);
+    if (Policy != NULL)
+    {
+        if (Policy->Decimation > 1)
+        {
+            if (Policy->DecimationCount != 0)
+            {
+                ++TO_LAB_Downlink.PacketsDecimated;
+                Policy->DecimationCount = (Policy->DecimationCount + 1) % Policy->Decimation;
+                return;
+            }
+            Policy->DecimationCount = 1;
+        }
+
+        Priority   = Policy->Priority;
+        DropPolicy = Policy->DropPolicy;
+    }
+
+    Queue = &TO_LAB_Downlink.Queue[Priority];
+
+    if (TO_LAB_QUEUE_ENTRY(Size) > sizeof(Queue->Data))
+    {
+        /* can never fit */
+        ++TO_LAB_Downlink.PacketsDropped;
+        return;
+    }
+
+    while (!TO_LAB_QueuePush(Queue, SBBufPtr, Size))
+    {
+        if (DropPolicy != TO_LAB_DROP_OLDEST || Queue->Count == 0)
+        {
+            ++TO_LAB_Downlink.PacketsDropped;
+            return;
+        }
+
+        TO_LAB_QueuePop(Queue);
+        ++TO_LAB_Downlink.PacketsDropped;
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* TO_LAB_DownlinkService() -- Drain queues within the rate limit  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+int32 TO_LAB_DownlinkService(osal_id_t SockId, const OS_SockAddr_t *Addr)
+{
+    TO_LAB_TokenBucket_t *  Bucket = &TO_LAB_Downlink.Bucket;
+    TO_LAB_PriorityQueue_t *Queue;
+    uint8 *                 DataPtr;
+    uint32                  Length;
+    int32                   status = OS_SUCCESS;
+    int32                   Level;
+
+    if (Bucket->BytesPerSec != 0)
+    {
+        TO_LAB_DownlinkRefill(Bucket);
+    }
+
+    for (Level = TO_LAB_MAX_PRIORITY_LEVELS - 1; Level >= 0; --Level)
+    {
+        Queue = &TO_LAB_Downlink.Queue[Level];
+
+        while (Queue->Count > 0)
+        {
+            Length = TO_LAB_QueuePeek(Queue, &DataPtr);
+
+            if (Bucket->BytesPerSec != 0)
+            {
+                /*
+                 * Stop at the first packet that does not fit, so lower
+                 * priorities cannot overtake it.  A full bucket always
+                 * admits one packet so that packets larger than the
+                 * burst size are not stuck forever.
+                 */
+                if (Length > Bucket->Tokens && Bucket->Tokens < Bucket->BurstBytes)
+                {
+                    ++TO_LAB_Downlink.RateLimitHolds;
+                    return status;
+                }
+
+                Bucket->Tokens = (Length > Bucket->Tokens) ? 0 : (Bucket->Tokens - Length);
+            }
+
+            CFE_ES_PerfLogEntry(TO_LAB_SOCKET_SEND_PERF_ID);
+
+            status = OS_SocketSendTo(SockId, DataPtr, Length, Addr);
+
+            CFE_ES_PerfLogExit(TO_LAB_SOCKET_SEND_PERF_ID);
+
+            TO_LAB_QueuePop(Queue);
+
+            if (status < 0)
+            {
+                return status;
+            }
+
+            ++TO_LAB_Downlink.PacketsSent;
+        }
+    }
+
+    return OS_SUCCESS;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* TO_LAB_DownlinkFlush() -- Discard all queued packets            */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void TO_LAB_DownlinkFlush(void)
+{
+    uint32 i;
+
+    for (i = 0; i < TO_LAB_MAX_PRIORITY_LEVELS; ++i)
+    {
+        TO_LAB_Downlink.Queue[i].Head  = 0;
+        TO_LAB_Downlink.Queue[i].Tail  = 0;
+        TO_LAB_Downlink.Queue[i].Used  = 0;
+        TO_LAB_Downlink.Queue[i].Count = 0;
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* TO_LAB_DownlinkSetRate() -- Configure the token bucket          */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+int32 TO_LAB_DownlinkSetRate(uint32 BytesPerSec, uint32 BurstBytes)
+{
+    TO_LAB_TokenBucket_t *Bucket = &TO_LAB_Downlink.Bucket;
+
+    if (BytesPerSec != 0 && BurstBytes == 0)
+    {
+        return CFE_STATUS_RANGE_ERROR;
+    }
+
+    Bucket->BytesPerSec = BytesPerSec;
+    Bucket->BurstBytes  = BurstBytes;
+    Bucket->Tokens      = BurstBytes;
+    OS_GetLocalTime(&Bucket->LastRefill);
+
+    return CFE_SUCCESS;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* TO_LAB_DownlinkReportStats() -- Fill HK counters                */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void TO_LAB_DownlinkReportStats(TO_LAB_HkTlm_Payload_t *Payload)
+{
+    uint32 i;
+
+    Payload->PacketsSent      = TO_LAB_Downlink.PacketsSent;
+    Payload->PacketsDropped   = TO_LAB_Downlink.PacketsDropped;
+    Payload->PacketsDecimated = TO_LAB_Downlink.PacketsDecimated;
+    Payload->RateLimitHolds   = TO_LAB_Downlink.RateLimitHolds;
+    Payload->BytesPerSec      = TO_LAB_Downlink.Bucket.BytesPerSec;
+    Payload->QueuedBytes      = 0;
+
+    for (i = 0; i < TO_LAB_MAX_PRIORITY_LEVELS; ++i)
+    {
+        Payload->QueuedBytes += TO_LAB_Downlink.Queue[i].Used;
+        Payload->QueuedPackets[i] = TO_LAB_Downlink.Queue[i].Count;
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* TO_LAB_DownlinkResetStats() -- Zero scheduler counters          */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void TO_LAB_DownlinkResetStats(void)
+{
+    TO_LAB_Downlink.PacketsSent      = 0;
+    TO_LAB_Downlink.PacketsDropped   = 0;
+    TO_LAB_Downlink.PacketsDecimated = 0;
+    TO_LAB_Downlink.RateLimitHolds   = 0;
+}
@@ -0,0 +1,96 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   Define TO Lab downlink scheduler
+ *
+ * Telemetry read from the TO pipe is copied into one queue per priority
+ * level.  Each service cycle drains the queues highest priority first,
+ * subject to a token bucket byte-rate limit on the destination, so that
+ * high priority packets never wait behind bulk data when the link is
+ * saturated.
+ */
+#ifndef TO_LAB_DOWNLINK_H
+#define TO_LAB_DOWNLINK_H
+
+#include "cfe.h"
+#include "to_lab_msg.h"
+#include "to_lab_sub_table.h"
+
+/**
+ * Reset all queues, stream policies and counters and apply the
+ * default rate limit.
+ */
+void TO_LAB_DownlinkInit(void);
+
+/**
+ * Record the priority, drop and decimation policy for a subscribed stream.
+ * A stream that is already known is updated in place.
+ */
+void TO_LAB_DownlinkSetStreamPolicy(CFE_SB_MsgId_t MsgId, const CFE_SB_Qos_t *Flags, uint8 DropPolicy,
+                                    uint8 Decimation);
+
+/**
+ * Forget the policy for a stream, e.g. after it has been unsubscribed.
+ */
+void TO_LAB_DownlinkClearStreamPolicy(CFE_SB_MsgId_t MsgId);
+
+/**
+ * Forget the policy of every stream.
+ */
+void TO_LAB_DownlinkClearAllStreamPolicies(void);
+
+/**
+ * Copy one packet into the queue selected by its stream policy,
+ * applying decimation and the drop policy as needed.
+ */
+void TO_LAB_DownlinkEnqueue(const CFE_SB_Buffer_t *SBBufPtr, size_t Size);
+
+/**
+ * Send queued packets highest priority first until either all queues are
+ * empty or the destination token bucket runs out.
+ *
+ * @returns OS_SUCCESS, or the failing status of OS_SocketSendTo.  The packet
+ *          that failed to send is discarded.
+ */
+int32 TO_LAB_DownlinkService(osal_id_t SockId, const OS_SockAddr_t *Addr);
+
+/**
+ * Discard everything currently queued.
+ */
+void TO_LAB_DownlinkFlush(void);
+
+/**
+ * Change the destination byte-rate limit.  A rate of 0 disables limiting.
+ *
+ * @returns CFE_SUCCESS, or CFE_STATUS_RANGE_ERROR if a rate is given with a zero burst
+ */
+int32 TO_LAB_DownlinkSetRate(uint32 BytesPerSec, uint32 BurstBytes);
+
+/**
+ * Copy the scheduler counters into the housekeeping payload.
+ */
+void TO_LAB_DownlinkReportStats(TO_LAB_HkTlm_Payload_t *Payload);
+
+/**
+ * Zero the scheduler counters.
+ */
+void TO_LAB_DownlinkResetStats(void);
+
+#endif
@@ -23,6 +23,8 @@
 #ifndef TO_LAB_MSG_H
 #define TO_LAB_MSG_H
 
+#include "to_lab_sub_table.h"
+
 #define TO_LAB_NOOP_CC            0 /*  no-op command     */
 #define TO_LAB_RESET_STATUS_CC    1 /*  reset status      */
 #define TO_LAB_ADD_PKT_CC         2 /*  add packet        */
@@ -30,14 +32,22 @@
 #define TO_LAB_REMOVE_PKT_CC      4 /*  remove packet     */
 #define TO_LAB_REMOVE_ALL_PKT_CC  5 /*  remove all packet */
 #define TO_LAB_OUTPUT_ENABLE_CC   6 /*  output enable     */
+#define TO_LAB_SET_RATE_CC        7 /*  set downlink rate */
 
 /******************************************************************************/
 
 typedef struct
 {
-    uint8 CommandCounter;
-    uint8 CommandErrorCounter;
-    uint8 spareToAlign[2];
+    uint8  CommandCounter;
+    uint8  CommandErrorCounter;
+    uint8  spareToAlign[2];
+    uint32 PacketsSent;      /**< \brief Packets written to the downlink socket */
+    uint32 PacketsDropped;   /**< \brief Packets discarded due to a full priority queue */
+    uint32 PacketsDecimated; /**< \brief Packets skipped by per-stream decimation */
+    uint32 RateLimitHolds;   /**< \brief Service cycles stopped early by the byte-rate limit */
+    uint32 BytesPerSec;      /**< \brief Current byte-rate limit, 0 if unlimited */
+    uint32 QueuedBytes;      /**< \brief Bytes currently held across all priority queues */
+    uint16 QueuedPackets[TO_LAB_MAX_PRIORITY_LEVELS]; /**< \brief Packets held per priority */
 } TO_LAB_HkTlm_Payload_t;
 
 typedef struct
@@ -132,6 +142,20 @@ typedef struct
 
 /******************************************************************************/
 
+typedef struct
+{
+    uint32 BytesPerSec; /**< \brief Sustained downlink rate, 0 disables rate limiting */
+    uint32 BurstBytes;  /**< \brief Token bucket depth, bytes that may be sent back to back */
+} TO_LAB_SetRate_Payload_t;
+
+typedef struct
+{
+    CFE_MSG_CommandHeader_t  CmdHeader; /**< \brief Command header */
+    TO_LAB_SetRate_Payload_t Payload;   /**< \brief Command payload */
+} TO_LAB_SetRateCmd_t;
+
+/******************************************************************************/
+
 typedef struct
 {
     char dest_IP[16];
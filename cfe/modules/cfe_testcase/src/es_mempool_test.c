@@ -199,6 +199,69 @@ void TestMemPoolDelete(void)
     UtAssert_INT32_EQ(CFE_ES_PoolDelete(CFE_ES_MEMHANDLE_UNDEFINED), CFE_ES_ERR_RESOURCEID_NOT_VALID);
 }
 
+void TestMemPoolFragmentation(void)
+{
+    CFE_ES_MemHandle_t  PoolID = CFE_ES_MEMHANDLE_UNDEFINED;
+    static uint32       Pool[2048];
+    CFE_ES_MemPoolBuf_t Large[16];
+    CFE_ES_MemPoolBuf_t Small;
+    uint32              NumLarge;
+    uint32              NumSmall;
+    uint32              i;
+    OS_time_t           StartTime;
+    OS_time_t           EndTime;
+    int64               ElapsedUs;
+
+    UtPrintf("Testing: CFE_ES_GetPoolBuf, CFE_ES_PutPoolBuf fragmentation and throughput");
+
+    UtAssert_INT32_EQ(CFE_ES_PoolCreateNoSem(&PoolID, Pool, sizeof(Pool)), CFE_SUCCESS);
+
+    /* Throughput: repeated get/put of the same size from the same pool */
+    OS_GetLocalTime(&StartTime);
+    for (i = 0; i < 10000; ++i)
+    {
+        if (CFE_ES_GetPoolBuf(&Small, PoolID, 64) < 0 || CFE_ES_PutPoolBuf(PoolID, Small) < 0)
+        {
+            break;
+        }
+    }
+    OS_GetLocalTime(&EndTime);
+    UtAssert_UINT32_EQ(i, 10000);
+
+    ElapsedUs = OS_TimeGetTotalMicroseconds(OS_TimeSubtract(EndTime, StartTime));
+    UtAssert_MIR("%lu get/put cycles took %ld usec", (unsigned long)i, (long)ElapsedUs);
+
+    /* Fragmentation: fill the pool with large blocks, release them, then ask for small ones */
+    NumLarge = 0;
+    while (NumLarge < (sizeof(Large) / sizeof(Large[0])) &&
+           CFE_ES_GetPoolBuf(&Large[NumLarge], PoolID, 1000) >= 0)
+    {
+        ++NumLarge;
+    }
+    UtAssert_NONZERO(NumLarge);
+
+    for (i = 0; i < NumLarge; ++i)
+    {
+        UtAssert_INT32_GT(CFE_ES_PutPoolBuf(PoolID, Large[i]), 0);
+    }
+
+    NumSmall = 0;
+    while (NumSmall < 1000 && CFE_ES_GetPoolBuf(&Small, PoolID, 32) >= 0)
+    {
+        ++NumSmall;
+    }
+    UtAssert_MIR("%lu small blocks allocated after releasing %lu large blocks", (unsigned long)NumSmall,
+                 (unsigned long)NumLarge);
+
+    if (CFE_PLATFORM_ES_MEMPOOL_COALESCE)
+    {
+        /* released large blocks are merged and split, so the small blocks must fit in the same space */
+        UtAssert_UINT32_GT(NumSmall, NumLarge);
+    }
+
+    UtAssert_INT32_EQ(CFE_ES_PoolDelete(PoolID), CFE_SUCCESS);
+}
+
 void ESMemPoolTestSetup(void)
 {
     UtTest_Add(TestMemPoolCreate, NULL, NULL, "Test Mem Pool Create");
@@ -207,4 +270,5 @@ void ESMemPoolTestSetup(void)
     UtTest_Add(TestMemPoolBufInfo, NULL, NULL, "Test Mem Pool Buf Info");
     UtTest_Add(TestMemPoolPutBuf, NULL, NULL, "Test Mem Pool Put Buf");
     UtTest_Add(TestMemPoolDelete, NULL, NULL, "Test Mem Pool Delete");
+    UtTest_Add(TestMemPoolFragmentation, NULL, NULL, "Test Mem Pool Fragmentation");
 }
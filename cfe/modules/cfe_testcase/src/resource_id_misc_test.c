@@ -212,6 +212,70 @@ void TestToIndex(void)
     UtAssert_INT32_LTEQ(idx, CFE_PLATFORM_ES_MAX_APPLICATIONS);
 }
 
+/*
+ * Measure the cost of converting IDs to table indices, which is done every time
+ * an ID is resolved to its internal record.  This compares the generic function
+ * against the inline conversion used by the per-type ES/SB helpers, for a table
+ * size that is a power of two (a mask) and one that is not (a division).
+ * This is informational only, as the result depends on the platform.
+ */
+void TestToIndexThroughput(void)
+{
+    union
+    {
+        CFE_ES_AppId_t   AppId;
+        CFE_ResourceId_t ResourceID;
+    } AppIdBuf;
+    uint32    idx;
+    uint32    i;
+    uint32    Sum;
+    int32     Status;
+    OS_time_t StartTime;
+    OS_time_t EndTime;
+    int       APPID_BASE = CFE_RESOURCEID_MAKE_BASE(OS_OBJECT_TYPE_USER + 1);
+
+    UtPrintf("Testing: CFE_ResourceId_ToIndex throughput");
+
+    /* The serial number varies so the conversion cannot be hoisted out of the loops */
+    Sum    = 0;
+    Status = CFE_SUCCESS;
+    OS_GetLocalTime(&StartTime);
+    for (i = 0; i < 100000 && Status == CFE_SUCCESS; ++i)
+    {
+        AppIdBuf.ResourceID = CFE_ResourceId_FromInteger(APPID_BASE + (i & 0xFFF));
+        Status              = CFE_ResourceId_ToIndex(AppIdBuf.ResourceID, APPID_BASE, 64, &idx);
+        Sum += idx;
+    }
+    OS_GetLocalTime(&EndTime);
+    CFE_Assert_STATUS_OK(Status);
+    UtAssert_MIR("%lu CFE_ResourceId_ToIndex() calls took %ld usec", (unsigned long)i,
+                 (long)OS_TimeGetTotalMicroseconds(OS_TimeSubtract(EndTime, StartTime)));
+
+    OS_GetLocalTime(&StartTime);
+    for (i = 0; i < 100000 && Status == CFE_SUCCESS; ++i)
+    {
+        AppIdBuf.ResourceID = CFE_ResourceId_FromInteger(APPID_BASE + (i & 0xFFF));
+        Status              = CFE_RESOURCEID_TO_INDEX(AppIdBuf.AppId, APPID_BASE, 64, &idx);
+        Sum += idx;
+    }
+    OS_GetLocalTime(&EndTime);
+    CFE_Assert_STATUS_OK(Status);
+    UtAssert_MIR("%lu inline conversions with a power of two table took %ld usec", (unsigned long)i,
+                 (long)OS_TimeGetTotalMicroseconds(OS_TimeSubtract(EndTime, StartTime)));
+
+    OS_GetLocalTime(&StartTime);
+    for (i = 0; i < 100000 && Status == CFE_SUCCESS; ++i)
+    {
+        AppIdBuf.ResourceID = CFE_ResourceId_FromInteger(APPID_BASE + (i & 0xFFF));
+        Status              = CFE_RESOURCEID_TO_INDEX(AppIdBuf.AppId, APPID_BASE, 63, &idx);
+        Sum += idx;
+    }
+    OS_GetLocalTime(&EndTime);
+    CFE_Assert_STATUS_OK(Status);
+    UtAssert_MIR("%lu inline conversions with another table size took %ld usec (checksum %lu)", (unsigned long)i,
+                 (long)OS_TimeGetTotalMicroseconds(OS_TimeSubtract(EndTime, StartTime)), (unsigned long)Sum);
+}
+
 void ResourceIdMiscTestSetup(void)
 {
     UtTest_Add(TestToFromInteger, NULL, NULL, "Test Resource Id to Integer");
@@ -219,4 +283,5 @@ void ResourceIdMiscTestSetup(void)
     UtTest_Add(TestGetBaseSerial, NULL, NULL, "Test Resource Id Get Base");
     UtTest_Add(TestFindNext, NULL, NULL, "Test Resource Id Find Next");
     UtTest_Add(TestToIndex, NULL, NULL, "Test Resource Id to Index");
+    UtTest_Add(TestToIndexThroughput, NULL, NULL, "Test Resource Id to Index Throughput");
 }
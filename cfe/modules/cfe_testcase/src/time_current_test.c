@@ -30,6 +30,20 @@
 #include "cfe_test.h"
 #include "cfe_time_msg.h"
 
+/*
+ * Number of reads used to measure the cost of reading each time source
+ */
+#define CFE_TEST_TIME_READ_COUNT 100000
+
+/*
+ * Interval over which the PSP time is compared against the OSAL local time,
+ * and the maximum allowed difference.  The OSAL local time is the realtime
+ * clock, which may itself be slewed (by up to 500 ppm on Linux) while the
+ * test runs, so the limit is kept loose.
+ */
+#define CFE_TEST_TIME_DRIFT_MSEC       2000
+#define CFE_TEST_TIME_DRIFT_LIMIT_USEC 2000
+
 void TimeInRange(CFE_TIME_SysTime_t Start, CFE_TIME_SysTime_t Time, CFE_TIME_SysTime_t Range, const char *Str)
 {
     char               StartStr[sizeof("yyyy-ddd-hh:mm:ss.xxxxx_")];
@@ -137,8 +151,77 @@ void TestClock(void)
     UtAssert_BITMASK_UNSET(CFE_TIME_GetClockInfo(), CFE_TIME_FLAG_UNUSED);
 }
 
+void TestPspTimeSource(void)
+{
+    UtPrintf("Testing: CFE_PSP_GetTime, CFE_PSP_Get_Timebase read cost and drift");
+
+    OS_time_t Start;
+    OS_time_t End;
+    OS_time_t PspStart;
+    OS_time_t PspEnd;
+    OS_time_t Prev;
+    OS_time_t Now;
+    uint32    Tbu;
+    uint32    Tbl;
+    uint32    i;
+    uint32    Backwards;
+    int64     DriftUsec;
+
+    /* Cost of reading the PSP time, which should also never go backwards */
+    Backwards = 0;
+    CFE_PSP_GetTime(&Prev);
+    OS_GetLocalTime(&Start);
+    for (i = 0; i < CFE_TEST_TIME_READ_COUNT; ++i)
+    {
+        CFE_PSP_GetTime(&Now);
+        if (OS_TimeGetTotalNanoseconds(OS_TimeSubtract(Now, Prev)) < 0)
+        {
+            ++Backwards;
+        }
+        Prev = Now;
+    }
+    OS_GetLocalTime(&End);
+    UtAssert_UINT32_EQ(Backwards, 0);
+    UtPrintf("CFE_PSP_GetTime: %ld ns/read",
+             (long)(OS_TimeGetTotalNanoseconds(OS_TimeSubtract(End, Start)) / CFE_TEST_TIME_READ_COUNT));
+
+    OS_GetLocalTime(&Start);
+    for (i = 0; i < CFE_TEST_TIME_READ_COUNT; ++i)
+    {
+        CFE_PSP_Get_Timebase(&Tbu, &Tbl);
+    }
+    OS_GetLocalTime(&End);
+    UtPrintf("CFE_PSP_Get_Timebase: %ld ns/read",
+             (long)(OS_TimeGetTotalNanoseconds(OS_TimeSubtract(End, Start)) / CFE_TEST_TIME_READ_COUNT));
+
+    /* For comparison, the OSAL local time is always read through clock_gettime() */
+    OS_GetLocalTime(&Start);
+    for (i = 0; i < CFE_TEST_TIME_READ_COUNT; ++i)
+    {
+        OS_GetLocalTime(&Now);
+    }
+    OS_GetLocalTime(&End);
+    UtPrintf("OS_GetLocalTime: %ld ns/read",
+             (long)(OS_TimeGetTotalNanoseconds(OS_TimeSubtract(End, Start)) / CFE_TEST_TIME_READ_COUNT));
+
+    /* Drift of the PSP time against the OSAL local time */
+    CFE_PSP_GetTime(&PspStart);
+    OS_GetLocalTime(&Start);
+    UtAssert_INT32_EQ(OS_TaskDelay(CFE_TEST_TIME_DRIFT_MSEC), OS_SUCCESS);
+    CFE_PSP_GetTime(&PspEnd);
+    OS_GetLocalTime(&End);
+
+    DriftUsec = OS_TimeGetTotalMicroseconds(OS_TimeSubtract(PspEnd, PspStart)) -
+                OS_TimeGetTotalMicroseconds(OS_TimeSubtract(End, Start));
+    UtPrintf("CFE_PSP_GetTime drift: %ld usec over %lu msec", (long)DriftUsec,
+             (unsigned long)CFE_TEST_TIME_DRIFT_MSEC);
+    UtAssert_True(DriftUsec <= CFE_TEST_TIME_DRIFT_LIMIT_USEC && DriftUsec >= -CFE_TEST_TIME_DRIFT_LIMIT_USEC,
+                  "PSP time drift %ld usec within %ld usec", (long)DriftUsec, (long)CFE_TEST_TIME_DRIFT_LIMIT_USEC);
+}
+
 void TimeCurrentTestSetup(void)
 {
     UtTest_Add(TestGetTime, NULL, NULL, "Test Current Time");
     UtTest_Add(TestClock, NULL, NULL, "Test Clock");
+    UtTest_Add(TestPspTimeSource, NULL, NULL, "Test PSP Time Source");
 }
@@ -171,6 +171,31 @@ CFE_Status_t CFE_ES_TaskID_ToIndex(CFE_ES_TaskId_t TaskID, uint32 *Idx);
  */
 CFE_Status_t CFE_ES_CounterID_ToIndex(CFE_ES_CounterId_t CounterId, uint32 *Idx);
 
+/**
+ * @brief Obtain an index value correlating to an ES Background Job ID
+ *
+ * This calculates a zero based integer value that may be used for indexing
+ * into a local resource table/array.
+ *
+ * Index values are only guaranteed to be unique for resources of the same
+ * type.  For instance, the indices corresponding to two [valid] Background Job
+ * IDs will never overlap, but the index of a Background Job and a Counter ID
+ * may be the same.  Furthermore, indices may be reused if a resource is
+ * deleted and re-created.
+ *
+ * @note There is no inverse of this function - indices cannot be converted
+ * back to the original JobId value.  The caller should retain the original ID
+ * for future use.
+ *
+ * @param[in]   JobId   Background Job ID to convert
+ * @param[out]  Idx     Buffer where the calculated index will be stored @nonnull
+ *
+ * @return Execution status, see @ref CFEReturnCodes
+ * @retval #CFE_SUCCESS                      @copybrief CFE_SUCCESS
+ * @retval #CFE_ES_ERR_RESOURCEID_NOT_VALID  @copybrief CFE_ES_ERR_RESOURCEID_NOT_VALID
+ */
+CFE_Status_t CFE_ES_BackgroundJobID_ToIndex(CFE_ES_BackgroundJobId_t JobId, uint32 *Idx);
+
 /** @} */
 
 /*****************************************************************************/
@@ -817,7 +842,8 @@ int32 CFE_ES_GetModuleInfo(CFE_ES_AppInfo_t *ModuleInfo, CFE_ResourceId_t Resour
 ** \param[in]   Priority      The priority for the new task.  Lower numbers are higher priority, with 0 being
 **                            the highest priority.
 **
-** \param[in]   Flags         Reserved for future expansion.
+** \param[in]   Flags         Task options.  A CPU affinity mask encoded with #OS_TASK_CPU_AFFINITY
+**                            restricts the CPUs the task may run on; other bits are reserved.
 **
 ** \return Execution status, see \ref CFEReturnCodes
 ** \retval #CFE_SUCCESS                      \copybrief CFE_SUCCESS
@@ -930,6 +956,50 @@ CFE_Status_t CFE_ES_DeleteChildTask(CFE_ES_TaskId_t TaskId);
 **
 ******************************************************************************/
 void CFE_ES_ExitChildTask(void);
+
+/*****************************************************************************/
+/**
+** \brief Runs a short job on the shared OSAL task pool
+**
+** \par Description
+**        This routine queues JobFunc(JobArg) to be run by one of a fixed set of
+**        worker threads, and returns without waiting for it.  It is intended for
+**        CPU-bound work that can be split into independent pieces, such as
+**        compressing an image or checking a large file, where creating a child
+**        task for each piece would cost more than the work itself.
+**
+** \par Assumptions, External Events, and Notes:
+**        Jobs do not run in the context of the calling Application, and the worker
+**        threads are not cFE tasks.  A job must not call cFE functions that act on
+**        the calling task or Application, such as #CFE_EVS_SendEvent,
+**        #CFE_SB_ReceiveBuffer or this function, and should signal its completion
+**        itself, e.g. with an OSAL semaphore or queue.  Jobs all run at the pool
+**        priority (#OS_TASK_POOL_PRIORITY), regardless of the caller's priority.
+**
+**        ES counts the jobs of each Application that are queued or running.  An
+**        Application that is being stopped, restarted or reloaded waits about one
+**        second for its jobs to return, since they may use its code and data, and
+**        it may not submit new jobs once it has left the RUNNING state.  If a job
+**        is still pending after that, the Application is cleaned up anyway but its
+**        module is not unloaded, the same as for a background job that is still
+**        being called.
+**
+** \param[in]   JobFunc   A pointer to the function to run @nonnull.
+**
+** \param[in]   JobArg    Opaque argument passed to JobFunc.
+**
+** \return Execution status, see \ref CFEReturnCodes
+** \retval #CFE_SUCCESS                       \copybrief CFE_SUCCESS
+** \retval #CFE_ES_BAD_ARGUMENT               \copybrief CFE_ES_BAD_ARGUMENT
+** \retval #CFE_ES_ERR_RESOURCEID_NOT_VALID   \copybrief CFE_ES_ERR_RESOURCEID_NOT_VALID
+** \retval #CFE_ES_NO_RESOURCE_IDS_AVAILABLE  if #OS_MAX_TASK_POOL_JOBS jobs are already queued or running
+** \retval #CFE_ES_NOT_IMPLEMENTED            if the OS does not provide a task pool
+** \retval #CFE_STATUS_EXTERNAL_RESOURCE_FAIL \covtest \copybrief CFE_STATUS_EXTERNAL_RESOURCE_FAIL
+**
+** \sa #CFE_ES_CreateChildTask
+**
+******************************************************************************/
+CFE_Status_t CFE_ES_TaskPoolSubmit(CFE_ES_TaskPoolJobFuncPtr_t JobFunc, void *JobArg);
 /**@}*/
 
 /** @defgroup CFEAPIESMisc cFE Miscellaneous APIs
@@ -966,7 +1036,10 @@ void CFE_ES_BackgroundWakeup(void);
 **        critical errors, and conditionally compiled debug software.
 **
 ** \par Assumptions, External Events, and Notes:
-**        None
+**        Once the ES background task is running, the message is staged and
+**        written to the log and the console by that task shortly afterwards.
+**        In that case #CFE_ES_ERR_SYS_LOG_FULL is based on the state of the
+**        log at the time of the call.
 **
 ** \param[in]   SpecStringPtr     The format string for the log message @nonnull.
 **                                This is similar to the format string for a printf() call.
@@ -1315,6 +1388,44 @@ CFE_Status_t CFE_ES_PoolCreate(CFE_ES_MemHandle_t *PoolID, void *MemPtr, size_t
 CFE_Status_t CFE_ES_PoolCreateEx(CFE_ES_MemHandle_t *PoolID, void *MemPtr, size_t Size, uint16 NumBlockSizes,
                                  const size_t *BlockSizes, bool UseMutex);
 
+/*****************************************************************************/
+/**
+** \brief Enables per-task caching of released buffers in a memory pool
+**
+** \par Description
+**        After this call, each task using the pool may be given a private cache of
+**        released buffers, of up to #CFE_PLATFORM_ES_MEMPOOL_TASK_CACHE_DEPTH buffers
+**        per block size.  #CFE_ES_PutPoolBuf keeps the buffer in the cache of the
+**        calling task, and #CFE_ES_GetPoolBuf hands it out again, neither taking the
+**        pool mutex.  The mutex is only taken to move a batch of buffers between a
+**        cache and the pool when the cache runs empty or full.  This reduces
+**        contention on pools that are shared by many tasks.
+**
+** \par Assumptions, External Events, and Notes:
+**        -# Only pools created with a mutex (#CFE_ES_PoolCreate, or #CFE_ES_PoolCreateEx
+**           with #CFE_ES_USE_MUTEX) can use caches.
+**        -# Pools that split and merge free blocks (#CFE_PLATFORM_ES_MEMPOOL_COALESCE)
+**           cannot use caches, and this call fails for them.
+**        -# Caching cannot be disabled again for the lifetime of the pool.
+**        -# At most #CFE_PLATFORM_ES_MEMPOOL_TASK_CACHES tasks have a cache at the same
+**           time, further tasks use the pool directly.  Caches are returned to the pool
+**           when their task is deleted through ES.
+**        -# Buffers held in caches are reported as free by #CFE_ES_GetMemPoolStats,
+**           but remain tied to their block size, so a pool using caches may need to be
+**           sized for a few more buffers than one that does not.
+**
+** \param[in]   Handle         The handle to the memory pool as returned by #CFE_ES_PoolCreate
+**
+** \return Execution status, see \ref CFEReturnCodes
+** \retval #CFE_SUCCESS                     \copybrief CFE_SUCCESS
+** \retval #CFE_ES_ERR_RESOURCEID_NOT_VALID \copybrief CFE_ES_ERR_RESOURCEID_NOT_VALID
+** \retval #CFE_ES_BAD_ARGUMENT             \copybrief CFE_ES_BAD_ARGUMENT
+**
+** \sa #CFE_ES_PoolCreate, #CFE_ES_PoolCreateEx, #CFE_ES_GetPoolBuf, #CFE_ES_PutPoolBuf, #CFE_ES_GetMemPoolStats
+**
+******************************************************************************/
+CFE_Status_t CFE_ES_PoolEnableTaskCache(CFE_ES_MemHandle_t Handle);
+
 /*****************************************************************************/
 /**
 ** \brief Deletes a memory pool that was previously created
@@ -1699,4 +1810,97 @@ CFE_Status_t CFE_ES_GetGenCounterName(char *CounterName, CFE_ES_CounterId_t Coun
 
 /**@}*/
 
+/** @defgroup CFEAPIESBackground cFE Background Job APIs
+ * @{
+ */
+
+/*****************************************************************************/
+/**
+** \brief Register a background job
+**
+** \par Description
+**        This routine registers a function to be called periodically from an ES
+**        background worker task.  This is intended for long-running, non real time
+**        work such as file writes and table scans, which is done in small steps.
+**
+** \par Assumptions, External Events, and Notes:
+**        The job is first called as soon as a worker is free.  After each call it is
+**        due again after \c ActivePeriod milliseconds if it returned true, or after
+**        \c IdlePeriod milliseconds if it returned false.  When several jobs are due
+**        at once, the one with the lowest \c Priority value is called first, and
+**        jobs of equal priority are called in order of their due time.
+**
+**        A job is never called by two workers at the same time, but different jobs may
+**        run concurrently when #CFE_PLATFORM_ES_BACKGROUND_WORKER_TASKS is greater
+**        than one.
+**
+**        The job is deleted automatically when the registering application is deleted.
+**
+** \param[out] JobIdPtr      Buffer to store the ID of the newly registered job @nonnull
+** \param[in]  JobName       The name of the job @nonnull
+** \param[in]  JobFunc       The function to call @nonnull
+** \param[in]  JobArg        Opaque argument passed to each call of JobFunc
+** \param[in]  ActivePeriod  Milliseconds between calls while the job has work pending @nonzero
+** \param[in]  IdlePeriod    Milliseconds between calls while the job is idle @nonzero
+** \param[in]  Priority      Scheduling priority, lower values are more urgent
+**
+** \return Execution status, see \ref CFEReturnCodes
+** \retval #CFE_SUCCESS                       \copybrief CFE_SUCCESS
+** \retval #CFE_ES_BAD_ARGUMENT               \copybrief CFE_ES_BAD_ARGUMENT
+** \retval #CFE_ES_ERR_RESOURCEID_NOT_VALID   \copybrief CFE_ES_ERR_RESOURCEID_NOT_VALID
+** \retval #CFE_ES_ERR_DUPLICATE_NAME         \copybrief CFE_ES_ERR_DUPLICATE_NAME
+** \retval #CFE_ES_NO_RESOURCE_IDS_AVAILABLE  \copybrief CFE_ES_NO_RESOURCE_IDS_AVAILABLE
+**
+** \sa #CFE_ES_DeleteBackgroundJob, #CFE_ES_GetBackgroundJobInfo, #CFE_ES_BackgroundWakeup
+**
+******************************************************************************/
+CFE_Status_t CFE_ES_RegisterBackgroundJob(CFE_ES_BackgroundJobId_t *JobIdPtr, const char *JobName,
+                                          CFE_ES_BackgroundJobFunc_t JobFunc, void *JobArg, uint32 ActivePeriod,
+                                          uint32 IdlePeriod, uint16 Priority);
+
+/*****************************************************************************/
+/**
+** \brief Delete a background job
+**
+** \par Description
+**        This routine deletes a previously registered background job.
+**
+** \par Assumptions, External Events, and Notes:
+**        If a worker is calling the job at the time, that call completes normally
+**        and the job is not called again.
+**
+** \param[in]  JobId     The ID of the job to delete
+**
+** \return Execution status, see \ref CFEReturnCodes
+** \retval #CFE_SUCCESS                      \copybrief CFE_SUCCESS
+** \retval #CFE_ES_ERR_RESOURCEID_NOT_VALID  \copybrief CFE_ES_ERR_RESOURCEID_NOT_VALID
+**
+** \sa #CFE_ES_RegisterBackgroundJob, #CFE_ES_GetBackgroundJobInfo
+**
+******************************************************************************/
+CFE_Status_t CFE_ES_DeleteBackgroundJob(CFE_ES_BackgroundJobId_t JobId);
+
+/*****************************************************************************/
+/**
+** \brief Get information about a background job
+**
+** \par Description
+**        This routine fills the given structure with the settings of a background
+**        job and the run time statistics that ES has collected for it.
+**
+** \param[out]  JobInfo   Pointer to the structure to fill @nonnull
+** \param[in]   JobId     The ID of the job
+**
+** \return Execution status, see \ref CFEReturnCodes
+** \retval #CFE_SUCCESS                      \copybrief CFE_SUCCESS
+** \retval #CFE_ES_ERR_RESOURCEID_NOT_VALID  \copybrief CFE_ES_ERR_RESOURCEID_NOT_VALID
+** \retval #CFE_ES_BAD_ARGUMENT              \copybrief CFE_ES_BAD_ARGUMENT
+**
+** \sa #CFE_ES_RegisterBackgroundJob, #CFE_ES_DeleteBackgroundJob
+**
+******************************************************************************/
+CFE_Status_t CFE_ES_GetBackgroundJobInfo(CFE_ES_BackgroundJobInfo_t *JobInfo, CFE_ES_BackgroundJobId_t JobId);
+
+/**@}*/
+
 #endif /* CFE_ES_H */
@@ -76,6 +76,13 @@ typedef int32 (*CFE_ES_LibraryEntryFuncPtr_t)(
  */
 typedef CFE_ES_TaskEntryFuncPtr_t CFE_ES_ChildTaskMainFuncPtr_t;
 
+/**
+ * \brief Required prototype of task pool job functions
+ *
+ * The argument is the JobArg given to #CFE_ES_TaskPoolSubmit.
+ */
+typedef void (*CFE_ES_TaskPoolJobFuncPtr_t)(void *JobArg);
+
 /**
  * @brief Type for the stack pointer of tasks.
  *
@@ -83,6 +90,41 @@ typedef CFE_ES_TaskEntryFuncPtr_t CFE_ES_ChildTaskMainFuncPtr_t;
  */
 typedef void *CFE_ES_StackPointer_t; /* aka osal_stackptr_t in proposed OSAL change */
 
+/**
+ * \brief Background job function
+ *
+ * Called from an ES background worker task.  ElapsedTime is the number of
+ * milliseconds since the previous call of the same job.  The function should do
+ * a limited amount of work and return true if it has more work pending, or false
+ * if it is idle.
+ */
+typedef bool (*CFE_ES_BackgroundJobFunc_t)(uint32 ElapsedTime, void *Arg);
+
+/**
+ * \brief Background job information
+ *
+ * Structure that is used to provide information about a background job,
+ * including its run time statistics.  All times are measured with the PSP clock.
+ */
+typedef struct CFE_ES_BackgroundJobInfo
+{
+    CFE_ES_BackgroundJobId_t JobId;                            /**< \brief Background Job ID */
+    CFE_ES_AppId_t           AppId;                            /**< \brief Application that registered the job */
+    char                     JobName[CFE_MISSION_MAX_API_LEN]; /**< \brief Background Job Name */
+    uint16                   Priority;                         /**< \brief Priority, lower values are more urgent */
+    bool                     IsRunning;                        /**< \brief Whether the job is being called now */
+    bool                     IsActive;                         /**< \brief Whether the last call had work pending */
+    uint32                   ActivePeriod;                     /**< \brief Milliseconds between calls when active */
+    uint32                   IdlePeriod;                       /**< \brief Milliseconds between calls when idle */
+    uint32                   RunCount;                         /**< \brief Number of calls */
+    uint32                   ActiveCount;                      /**< \brief Number of calls that had work pending */
+    uint32                   LateCount;                        /**< \brief Calls started a period or more late */
+    uint32                   MaxStartDelayMsec;                /**< \brief Longest delay from due time to start */
+    uint32                   LastRunTimeUsec;                  /**< \brief Duration of the last call */
+    uint32                   MaxRunTimeUsec;                   /**< \brief Duration of the longest call */
+    uint32                   TotalRunTimeMsec;                 /**< \brief Total time spent in the job */
+} CFE_ES_BackgroundJobInfo_t;
+
 /**
  * \brief Checksum/CRC algorithm identifiers
  *
@@ -171,6 +213,7 @@ typedef void *CFE_ES_MemPoolBuf_t;
 #define CFE_ES_COUNTERID_C(val) ((CFE_ES_CounterId_t)CFE_RESOURCEID_WRAP(val))
 #define CFE_ES_MEMHANDLE_C(val) ((CFE_ES_MemHandle_t)CFE_RESOURCEID_WRAP(val))
 #define CFE_ES_CDSHANDLE_C(val) ((CFE_ES_CDSHandle_t)CFE_RESOURCEID_WRAP(val))
+#define CFE_ES_BGJOBID_C(val)   ((CFE_ES_BackgroundJobId_t)CFE_RESOURCEID_WRAP(val))
 
 /** \} */
 
@@ -183,6 +226,7 @@ typedef void *CFE_ES_MemPoolBuf_t;
 #define CFE_ES_COUNTERID_UNDEFINED CFE_ES_COUNTERID_C(CFE_RESOURCEID_UNDEFINED)
 #define CFE_ES_MEMHANDLE_UNDEFINED CFE_ES_MEMHANDLE_C(CFE_RESOURCEID_UNDEFINED)
 #define CFE_ES_CDS_BAD_HANDLE      CFE_ES_CDSHANDLE_C(CFE_RESOURCEID_UNDEFINED)
+#define CFE_ES_BGJOBID_UNDEFINED   CFE_ES_BGJOBID_C(CFE_RESOURCEID_UNDEFINED)
 /** \} */
 
 /** \name Task Stack Constants */
@@ -132,6 +132,10 @@ typedef struct CFE_FS_FileWriteMetaData
 
     CFE_FS_FileWriteGetData_t GetData; /**< Application callback to get a data record */
     CFE_FS_FileWriteOnEvent_t OnEvent; /**< Application callback for abstract event processing */
+
+    /* Statistics of the file write, set by FS before the complete event is generated */
+    uint32 WriteCount;  /**< Number of write calls used for the file, including the header */
+    uint32 ElapsedMsec; /**< Time from creating the file to completing it */
 } CFE_FS_FileWriteMetaData_t;
 
 #endif /* CFE_FS_API_TYPEDEFS_H */
@@ -77,6 +77,15 @@
  */
 #define CFE_RESOURCEID_TEST_EQUAL(id1, id2) CFE_ResourceId_Equal(CFE_RESOURCEID_UNWRAP(id1), CFE_RESOURCEID_UNWRAP(id2))
 
+/**
+ * \brief Number of uint32 words in a slot usage map for a table of the given size
+ *
+ * A slot usage map holds one bit per table entry, which is set while the entry
+ * is in use.  It is used with CFE_ResourceId_FindNextFree() to allocate IDs
+ * without probing every table entry.
+ */
+#define CFE_RESOURCEID_MAP_WORDS(size) (((size) + 31) / 32)
+
 /**
  * @brief Convert a resource ID to an integer.
  *
@@ -153,6 +162,28 @@ static inline bool CFE_ResourceId_IsDefined(CFE_ResourceId_t id)
     return (!CFE_ResourceId_Equal(id, CFE_RESOURCEID_UNDEFINED));
 }
 
+/**
+ * @brief Mark a table index as used in a slot usage map
+ *
+ * @param[inout] UsedMap  the slot usage map, see #CFE_RESOURCEID_MAP_WORDS
+ * @param[in]    Idx      the table index
+ */
+static inline void CFE_ResourceId_MapSetUsed(uint32 *UsedMap, uint32 Idx)
+{
+    UsedMap[Idx / 32] |= (1U << (Idx % 32));
+}
+
+/**
+ * @brief Mark a table index as free in a slot usage map
+ *
+ * @param[inout] UsedMap  the slot usage map, see #CFE_RESOURCEID_MAP_WORDS
+ * @param[in]    Idx      the table index
+ */
+static inline void CFE_ResourceId_MapSetFree(uint32 *UsedMap, uint32 Idx)
+{
+    UsedMap[Idx / 32] &= ~(1U << (Idx % 32));
+}
+
 /** \} */
 
 /*
@@ -203,6 +234,42 @@ uint32 CFE_ResourceId_GetSerial(CFE_ResourceId_t ResourceId);
 CFE_ResourceId_t CFE_ResourceId_FindNext(CFE_ResourceId_t StartId, uint32 TableSize,
                                          bool (*CheckFunc)(CFE_ResourceId_t));
 
+/**
+ * @brief Locate the next resource ID which does not map to an in-use table entry, using a slot usage map
+ *
+ * This returns the same ID as CFE_ResourceId_FindNext() would, but only calls
+ * CheckFunc for the entries that are marked free in the slot usage map, which
+ * is located with a word-at-a-time bit search.  The returned entry is marked
+ * used in the map.  The caller must release it again with
+ * CFE_ResourceId_MapRelease() when the entry is freed, including when the
+ * creation of the resource fails.
+ *
+ * The map is only used as a hint: CheckFunc remains authoritative, and if every
+ * entry is marked used, the table is scanned in the same way as
+ * CFE_ResourceId_FindNext() before reporting that no ID is available.
+ *
+ * @param[in]    StartId   the last issued ID for the resource category (app, lib, etc).
+ * @param[in]    TableSize the maximum size of the target table
+ * @param[inout] UsedMap   the slot usage map for the table, see #CFE_RESOURCEID_MAP_WORDS
+ * @param[in]    CheckFunc a function to check if the given ID is available
+ * @returns      Next ID value which does not map to a valid entry
+ * @retval       #CFE_RESOURCEID_UNDEFINED if no open slots or bad arguments.
+ */
+CFE_ResourceId_t CFE_ResourceId_FindNextFree(CFE_ResourceId_t StartId, uint32 TableSize, uint32 *UsedMap,
+                                             bool (*CheckFunc)(CFE_ResourceId_t));
+
+/**
+ * @brief Mark the table entry of a resource ID as free in a slot usage map
+ *
+ * This is the counterpart of CFE_ResourceId_FindNextFree(), to be called when
+ * the table entry of the ID is released.  Undefined and reserved IDs are ignored.
+ *
+ * @param[in]    Id        the resource ID being released
+ * @param[in]    TableSize the maximum size of the target table
+ * @param[inout] UsedMap   the slot usage map for the table, see #CFE_RESOURCEID_MAP_WORDS
+ */
+void CFE_ResourceId_MapRelease(CFE_ResourceId_t Id, uint32 TableSize, uint32 *UsedMap);
+
 /**
  * @brief Internal routine to aid in converting an ES resource ID to an array index
 
@@ -62,6 +62,23 @@ CFE_Status_t CFE_ES_AppID_ToIndex(CFE_ES_AppId_t AppID, uint32 *Idx)
     return UT_GenStub_GetReturnValue(CFE_ES_AppID_ToIndex, CFE_Status_t);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_ES_BackgroundJobID_ToIndex()
+ * ----------------------------------------------------
+ */
+CFE_Status_t CFE_ES_BackgroundJobID_ToIndex(CFE_ES_BackgroundJobId_t JobId, uint32 *Idx)
+{
+    UT_GenStub_SetupReturnBuffer(CFE_ES_BackgroundJobID_ToIndex, CFE_Status_t);
+
+    UT_GenStub_AddParam(CFE_ES_BackgroundJobID_ToIndex, CFE_ES_BackgroundJobId_t, JobId);
+    UT_GenStub_AddParam(CFE_ES_BackgroundJobID_ToIndex, uint32 *, Idx);
+
+    UT_GenStub_Execute(CFE_ES_BackgroundJobID_ToIndex, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CFE_ES_BackgroundJobID_ToIndex, CFE_Status_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CFE_ES_BackgroundWakeup()
@@ -166,6 +183,22 @@ CFE_Status_t CFE_ES_DeleteApp(CFE_ES_AppId_t AppID)
     return UT_GenStub_GetReturnValue(CFE_ES_DeleteApp, CFE_Status_t);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_ES_DeleteBackgroundJob()
+ * ----------------------------------------------------
+ */
+CFE_Status_t CFE_ES_DeleteBackgroundJob(CFE_ES_BackgroundJobId_t JobId)
+{
+    UT_GenStub_SetupReturnBuffer(CFE_ES_DeleteBackgroundJob, CFE_Status_t);
+
+    UT_GenStub_AddParam(CFE_ES_DeleteBackgroundJob, CFE_ES_BackgroundJobId_t, JobId);
+
+    UT_GenStub_Execute(CFE_ES_DeleteBackgroundJob, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CFE_ES_DeleteBackgroundJob, CFE_Status_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CFE_ES_DeleteChildTask()
@@ -289,6 +322,23 @@ CFE_Status_t CFE_ES_GetAppName(char *AppName, CFE_ES_AppId_t AppId, size_t Buffe
     return UT_GenStub_GetReturnValue(CFE_ES_GetAppName, CFE_Status_t);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_ES_GetBackgroundJobInfo()
+ * ----------------------------------------------------
+ */
+CFE_Status_t CFE_ES_GetBackgroundJobInfo(CFE_ES_BackgroundJobInfo_t *JobInfo, CFE_ES_BackgroundJobId_t JobId)
+{
+    UT_GenStub_SetupReturnBuffer(CFE_ES_GetBackgroundJobInfo, CFE_Status_t);
+
+    UT_GenStub_AddParam(CFE_ES_GetBackgroundJobInfo, CFE_ES_BackgroundJobInfo_t *, JobInfo);
+    UT_GenStub_AddParam(CFE_ES_GetBackgroundJobInfo, CFE_ES_BackgroundJobId_t, JobId);
+
+    UT_GenStub_Execute(CFE_ES_GetBackgroundJobInfo, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CFE_ES_GetBackgroundJobInfo, CFE_Status_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CFE_ES_GetCDSBlockIDByName()
@@ -727,6 +777,22 @@ int32 CFE_ES_PoolDelete(CFE_ES_MemHandle_t PoolID)
     return UT_GenStub_GetReturnValue(CFE_ES_PoolDelete, int32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_ES_PoolEnableTaskCache()
+ * ----------------------------------------------------
+ */
+CFE_Status_t CFE_ES_PoolEnableTaskCache(CFE_ES_MemHandle_t Handle)
+{
+    UT_GenStub_SetupReturnBuffer(CFE_ES_PoolEnableTaskCache, CFE_Status_t);
+
+    UT_GenStub_AddParam(CFE_ES_PoolEnableTaskCache, CFE_ES_MemHandle_t, Handle);
+
+    UT_GenStub_Execute(CFE_ES_PoolEnableTaskCache, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CFE_ES_PoolEnableTaskCache, CFE_Status_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CFE_ES_ProcessAsyncEvent()
@@ -755,6 +821,28 @@ int32 CFE_ES_PutPoolBuf(CFE_ES_MemHandle_t Handle, CFE_ES_MemPoolBuf_t BufPtr)
     return UT_GenStub_GetReturnValue(CFE_ES_PutPoolBuf, int32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_ES_RegisterBackgroundJob()
+ * ----------------------------------------------------
+ */
+CFE_Status_t CFE_ES_RegisterBackgroundJob(CFE_ES_BackgroundJobId_t *JobIdPtr, const char *JobName, CFE_ES_BackgroundJobFunc_t JobFunc, void *JobArg, uint32 ActivePeriod, uint32 IdlePeriod, uint16 Priority)
+{
+    UT_GenStub_SetupReturnBuffer(CFE_ES_RegisterBackgroundJob, CFE_Status_t);
+
+    UT_GenStub_AddParam(CFE_ES_RegisterBackgroundJob, CFE_ES_BackgroundJobId_t *, JobIdPtr);
+    UT_GenStub_AddParam(CFE_ES_RegisterBackgroundJob, const char *, JobName);
+    UT_GenStub_AddParam(CFE_ES_RegisterBackgroundJob, CFE_ES_BackgroundJobFunc_t, JobFunc);
+    UT_GenStub_AddParam(CFE_ES_RegisterBackgroundJob, void *, JobArg);
+    UT_GenStub_AddParam(CFE_ES_RegisterBackgroundJob, uint32, ActivePeriod);
+    UT_GenStub_AddParam(CFE_ES_RegisterBackgroundJob, uint32, IdlePeriod);
+    UT_GenStub_AddParam(CFE_ES_RegisterBackgroundJob, uint16, Priority);
+
+    UT_GenStub_Execute(CFE_ES_RegisterBackgroundJob, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CFE_ES_RegisterBackgroundJob, CFE_Status_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CFE_ES_RegisterCDS()
@@ -906,6 +994,23 @@ CFE_Status_t CFE_ES_TaskID_ToIndex(CFE_ES_TaskId_t TaskID, uint32 *Idx)
     return UT_GenStub_GetReturnValue(CFE_ES_TaskID_ToIndex, CFE_Status_t);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_ES_TaskPoolSubmit()
+ * ----------------------------------------------------
+ */
+CFE_Status_t CFE_ES_TaskPoolSubmit(CFE_ES_TaskPoolJobFuncPtr_t JobFunc, void *JobArg)
+{
+    UT_GenStub_SetupReturnBuffer(CFE_ES_TaskPoolSubmit, CFE_Status_t);
+
+    UT_GenStub_AddParam(CFE_ES_TaskPoolSubmit, CFE_ES_TaskPoolJobFuncPtr_t, JobFunc);
+    UT_GenStub_AddParam(CFE_ES_TaskPoolSubmit, void *, JobArg);
+
+    UT_GenStub_Execute(CFE_ES_TaskPoolSubmit, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CFE_ES_TaskPoolSubmit, CFE_Status_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CFE_ES_WaitForStartupSync()
@@ -107,6 +107,18 @@ void UT_DefaultHandler_CFE_ResourceId_FindNext(void *UserObj, UT_EntryKey_t Func
     UT_Stub_SetReturnValue(FuncKey, NextId);
 }
 
+/*------------------------------------------------------------
+ *
+ * Default handler for CFE_ResourceId_FindNextFree coverage stub function
+ *
+ *------------------------------------------------------------*/
+void UT_DefaultHandler_CFE_ResourceId_FindNextFree(void *UserObj, UT_EntryKey_t FuncKey,
+                                                   const UT_StubContext_t *Context)
+{
+    /* Same behavior as CFE_ResourceId_FindNext, the map is not used here */
+    UT_DefaultHandler_CFE_ResourceId_FindNext(UserObj, FuncKey, Context);
+}
+
 /*------------------------------------------------------------
  *
  * Default handler for CFE_ResourceId_ToIndex coverage stub function
@@ -26,6 +26,7 @@
 #include "utgenstub.h"
 
 void UT_DefaultHandler_CFE_ResourceId_FindNext(void *, UT_EntryKey_t, const UT_StubContext_t *);
+void UT_DefaultHandler_CFE_ResourceId_FindNextFree(void *, UT_EntryKey_t, const UT_StubContext_t *);
 void UT_DefaultHandler_CFE_ResourceId_GetBase(void *, UT_EntryKey_t, const UT_StubContext_t *);
 void UT_DefaultHandler_CFE_ResourceId_GetSerial(void *, UT_EntryKey_t, const UT_StubContext_t *);
 void UT_DefaultHandler_CFE_ResourceId_ToIndex(void *, UT_EntryKey_t, const UT_StubContext_t *);
@@ -48,6 +49,25 @@ CFE_ResourceId_t CFE_ResourceId_FindNext(CFE_ResourceId_t StartId, uint32 TableS
     return UT_GenStub_GetReturnValue(CFE_ResourceId_FindNext, CFE_ResourceId_t);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_ResourceId_FindNextFree()
+ * ----------------------------------------------------
+ */
+CFE_ResourceId_t CFE_ResourceId_FindNextFree(CFE_ResourceId_t StartId, uint32 TableSize, uint32 *UsedMap,
+                                             bool (*CheckFunc)(CFE_ResourceId_t))
+{
+    UT_GenStub_SetupReturnBuffer(CFE_ResourceId_FindNextFree, CFE_ResourceId_t);
+
+    UT_GenStub_AddParam(CFE_ResourceId_FindNextFree, CFE_ResourceId_t, StartId);
+    UT_GenStub_AddParam(CFE_ResourceId_FindNextFree, uint32, TableSize);
+    UT_GenStub_AddParam(CFE_ResourceId_FindNextFree, uint32 *, UsedMap);
+
+    UT_GenStub_Execute(CFE_ResourceId_FindNextFree, Basic, UT_DefaultHandler_CFE_ResourceId_FindNextFree);
+
+    return UT_GenStub_GetReturnValue(CFE_ResourceId_FindNextFree, CFE_ResourceId_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CFE_ResourceId_GetBase()
@@ -80,6 +100,20 @@ uint32 CFE_ResourceId_GetSerial(CFE_ResourceId_t ResourceId)
     return UT_GenStub_GetReturnValue(CFE_ResourceId_GetSerial, uint32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_ResourceId_MapRelease()
+ * ----------------------------------------------------
+ */
+void CFE_ResourceId_MapRelease(CFE_ResourceId_t Id, uint32 TableSize, uint32 *UsedMap)
+{
+    UT_GenStub_AddParam(CFE_ResourceId_MapRelease, CFE_ResourceId_t, Id);
+    UT_GenStub_AddParam(CFE_ResourceId_MapRelease, uint32, TableSize);
+    UT_GenStub_AddParam(CFE_ResourceId_MapRelease, uint32 *, UsedMap);
+
+    UT_GenStub_Execute(CFE_ResourceId_MapRelease, Basic, NULL);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CFE_ResourceId_ToIndex()
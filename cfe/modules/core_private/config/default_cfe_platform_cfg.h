@@ -37,6 +37,7 @@
 #include "cfe_core_private_internal_cfg.h"
 #include "cfe_es_platform_cfg.h"
 #include "cfe_evs_platform_cfg.h"
+#include "cfe_fs_platform_cfg.h"
 #include "cfe_sb_platform_cfg.h"
 #include "cfe_tbl_platform_cfg.h"
 #include "cfe_time_platform_cfg.h"
@@ -135,6 +135,72 @@ int32 CFE_ES_RegisterCDSEx(CFE_ES_CDSHandle_t *HandlePtr, size_t UserBlockSize,
 ******************************************************************************/
 int32 CFE_ES_DeleteCDS(const char *CDSName, bool CalledByTblServices);
 
+/**
+ * \brief State of a lock acquisition being profiled
+ *
+ * Filled in by CFE_ES_LockProfileWait() before taking the lock and
+ * passed to CFE_ES_LockProfileAcquired() once it has been obtained.
+ */
+typedef struct CFE_ES_LockProfileWait
+{
+    uint64 StartTime; /**< \brief Timebase value when the caller started waiting */
+    bool   Contended; /**< \brief Whether the lock was held by another task at that time */
+} CFE_ES_LockProfileWait_t;
+
+/*****************************************************************************/
+/**
+** \brief Start profiling an acquisition of a cFE core lock
+**
+** \par Description
+**        Records the time at which the calling task started waiting for the lock,
+**        and whether the lock was held by another task at that time.  Must be called
+**        immediately before taking the lock.
+**
+** \par Assumptions, External Events, and Notes:
+**        Only called when #CFE_PLATFORM_ES_LOCK_PROFILE is enabled.  Acquisitions by
+**        threads that are not OSAL tasks are not profiled.
+**
+** \param[in]  LockId   The lock about to be taken
+** \param[out] WaitPtr  Acquisition state to pass to CFE_ES_LockProfileAcquired()
+**
+******************************************************************************/
+void CFE_ES_LockProfileWait(CFE_ES_LockProfileLock_Enum_t LockId, CFE_ES_LockProfileWait_t *WaitPtr);
+
+/*****************************************************************************/
+/**
+** \brief Account a profiled acquisition of a cFE core lock
+**
+** \par Description
+**        Accounts the wait time of the acquisition against the call site and starts
+**        timing the hold.  Must be called immediately after the lock was obtained.
+**
+** \par Assumptions, External Events, and Notes:
+**        The statistics are kept in a table owned by the calling task, so no
+**        additional locking is required.  The function name is stored by reference,
+**        it must be a string constant such as \c __func__.
+**
+** \param[in]  LockId       The lock that was obtained
+** \param[in]  WaitPtr      Acquisition state from CFE_ES_LockProfileWait()
+** \param[in]  FunctionName Name of the function acquiring the lock
+** \param[in]  LineNumber   Line of the call site
+**
+******************************************************************************/
+void CFE_ES_LockProfileAcquired(CFE_ES_LockProfileLock_Enum_t LockId, const CFE_ES_LockProfileWait_t *WaitPtr,
+                                const char *FunctionName, int32 LineNumber);
+
+/*****************************************************************************/
+/**
+** \brief Account the release of a profiled cFE core lock
+**
+** \par Description
+**        Accounts the hold time against the call site that acquired the lock.
+**        Must be called immediately before giving the lock.
+**
+** \param[in]  LockId   The lock about to be given
+**
+******************************************************************************/
+void CFE_ES_LockProfileRelease(CFE_ES_LockProfileLock_Enum_t LockId);
+
 /**@}*/
 
 #endif /* CFE_ES_CORE_INTERNAL_H */
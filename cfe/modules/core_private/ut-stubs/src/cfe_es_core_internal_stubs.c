@@ -58,6 +58,47 @@ int32 CFE_ES_DeleteCDS(const char *CDSName, bool CalledByTblServices)
     return UT_GenStub_GetReturnValue(CFE_ES_DeleteCDS, int32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_ES_LockProfileAcquired()
+ * ----------------------------------------------------
+ */
+void CFE_ES_LockProfileAcquired(CFE_ES_LockProfileLock_Enum_t LockId, const CFE_ES_LockProfileWait_t *WaitPtr,
+                                const char *FunctionName, int32 LineNumber)
+{
+    UT_GenStub_AddParam(CFE_ES_LockProfileAcquired, CFE_ES_LockProfileLock_Enum_t, LockId);
+    UT_GenStub_AddParam(CFE_ES_LockProfileAcquired, const CFE_ES_LockProfileWait_t *, WaitPtr);
+    UT_GenStub_AddParam(CFE_ES_LockProfileAcquired, const char *, FunctionName);
+    UT_GenStub_AddParam(CFE_ES_LockProfileAcquired, int32, LineNumber);
+
+    UT_GenStub_Execute(CFE_ES_LockProfileAcquired, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_ES_LockProfileRelease()
+ * ----------------------------------------------------
+ */
+void CFE_ES_LockProfileRelease(CFE_ES_LockProfileLock_Enum_t LockId)
+{
+    UT_GenStub_AddParam(CFE_ES_LockProfileRelease, CFE_ES_LockProfileLock_Enum_t, LockId);
+
+    UT_GenStub_Execute(CFE_ES_LockProfileRelease, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_ES_LockProfileWait()
+ * ----------------------------------------------------
+ */
+void CFE_ES_LockProfileWait(CFE_ES_LockProfileLock_Enum_t LockId, CFE_ES_LockProfileWait_t *WaitPtr)
+{
+    UT_GenStub_AddParam(CFE_ES_LockProfileWait, CFE_ES_LockProfileLock_Enum_t, LockId);
+    UT_GenStub_AddParam(CFE_ES_LockProfileWait, CFE_ES_LockProfileWait_t *, WaitPtr);
+
+    UT_GenStub_Execute(CFE_ES_LockProfileWait, Basic, NULL);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CFE_ES_RegisterCDSEx()
@@ -332,6 +332,13 @@ typedef CFE_RESOURCEID_BASE_TYPE CFE_ES_LibId_t;
  */
 typedef CFE_RESOURCEID_BASE_TYPE CFE_ES_CounterId_t;
 
+/**
+ * @brief A type for Background Job IDs
+ *
+ * This is the type that is used for any API accepting or returning a Background Job ID
+ */
+typedef CFE_RESOURCEID_BASE_TYPE CFE_ES_BackgroundJobId_t;
+
 /**
  * @brief Memory Handle type
  *
@@ -483,6 +490,18 @@ typedef struct CFE_ES_AppInfo
                                                         \brief The Application's Main Task ID */
     uint32 NumOfChildTasks;                        /**< \cfetlmmnemonic \ES_CHILDTASKS
                                                         \brief Number of Child tasks for an App */
+    uint32 CpuAffinity;                            /**< \cfetlmmnemonic \ES_CPUAFFINITY
+                                                        \brief CPU mask of the Main Task, 0 if unrestricted */
+    uint32 Migrations;                             /**< \cfetlmmnemonic \ES_MAINTASKMIGR
+                                                        \brief Times the Main Task moved between CPUs */
+    uint32 InvoluntaryCtxSwitches;                 /**< \cfetlmmnemonic \ES_MAINTASKICSW
+                                                        \brief Times the Main Task was preempted */
+    uint32 TimeToReadyMsec;                        /**< \cfetlmmnemonic \ES_READYMSEC
+                                                        \brief Milliseconds from creation to RUNNING, 0 if not yet */
+    uint32 TaskPoolJobsPending;                    /**< \cfetlmmnemonic \ES_POOLJOBSPEND
+                                                        \brief Task pool jobs of the App queued or running */
+    uint32 TaskPoolJobsCompleted;                  /**< \cfetlmmnemonic \ES_POOLJOBSDONE
+                                                        \brief Task pool jobs of the App that have returned */
 } CFE_ES_AppInfo_t;
 
 /**
@@ -506,8 +525,150 @@ typedef struct CFE_ES_TaskInfo
     CFE_ES_MemOffset_t         StackSize;                         /**< Size of task stack */
     CFE_ES_TaskPriority_Atom_t Priority;                          /**< Priority of task */
     uint8                      Spare[2];                          /**< Spare bytes for alignment */
+    uint32                     CpuAffinity;                       /**< CPU mask of the task, 0 if unrestricted */
+    uint32                     Migrations;                        /**< Times the task moved between CPUs */
+    uint32                     InvoluntaryCtxSwitches;            /**< Times the task was preempted */
 } CFE_ES_TaskInfo_t;
 
+/**
+ * \brief Task Statistics
+ *
+ * Sub-Structure that is used to provide the execution statistics of a single
+ * task, as sampled from the operating system.  It is primarily used for the
+ * Send Task Statistics (#CFE_ES_SEND_TASK_STATS_CC) command.
+ *
+ * \note Values that the underlying OS does not provide are reported as zero.
+ */
+typedef struct CFE_ES_TaskStats
+{
+    CFE_ES_TaskId_t TaskId;                            /**< \brief Task Id */
+    CFE_ES_AppId_t  AppId;                             /**< \brief Parent Application ID */
+    char            TaskName[CFE_MISSION_MAX_API_LEN]; /**< \brief Task Name */
+    uint32          CpuTimeMsec;                       /**< \brief Total CPU time consumed, in milliseconds */
+    uint32          CpuLoad;                           /**< \brief CPU use since the last sample, in 0.01% of one CPU */
+    uint32          VoluntaryCtxSwitches;              /**< \brief Context switches where the task blocked */
+    uint32          InvoluntaryCtxSwitches;            /**< \brief Context switches where the task was preempted */
+    uint32          RunSlices;                         /**< \brief Times the task was scheduled onto a CPU */
+    uint32          MaxRunSliceUsec;                   /**< \brief Longest single run on a CPU, in microseconds */
+} CFE_ES_TaskStats_t;
+
+/**
+ * \brief Performance Marker Statistics
+ *
+ * Sub-Structure that is used to provide the timing statistics of a single
+ * performance marker, measured from each CFE_ES_PerfLogEntry() to the matching
+ * CFE_ES_PerfLogExit() of the same task, over one reporting interval.
+ */
+typedef struct CFE_ES_PerfMarkerStats
+{
+    uint32 PerfId;        /**< \brief Performance marker ID */
+    uint32 Count;         /**< \brief Number of completed entry/exit pairs */
+    uint32 TotalTimeUsec; /**< \brief Total time between entry and exit, in microseconds */
+    uint32 MinTimeUsec;   /**< \brief Shortest time between entry and exit, in microseconds */
+    uint32 MaxTimeUsec;   /**< \brief Longest time between entry and exit, in microseconds */
+    uint32 MeanTimeUsec;  /**< \brief Mean time between entry and exit, in microseconds */
+    uint32 Histogram[CFE_MISSION_ES_PERF_STATS_HIST_BINS]; /**< \brief Log2 latency histogram, bin N counts
+                                                                 durations of 2^(N-1) to 2^N microseconds */
+} CFE_ES_PerfMarkerStats_t;
+
+/**
+ * \brief Label definitions associated with CFE_ES_LockProfileLock_Enum_t
+ */
+enum CFE_ES_LockProfileLock
+{
+    /**
+     * \brief ES shared data lock (CFE_ES_LockSharedData)
+     */
+    CFE_ES_LockProfileLock_ES_SHARED_DATA = 0,
+
+    /**
+     * \brief SB shared data lock (CFE_SB_LockSharedData)
+     */
+    CFE_ES_LockProfileLock_SB_SHARED_DATA = 1,
+
+    /**
+     * \brief TBL registry lock (CFE_TBL_LockRegistry)
+     */
+    CFE_ES_LockProfileLock_TBL_REGISTRY = 2,
+
+    /**
+     * \brief FS shared data lock (CFE_FS_LockSharedData)
+     */
+    CFE_ES_LockProfileLock_FS_SHARED_DATA = 3,
+
+    /**
+     * \brief EVS shared data lock (CFE_EVS_LockSharedData)
+     */
+    CFE_ES_LockProfileLock_EVS_SHARED_DATA = 4,
+
+    /**
+     * \brief Number of profiled locks, must be last
+     */
+    CFE_ES_LockProfileLock_MAX = 5
+};
+
+/**
+ * \brief Identifies one of the cFE core locks accounted by the lock profiler
+ *
+ * \sa enum CFE_ES_LockProfileLock
+ */
+typedef uint8 CFE_ES_LockProfileLock_Enum_t;
+
+/**
+ * \brief Byte order mark of the lock profile file
+ *
+ * Written in the byte order of the target, allowing ground tools to detect
+ * whether the file contents need to be swapped.
+ */
+#define CFE_ES_LOCK_PROFILE_BYTE_ORDER_MARK 0x01020304
+
+/**
+ * \brief Lock Profile File Metadata
+ *
+ * Follows the standard cFE file header in the file written by the
+ * Write Lock Profile (#CFE_ES_WRITE_LOCK_PROFILE_CC) command, and is followed
+ * by \c NumRecords instances of #CFE_ES_LockProfileRecord_t.
+ *
+ * \note Unlike the cFE file header, the metadata and the records are written
+ * in the byte order of the target.  The record layout parameters are included
+ * so that ground tools do not depend on the mission configuration.
+ */
+typedef struct CFE_ES_LockProfileMetaData
+{
+    uint32 ByteOrderMark;       /**< \brief Always #CFE_ES_LOCK_PROFILE_BYTE_ORDER_MARK */
+    uint32 RecordSize;          /**< \brief Size of each record, in bytes */
+    uint32 FunctionNameLen;     /**< \brief Size of the function name field of each record */
+    uint32 TaskNameLen;         /**< \brief Size of the task name field of each record */
+    uint32 TimerTicksPerSecond; /**< \brief Rate of the timebase used for all times in the records */
+    uint32 NumRecords;          /**< \brief Number of records following the metadata */
+    uint32 DroppedSites;        /**< \brief Acquisitions not accounted because a task ran out of call sites */
+    uint32 Spare;               /**< \brief Keeps the records 64-bit aligned */
+} CFE_ES_LockProfileMetaData_t;
+
+/**
+ * \brief Lock Profile Record
+ *
+ * Statistics of one call site of one task acquiring one of the cFE core locks,
+ * as written to the lock profile file.  All times are in timebase ticks, see
+ * CFE_ES_LockProfileMetaData_t::TimerTicksPerSecond.  The wait time is measured
+ * from the call of the lock function until the lock was obtained, the hold time
+ * from then until the matching unlock.
+ */
+typedef struct CFE_ES_LockProfileRecord
+{
+    uint64          WaitTicksTotal; /**< \brief Total time spent waiting to obtain the lock */
+    uint64          HoldTicksTotal; /**< \brief Total time the lock was held */
+    CFE_ES_TaskId_t TaskId;         /**< \brief Task that acquired the lock */
+    uint32          LockId;         /**< \brief Lock acquired, see #CFE_ES_LockProfileLock_Enum_t */
+    uint32          LineNumber;     /**< \brief Source line of the call site */
+    uint32          AcquireCount;   /**< \brief Number of times the lock was obtained at this site */
+    uint32          ContendedCount; /**< \brief Number of those where another task held the lock */
+    uint32          WaitTicksMax;   /**< \brief Longest single wait */
+    uint32          HoldTicksMax;   /**< \brief Longest single hold */
+    char            FunctionName[CFE_MISSION_ES_LOCK_PROFILE_NAME_LEN]; /**< \brief Function of the call site */
+    char            TaskName[CFE_MISSION_MAX_API_LEN];                  /**< \brief Name of the task */
+} CFE_ES_LockProfileRecord_t;
+
 /**
  * \brief CDS Register Dump Record
  *
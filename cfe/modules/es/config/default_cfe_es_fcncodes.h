@@ -1031,6 +1031,92 @@
 */
 #define CFE_ES_QUERY_ALL_TASKS_CC 24
 
+/** \cfeescmd Telemeter Task Statistics
+**
+**  \par Description
+**       This command samples the CPU time, context switch and run slice statistics
+**       of every registered task from the operating system and telemeters them.
+**       The CPU load of each task is reported relative to the time elapsed since
+**       the previous execution of this command, so commanding it at a fixed rate
+**       yields the per-task share of the cycle budget.
+**
+**  \cfecmdmnemonic \ES_TLMTASKSTATS
+**
+**  \par Command Structure
+**       #CFE_ES_SendTaskStatsCmd_t
+**
+**  \par Command Verification
+**       Successful execution of this command may be verified with
+**       the following telemetry:
+**       - \b \c \ES_CMDPC - command execution counter will
+**         increment
+**       - The #CFE_ES_TLM_TASK_STATS_INF_EID debug event message will be
+**         generated.
+**       - One or more \link #CFE_ES_TaskStatsTlm_t Task Statistics Telemetry Packets \endlink
+**         are produced, each holding up to #CFE_MISSION_ES_TASK_STATS_MAX_ENTRIES tasks
+**
+**  \par Error Conditions
+**       This command may fail for the following reason(s):
+**       - The command packet length is incorrect
+**
+**       Evidence of failure may be found in the following telemetry:
+**       - \b \c \ES_CMDEC - command error counter will increment
+**
+**  \par Criticality
+**       None
+**
+**  \sa #CFE_ES_QUERY_ALL_TASKS_CC
+*/
+#define CFE_ES_SEND_TASK_STATS_CC 25
+
+/** \cfeescmd Write Lock Profile to a File
+**
+**  \par Description
+**       This command writes the statistics collected by the shared data lock
+**       profiler (see #CFE_PLATFORM_ES_LOCK_PROFILE) to a file.  One record is
+**       written for every call site of every task that acquired one of the cFE
+**       core locks, holding the number of acquisitions, the number of contended
+**       acquisitions, and the total and longest wait and hold times.  The file
+**       can be summarized on the ground with the cfe_lockprof_summary tool.
+**       Optionally the statistics are cleared once the file has been written,
+**       so that the next file covers a fresh interval.
+**
+**  \cfecmdmnemonic \ES_WRITELOCKPROF
+**
+**  \par Command Structure
+**       #CFE_ES_WriteLockProfileCmd_t
+**
+**  \par Command Verification
+**       Successful execution of this command may be verified with
+**       the following telemetry:
+**       - \b \c \ES_CMDPC - command execution counter will
+**         increment
+**       - The #CFE_ES_LOCKPROF_INF_EID debug event message will be
+**         generated.
+**       - The file specified in the command (or the default specified
+**         by the #CFE_PLATFORM_ES_DEFAULT_LOCK_PROFILE_FILE configuration parameter) will be
+**         updated with the latest information.
+**
+**  \par Error Conditions
+**       This command may fail for the following reason(s):
+**       - Lock profiling is not enabled in this build
+**       - The file name specified could not be parsed
+**       - An Error occurs while trying to write to the file
+**
+**       Evidence of failure may be found in the following telemetry:
+**       - \b \c \ES_CMDEC - command error counter will increment
+**       - The #CFE_ES_LOCKPROF_ERR_EID error event message will be generated
+**
+**  \par Criticality
+**       This command is not inherently dangerous.  It will create a new
+**       file in the file system (or overwrite an existing one) and could,
+**       if performed repeatedly without sufficient file management by the
+**       operator, fill the file system.
+**
+**  \sa #CFE_ES_QUERY_ALL_TASKS_CC
+*/
+#define CFE_ES_WRITE_LOCK_PROFILE_CC 26
+
 /** \} */
 
 #endif
@@ -48,6 +48,23 @@
 */
 #define CFE_MISSION_ES_MAX_APPLICATIONS 16
 
+/**
+**  \cfeescfg Mission Max Task Statistics Entries in a message
+**
+**  \par Description:
+**      Indicates the maximum number of task entries in a single task statistics
+**      telemetry packet.  Systems with more tasks send several packets per request.
+**
+**      This affects the layout of command/telemetry messages but does not affect run
+**      time behavior or internal allocation.
+**
+**  \par Limits
+**       All CPUs within the same SB domain (mission) must share the same definition
+**       Note this affects the size of messages, so it must not cause any message
+**       to exceed the max length.
+*/
+#define CFE_MISSION_ES_TASK_STATS_MAX_ENTRIES 16
+
 /**
 **  \cfeescfg Define Max Number of Performance IDs for messages
 **
@@ -65,6 +82,59 @@
 */
 #define CFE_MISSION_ES_PERF_MAX_IDS 128
 
+/**
+**  \cfeescfg Number of Performance Markers in the Statistics Telemetry
+**
+**  \par Description:
+**       Defines how many of the busiest performance markers are reported in each
+**       performance statistics telemetry packet.
+**
+**      This affects the layout of command/telemetry messages but does not affect run
+**      time behavior or internal allocation.
+**
+**  \par Limits
+**       All CPUs within the same SB domain (mission) must share the same definition
+**       Note this affects the size of messages, so it must not cause any message
+**       to exceed the max length.
+*/
+#define CFE_MISSION_ES_PERF_STATS_TOP_N 8
+
+/**
+**  \cfeescfg Number of Bins in the Performance Marker Latency Histogram
+**
+**  \par Description:
+**       Defines the number of log2 bins in the latency histogram kept for each
+**       performance marker.  Bin 0 counts durations under 1 microsecond, bin N
+**       counts durations from 2^(N-1) up to 2^N microseconds and the last bin
+**       also counts everything longer.
+**
+**      This affects the layout of command/telemetry messages but does not affect run
+**      time behavior or internal allocation.
+**
+**  \par Limits
+**       All CPUs within the same SB domain (mission) must share the same definition
+**       Note this affects the size of messages, so it must not cause any message
+**       to exceed the max length.
+*/
+#define CFE_MISSION_ES_PERF_STATS_HIST_BINS 20
+
+/**
+**  \cfeescfg Length of Function Names in the Lock Profile
+**
+**  \par Description:
+**       Defines the space reserved for the name of the calling function in each
+**       record of the file written by the
+**       \link #CFE_ES_WRITE_LOCK_PROFILE_CC Write Lock Profile \endlink command.
+**       Longer names are truncated.
+**
+**      This affects the layout of the lock profile file but does not affect run
+**      time behavior or internal allocation.
+**
+**  \par Limits
+**       Must be a multiple of 4, with a lower limit of 8.
+*/
+#define CFE_MISSION_ES_LOCK_PROFILE_NAME_LEN 40
+
 /** \cfeescfg Maximum number of block sizes in pool structures
 **
 **  \par Description:
@@ -158,6 +158,23 @@
 */
 #define CFE_PLATFORM_ES_SYSTEM_LOG_SIZE 3072
 
+/**
+**  \cfeescfg Define Number of Staged System Log Messages
+**
+**  \par Description:
+**       Defines the number of messages that can be staged for the system log.
+**       Tasks calling CFE_ES_WriteToSysLog() format their message into a
+**       staging entry without taking the ES shared data lock, and the ES
+**       background task later copies staged messages into the system log and
+**       to the console.  When all entries are in use, the caller writes its
+**       message directly into the system log under the lock instead.
+**
+**  \par Limits
+**       Must be a power of two and at least 2.  Each entry holds one complete
+**       system log message.
+*/
+#define CFE_PLATFORM_ES_SYSLOG_STAGE_ENTRIES 16
+
 /**
 **  \cfeescfg Define Number of entries in the ES Object table
 **
@@ -347,6 +364,60 @@
 */
 #define CFE_PLATFORM_ES_MEMPOOL_ALIGN_SIZE_MIN 4
 
+/**
+**  \cfeescfg Enable Coalescing Memory Pools
+**
+**  \par Description:
+**       When set to true, memory pools created with CFE_ES_PoolCreate(),
+**       CFE_ES_PoolCreateNoSem() or CFE_ES_PoolCreateEx() split and merge free
+**       blocks instead of keeping every block permanently tied to the block
+**       size it was first allocated for.  Requests are still rounded up to the
+**       configured block sizes, and the same statistics are reported, but memory
+**       released by a burst of large buffers can be reused for smaller ones.
+**
+**       Each block in a coalescing pool carries a slightly larger descriptor
+**       (four additional size_t words).  The CDS is not affected by this setting.
+**
+**       Per-task caches (see CFE_ES_PoolEnableTaskCache()) rely on free blocks
+**       staying tied to their block size, so they cannot be enabled on these pools.
+**
+**  \par Limits
+**       Must be true or false.
+*/
+#define CFE_PLATFORM_ES_MEMPOOL_COALESCE false
+
+/**
+**  \cfeescfg Number of Per-Task Caches in Each Memory Pool
+**
+**  \par Description:
+**       The number of tasks that can each hold a private cache of released
+**       blocks in a memory pool for which CFE_ES_PoolEnableTaskCache() has been
+**       called.  Tasks beyond this number use the pool directly, under the pool
+**       mutex, as usual.
+**
+**       Every memory pool entry reserves space for this many caches, whether
+**       enabled or not, of CFE_PLATFORM_ES_POOL_MAX_BUCKETS times
+**       CFE_PLATFORM_ES_MEMPOOL_TASK_CACHE_DEPTH offsets each.
+**
+**  \par Limits
+**       Must be at least one.
+*/
+#define CFE_PLATFORM_ES_MEMPOOL_TASK_CACHES 4
+
+/**
+**  \cfeescfg Depth of Per-Task Memory Pool Caches
+**
+**  \par Description:
+**       The number of released blocks of each block size that a per-task cache
+**       holds.  When a cache runs empty or full, half of this number of blocks
+**       is moved from or to the pool at once, under a single acquisition of the
+**       pool mutex.
+**
+**  \par Limits
+**       Must be at least two and no more than 255.
+*/
+#define CFE_PLATFORM_ES_MEMPOOL_TASK_CACHE_DEPTH 8
+
 /**
 **  \cfeescfg ES Nonvolatile Startup Filename
 **
@@ -405,6 +476,20 @@
 */
 #define CFE_PLATFORM_ES_DEFAULT_TASK_LOG_FILE "/ram/cfe_es_taskinfo.log"
 
+/**
+**  \cfeescfg Default Lock Profile Filename
+**
+**  \par Description:
+**       The value of this constant defines the filename used to store the shared
+**       data lock profile.  This filename is used only when no filename is
+**       specified in the command to write the lock profile.
+**
+**  \par Limits
+**       The length of each string, including the NULL terminator cannot exceed the
+**       #OS_MAX_PATH_LEN value.
+*/
+#define CFE_PLATFORM_ES_DEFAULT_LOCK_PROFILE_FILE "/ram/cfe_es_lockprof.dat"
+
 /**
 **  \cfeescfg Default System Log Filename
 **
@@ -516,6 +601,34 @@
 */
 #define CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE 10000
 
+/**
+**  \cfeescfg Define Max Nesting of Performance Markers for Statistics
+**
+**  \par Description:
+**       Defines how many performance markers a single task may have entered
+**       (and not yet exited) at the same time for the purpose of the always-on
+**       performance marker statistics.  Entries beyond this depth are not timed.
+**
+**  \par Limits
+**       There is a lower limit of 1.  Each task uses 16 bytes per level.
+*/
+#define CFE_PLATFORM_ES_PERF_STATS_MAX_NESTING 8
+
+/**
+**  \cfeescfg Define Number of Performance Markers with Statistics per Task
+**
+**  \par Description:
+**       Defines how many distinct performance markers each task keeps statistics
+**       for within a reporting interval.  Samples of additional markers are only
+**       counted as dropped.  A table of this many entries is reserved for each of
+**       the #OS_MAX_TASKS tasks.
+**
+**  \par Limits
+**       Must be a power of two.  There is a lower limit of 1 and an upper limit
+**       of #CFE_MISSION_ES_PERF_MAX_IDS.
+*/
+#define CFE_PLATFORM_ES_PERF_STATS_MARKERS_PER_TASK 16
+
 /**
 **  \cfeescfg Define Filter Mask Setting for Disabling All Performance Entries
 **
@@ -628,12 +741,82 @@
 **  \cfeescfg Define Performance Analyzer Child Task Number of Entries Between Delay
 **
 **  \par Description:
-**       This parameter defines the number of performance analyzer entries the Performance
-**       Analyzer Child Task will write to the file between delays.
+**       This parameter defines the number of file write operations the Performance
+**       Analyzer Child Task will perform between delays.  Each write operation
+**       transfers up to #CFE_PLATFORM_ES_PERF_DUMP_BLOCK_ENTRIES performance
+**       analyzer entries.
 **
 */
 #define CFE_PLATFORM_ES_PERF_ENTRIES_BTWN_DLYS 50
 
+/**
+**  \cfeescfg Define Performance Analyzer Dump Block Size
+**
+**  \par Description:
+**       This parameter defines the maximum number of performance analyzer entries
+**       written to the dump file in a single write operation.  Contiguous segments
+**       of the performance data ring are written as one block, so larger values
+**       reduce the number of file system calls needed to dump the log.
+**
+**  \par Limits
+**       There is a lower limit of 1.  The upper limit is
+**       #CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE.  A staging buffer of 15 bytes
+**       per block entry is reserved in the ES global data for the compact format.
+*/
+#define CFE_PLATFORM_ES_PERF_DUMP_BLOCK_ENTRIES 256
+
+/**
+**  \cfeescfg Enable Compact Performance Analyzer Dump Format
+**
+**  \par Description:
+**       When set to true, the performance analyzer entries are written using a
+**       compact encoding where each entry is stored as a variable length delta
+**       from the previous timestamp followed by the variable length data word.
+**       The file is marked with the #CFE_FS_SubType_ES_PERFDATA_COMPACT sub type
+**       and can be converted back to the standard format on the ground with the
+**       cfe_perf_convert tool.
+**
+**  \par Limits
+**       Must be true or false.
+*/
+#define CFE_PLATFORM_ES_PERF_DUMP_COMPACT false
+
+/**
+**  \cfeescfg Enable Shared Data Lock Profiling
+**
+**  \par Description:
+**       When set to true, every acquisition of the cFE core shared data locks
+**       (the ES, SB, FS and EVS shared data locks and the TBL registry lock) is timed
+**       and accounted against the calling function and line.  Each task keeps
+**       its own table of call sites, recording how often each site acquired the
+**       lock, how often it had to wait for another task, and the total and
+**       longest wait and hold times.  The tables can be written to a file with the
+**       \link #CFE_ES_WRITE_LOCK_PROFILE_CC Write Lock Profile \endlink command
+**       and summarized on the ground with the cfe_lockprof_summary tool.
+**
+**       Timing uses the same timebase as the performance analyzer, so the
+**       overhead is two timebase reads per lock acquisition.
+**
+**  \par Limits
+**       Must be true or false.
+*/
+#define CFE_PLATFORM_ES_LOCK_PROFILE false
+
+/**
+**  \cfeescfg Number of Lock Profile Call Sites per Task
+**
+**  \par Description:
+**       Defines the number of distinct call sites that can be accounted for each
+**       task when #CFE_PLATFORM_ES_LOCK_PROFILE is enabled.  Acquisitions from
+**       additional call sites are only counted as dropped.  A table of this many
+**       entries is reserved for each of the #OS_MAX_TASKS tasks.
+**
+**  \par Limits
+**       Must be a power of two.  There is a lower limit of 1 and an upper limit
+**       of 1024.
+*/
+#define CFE_PLATFORM_ES_LOCK_PROFILE_SITES 32
+
 /**
 **  \cfeescfg Define Default Stack Size for an Application
 **
@@ -685,9 +868,8 @@
 **      pool implementation, which in turn implements the memory pools and CDS.
 **
 **  \par Limits:
-**       Must be at least one.  No specific upper limit, but the number is
-**       anticipated to be reasonably small (i.e. tens, not hundreds).  Large
-**       values have not been tested.
+**       Must be at least one and no more than 32, as the free lists of
+**       coalescing pools are tracked in a 32 bit mask.
 **
 **       The ES and CDS block size lists must correlate with this value
 */
@@ -813,4 +995,51 @@
 */
 #define CFE_PLATFORM_ES_STARTUP_SCRIPT_TIMEOUT_MSEC 1000
 
+/** \cfeescfg Startup script loader tasks
+**
+**  \par Description:
+**      The number of tasks that create the applications listed in the CFE ES
+**      startup script.  All libraries are loaded first, in script order, by the
+**      ES main task.  Applications are then claimed in script order by whichever
+**      loader task is free, so module loading and application creation overlap.
+**
+**      A value of 1 creates every application from the ES main task, which keeps
+**      the application IDs and the startup syslog order identical from boot to boot.
+**      Larger values shorten the time to reach OPERATIONAL when the startup script
+**      lists many applications or the module loader is slow.
+**
+**  \par Limits:
+**       Must be defined as an integer value that is greater than
+**       or equal to one.
+*/
+#define CFE_PLATFORM_ES_STARTUP_LOADER_TASKS 1
+
+/** \cfeescfg Maximum number of background jobs
+**
+**  \par Description:
+**      The number of jobs that can be registered with the ES background task
+**      scheduler, see CFE_ES_RegisterBackgroundJob().  ES and FS register five
+**      jobs of their own at startup, the rest are available to applications.
+**
+**  \par Limits:
+**       Must be defined as an integer value that is greater than
+**       or equal to 5, and no more than 65535.
+*/
+#define CFE_PLATFORM_ES_MAX_BACKGROUND_JOBS 16
+
+/** \cfeescfg Background worker tasks
+**
+**  \par Description:
+**      The number of tasks that run background jobs.  Each worker calls the
+**      most urgent job that is due, so with more than one worker a slow job
+**      (such as a large file write) does not delay the other jobs.
+**
+**      A value of 1 runs every job from the ES background task, one at a time.
+**
+**  \par Limits:
+**       Must be defined as an integer value that is greater than
+**       or equal to one.
+*/
+#define CFE_PLATFORM_ES_BACKGROUND_WORKER_TASKS 1
+
 #endif
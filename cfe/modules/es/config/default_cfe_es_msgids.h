@@ -35,8 +35,11 @@
 /*
 ** CFE ES Telemetry Message Id's
 */
-#define CFE_ES_HK_TLM_MID       CFE_PLATFORM_TLM_MID_BASE + CFE_MISSION_ES_HK_TLM_MSG       /* 0x0800 */
-#define CFE_ES_APP_TLM_MID      CFE_PLATFORM_TLM_MID_BASE + CFE_MISSION_ES_APP_TLM_MSG      /* 0x080B */
-#define CFE_ES_MEMSTATS_TLM_MID CFE_PLATFORM_TLM_MID_BASE + CFE_MISSION_ES_MEMSTATS_TLM_MSG /* 0x0810 */
+#define CFE_ES_HK_TLM_MID         CFE_PLATFORM_TLM_MID_BASE + CFE_MISSION_ES_HK_TLM_MSG         /* 0x0800 */
+#define CFE_ES_TASK_STATS_TLM_MID CFE_PLATFORM_TLM_MID_BASE + CFE_MISSION_ES_TASK_STATS_TLM_MSG /* 0x0807 */
+#define CFE_ES_APP_TLM_MID        CFE_PLATFORM_TLM_MID_BASE + CFE_MISSION_ES_APP_TLM_MSG        /* 0x080B */
+#define CFE_ES_PERF_STATS_TLM_MID CFE_PLATFORM_TLM_MID_BASE + CFE_MISSION_ES_PERF_STATS_TLM_MSG /* 0x080F */
+#define CFE_ES_MEMSTATS_TLM_MID   CFE_PLATFORM_TLM_MID_BASE + CFE_MISSION_ES_MEMSTATS_TLM_MSG   /* 0x0810 */
+#define CFE_ES_STARTUP_TLM_MID    CFE_PLATFORM_TLM_MID_BASE + CFE_MISSION_ES_STARTUP_TLM_MSG    /* 0x0811 */
 
 #endif
@@ -69,6 +69,7 @@ typedef CFE_ES_NoArgsCmd_t CFE_ES_ClearSysLogCmd_t;
 typedef CFE_ES_NoArgsCmd_t CFE_ES_ClearERLogCmd_t;
 typedef CFE_ES_NoArgsCmd_t CFE_ES_ResetPRCountCmd_t;
 typedef CFE_ES_NoArgsCmd_t CFE_ES_SendHkCmd_t;
+typedef CFE_ES_NoArgsCmd_t CFE_ES_SendTaskStatsCmd_t;
 
 /**
 ** \brief Restart cFE Command Payload
@@ -393,6 +394,29 @@ typedef struct CFE_ES_DumpCDSRegistryCmd
     CFE_ES_DumpCDSRegistryCmd_Payload_t Payload;       /**< \brief Command payload */
 } CFE_ES_DumpCDSRegistryCmd_t;
 
+/**
+** \brief Write Lock Profile Command Payload
+**
+** For command details, see #CFE_ES_WRITE_LOCK_PROFILE_CC
+**
+**/
+typedef struct CFE_ES_WriteLockProfileCmd_Payload
+{
+    char  FileName[CFE_MISSION_MAX_PATH_LEN]; /**< \brief ASCII text string of full path and filename
+                                                 of file the lock profile is to be written */
+    uint8 ResetStats;                         /**< \brief Clear the profile after writing it if non-zero */
+    uint8 Spare[3];                           /**< \brief Pad to even 4 byte length */
+} CFE_ES_WriteLockProfileCmd_Payload_t;
+
+/**
+ * \brief Write Lock Profile Command
+ */
+typedef struct CFE_ES_WriteLockProfileCmd
+{
+    CFE_MSG_CommandHeader_t              CommandHeader; /**< \brief Command header */
+    CFE_ES_WriteLockProfileCmd_Payload_t Payload;       /**< \brief Command payload */
+} CFE_ES_WriteLockProfileCmd_t;
+
 /*************************************************************************/
 
 /************************************/
@@ -432,6 +456,90 @@ typedef struct CFE_ES_MemStatsTlm
     CFE_ES_PoolStatsTlm_Payload_t Payload;         /**< \brief Telemetry payload */
 } CFE_ES_MemStatsTlm_t;
 
+/**
+**  \cfeestlm Task Statistics Packet
+**/
+typedef struct CFE_ES_TaskStatsTlm_Payload
+{
+    uint32 TotalTasks;         /**< \cfetlmmnemonic \ES_TS_TOTALTASKS
+                                    \brief Number of tasks sampled for this request */
+    uint32 FirstEntry;         /**< \cfetlmmnemonic \ES_TS_FIRSTENTRY
+                                    \brief Index of the first entry of this packet within the request */
+    uint32 NumEntries;         /**< \cfetlmmnemonic \ES_TS_NUMENTRIES
+                                    \brief Number of valid entries in this packet */
+    uint32 SampleIntervalMsec; /**< \cfetlmmnemonic \ES_TS_INTERVAL
+                                    \brief Time since the previous sample, which CpuLoad is relative to */
+    CFE_ES_TaskStats_t TaskStats[CFE_MISSION_ES_TASK_STATS_MAX_ENTRIES]; /**< \brief See #CFE_ES_TaskStats_t */
+} CFE_ES_TaskStatsTlm_Payload_t;
+
+typedef struct CFE_ES_TaskStatsTlm
+{
+    CFE_MSG_TelemetryHeader_t     TelemetryHeader; /**< \brief Telemetry header */
+    CFE_ES_TaskStatsTlm_Payload_t Payload;         /**< \brief Telemetry payload */
+} CFE_ES_TaskStatsTlm_t;
+
+/**
+**  \cfeestlm Performance Marker Statistics Packet
+**/
+typedef struct CFE_ES_PerfStatsTlm_Payload
+{
+    uint32 NumMarkers;         /**< \cfetlmmnemonic \ES_PS_NUMMARKERS
+                                    \brief Number of valid entries in MarkerStats */
+    uint32 ActiveMarkers;      /**< \cfetlmmnemonic \ES_PS_ACTIVEMARKERS
+                                    \brief Number of markers that completed at least once in the interval */
+    uint32 NestingOverflows;   /**< \cfetlmmnemonic \ES_PS_OVERFLOWS
+                                    \brief Marker entries not timed because the nesting limit was reached */
+    uint32 UnmatchedExits;     /**< \cfetlmmnemonic \ES_PS_UNMATCHED
+                                    \brief Marker exits without a corresponding entry in the same task */
+    uint32 DroppedSamples;     /**< \cfetlmmnemonic \ES_PS_DROPPED
+                                    \brief Marker samples not kept because the task statistics table was full */
+    CFE_ES_PerfMarkerStats_t MarkerStats[CFE_MISSION_ES_PERF_STATS_TOP_N]; /**< \brief Busiest markers first */
+} CFE_ES_PerfStatsTlm_Payload_t;
+
+typedef struct CFE_ES_PerfStatsTlm
+{
+    CFE_MSG_TelemetryHeader_t     TelemetryHeader; /**< \brief Telemetry header */
+    CFE_ES_PerfStatsTlm_Payload_t Payload;         /**< \brief Telemetry payload */
+} CFE_ES_PerfStatsTlm_t;
+
+/**
+**  \cfeestlm Startup Timeline Packet
+**
+**  All times are milliseconds since CFE_ES_Main was entered.  A time of
+**  zero means the phase has not been reached yet.
+**/
+typedef struct CFE_ES_StartupTlm_Payload
+{
+    uint32 ResetType;       /**< \cfetlmmnemonic \ES_SU_RESETTYPE
+                                 \brief Reset type of the last boot */
+    uint32 ResetSubtype;    /**< \cfetlmmnemonic \ES_SU_RESETSUBTYPE
+                                 \brief Reset subtype of the last boot */
+    uint32 CoreReadyMsec;   /**< \cfetlmmnemonic \ES_SU_COREREADY
+                                 \brief Core apps created and running */
+    uint32 LibsLoadedMsec;  /**< \cfetlmmnemonic \ES_SU_LIBSLOADED
+                                 \brief Startup script libraries loaded */
+    uint32 AppsCreatedMsec; /**< \cfetlmmnemonic \ES_SU_APPSCREATED
+                                 \brief Startup script applications created */
+    uint32 AppsInitMsec;    /**< \cfetlmmnemonic \ES_SU_APPSINIT
+                                 \brief Applications reached LATE_INIT, or the wait timed out */
+    uint32 OperationalMsec; /**< \cfetlmmnemonic \ES_SU_OPERATIONAL
+                                 \brief System entered the OPERATIONAL state */
+    uint32 LibsLoaded;      /**< \cfetlmmnemonic \ES_SU_NUMLIBS
+                                 \brief Libraries successfully loaded from the startup script */
+    uint32 AppsCreated;     /**< \cfetlmmnemonic \ES_SU_NUMAPPS
+                                 \brief Applications successfully created from the startup script */
+    uint32 ScriptErrors;    /**< \cfetlmmnemonic \ES_SU_SCRIPTERRORS
+                                 \brief Startup script entries that were malformed or failed */
+    uint32 LoaderTasks;     /**< \cfetlmmnemonic \ES_SU_LOADERS
+                                 \brief Number of tasks that created applications */
+} CFE_ES_StartupTlm_Payload_t;
+
+typedef struct CFE_ES_StartupTlm
+{
+    CFE_MSG_TelemetryHeader_t   TelemetryHeader; /**< \brief Telemetry header */
+    CFE_ES_StartupTlm_Payload_t Payload;         /**< \brief Telemetry payload */
+} CFE_ES_StartupTlm_t;
+
 /*************************************************************************/
 
 /**
@@ -44,8 +44,11 @@
 **  \par Limits
 **      Not Applicable
 */
-#define CFE_MISSION_ES_HK_TLM_MSG       0
-#define CFE_MISSION_ES_APP_TLM_MSG      11
-#define CFE_MISSION_ES_MEMSTATS_TLM_MSG 16
+#define CFE_MISSION_ES_HK_TLM_MSG         0
+#define CFE_MISSION_ES_TASK_STATS_TLM_MSG 7
+#define CFE_MISSION_ES_APP_TLM_MSG        11
+#define CFE_MISSION_ES_PERF_STATS_TLM_MSG 15
+#define CFE_MISSION_ES_MEMSTATS_TLM_MSG   16
+#define CFE_MISSION_ES_STARTUP_TLM_MSG    17
 
 #endif
@@ -1057,6 +1057,41 @@
  *  a write already being in progress.
  */
 #define CFE_ES_ERLOG_PENDING_ERR_EID 93
+
+/**
+ * \brief ES Telemeter Task Statistics Command Success Event ID
+ *
+ *  \par Type: DEBUG
+ *
+ *  \par Cause:
+ *
+ *  \link #CFE_ES_SEND_TASK_STATS_CC ES Telemeter Task Statistics Command \endlink success.
+ */
+#define CFE_ES_TLM_TASK_STATS_INF_EID 94
+
+/**
+ * \brief ES Write Lock Profile Command Success Event ID
+ *
+ *  \par Type: DEBUG
+ *
+ *  \par Cause:
+ *
+ *  \link #CFE_ES_WRITE_LOCK_PROFILE_CC ES Write Lock Profile Command \endlink success.
+ */
+#define CFE_ES_LOCKPROF_INF_EID 95
+
+/**
+ * \brief ES Write Lock Profile Command Failed Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  \link #CFE_ES_WRITE_LOCK_PROFILE_CC ES Write Lock Profile Command \endlink failure,
+ *  either because lock profiling is not enabled or the file could not be created
+ *  or written.  OVERLOADED
+ */
+#define CFE_ES_LOCKPROF_ERR_EID 96
 /**\}*/
 
 #endif /* CFE_ES_EVENTS_H */
@@ -91,6 +91,7 @@ CFE_Status_t CFE_ES_ResetCFE(uint32 ResetType)
             /*
             ** Call the BSP reset routine
             */
+            CFE_ES_SysLogFlush();
             CFE_PSP_Restart(CFE_PSP_RST_TYPE_POWERON);
         }
         else
@@ -110,6 +111,7 @@ CFE_Status_t CFE_ES_ResetCFE(uint32 ResetType)
             /*
             ** Call the BSP reset routine
             */
+            CFE_ES_SysLogFlush();
             CFE_PSP_Restart(CFE_PSP_RST_TYPE_PROCESSOR);
         }
 
@@ -133,6 +135,7 @@ CFE_Status_t CFE_ES_ResetCFE(uint32 ResetType)
         /*
         ** Call the BSP reset routine
         */
+        CFE_ES_SysLogFlush();
         CFE_PSP_Restart(CFE_PSP_RST_TYPE_POWERON);
 
         /*
@@ -439,7 +442,7 @@ void CFE_ES_ExitApp(uint32 ExitStatus)
             CFE_ES_SysLogWrite_Unsync("%s: Application %s called CFE_ES_ExitApp\n", __func__,
                                       CFE_ES_AppRecordGetName(AppRecPtr));
 
-            AppRecPtr->AppState = CFE_ES_AppState_STOPPED;
+            CFE_ES_AppSetState(AppRecPtr, CFE_ES_AppState_STOPPED);
 
             /*
             ** Unlock the ES Shared data before suspending the app
@@ -512,7 +515,7 @@ bool CFE_ES_RunLoop(uint32 *RunStatus)
          */
         if (AppRecPtr->AppState < CFE_ES_AppState_RUNNING)
         {
-            AppRecPtr->AppState = CFE_ES_AppState_RUNNING;
+            CFE_ES_AppSetState(AppRecPtr, CFE_ES_AppState_RUNNING);
         }
 
         /*
@@ -550,6 +553,19 @@ bool CFE_ES_RunLoop(uint32 *RunStatus)
     return ReturnCode;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Wait condition for CFE_ES_WaitForSystemState(), the argument
+ * points to the minimum system state.
+ *
+ *-----------------------------------------------------------------*/
+static bool CFE_ES_SystemStateReached(void *Arg)
+{
+    return (CFE_ES_Global.SystemState >= *(const uint32 *)Arg);
+}
+
 /*----------------------------------------------------------------
  *
  * Implemented per public API
@@ -558,11 +574,8 @@ bool CFE_ES_RunLoop(uint32 *RunStatus)
  *-----------------------------------------------------------------*/
 CFE_Status_t CFE_ES_WaitForSystemState(uint32 MinSystemState, uint32 TimeOutMilliseconds)
 {
-    int32               Status = CFE_SUCCESS;
     CFE_ES_AppRecord_t *AppRecPtr;
     uint32              RequiredAppState;
-    uint32              WaitTime;
-    uint32              WaitRemaining;
 
     /*
      * Calling app is assumed to have completed its own initialization up to the point
@@ -615,41 +628,18 @@ CFE_Status_t CFE_ES_WaitForSystemState(uint32 MinSystemState, uint32 TimeOutMill
          */
         if (AppRecPtr->AppState < RequiredAppState)
         {
-            AppRecPtr->AppState = RequiredAppState;
+            CFE_ES_AppSetState(AppRecPtr, RequiredAppState);
         }
     }
     CFE_ES_UnlockSharedData(__func__, __LINE__);
 
     /*
-     * Do the actual delay loop.
+     * Do the actual wait.
      *
      * This is only dependent on the main (startup) task updating the global variable
-     * to be at least the state requested.
+     * to be at least the state requested, which wakes all waiters at once.
      */
-    WaitRemaining = TimeOutMilliseconds;
-    while (CFE_ES_Global.SystemState < MinSystemState)
-    {
-        /* TBD: Very Crude timing here, but not sure if it matters,
-         * as this is only done during startup, not real work */
-        if (WaitRemaining > CFE_PLATFORM_ES_STARTUP_SYNC_POLL_MSEC)
-        {
-            WaitTime = CFE_PLATFORM_ES_STARTUP_SYNC_POLL_MSEC;
-        }
-        else if (WaitRemaining > 0)
-        {
-            WaitTime = WaitRemaining;
-        }
-        else
-        {
-            Status = CFE_ES_OPERATION_TIMED_OUT;
-            break;
-        }
-
-        OS_TaskDelay(WaitTime);
-        WaitRemaining -= WaitTime;
-    }
-
-    return Status;
+    return CFE_ES_StateWait(CFE_ES_SystemStateReached, &MinSystemState, TimeOutMilliseconds);
 }
 
 /*----------------------------------------------------------------
@@ -1015,8 +1005,12 @@ CFE_Status_t CFE_ES_GetAppInfo(CFE_ES_AppInfo_t *AppInfo, CFE_ES_AppId_t AppId)
     }
     else
     {
-        AppInfo->ResourceId = CFE_RESOURCEID_UNWRAP(AppId); /* make into a generic resource ID */
-        AppInfo->Type       = AppRecPtr->Type;
+        AppInfo->ResourceId      = CFE_RESOURCEID_UNWRAP(AppId); /* make into a generic resource ID */
+        AppInfo->Type            = AppRecPtr->Type;
+        AppInfo->TimeToReadyMsec = AppRecPtr->TimeToReadyMsec;
+
+        AppInfo->TaskPoolJobsPending   = AppRecPtr->TaskPoolJobsPending;
+        AppInfo->TaskPoolJobsCompleted = AppRecPtr->TaskPoolJobsCompleted;
 
         strncpy(AppInfo->Name, CFE_ES_AppRecordGetName(AppRecPtr), sizeof(AppInfo->Name) - 1);
 
@@ -1044,8 +1038,9 @@ CFE_Status_t CFE_ES_GetAppInfo(CFE_ES_AppInfo_t *AppInfo, CFE_ES_AppId_t AppId)
                     strncpy(AppInfo->MainTaskName, TaskRecPtr->TaskName, sizeof(AppInfo->MainTaskName) - 1);
                     AppInfo->MainTaskName[sizeof(AppInfo->MainTaskName) - 1] = '\0';
 
-                    AppInfo->StackSize = CFE_ES_MEMOFFSET_C(TaskRecPtr->StartParams.StackSize);
-                    AppInfo->Priority  = TaskRecPtr->StartParams.Priority;
+                    AppInfo->StackSize   = CFE_ES_MEMOFFSET_C(TaskRecPtr->StartParams.StackSize);
+                    AppInfo->Priority    = TaskRecPtr->StartParams.Priority;
+                    AppInfo->CpuAffinity = TaskRecPtr->StartParams.CpuAffinity;
                 }
                 else
                 {
@@ -1067,6 +1062,7 @@ CFE_Status_t CFE_ES_GetAppInfo(CFE_ES_AppInfo_t *AppInfo, CFE_ES_AppId_t AppId)
     if (Status == CFE_SUCCESS)
     {
         CFE_ES_CopyModuleAddressInfo(ModuleId, AppInfo);
+        CFE_ES_GetTaskSchedStats(AppInfo->MainTaskId, &AppInfo->Migrations, &AppInfo->InvoluntaryCtxSwitches);
     }
 
     return Status;
@@ -1215,6 +1211,7 @@ CFE_Status_t CFE_ES_GetTaskInfo(CFE_ES_TaskInfo_t *TaskInfo, CFE_ES_TaskId_t Tas
         TaskInfo->ExecutionCounter = TaskRecPtr->ExecutionCounter;
         TaskInfo->StackSize        = CFE_ES_MEMOFFSET_C(TaskRecPtr->StartParams.StackSize);
         TaskInfo->Priority         = TaskRecPtr->StartParams.Priority;
+        TaskInfo->CpuAffinity      = TaskRecPtr->StartParams.CpuAffinity;
 
         /*
         ** Get the Application Details
@@ -1235,6 +1232,11 @@ CFE_Status_t CFE_ES_GetTaskInfo(CFE_ES_TaskInfo_t *TaskInfo, CFE_ES_TaskId_t Tas
 
     CFE_ES_UnlockSharedData(__func__, __LINE__);
 
+    if (Status == CFE_SUCCESS)
+    {
+        CFE_ES_GetTaskSchedStats(TaskId, &TaskInfo->Migrations, &TaskInfo->InvoluntaryCtxSwitches);
+    }
+
     return Status;
 }
 
@@ -1257,8 +1259,9 @@ CFE_Status_t CFE_ES_CreateChildTask(CFE_ES_TaskId_t *TaskIdPtr, const char *Task
     ParentAppId = CFE_ES_APPID_UNDEFINED;
 
     memset(&Params, 0, sizeof(Params));
-    Params.Priority  = Priority;
-    Params.StackSize = StackSize;
+    Params.Priority    = Priority;
+    Params.StackSize   = StackSize;
+    Params.CpuAffinity = OS_TASK_CPU_AFFINITY_GET(Flags);
 
     /*
     ** Validate some of the arguments
@@ -1428,6 +1431,11 @@ CFE_Status_t CFE_ES_DeleteChildTask(CFE_ES_TaskId_t TaskId)
                     CFE_ES_TaskRecordSetFree(TaskRecPtr);
                     CFE_ES_Global.RegisteredTasks--;
 
+                    /*
+                    ** Return any blocks the task kept in memory pool caches
+                    */
+                    CFE_ES_MemPoolReleaseTaskCaches(OsalId);
+
                     /*
                     ** Report the task delete
                     */
@@ -1507,6 +1515,11 @@ void CFE_ES_ExitChildTask(void)
 
             CFE_ES_UnlockSharedData(__func__, __LINE__);
 
+            /*
+            ** Return any blocks this task kept in memory pool caches
+            */
+            CFE_ES_MemPoolReleaseTaskCaches(OS_TaskGetId());
+
             /*
             ** Call the OS AL routine
             */
@@ -1530,6 +1543,96 @@ void CFE_ES_ExitChildTask(void)
     CFE_ES_UnlockSharedData(__func__, __LINE__);
 }
 
+/*----------------------------------------------------------------
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_Status_t CFE_ES_TaskPoolSubmit(CFE_ES_TaskPoolJobFuncPtr_t JobFunc, void *JobArg)
+{
+    CFE_ES_AppRecord_t *        AppRecPtr;
+    CFE_ES_TaskPoolJobRecord_t *JobRecPtr;
+    CFE_ES_AppId_t              AppId;
+    int32                       OsStatus;
+    int32                       ReturnCode;
+    uint32                      i;
+
+    if (JobFunc == NULL)
+    {
+        CFE_ES_WriteToSysLog("%s: Job Function Pointer Parameter is NULL\n", __func__);
+        return CFE_ES_BAD_ARGUMENT;
+    }
+
+    JobRecPtr = NULL;
+    AppId     = CFE_ES_APPID_UNDEFINED;
+
+    CFE_ES_LockSharedData(__func__, __LINE__);
+
+    AppRecPtr = CFE_ES_GetAppRecordByContext();
+    if (AppRecPtr == NULL || AppRecPtr->AppState > CFE_ES_AppState_RUNNING)
+    {
+        CFE_ES_SysLogWrite_Unsync("%s: Invalid calling context when submitting a job\n", __func__);
+        ReturnCode = CFE_ES_ERR_RESOURCEID_NOT_VALID;
+    }
+    else
+    {
+        /* Reserve a job record, which the job entry point frees when the job returns */
+        ReturnCode = CFE_ES_NO_RESOURCE_IDS_AVAILABLE;
+        for (i = 0; i < OS_MAX_TASK_POOL_JOBS; ++i)
+        {
+            if (!CFE_RESOURCEID_TEST_DEFINED(CFE_ES_Global.TaskPoolJobTable[i].AppId))
+            {
+                AppId              = CFE_ES_AppRecordGetID(AppRecPtr);
+                JobRecPtr          = &CFE_ES_Global.TaskPoolJobTable[i];
+                JobRecPtr->AppId   = AppId;
+                JobRecPtr->JobFunc = JobFunc;
+                JobRecPtr->JobArg  = JobArg;
+                ++AppRecPtr->TaskPoolJobsPending;
+                ReturnCode = CFE_SUCCESS;
+                break;
+            }
+        }
+    }
+
+    CFE_ES_UnlockSharedData(__func__, __LINE__);
+
+    if (ReturnCode != CFE_SUCCESS)
+    {
+        return ReturnCode;
+    }
+
+    OsStatus = OS_TaskPoolSubmit(CFE_ES_TaskPoolJobEntry, JobRecPtr);
+    if (OsStatus != OS_SUCCESS)
+    {
+        CFE_ES_LockSharedData(__func__, __LINE__);
+
+        if (CFE_ES_AppRecordIsMatch(AppRecPtr, AppId))
+        {
+            --AppRecPtr->TaskPoolJobsPending;
+        }
+        JobRecPtr->AppId = CFE_ES_APPID_UNDEFINED;
+
+        CFE_ES_UnlockSharedData(__func__, __LINE__);
+
+        if (OsStatus == OS_QUEUE_FULL)
+        {
+            ReturnCode = CFE_ES_NO_RESOURCE_IDS_AVAILABLE;
+        }
+        else if (OsStatus == OS_ERR_NOT_IMPLEMENTED)
+        {
+            ReturnCode = CFE_ES_NOT_IMPLEMENTED;
+        }
+        else
+        {
+            CFE_ES_WriteToSysLog("%s: OS_TaskPoolSubmit failed, RC=%ld\n", __func__, (long)OsStatus);
+            ReturnCode = CFE_STATUS_EXTERNAL_RESOURCE_FAIL;
+        }
+    }
+
+    return ReturnCode;
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -1547,6 +1650,22 @@ CFE_Status_t CFE_ES_WriteToSysLog(const char *SpecStringPtr, ...)
         return CFE_ES_BAD_ARGUMENT;
     }
 
+    /*
+     * Normally the message is staged without locking, and the
+     * background task appends it to the syslog buffer and the console.
+     */
+    va_start(ArgPtr, SpecStringPtr);
+    ReturnCode = CFE_ES_SysLogStage(SpecStringPtr, ArgPtr);
+    va_end(ArgPtr);
+
+    if (ReturnCode != CFE_STATUS_INCORRECT_STATE)
+    {
+        return ReturnCode;
+    }
+
+    /*
+     * Staging is not running yet or is full, so write it directly.
+     */
     va_start(ArgPtr, SpecStringPtr);
     CFE_ES_SysLog_vsnprintf(TmpString, sizeof(TmpString), SpecStringPtr, ArgPtr);
     va_end(ArgPtr);
@@ -1554,12 +1673,15 @@ CFE_Status_t CFE_ES_WriteToSysLog(const char *SpecStringPtr, ...)
     /*
      * Append to the syslog buffer, which must be done while locked.
      * Only one thread can actively write into the buffer at time.
+     * Anything already staged is committed first to keep the order.
      */
     CFE_ES_LockSharedData(__func__, __LINE__);
+    CFE_ES_SysLogCommit_Unsync();
     ReturnCode = CFE_ES_SysLogAppend_Unsync(TmpString);
     CFE_ES_UnlockSharedData(__func__, __LINE__);
 
-    /* Output the entry to the console */
+    /* Output the staged entries, then this one, to the console */
+    CFE_ES_SysLogEcho();
     OS_printf("%s", TmpString);
 
     return ReturnCode;
@@ -1872,8 +1994,8 @@ CFE_Status_t CFE_ES_RegisterGenCounter(CFE_ES_CounterId_t *CounterIdPtr, const c
     else
     {
         /* scan for a free slot */
-        PendingResourceId = CFE_ResourceId_FindNext(CFE_ES_Global.LastCounterId, CFE_PLATFORM_ES_MAX_GEN_COUNTERS,
-                                                    CFE_ES_CheckCounterIdSlotUsed);
+        PendingResourceId = CFE_ResourceId_FindNextFree(CFE_ES_Global.LastCounterId, CFE_PLATFORM_ES_MAX_GEN_COUNTERS,
+                                                        CFE_ES_Global.CounterIdMap, CFE_ES_CheckCounterIdSlotUsed);
         CountRecPtr       = CFE_ES_LocateCounterRecordByID(CFE_ES_COUNTERID_C(PendingResourceId));
 
         if (CountRecPtr == NULL)
@@ -1916,6 +2038,8 @@ CFE_Status_t CFE_ES_DeleteGenCounter(CFE_ES_CounterId_t CounterId)
         if (CFE_ES_CounterRecordIsMatch(CountRecPtr, CounterId))
         {
             CountRecPtr->Counter = 0;
+            CFE_ResourceId_MapRelease(CFE_RESOURCEID_UNWRAP(CounterId), CFE_PLATFORM_ES_MAX_GEN_COUNTERS,
+                                      CFE_ES_Global.CounterIdMap);
             CFE_ES_CounterRecordSetFree(CountRecPtr);
             Status = CFE_SUCCESS;
         }
@@ -2072,8 +2196,7 @@ CFE_Status_t CFE_ES_GetGenCounterName(char *CounterName, CFE_ES_CounterId_t Coun
  *-----------------------------------------------------------------*/
 CFE_Status_t CFE_ES_AppID_ToIndex(CFE_ES_AppId_t AppID, uint32 *Idx)
 {
-    return CFE_ResourceId_ToIndex(CFE_RESOURCEID_UNWRAP(AppID), CFE_ES_APPID_BASE, CFE_PLATFORM_ES_MAX_APPLICATIONS,
-                                  Idx);
+    return CFE_ES_AppRecordIdToIndex(AppID, Idx);
 }
 
 /*----------------------------------------------------------------
@@ -2084,7 +2207,7 @@ CFE_Status_t CFE_ES_AppID_ToIndex(CFE_ES_AppId_t AppID, uint32 *Idx)
  *-----------------------------------------------------------------*/
 int32 CFE_ES_LibID_ToIndex(CFE_ES_LibId_t LibId, uint32 *Idx)
 {
-    return CFE_ResourceId_ToIndex(CFE_RESOURCEID_UNWRAP(LibId), CFE_ES_LIBID_BASE, CFE_PLATFORM_ES_MAX_LIBRARIES, Idx);
+    return CFE_ES_LibRecordIdToIndex(LibId, Idx);
 }
 
 /*----------------------------------------------------------------
@@ -2129,8 +2252,18 @@ CFE_Status_t CFE_ES_TaskID_ToIndex(CFE_ES_TaskId_t TaskID, uint32 *Idx)
  *-----------------------------------------------------------------*/
 CFE_Status_t CFE_ES_CounterID_ToIndex(CFE_ES_CounterId_t CounterId, uint32 *Idx)
 {
-    return CFE_ResourceId_ToIndex(CFE_RESOURCEID_UNWRAP(CounterId), CFE_ES_COUNTID_BASE,
-                                  CFE_PLATFORM_ES_MAX_GEN_COUNTERS, Idx);
+    return CFE_ES_CounterRecordIdToIndex(CounterId, Idx);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_Status_t CFE_ES_BackgroundJobID_ToIndex(CFE_ES_BackgroundJobId_t JobId, uint32 *Idx)
+{
+    return CFE_ES_BackgroundJobRecordIdToIndex(JobId, Idx);
 }
 
 /***************************************************************************************
@@ -2145,7 +2278,13 @@ CFE_Status_t CFE_ES_CounterID_ToIndex(CFE_ES_CounterId_t CounterId, uint32 *Idx)
  *-----------------------------------------------------------------*/
 void CFE_ES_LockSharedData(const char *FunctionName, int32 LineNumber)
 {
-    int32 OsStatus;
+    int32                    OsStatus;
+    CFE_ES_LockProfileWait_t ProfileWait;
+
+    if (CFE_PLATFORM_ES_LOCK_PROFILE)
+    {
+        CFE_ES_LockProfileWait(CFE_ES_LockProfileLock_ES_SHARED_DATA, &ProfileWait);
+    }
 
     OsStatus = OS_MutSemTake(CFE_ES_Global.SharedDataMutex);
     if (OsStatus != OS_SUCCESS)
@@ -2157,6 +2296,10 @@ void CFE_ES_LockSharedData(const char *FunctionName, int32 LineNumber)
         CFE_ES_SysLogWrite_Unsync("%s: SharedData Mutex Take Err Stat=%ld,Func=%s,Line=%d\n", __func__, (long)OsStatus,
                                   FunctionName, (int)LineNumber);
     }
+    else if (CFE_PLATFORM_ES_LOCK_PROFILE)
+    {
+        CFE_ES_LockProfileAcquired(CFE_ES_LockProfileLock_ES_SHARED_DATA, &ProfileWait, FunctionName, LineNumber);
+    }
 }
 
 /*----------------------------------------------------------------
@@ -2169,6 +2312,11 @@ void CFE_ES_UnlockSharedData(const char *FunctionName, int32 LineNumber)
 {
     int32 OsStatus;
 
+    if (CFE_PLATFORM_ES_LOCK_PROFILE)
+    {
+        CFE_ES_LockProfileRelease(CFE_ES_LockProfileLock_ES_SHARED_DATA);
+    }
+
     OsStatus = OS_MutSemGive(CFE_ES_Global.SharedDataMutex);
     if (OsStatus != OS_SUCCESS)
     {
@@ -48,7 +48,8 @@
 /*
 ** Defines
 */
-#define ES_START_BUFF_SIZE 128
+#define ES_START_BUFF_SIZE CFE_ES_STARTSCRIPT_MAX_LINE_LENGTH
+#define ES_START_READ_SIZE 256 /* Bytes of the startup script read at a time */
 
 /*
 **
@@ -70,18 +71,11 @@
  *-----------------------------------------------------------------*/
 void CFE_ES_StartApplications(uint32 ResetType, const char *StartFilePath)
 {
-    char        ES_AppLoadBuffer[ES_START_BUFF_SIZE]; /* A buffer of for a line in a file */
-    char        ScriptFileName[OS_MAX_PATH_LEN];
-    const char *TokenList[CFE_ES_STARTSCRIPT_MAX_TOKENS_PER_LINE];
-    uint32      NumTokens;
-    uint32      NumLines;
-    uint32      BuffLen; /* Length of the current buffer */
-    osal_id_t   AppFile = OS_OBJECT_ID_UNDEFINED;
-    int32       Status;
-    int32       OsStatus;
-    char        c           = 0;
-    bool        LineTooLong = false;
-    bool        FileOpened  = false;
+    char      ScriptFileName[OS_MAX_PATH_LEN];
+    osal_id_t AppFile = OS_OBJECT_ID_UNDEFINED;
+    int32     Status;
+    int32     OsStatus;
+    bool      FileOpened = false;
 
     /*
     ** Get the ES startup script filename.
@@ -156,19 +150,108 @@ void CFE_ES_StartApplications(uint32 ResetType, const char *StartFilePath)
     {
         CFE_ES_WriteToSysLog("%s: Opened ES App Startup file: %s\n", __func__, ScriptFileName);
 
-        memset(ES_AppLoadBuffer, 0x0, ES_START_BUFF_SIZE);
-        BuffLen      = 0;
-        NumTokens    = 0;
-        NumLines     = 0;
-        TokenList[0] = ES_AppLoadBuffer;
+        /*
+        ** Load all libraries in script order, and queue the applications
+        */
+        CFE_ES_ProcessStartupScript(AppFile);
 
         /*
-        ** Parse the lines from the file. If it has an error
-        ** or reaches EOF, then abort the loop.
+        ** close the file
         */
-        while (1)
+        OS_close(AppFile);
+        CFE_ES_StartupTimeMark(&CFE_ES_Global.StartupState.Timeline.LibsLoadedMsec);
+
+        /*
+        ** Then create the applications, once every library is available
+        */
+        CFE_ES_RunStartupLoaders(CFE_PLATFORM_ES_STARTUP_LOADER_TASKS);
+        CFE_ES_StartupTimeMark(&CFE_ES_Global.StartupState.Timeline.AppsCreatedMsec);
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Processes one complete startup script line.  Libraries are loaded right
+ * away, applications are queued for the loader tasks.
+ *
+ *-----------------------------------------------------------------*/
+static void CFE_ES_ProcessStartupScriptLine(const char **TokenList, uint32 NumTokens, uint32 LineLen,
+                                            uint32 LineNum)
+{
+    CFE_ES_StartupState_t *   StartupState = &CFE_ES_Global.StartupState;
+    CFE_ES_StartupAppEntry_t *AppEntry;
+    int32                     Status;
+
+    if (strcmp(TokenList[0], "CFE_APP") == 0)
+    {
+        if (StartupState->NumAppEntries < CFE_PLATFORM_ES_MAX_APPLICATIONS)
+        {
+            AppEntry = &StartupState->AppEntries[StartupState->NumAppEntries];
+            memcpy(AppEntry->Line, TokenList[0], LineLen);
+            AppEntry->NumTokens = NumTokens;
+            ++StartupState->NumAppEntries;
+        }
+        else
         {
-            OsStatus = OS_read(AppFile, &c, 1);
+            /* The line is not parsed yet, so it may not have a name field */
+            CFE_ES_WriteToSysLog("%s: Too many applications in startup file, line %u not started\n", __func__,
+                                 (unsigned int)LineNum);
+            ++StartupState->Timeline.ScriptErrors;
+        }
+    }
+    else
+    {
+        Status = CFE_ES_ParseFileEntry(TokenList, NumTokens);
+        if (Status == CFE_SUCCESS)
+        {
+            ++StartupState->Timeline.LibsLoaded;
+        }
+        else
+        {
+            ++StartupState->Timeline.ScriptErrors;
+        }
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_ProcessStartupScript(osal_id_t AppFile)
+{
+    char        ES_AppLoadBuffer[ES_START_BUFF_SIZE + 1]; /* A buffer of for a line in a file, plus termination */
+    char        ReadBuffer[ES_START_READ_SIZE];           /* A block of the file */
+    const char *TokenList[CFE_ES_STARTSCRIPT_MAX_TOKENS_PER_LINE];
+    uint32      NumTokens;
+    uint32      NumLines;
+    uint32      BuffLen; /* Length of the current buffer */
+    uint32      ReadLen; /* Length of the current block */
+    uint32      ReadPos; /* Position within the current block */
+    int32       OsStatus;
+    char        c           = 0;
+    bool        LineTooLong = false;
+
+    memset(ES_AppLoadBuffer, 0x0, sizeof(ES_AppLoadBuffer));
+    BuffLen      = 0;
+    NumTokens    = 0;
+    NumLines     = 0;
+    ReadLen      = 0;
+    ReadPos      = 0;
+    TokenList[0] = ES_AppLoadBuffer;
+
+    /*
+    ** Parse the lines from the file. If it has an error
+    ** or reaches EOF, then abort the loop.
+    */
+    while (1)
+    {
+        if (ReadPos >= ReadLen)
+        {
+            OsStatus = OS_read(AppFile, ReadBuffer, sizeof(ReadBuffer));
             if (OsStatus < OS_SUCCESS)
             {
                 CFE_ES_WriteToSysLog("%s: Error Reading Startup file. EC = %ld\n", __func__, (long)OsStatus);
@@ -181,99 +264,266 @@ void CFE_ES_StartApplications(uint32 ResetType, const char *StartFilePath)
                 */
                 break;
             }
-            else if (c != '!')
+
+            ReadLen = OsStatus;
+            ReadPos = 0;
+        }
+
+        c = ReadBuffer[ReadPos];
+        ++ReadPos;
+
+        if (c != '!')
+        {
+            if (c <= ' ')
             {
-                if (c <= ' ')
+                /*
+                ** Skip all white space in the file
+                */
+                ;
+            }
+            else if (c == ',')
+            {
+                /*
+                ** replace the field delimiter with a null
+                ** This is used to separate the tokens
+                */
+                if (BuffLen < ES_START_BUFF_SIZE)
                 {
-                    /*
-                    ** Skip all white space in the file
-                    */
-                    ;
+                    ES_AppLoadBuffer[BuffLen] = 0;
                 }
-                else if (c == ',')
+                else
                 {
-                    /*
-                    ** replace the field delimiter with a null
-                    ** This is used to separate the tokens
-                    */
-                    if (BuffLen < ES_START_BUFF_SIZE)
-                    {
-                        ES_AppLoadBuffer[BuffLen] = 0;
-                    }
-                    else
-                    {
-                        LineTooLong = true;
-                    }
-                    BuffLen++;
-
-                    ++NumTokens;
-                    if (NumTokens < CFE_ES_STARTSCRIPT_MAX_TOKENS_PER_LINE)
-                    {
-                        /*
-                         * NOTE: pointer never dereferenced unless "LineTooLong" is false.
-                         */
-                        TokenList[NumTokens] = &ES_AppLoadBuffer[BuffLen];
-                    }
-                    else
-                    {
-                        LineTooLong = true;
-                    }
+                    LineTooLong = true;
                 }
-                else if (c != ';')
+                BuffLen++;
+
+                ++NumTokens;
+                if (NumTokens < CFE_ES_STARTSCRIPT_MAX_TOKENS_PER_LINE)
                 {
                     /*
-                    ** Regular data gets copied in
-                    */
-                    if (BuffLen < ES_START_BUFF_SIZE)
-                    {
-                        ES_AppLoadBuffer[BuffLen] = c;
-                    }
-                    else
-                    {
-                        LineTooLong = true;
-                    }
-                    BuffLen++;
+                     * NOTE: pointer never dereferenced unless "LineTooLong" is false.
+                     */
+                    TokenList[NumTokens] = &ES_AppLoadBuffer[BuffLen];
                 }
                 else
                 {
-                    ++NumLines;
-
-                    if (LineTooLong == true)
-                    {
-                        /*
-                        ** The line was not formed correctly
-                        */
-                        CFE_ES_WriteToSysLog("%s: **WARNING** File Line %u is malformed: %u bytes, %u tokens.\n",
-                                             __func__, (unsigned int)NumLines, (unsigned int)BuffLen,
-                                             (unsigned int)NumTokens);
-                        LineTooLong = false;
-                    }
-                    else
-                    {
-                        /*
-                        ** Send the line to the file parser
-                        ** Ensure termination of the last token and send it along
-                        */
-                        ES_AppLoadBuffer[BuffLen] = 0;
-                        CFE_ES_ParseFileEntry(TokenList, 1 + NumTokens);
-                    }
-                    BuffLen   = 0;
-                    NumTokens = 0;
+                    LineTooLong = true;
                 }
             }
-            else
+            else if (c != ';')
             {
                 /*
-                ** break when EOF character '!' is reached
+                ** Regular data gets copied in
                 */
-                break;
+                if (BuffLen < ES_START_BUFF_SIZE)
+                {
+                    ES_AppLoadBuffer[BuffLen] = c;
+                }
+                else
+                {
+                    LineTooLong = true;
+                }
+                BuffLen++;
             }
+            else
+            {
+                ++NumLines;
+
+                if (LineTooLong == true)
+                {
+                    /*
+                    ** The line was not formed correctly
+                    */
+                    CFE_ES_WriteToSysLog("%s: **WARNING** File Line %u is malformed: %u bytes, %u tokens.\n",
+                                         __func__, (unsigned int)NumLines, (unsigned int)BuffLen,
+                                         (unsigned int)NumTokens);
+                    ++CFE_ES_Global.StartupState.Timeline.ScriptErrors;
+                    LineTooLong = false;
+                }
+                else
+                {
+                    /*
+                    ** Send the line to the file parser
+                    ** Ensure termination of the last token and send it along
+                    */
+                    ES_AppLoadBuffer[BuffLen] = 0;
+                    CFE_ES_ProcessStartupScriptLine(TokenList, 1 + NumTokens, 1 + BuffLen, NumLines);
+                }
+                BuffLen   = 0;
+                NumTokens = 0;
+            }
+        }
+        else
+        {
+            /*
+            ** break when EOF character '!' is reached
+            */
+            break;
+        }
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Creates queued applications, in script order, until none are left
+ * unclaimed.  Runs concurrently in every loader task.
+ *
+ *-----------------------------------------------------------------*/
+static void CFE_ES_StartupLoaderProcess(void)
+{
+    CFE_ES_StartupState_t *   StartupState = &CFE_ES_Global.StartupState;
+    CFE_ES_StartupAppEntry_t *AppEntry;
+    const char *              TokenList[CFE_ES_STARTSCRIPT_MAX_TOKENS_PER_LINE];
+    uint32                    i;
+    int32                     Status;
+
+    while (true)
+    {
+        AppEntry = NULL;
+
+        CFE_ES_LockSharedData(__func__, __LINE__);
+        if (StartupState->NextAppEntry < StartupState->NumAppEntries)
+        {
+            AppEntry = &StartupState->AppEntries[StartupState->NextAppEntry];
+            ++StartupState->NextAppEntry;
         }
+        CFE_ES_UnlockSharedData(__func__, __LINE__);
+
+        if (AppEntry == NULL)
+        {
+            break;
+        }
+
         /*
-        ** close the file
+        ** The tokens were stored back to back, each one null terminated
         */
-        OS_close(AppFile);
+        TokenList[0] = AppEntry->Line;
+        for (i = 1; i < AppEntry->NumTokens; ++i)
+        {
+            TokenList[i] = TokenList[i - 1] + strlen(TokenList[i - 1]) + 1;
+        }
+
+        Status = CFE_ES_ParseFileEntry(TokenList, AppEntry->NumTokens);
+
+        CFE_ES_LockSharedData(__func__, __LINE__);
+        if (Status == CFE_SUCCESS)
+        {
+            ++StartupState->Timeline.AppsCreated;
+        }
+        else
+        {
+            ++StartupState->Timeline.ScriptErrors;
+        }
+        CFE_ES_UnlockSharedData(__func__, __LINE__);
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_StartupLoaderTask(void)
+{
+    CFE_ES_StartupLoaderProcess();
+    OS_CountSemGive(CFE_ES_Global.StartupState.LoaderSem);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_RunStartupLoaders(uint32 NumLoaders)
+{
+    char      LoaderName[OS_MAX_API_NAME];
+    osal_id_t LoaderTaskId;
+    uint32    NumStarted;
+    uint32    i;
+    int32     OsStatus;
+
+    CFE_ES_Global.StartupState.NextAppEntry = 0;
+    NumStarted                              = 0;
+
+    if (NumLoaders > 1)
+    {
+        OsStatus = OS_CountSemCreate(&CFE_ES_Global.StartupState.LoaderSem, "ES_LOADER_DONE", 0, 0);
+        if (OsStatus != OS_SUCCESS)
+        {
+            CFE_ES_WriteToSysLog("%s: Cannot create loader semaphore, EC = %ld\n", __func__, (long)OsStatus);
+            NumLoaders = 1;
+        }
+    }
+
+    /*
+    ** Any loader that cannot be created is not fatal, its share of the
+    ** applications is simply claimed by the others.
+    */
+    for (i = 1; i < NumLoaders; ++i)
+    {
+        snprintf(LoaderName, sizeof(LoaderName), "ES_LOADER_%u", (unsigned int)i);
+        OsStatus = OS_TaskCreate(&LoaderTaskId, LoaderName, CFE_ES_StartupLoaderTask, OSAL_TASK_STACK_ALLOCATE,
+                                 CFE_PLATFORM_ES_DEFAULT_STACK_SIZE, CFE_PLATFORM_ES_START_TASK_PRIORITY, 0);
+        if (OsStatus == OS_SUCCESS)
+        {
+            ++NumStarted;
+        }
+        else
+        {
+            CFE_ES_WriteToSysLog("%s: Cannot create loader task %s, EC = %ld\n", __func__, LoaderName,
+                                 (long)OsStatus);
+        }
     }
+
+    /*
+    ** The calling task is always one of the loaders
+    */
+    CFE_ES_StartupLoaderProcess();
+
+    for (i = 0; i < NumStarted; ++i)
+    {
+        OS_CountSemTake(CFE_ES_Global.StartupState.LoaderSem);
+    }
+
+    if (NumLoaders > 1)
+    {
+        OS_CountSemDelete(CFE_ES_Global.StartupState.LoaderSem);
+        CFE_ES_Global.StartupState.LoaderSem = OS_OBJECT_ID_UNDEFINED;
+    }
+
+    CFE_ES_Global.StartupState.Timeline.LoaderTasks = 1 + NumStarted;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_AppSetState(CFE_ES_AppRecord_t *AppRecPtr, CFE_ES_AppState_Enum_t NewState)
+{
+    OS_time_t Now;
+    int64     ElapsedMsec;
+
+    AppRecPtr->AppState = NewState;
+
+    if (NewState == CFE_ES_AppState_RUNNING && AppRecPtr->TimeToReadyMsec == 0)
+    {
+        CFE_PSP_GetTime(&Now);
+        ElapsedMsec = OS_TimeGetTotalMilliseconds(OS_TimeSubtract(Now, AppRecPtr->CreateTime));
+        if (ElapsedMsec < 1)
+        {
+            /* zero means "not ready yet" */
+            ElapsedMsec = 1;
+        }
+        AppRecPtr->TimeToReadyMsec = (uint32)ElapsedMsec;
+    }
+
+    CFE_ES_StartupSyncNotify();
 }
 
 /*----------------------------------------------------------------
@@ -286,6 +536,7 @@ int32 CFE_ES_ParseFileEntry(const char **TokenList, uint32 NumTokens)
 {
     const char *  ModuleName;
     const char *  EntryType;
+    char *        ParseEnd;
     unsigned long ParsedValue;
     union
     {
@@ -362,6 +613,23 @@ int32 CFE_ES_ParseFileEntry(const char **TokenList, uint32 NumTokens)
             ParamBuf.ExceptionAction = (CFE_ES_ExceptionAction_Enum_t)ParsedValue;
         }
 
+        /*
+        ** The CPU affinity mask is optional, older scripts end after the exception action
+        */
+        if (NumTokens > CFE_ES_STARTSCRIPT_AFFINITY_TOKEN)
+        {
+            ParsedValue = strtoul(TokenList[CFE_ES_STARTSCRIPT_AFFINITY_TOKEN], &ParseEnd, 0);
+            if (ParseEnd == TokenList[CFE_ES_STARTSCRIPT_AFFINITY_TOKEN] || *ParseEnd != 0 ||
+                ParsedValue > (OS_TASK_CPU_AFFINITY_MASK >> OS_TASK_CPU_AFFINITY_SHIFT))
+            {
+                CFE_ES_WriteToSysLog("%s: Invalid CPU affinity %s for APP: %s\n", __func__,
+                                     TokenList[CFE_ES_STARTSCRIPT_AFFINITY_TOKEN], ModuleName);
+                return CFE_ES_BAD_ARGUMENT;
+            }
+
+            ParamBuf.MainTaskInfo.CpuAffinity = (uint32)ParsedValue;
+        }
+
         /*
         ** Now create the application
         */
@@ -485,6 +753,34 @@ int32 CFE_ES_LoadModule(CFE_ResourceId_t ParentResourceId, const char *ModuleNam
     return ReturnCode;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Wait condition for CFE_ES_GetTaskFunction(), true once the record of the
+ * calling task is complete.  The entry function is output via the argument.
+ *
+ *-----------------------------------------------------------------*/
+static bool CFE_ES_TaskFunctionReady(void *Arg)
+{
+    CFE_ES_TaskEntryFuncPtr_t *EntryFuncPtr = Arg;
+    CFE_ES_TaskRecord_t *      TaskRecPtr;
+    bool                       IsReady;
+
+    IsReady = false;
+
+    CFE_ES_LockSharedData(__func__, __LINE__);
+    TaskRecPtr = CFE_ES_GetTaskRecordByContext();
+    if (TaskRecPtr != NULL)
+    {
+        *EntryFuncPtr = TaskRecPtr->EntryFunc;
+        IsReady       = (CFE_RESOURCEID_TEST_DEFINED(TaskRecPtr->AppId) && *EntryFuncPtr != NULL);
+    }
+    CFE_ES_UnlockSharedData(__func__, __LINE__);
+
+    return IsReady;
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -493,41 +789,19 @@ int32 CFE_ES_LoadModule(CFE_ResourceId_t ParentResourceId, const char *ModuleNam
  *-----------------------------------------------------------------*/
 int32 CFE_ES_GetTaskFunction(CFE_ES_TaskEntryFuncPtr_t *FuncPtr)
 {
-    CFE_ES_TaskRecord_t *     TaskRecPtr;
     CFE_ES_TaskEntryFuncPtr_t EntryFunc;
     int32                     ReturnCode;
-    int32                     Timeout;
 
     /*
-     * Use the same timeout as was used for the startup script itself.
+     * The task record is filled in by the parent after OS_TaskCreate() returns,
+     * which broadcasts once it is done.  Use the same timeout as was used for the
+     * startup script itself.
      */
-    ReturnCode = CFE_ES_ERR_APP_REGISTER;
-    Timeout    = CFE_PLATFORM_ES_STARTUP_SCRIPT_TIMEOUT_MSEC;
     EntryFunc  = NULL;
-
-    while (true)
+    ReturnCode = CFE_ES_StateWait(CFE_ES_TaskFunctionReady, &EntryFunc, CFE_PLATFORM_ES_STARTUP_SCRIPT_TIMEOUT_MSEC);
+    if (ReturnCode != CFE_SUCCESS)
     {
-        OS_TaskDelay(CFE_PLATFORM_ES_STARTUP_SYNC_POLL_MSEC);
-
-        CFE_ES_LockSharedData(__func__, __LINE__);
-        TaskRecPtr = CFE_ES_GetTaskRecordByContext();
-        if (TaskRecPtr != NULL)
-        {
-            EntryFunc = TaskRecPtr->EntryFunc;
-            if (CFE_RESOURCEID_TEST_DEFINED(TaskRecPtr->AppId) && EntryFunc != 0)
-            {
-                ReturnCode = CFE_SUCCESS;
-            }
-        }
-        CFE_ES_UnlockSharedData(__func__, __LINE__);
-
-        if (ReturnCode == CFE_SUCCESS || Timeout <= 0)
-        {
-            /* end of loop condition */
-            break;
-        }
-
-        Timeout -= CFE_PLATFORM_ES_STARTUP_SYNC_POLL_MSEC;
+        ReturnCode = CFE_ES_ERR_APP_REGISTER;
     }
 
     /* output function address to caller */
@@ -581,6 +855,10 @@ int32 CFE_ES_StartAppTask(CFE_ES_TaskId_t *TaskIdPtr, const char *TaskName, CFE_
     CFE_ES_TaskId_t      LocalTaskId;
     int32                OsStatus;
     int32                ReturnCode;
+    uint32               TaskFlags;
+
+    /* All cFE tasks may use floating point, and are optionally pinned to a set of CPUs */
+    TaskFlags = OS_FP_ENABLED | OS_TASK_CPU_AFFINITY(Params->CpuAffinity);
 
     /*
      * Create the primary task for the newly loaded task
@@ -591,7 +869,7 @@ int32 CFE_ES_StartAppTask(CFE_ES_TaskId_t *TaskIdPtr, const char *TaskName, CFE_
                              OSAL_TASK_STACK_ALLOCATE, /* stack pointer (allocate) */
                              Params->StackSize,        /* stack size */
                              Params->Priority,         /* task priority */
-                             OS_FP_ENABLED);           /* task options */
+                             TaskFlags);               /* task options */
 
     CFE_ES_LockSharedData(__func__, __LINE__);
 
@@ -642,6 +920,14 @@ int32 CFE_ES_StartAppTask(CFE_ES_TaskId_t *TaskIdPtr, const char *TaskName, CFE_
 
     CFE_ES_UnlockSharedData(__func__, __LINE__);
 
+    /*
+     * The new task may already be waiting in CFE_ES_GetTaskFunction()
+     */
+    if (ReturnCode == CFE_SUCCESS)
+    {
+        CFE_ES_StateBroadcast();
+    }
+
     return ReturnCode;
 }
 
@@ -703,8 +989,8 @@ int32 CFE_ES_AppCreate(CFE_ES_AppId_t *ApplicationIdPtr, const char *AppName, co
     else
     {
         /* scan for a free slot */
-        PendingResourceId = CFE_ResourceId_FindNext(CFE_ES_Global.LastAppId, CFE_PLATFORM_ES_MAX_APPLICATIONS,
-                                                    CFE_ES_CheckAppIdSlotUsed);
+        PendingResourceId = CFE_ResourceId_FindNextFree(CFE_ES_Global.LastAppId, CFE_PLATFORM_ES_MAX_APPLICATIONS,
+                                                        CFE_ES_Global.AppIdMap, CFE_ES_CheckAppIdSlotUsed);
         AppRecPtr         = CFE_ES_LocateAppRecordByID(CFE_ES_APPID_C(PendingResourceId));
 
         if (AppRecPtr == NULL)
@@ -721,6 +1007,7 @@ int32 CFE_ES_AppCreate(CFE_ES_AppId_t *ApplicationIdPtr, const char *AppName, co
             strncpy(AppRecPtr->AppName, AppName, sizeof(AppRecPtr->AppName) - 1);
 
             AppRecPtr->Type = CFE_ES_AppType_EXTERNAL;
+            CFE_PSP_GetTime(&AppRecPtr->CreateTime);
 
             /*
              * Fill out the parameters in the StartParams sub-structure
@@ -736,6 +1023,7 @@ int32 CFE_ES_AppCreate(CFE_ES_AppId_t *ApplicationIdPtr, const char *AppName, co
              */
             AppRecPtr->ControlReq.AppControlRequest = CFE_ES_RunStatus_APP_RUN;
             AppRecPtr->ControlReq.AppTimerMsec      = 0;
+            AppRecPtr->ControlReq.JobWaitMsec       = 0;
 
             CFE_ES_AppRecordSetUsed(AppRecPtr, CFE_RESOURCEID_RESERVED);
             CFE_ES_Global.LastAppId = PendingResourceId;
@@ -797,6 +1085,7 @@ int32 CFE_ES_AppCreate(CFE_ES_AppId_t *ApplicationIdPtr, const char *AppName, co
         /*
          * Set the table entry back to free
          */
+        CFE_ResourceId_MapRelease(PendingResourceId, CFE_PLATFORM_ES_MAX_APPLICATIONS, CFE_ES_Global.AppIdMap);
         CFE_ES_AppRecordSetFree(AppRecPtr);
         PendingResourceId = CFE_RESOURCEID_UNDEFINED;
     }
@@ -874,7 +1163,8 @@ int32 CFE_ES_LoadLibrary(CFE_ES_LibId_t *LibraryIdPtr, const char *LibName, cons
     {
         /* scan for a free slot */
         PendingResourceId =
-            CFE_ResourceId_FindNext(CFE_ES_Global.LastLibId, CFE_PLATFORM_ES_MAX_LIBRARIES, CFE_ES_CheckLibIdSlotUsed);
+            CFE_ResourceId_FindNextFree(CFE_ES_Global.LastLibId, CFE_PLATFORM_ES_MAX_LIBRARIES, CFE_ES_Global.LibIdMap,
+                                        CFE_ES_CheckLibIdSlotUsed);
         LibSlotPtr = CFE_ES_LocateLibRecordByID(CFE_ES_LIBID_C(PendingResourceId));
 
         if (LibSlotPtr == NULL)
@@ -951,6 +1241,7 @@ int32 CFE_ES_LoadLibrary(CFE_ES_LibId_t *LibraryIdPtr, const char *LibName, cons
     }
     else
     {
+        CFE_ResourceId_MapRelease(PendingResourceId, CFE_PLATFORM_ES_MAX_LIBRARIES, CFE_ES_Global.LibIdMap);
         CFE_ES_LibRecordSetFree(LibSlotPtr);
         PendingResourceId = CFE_RESOURCEID_UNDEFINED;
     }
@@ -1039,9 +1330,23 @@ bool CFE_ES_RunAppTableScan(uint32 ElapsedTime, void *Arg)
                 {
                     AppPtr->ControlReq.AppTimerMsec = 0;
 
-                    /* Add it to the list to be processed later */
-                    AppTimeoutList[NumAppTimeouts] = CFE_ES_AppRecordGetID(AppPtr);
-                    ++NumAppTimeouts;
+                    /*
+                     * Task pool jobs of the app may still be using its code and data,
+                     * so they are given the same time to return as background jobs
+                     * get in CFE_ES_BackgroundCleanUpApp().  CFE_ES_CleanUpApp()
+                     * reports any that are still pending after that.
+                     */
+                    if (AppPtr->TaskPoolJobsPending != 0 &&
+                        AppPtr->ControlReq.JobWaitMsec < CFE_ES_APP_JOB_DRAIN_TIMEOUT)
+                    {
+                        AppPtr->ControlReq.JobWaitMsec += ElapsedTime;
+                    }
+                    else
+                    {
+                        /* Add it to the list to be processed later */
+                        AppTimeoutList[NumAppTimeouts] = CFE_ES_AppRecordGetID(AppPtr);
+                        ++NumAppTimeouts;
+                    }
                 }
             }
             else if (AppPtr->AppState == CFE_ES_AppState_RUNNING &&
@@ -1051,6 +1356,7 @@ bool CFE_ES_RunAppTableScan(uint32 ElapsedTime, void *Arg)
                 /* switch to WAITING state, and set the timer for transition */
                 AppPtr->AppState                = CFE_ES_AppState_WAITING;
                 AppPtr->ControlReq.AppTimerMsec = CFE_PLATFORM_ES_APP_KILL_TIMEOUT * CFE_PLATFORM_ES_APP_SCAN_RATE;
+                AppPtr->ControlReq.JobWaitMsec  = 0;
             }
         }
 
@@ -1323,14 +1629,16 @@ int32 CFE_ES_CleanUpApp(CFE_ES_AppId_t AppId)
     osal_id_t               ModuleId;
     uint32                  NumTasks;
     uint32                  NumPools;
+    uint32                  NumPoolJobs;
     CFE_ES_AppRecord_t *    AppRecPtr;
     CFE_ES_TaskRecord_t *   TaskRecPtr;
     CFE_ES_MemPoolRecord_t *MemPoolRecPtr;
 
-    NumTasks   = 0;
-    NumPools   = 0;
-    ModuleId   = OS_OBJECT_ID_UNDEFINED;
-    ReturnCode = CFE_SUCCESS;
+    NumTasks    = 0;
+    NumPools    = 0;
+    NumPoolJobs = 0;
+    ModuleId    = OS_OBJECT_ID_UNDEFINED;
+    ReturnCode  = CFE_SUCCESS;
 
     AppRecPtr = CFE_ES_LocateAppRecordByID(AppId);
 
@@ -1354,6 +1662,9 @@ int32 CFE_ES_CleanUpApp(CFE_ES_AppId_t AppId)
             ModuleId = AppRecPtr->LoadStatus.ModuleId;
         }
 
+        /* only nonzero if the scan gave up waiting for these */
+        NumPoolJobs = AppRecPtr->TaskPoolJobsPending;
+
         /*
          * Collect all tasks associated with this app
          */
@@ -1427,6 +1738,26 @@ int32 CFE_ES_CleanUpApp(CFE_ES_AppId_t AppId)
      * than one lock at a time.
      */
 
+    /*
+     * Stop calling the background jobs of the app first, as those
+     * may use any of the other resources.  A background or task pool
+     * job that is still running may be executing the app code, so in
+     * that case the module is not unloaded.
+     */
+    Status = CFE_ES_BackgroundCleanUpApp(AppId);
+    if (NumPoolJobs != 0)
+    {
+        CFE_ES_WriteToSysLog("%s: %lu task pool job(s) of AppID %lu still running\n", __func__,
+                             (unsigned long)NumPoolJobs, CFE_RESOURCEID_TO_ULONG(AppId));
+    }
+    if (Status != CFE_SUCCESS || NumPoolJobs != 0)
+    {
+        CFE_ES_WriteToSysLog("%s: Module (ID:0x%08lX) not unloaded, job(s) still running\n", __func__,
+                             OS_ObjectIdToInteger(ModuleId));
+        ModuleId   = OS_OBJECT_ID_UNDEFINED;
+        ReturnCode = CFE_ES_APP_CLEANUP_ERR;
+    }
+
     /*
      ** Call the Table Clean up function
      */
@@ -1527,6 +1858,8 @@ int32 CFE_ES_CleanUpApp(CFE_ES_AppId_t AppId)
      */
     if (CFE_ES_AppRecordIsMatch(AppRecPtr, CFE_ES_APPID_C(CFE_RESOURCEID_RESERVED)))
     {
+        CFE_ResourceId_MapRelease(CFE_RESOURCEID_UNWRAP(AppId), CFE_PLATFORM_ES_MAX_APPLICATIONS,
+                                  CFE_ES_Global.AppIdMap);
         CFE_ES_AppRecordSetFree(AppRecPtr);
     }
 
@@ -1699,6 +2032,9 @@ int32 CFE_ES_CleanupTaskResources(CFE_ES_TaskId_t TaskId)
     OsStatus = OS_TaskDelete(OsalId);
     if (OsStatus == OS_SUCCESS || OsStatus == OS_ERR_INVALID_ID)
     {
+        /* Blocks the task kept in memory pool caches would otherwise be lost */
+        CFE_ES_MemPoolReleaseTaskCaches(OsalId);
+
         Result = CleanState.OverallStatus;
         if (Result == CFE_SUCCESS && CleanState.FoundObjects > 0)
         {
@@ -1775,3 +2111,122 @@ void CFE_ES_CopyModuleAddressInfo(osal_id_t ModuleId, CFE_ES_AppInfo_t *AppInfoP
     AppInfoPtr->BSSAddress  = CFE_ES_MEMADDRESS_C(ModuleInfo.addr.bss_address);
     AppInfoPtr->BSSSize     = CFE_ES_MEMOFFSET_C(ModuleInfo.addr.bss_size);
 }
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_GetTaskSchedStats(CFE_ES_TaskId_t TaskId, uint32 *Migrations, uint32 *InvoluntaryCtxSwitches)
+{
+    OS_task_prop_t TaskProp;
+
+    memset(&TaskProp, 0, sizeof(TaskProp));
+
+    if (OS_TaskGetInfo(CFE_ES_TaskId_ToOSAL(TaskId), &TaskProp) != OS_SUCCESS)
+    {
+        memset(&TaskProp, 0, sizeof(TaskProp));
+    }
+
+    *Migrations             = TaskProp.migrations;
+    *InvoluntaryCtxSwitches = TaskProp.involuntary_switches;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_ES_SampleTaskStats(CFE_ES_TaskStats_t *StatsPtr, CFE_ES_TaskId_t TaskId, OS_time_t Interval)
+{
+    CFE_ES_TaskRecord_t *TaskRecPtr;
+    OS_task_prop_t       TaskProp;
+    OS_time_t            PrevCpuTime;
+    int64                IntervalUsec;
+    int64                CpuUsec;
+    int32                Status;
+
+    memset(StatsPtr, 0, sizeof(*StatsPtr));
+    PrevCpuTime = OS_TimeFromTotalMilliseconds(0);
+
+    TaskRecPtr = CFE_ES_LocateTaskRecordByID(TaskId);
+
+    CFE_ES_LockSharedData(__func__, __LINE__);
+
+    if (CFE_ES_TaskRecordIsMatch(TaskRecPtr, TaskId))
+    {
+        StatsPtr->TaskId = TaskId;
+        StatsPtr->AppId  = TaskRecPtr->AppId;
+        strncpy(StatsPtr->TaskName, TaskRecPtr->TaskName, sizeof(StatsPtr->TaskName) - 1);
+        StatsPtr->TaskName[sizeof(StatsPtr->TaskName) - 1] = '\0';
+
+        PrevCpuTime = TaskRecPtr->LastCpuTime;
+        Status      = CFE_SUCCESS;
+    }
+    else
+    {
+        Status = CFE_ES_ERR_RESOURCEID_NOT_VALID;
+    }
+
+    CFE_ES_UnlockSharedData(__func__, __LINE__);
+
+    if (Status == CFE_SUCCESS)
+    {
+        /* on failure OS_TaskGetInfo leaves the properties zeroed, so all stats read as zero */
+        OS_TaskGetInfo(CFE_ES_TaskId_ToOSAL(TaskId), &TaskProp);
+
+        StatsPtr->CpuTimeMsec            = (uint32)OS_TimeGetTotalMilliseconds(TaskProp.cpu_time);
+        StatsPtr->VoluntaryCtxSwitches   = TaskProp.voluntary_switches;
+        StatsPtr->InvoluntaryCtxSwitches = TaskProp.involuntary_switches;
+        StatsPtr->RunSlices              = TaskProp.run_slices;
+        StatsPtr->MaxRunSliceUsec        = (uint32)OS_TimeGetTotalMicroseconds(TaskProp.max_run_slice);
+
+        IntervalUsec = OS_TimeGetTotalMicroseconds(Interval);
+        CpuUsec      = OS_TimeGetTotalMicroseconds(OS_TimeSubtract(TaskProp.cpu_time, PrevCpuTime));
+        if (IntervalUsec > 0 && CpuUsec > 0)
+        {
+            StatsPtr->CpuLoad = (uint32)((CpuUsec * 10000) / IntervalUsec);
+        }
+
+        CFE_ES_LockSharedData(__func__, __LINE__);
+        if (CFE_ES_TaskRecordIsMatch(TaskRecPtr, TaskId))
+        {
+            TaskRecPtr->LastCpuTime = TaskProp.cpu_time;
+        }
+        CFE_ES_UnlockSharedData(__func__, __LINE__);
+    }
+
+    return Status;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_TaskPoolJobEntry(void *Arg)
+{
+    CFE_ES_TaskPoolJobRecord_t *JobRecPtr = Arg;
+    CFE_ES_AppRecord_t *        AppRecPtr;
+
+    /* The record belongs to this job until it is freed below, so it is read without the lock */
+    JobRecPtr->JobFunc(JobRecPtr->JobArg);
+
+    AppRecPtr = CFE_ES_LocateAppRecordByID(JobRecPtr->AppId);
+
+    CFE_ES_LockSharedData(__func__, __LINE__);
+
+    if (CFE_ES_AppRecordIsMatch(AppRecPtr, JobRecPtr->AppId) && AppRecPtr->TaskPoolJobsPending > 0)
+    {
+        --AppRecPtr->TaskPoolJobsPending;
+        ++AppRecPtr->TaskPoolJobsCompleted;
+    }
+
+    JobRecPtr->AppId = CFE_ES_APPID_UNDEFINED;
+
+    CFE_ES_UnlockSharedData(__func__, __LINE__);
+}
+
@@ -43,7 +43,16 @@
 /*
 ** Macro Definitions
 */
-#define CFE_ES_STARTSCRIPT_MAX_TOKENS_PER_LINE 8
+#define CFE_ES_STARTSCRIPT_AFFINITY_TOKEN      8 /* Optional trailing CPU affinity mask field */
+#define CFE_ES_STARTSCRIPT_MAX_TOKENS_PER_LINE (CFE_ES_STARTSCRIPT_AFFINITY_TOKEN + 1)
+#define CFE_ES_STARTSCRIPT_MAX_LINE_LENGTH     128
+
+/*
+ * How long the cleanup of an app waits for its background or task pool jobs
+ * that are still running, in milliseconds.  After that the app is cleaned up
+ * anyway, but its module is left loaded as a job may still be executing it.
+ */
+#define CFE_ES_APP_JOB_DRAIN_TIMEOUT 1000
 
 /*
 ** Type Definitions
@@ -58,6 +67,7 @@ typedef struct
 {
     uint32 AppControlRequest; /* What the App should be doing next */
     int32  AppTimerMsec;      /* Countdown timer for killing an app, in milliseconds */
+    uint32 JobWaitMsec;       /* Time waited for task pool jobs after the timer expired */
 } CFE_ES_ControlReq_t;
 
 /*
@@ -100,6 +110,7 @@ typedef struct
 {
     size_t                     StackSize;
     CFE_ES_TaskPriority_Atom_t Priority;
+    uint32                     CpuAffinity; /* Mask of CPUs the task may run on, 0 for any */
 } CFE_ES_TaskStartParams_t;
 
 /*
@@ -134,6 +145,10 @@ typedef struct
     CFE_ES_ModuleLoadStatus_t LoadStatus;               /* Runtime module information */
     CFE_ES_ControlReq_t       ControlReq;               /* The Control Request Record for External cFE Apps */
     CFE_ES_TaskId_t           MainTaskId;               /* The Application's Main Task ID */
+    OS_time_t                 CreateTime;               /* PSP time when the app was created */
+    uint32                    TimeToReadyMsec;          /* Time from creation until RUNNING, 0 if not yet */
+    uint32                    TaskPoolJobsPending;      /* Task pool jobs queued or running */
+    uint32                    TaskPoolJobsCompleted;    /* Task pool jobs that have returned */
 } CFE_ES_AppRecord_t;
 
 /*
@@ -148,8 +163,20 @@ typedef struct
     CFE_ES_TaskStartParams_t  StartParams;               /* The start parameters for the task */
     CFE_ES_TaskEntryFuncPtr_t EntryFunc;                 /* Task entry function */
     uint32                    ExecutionCounter;          /* The execution counter for the task */
+    OS_time_t                 LastCpuTime;               /* CPU time of the task at the previous stats sample */
 } CFE_ES_TaskRecord_t;
 
+/*
+** CFE_ES_TaskPoolJobRecord_t is an internal structure used to keep track of
+** a job submitted to the OSAL task pool, until it returns.
+*/
+typedef struct
+{
+    CFE_ES_AppId_t              AppId;   /* The submitting Application, or undefined if the entry is free */
+    CFE_ES_TaskPoolJobFuncPtr_t JobFunc; /* Job function */
+    void *                      JobArg;  /* Job argument */
+} CFE_ES_TaskPoolJobRecord_t;
+
 /*
 ** CFE_ES_LibRecord_t is an internal structure used to keep track of
 ** CFE Shared Libraries that are loaded in the system.
@@ -162,6 +189,16 @@ typedef struct
     CFE_ES_ModuleLoadStatus_t LoadStatus;               /* Runtime information about the module */
 } CFE_ES_LibRecord_t;
 
+/*
+** CFE_ES_StartupAppEntry_t is an application line of the startup script,
+** queued until every library in the script has been loaded.
+*/
+typedef struct
+{
+    char   Line[CFE_ES_STARTSCRIPT_MAX_LINE_LENGTH + 1]; /* Tokens stored back to back, each null terminated */
+    uint32 NumTokens;
+} CFE_ES_StartupAppEntry_t;
+
 /*
 ** CFE_ES_AppTableScanState_t is an internal structure used to keep state of
 ** the background app table scan/cleanup process
@@ -184,6 +221,35 @@ typedef struct
  */
 void CFE_ES_StartApplications(uint32 ResetType, const char *StartFilePath);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * Reads the startup script up to EOF or the '!' terminator.  Libraries are
+ * loaded as they are found, applications are queued for CFE_ES_RunStartupLoaders().
+ */
+void CFE_ES_ProcessStartupScript(osal_id_t AppFile);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * Creates the queued startup script applications using the given number of
+ * loader tasks, including the calling task, and waits for all of them to finish.
+ */
+void CFE_ES_RunStartupLoaders(uint32 NumLoaders);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * Entry point of the additional startup loader tasks.
+ */
+void CFE_ES_StartupLoaderTask(void);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * Changes the state of an application, records its time to ready when it
+ * first reaches RUNNING and wakes the startup sync.
+ *
+ * Must be called with the ES shared data lock held.
+ */
+void CFE_ES_AppSetState(CFE_ES_AppRecord_t *AppRecPtr, CFE_ES_AppState_Enum_t NewState);
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * This function parses the startup file line for an individual cFE application.
@@ -339,4 +405,35 @@ void CFE_ES_CopyModuleStatusInfo(const CFE_ES_ModuleLoadStatus_t *StatusPtr, CFE
  */
 void CFE_ES_CopyModuleAddressInfo(osal_id_t ModuleId, CFE_ES_AppInfo_t *AppInfoPtr);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * Get the scheduler statistics of a task from the OS.
+ *
+ * The outputs are set to zero if the OS does not provide them.  This queries
+ * OSAL, so it should not be called while the ES shared data lock is held.
+ */
+void CFE_ES_GetTaskSchedStats(CFE_ES_TaskId_t TaskId, uint32 *Migrations, uint32 *InvoluntaryCtxSwitches);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * Sample the execution statistics of a task from the OS.
+ *
+ * The CPU load is computed from the CPU time the task consumed since the
+ * previous sample, relative to the given interval, and the stored CPU time
+ * of the task is updated.  Statistics the OS does not provide are zero.
+ *
+ * This queries OSAL, so it should not be called while the ES shared data lock is held.
+ */
+int32 CFE_ES_SampleTaskStats(CFE_ES_TaskStats_t *StatsPtr, CFE_ES_TaskId_t TaskId, OS_time_t Interval);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * Entry point of all jobs submitted with CFE_ES_TaskPoolSubmit()
+ *
+ * Runs on an OSAL task pool worker.  Calls the job function held in the
+ * CFE_ES_TaskPoolJobRecord_t passed as the argument, then frees the record
+ * and updates the job counts of the submitting app.
+ */
+void CFE_ES_TaskPoolJobEntry(void *Arg);
+
 #endif /* CFE_ES_APPS_H */
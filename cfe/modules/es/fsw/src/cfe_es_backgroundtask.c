@@ -36,121 +36,421 @@
 #include "cfe_es_module_all.h"
 #include "cfe_fs_core_internal.h"
 
-#define CFE_ES_BACKGROUND_SEM_NAME         "ES_BG_SEM"
-#define CFE_ES_BACKGROUND_CHILD_NAME       "ES_BG_TASK"
-#define CFE_ES_BACKGROUND_CHILD_STACK_PTR  CFE_ES_TASK_STACK_ALLOCATE
-#define CFE_ES_BACKGROUND_CHILD_STACK_SIZE CFE_PLATFORM_ES_PERF_CHILD_STACK_SIZE
-#define CFE_ES_BACKGROUND_CHILD_PRIORITY   CFE_PLATFORM_ES_PERF_CHILD_PRIORITY
-#define CFE_ES_BACKGROUND_CHILD_FLAGS      0
-#define CFE_ES_BACKGROUND_MAX_IDLE_DELAY   30000 /* 30 seconds */
+#define CFE_ES_BACKGROUND_SEM_NAME            "ES_BG_SEM"
+#define CFE_ES_BACKGROUND_CHILD_NAME          "ES_BG_TASK"
+#define CFE_ES_BACKGROUND_WORKER_NAME         "ES_BG_WORKER"
+#define CFE_ES_BACKGROUND_CHILD_STACK_PTR     CFE_ES_TASK_STACK_ALLOCATE
+#define CFE_ES_BACKGROUND_CHILD_STACK_SIZE    CFE_PLATFORM_ES_PERF_CHILD_STACK_SIZE
+#define CFE_ES_BACKGROUND_CHILD_PRIORITY      CFE_PLATFORM_ES_PERF_CHILD_PRIORITY
+#define CFE_ES_BACKGROUND_CHILD_FLAGS         0
+#define CFE_ES_BACKGROUND_MAX_IDLE_DELAY      30000 /* 30 seconds */
+#define CFE_ES_BACKGROUND_SYSLOG_COMMIT_DELAY 10    /* msec, while syslog messages are staged */
+#define CFE_ES_BACKGROUND_CLEANUP_POLL_DELAY  10    /* msec, while a job of a deleted app is still running */
+#define CFE_ES_BACKGROUND_CLEANUP_POLL_COUNT  (CFE_ES_APP_JOB_DRAIN_TIMEOUT / CFE_ES_BACKGROUND_CLEANUP_POLL_DELAY)
+
+/*
+ * Priorities of the jobs registered by ES itself, lower values are called first.
+ * Application jobs may use any value, these leave room on either side.
+ */
+#define CFE_ES_BACKGROUND_SYSLOG_COMMIT_PRIORITY 10  /* writers fall back to the lock when the ring is full */
+#define CFE_ES_BACKGROUND_APP_SCAN_PRIORITY      20  /* app state transitions wait for the scan */
+#define CFE_ES_BACKGROUND_EXCEPTION_PRIORITY     30
+#define CFE_ES_BACKGROUND_FILE_DUMP_PRIORITY     100 /* bulk file writes */
 
 typedef struct
 {
-    bool (*RunFunc)(uint32 ElapsedTime, void *Arg);
-    void * JobArg;
-    uint32 ActivePeriod; /**< max wait/delay time between calls when job is active */
-    uint32 IdlePeriod;   /**< max wait/delay time between calls when job is idle */
+    const char *               JobName;
+    CFE_ES_BackgroundJobFunc_t RunFunc;
+    void *                     JobArg;
+    uint32                     ActivePeriod; /**< max wait/delay time between calls when job is active */
+    uint32                     IdlePeriod;   /**< max wait/delay time between calls when job is idle */
+    uint16                     Priority;     /**< lower values are called first when several jobs are due */
 } CFE_ES_BackgroundJobEntry_t;
 
 /*
- * List of "background jobs"
+ * List of "background jobs" that are registered by ES itself
  *
- * This is just a list of functions to periodically call from the context of the background task,
- * and can be added/extended as needed.
+ * Applications add their own with CFE_ES_RegisterBackgroundJob().
  *
  * Each Job function returns a boolean, and should return "true" if it is active, or "false" if it is idle.
  *
  * This uses "cooperative multitasking" -- the function should do some limited work, then return to the
  * background task.  It will be called again after a delay period to do more work.
+ *
+ * The system log and the app table scan are the most urgent, as both may delay other
+ * tasks if they fall behind.  Bulk file writes are the least urgent.
  */
 const CFE_ES_BackgroundJobEntry_t CFE_ES_BACKGROUND_JOB_TABLE[] = {
+    {/* Commit staged system log messages */
+     .JobName      = "ES_SYSLOG_COMMIT",
+     .RunFunc      = CFE_ES_RunSysLogCommit,
+     .JobArg       = &CFE_ES_Global.SysLogStage,
+     .ActivePeriod = CFE_ES_BACKGROUND_SYSLOG_COMMIT_DELAY,
+     .IdlePeriod   = CFE_PLATFORM_ES_APP_SCAN_RATE,
+     .Priority     = CFE_ES_BACKGROUND_SYSLOG_COMMIT_PRIORITY},
     {/* ES app table background scan */
+     .JobName      = "ES_APP_SCAN",
      .RunFunc      = CFE_ES_RunAppTableScan,
      .JobArg       = &CFE_ES_Global.BackgroundAppScanState,
      .ActivePeriod = CFE_PLATFORM_ES_APP_SCAN_RATE / 4,
-     .IdlePeriod   = CFE_PLATFORM_ES_APP_SCAN_RATE},
-    {/* Performance Log Data Dump to file */
-     .RunFunc      = CFE_ES_RunPerfLogDump,
-     .JobArg       = &CFE_ES_Global.BackgroundPerfDumpState,
-     .ActivePeriod = CFE_PLATFORM_ES_PERF_CHILD_MS_DELAY,
-     .IdlePeriod   = CFE_PLATFORM_ES_PERF_CHILD_MS_DELAY * 1000},
+     .IdlePeriod   = CFE_PLATFORM_ES_APP_SCAN_RATE,
+     .Priority     = CFE_ES_BACKGROUND_APP_SCAN_PRIORITY},
     {/* Check for exceptions stored in the PSP */
+     .JobName      = "ES_EXCEPTION_SCAN",
      .RunFunc      = CFE_ES_RunExceptionScan,
      .JobArg       = NULL,
      .ActivePeriod = CFE_PLATFORM_ES_APP_SCAN_RATE,
-     .IdlePeriod   = CFE_PLATFORM_ES_APP_SCAN_RATE},
+     .IdlePeriod   = CFE_PLATFORM_ES_APP_SCAN_RATE,
+     .Priority     = CFE_ES_BACKGROUND_EXCEPTION_PRIORITY},
+    {/* Performance Log Data Dump to file */
+     .JobName      = "ES_PERF_DUMP",
+     .RunFunc      = CFE_ES_RunPerfLogDump,
+     .JobArg       = &CFE_ES_Global.BackgroundPerfDumpState,
+     .ActivePeriod = CFE_PLATFORM_ES_PERF_CHILD_MS_DELAY,
+     .IdlePeriod   = CFE_PLATFORM_ES_PERF_CHILD_MS_DELAY * 1000,
+     .Priority     = CFE_ES_BACKGROUND_FILE_DUMP_PRIORITY},
     {/* Call FS to handle background file writes */
+     .JobName      = "FS_FILE_DUMP",
      .RunFunc      = CFE_FS_RunBackgroundFileDump,
      .JobArg       = NULL,
      .ActivePeriod = CFE_PLATFORM_ES_APP_SCAN_RATE,
-     .IdlePeriod   = CFE_PLATFORM_ES_APP_SCAN_RATE}};
+     .IdlePeriod   = CFE_PLATFORM_ES_APP_SCAN_RATE,
+     .Priority     = CFE_ES_BACKGROUND_FILE_DUMP_PRIORITY}};
 
-#define CFE_ES_BACKGROUND_NUM_JOBS (sizeof(CFE_ES_BACKGROUND_JOB_TABLE) / sizeof(CFE_ES_BACKGROUND_JOB_TABLE[0]))
+#define CFE_ES_BACKGROUND_NUM_JOBS            (sizeof(CFE_ES_BACKGROUND_JOB_TABLE) / sizeof(CFE_ES_BACKGROUND_JOB_TABLE[0]))
 
 /*----------------------------------------------------------------
  *
- * Application-scope internal function
- * See description in header file for argument/return detail
+ * Internal helper routine only, not part of API.
+ *
+ * Converts the time from Start to End into whole milliseconds, where
+ * negative differences are reported as zero.
  *
  *-----------------------------------------------------------------*/
-void CFE_ES_BackgroundTask(void)
+static uint32 CFE_ES_BackgroundTimeDiffMsec(OS_time_t End, OS_time_t Start)
 {
-    int32                              OsStatus;
-    uint32                             JobTotal;
-    uint32                             NumJobsRunning;
-    uint32                             NextDelay;
-    uint32                             ElapsedTime;
-    OS_time_t                          CurrTime;
-    OS_time_t                          LastTime;
-    const CFE_ES_BackgroundJobEntry_t *JobPtr;
+    int64 Msec;
 
-    memset(&LastTime, 0, sizeof(LastTime));
-    memset(&CurrTime, 0, sizeof(CurrTime));
+    Msec = OS_TimeGetTotalMilliseconds(OS_TimeSubtract(End, Start));
+    if (Msec < 0)
+    {
+        Msec = 0;
+    }
+    else if (Msec > UINT32_MAX)
+    {
+        Msec = UINT32_MAX;
+    }
 
-    CFE_PSP_GetTime(&LastTime);
+    return (uint32)Msec;
+}
 
-    while (true)
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Frees a job record, or marks it for deletion by the worker that is
+ * currently calling it.  Must be called while locked.
+ *
+ *-----------------------------------------------------------------*/
+static void CFE_ES_BackgroundJobRelease(CFE_ES_BackgroundJobRecord_t *JobRecPtr)
+{
+    if (JobRecPtr->IsRunning)
     {
-        /*
-         * compute the elapsed time (difference) between last
-         * execution and now, in milliseconds.
-         */
-        CFE_PSP_GetTime(&CurrTime);
-        ElapsedTime = OS_TimeGetTotalMilliseconds(OS_TimeSubtract(CurrTime, LastTime));
-        LastTime    = CurrTime;
-
-        NextDelay      = CFE_ES_BACKGROUND_MAX_IDLE_DELAY; /* default; will be adjusted based on active jobs */
-        JobPtr         = CFE_ES_BACKGROUND_JOB_TABLE;
-        JobTotal       = CFE_ES_BACKGROUND_NUM_JOBS;
-        NumJobsRunning = 0;
-
-        while (JobTotal > 0)
-        {
-            /*
-             * call the background job -
-             * if it returns "true" that means it is active,
-             * if it returns "false" that means it is idle
-             */
-            if (JobPtr->RunFunc != NULL && JobPtr->RunFunc(ElapsedTime, JobPtr->JobArg))
+        JobRecPtr->DeletePending = true;
+        return;
+    }
+
+    if (JobRecPtr->IsActive)
+    {
+        --CFE_ES_Global.BackgroundTask.NumJobsRunning;
+    }
+
+    CFE_ResourceId_MapRelease(CFE_RESOURCEID_UNWRAP(CFE_ES_BackgroundJobRecordGetID(JobRecPtr)),
+                              CFE_PLATFORM_ES_MAX_BACKGROUND_JOBS, CFE_ES_Global.BackgroundJobIdMap);
+    CFE_ES_BackgroundJobRecordSetFree(JobRecPtr);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Adds a job to the table on behalf of the given application.
+ *
+ *-----------------------------------------------------------------*/
+static int32 CFE_ES_BackgroundJobCreate(CFE_ES_BackgroundJobId_t *JobIdPtr, CFE_ES_AppId_t AppId,
+                                        const CFE_ES_BackgroundJobEntry_t *EntryPtr)
+{
+    CFE_ES_BackgroundJobRecord_t *JobRecPtr;
+    CFE_ResourceId_t              PendingResourceId;
+    int32                         Status;
+
+    CFE_ES_LockSharedData(__func__, __LINE__);
+
+    /*
+     * Check for an existing entry with the same name.
+     */
+    JobRecPtr = CFE_ES_LocateBackgroundJobRecordByName(EntryPtr->JobName);
+    if (JobRecPtr != NULL)
+    {
+        CFE_ES_SysLogWrite_Unsync("%s: Duplicate Background Job name '%s'\n", __func__, EntryPtr->JobName);
+        Status            = CFE_ES_ERR_DUPLICATE_NAME;
+        PendingResourceId = CFE_RESOURCEID_UNDEFINED;
+    }
+    else
+    {
+        /* scan for a free slot */
+        PendingResourceId =
+            CFE_ResourceId_FindNextFree(CFE_ES_Global.LastBackgroundJobId, CFE_PLATFORM_ES_MAX_BACKGROUND_JOBS,
+                                        CFE_ES_Global.BackgroundJobIdMap, CFE_ES_CheckBackgroundJobIdSlotUsed);
+        JobRecPtr = CFE_ES_LocateBackgroundJobRecordByID(CFE_ES_BGJOBID_C(PendingResourceId));
+
+        if (JobRecPtr == NULL)
+        {
+            CFE_ES_SysLogWrite_Unsync("%s: No free Background Job slots available\n", __func__);
+            Status = CFE_ES_NO_RESOURCE_IDS_AVAILABLE;
+        }
+        else
+        {
+            memset(JobRecPtr, 0, sizeof(*JobRecPtr));
+            strncpy(JobRecPtr->JobName, EntryPtr->JobName, sizeof(JobRecPtr->JobName) - 1);
+            JobRecPtr->AppId         = AppId;
+            JobRecPtr->RunFunc       = EntryPtr->RunFunc;
+            JobRecPtr->JobArg        = EntryPtr->JobArg;
+            JobRecPtr->ActivePeriod  = EntryPtr->ActivePeriod;
+            JobRecPtr->IdlePeriod    = EntryPtr->IdlePeriod;
+            JobRecPtr->CurrentPeriod = EntryPtr->IdlePeriod;
+            JobRecPtr->Priority      = EntryPtr->Priority;
+
+            /* Due right away */
+            CFE_PSP_GetTime(&JobRecPtr->NextRunTime);
+            JobRecPtr->LastRunTime = JobRecPtr->NextRunTime;
+
+            CFE_ES_BackgroundJobRecordSetUsed(JobRecPtr, PendingResourceId);
+            CFE_ES_Global.LastBackgroundJobId = PendingResourceId;
+            Status                            = CFE_SUCCESS;
+        }
+    }
+
+    CFE_ES_UnlockSharedData(__func__, __LINE__);
+
+    if (Status == CFE_SUCCESS)
+    {
+        /* A worker may be sleeping until a much later job is due */
+        OS_BinSemGive(CFE_ES_Global.BackgroundTask.WorkSem);
+    }
+
+    *JobIdPtr = CFE_ES_BGJOBID_C(PendingResourceId);
+    return Status;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Selects the most urgent job that is due and calls it.  The job with
+ * the lowest priority value goes first, ties are broken by the earliest
+ * due time.  Jobs that are being called by another worker are skipped.
+ *
+ * Returns 0 if a job was called, or otherwise the time in milliseconds
+ * until the next job is due.
+ *
+ *-----------------------------------------------------------------*/
+static uint32 CFE_ES_BackgroundRunNextJob(void)
+{
+    CFE_ES_BackgroundJobRecord_t *JobRecPtr;
+    CFE_ES_BackgroundJobRecord_t *SelectedPtr;
+    CFE_ES_BackgroundJobFunc_t    RunFunc;
+    void *                        JobArg;
+    OS_time_t                     StartTime;
+    OS_time_t                     EndTime;
+    int64                         DueMsec;
+    uint32                        ElapsedTime;
+    uint32                        StartDelay;
+    uint32                        RunTimeUsec;
+    uint32                        NextDelay;
+    uint32                        NumDue;
+    uint32                        i;
+    bool                          IsActive;
+
+    SelectedPtr = NULL;
+    RunFunc     = NULL;
+    JobArg      = NULL;
+    ElapsedTime = 0;
+    StartDelay  = 0;
+    NumDue      = 0;
+    NextDelay   = CFE_ES_BACKGROUND_MAX_IDLE_DELAY;
+
+    CFE_ES_LockSharedData(__func__, __LINE__);
+
+    CFE_PSP_GetTime(&StartTime);
+
+    JobRecPtr = CFE_ES_Global.BackgroundJobTable;
+    for (i = 0; i < CFE_PLATFORM_ES_MAX_BACKGROUND_JOBS; ++i)
+    {
+        if (CFE_ES_BackgroundJobRecordIsUsed(JobRecPtr) && !JobRecPtr->IsRunning)
+        {
+            /* a wakeup request makes every job due now, like a new work item would */
+            if (CFE_ES_Global.BackgroundTask.WakeupPending)
             {
-                ++NumJobsRunning;
+                JobRecPtr->NextRunTime = StartTime;
+            }
 
-                if (JobPtr->ActivePeriod != 0 && NextDelay > JobPtr->ActivePeriod)
+            DueMsec = OS_TimeGetTotalMilliseconds(OS_TimeSubtract(JobRecPtr->NextRunTime, StartTime));
+            if (DueMsec > 0)
+            {
+                if (DueMsec < NextDelay)
                 {
-                    /* next delay is based on this active job wait time */
-                    NextDelay = JobPtr->ActivePeriod;
+                    NextDelay = (uint32)DueMsec;
                 }
             }
-            else if (JobPtr->IdlePeriod != 0 && NextDelay > JobPtr->IdlePeriod)
+            else
             {
-                /* next delay is based on this idle job wait time */
-                NextDelay = JobPtr->IdlePeriod;
+                ++NumDue;
+                if (SelectedPtr == NULL || JobRecPtr->Priority < SelectedPtr->Priority ||
+                    (JobRecPtr->Priority == SelectedPtr->Priority &&
+                     OS_TimeGetTotalMilliseconds(OS_TimeSubtract(JobRecPtr->NextRunTime, SelectedPtr->NextRunTime)) <
+                         0))
+                {
+                    SelectedPtr = JobRecPtr;
+                }
             }
-            --JobTotal;
-            ++JobPtr;
         }
 
-        CFE_ES_Global.BackgroundTask.NumJobsRunning = NumJobsRunning;
+        ++JobRecPtr;
+    }
+
+    CFE_ES_Global.BackgroundTask.WakeupPending = false;
+
+    if (SelectedPtr != NULL)
+    {
+        SelectedPtr->IsRunning = true;
+
+        RunFunc     = SelectedPtr->RunFunc;
+        JobArg      = SelectedPtr->JobArg;
+        ElapsedTime = CFE_ES_BackgroundTimeDiffMsec(StartTime, SelectedPtr->LastRunTime);
+        StartDelay  = CFE_ES_BackgroundTimeDiffMsec(StartTime, SelectedPtr->NextRunTime);
+
+        SelectedPtr->LastRunTime = StartTime;
+    }
+
+    CFE_ES_UnlockSharedData(__func__, __LINE__);
+
+    if (SelectedPtr == NULL)
+    {
+        return NextDelay;
+    }
+
+    /*
+     * If more jobs are due, pass the wakeup on so that an idle worker,
+     * if there is one, can start on them in parallel.
+     */
+    if (NumDue > 1 && CFE_ES_Global.BackgroundTask.NumWorkers > 0)
+    {
+        OS_BinSemGive(CFE_ES_Global.BackgroundTask.WorkSem);
+    }
+
+    /*
+     * call the background job -
+     * if it returns "true" that means it is active,
+     * if it returns "false" that means it is idle
+     */
+    IsActive = RunFunc(ElapsedTime, JobArg);
+
+    CFE_PSP_GetTime(&EndTime);
+    RunTimeUsec = OS_TimeGetTotalMicroseconds(OS_TimeSubtract(EndTime, StartTime));
+
+    CFE_ES_LockSharedData(__func__, __LINE__);
+
+    /* the record stays allocated while running, so it is still the same job */
+    SelectedPtr->IsRunning = false;
+
+    if (SelectedPtr->DeletePending)
+    {
+        IsActive = false;
+    }
+
+    if (IsActive != SelectedPtr->IsActive)
+    {
+        if (IsActive)
+        {
+            ++CFE_ES_Global.BackgroundTask.NumJobsRunning;
+        }
+        else
+        {
+            --CFE_ES_Global.BackgroundTask.NumJobsRunning;
+        }
+        SelectedPtr->IsActive = IsActive;
+    }
+
+    if (SelectedPtr->DeletePending)
+    {
+        CFE_ES_BackgroundJobRelease(SelectedPtr);
+    }
+    else
+    {
+        ++SelectedPtr->RunCount;
+        if (IsActive)
+        {
+            ++SelectedPtr->ActiveCount;
+        }
+
+        /* A job that started a full period late missed at least one of its due times */
+        if (StartDelay >= SelectedPtr->CurrentPeriod)
+        {
+            ++SelectedPtr->LateCount;
+        }
+        if (StartDelay > SelectedPtr->MaxStartDelayMsec)
+        {
+            SelectedPtr->MaxStartDelayMsec = StartDelay;
+        }
+
+        SelectedPtr->LastRunTimeUsec = RunTimeUsec;
+        if (RunTimeUsec > SelectedPtr->MaxRunTimeUsec)
+        {
+            SelectedPtr->MaxRunTimeUsec = RunTimeUsec;
+        }
+        SelectedPtr->RunTimeUsecResidue += RunTimeUsec % 1000;
+        SelectedPtr->TotalRunTimeMsec += (RunTimeUsec / 1000) + (SelectedPtr->RunTimeUsecResidue / 1000);
+        SelectedPtr->RunTimeUsecResidue %= 1000;
+
+        /* The next due time is relative to the start of this call, so the period does not drift */
+        if (IsActive)
+        {
+            SelectedPtr->CurrentPeriod = SelectedPtr->ActivePeriod;
+        }
+        else
+        {
+            SelectedPtr->CurrentPeriod = SelectedPtr->IdlePeriod;
+        }
+        SelectedPtr->NextRunTime = OS_TimeAdd(StartTime, OS_TimeFromTotalMilliseconds(SelectedPtr->CurrentPeriod));
+    }
+
+    CFE_ES_UnlockSharedData(__func__, __LINE__);
+
+    return 0;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Main loop of every background worker, calls jobs as they become
+ * due until the work semaphore fails.
+ *
+ *-----------------------------------------------------------------*/
+static void CFE_ES_BackgroundWorkerLoop(void)
+{
+    int32  OsStatus;
+    uint32 NextDelay;
+
+    while (true)
+    {
+        NextDelay = CFE_ES_BackgroundRunNextJob();
+        if (NextDelay == 0)
+        {
+            /* a job was called, check for the next one right away */
+            continue;
+        }
 
         OsStatus = OS_BinSemTimedWait(CFE_ES_Global.BackgroundTask.WorkSem, NextDelay);
         if (OsStatus != OS_SUCCESS && OsStatus != OS_SEM_TIMEOUT)
@@ -162,6 +462,31 @@ void CFE_ES_BackgroundTask(void)
     }
 }
 
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_BackgroundTask(void)
+{
+    CFE_ES_BackgroundWorkerLoop();
+
+    /* Nothing commits staged syslog messages after this */
+    CFE_ES_SysLogStageStop();
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_BackgroundWorkerTask(void)
+{
+    CFE_ES_BackgroundWorkerLoop();
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -170,8 +495,13 @@ void CFE_ES_BackgroundTask(void)
  *-----------------------------------------------------------------*/
 int32 CFE_ES_BackgroundInit(void)
 {
-    int32 status;
-    int32 OsStatus;
+    int32                              status;
+    int32                              OsStatus;
+    uint32                             i;
+    char                               WorkerName[OS_MAX_API_NAME];
+    CFE_ES_AppId_t                     AppId;
+    CFE_ES_BackgroundJobId_t           JobId;
+    const CFE_ES_BackgroundJobEntry_t *JobPtr;
 
     OsStatus = OS_BinSemCreate(&CFE_ES_Global.BackgroundTask.WorkSem, CFE_ES_BACKGROUND_SEM_NAME, 0, 0);
     if (OsStatus != OS_SUCCESS)
@@ -180,6 +510,25 @@ int32 CFE_ES_BackgroundInit(void)
         return CFE_STATUS_EXTERNAL_RESOURCE_FAIL;
     }
 
+    /* The built-in jobs belong to ES itself */
+    if (CFE_ES_GetAppID(&AppId) != CFE_SUCCESS)
+    {
+        AppId = CFE_ES_APPID_UNDEFINED;
+    }
+
+    JobPtr = CFE_ES_BACKGROUND_JOB_TABLE;
+    for (i = 0; i < CFE_ES_BACKGROUND_NUM_JOBS; ++i)
+    {
+        status = CFE_ES_BackgroundJobCreate(&JobId, AppId, JobPtr);
+        if (status != CFE_SUCCESS)
+        {
+            CFE_ES_WriteToSysLog("%s: Failed to register background job %s: %08lx\n", __func__, JobPtr->JobName,
+                                 (unsigned long)status);
+            return status;
+        }
+        ++JobPtr;
+    }
+
     /* Spawn a task to write the performance data to a file */
     status = CFE_ES_CreateChildTask(&CFE_ES_Global.BackgroundTask.TaskID, CFE_ES_BACKGROUND_CHILD_NAME,
                                     CFE_ES_BackgroundTask, CFE_ES_BACKGROUND_CHILD_STACK_PTR,
@@ -192,6 +541,28 @@ int32 CFE_ES_BackgroundInit(void)
         return status;
     }
 
+    /*
+     * Additional workers are optional, if one cannot be started the
+     * remaining jobs are just called by fewer tasks.
+     */
+    CFE_ES_Global.BackgroundTask.NumWorkers = 0;
+    for (i = 1; i < CFE_PLATFORM_ES_BACKGROUND_WORKER_TASKS; ++i)
+    {
+        snprintf(WorkerName, sizeof(WorkerName), "%s%lu", CFE_ES_BACKGROUND_WORKER_NAME, (unsigned long)i);
+        status = CFE_ES_CreateChildTask(
+            &CFE_ES_Global.BackgroundTask.WorkerTaskIDs[CFE_ES_Global.BackgroundTask.NumWorkers], WorkerName,
+            CFE_ES_BackgroundWorkerTask, CFE_ES_BACKGROUND_CHILD_STACK_PTR, CFE_ES_BACKGROUND_CHILD_STACK_SIZE,
+            CFE_ES_BACKGROUND_CHILD_PRIORITY, CFE_ES_BACKGROUND_CHILD_FLAGS);
+        if (status != CFE_SUCCESS)
+        {
+            CFE_ES_WriteToSysLog("%s: Failed to create background worker %s: %08lx\n", __func__, WorkerName,
+                                 (unsigned long)status);
+            break;
+        }
+
+        ++CFE_ES_Global.BackgroundTask.NumWorkers;
+    }
+
     return CFE_SUCCESS;
 }
 
@@ -203,8 +574,18 @@ int32 CFE_ES_BackgroundInit(void)
  *-----------------------------------------------------------------*/
 void CFE_ES_BackgroundCleanup(void)
 {
+    uint32 i;
+
+    for (i = 0; i < CFE_ES_Global.BackgroundTask.NumWorkers; ++i)
+    {
+        CFE_ES_DeleteChildTask(CFE_ES_Global.BackgroundTask.WorkerTaskIDs[i]);
+        CFE_ES_Global.BackgroundTask.WorkerTaskIDs[i] = CFE_ES_TASKID_UNDEFINED;
+    }
+    CFE_ES_Global.BackgroundTask.NumWorkers = 0;
+
     CFE_ES_DeleteChildTask(CFE_ES_Global.BackgroundTask.TaskID);
     OS_BinSemDelete(CFE_ES_Global.BackgroundTask.WorkSem);
+    CFE_ES_SysLogStageStop();
 
     CFE_ES_Global.BackgroundTask.TaskID  = CFE_ES_TASKID_UNDEFINED;
     CFE_ES_Global.BackgroundTask.WorkSem = OS_OBJECT_ID_UNDEFINED;
@@ -221,6 +602,193 @@ void CFE_ES_BackgroundWakeup(void)
     /* wake up the background task by giving the sem.
      * This is "informational" and not strictly required,
      * but it will make the task immediately wake up and check for new
-     * work if it was idle. */
+     * work if it was idle.  Every job is called on the next pass, since
+     * the caller does not say which job the new work is for. */
+    CFE_ES_Global.BackgroundTask.WakeupPending = true;
     OS_BinSemGive(CFE_ES_Global.BackgroundTask.WorkSem);
 }
+
+/*----------------------------------------------------------------
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_Status_t CFE_ES_RegisterBackgroundJob(CFE_ES_BackgroundJobId_t *JobIdPtr, const char *JobName,
+                                          CFE_ES_BackgroundJobFunc_t JobFunc, void *JobArg, uint32 ActivePeriod,
+                                          uint32 IdlePeriod, uint16 Priority)
+{
+    CFE_ES_BackgroundJobEntry_t Entry;
+    CFE_ES_AppId_t              AppId;
+    int32                       Status;
+
+    if (JobIdPtr == NULL || JobName == NULL || JobFunc == NULL)
+    {
+        return CFE_ES_BAD_ARGUMENT;
+    }
+
+    *JobIdPtr = CFE_ES_BGJOBID_UNDEFINED;
+
+    if (strlen(JobName) >= OS_MAX_API_NAME || ActivePeriod == 0 || IdlePeriod == 0)
+    {
+        return CFE_ES_BAD_ARGUMENT;
+    }
+
+    /* The job is deleted along with the calling app */
+    Status = CFE_ES_GetAppID(&AppId);
+    if (Status != CFE_SUCCESS)
+    {
+        return Status;
+    }
+
+    Entry.JobName      = JobName;
+    Entry.RunFunc      = JobFunc;
+    Entry.JobArg       = JobArg;
+    Entry.ActivePeriod = ActivePeriod;
+    Entry.IdlePeriod   = IdlePeriod;
+    Entry.Priority     = Priority;
+
+    return CFE_ES_BackgroundJobCreate(JobIdPtr, AppId, &Entry);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_Status_t CFE_ES_DeleteBackgroundJob(CFE_ES_BackgroundJobId_t JobId)
+{
+    CFE_ES_BackgroundJobRecord_t *JobRecPtr;
+    int32                         Status;
+
+    JobRecPtr = CFE_ES_LocateBackgroundJobRecordByID(JobId);
+
+    CFE_ES_LockSharedData(__func__, __LINE__);
+
+    if (CFE_ES_BackgroundJobRecordIsMatch(JobRecPtr, JobId) && !JobRecPtr->DeletePending)
+    {
+        CFE_ES_BackgroundJobRelease(JobRecPtr);
+        Status = CFE_SUCCESS;
+    }
+    else
+    {
+        Status = CFE_ES_ERR_RESOURCEID_NOT_VALID;
+    }
+
+    CFE_ES_UnlockSharedData(__func__, __LINE__);
+
+    return Status;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_Status_t CFE_ES_GetBackgroundJobInfo(CFE_ES_BackgroundJobInfo_t *JobInfo, CFE_ES_BackgroundJobId_t JobId)
+{
+    CFE_ES_BackgroundJobRecord_t *JobRecPtr;
+    int32                         Status;
+
+    if (JobInfo == NULL)
+    {
+        return CFE_ES_BAD_ARGUMENT;
+    }
+
+    memset(JobInfo, 0, sizeof(*JobInfo));
+
+    JobRecPtr = CFE_ES_LocateBackgroundJobRecordByID(JobId);
+
+    CFE_ES_LockSharedData(__func__, __LINE__);
+
+    if (CFE_ES_BackgroundJobRecordIsMatch(JobRecPtr, JobId) && !JobRecPtr->DeletePending)
+    {
+        JobInfo->JobId = JobId;
+        JobInfo->AppId = JobRecPtr->AppId;
+        strncpy(JobInfo->JobName, CFE_ES_BackgroundJobRecordGetName(JobRecPtr), sizeof(JobInfo->JobName) - 1);
+        JobInfo->Priority          = JobRecPtr->Priority;
+        JobInfo->IsRunning         = JobRecPtr->IsRunning;
+        JobInfo->IsActive          = JobRecPtr->IsActive;
+        JobInfo->ActivePeriod      = JobRecPtr->ActivePeriod;
+        JobInfo->IdlePeriod        = JobRecPtr->IdlePeriod;
+        JobInfo->RunCount          = JobRecPtr->RunCount;
+        JobInfo->ActiveCount       = JobRecPtr->ActiveCount;
+        JobInfo->LateCount         = JobRecPtr->LateCount;
+        JobInfo->MaxStartDelayMsec = JobRecPtr->MaxStartDelayMsec;
+        JobInfo->LastRunTimeUsec   = JobRecPtr->LastRunTimeUsec;
+        JobInfo->MaxRunTimeUsec    = JobRecPtr->MaxRunTimeUsec;
+        JobInfo->TotalRunTimeMsec  = JobRecPtr->TotalRunTimeMsec;
+        Status                     = CFE_SUCCESS;
+    }
+    else
+    {
+        Status = CFE_ES_ERR_RESOURCEID_NOT_VALID;
+    }
+
+    CFE_ES_UnlockSharedData(__func__, __LINE__);
+
+    return Status;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_ES_BackgroundCleanUpApp(CFE_ES_AppId_t AppId)
+{
+    CFE_ES_BackgroundJobRecord_t *JobRecPtr;
+    uint32                        i;
+    uint32                        NumRunning;
+    uint32                        PollCount;
+
+    PollCount = 0;
+
+    while (true)
+    {
+        NumRunning = 0;
+
+        CFE_ES_LockSharedData(__func__, __LINE__);
+
+        JobRecPtr = CFE_ES_Global.BackgroundJobTable;
+        for (i = 0; i < CFE_PLATFORM_ES_MAX_BACKGROUND_JOBS; ++i)
+        {
+            if (CFE_ES_BackgroundJobRecordIsUsed(JobRecPtr) && CFE_RESOURCEID_TEST_EQUAL(JobRecPtr->AppId, AppId))
+            {
+                CFE_ES_BackgroundJobRelease(JobRecPtr);
+                if (JobRecPtr->IsRunning)
+                {
+                    ++NumRunning;
+                }
+            }
+
+            ++JobRecPtr;
+        }
+
+        CFE_ES_UnlockSharedData(__func__, __LINE__);
+
+        /*
+         * The app code may be unloaded after this returns, so give a job that
+         * is being called right now a chance to return first.
+         */
+        if (NumRunning == 0 || PollCount >= CFE_ES_BACKGROUND_CLEANUP_POLL_COUNT)
+        {
+            break;
+        }
+
+        OS_TaskDelay(CFE_ES_BACKGROUND_CLEANUP_POLL_DELAY);
+        ++PollCount;
+    }
+
+    if (NumRunning != 0)
+    {
+        CFE_ES_WriteToSysLog("%s: %lu background job(s) of AppID %lu still running\n", __func__,
+                             (unsigned long)NumRunning, CFE_RESOURCEID_TO_ULONG(AppId));
+        return CFE_ES_APP_CLEANUP_ERR;
+    }
+
+    return CFE_SUCCESS;
+}
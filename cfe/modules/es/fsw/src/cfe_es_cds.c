@@ -153,8 +153,7 @@ int32 CFE_ES_CDS_EarlyInit(void)
  *-----------------------------------------------------------------*/
 int32 CFE_ES_CDSHandle_ToIndex(CFE_ES_CDSHandle_t BlockID, uint32 *Idx)
 {
-    return CFE_ResourceId_ToIndex(CFE_RESOURCEID_UNWRAP(BlockID), CFE_ES_CDSBLOCKID_BASE,
-                                  CFE_PLATFORM_ES_CDS_MAX_NUM_ENTRIES, Idx);
+    return CFE_ES_CDSBlockRecordIdToIndex(BlockID, Idx);
 }
 
 /*----------------------------------------------------------------
@@ -187,7 +186,7 @@ CFE_ES_CDS_RegRec_t *CFE_ES_LocateCDSBlockRecordByID(CFE_ES_CDSHandle_t BlockID)
     CFE_ES_CDS_RegRec_t *  CDSRegRecPtr;
     uint32                 Idx;
 
-    if (CFE_ES_CDSHandle_ToIndex(BlockID, &Idx) == CFE_SUCCESS)
+    if (CFE_ES_CDSBlockRecordIdToIndex(BlockID, &Idx) == CFE_SUCCESS)
     {
         CDSRegRecPtr = &CDS->Registry[Idx];
     }
@@ -344,8 +343,8 @@ int32 CFE_ES_RegisterCDSEx(CFE_ES_CDSHandle_t *HandlePtr, size_t UserBlockSize,
     else
     {
         /* scan for a free slot */
-        PendingBlockId = CFE_ResourceId_FindNext(CDS->LastCDSBlockId, CFE_PLATFORM_ES_CDS_MAX_NUM_ENTRIES,
-                                                 CFE_ES_CheckCDSHandleSlotUsed);
+        PendingBlockId = CFE_ResourceId_FindNextFree(CDS->LastCDSBlockId, CFE_PLATFORM_ES_CDS_MAX_NUM_ENTRIES,
+                                                     CDS->RegistryMap, CFE_ES_CheckCDSHandleSlotUsed);
         RegRecPtr      = CFE_ES_LocateCDSBlockRecordByID(CFE_ES_CDSHANDLE_C(PendingBlockId));
 
         if (RegRecPtr != NULL)
@@ -410,6 +409,11 @@ int32 CFE_ES_RegisterCDSEx(CFE_ES_CDSHandle_t *HandlePtr, size_t UserBlockSize,
             RegRecPtr->Name[sizeof(RegRecPtr->Name) - 1] = 0;
             CFE_ES_CDSBlockRecordSetUsed(RegRecPtr, PendingBlockId);
         }
+        else if (IsNewEntry)
+        {
+            /* The new entry was never set used, return its slot */
+            CFE_ResourceId_MapRelease(PendingBlockId, CFE_PLATFORM_ES_CDS_MAX_NUM_ENTRIES, CDS->RegistryMap);
+        }
 
         if (Status == CFE_SUCCESS && IsNewOffset)
         {
@@ -608,6 +612,7 @@ int32 CFE_ES_InitCDSRegistry(void)
     if (Status == CFE_SUCCESS)
     {
         memset(CDS->Registry, 0, sizeof(CDS->Registry));
+        memset(CDS->RegistryMap, 0, sizeof(CDS->RegistryMap));
 
         Status = CFE_ES_UpdateCDSRegistry();
     }
@@ -871,6 +876,8 @@ int32 CFE_ES_DeleteCDS(const char *CDSName, bool CalledByTblServices)
                 else
                 {
                     /* Remove entry from the CDS Registry */
+                    CFE_ResourceId_MapRelease(CFE_RESOURCEID_UNWRAP(CFE_ES_CDSBlockRecordGetID(RegRecPtr)),
+                                              CFE_PLATFORM_ES_CDS_MAX_NUM_ENTRIES, CDS->RegistryMap);
                     CFE_ES_CDSBlockRecordSetFree(RegRecPtr);
 
                     Status = CFE_ES_UpdateCDSRegistry();
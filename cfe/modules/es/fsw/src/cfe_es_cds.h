@@ -39,6 +39,7 @@
 */
 #include "common_types.h"
 #include "cfe_es_generic_pool.h"
+#include "cfe_core_resourceid_basevalues.h"
 
 /*
 ** Macro Definitions
@@ -163,6 +164,7 @@ typedef struct
     size_t              DataSize;       /**< \brief Size of actual user data pool */
     CFE_ResourceId_t    LastCDSBlockId; /**< \brief Last issued CDS block ID */
     CFE_ES_CDS_RegRec_t Registry[CFE_PLATFORM_ES_CDS_MAX_NUM_ENTRIES]; /**< \brief CDS Registry (Local Copy) */
+    uint32 RegistryMap[CFE_RESOURCEID_MAP_WORDS(CFE_PLATFORM_ES_CDS_MAX_NUM_ENTRIES)]; /**< \brief Registry usage map */
 } CFE_ES_CDS_Instance_t;
 
 /*
@@ -294,6 +296,21 @@ int32 CFE_ES_CDSHandle_ToIndex(CFE_ES_CDSHandle_t BlockID, uint32 *Idx);
  */
 CFE_ES_CDS_RegRec_t *CFE_ES_LocateCDSBlockRecordByID(CFE_ES_CDSHandle_t BlockID);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Convert a CDS block ID to an index in its table
+ *
+ * Inline form of the conversion routine, for use within ES.
+ *
+ * @param[in]   BlockID  the ID to convert
+ * @param[out]  Idx     the table index
+ * @returns CFE_SUCCESS, or an error if the ID could never refer to a table entry
+ */
+static inline CFE_Status_t CFE_ES_CDSBlockRecordIdToIndex(CFE_ES_CDSHandle_t BlockID, uint32 *Idx)
+{
+    return CFE_RESOURCEID_TO_INDEX(BlockID, CFE_ES_CDSBLOCKID_BASE, CFE_PLATFORM_ES_CDS_MAX_NUM_ENTRIES, Idx);
+}
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * @brief Check if a Memory Pool record is in use or free/empty
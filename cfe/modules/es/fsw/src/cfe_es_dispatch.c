@@ -266,6 +266,20 @@ void CFE_ES_TaskPipe(const CFE_SB_Buffer_t *SBBufPtr)
                     }
                     break;
 
+                case CFE_ES_SEND_TASK_STATS_CC:
+                    if (CFE_ES_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_ES_SendTaskStatsCmd_t)))
+                    {
+                        CFE_ES_SendTaskStatsCmd((const CFE_ES_SendTaskStatsCmd_t *)SBBufPtr);
+                    }
+                    break;
+
+                case CFE_ES_WRITE_LOCK_PROFILE_CC:
+                    if (CFE_ES_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_ES_WriteLockProfileCmd_t)))
+                    {
+                        CFE_ES_WriteLockProfileCmd((const CFE_ES_WriteLockProfileCmd_t *)SBBufPtr);
+                    }
+                    break;
+
                 default:
                     CFE_EVS_SendEvent(CFE_ES_CC1_ERR_EID, CFE_EVS_EventType_ERROR,
                                       "Invalid ground command code: ID = 0x%X, CC = %d",
@@ -239,8 +239,10 @@ void CFE_ES_BackgroundERLogFileEventHandler(void *Meta, CFE_FS_FileWriteEvent_t
     switch (Event)
     {
         case CFE_FS_FileWriteEvent_COMPLETE:
-            CFE_EVS_SendEvent(CFE_ES_ERLOG2_EID, CFE_EVS_EventType_DEBUG, "%s written:Size=%lu",
-                              BgFilePtr->FileWrite.FileName, (unsigned long)Position);
+            CFE_EVS_SendEvent(CFE_ES_ERLOG2_EID, CFE_EVS_EventType_DEBUG, "%s written:Size=%lu,Writes=%lu,Time=%lums",
+                              BgFilePtr->FileWrite.FileName, (unsigned long)Position,
+                              (unsigned long)BgFilePtr->FileWrite.WriteCount,
+                              (unsigned long)BgFilePtr->FileWrite.ElapsedMsec);
             break;
 
         case CFE_FS_FileWriteEvent_HEADER_WRITE_ERROR:
@@ -410,6 +412,7 @@ bool CFE_ES_RunExceptionScan(uint32 ElapsedTime, void *Arg)
         else
         {
             /* normally this will not return */
+            CFE_ES_SysLogFlush();
             CFE_PSP_Restart(ResetType);
         }
     } while (ResetType == 0);
@@ -47,20 +47,48 @@
  *
  * Internal helper routine only, not part of API.
  *
- * Find the appropriate bucket given a requested block size
+ * Get the size class of a block size, i.e. the position of its highest set bit
  *
  *-----------------------------------------------------------------*/
-uint16 CFE_ES_GenPoolFindBucket(CFE_ES_GenPoolRecord_t *PoolRecPtr, size_t ReqSize)
+uint32 CFE_ES_GenPoolSizeClass(size_t Size)
 {
-    uint16 Index;
+    uint32 SizeClass;
+    uint32 Shift;
 
-    for (Index = 0; Index < PoolRecPtr->NumBuckets; ++Index)
+    SizeClass = 0;
+    Shift     = CFE_ES_GENERIC_POOL_NUM_SIZE_CLASSES / 2;
+    while (Shift > 0)
     {
-        if (ReqSize <= PoolRecPtr->Buckets[Index].BlockSize)
+        if ((Size >> Shift) != 0)
         {
-            /* it fits - stop here */
-            break;
+            Size >>= Shift;
+            SizeClass += Shift;
         }
+        Shift >>= 1;
+    }
+
+    return SizeClass;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+uint16 CFE_ES_GenPoolFindBucket(CFE_ES_GenPoolRecord_t *PoolRecPtr, size_t ReqSize)
+{
+    uint16 Index;
+
+    /*
+     * All buckets before the one given by the size class map are smaller than
+     * the power of two at or below the requested size, so the search can start
+     * there.  It ends within the same power of two range at the latest.
+     */
+    Index = PoolRecPtr->SizeClassMap[CFE_ES_GenPoolSizeClass(ReqSize)];
+    while (Index < PoolRecPtr->NumBuckets && ReqSize > PoolRecPtr->Buckets[Index].BlockSize)
+    {
+        ++Index;
     }
 
     /*
@@ -225,6 +253,308 @@ int32 CFE_ES_GenPoolCreatePoolBlock(CFE_ES_GenPoolRecord_t *PoolRecPtr, uint16 B
     return Status;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Obtain a pointer to the coalescing mode descriptor of a block
+ *
+ *-----------------------------------------------------------------*/
+CFE_ES_GenPoolArenaBD_t *CFE_ES_GenPoolArenaGetBD(CFE_ES_GenPoolRecord_t *PoolRecPtr, size_t BlockOffset)
+{
+    return (CFE_ES_GenPoolArenaBD_t *)(PoolRecPtr->ArenaBaseAddr + BlockOffset -
+                                       CFE_ES_GENERIC_POOL_ARENA_DESCRIPTOR_SIZE);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Get the offset of the block that physically follows the given extent,
+ * which must be aligned according to the AlignMask member.
+ *
+ *-----------------------------------------------------------------*/
+size_t CFE_ES_GenPoolArenaNextOffset(CFE_ES_GenPoolRecord_t *PoolRecPtr, size_t EndPosition)
+{
+    size_t BlockOffset;
+
+    BlockOffset = EndPosition + CFE_ES_GENERIC_POOL_ARENA_DESCRIPTOR_SIZE;
+    BlockOffset += PoolRecPtr->AlignMask;
+    BlockOffset &= ~PoolRecPtr->AlignMask;
+
+    return BlockOffset;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Get the free list for a block of the given size - this is the largest
+ * bucket that the block can hold, so that any block on list N is large
+ * enough for any request that maps to bucket N.
+ *
+ *-----------------------------------------------------------------*/
+uint16 CFE_ES_GenPoolArenaFreeListIndex(CFE_ES_GenPoolRecord_t *PoolRecPtr, size_t BlockSize)
+{
+    uint16 Index;
+
+    Index = PoolRecPtr->NumBuckets - CFE_ES_GenPoolFindBucket(PoolRecPtr, BlockSize);
+    if (Index >= PoolRecPtr->NumBuckets || PoolRecPtr->Buckets[Index].BlockSize > BlockSize)
+    {
+        /* blocks are never smaller than the first bucket, so this does not go below 0 */
+        --Index;
+    }
+
+    return Index;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Put a block on the free list corresponding to its size
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_GenPoolArenaInsertFree(CFE_ES_GenPoolRecord_t *PoolRecPtr, size_t BlockOffset,
+                                   CFE_ES_GenPoolArenaBD_t *BdPtr)
+{
+    uint16 Index;
+
+    Index = CFE_ES_GenPoolArenaFreeListIndex(PoolRecPtr, BdPtr->BlockSize);
+
+    BdPtr->Common.Allocated = CFE_ES_MEMORY_DEALLOCATED + (PoolRecPtr->NumBuckets - Index);
+    BdPtr->NextFreeOffset   = PoolRecPtr->FreeList[Index];
+    BdPtr->PrevFreeOffset   = 0;
+
+    if (BdPtr->NextFreeOffset != 0)
+    {
+        CFE_ES_GenPoolArenaGetBD(PoolRecPtr, BdPtr->NextFreeOffset)->PrevFreeOffset = BlockOffset;
+    }
+
+    PoolRecPtr->FreeList[Index] = BlockOffset;
+    PoolRecPtr->FreeListMask |= (uint32)1 << Index;
+    PoolRecPtr->FreeBytes += BdPtr->BlockSize;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Take a block off the free list it is on
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_GenPoolArenaRemoveFree(CFE_ES_GenPoolRecord_t *PoolRecPtr, size_t BlockOffset,
+                                   CFE_ES_GenPoolArenaBD_t *BdPtr)
+{
+    uint16 Index;
+
+    Index = CFE_ES_GenPoolArenaFreeListIndex(PoolRecPtr, BdPtr->BlockSize);
+
+    if (BdPtr->PrevFreeOffset != 0)
+    {
+        CFE_ES_GenPoolArenaGetBD(PoolRecPtr, BdPtr->PrevFreeOffset)->NextFreeOffset = BdPtr->NextFreeOffset;
+    }
+    else
+    {
+        PoolRecPtr->FreeList[Index] = BdPtr->NextFreeOffset;
+        if (PoolRecPtr->FreeList[Index] == 0)
+        {
+            PoolRecPtr->FreeListMask &= ~((uint32)1 << Index);
+        }
+    }
+
+    if (BdPtr->NextFreeOffset != 0)
+    {
+        CFE_ES_GenPoolArenaGetBD(PoolRecPtr, BdPtr->NextFreeOffset)->PrevFreeOffset = BdPtr->PrevFreeOffset;
+    }
+
+    BdPtr->NextFreeOffset = 0;
+    BdPtr->PrevFreeOffset = 0;
+    PoolRecPtr->FreeBytes -= BdPtr->BlockSize;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Check if the block described by the descriptor is on a free list
+ *
+ *-----------------------------------------------------------------*/
+bool CFE_ES_GenPoolArenaIsFree(CFE_ES_GenPoolRecord_t *PoolRecPtr, const CFE_ES_GenPoolArenaBD_t *BdPtr)
+{
+    return (BdPtr->Common.CheckBits == CFE_ES_CHECK_PATTERN &&
+            CFE_ES_GenPoolGetBucketState(PoolRecPtr, BdPtr->Common.Allocated - CFE_ES_MEMORY_DEALLOCATED) != NULL);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Get a block for the given bucket in coalescing mode, either from the
+ * free lists or from the unused area at the end of the pool
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_ES_GenPoolArenaGetBlock(CFE_ES_GenPoolRecord_t *PoolRecPtr, uint16 BucketId, size_t NewSize,
+                                  size_t *BlockOffsetPtr)
+{
+    CFE_ES_GenPoolBucket_t * BucketPtr;
+    CFE_ES_GenPoolArenaBD_t *BdPtr;
+    CFE_ES_GenPoolArenaBD_t *SplitPtr;
+    size_t                   BlockOffset;
+    size_t                   SplitOffset;
+    size_t                   EndPosition;
+    uint32                   FreeMask;
+    uint16                   Index;
+
+    Index     = PoolRecPtr->NumBuckets - BucketId;
+    BucketPtr = &PoolRecPtr->Buckets[Index];
+    FreeMask  = PoolRecPtr->FreeListMask >> Index;
+
+    if (FreeMask != 0)
+    {
+        /* take the first block from the smallest free list that can hold the request */
+        while ((FreeMask & 1) == 0)
+        {
+            FreeMask >>= 1;
+            ++Index;
+        }
+
+        BlockOffset = PoolRecPtr->FreeList[Index];
+        BdPtr       = CFE_ES_GenPoolArenaGetBD(PoolRecPtr, BlockOffset);
+        CFE_ES_GenPoolArenaRemoveFree(PoolRecPtr, BlockOffset, BdPtr);
+
+        /*
+         * Split off the remainder as a new free block, if it is
+         * large enough to hold at least the smallest bucket size.
+         */
+        EndPosition = BlockOffset + BdPtr->BlockSize;
+        SplitOffset = CFE_ES_GenPoolArenaNextOffset(PoolRecPtr, BlockOffset + BucketPtr->BlockSize);
+        if (EndPosition >= SplitOffset + PoolRecPtr->Buckets[0].BlockSize)
+        {
+            SplitPtr = CFE_ES_GenPoolArenaGetBD(PoolRecPtr, SplitOffset);
+
+            SplitPtr->Common.CheckBits  = CFE_ES_CHECK_PATTERN;
+            SplitPtr->Common.ActualSize = 0;
+            SplitPtr->Common.NextOffset = 0;
+            SplitPtr->BlockSize         = EndPosition - SplitOffset;
+            SplitPtr->PrevBlockOffset   = BlockOffset;
+
+            if (EndPosition < PoolRecPtr->TailPosition)
+            {
+                CFE_ES_GenPoolArenaGetBD(PoolRecPtr, CFE_ES_GenPoolArenaNextOffset(PoolRecPtr, EndPosition))
+                    ->PrevBlockOffset = SplitOffset;
+            }
+
+            BdPtr->BlockSize = SplitOffset - CFE_ES_GENERIC_POOL_ARENA_DESCRIPTOR_SIZE - BlockOffset;
+            CFE_ES_GenPoolArenaInsertFree(PoolRecPtr, SplitOffset, SplitPtr);
+        }
+    }
+    else
+    {
+        /* nothing suitable on the free lists - carve a new block from the tail */
+        BlockOffset = CFE_ES_GenPoolArenaNextOffset(PoolRecPtr, PoolRecPtr->TailPosition);
+        EndPosition = BlockOffset + BucketPtr->BlockSize;
+
+        if (EndPosition > PoolRecPtr->PoolMaxOffset)
+        {
+            /* can't fit in remaining mem */
+            return CFE_ES_ERR_MEM_BLOCK_SIZE;
+        }
+
+        BdPtr = CFE_ES_GenPoolArenaGetBD(PoolRecPtr, BlockOffset);
+
+        BdPtr->Common.CheckBits = CFE_ES_CHECK_PATTERN;
+        BdPtr->BlockSize        = BucketPtr->BlockSize;
+        BdPtr->PrevBlockOffset  = PoolRecPtr->LastBlockOffset;
+        BdPtr->NextFreeOffset   = 0;
+        BdPtr->PrevFreeOffset   = 0;
+
+        PoolRecPtr->LastBlockOffset = BlockOffset;
+        PoolRecPtr->TailPosition    = EndPosition;
+    }
+
+    BdPtr->Common.Allocated  = CFE_ES_MEMORY_ALLOCATED + BucketId; /* Flag memory block as allocated */
+    BdPtr->Common.ActualSize = NewSize;
+    BdPtr->Common.NextOffset = 0;
+
+    ++BucketPtr->AllocationCount;
+    ++PoolRecPtr->AllocationCount;
+
+    *BlockOffsetPtr = BlockOffset;
+
+    return CFE_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Release a (validated) block in coalescing mode, merging it with any
+ * free neighbors, or with the unused area at the end of the pool
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_GenPoolArenaPutBlock(CFE_ES_GenPoolRecord_t *PoolRecPtr, size_t BlockOffset)
+{
+    CFE_ES_GenPoolArenaBD_t *BdPtr;
+    CFE_ES_GenPoolArenaBD_t *NeighborPtr;
+    size_t                   NeighborOffset;
+    size_t                   EndPosition;
+
+    BdPtr       = CFE_ES_GenPoolArenaGetBD(PoolRecPtr, BlockOffset);
+    EndPosition = BlockOffset + BdPtr->BlockSize;
+
+    /* merge the following block into this one, if it is free */
+    if (EndPosition < PoolRecPtr->TailPosition)
+    {
+        NeighborOffset = CFE_ES_GenPoolArenaNextOffset(PoolRecPtr, EndPosition);
+        NeighborPtr    = CFE_ES_GenPoolArenaGetBD(PoolRecPtr, NeighborOffset);
+        if (CFE_ES_GenPoolArenaIsFree(PoolRecPtr, NeighborPtr))
+        {
+            CFE_ES_GenPoolArenaRemoveFree(PoolRecPtr, NeighborOffset, NeighborPtr);
+            NeighborPtr->Common.CheckBits = 0;
+            EndPosition                   = NeighborOffset + NeighborPtr->BlockSize;
+        }
+    }
+
+    /* merge this block into the preceding one, if it is free */
+    if (BdPtr->PrevBlockOffset != 0)
+    {
+        NeighborOffset = BdPtr->PrevBlockOffset;
+        NeighborPtr    = CFE_ES_GenPoolArenaGetBD(PoolRecPtr, NeighborOffset);
+        if (CFE_ES_GenPoolArenaIsFree(PoolRecPtr, NeighborPtr))
+        {
+            CFE_ES_GenPoolArenaRemoveFree(PoolRecPtr, NeighborOffset, NeighborPtr);
+            BdPtr->Common.CheckBits = 0;
+            BlockOffset             = NeighborOffset;
+            BdPtr                   = NeighborPtr;
+        }
+    }
+
+    BdPtr->BlockSize = EndPosition - BlockOffset;
+
+    if (EndPosition >= PoolRecPtr->TailPosition)
+    {
+        /* this is now the last block, give the space back to the unused area */
+        BdPtr->Common.CheckBits     = 0;
+        PoolRecPtr->LastBlockOffset = BdPtr->PrevBlockOffset;
+        if (BdPtr->PrevBlockOffset != 0)
+        {
+            PoolRecPtr->TailPosition =
+                BdPtr->PrevBlockOffset + CFE_ES_GenPoolArenaGetBD(PoolRecPtr, BdPtr->PrevBlockOffset)->BlockSize;
+        }
+        else
+        {
+            PoolRecPtr->TailPosition = PoolRecPtr->PoolMaxOffset - PoolRecPtr->PoolTotalSize;
+        }
+    }
+    else
+    {
+        CFE_ES_GenPoolArenaGetBD(PoolRecPtr, CFE_ES_GenPoolArenaNextOffset(PoolRecPtr, EndPosition))
+            ->PrevBlockOffset = BlockOffset;
+        CFE_ES_GenPoolArenaInsertFree(PoolRecPtr, BlockOffset, BdPtr);
+    }
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -316,9 +646,32 @@ int32 CFE_ES_GenPoolInitialize(CFE_ES_GenPoolRecord_t *PoolRecPtr, size_t StartO
         return CFE_ES_ERR_MEM_BLOCK_SIZE;
     }
 
+    /* Build the map from size class to the first bucket that is at least that large */
+    j = 0;
+    for (i = 0; i < CFE_ES_GENERIC_POOL_NUM_SIZE_CLASSES; ++i)
+    {
+        while (j < NumBlockSizes && PoolRecPtr->Buckets[j].BlockSize < ((size_t)1 << i))
+        {
+            ++j;
+        }
+        PoolRecPtr->SizeClassMap[i] = j;
+    }
+
     return CFE_SUCCESS;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_GenPoolEnableCoalescing(CFE_ES_GenPoolRecord_t *PoolRecPtr, cpuaddr BaseAddr)
+{
+    PoolRecPtr->IsCoalescing  = true;
+    PoolRecPtr->ArenaBaseAddr = BaseAddr;
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -369,6 +722,11 @@ int32 CFE_ES_GenPoolGetBlock(CFE_ES_GenPoolRecord_t *PoolRecPtr, size_t *BlockOf
         return CFE_ES_ERR_MEM_BLOCK_SIZE;
     }
 
+    if (PoolRecPtr->IsCoalescing)
+    {
+        return CFE_ES_GenPoolArenaGetBlock(PoolRecPtr, BucketId, ReqSize, BlockOffsetPtr);
+    }
+
     /* first attempt to recycle any buffers from the same bucket that were freed */
     Status = CFE_ES_GenPoolRecyclePoolBlock(PoolRecPtr, BucketId, ReqSize, BlockOffsetPtr);
     if (Status != CFE_SUCCESS)
@@ -458,6 +816,12 @@ int32 CFE_ES_GenPoolPutBlock(CFE_ES_GenPoolRecord_t *PoolRecPtr, size_t *BlockSi
             ++PoolRecPtr->ValidationErrorCount;
             Status = CFE_ES_POOL_BLOCK_INVALID;
         }
+        else if (PoolRecPtr->IsCoalescing)
+        {
+            *BlockSizePtr = BdPtr->ActualSize;
+            CFE_ES_GenPoolArenaPutBlock(PoolRecPtr, BlockOffset);
+            ++BucketPtr->ReleaseCount;
+        }
         else
         {
             BdPtr->Allocated  = CFE_ES_MEMORY_DEALLOCATED + BucketId;
@@ -476,6 +840,194 @@ int32 CFE_ES_GenPoolPutBlock(CFE_ES_GenPoolRecord_t *PoolRecPtr, size_t *BlockSi
     return Status;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_ES_GenPoolCacheBlock(CFE_ES_GenPoolRecord_t *PoolRecPtr, uint16 *BucketIdPtr, size_t *BlockSizePtr,
+                               size_t BlockOffset)
+{
+    size_t                  DescOffset;
+    CFE_ES_GenPoolBucket_t *BucketPtr;
+    CFE_ES_GenPoolBD_t *    BdPtr;
+    int32                   Status;
+    uint16                  BucketId;
+
+    if (BlockOffset >= PoolRecPtr->TailPosition || BlockOffset < CFE_ES_GENERIC_POOL_DESCRIPTOR_SIZE)
+    {
+        /* outside the bounds of the pool */
+        return CFE_ES_BUFFER_NOT_IN_POOL;
+    }
+
+    DescOffset = BlockOffset - CFE_ES_GENERIC_POOL_DESCRIPTOR_SIZE;
+
+    Status = PoolRecPtr->Retrieve(PoolRecPtr, DescOffset, &BdPtr);
+    if (Status == CFE_SUCCESS)
+    {
+        BucketId  = BdPtr->Allocated - CFE_ES_MEMORY_ALLOCATED;
+        BucketPtr = CFE_ES_GenPoolGetBucketState(PoolRecPtr, BucketId);
+
+        if (BdPtr->CheckBits != CFE_ES_CHECK_PATTERN || BucketPtr == NULL || BdPtr->ActualSize == 0 ||
+            BucketPtr->BlockSize < BdPtr->ActualSize)
+        {
+            /* This does not appear to be a valid data buffer, left for the caller to report */
+            Status = CFE_ES_POOL_BLOCK_INVALID;
+        }
+        else
+        {
+            BdPtr->Allocated = CFE_ES_MEMORY_CACHED + BucketId;
+            *BucketIdPtr     = BucketId;
+            *BlockSizePtr    = BdPtr->ActualSize;
+
+            Status = PoolRecPtr->Commit(PoolRecPtr, DescOffset, BdPtr);
+        }
+    }
+
+    return Status;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_ES_GenPoolUncacheBlock(CFE_ES_GenPoolRecord_t *PoolRecPtr, uint16 BucketId, size_t ReqSize,
+                                 size_t BlockOffset)
+{
+    size_t                  DescOffset;
+    CFE_ES_GenPoolBucket_t *BucketPtr;
+    CFE_ES_GenPoolBD_t *    BdPtr;
+    int32                   Status;
+
+    if (BlockOffset >= PoolRecPtr->TailPosition || BlockOffset < CFE_ES_GENERIC_POOL_DESCRIPTOR_SIZE)
+    {
+        /* outside the bounds of the pool */
+        return CFE_ES_BUFFER_NOT_IN_POOL;
+    }
+
+    DescOffset = BlockOffset - CFE_ES_GENERIC_POOL_DESCRIPTOR_SIZE;
+
+    Status = PoolRecPtr->Retrieve(PoolRecPtr, DescOffset, &BdPtr);
+    if (Status == CFE_SUCCESS)
+    {
+        BucketPtr = CFE_ES_GenPoolGetBucketState(PoolRecPtr, BucketId);
+
+        if (BdPtr->CheckBits != CFE_ES_CHECK_PATTERN || BdPtr->Allocated != (uint16)(CFE_ES_MEMORY_CACHED + BucketId) ||
+            BucketPtr == NULL || BucketPtr->BlockSize < ReqSize)
+        {
+            /* sanity check failed - possible pool corruption? */
+            Status = CFE_ES_POOL_BLOCK_INVALID;
+        }
+        else
+        {
+            BdPtr->Allocated  = CFE_ES_MEMORY_ALLOCATED + BucketId;
+            BdPtr->ActualSize = ReqSize;
+
+            Status = PoolRecPtr->Commit(PoolRecPtr, DescOffset, BdPtr);
+        }
+    }
+
+    return Status;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+uint32 CFE_ES_GenPoolGetCachedBlocks(CFE_ES_GenPoolRecord_t *PoolRecPtr, uint16 BucketId, size_t *BlockOffsetList,
+                                     uint32 MaxBlocks)
+{
+    CFE_ES_GenPoolBucket_t *BucketPtr;
+    CFE_ES_GenPoolBD_t *    BdPtr;
+    size_t                  BlockOffset;
+    size_t                  DescOffset;
+    uint32                  NumBlocks;
+    int32                   Status;
+
+    BucketPtr = CFE_ES_GenPoolGetBucketState(PoolRecPtr, BucketId);
+    if (BucketPtr == NULL || PoolRecPtr->IsCoalescing)
+    {
+        /* free blocks of coalescing pools are not kept per bucket */
+        return 0;
+    }
+
+    NumBlocks = 0;
+    Status    = CFE_SUCCESS;
+    while (Status == CFE_SUCCESS && NumBlocks < MaxBlocks)
+    {
+        Status = CFE_ES_GenPoolRecyclePoolBlock(PoolRecPtr, BucketId, BucketPtr->BlockSize, &BlockOffset);
+        if (Status == CFE_SUCCESS)
+        {
+            DescOffset = BlockOffset - CFE_ES_GENERIC_POOL_DESCRIPTOR_SIZE;
+            Status     = PoolRecPtr->Retrieve(PoolRecPtr, DescOffset, &BdPtr);
+        }
+        if (Status == CFE_SUCCESS)
+        {
+            BdPtr->Allocated = CFE_ES_MEMORY_CACHED + BucketId;
+            Status           = PoolRecPtr->Commit(PoolRecPtr, DescOffset, BdPtr);
+        }
+        if (Status == CFE_SUCCESS)
+        {
+            BlockOffsetList[NumBlocks] = BlockOffset;
+            ++NumBlocks;
+        }
+    }
+
+    return NumBlocks;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_ES_GenPoolPutCachedBlocks(CFE_ES_GenPoolRecord_t *PoolRecPtr, uint16 BucketId,
+                                    const size_t *BlockOffsetList, uint32 NumBlocks)
+{
+    CFE_ES_GenPoolBucket_t *BucketPtr;
+    size_t                  BlockSize;
+    uint32                  i;
+    int32                   Result;
+    int32                   Status;
+
+    BucketPtr = CFE_ES_GenPoolGetBucketState(PoolRecPtr, BucketId);
+    if (BucketPtr == NULL)
+    {
+        return CFE_ES_BUFFER_NOT_IN_POOL;
+    }
+
+    Status = CFE_SUCCESS;
+    for (i = 0; i < NumBlocks; ++i)
+    {
+        /*
+         * Once marked as allocated again, the block can go through the normal put path,
+         * which takes care of the differences between bucket and coalescing mode.
+         */
+        Result = CFE_ES_GenPoolUncacheBlock(PoolRecPtr, BucketId, BucketPtr->BlockSize, BlockOffsetList[i]);
+        if (Result != CFE_SUCCESS)
+        {
+            ++PoolRecPtr->ValidationErrorCount;
+        }
+        else
+        {
+            Result = CFE_ES_GenPoolPutBlock(PoolRecPtr, &BlockSize, BlockOffsetList[i]);
+        }
+
+        if (Result != CFE_SUCCESS)
+        {
+            Status = Result;
+        }
+    }
+
+    return Status;
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -492,6 +1044,12 @@ int32 CFE_ES_GenPoolRebuild(CFE_ES_GenPoolRecord_t *PoolRecPtr)
     uint16                  BucketId;
     bool                    IsDeallocatedBlock;
 
+    if (PoolRecPtr->IsCoalescing)
+    {
+        /* coalescing pools are not kept in nonvolatile memory */
+        return CFE_ES_BAD_ARGUMENT;
+    }
+
     Status = CFE_SUCCESS;
 
     /* Scan the pool to find blocks that were created and freed */
@@ -533,6 +1091,16 @@ int32 CFE_ES_GenPoolRebuild(CFE_ES_GenPoolRecord_t *PoolRecPtr)
             /* Test if block is deallocated */
             BucketId  = BdPtr->Allocated - CFE_ES_MEMORY_DEALLOCATED;
             BucketPtr = CFE_ES_GenPoolGetBucketState(PoolRecPtr, BucketId);
+            if (BucketPtr == NULL)
+            {
+                /* Caches do not survive a restart, so blocks that were held in one are free now */
+                BucketId  = BdPtr->Allocated - CFE_ES_MEMORY_CACHED;
+                BucketPtr = CFE_ES_GenPoolGetBucketState(PoolRecPtr, BucketId);
+                if (BucketPtr != NULL)
+                {
+                    BdPtr->Allocated = CFE_ES_MEMORY_DEALLOCATED + BucketId;
+                }
+            }
             if (BucketPtr != 0)
             {
                 IsDeallocatedBlock = true;
@@ -613,7 +1181,8 @@ void CFE_ES_GenPoolGetUsage(CFE_ES_GenPoolRecord_t *PoolRecPtr, CFE_ES_MemOffset
     }
     if (FreeSizeBuf != NULL)
     {
-        *FreeSizeBuf = CFE_ES_MEMOFFSET_C(PoolRecPtr->PoolMaxOffset - PoolRecPtr->TailPosition);
+        *FreeSizeBuf =
+            CFE_ES_MEMOFFSET_C(PoolRecPtr->PoolMaxOffset - PoolRecPtr->TailPosition + PoolRecPtr->FreeBytes);
     }
 }
 
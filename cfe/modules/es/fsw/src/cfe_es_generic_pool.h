@@ -45,10 +45,19 @@
 #define CFE_ES_CHECK_PATTERN      ((uint16)0x5a5a)
 #define CFE_ES_MEMORY_ALLOCATED   ((uint16)0xaaaa)
 #define CFE_ES_MEMORY_DEALLOCATED ((uint16)0xdddd)
+#define CFE_ES_MEMORY_CACHED      ((uint16)0xcccc)
 
 #define CFE_ES_GENERIC_POOL_DESCRIPTOR_SIZE \
     sizeof(CFE_ES_GenPoolBD_t) /* amount of space to reserve with every allocation */
 
+#define CFE_ES_GENERIC_POOL_ARENA_DESCRIPTOR_SIZE \
+    sizeof(CFE_ES_GenPoolArenaBD_t) /* amount of space to reserve with every block in coalescing mode */
+
+/*
+ * Number of entries in the size class map, one for every power of two that fits in a size_t
+ */
+#define CFE_ES_GENERIC_POOL_NUM_SIZE_CLASSES (sizeof(size_t) * 8)
+
 /*
 ** Type Definitions
 */
@@ -61,6 +70,28 @@ typedef struct CFE_ES_GenPoolBD
     size_t NextOffset; /**< The offset of the next descriptor in the free stack */
 } CFE_ES_GenPoolBD_t;
 
+/*
+ * Block descriptor used in coalescing mode
+ *
+ * Blocks are carved from the pool with a size that may grow or shrink as
+ * neighbors are merged or split off, so each descriptor records its own size
+ * and the position of the physically preceding block.  Free blocks are kept
+ * on doubly linked lists so they can be taken off a list when a neighbor is
+ * merged into them.
+ *
+ * The common descriptor is the last member, so it sits immediately before the
+ * user block exactly as it does in the bucket mode, and validation of user
+ * supplied block offsets works the same way in both modes.
+ */
+typedef struct CFE_ES_GenPoolArenaBD
+{
+    size_t             BlockSize;       /**< Usable size of the block, up to the next descriptor */
+    size_t             PrevBlockOffset; /**< Offset of the physically preceding block, 0 if first */
+    size_t             NextFreeOffset;  /**< Offset of the next block on the same free list, 0 if last */
+    size_t             PrevFreeOffset;  /**< Offset of the previous block on the same free list, 0 if first */
+    CFE_ES_GenPoolBD_t Common;          /**< Common descriptor, immediately before the user block */
+} CFE_ES_GenPoolArenaBD_t;
+
 typedef struct CFE_ES_GenPoolBucket
 {
     size_t BlockSize;
@@ -114,6 +145,23 @@ struct CFE_ES_GenPoolRecord
 
     uint16                 NumBuckets; /**< Number of entries in the "Buckets" array that are valid */
     CFE_ES_GenPoolBucket_t Buckets[CFE_PLATFORM_ES_POOL_MAX_BUCKETS]; /**< Bucket States */
+
+    /**
+     * Index of the first bucket whose block size is at least 2^N, for each N.
+     * A request only needs to be compared against the buckets within its own
+     * power of two range, rather than the whole list.
+     */
+    uint8 SizeClassMap[CFE_ES_GENERIC_POOL_NUM_SIZE_CLASSES];
+
+    /*
+     * Coalescing mode state, unused in bucket mode
+     */
+    bool    IsCoalescing;    /**< Whether free blocks are split and merged rather than kept per bucket */
+    cpuaddr ArenaBaseAddr;   /**< Base address for direct access to the coalescing mode descriptors */
+    size_t  LastBlockOffset; /**< Offset of the block that ends at the tail position, 0 if none */
+    size_t  FreeBytes;       /**< Total usable size of all blocks on the free lists */
+    uint32  FreeListMask;    /**< Bit N is set if FreeList[N] is not empty */
+    size_t  FreeList[CFE_PLATFORM_ES_POOL_MAX_BUCKETS]; /**< Free blocks, by the largest bucket size they can hold */
 };
 
 /*****************************************************************************/
@@ -143,6 +191,44 @@ int32 CFE_ES_GenPoolInitialize(CFE_ES_GenPoolRecord_t *PoolRecPtr, size_t StartO
                                size_t AlignSize, uint16 NumBlockSizes, const size_t *BlockSizeList,
                                CFE_ES_PoolRetrieve_Func_t RetrieveFunc, CFE_ES_PoolCommit_Func_t CommitFunc);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Switch a newly initialized pool to coalescing mode
+ *
+ * In coalescing mode, requests are still rounded up to the configured block
+ * sizes, but blocks are not tied to a bucket once released.  A get request is
+ * served from the smallest free list that can hold it, splitting off any
+ * sufficiently large remainder, and a put request merges the block with any
+ * free physical neighbors.  This prevents a burst of large allocations from
+ * permanently fragmenting the pool.
+ *
+ * The bucket statistics are kept as follows in this mode: the allocation count
+ * is the total number of get requests and the release count is the total number
+ * of put requests for that block size, so their difference remains the number
+ * of blocks in use.
+ *
+ * Coalescing mode accesses the descriptors directly in memory, so it is only
+ * available for memory mapped pools.  It must be enabled after
+ * CFE_ES_GenPoolInitialize() and before any block is allocated, and
+ * CFE_ES_GenPoolRebuild() is not supported for such pools.
+ *
+ * \param[inout] PoolRecPtr     Pointer to pool structure
+ * \param[in]    BaseAddr       Memory address corresponding to offset 0 of the pool
+ */
+void CFE_ES_GenPoolEnableCoalescing(CFE_ES_GenPoolRecord_t *PoolRecPtr, cpuaddr BaseAddr);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Find the bucket for a given request size
+ *
+ * \param[in]   PoolRecPtr     Pointer to pool structure
+ * \param[in]   ReqSize        Size of block requested
+ *
+ * \return The ID of the smallest bucket that can hold the request, or 0 if the
+ * request is larger than every bucket.
+ */
+uint16 CFE_ES_GenPoolFindBucket(CFE_ES_GenPoolRecord_t *PoolRecPtr, size_t ReqSize);
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * \brief Gets a block from the pool
@@ -173,6 +259,85 @@ int32 CFE_ES_GenPoolGetBlock(CFE_ES_GenPoolRecord_t *PoolRecPtr, size_t *BlockOf
  */
 int32 CFE_ES_GenPoolPutBlock(CFE_ES_GenPoolRecord_t *PoolRecPtr, size_t *BlockSizePtr, size_t BlockOffset);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Mark an allocated block as held in a cache
+ *
+ * Validates a block in the same way as CFE_ES_GenPoolPutBlock(), but instead
+ * of returning it to the free list of its bucket, marks it as cached so that
+ * the caller can keep it aside and hand it out again with
+ * CFE_ES_GenPoolUncacheBlock().  A cached block is not valid for any other
+ * operation, so releasing it a second time is still detected.
+ *
+ * This only accesses the descriptor of the block itself, so the caller may
+ * skip the pool lock for a block it owns.  Validation failures are not
+ * counted; the caller should retry the operation through
+ * CFE_ES_GenPoolPutBlock() to get the error reported.
+ *
+ * \param[inout] PoolRecPtr     Pointer to pool structure
+ * \param[out]   BucketIdPtr    Location to output the bucket ID of the block
+ * \param[out]   BlockSizePtr   Location to output original allocation size
+ * \param[in]    BlockOffset    Offset of data block
+ *
+ * \return #CFE_SUCCESS, or error code \ref CFEReturnCodes
+ */
+int32 CFE_ES_GenPoolCacheBlock(CFE_ES_GenPoolRecord_t *PoolRecPtr, uint16 *BucketIdPtr, size_t *BlockSizePtr,
+                               size_t BlockOffset);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Hand out a cached block again
+ *
+ * Marks a block previously passed to CFE_ES_GenPoolCacheBlock() or obtained
+ * from CFE_ES_GenPoolGetCachedBlocks() as allocated again, with a new size.
+ * Like CFE_ES_GenPoolCacheBlock(), this only accesses the descriptor of the
+ * block itself.
+ *
+ * \param[inout] PoolRecPtr     Pointer to pool structure
+ * \param[in]    BucketId       Bucket ID the block was cached for
+ * \param[in]    ReqSize        Size of block requested, must fit in the bucket
+ * \param[in]    BlockOffset    Offset of data block
+ *
+ * \return #CFE_SUCCESS, or error code \ref CFEReturnCodes
+ */
+int32 CFE_ES_GenPoolUncacheBlock(CFE_ES_GenPoolRecord_t *PoolRecPtr, uint16 BucketId, size_t ReqSize,
+                                 size_t BlockOffset);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Move previously released blocks of a bucket into a cache
+ *
+ * Takes up to MaxBlocks blocks off the free list of the given bucket and marks
+ * them as cached.  Only blocks that have been released before are taken; this
+ * never grows the pool, and in coalescing mode it takes no blocks at all.
+ *
+ * \param[inout] PoolRecPtr      Pointer to pool structure
+ * \param[in]    BucketId        Bucket ID to take blocks from
+ * \param[out]   BlockOffsetList Location to output the offsets of the blocks
+ * \param[in]    MaxBlocks       Maximum number of blocks to take
+ *
+ * \return The number of blocks taken
+ */
+uint32 CFE_ES_GenPoolGetCachedBlocks(CFE_ES_GenPoolRecord_t *PoolRecPtr, uint16 BucketId, size_t *BlockOffsetList,
+                                     uint32 MaxBlocks);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Return cached blocks to the pool
+ *
+ * Releases blocks previously marked as cached for the given bucket, exactly as
+ * if they had been passed to CFE_ES_GenPoolPutBlock().
+ *
+ * \param[inout] PoolRecPtr      Pointer to pool structure
+ * \param[in]    BucketId        Bucket ID the blocks were cached for
+ * \param[in]    BlockOffsetList Offsets of the blocks
+ * \param[in]    NumBlocks       Number of blocks
+ *
+ * \return #CFE_SUCCESS, or the error code of the last block that could not be released
+ */
+int32 CFE_ES_GenPoolPutCachedBlocks(CFE_ES_GenPoolRecord_t *PoolRecPtr, uint16 BucketId,
+                                    const size_t *BlockOffsetList, uint32 NumBlocks);
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * \brief Rebuild list of free blocks in pool
@@ -187,6 +352,7 @@ int32 CFE_ES_GenPoolPutBlock(CFE_ES_GenPoolRecord_t *PoolRecPtr, size_t *BlockSi
  *
  * This function will then attempt to recreate the internal free lists
  * based on descriptors/signatures already existing in the memory area.
+ * Blocks that were held in a cache are treated as released.
  *
  * \param[inout] PoolRecPtr     Pointer to pool structure
  *
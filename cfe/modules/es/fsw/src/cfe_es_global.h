@@ -41,6 +41,7 @@
 #include "cfe_es_erlog_typedef.h"
 #include "cfe_es_resetdata_typedef.h"
 #include "cfe_es_cds.h"
+#include "cfe_es_log.h"
 
 #include <signal.h> /* for sig_atomic_t */
 
@@ -59,6 +60,36 @@ typedef struct
     char               CounterName[OS_MAX_API_NAME]; /* Counter Name */
 } CFE_ES_GenCounterRecord_t;
 
+/*
+** CFE_ES_BackgroundJobRecord_t is an internal structure used to keep track of
+** jobs registered with the background task scheduler.
+*/
+typedef struct
+{
+    CFE_ES_BackgroundJobId_t   JobId;         /**< The actual job ID of this entry, or undefined */
+    CFE_ES_AppId_t             AppId;         /**< Application that registered the job */
+    CFE_ES_BackgroundJobFunc_t RunFunc;       /**< Function called by the workers */
+    void *                     JobArg;        /**< Argument passed to RunFunc */
+    uint32                     ActivePeriod;  /**< Delay between calls when the job is active */
+    uint32                     IdlePeriod;    /**< Delay between calls when the job is idle */
+    uint32                     CurrentPeriod; /**< Period that computed NextRunTime */
+    uint16                     Priority;      /**< Lower values are more urgent */
+    bool                       IsRunning;     /**< Set while a worker is calling RunFunc */
+    bool                       IsActive;      /**< Result of the last call */
+    bool                       DeletePending; /**< Deleted while running, freed once the call returns */
+    OS_time_t                  NextRunTime;   /**< When the job is next due */
+    OS_time_t                  LastRunTime;   /**< When the last call started */
+    uint32                     RunCount;
+    uint32                     ActiveCount;
+    uint32                     LateCount;
+    uint32                     MaxStartDelayMsec;
+    uint32                     LastRunTimeUsec;
+    uint32                     MaxRunTimeUsec;
+    uint32                     TotalRunTimeMsec;
+    uint32                     RunTimeUsecResidue; /**< Sub-millisecond part of the total run time */
+    char                       JobName[OS_MAX_API_NAME];
+} CFE_ES_BackgroundJobRecord_t;
+
 /*
  * Encapsulates the state of the ES background task
  */
@@ -67,8 +98,28 @@ typedef struct
     CFE_ES_TaskId_t TaskID;         /**< ES ID of the background task */
     osal_id_t       WorkSem;        /**< Semaphore that is given whenever background work is pending */
     uint32          NumJobsRunning; /**< Current Number of active jobs (updated by background task) */
+    bool            WakeupPending;  /**< Set by CFE_ES_BackgroundWakeup(), makes every job due */
+    uint32          NumWorkers;     /**< Number of additional worker tasks that were started */
+
+    CFE_ES_TaskId_t WorkerTaskIDs[CFE_PLATFORM_ES_BACKGROUND_WORKER_TASKS]; /**< Additional worker tasks */
 } CFE_ES_BackgroundTaskState_t;
 
+/*
+ * Encapsulates the state of the startup sequence and its timeline
+ */
+typedef struct
+{
+    OS_time_t                   StartTime;     /**< PSP time when CFE_ES_Main was entered */
+    osal_id_t                   SyncSem;       /**< Given whenever an app changes state */
+    osal_id_t                   StateCondVar;  /**< Broadcast whenever the system or a task record changes */
+    osal_id_t                   LoaderSem;     /**< Given by each loader task when done */
+    uint32                      NumAppEntries; /**< Applications queued from the startup script */
+    uint32                      NextAppEntry;  /**< Next queued application to claim */
+    CFE_ES_StartupTlm_Payload_t Timeline;      /**< Startup timeline, reported in telemetry */
+
+    CFE_ES_StartupAppEntry_t AppEntries[CFE_PLATFORM_ES_MAX_APPLICATIONS];
+} CFE_ES_StartupState_t;
+
 /*
  * Background log dump state structure
  *
@@ -117,10 +168,26 @@ typedef struct
     */
     CFE_ES_MemStatsTlm_t MemStatsPacket;
 
+    /*
+    ** Task statistics telemetry
+    */
+    CFE_ES_TaskStatsTlm_t TaskStatsPacket;
+
+    /*
+    ** Performance marker statistics telemetry
+    */
+    CFE_ES_PerfStatsTlm_t PerfStatsPacket;
+
+    /*
+    ** Startup timeline telemetry
+    */
+    CFE_ES_StartupTlm_t StartupPacket;
+
     /*
     ** ES Task operational data (not reported in housekeeping)
     */
     CFE_SB_PipeId_t CmdPipe;
+    OS_time_t       TaskStatsSampleTime; /* Local time of the previous task statistics sample */
 } CFE_ES_TaskData_t;
 
 /*
@@ -149,6 +216,7 @@ typedef struct
     ** Startup Sync
     */
     volatile sig_atomic_t SystemState;
+    CFE_ES_StartupState_t StartupState;
 
     /*
     ** ES Task Table
@@ -163,6 +231,7 @@ typedef struct
     uint32             RegisteredExternalApps;
     CFE_ResourceId_t   LastAppId;
     CFE_ES_AppRecord_t AppTable[CFE_PLATFORM_ES_MAX_APPLICATIONS];
+    uint32             AppIdMap[CFE_RESOURCEID_MAP_WORDS(CFE_PLATFORM_ES_MAX_APPLICATIONS)];
 
     /*
     ** ES Shared Library Table
@@ -170,12 +239,14 @@ typedef struct
     uint32             RegisteredLibs;
     CFE_ResourceId_t   LastLibId;
     CFE_ES_LibRecord_t LibTable[CFE_PLATFORM_ES_MAX_LIBRARIES];
+    uint32             LibIdMap[CFE_RESOURCEID_MAP_WORDS(CFE_PLATFORM_ES_MAX_LIBRARIES)];
 
     /*
     ** ES Generic Counters Table
     */
     CFE_ResourceId_t          LastCounterId;
     CFE_ES_GenCounterRecord_t CounterTable[CFE_PLATFORM_ES_MAX_GEN_COUNTERS];
+    uint32                    CounterIdMap[CFE_RESOURCEID_MAP_WORDS(CFE_PLATFORM_ES_MAX_GEN_COUNTERS)];
 
     /*
     ** Critical Data Store Management Variables
@@ -189,11 +260,29 @@ typedef struct
      */
     CFE_ES_BackgroundTaskState_t BackgroundTask;
 
+    /*
+    ** ES Background Job Table
+    */
+    CFE_ResourceId_t             LastBackgroundJobId;
+    CFE_ES_BackgroundJobRecord_t BackgroundJobTable[CFE_PLATFORM_ES_MAX_BACKGROUND_JOBS];
+    uint32                       BackgroundJobIdMap[CFE_RESOURCEID_MAP_WORDS(CFE_PLATFORM_ES_MAX_BACKGROUND_JOBS)];
+
+    /*
+    ** ES Task Pool Job Table, one entry for each job queued or running on the OSAL task pool
+    */
+    CFE_ES_TaskPoolJobRecord_t TaskPoolJobTable[OS_MAX_TASK_POOL_JOBS];
+
+    /*
+     * Messages staged for the system log, committed by the background task
+     */
+    CFE_ES_SysLogStage_t SysLogStage;
+
     /*
     ** Memory Pools
     */
     CFE_ResourceId_t       LastMemPoolId;
     CFE_ES_MemPoolRecord_t MemPoolTable[CFE_PLATFORM_ES_MAX_MEMORY_POOLS];
+    uint32                 MemPoolIdMap[CFE_RESOURCEID_MAP_WORDS(CFE_PLATFORM_ES_MAX_MEMORY_POOLS)];
 
     /*
     ** ES Task initialization data (not reported in housekeeping)
@@ -205,6 +294,16 @@ typedef struct
      */
     CFE_ES_PerfDumpGlobal_t BackgroundPerfDumpState;
 
+    /*
+     * Performance marker statistics
+     */
+    CFE_ES_PerfStatsGlobal_t PerfStats;
+
+    /*
+     * Shared data lock profile
+     */
+    CFE_ES_LockProfileGlobal_t LockProfile;
+
     /*
      * Persistent state data associated with background app table scans
      */
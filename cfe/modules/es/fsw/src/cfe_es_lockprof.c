@@ -0,0 +1,423 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/*
+** File: cfe_es_lockprof.c
+**
+** Purpose: This file contains the functions that profile the acquisitions
+**  of the cFE core shared data locks.
+**
+*/
+
+/*
+** Include Section
+*/
+#include "cfe_es_module_all.h"
+
+#include <string.h>
+
+/*----------------------------------------------------------------
+ *
+ * Local helper function, not invoked outside this unit
+ * Reads the timebase as a single 64 bit tick count
+ *
+ *-----------------------------------------------------------------*/
+static uint64 CFE_ES_LockProfileGetTime(const CFE_ES_LockProfileGlobal_t *Prof)
+{
+    uint32 TimerUpper32;
+    uint32 TimerLower32;
+
+    CFE_PSP_Get_Timebase(&TimerUpper32, &TimerLower32);
+    if (Prof->TimerLow32Rollover == 0)
+    {
+        return ((uint64)TimerUpper32 << 32) | TimerLower32;
+    }
+
+    return ((uint64)TimerUpper32 * Prof->TimerLow32Rollover) + TimerLower32;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Local helper function, not invoked outside this unit
+ * Gets the table of the calling task, or NULL if it is not profiled.
+ * Clears the table first if it was used by a task that has since been
+ * deleted, or if a reset was requested since it was last cleared.
+ *
+ *-----------------------------------------------------------------*/
+static CFE_ES_LockProfileTask_t *CFE_ES_LockProfileGetTask(CFE_ES_LockProfileGlobal_t *Prof)
+{
+    CFE_ES_LockProfileTask_t *Task;
+    osal_id_t                 TaskId;
+    osal_index_t              TaskIndex;
+    uint32                    Generation;
+    uint32                    i;
+
+    if (!Prof->IsEnabled)
+    {
+        return NULL;
+    }
+
+    TaskId = OS_TaskGetId();
+    if (OS_ObjectIdToArrayIndex(OS_OBJECT_TYPE_OS_TASK, TaskId, &TaskIndex) != OS_SUCCESS ||
+        TaskIndex >= CFE_ES_LOCK_PROFILE_TASKS)
+    {
+        return NULL;
+    }
+
+    Task       = &Prof->Task[TaskIndex];
+    Generation = Prof->Generation;
+
+    if (!OS_ObjectIdEqual(Task->TaskId, TaskId))
+    {
+        memset(Task, 0, sizeof(*Task));
+        Task->TaskId     = TaskId;
+        Task->Generation = Generation;
+    }
+    else if (Task->Generation != Generation)
+    {
+        /* Locks held right now are still tracked, but their hold is no longer accounted */
+        memset(Task->Sites, 0, sizeof(Task->Sites));
+        for (i = 0; i < CFE_ES_LockProfileLock_MAX; ++i)
+        {
+            Task->Held[i].SiteIndex = CFE_ES_LOCK_PROFILE_NO_SITE;
+        }
+        Task->DroppedSites = 0;
+        Task->Generation   = Generation;
+    }
+
+    return Task;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Local helper function, not invoked outside this unit
+ * Finds (or allocates) the entry of a call site in the table of a task,
+ * returns CFE_ES_LOCK_PROFILE_NO_SITE if the table is full
+ *
+ *-----------------------------------------------------------------*/
+static uint32 CFE_ES_LockProfileFindSite(CFE_ES_LockProfileTask_t *Task, CFE_ES_LockProfileLock_Enum_t LockId,
+                                         const char *FunctionName, uint32 LineNumber)
+{
+    CFE_ES_LockProfileSite_t *Site;
+    uint32                    Hash;
+    uint32                    Probe;
+    uint32                    SiteIndex;
+
+    /* __func__ is a unique constant per function, so its address identifies it */
+    Hash = (uint32)((cpuaddr)FunctionName >> 2) ^ (LineNumber * 31) ^ LockId;
+
+    for (Probe = 0; Probe < CFE_PLATFORM_ES_LOCK_PROFILE_SITES; ++Probe)
+    {
+        SiteIndex = (Hash + Probe) & (CFE_PLATFORM_ES_LOCK_PROFILE_SITES - 1);
+        Site      = &Task->Sites[SiteIndex];
+
+        if (Site->FunctionName == NULL)
+        {
+            Site->LockId       = LockId;
+            Site->LineNumber   = LineNumber;
+            Site->FunctionName = FunctionName;
+            return SiteIndex;
+        }
+
+        if (Site->FunctionName == FunctionName && Site->LineNumber == LineNumber && Site->LockId == LockId)
+        {
+            return SiteIndex;
+        }
+    }
+
+    return CFE_ES_LOCK_PROFILE_NO_SITE;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Local helper function, not invoked outside this unit
+ * Writes a block to the file, converting a short write into an error
+ *
+ *-----------------------------------------------------------------*/
+static int32 CFE_ES_LockProfileWriteBlock(osal_id_t FileDescriptor, const void *Data, size_t Size)
+{
+    int32 OsStatus;
+
+    OsStatus = OS_write(FileDescriptor, Data, Size);
+    if (OsStatus == (int32)Size)
+    {
+        OsStatus = OS_SUCCESS;
+    }
+    else if (OsStatus >= 0)
+    {
+        OsStatus = OS_ERROR;
+    }
+
+    return OsStatus;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_LockProfileInit(void)
+{
+    CFE_ES_LockProfileGlobal_t *Prof = &CFE_ES_Global.LockProfile;
+
+    memset(Prof, 0, sizeof(*Prof));
+
+    Prof->TimerTicksPerSecond = CFE_ES_Global.ResetDataPtr->Perf.MetaData.TimerTicksPerSecond;
+    Prof->TimerLow32Rollover  = CFE_ES_Global.ResetDataPtr->Perf.MetaData.TimerLow32Rollover;
+
+    if (CFE_PLATFORM_ES_LOCK_PROFILE && Prof->TimerTicksPerSecond != 0)
+    {
+        Prof->IsEnabled = true;
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_LockProfileReset(void)
+{
+    ++CFE_ES_Global.LockProfile.Generation;
+}
+
+/*----------------------------------------------------------------
+ *
+ * CFE core internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_LockProfileWait(CFE_ES_LockProfileLock_Enum_t LockId, CFE_ES_LockProfileWait_t *WaitPtr)
+{
+    CFE_ES_LockProfileGlobal_t *Prof = &CFE_ES_Global.LockProfile;
+    CFE_ES_LockProfileTask_t *  Task;
+
+    WaitPtr->StartTime = 0;
+    WaitPtr->Contended = false;
+
+    Task = CFE_ES_LockProfileGetTask(Prof);
+    if (Task == NULL || LockId >= CFE_ES_LockProfileLock_MAX)
+    {
+        return;
+    }
+
+    /*
+     * This only catches a lock held for longer than it takes to get from here
+     * to the take, which is what matters; a nested take never waits at all
+     */
+    WaitPtr->Contended = (Task->Held[LockId].Depth == 0 && Prof->IsHeld[LockId]);
+    WaitPtr->StartTime = CFE_ES_LockProfileGetTime(Prof);
+}
+
+/*----------------------------------------------------------------
+ *
+ * CFE core internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_LockProfileAcquired(CFE_ES_LockProfileLock_Enum_t LockId, const CFE_ES_LockProfileWait_t *WaitPtr,
+                                const char *FunctionName, int32 LineNumber)
+{
+    CFE_ES_LockProfileGlobal_t *Prof = &CFE_ES_Global.LockProfile;
+    CFE_ES_LockProfileTask_t *  Task;
+    CFE_ES_LockProfileHeld_t *  Held;
+    CFE_ES_LockProfileSite_t *  Site;
+    uint64                      Now;
+    uint64                      WaitTicks;
+
+    Task = CFE_ES_LockProfileGetTask(Prof);
+    if (Task == NULL || LockId >= CFE_ES_LockProfileLock_MAX)
+    {
+        return;
+    }
+
+    /* Only the outermost acquisition of a recursive lock is accounted */
+    Held = &Task->Held[LockId];
+    ++Held->Depth;
+    if (Held->Depth > 1)
+    {
+        return;
+    }
+
+    Now       = CFE_ES_LockProfileGetTime(Prof);
+    WaitTicks = Now - WaitPtr->StartTime;
+
+    Held->AcquireTime    = Now;
+    Held->SiteIndex      = CFE_ES_LockProfileFindSite(Task, LockId, FunctionName, (uint32)LineNumber);
+    Prof->IsHeld[LockId] = true;
+
+    if (Held->SiteIndex == CFE_ES_LOCK_PROFILE_NO_SITE)
+    {
+        ++Task->DroppedSites;
+        return;
+    }
+
+    Site = &Task->Sites[Held->SiteIndex];
+    ++Site->AcquireCount;
+    if (WaitPtr->Contended)
+    {
+        ++Site->ContendedCount;
+    }
+    Site->WaitTicksTotal += WaitTicks;
+    if (WaitTicks > Site->WaitTicksMax)
+    {
+        Site->WaitTicksMax = (WaitTicks > 0xFFFFFFFF) ? 0xFFFFFFFF : (uint32)WaitTicks;
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * CFE core internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_LockProfileRelease(CFE_ES_LockProfileLock_Enum_t LockId)
+{
+    CFE_ES_LockProfileGlobal_t *Prof = &CFE_ES_Global.LockProfile;
+    CFE_ES_LockProfileTask_t *  Task;
+    CFE_ES_LockProfileHeld_t *  Held;
+    CFE_ES_LockProfileSite_t *  Site;
+    uint64                      HoldTicks;
+
+    Task = CFE_ES_LockProfileGetTask(Prof);
+    if (Task == NULL || LockId >= CFE_ES_LockProfileLock_MAX)
+    {
+        return;
+    }
+
+    /* Ignore a release of a lock that was taken before profiling started */
+    Held = &Task->Held[LockId];
+    if (Held->Depth == 0)
+    {
+        return;
+    }
+
+    --Held->Depth;
+    if (Held->Depth > 0)
+    {
+        return;
+    }
+
+    Prof->IsHeld[LockId] = false;
+
+    if (Held->SiteIndex == CFE_ES_LOCK_PROFILE_NO_SITE)
+    {
+        return;
+    }
+
+    HoldTicks = CFE_ES_LockProfileGetTime(Prof) - Held->AcquireTime;
+
+    Site = &Task->Sites[Held->SiteIndex];
+    Site->HoldTicksTotal += HoldTicks;
+    if (HoldTicks > Site->HoldTicksMax)
+    {
+        Site->HoldTicksMax = (HoldTicks > 0xFFFFFFFF) ? 0xFFFFFFFF : (uint32)HoldTicks;
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_ES_LockProfileWriteData(osal_id_t FileDescriptor, uint32 *NumRecords)
+{
+    CFE_ES_LockProfileGlobal_t *    Prof = &CFE_ES_Global.LockProfile;
+    const CFE_ES_LockProfileTask_t *Task;
+    const CFE_ES_LockProfileSite_t *Site;
+    CFE_ES_LockProfileMetaData_t    MetaData;
+    CFE_ES_LockProfileRecord_t      Record;
+    OS_task_prop_t                  TaskProp;
+    uint32                          Generation;
+    uint32                          i;
+    uint32                          j;
+    int32                           OsStatus;
+
+    *NumRecords = 0;
+
+    memset(&MetaData, 0, sizeof(MetaData));
+    MetaData.ByteOrderMark       = CFE_ES_LOCK_PROFILE_BYTE_ORDER_MARK;
+    MetaData.RecordSize          = sizeof(Record);
+    MetaData.FunctionNameLen     = sizeof(Record.FunctionName);
+    MetaData.TaskNameLen         = sizeof(Record.TaskName);
+    MetaData.TimerTicksPerSecond = Prof->TimerTicksPerSecond;
+
+    /* The record count is only known at the end, the metadata is written again then */
+    OsStatus = CFE_ES_LockProfileWriteBlock(FileDescriptor, &MetaData, sizeof(MetaData));
+
+    Generation = Prof->Generation;
+    for (i = 0; i < CFE_ES_LOCK_PROFILE_TASKS && OsStatus == OS_SUCCESS; ++i)
+    {
+        /* A table that was not cleared since the last reset holds no current data */
+        Task = &Prof->Task[i];
+        if (!OS_ObjectIdDefined(Task->TaskId) || Task->Generation != Generation)
+        {
+            continue;
+        }
+
+        MetaData.DroppedSites += Task->DroppedSites;
+
+        /* The statistics of a task that has been deleted are still written, without a name */
+        memset(&TaskProp, 0, sizeof(TaskProp));
+        OS_TaskGetInfo(Task->TaskId, &TaskProp);
+
+        for (j = 0; j < CFE_PLATFORM_ES_LOCK_PROFILE_SITES && OsStatus == OS_SUCCESS; ++j)
+        {
+            Site = &Task->Sites[j];
+            if (Site->FunctionName == NULL)
+            {
+                continue;
+            }
+
+            memset(&Record, 0, sizeof(Record));
+            Record.WaitTicksTotal = Site->WaitTicksTotal;
+            Record.HoldTicksTotal = Site->HoldTicksTotal;
+            Record.TaskId         = CFE_ES_TaskId_FromOSAL(Task->TaskId);
+            Record.LockId         = Site->LockId;
+            Record.LineNumber     = Site->LineNumber;
+            Record.AcquireCount   = Site->AcquireCount;
+            Record.ContendedCount = Site->ContendedCount;
+            Record.WaitTicksMax   = Site->WaitTicksMax;
+            Record.HoldTicksMax   = Site->HoldTicksMax;
+            strncpy(Record.FunctionName, Site->FunctionName, sizeof(Record.FunctionName) - 1);
+            strncpy(Record.TaskName, TaskProp.name, sizeof(Record.TaskName) - 1);
+
+            OsStatus = CFE_ES_LockProfileWriteBlock(FileDescriptor, &Record, sizeof(Record));
+            if (OsStatus == OS_SUCCESS)
+            {
+                ++MetaData.NumRecords;
+            }
+        }
+    }
+
+    if (OsStatus == OS_SUCCESS)
+    {
+        OsStatus = OS_lseek(FileDescriptor, sizeof(CFE_FS_Header_t), OS_SEEK_SET);
+        if (OsStatus >= 0)
+        {
+            OsStatus = CFE_ES_LockProfileWriteBlock(FileDescriptor, &MetaData, sizeof(MetaData));
+        }
+    }
+
+    *NumRecords = MetaData.NumRecords;
+
+    return OsStatus;
+}
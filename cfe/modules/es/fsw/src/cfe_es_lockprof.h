@@ -0,0 +1,144 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * Purpose: Shared data lock profiler data structures
+ *
+ * Design Notes:
+ *   Each task accounts its own acquisitions of the cFE core locks in a table
+ *   of call sites that only the task itself ever modifies, so recording
+ *   requires no lock of its own.  The only shared state written by more than
+ *   one task is a "held" flag per lock, which is only ever set and cleared by
+ *   the task holding the lock and is read by others to detect contention.
+ *
+ *   Clearing the statistics is requested by incrementing a generation count;
+ *   each task clears its own table the next time it takes a lock.
+ *
+ * References:
+ *
+ */
+
+#ifndef CFE_ES_LOCKPROF_H
+#define CFE_ES_LOCKPROF_H
+
+/*
+** Include Files
+*/
+#include "common_types.h"
+#include "osconfig.h"
+#include "cfe_es_core_internal.h"
+#include "cfe_platform_cfg.h"
+
+/*
+**  Defines
+*/
+
+/*
+ * Number of per-task tables, only one is kept when profiling
+ * is not enabled to avoid reserving memory that is never used
+ */
+#define CFE_ES_LOCK_PROFILE_TASKS (CFE_PLATFORM_ES_LOCK_PROFILE ? OS_MAX_TASKS : 1)
+
+/* Site index of a hold that is not being accounted */
+#define CFE_ES_LOCK_PROFILE_NO_SITE CFE_PLATFORM_ES_LOCK_PROFILE_SITES
+
+/*
+** Typedefs
+*/
+typedef struct
+{
+    const char *                  FunctionName; /* __func__ of the call site, NULL if the entry is unused */
+    uint32                        LineNumber;
+    CFE_ES_LockProfileLock_Enum_t LockId;
+    uint32                        AcquireCount;
+    uint32                        ContendedCount;
+    uint32                        WaitTicksMax;
+    uint32                        HoldTicksMax;
+    uint64                        WaitTicksTotal;
+    uint64                        HoldTicksTotal;
+} CFE_ES_LockProfileSite_t;
+
+typedef struct
+{
+    uint32 Depth;       /* number of nested acquisitions by the task */
+    uint32 SiteIndex;   /* site the outermost acquisition is accounted against */
+    uint64 AcquireTime; /* timebase value when the lock was obtained */
+} CFE_ES_LockProfileHeld_t;
+
+typedef struct
+{
+    osal_id_t                TaskId;     /* OSAL task owning the table, detects reuse of the slot */
+    uint32                   Generation; /* global generation the table was last cleared at */
+    uint32                   DroppedSites;
+    CFE_ES_LockProfileHeld_t Held[CFE_ES_LockProfileLock_MAX];
+    CFE_ES_LockProfileSite_t Sites[CFE_PLATFORM_ES_LOCK_PROFILE_SITES];
+} CFE_ES_LockProfileTask_t;
+
+typedef struct
+{
+    bool IsEnabled; /* set once the timebase is known, if profiling is configured */
+
+    uint32 TimerTicksPerSecond;
+    uint32 TimerLow32Rollover;
+
+    volatile uint32 Generation;                        /* incremented to clear all tables */
+    volatile bool   IsHeld[CFE_ES_LockProfileLock_MAX]; /* set by the task holding each lock */
+
+    CFE_ES_LockProfileTask_t Task[CFE_ES_LOCK_PROFILE_TASKS]; /* indexed by OSAL task, owned by that task */
+} CFE_ES_LockProfileGlobal_t;
+
+/*
+** Function prototypes
+*/
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Initialize the shared data lock profiler
+ *
+ * Clears all statistics and enables profiling if #CFE_PLATFORM_ES_LOCK_PROFILE
+ * is set.  Must be called after CFE_ES_SetupPerfVariables() as it uses the
+ * timebase information from the perf log metadata.
+ */
+void CFE_ES_LockProfileInit(void);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Request all lock profile statistics to be cleared
+ *
+ * Each task clears its own statistics the next time it takes a profiled lock.
+ */
+void CFE_ES_LockProfileReset(void);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Write the lock profile metadata and records to a file
+ *
+ * The file must be open for writing and positioned after the cFE file header.
+ * The statistics are read while tasks may be updating them, so the values of
+ * a site in active use may be slightly inconsistent with each other.
+ *
+ * @param[in]  FileDescriptor  File to write to
+ * @param[out] NumRecords      Number of records written
+ *
+ * @returns OS_SUCCESS, or the failing status of the OSAL file calls
+ */
+int32 CFE_ES_LockProfileWriteData(osal_id_t FileDescriptor, uint32 *NumRecords);
+
+#endif /* CFE_ES_LOCKPROF_H */
@@ -41,6 +41,7 @@
 #include "common_types.h"
 #include "cfe_es_api_typedefs.h"
 #include "cfe_time_api_typedefs.h"
+#include "cfe_platform_cfg.h"
 
 #include <stdarg.h> /* required for "va_list" */
 
@@ -114,6 +115,42 @@ typedef struct
     char Data[CFE_ES_SYSLOG_READ_BUFFER_SIZE]; /**< Actual syslog content */
 } CFE_ES_SysLogReadBuffer_t;
 
+/**
+ * \brief One message staged for the SysLog
+ *
+ * The entry belongs to the task that reserved it until "Ready" is set,
+ * and from then on to the committer until it has been echoed and released.
+ */
+typedef struct
+{
+    volatile uint32 Ready;                            /**< Nonzero once Text holds a complete message */
+    char            Text[CFE_ES_MAX_SYSLOG_MSG_SIZE]; /**< Formatted message, including timestamp and newline */
+} CFE_ES_SysLogStageEntry_t;
+
+/**
+ * \brief Staging ring in front of the SysLog
+ *
+ * Writers reserve an entry by advancing ReserveCount and format their message
+ * into it without holding the ES shared data lock.  Entries are committed to
+ * the reset area log in reservation order by CFE_ES_SysLogCommit_Unsync(),
+ * normally from the ES background task, and then echoed to the console and
+ * released by CFE_ES_SysLogEcho() once the lock has been given up.
+ *
+ * All counters run freely and are reduced to an entry index with a mask,
+ * so the number of entries must be a power of two.
+ *
+ * @sa CFE_ES_SysLogStage(), CFE_ES_RunSysLogCommit()
+ */
+typedef struct
+{
+    volatile uint32 ReserveCount; /**< Number of entries reserved by writers */
+    volatile uint32 CommitCount;  /**< Number of entries committed to the reset area log */
+    volatile uint32 EchoCount;    /**< Number of entries echoed to the console and released */
+    volatile bool   Active;       /**< Set once the background task is committing entries */
+
+    CFE_ES_SysLogStageEntry_t Entries[CFE_PLATFORM_ES_SYSLOG_STAGE_ENTRIES];
+} CFE_ES_SysLogStage_t;
+
 /*
 ** Function prototypes
 */
@@ -289,6 +326,84 @@ void CFE_ES_SysLog_vsnprintf(char *Buffer, size_t BufferSize, const char *SpecSt
  */
 int32 CFE_ES_SysLogDump(const char *Filename);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Format a message into the SysLog staging ring
+ *
+ * Reserves a staging entry without taking the ES shared data lock, formats
+ * the message into it, and marks it ready to be committed.  The message is
+ * written to the reset area log later by CFE_ES_SysLogCommit_Unsync(), and
+ * to the console by CFE_ES_SysLogEcho().
+ *
+ * Nothing is consumed from ArgPtr unless an entry was reserved, so the caller
+ * may fall back to writing the message directly if this fails.
+ *
+ * \param SpecStringPtr  Format string
+ * \param ArgPtr         Format arguments
+ *
+ * \retval #CFE_SUCCESS if staged
+ * \retval #CFE_ES_ERR_SYS_LOG_FULL if staged, but the log is in discard mode and already full
+ * \retval #CFE_STATUS_INCORRECT_STATE if staging is not active or no entry is free
+ */
+int32 CFE_ES_SysLogStage(const char *SpecStringPtr, va_list ArgPtr);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Commit staged messages to the SysLog
+ *
+ * Appends every ready staged message to the reset area log, in the order the
+ * entries were reserved.  Stops at the first entry that is still being written.
+ * The entries are not released until CFE_ES_SysLogEcho() has echoed them.
+ *
+ * \note This function requires external thread synchronization
+ */
+void CFE_ES_SysLogCommit_Unsync(void);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Echo committed staged messages to the console
+ *
+ * Prints every committed staged message that has not been echoed yet, and
+ * releases its entry.  Each message is copied out of its entry first, so
+ * nothing is held while printing.
+ *
+ * \note This must be called without the ES shared data lock held
+ */
+void CFE_ES_SysLogEcho(void);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Commit staged messages to the SysLog
+ *
+ * Calls CFE_ES_SysLogCommit_Unsync() with the ES shared data lock held, then
+ * CFE_ES_SysLogEcho() after giving it up.  Used before resets so staged
+ * messages are not lost.
+ */
+void CFE_ES_SysLogFlush(void);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Background job that commits staged SysLog messages
+ *
+ * The first call enables staging in CFE_ES_WriteToSysLog(); until then
+ * messages are written directly.
+ *
+ * \param ElapsedTime  Time since last call (not used)
+ * \param Arg          Pointer to the staging ring
+ *
+ * \returns true if messages are still staged, false if the ring is empty
+ */
+bool CFE_ES_RunSysLogCommit(uint32 ElapsedTime, void *Arg);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Stop staging SysLog messages
+ *
+ * Called when the background task stops.  Messages already staged are
+ * committed, and later messages are written directly.
+ */
+void CFE_ES_SysLogStageStop(void);
+
 /*
 ** Exception and Reset Log API
 */
@@ -53,6 +53,11 @@
                  } *)0)          \
                      ->Align)
 
+/**
+ * Number of blocks moved between a per-task cache and the pool at once
+ */
+#define CFE_ES_MEMPOOL_TASK_CACHE_BATCH (CFE_PLATFORM_ES_MEMPOOL_TASK_CACHE_DEPTH / 2)
+
 /*****************************************************************************/
 /*
 ** Type Definitions
@@ -97,6 +102,196 @@ int32 CFE_ES_MemPoolDirectCommit(CFE_ES_GenPoolRecord_t *PoolRecPtr, size_t Offs
     return CFE_SUCCESS;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Find the cache owned by the calling task.  If it does not have one yet
+ * and Claim is set, this claims a free cache, which must only be done while
+ * holding the pool mutex.
+ *
+ *-----------------------------------------------------------------*/
+CFE_ES_MemPoolTaskCache_t *CFE_ES_MemPoolGetTaskCache(CFE_ES_MemPoolRecord_t *PoolRecPtr, bool Claim)
+{
+    CFE_ES_MemPoolTaskCache_t *CachePtr;
+    CFE_ES_MemPoolTaskCache_t *FreeCachePtr;
+    osal_id_t                  TaskId;
+    uint32                     i;
+
+    TaskId = OS_TaskGetId();
+    if (!OS_ObjectIdDefined(TaskId))
+    {
+        /* not called from an OSAL task, no cache can be associated with it */
+        return NULL;
+    }
+
+    FreeCachePtr = NULL;
+    CachePtr     = PoolRecPtr->TaskCache;
+    for (i = 0; i < CFE_PLATFORM_ES_MEMPOOL_TASK_CACHES; ++i)
+    {
+        if (OS_ObjectIdEqual(CachePtr->OwnerTaskId, TaskId))
+        {
+            return CachePtr;
+        }
+
+        if (FreeCachePtr == NULL && !OS_ObjectIdDefined(CachePtr->OwnerTaskId))
+        {
+            FreeCachePtr = CachePtr;
+        }
+
+        ++CachePtr;
+    }
+
+    if (!Claim || FreeCachePtr == NULL)
+    {
+        return NULL;
+    }
+
+    FreeCachePtr->OwnerTaskId = TaskId;
+
+    return FreeCachePtr;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Serve a get request from the cache of the calling task, without
+ * taking the pool mutex.  Returns true if successful.
+ *
+ *-----------------------------------------------------------------*/
+bool CFE_ES_MemPoolTaskCacheGet(CFE_ES_MemPoolRecord_t *PoolRecPtr, CFE_ES_MemPoolTaskCache_t *CachePtr,
+                                size_t *BlockOffsetPtr, size_t Size)
+{
+    uint16 BucketId;
+    uint16 Idx;
+
+    BucketId = CFE_ES_GenPoolFindBucket(&PoolRecPtr->Pool, Size);
+    if (BucketId == 0 || CachePtr->Depth[BucketId - 1] == 0)
+    {
+        /* leave it to the normal path, which also refills the cache */
+        return false;
+    }
+
+    Idx             = BucketId - 1;
+    *BlockOffsetPtr = CachePtr->BlockOffset[Idx][CachePtr->Depth[Idx] - 1];
+
+    if (CFE_ES_GenPoolUncacheBlock(&PoolRecPtr->Pool, BucketId, Size, *BlockOffsetPtr) != CFE_SUCCESS)
+    {
+        /*
+         * The descriptor was damaged while the block sat in the cache, so it
+         * cannot be handed out nor returned to the pool.  Drop it, but count
+         * it the same way the pool counts its own invalid blocks.
+         */
+        OS_MutSemTake(PoolRecPtr->MutexId);
+        ++PoolRecPtr->Pool.ValidationErrorCount;
+        OS_MutSemGive(PoolRecPtr->MutexId);
+
+        --CachePtr->Depth[Idx];
+        return false;
+    }
+
+    --CachePtr->Depth[Idx];
+
+    return true;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Serve a put request with the cache of the calling task.  The pool mutex
+ * is only taken if the cache is full, to return a batch of blocks to the
+ * pool.  Returns true if successful.
+ *
+ *-----------------------------------------------------------------*/
+bool CFE_ES_MemPoolTaskCachePut(CFE_ES_MemPoolRecord_t *PoolRecPtr, CFE_ES_MemPoolTaskCache_t *CachePtr,
+                                size_t BlockOffset, size_t *BlockSizePtr)
+{
+    uint16 BucketId;
+    uint16 Idx;
+
+    if (CFE_ES_GenPoolCacheBlock(&PoolRecPtr->Pool, &BucketId, BlockSizePtr, BlockOffset) != CFE_SUCCESS)
+    {
+        /* leave it to the normal path, which reports the error */
+        return false;
+    }
+
+    Idx = BucketId - 1;
+    if (CachePtr->Depth[Idx] >= CFE_PLATFORM_ES_MEMPOOL_TASK_CACHE_DEPTH)
+    {
+        OS_MutSemTake(PoolRecPtr->MutexId);
+
+        CachePtr->Depth[Idx] -= CFE_ES_MEMPOOL_TASK_CACHE_BATCH;
+        CFE_ES_GenPoolPutCachedBlocks(&PoolRecPtr->Pool, BucketId, &CachePtr->BlockOffset[Idx][CachePtr->Depth[Idx]],
+                                      CFE_ES_MEMPOOL_TASK_CACHE_BATCH);
+
+        OS_MutSemGive(PoolRecPtr->MutexId);
+    }
+
+    CachePtr->BlockOffset[Idx][CachePtr->Depth[Idx]] = BlockOffset;
+    ++CachePtr->Depth[Idx];
+
+    return true;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Claim a cache for the calling task if needed, and move a batch of
+ * previously released blocks of the given size into it.  The pool
+ * mutex must be held.
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_MemPoolTaskCacheRefill(CFE_ES_MemPoolRecord_t *PoolRecPtr, size_t Size)
+{
+    CFE_ES_MemPoolTaskCache_t *CachePtr;
+    uint16                     BucketId;
+    uint16                     Idx;
+    uint8                      Depth;
+
+    CachePtr = CFE_ES_MemPoolGetTaskCache(PoolRecPtr, true);
+    BucketId = CFE_ES_GenPoolFindBucket(&PoolRecPtr->Pool, Size);
+    if (CachePtr == NULL || BucketId == 0)
+    {
+        return;
+    }
+
+    Idx   = BucketId - 1;
+    Depth = CachePtr->Depth[Idx];
+    if (Depth < CFE_ES_MEMPOOL_TASK_CACHE_BATCH)
+    {
+        CachePtr->Depth[Idx] += CFE_ES_GenPoolGetCachedBlocks(&PoolRecPtr->Pool, BucketId,
+                                                              &CachePtr->BlockOffset[Idx][Depth],
+                                                              CFE_ES_MEMPOOL_TASK_CACHE_BATCH - Depth);
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Count the blocks of a bucket held in all caches of a pool
+ *
+ *-----------------------------------------------------------------*/
+uint32 CFE_ES_MemPoolCachedBlockCount(CFE_ES_MemPoolRecord_t *PoolRecPtr, uint16 BucketId)
+{
+    uint32 Count;
+    uint32 i;
+
+    Count = 0;
+    if (PoolRecPtr->UseTaskCache && BucketId != 0)
+    {
+        for (i = 0; i < CFE_PLATFORM_ES_MEMPOOL_TASK_CACHES; ++i)
+        {
+            Count += PoolRecPtr->TaskCache[i].Depth[BucketId - 1];
+        }
+    }
+
+    return Count;
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -105,8 +300,7 @@ int32 CFE_ES_MemPoolDirectCommit(CFE_ES_GenPoolRecord_t *PoolRecPtr, size_t Offs
  *-----------------------------------------------------------------*/
 int32 CFE_ES_MemPoolID_ToIndex(CFE_ES_MemHandle_t PoolID, uint32 *Idx)
 {
-    return CFE_ResourceId_ToIndex(CFE_RESOURCEID_UNWRAP(PoolID), CFE_ES_POOLID_BASE, CFE_PLATFORM_ES_MAX_MEMORY_POOLS,
-                                  Idx);
+    return CFE_ES_MemPoolRecordIdToIndex(PoolID, Idx);
 }
 
 /*----------------------------------------------------------------
@@ -138,7 +332,7 @@ CFE_ES_MemPoolRecord_t *CFE_ES_LocateMemPoolRecordByID(CFE_ES_MemHandle_t PoolID
     CFE_ES_MemPoolRecord_t *MemPoolRecPtr;
     uint32                  Idx;
 
-    if (CFE_ES_MemPoolID_ToIndex(PoolID, &Idx) == CFE_SUCCESS)
+    if (CFE_ES_MemPoolRecordIdToIndex(PoolID, &Idx) == CFE_SUCCESS)
     {
         MemPoolRecPtr = &CFE_ES_Global.MemPoolTable[Idx];
     }
@@ -231,8 +425,8 @@ CFE_Status_t CFE_ES_PoolCreateEx(CFE_ES_MemHandle_t *PoolID, void *MemPtr, size_
     CFE_ES_LockSharedData(__func__, __LINE__);
 
     /* scan for a free slot */
-    PendingID  = CFE_ResourceId_FindNext(CFE_ES_Global.LastMemPoolId, CFE_PLATFORM_ES_MAX_MEMORY_POOLS,
-                                        CFE_ES_CheckMemPoolSlotUsed);
+    PendingID  = CFE_ResourceId_FindNextFree(CFE_ES_Global.LastMemPoolId, CFE_PLATFORM_ES_MAX_MEMORY_POOLS,
+                                            CFE_ES_Global.MemPoolIdMap, CFE_ES_CheckMemPoolSlotUsed);
     PoolRecPtr = CFE_ES_LocateMemPoolRecordByID(CFE_ES_MEMHANDLE_C(PendingID));
 
     if (PoolRecPtr == NULL)
@@ -281,6 +475,17 @@ CFE_Status_t CFE_ES_PoolCreateEx(CFE_ES_MemHandle_t *PoolID, void *MemPtr, size_
     Status = CFE_ES_GenPoolInitialize(&PoolRecPtr->Pool, 0, Size, Alignment, NumBlockSizes, BlockSizes,
                                       CFE_ES_MemPoolDirectRetrieve, CFE_ES_MemPoolDirectCommit);
 
+    /*
+     * Memory pools are directly mapped, so they can optionally split and merge free blocks.
+     *
+     * Note about path coverage testing - depending on the platform
+     * configuration this line may be unreachable.  This is OK.
+     */
+    if (Status == CFE_SUCCESS && CFE_PLATFORM_ES_MEMPOOL_COALESCE)
+    {
+        CFE_ES_GenPoolEnableCoalescing(&PoolRecPtr->Pool, (cpuaddr)MemPtr);
+    }
+
     /*
      * If successful, complete the process.
      */
@@ -293,8 +498,13 @@ CFE_Status_t CFE_ES_PoolCreateEx(CFE_ES_MemHandle_t *PoolID, void *MemPtr, size_
         */
         snprintf(MutexName, OS_MAX_API_NAME, "Pool%08lX", CFE_ResourceId_ToInteger(PendingID));
 
-        /* create a mutex to protect this memory pool */
-        OsStatus = OS_MutSemCreate(&PoolRecPtr->MutexId, MutexName, 0);
+        /*
+         * create a mutex to protect this memory pool.  It is never taken
+         * again while held: the task cache and generic pool routines called
+         * under it do not lock.
+         */
+        OsStatus = OS_MutSemCreate(&PoolRecPtr->MutexId, MutexName,
+                                   OS_MUTEX_OPTION_ADAPTIVE | OS_MUTEX_OPTION_STATISTICS);
         if (OsStatus != OS_SUCCESS)
         {
             /* log error and rewrite to CFE status code */
@@ -330,6 +540,7 @@ CFE_Status_t CFE_ES_PoolCreateEx(CFE_ES_MemHandle_t *PoolID, void *MemPtr, size_
         /*
          * Free the entry that was reserved earlier
          */
+        CFE_ResourceId_MapRelease(PendingID, CFE_PLATFORM_ES_MAX_MEMORY_POOLS, CFE_ES_Global.MemPoolIdMap);
         CFE_ES_MemPoolRecordSetFree(PoolRecPtr);
         PendingID = CFE_RESOURCEID_UNDEFINED;
     }
@@ -342,6 +553,92 @@ CFE_Status_t CFE_ES_PoolCreateEx(CFE_ES_MemHandle_t *PoolID, void *MemPtr, size_
     return Status;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_Status_t CFE_ES_PoolEnableTaskCache(CFE_ES_MemHandle_t Handle)
+{
+    CFE_ES_MemPoolRecord_t *PoolRecPtr;
+
+    PoolRecPtr = CFE_ES_LocateMemPoolRecordByID(Handle);
+
+    /* basic sanity check */
+    if (!CFE_ES_MemPoolRecordIsMatch(PoolRecPtr, Handle))
+    {
+        return CFE_ES_ERR_RESOURCEID_NOT_VALID;
+    }
+
+    /*
+     * Caches are claimed and refilled under the pool mutex, and a pool
+     * without one is only meant to be used by a single task anyway.
+     */
+    if (!OS_ObjectIdDefined(PoolRecPtr->MutexId))
+    {
+        return CFE_ES_BAD_ARGUMENT;
+    }
+
+    /*
+     * Free blocks of a coalescing pool are merged rather than kept per block
+     * size, so there would never be anything to put in a cache.
+     */
+    if (PoolRecPtr->Pool.IsCoalescing)
+    {
+        return CFE_ES_BAD_ARGUMENT;
+    }
+
+    PoolRecPtr->UseTaskCache = true;
+
+    return CFE_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_MemPoolReleaseTaskCaches(osal_id_t TaskId)
+{
+    CFE_ES_MemPoolRecord_t *   PoolRecPtr;
+    CFE_ES_MemPoolTaskCache_t *CachePtr;
+    uint32                     i;
+    uint32                     j;
+    uint16                     Idx;
+
+    PoolRecPtr = CFE_ES_Global.MemPoolTable;
+    for (i = 0; i < CFE_PLATFORM_ES_MAX_MEMORY_POOLS; ++i)
+    {
+        if (CFE_ES_MemPoolRecordIsUsed(PoolRecPtr) && PoolRecPtr->UseTaskCache &&
+            OS_MutSemTake(PoolRecPtr->MutexId) == OS_SUCCESS)
+        {
+            CachePtr = PoolRecPtr->TaskCache;
+            for (j = 0; j < CFE_PLATFORM_ES_MEMPOOL_TASK_CACHES; ++j)
+            {
+                if (OS_ObjectIdEqual(CachePtr->OwnerTaskId, TaskId))
+                {
+                    for (Idx = 0; Idx < PoolRecPtr->Pool.NumBuckets; ++Idx)
+                    {
+                        CFE_ES_GenPoolPutCachedBlocks(&PoolRecPtr->Pool, Idx + 1, CachePtr->BlockOffset[Idx],
+                                                      CachePtr->Depth[Idx]);
+                        CachePtr->Depth[Idx] = 0;
+                    }
+
+                    CachePtr->OwnerTaskId = OS_OBJECT_ID_UNDEFINED;
+                }
+
+                ++CachePtr;
+            }
+
+            OS_MutSemGive(PoolRecPtr->MutexId);
+        }
+
+        ++PoolRecPtr;
+    }
+}
+
 /*----------------------------------------------------------------
  *
  * Implemented per public API
@@ -363,6 +660,8 @@ int32 CFE_ES_PoolDelete(CFE_ES_MemHandle_t PoolID)
     if (CFE_ES_MemPoolRecordIsMatch(PoolRecPtr, PoolID))
     {
         MutexId = PoolRecPtr->MutexId; /* snapshot mutex ID, will be freed later */
+        CFE_ResourceId_MapRelease(CFE_RESOURCEID_UNWRAP(PoolID), CFE_PLATFORM_ES_MAX_MEMORY_POOLS,
+                                  CFE_ES_Global.MemPoolIdMap);
         CFE_ES_MemPoolRecordSetFree(PoolRecPtr);
         Status = CFE_SUCCESS;
     }
@@ -403,10 +702,11 @@ int32 CFE_ES_PoolDelete(CFE_ES_MemHandle_t PoolID)
  *-----------------------------------------------------------------*/
 int32 CFE_ES_GetPoolBuf(CFE_ES_MemPoolBuf_t *BufPtr, CFE_ES_MemHandle_t Handle, size_t Size)
 {
-    int32                   Status;
-    CFE_ES_AppId_t          AppId;
-    CFE_ES_MemPoolRecord_t *PoolRecPtr;
-    size_t                  DataOffset;
+    int32                      Status;
+    CFE_ES_AppId_t             AppId;
+    CFE_ES_MemPoolRecord_t *   PoolRecPtr;
+    CFE_ES_MemPoolTaskCache_t *CachePtr;
+    size_t                     DataOffset;
 
     if (BufPtr == NULL)
     {
@@ -424,6 +724,20 @@ int32 CFE_ES_GetPoolBuf(CFE_ES_MemPoolBuf_t *BufPtr, CFE_ES_MemHandle_t Handle,
         return CFE_ES_ERR_RESOURCEID_NOT_VALID;
     }
 
+    /*
+     * If the calling task has a cache in this pool, try to
+     * serve the request from it without taking the mutex.
+     */
+    if (PoolRecPtr->UseTaskCache)
+    {
+        CachePtr = CFE_ES_MemPoolGetTaskCache(PoolRecPtr, false);
+        if (CachePtr != NULL && CFE_ES_MemPoolTaskCacheGet(PoolRecPtr, CachePtr, &DataOffset, Size))
+        {
+            *BufPtr = CFE_ES_MEMPOOLBUF_C(PoolRecPtr->BaseAddr + DataOffset);
+            return (int32)Size;
+        }
+    }
+
     /*
      * Real work begins here.
      * If pool is mutex-protected, take the mutex now.
@@ -441,6 +755,14 @@ int32 CFE_ES_GetPoolBuf(CFE_ES_MemPoolBuf_t *BufPtr, CFE_ES_MemHandle_t Handle,
      */
     Status = CFE_ES_GenPoolGetBlock(&PoolRecPtr->Pool, &DataOffset, Size);
 
+    /*
+     * Stock the cache of the calling task for the next request of this size
+     */
+    if (Status == CFE_SUCCESS && PoolRecPtr->UseTaskCache)
+    {
+        CFE_ES_MemPoolTaskCacheRefill(PoolRecPtr, Size);
+    }
+
     /*
      * Real work ends here.
      * If pool is mutex-protected, release the mutex now.
@@ -530,10 +852,11 @@ CFE_Status_t CFE_ES_GetPoolBufInfo(CFE_ES_MemHandle_t Handle, CFE_ES_MemPoolBuf_
  *-----------------------------------------------------------------*/
 int32 CFE_ES_PutPoolBuf(CFE_ES_MemHandle_t Handle, CFE_ES_MemPoolBuf_t BufPtr)
 {
-    CFE_ES_MemPoolRecord_t *PoolRecPtr;
-    size_t                  DataSize;
-    size_t                  DataOffset;
-    int32                   Status;
+    CFE_ES_MemPoolRecord_t *   PoolRecPtr;
+    CFE_ES_MemPoolTaskCache_t *CachePtr;
+    size_t                     DataSize;
+    size_t                     DataOffset;
+    int32                      Status;
 
     if (BufPtr == NULL)
     {
@@ -550,6 +873,21 @@ int32 CFE_ES_PutPoolBuf(CFE_ES_MemHandle_t Handle, CFE_ES_MemPoolBuf_t BufPtr)
         return CFE_ES_ERR_RESOURCEID_NOT_VALID;
     }
 
+    DataOffset = (cpuaddr)BufPtr - PoolRecPtr->BaseAddr;
+
+    /*
+     * If the calling task has a cache in this pool, keep
+     * the block there without taking the mutex.
+     */
+    if (PoolRecPtr->UseTaskCache)
+    {
+        CachePtr = CFE_ES_MemPoolGetTaskCache(PoolRecPtr, false);
+        if (CachePtr != NULL && CFE_ES_MemPoolTaskCachePut(PoolRecPtr, CachePtr, DataOffset, &DataSize))
+        {
+            return (int32)DataSize;
+        }
+    }
+
     /*
      * Real work begins here.
      * If pool is mutex-protected, take the mutex now.
@@ -559,8 +897,6 @@ int32 CFE_ES_PutPoolBuf(CFE_ES_MemHandle_t Handle, CFE_ES_MemPoolBuf_t BufPtr)
         OS_MutSemTake(PoolRecPtr->MutexId);
     }
 
-    DataOffset = (cpuaddr)BufPtr - PoolRecPtr->BaseAddr;
-
     /*
      * Fundamental work is done as a generic routine.
      *
@@ -569,6 +905,14 @@ int32 CFE_ES_PutPoolBuf(CFE_ES_MemHandle_t Handle, CFE_ES_MemPoolBuf_t BufPtr)
      */
     Status = CFE_ES_GenPoolPutBlock(&PoolRecPtr->Pool, &DataSize, DataOffset);
 
+    /*
+     * Give the calling task a cache for its next request
+     */
+    if (PoolRecPtr->UseTaskCache)
+    {
+        CFE_ES_MemPoolGetTaskCache(PoolRecPtr, true);
+    }
+
     /*
      * Real work ends here.
      * If pool is mutex-protected, release the mutex now.
@@ -653,6 +997,9 @@ CFE_Status_t CFE_ES_GetMemPoolStats(CFE_ES_MemPoolStats_t *BufPtr, CFE_ES_MemHan
     {
         CFE_ES_GenPoolGetBucketUsage(&PoolRecPtr->Pool, NumBuckets, &BufPtr->BlockStats[Idx]);
 
+        /* blocks held in per-task caches are free as far as the users of the pool are concerned */
+        BufPtr->BlockStats[Idx].NumFree += CFE_ES_MemPoolCachedBlockCount(PoolRecPtr, NumBuckets);
+
         if (NumBuckets > 0)
         {
             --NumBuckets;
@@ -33,8 +33,24 @@
 */
 #include "common_types.h"
 #include "cfe_resourceid.h"
+#include "cfe_core_resourceid_basevalues.h"
 #include "cfe_es_generic_pool.h"
 
+/**
+ * Per-task cache of released blocks, see CFE_ES_PoolEnableTaskCache()
+ *
+ * Each cache is owned by a single task, which pushes and pops blocks
+ * without taking the pool mutex.  The mutex is only taken to claim the
+ * cache, and to move a batch of blocks between the cache and the pool
+ * when it runs empty or full.
+ */
+typedef struct
+{
+    osal_id_t OwnerTaskId; /**< Task using this cache, undefined if not claimed */
+    uint8     Depth[CFE_PLATFORM_ES_POOL_MAX_BUCKETS]; /**< Number of cached blocks, per bucket (ID - 1) */
+    size_t    BlockOffset[CFE_PLATFORM_ES_POOL_MAX_BUCKETS][CFE_PLATFORM_ES_MEMPOOL_TASK_CACHE_DEPTH];
+} CFE_ES_MemPoolTaskCache_t;
+
 typedef struct
 {
     /*
@@ -69,6 +85,16 @@ typedef struct
      * Optional Mutex for serializing get/put operations
      */
     osal_id_t MutexId;
+
+    /**
+     * Whether get/put operations go through the per-task caches first
+     */
+    bool UseTaskCache;
+
+    /**
+     * Per-task caches, only used if UseTaskCache is set
+     */
+    CFE_ES_MemPoolTaskCache_t TaskCache[CFE_PLATFORM_ES_MEMPOOL_TASK_CACHES];
 } CFE_ES_MemPoolRecord_t;
 
 /*---------------------------------------------------------------------------------------*/
@@ -124,6 +150,21 @@ int32 CFE_ES_MemPoolID_ToIndex(CFE_ES_MemHandle_t PoolID, uint32 *Idx);
  */
 CFE_ES_MemPoolRecord_t *CFE_ES_LocateMemPoolRecordByID(CFE_ES_MemHandle_t PoolID);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Convert a memory pool ID to an index in its table
+ *
+ * Inline form of the conversion routine, for use within ES.
+ *
+ * @param[in]   PoolID  the ID to convert
+ * @param[out]  Idx     the table index
+ * @returns CFE_SUCCESS, or an error if the ID could never refer to a table entry
+ */
+static inline CFE_Status_t CFE_ES_MemPoolRecordIdToIndex(CFE_ES_MemHandle_t PoolID, uint32 *Idx)
+{
+    return CFE_RESOURCEID_TO_INDEX(PoolID, CFE_ES_POOLID_BASE, CFE_PLATFORM_ES_MAX_MEMORY_POOLS, Idx);
+}
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * @brief Check if a Memory Pool record is in use or free/empty
@@ -241,4 +282,17 @@ static inline bool CFE_ES_MemPoolRecordIsMatch(const CFE_ES_MemPoolRecord_t *Poo
  */
 bool CFE_ES_CheckMemPoolSlotUsed(CFE_ResourceId_t CheckId);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Return the blocks held in the per-task caches of a task
+ *
+ * Returns all blocks cached for the given task in every memory pool,
+ * and frees its cache entries for use by other tasks.  This must be
+ * called when a task is deleted or exits, while the task is not (or
+ * no longer) performing pool operations itself.
+ *
+ * @param[in]   TaskId       OSAL ID of the task
+ */
+void CFE_ES_MemPoolReleaseTaskCaches(osal_id_t TaskId);
+
 #endif /* CFE_ES_MEMPOOL_H */
@@ -42,6 +42,7 @@
 #include "cfe_es_apps.h"
 #include "cfe_es_cds.h"
 #include "cfe_es_perf.h"
+#include "cfe_es_lockprof.h"
 #include "cfe_es_generic_pool.h"
 #include "cfe_es_mempool.h"
 #include "cfe_es_global.h"
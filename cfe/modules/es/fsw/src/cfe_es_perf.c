@@ -169,7 +169,7 @@ int32 CFE_ES_StartPerfDataCmd(const CFE_ES_StartPerfDataCmd_t *data)
             Perf->MetaData.DataEnd               = 0;
             Perf->MetaData.DataCount             = 0;
             Perf->MetaData.InvalidMarkerReported = false;
-            Perf->MetaData.State                 = CFE_ES_PERF_WAITING_FOR_TRIGGER; /* this must be done last */
+            Perf->MetaData.State = CFE_ES_PERF_WAITING_FOR_TRIGGER; /* this must be done last */
             OS_MutSemGive(CFE_ES_Global.PerfDataMutex);
 
             CFE_EVS_SendEvent(CFE_ES_PERF_STARTCMD_EID, CFE_EVS_EventType_DEBUG,
@@ -229,15 +229,17 @@ int32 CFE_ES_StopPerfDataCmd(const CFE_ES_StopPerfDataCmd_t *data)
 
         if (Status == CFE_SUCCESS)
         {
+            PerfDumpState->Compact      = CFE_PLATFORM_ES_PERF_DUMP_COMPACT;
             PerfDumpState->PendingState = CFE_ES_PerfDumpState_INIT;
             CFE_ES_BackgroundWakeup();
 
             CFE_ES_Global.TaskData.CommandCounter++;
 
             CFE_EVS_SendEvent(CFE_ES_PERF_STOPCMD_EID, CFE_EVS_EventType_DEBUG,
-                              "Perf Stop Cmd Rcvd, will write %d entries.%dmS dly every %d entries",
+                              "Perf Stop Cmd Rcvd, will write %d entries.%dmS dly every %d blocks of %d entries",
                               (int)Perf->MetaData.DataCount, (int)CFE_PLATFORM_ES_PERF_CHILD_MS_DELAY,
-                              (int)CFE_PLATFORM_ES_PERF_ENTRIES_BTWN_DLYS);
+                              (int)CFE_PLATFORM_ES_PERF_ENTRIES_BTWN_DLYS,
+                              (int)CFE_PLATFORM_ES_PERF_DUMP_BLOCK_ENTRIES);
         }
         else
         {
@@ -257,6 +259,68 @@ int32 CFE_ES_StopPerfDataCmd(const CFE_ES_StopPerfDataCmd_t *data)
     return CFE_SUCCESS;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Local helper function, not invoked outside this unit
+ * Appends an unsigned LEB128 varint to the buffer, returns the number of bytes
+ *
+ *-----------------------------------------------------------------*/
+static size_t CFE_ES_PerfDumpPutVarint(uint8 *Buf, uint64 Value)
+{
+    size_t Len = 0;
+
+    while (Value >= 0x80)
+    {
+        Buf[Len] = (uint8)(Value | 0x80);
+        Value >>= 7;
+        ++Len;
+    }
+
+    Buf[Len] = (uint8)Value;
+
+    return Len + 1;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Local helper function, not invoked outside this unit
+ * Encodes a block of perf log entries into the compact format staging buffer
+ * See CFE_ES_PERF_COMPACT_MAX_RECORD_SIZE for a description of the format
+ *
+ *-----------------------------------------------------------------*/
+static size_t CFE_ES_PerfDumpEncodeBlock(CFE_ES_PerfDumpGlobal_t *State, const CFE_ES_PerfDataEntry_t *Entry,
+                                         uint32 Count, uint32 TimerLow32Rollover)
+{
+    size_t Len = 0;
+    uint64 Timestamp;
+    uint64 Delta;
+
+    while (Count > 0)
+    {
+        if (TimerLow32Rollover != 0)
+        {
+            Timestamp = ((uint64)Entry->TimerUpper32 * TimerLow32Rollover) + Entry->TimerLower32;
+        }
+        else
+        {
+            Timestamp = ((uint64)Entry->TimerUpper32 << 32) | Entry->TimerLower32;
+        }
+
+        /* zigzag encoding keeps small negative deltas (out of order entries from different tasks) short */
+        Delta = Timestamp - State->LastTimestamp;
+        Delta = (Delta << 1) ^ ((Delta & 0x8000000000000000ULL) ? ~0ULL : 0ULL);
+
+        Len += CFE_ES_PerfDumpPutVarint(&State->EncodeBuffer[Len], Delta);
+        Len += CFE_ES_PerfDumpPutVarint(&State->EncodeBuffer[Len], (Entry->Data << 1) | (Entry->Data >> 31));
+
+        State->LastTimestamp = Timestamp;
+        ++Entry;
+        --Count;
+    }
+
+    return Len;
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -270,6 +334,7 @@ bool CFE_ES_RunPerfLogDump(uint32 ElapsedTime, void *Arg)
     int32                    Status;
     CFE_FS_Header_t          FileHdr;
     size_t                   BlockSize;
+    uint32                   ItemCount;
     CFE_ES_PerfData_t *      Perf;
 
     /*
@@ -349,8 +414,9 @@ bool CFE_ES_RunPerfLogDump(uint32 ElapsedTime, void *Arg)
                     break;
 
                 case CFE_ES_PerfDumpState_WRITE_PERF_ENTRIES:
-                    State->DataPos      = Perf->MetaData.DataStart;
-                    State->StateCounter = Perf->MetaData.DataCount;
+                    State->DataPos       = Perf->MetaData.DataStart;
+                    State->StateCounter  = Perf->MetaData.DataCount;
+                    State->LastTimestamp = 0;
                     break;
 
                 case CFE_ES_PerfDumpState_UNLOCK_DATA:
@@ -420,12 +486,14 @@ bool CFE_ES_RunPerfLogDump(uint32 ElapsedTime, void *Arg)
              */
             Status    = 0;
             BlockSize = 0;
+            ItemCount = 1;
             switch (State->CurrentState)
             {
                 case CFE_ES_PerfDumpState_WRITE_FS_HDR:
                     /* Zero cFE header, then fill in fields */
-                    CFE_FS_InitHeader(&FileHdr, CFE_ES_PERF_LOG_DESC, CFE_FS_SubType_ES_PERFDATA);
-                    /* predicted total length of final output */
+                    CFE_FS_InitHeader(&FileHdr, CFE_ES_PERF_LOG_DESC,
+                                      State->Compact ? CFE_FS_SubType_ES_PERFDATA_COMPACT : CFE_FS_SubType_ES_PERFDATA);
+                    /* predicted total length of final output (after decoding, for the compact format) */
                     FileHdr.Length =
                         sizeof(CFE_ES_PerfMetaData_t) + (Perf->MetaData.DataCount * sizeof(CFE_ES_PerfDataEntry_t));
                     /* write the cFE header to the file */
@@ -441,11 +509,31 @@ bool CFE_ES_RunPerfLogDump(uint32 ElapsedTime, void *Arg)
                     break;
 
                 case CFE_ES_PerfDumpState_WRITE_PERF_ENTRIES:
-                    BlockSize = sizeof(CFE_ES_PerfDataEntry_t);
-                    OsStatus  = OS_write(State->FileDesc, &Perf->DataBuffer[State->DataPos], BlockSize);
-                    Status    = (long)OsStatus; /* status type conversion (size) */
+                    /* write as much of the contiguous ring segment as fits in one block */
+                    ItemCount = State->StateCounter;
+                    if (ItemCount > CFE_PLATFORM_ES_PERF_DUMP_BLOCK_ENTRIES)
+                    {
+                        ItemCount = CFE_PLATFORM_ES_PERF_DUMP_BLOCK_ENTRIES;
+                    }
+                    if (ItemCount > (CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE - State->DataPos))
+                    {
+                        ItemCount = CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE - State->DataPos;
+                    }
 
-                    ++State->DataPos;
+                    if (State->Compact)
+                    {
+                        BlockSize = CFE_ES_PerfDumpEncodeBlock(State, &Perf->DataBuffer[State->DataPos], ItemCount,
+                                                               Perf->MetaData.TimerLow32Rollover);
+                        OsStatus  = OS_write(State->FileDesc, State->EncodeBuffer, BlockSize);
+                    }
+                    else
+                    {
+                        BlockSize = ItemCount * sizeof(CFE_ES_PerfDataEntry_t);
+                        OsStatus  = OS_write(State->FileDesc, &Perf->DataBuffer[State->DataPos], BlockSize);
+                    }
+                    Status = (long)OsStatus; /* status type conversion (size) */
+
+                    State->DataPos += ItemCount;
                     if (State->DataPos >= CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE)
                     {
                         State->DataPos = 0;
@@ -474,7 +562,7 @@ bool CFE_ES_RunPerfLogDump(uint32 ElapsedTime, void *Arg)
                 }
             }
 
-            --State->StateCounter;
+            State->StateCounter -= ItemCount;
         }
     }
 
@@ -577,6 +665,16 @@ void CFE_ES_PerfLogAdd(uint32 Marker, uint32 EntryExit)
     */
     Perf = &CFE_ES_Global.ResetDataPtr->Perf;
 
+    /*
+     * The statistics are always kept, for all markers, whether or not a trace
+     * capture is running and regardless of the filter mask.  They are task-local
+     * and do not take the perflog mutex.
+     */
+    if (CFE_ES_Global.PerfStats.IsEnabled && Marker < CFE_MISSION_ES_PERF_MAX_IDS)
+    {
+        CFE_ES_PerfStatsUpdate(Marker, EntryExit);
+    }
+
     /*
      * If the global state is idle, exit immediately without locking or doing anything
      */
@@ -692,3 +790,321 @@ void CFE_ES_PerfLogAdd(uint32 Marker, uint32 EntryExit)
 
     OS_MutSemGive(CFE_ES_Global.PerfDataMutex);
 }
+
+/*----------------------------------------------------------------
+ *
+ * Local helper function, not invoked outside this unit
+ * Gets the statistics of the calling task, or NULL if it has none.
+ * Clears them first if they were kept by a task that has since been
+ * deleted, or if a reset was requested since they were last cleared.
+ *
+ *-----------------------------------------------------------------*/
+static CFE_ES_PerfStatsTask_t *CFE_ES_PerfStatsGetTask(CFE_ES_PerfStatsGlobal_t *Stats)
+{
+    CFE_ES_PerfStatsTask_t *Task;
+    osal_id_t               TaskId;
+    osal_index_t            TaskIndex;
+    uint32                  Generation;
+
+    if (!Stats->IsEnabled)
+    {
+        return NULL;
+    }
+
+    /*
+     * Markers are matched per task, so a marker logged from a thread that is
+     * not an OSAL task (or before init is complete) cannot be timed
+     */
+    TaskId = OS_TaskGetId();
+    if (OS_ObjectIdToArrayIndex(OS_OBJECT_TYPE_OS_TASK, TaskId, &TaskIndex) != OS_SUCCESS)
+    {
+        return NULL;
+    }
+
+    Task       = &Stats->Task[TaskIndex];
+    Generation = Stats->Generation;
+
+    if (!OS_ObjectIdEqual(Task->TaskId, TaskId))
+    {
+        memset(Task, 0, sizeof(*Task));
+        Task->TaskId     = TaskId;
+        Task->Generation = Generation;
+    }
+    else if (Task->Generation != Generation)
+    {
+        /* Markers entered right now are kept, and accounted in the new interval when they exit */
+        memset(Task->Accum, 0, sizeof(Task->Accum));
+        Task->NestingOverflows = 0;
+        Task->UnmatchedExits   = 0;
+        Task->DroppedSamples   = 0;
+        Task->Generation       = Generation;
+    }
+
+    return Task;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Local helper function, not invoked outside this unit
+ * Finds (or allocates) the statistics entry of a marker in the table of
+ * a task, returns NULL if the table is full
+ *
+ *-----------------------------------------------------------------*/
+static CFE_ES_PerfStatsAccum_t *CFE_ES_PerfStatsFindAccum(CFE_ES_PerfStatsTask_t *Task, uint32 Marker)
+{
+    CFE_ES_PerfStatsAccum_t *Accum;
+    uint32                   Probe;
+
+    for (Probe = 0; Probe < CFE_PLATFORM_ES_PERF_STATS_MARKERS_PER_TASK; ++Probe)
+    {
+        Accum = &Task->Accum[(Marker + Probe) & (CFE_PLATFORM_ES_PERF_STATS_MARKERS_PER_TASK - 1)];
+
+        if (Accum->Count == 0)
+        {
+            Accum->Marker = Marker;
+            return Accum;
+        }
+
+        if (Accum->Marker == Marker)
+        {
+            return Accum;
+        }
+    }
+
+    return NULL;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_PerfStatsInit(void)
+{
+    CFE_ES_PerfStatsGlobal_t *Stats = &CFE_ES_Global.PerfStats;
+
+    memset(Stats, 0, sizeof(*Stats));
+
+    Stats->TimerTicksPerSecond = CFE_ES_Global.ResetDataPtr->Perf.MetaData.TimerTicksPerSecond;
+    Stats->TimerLow32Rollover  = CFE_ES_Global.ResetDataPtr->Perf.MetaData.TimerLow32Rollover;
+
+    if (Stats->TimerTicksPerSecond != 0)
+    {
+        Stats->IsEnabled = true;
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_PerfStatsUpdate(uint32 Marker, uint32 EntryExit)
+{
+    CFE_ES_PerfStatsGlobal_t *Stats = &CFE_ES_Global.PerfStats;
+    CFE_ES_PerfStatsTask_t *  Task;
+    CFE_ES_PerfStatsAccum_t * Accum;
+    uint32                    TimerUpper32;
+    uint32                    TimerLower32;
+    uint64                    Now;
+    uint64                    ElapsedUsec;
+    uint32                    Depth;
+    uint32                    Bin;
+
+    Task = CFE_ES_PerfStatsGetTask(Stats);
+    if (Task == NULL)
+    {
+        return;
+    }
+
+    CFE_PSP_Get_Timebase(&TimerUpper32, &TimerLower32);
+    if (Stats->TimerLow32Rollover == 0)
+    {
+        Now = ((uint64)TimerUpper32 << 32) | TimerLower32;
+    }
+    else
+    {
+        Now = ((uint64)TimerUpper32 * Stats->TimerLow32Rollover) + TimerLower32;
+    }
+
+    Depth = Task->Depth;
+
+    if (EntryExit == 0) /* CFE_ES_PerfLogEntry() */
+    {
+        if (Depth < CFE_PLATFORM_ES_PERF_STATS_MAX_NESTING)
+        {
+            Task->Open[Depth].Marker    = Marker;
+            Task->Open[Depth].StartTime = Now;
+            Task->Depth                 = Depth + 1;
+        }
+        else
+        {
+            ++Task->NestingOverflows;
+        }
+
+        return;
+    }
+
+    /*
+     * Find the most recent entry of this marker.  Anything entered after it
+     * but never exited is discarded along with it.
+     */
+    while (Depth > 0 && Task->Open[Depth - 1].Marker != Marker)
+    {
+        --Depth;
+    }
+
+    if (Depth == 0)
+    {
+        ++Task->UnmatchedExits;
+        return;
+    }
+
+    --Depth;
+    Task->Depth = Depth;
+
+    Accum = CFE_ES_PerfStatsFindAccum(Task, Marker);
+    if (Accum == NULL)
+    {
+        ++Task->DroppedSamples;
+        return;
+    }
+
+    ElapsedUsec = ((Now - Task->Open[Depth].StartTime) * 1000000) / Stats->TimerTicksPerSecond;
+    if (ElapsedUsec > 0xFFFFFFFF)
+    {
+        ElapsedUsec = 0xFFFFFFFF;
+    }
+
+    /* bin 0 is under 1us, bin N is [2^(N-1), 2^N) us, the last bin is open ended */
+    Bin = 0;
+    while (Bin < (CFE_MISSION_ES_PERF_STATS_HIST_BINS - 1) && (ElapsedUsec >> Bin) != 0)
+    {
+        ++Bin;
+    }
+
+    if (Accum->Count == 0 || ElapsedUsec < Accum->MinTimeUsec)
+    {
+        Accum->MinTimeUsec = (uint32)ElapsedUsec;
+    }
+    if (ElapsedUsec > Accum->MaxTimeUsec)
+    {
+        Accum->MaxTimeUsec = (uint32)ElapsedUsec;
+    }
+    Accum->TotalTimeUsec += ElapsedUsec;
+    ++Accum->Histogram[Bin];
+    ++Accum->Count; /* last, the entry is in use once this is nonzero */
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_PerfStatsReport(CFE_ES_PerfStatsTlm_Payload_t *Payload)
+{
+    CFE_ES_PerfStatsGlobal_t *     Stats = &CFE_ES_Global.PerfStats;
+    const CFE_ES_PerfStatsTask_t * Task;
+    const CFE_ES_PerfStatsAccum_t *TaskAccum;
+    CFE_ES_PerfMarkerStats_t *     Entry;
+    CFE_ES_PerfStatsAccum_t *      Accum;
+    bool                           IsReported[CFE_MISSION_ES_PERF_MAX_IDS];
+    uint32                         Generation;
+    uint32                         Best;
+    uint32                         Bin;
+    uint32                         i;
+    uint32                         j;
+
+    memset(Payload, 0, sizeof(*Payload));
+
+    if (!Stats->IsEnabled)
+    {
+        return;
+    }
+
+    memset(IsReported, 0, sizeof(IsReported));
+    memset(Stats->Merged, 0, sizeof(Stats->Merged));
+
+    /* A table that was not cleared since the last report holds no current data */
+    Generation = Stats->Generation;
+    for (i = 0; i < OS_MAX_TASKS; ++i)
+    {
+        Task = &Stats->Task[i];
+        if (!OS_ObjectIdDefined(Task->TaskId) || Task->Generation != Generation)
+        {
+            continue;
+        }
+
+        Payload->NestingOverflows += Task->NestingOverflows;
+        Payload->UnmatchedExits += Task->UnmatchedExits;
+        Payload->DroppedSamples += Task->DroppedSamples;
+
+        for (j = 0; j < CFE_PLATFORM_ES_PERF_STATS_MARKERS_PER_TASK; ++j)
+        {
+            TaskAccum = &Task->Accum[j];
+            if (TaskAccum->Count == 0 || TaskAccum->Marker >= CFE_MISSION_ES_PERF_MAX_IDS)
+            {
+                continue;
+            }
+
+            Accum = &Stats->Merged[TaskAccum->Marker];
+            if (Accum->Count == 0 || TaskAccum->MinTimeUsec < Accum->MinTimeUsec)
+            {
+                Accum->MinTimeUsec = TaskAccum->MinTimeUsec;
+            }
+            if (TaskAccum->MaxTimeUsec > Accum->MaxTimeUsec)
+            {
+                Accum->MaxTimeUsec = TaskAccum->MaxTimeUsec;
+            }
+            Accum->Count += TaskAccum->Count;
+            Accum->TotalTimeUsec += TaskAccum->TotalTimeUsec;
+            for (Bin = 0; Bin < CFE_MISSION_ES_PERF_STATS_HIST_BINS; ++Bin)
+            {
+                Accum->Histogram[Bin] += TaskAccum->Histogram[Bin];
+            }
+        }
+    }
+
+    /* start a new interval; the open markers of each task are kept */
+    ++Stats->Generation;
+
+    for (i = 0; i < CFE_MISSION_ES_PERF_MAX_IDS; ++i)
+    {
+        if (Stats->Merged[i].Count != 0)
+        {
+            ++Payload->ActiveMarkers;
+        }
+    }
+
+    /* A simple selection of the busiest markers; N is small */
+    while (Payload->NumMarkers < CFE_MISSION_ES_PERF_STATS_TOP_N && Payload->NumMarkers < Payload->ActiveMarkers)
+    {
+        Best = CFE_MISSION_ES_PERF_MAX_IDS;
+        for (i = 0; i < CFE_MISSION_ES_PERF_MAX_IDS; ++i)
+        {
+            if (!IsReported[i] && Stats->Merged[i].Count != 0 &&
+                (Best == CFE_MISSION_ES_PERF_MAX_IDS ||
+                 Stats->Merged[i].TotalTimeUsec > Stats->Merged[Best].TotalTimeUsec))
+            {
+                Best = i;
+            }
+        }
+
+        IsReported[Best] = true;
+        Accum            = &Stats->Merged[Best];
+        Entry            = &Payload->MarkerStats[Payload->NumMarkers];
+
+        Entry->PerfId        = Best;
+        Entry->Count         = Accum->Count;
+        Entry->TotalTimeUsec = (Accum->TotalTimeUsec > 0xFFFFFFFF) ? 0xFFFFFFFF : (uint32)Accum->TotalTimeUsec;
+        Entry->MinTimeUsec   = Accum->MinTimeUsec;
+        Entry->MaxTimeUsec   = Accum->MaxTimeUsec;
+        Entry->MeanTimeUsec  = (uint32)(Accum->TotalTimeUsec / Accum->Count);
+        memcpy(Entry->Histogram, Accum->Histogram, sizeof(Entry->Histogram));
+
+        ++Payload->NumMarkers;
+    }
+}
@@ -36,6 +36,8 @@
 #include "common_types.h"
 #include "osconfig.h"
 #include "cfe_es_api_typedefs.h"
+#include "cfe_es_msg.h"
+#include "cfe_platform_cfg.h"
 
 /*
 **  Defines
@@ -81,6 +83,23 @@ typedef enum
     CFE_ES_PerfDumpState_MAX                  /* Placeholder for last state, no action, always last */
 } CFE_ES_PerfDumpState_t;
 
+/*
+ * Compact perf log dump format
+ *
+ * Each entry is written as two unsigned LEB128 varints (7 bits per byte,
+ * least significant group first, high bit set on all but the last byte):
+ *
+ *  1. The zigzag-encoded signed difference between this entry's timestamp
+ *     and the previous one (the first entry is relative to zero).  The
+ *     64-bit timestamp is TimerUpper32 * TimerLow32Rollover + TimerLower32,
+ *     or simply the concatenation of the two words when the rollover is 0.
+ *  2. The data word rotated left by one bit, so that the entry/exit flag
+ *     in bit 31 becomes bit 0 and small marker IDs encode to a single byte.
+ *
+ * The worst case is 10 bytes for the delta plus 5 bytes for the data word.
+ */
+#define CFE_ES_PERF_COMPACT_MAX_RECORD_SIZE 15
+
 /*
  * Performance log dump state structure
  *
@@ -108,6 +127,11 @@ typedef struct
     uint32    StateCounter;                  /* number of blocks/items left in current state */
     uint32    DataPos;                       /* last position within the Perf Log */
     size_t    FileSize;                      /* Total file size, for progress reporting in telemetry */
+    bool      Compact;                       /* whether entries are written in the compact format */
+    uint64    LastTimestamp;                 /* previous entry timestamp, for compact delta encoding */
+
+    /* staging area for one block of entries in the compact format */
+    uint8 EncodeBuffer[CFE_PLATFORM_ES_PERF_DUMP_BLOCK_ENTRIES * CFE_ES_PERF_COMPACT_MAX_RECORD_SIZE];
 } CFE_ES_PerfDumpGlobal_t;
 
 /*
@@ -124,6 +148,93 @@ typedef struct
  */
 uint32 CFE_ES_GetPerfLogDumpRemaining(void);
 
+/*
+ * Performance marker statistics
+ *
+ * Every entry/exit pair of a performance marker is timed and folded into
+ * per-marker statistics, whether or not a trace capture is running.  Each
+ * task keeps the stack of the markers it has entered and its own statistics
+ * table, which only that task writes, so no lock is taken when a marker is
+ * logged.  The tables of all tasks are merged when the statistics are reported.
+ *
+ * Clearing the statistics is requested by incrementing a generation count;
+ * each task clears its own table the next time it logs a marker.
+ */
+typedef struct
+{
+    uint32 Marker;    /* marker ID that was entered */
+    uint32 Spare;     /* keeps the timestamp 64-bit aligned */
+    uint64 StartTime; /* timebase value at entry */
+} CFE_ES_PerfStatsOpenMarker_t;
+
+typedef struct
+{
+    uint32 Marker; /* marker ID, only valid if Count is nonzero */
+    uint32 Count;
+    uint32 MinTimeUsec;
+    uint32 MaxTimeUsec;
+    uint64 TotalTimeUsec;
+    uint32 Histogram[CFE_MISSION_ES_PERF_STATS_HIST_BINS];
+} CFE_ES_PerfStatsAccum_t;
+
+typedef struct
+{
+    osal_id_t TaskId;     /* OSAL task owning the table, detects reuse of the slot */
+    uint32    Generation; /* global generation the statistics were last cleared at */
+
+    uint32 NestingOverflows;
+    uint32 UnmatchedExits;
+    uint32 DroppedSamples;
+
+    uint32                       Depth; /* number of valid entries in Open */
+    CFE_ES_PerfStatsOpenMarker_t Open[CFE_PLATFORM_ES_PERF_STATS_MAX_NESTING];
+    CFE_ES_PerfStatsAccum_t      Accum[CFE_PLATFORM_ES_PERF_STATS_MARKERS_PER_TASK];
+} CFE_ES_PerfStatsTask_t;
+
+typedef struct
+{
+    bool IsEnabled; /* set once the timebase is known */
+
+    uint32 TimerTicksPerSecond;
+    uint32 TimerLow32Rollover;
+
+    volatile uint32 Generation; /* incremented to clear the statistics of all tasks */
+
+    CFE_ES_PerfStatsTask_t  Task[OS_MAX_TASKS];                  /* indexed by OSAL task, owned by that task */
+    CFE_ES_PerfStatsAccum_t Merged[CFE_MISSION_ES_PERF_MAX_IDS]; /* report scratch area, used by the ES task */
+} CFE_ES_PerfStatsGlobal_t;
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Initialize the performance marker statistics
+ *
+ * Clears all statistics and enables collection if the timebase is known.
+ * Must be called after CFE_ES_SetupPerfVariables() as it uses the timebase
+ * information from the perf log metadata.
+ */
+void CFE_ES_PerfStatsInit(void);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Account a performance marker entry or exit in the statistics
+ *
+ * Called for every valid marker logged, whether or not a trace capture is
+ * running and regardless of the filter mask.
+ */
+void CFE_ES_PerfStatsUpdate(uint32 Marker, uint32 EntryExit);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Report the busiest performance markers and start a new interval
+ *
+ * Merges the statistics of all tasks and fills the payload with the markers
+ * with the highest total time since the previous report, busiest first, then
+ * requests all statistics to be cleared.  The tables are read while tasks may
+ * be updating them, so the values of a marker in active use may be slightly
+ * inconsistent with each other.
+ */
+void CFE_ES_PerfStatsReport(CFE_ES_PerfStatsTlm_Payload_t *Payload);
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * @brief Write performance data to a file
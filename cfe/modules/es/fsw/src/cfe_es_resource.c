@@ -176,6 +176,42 @@ CFE_ES_GenCounterRecord_t *CFE_ES_LocateCounterRecordByName(const char *Name)
     return CounterRecPtr;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_ES_BackgroundJobRecord_t *CFE_ES_LocateBackgroundJobRecordByName(const char *Name)
+{
+    CFE_ES_BackgroundJobRecord_t *JobRecPtr;
+    uint32                        Count;
+
+    /*
+    ** Search the background job table for a matching name.
+    */
+    JobRecPtr = CFE_ES_Global.BackgroundJobTable;
+    Count     = CFE_PLATFORM_ES_MAX_BACKGROUND_JOBS;
+    while (true)
+    {
+        if (Count == 0)
+        {
+            JobRecPtr = NULL;
+            break;
+        }
+        if (CFE_ES_BackgroundJobRecordIsUsed(JobRecPtr) &&
+            strcmp(Name, CFE_ES_BackgroundJobRecordGetName(JobRecPtr)) == 0)
+        {
+            break;
+        }
+
+        ++JobRecPtr;
+        --Count;
+    }
+
+    return JobRecPtr;
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -187,7 +223,7 @@ CFE_ES_AppRecord_t *CFE_ES_LocateAppRecordByID(CFE_ES_AppId_t AppID)
     CFE_ES_AppRecord_t *AppRecPtr;
     uint32              Idx;
 
-    if (CFE_ES_AppID_ToIndex(AppID, &Idx) == CFE_SUCCESS)
+    if (CFE_ES_AppRecordIdToIndex(AppID, &Idx) == CFE_SUCCESS)
     {
         AppRecPtr = &CFE_ES_Global.AppTable[Idx];
     }
@@ -210,7 +246,7 @@ CFE_ES_LibRecord_t *CFE_ES_LocateLibRecordByID(CFE_ES_LibId_t LibID)
     CFE_ES_LibRecord_t *LibRecPtr;
     uint32              Idx;
 
-    if (CFE_ES_LibID_ToIndex(LibID, &Idx) == CFE_SUCCESS)
+    if (CFE_ES_LibRecordIdToIndex(LibID, &Idx) == CFE_SUCCESS)
     {
         LibRecPtr = &CFE_ES_Global.LibTable[Idx];
     }
@@ -256,7 +292,7 @@ CFE_ES_GenCounterRecord_t *CFE_ES_LocateCounterRecordByID(CFE_ES_CounterId_t Cou
     CFE_ES_GenCounterRecord_t *CounterRecPtr;
     uint32                     Idx;
 
-    if (CFE_ES_CounterID_ToIndex(CounterID, &Idx) == CFE_SUCCESS)
+    if (CFE_ES_CounterRecordIdToIndex(CounterID, &Idx) == CFE_SUCCESS)
     {
         CounterRecPtr = &CFE_ES_Global.CounterTable[Idx];
     }
@@ -268,6 +304,29 @@ CFE_ES_GenCounterRecord_t *CFE_ES_LocateCounterRecordByID(CFE_ES_CounterId_t Cou
     return CounterRecPtr;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_ES_BackgroundJobRecord_t *CFE_ES_LocateBackgroundJobRecordByID(CFE_ES_BackgroundJobId_t JobID)
+{
+    CFE_ES_BackgroundJobRecord_t *JobRecPtr;
+    uint32                        Idx;
+
+    if (CFE_ES_BackgroundJobRecordIdToIndex(JobID, &Idx) == CFE_SUCCESS)
+    {
+        JobRecPtr = &CFE_ES_Global.BackgroundJobTable[Idx];
+    }
+    else
+    {
+        JobRecPtr = NULL;
+    }
+
+    return JobRecPtr;
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -358,6 +417,24 @@ bool CFE_ES_CheckCounterIdSlotUsed(CFE_ResourceId_t CheckId)
     return (GenCounterRecPtr == NULL || CFE_ES_CounterRecordIsUsed(GenCounterRecPtr));
 }
 
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+bool CFE_ES_CheckBackgroundJobIdSlotUsed(CFE_ResourceId_t CheckId)
+{
+    CFE_ES_BackgroundJobRecord_t *JobRecPtr;
+    /*
+     * Note - The pointer here should never be NULL because the ID should always be
+     * within the expected range, but if it ever is NULL, this should return true
+     * such that the caller will _not_ attempt to use the record.
+     */
+    JobRecPtr = CFE_ES_LocateBackgroundJobRecordByID(CFE_ES_BGJOBID_C(CheckId));
+    return (JobRecPtr == NULL || CFE_ES_BackgroundJobRecordIsUsed(JobRecPtr));
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
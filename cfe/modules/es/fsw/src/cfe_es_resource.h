@@ -148,6 +148,44 @@ CFE_ES_TaskRecord_t *CFE_ES_LocateTaskRecordByID(CFE_ES_TaskId_t TaskID);
  */
 CFE_ES_GenCounterRecord_t *CFE_ES_LocateCounterRecordByID(CFE_ES_CounterId_t CounterID);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Locate the background job table entry correlating with a given job ID.
+ *
+ * This only returns a pointer to the table entry where the record
+ * should reside, but does _not_ actually check/validate the entry.
+ *
+ * If the passed-in ID parameter is not within the acceptable range of ID
+ * values for background jobs, such that it could never be valid under
+ * any circumstances, then NULL is returned.  Otherwise, a pointer to the
+ * corresponding table entry is returned, indicating the location where
+ * that ID _should_ reside, if it is currently in use.
+ *
+ * The CFE_ES_BackgroundJobRecordIsMatch() function can be used to check/confirm
+ * if the returned table entry is a positive match for the given ID.
+ *
+ * @sa CFE_ES_BackgroundJobRecordIsMatch()
+ *
+ * @param[in]   JobID   the background job ID to locate
+ * @return pointer to background job table entry for the given job ID, or NULL if out of range
+ */
+CFE_ES_BackgroundJobRecord_t *CFE_ES_LocateBackgroundJobRecordByID(CFE_ES_BackgroundJobId_t JobID);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Convert an app ID to an index in its table
+ *
+ * Inline form of the public conversion routine, for use within ES.
+ *
+ * @param[in]   AppID   the ID to convert
+ * @param[out]  Idx     the table index
+ * @returns CFE_SUCCESS, or an error if the ID could never refer to a table entry
+ */
+static inline CFE_Status_t CFE_ES_AppRecordIdToIndex(CFE_ES_AppId_t AppID, uint32 *Idx)
+{
+    return CFE_RESOURCEID_TO_INDEX(AppID, CFE_ES_APPID_BASE, CFE_PLATFORM_ES_MAX_APPLICATIONS, Idx);
+}
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * @brief Check if an app record is in use or free/empty
@@ -272,6 +310,21 @@ static inline const char *CFE_ES_AppRecordGetName(const CFE_ES_AppRecord_t *AppR
     return AppRecPtr->AppName;
 }
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Convert a library ID to an index in its table
+ *
+ * Inline form of the public conversion routine, for use within ES.
+ *
+ * @param[in]   LibID   the ID to convert
+ * @param[out]  Idx     the table index
+ * @returns CFE_SUCCESS, or an error if the ID could never refer to a table entry
+ */
+static inline CFE_Status_t CFE_ES_LibRecordIdToIndex(CFE_ES_LibId_t LibID, uint32 *Idx)
+{
+    return CFE_RESOURCEID_TO_INDEX(LibID, CFE_ES_LIBID_BASE, CFE_PLATFORM_ES_MAX_LIBRARIES, Idx);
+}
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * @brief Check if a Library record is in use or free/empty
@@ -520,6 +573,21 @@ static inline const char *CFE_ES_TaskRecordGetName(const CFE_ES_TaskRecord_t *Ta
     return TaskRecPtr->TaskName;
 }
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Convert a counter ID to an index in its table
+ *
+ * Inline form of the public conversion routine, for use within ES.
+ *
+ * @param[in]   CounterID   the ID to convert
+ * @param[out]  Idx     the table index
+ * @returns CFE_SUCCESS, or an error if the ID could never refer to a table entry
+ */
+static inline CFE_Status_t CFE_ES_CounterRecordIdToIndex(CFE_ES_CounterId_t CounterID, uint32 *Idx)
+{
+    return CFE_RESOURCEID_TO_INDEX(CounterID, CFE_ES_COUNTID_BASE, CFE_PLATFORM_ES_MAX_GEN_COUNTERS, Idx);
+}
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * @brief Check if a Counter record is in use or free/empty
@@ -645,6 +713,127 @@ static inline const char *CFE_ES_CounterRecordGetName(const CFE_ES_GenCounterRec
     return CounterRecPtr->CounterName;
 }
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Convert a background job ID to an index in its table
+ *
+ * Inline form of the public conversion routine, for use within ES.
+ *
+ * @param[in]   JobID   the ID to convert
+ * @param[out]  Idx     the table index
+ * @returns CFE_SUCCESS, or an error if the ID could never refer to a table entry
+ */
+static inline CFE_Status_t CFE_ES_BackgroundJobRecordIdToIndex(CFE_ES_BackgroundJobId_t JobID, uint32 *Idx)
+{
+    return CFE_RESOURCEID_TO_INDEX(JobID, CFE_ES_BGJOBID_BASE, CFE_PLATFORM_ES_MAX_BACKGROUND_JOBS, Idx);
+}
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Check if a background job record is in use or free/empty
+ *
+ * As this dereferences fields within the record, global data must be
+ * locked prior to invoking this function.
+ *
+ * @note This internal helper function must only be used on record pointers
+ * that are known to refer to an actual table location (i.e. non-null).
+ *
+ * @param[in]   JobRecPtr   pointer to background job table entry
+ * @returns true if the entry is in use/configured, or false if it is free/empty
+ */
+static inline bool CFE_ES_BackgroundJobRecordIsUsed(const CFE_ES_BackgroundJobRecord_t *JobRecPtr)
+{
+    return CFE_RESOURCEID_TEST_DEFINED(JobRecPtr->JobId);
+}
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Get the ID value from a background job table entry
+ *
+ * @note This internal helper function must only be used on record pointers
+ * that are known to refer to an actual table location (i.e. non-null).
+ *
+ * @param[in]   JobRecPtr   pointer to background job table entry
+ * @returns JobID of entry
+ */
+static inline CFE_ES_BackgroundJobId_t CFE_ES_BackgroundJobRecordGetID(const CFE_ES_BackgroundJobRecord_t *JobRecPtr)
+{
+    return JobRecPtr->JobId;
+}
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Marks a background job table entry as used (not free)
+ *
+ * As this dereferences fields within the record, global data must be
+ * locked prior to invoking this function.
+ *
+ * @note This internal helper function must only be used on record pointers
+ * that are known to refer to an actual table location (i.e. non-null).
+ *
+ * @param[in]   JobRecPtr   pointer to background job table entry
+ * @param[in]   PendingId   the job ID of this entry
+ */
+static inline void CFE_ES_BackgroundJobRecordSetUsed(CFE_ES_BackgroundJobRecord_t *JobRecPtr,
+                                                     CFE_ResourceId_t              PendingId)
+{
+    JobRecPtr->JobId = CFE_ES_BGJOBID_C(PendingId);
+}
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Set a background job record table entry free (not used)
+ *
+ * As this dereferences fields within the record, global data must be
+ * locked prior to invoking this function.
+ *
+ * @note This internal helper function must only be used on record pointers
+ * that are known to refer to an actual table location (i.e. non-null).
+ *
+ * @param[in]   JobRecPtr   pointer to background job table entry
+ */
+static inline void CFE_ES_BackgroundJobRecordSetFree(CFE_ES_BackgroundJobRecord_t *JobRecPtr)
+{
+    JobRecPtr->JobId = CFE_ES_BGJOBID_UNDEFINED;
+}
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Check if a background job record is a match for the given JobID
+ *
+ * As this dereferences fields within the record, global data must be
+ * locked prior to invoking this function.
+ *
+ * The record pointer is permitted to be NULL, so this may be used directly
+ * on the result of CFE_ES_LocateBackgroundJobRecordByID().
+ *
+ * @sa CFE_ES_LocateBackgroundJobRecordByID
+ *
+ * @param[in]   JobRecPtr   pointer to background job table entry
+ * @param[in]   JobID       expected job ID
+ * @returns true if the entry matches the given job ID
+ */
+static inline bool CFE_ES_BackgroundJobRecordIsMatch(const CFE_ES_BackgroundJobRecord_t *JobRecPtr,
+                                                     CFE_ES_BackgroundJobId_t            JobID)
+{
+    return (JobRecPtr != NULL && CFE_RESOURCEID_TEST_EQUAL(JobRecPtr->JobId, JobID));
+}
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Obtain the name associated with the background job record
+ *
+ * @note This internal helper function must only be used on record pointers
+ * that are known to refer to an actual table location (i.e. non-null).
+ *
+ * @param[in]   JobRecPtr   pointer to background job table entry
+ * @returns Pointer to job name
+ */
+static inline const char *CFE_ES_BackgroundJobRecordGetName(const CFE_ES_BackgroundJobRecord_t *JobRecPtr)
+{
+    return JobRecPtr->JobName;
+}
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * Locate and validate the app record for the calling context.
@@ -777,6 +966,17 @@ CFE_ES_TaskRecord_t *CFE_ES_LocateTaskRecordByName(const char *Name);
  */
 CFE_ES_GenCounterRecord_t *CFE_ES_LocateCounterRecordByName(const char *Name);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Finds a background job table record matching the given name
+ *
+ * Helper function, aids in finding a background job record from a name string.
+ * Must be called while locked.
+ *
+ * @returns pointer to table entry matching name, or NULL if not found
+ */
+CFE_ES_BackgroundJobRecord_t *CFE_ES_LocateBackgroundJobRecordByName(const char *Name);
+
 /*
  * Availability check functions used in conjunction with CFE_ResourceId_FindNext()
  */
@@ -814,4 +1014,15 @@ bool CFE_ES_CheckLibIdSlotUsed(CFE_ResourceId_t CheckId);
  */
 bool CFE_ES_CheckCounterIdSlotUsed(CFE_ResourceId_t CheckId);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Checks if Background Job slot is currently used
+ *
+ * Helper function, Aids in allocating a new ID by checking if
+ * a given ID is available.  Must be called while locked.
+ *
+ * @returns false if slot is unused/available, true if used/unavailable
+ */
+bool CFE_ES_CheckBackgroundJobIdSlotUsed(CFE_ResourceId_t CheckId);
+
 #endif /* CFE_ES_RESOURCE_H */
@@ -80,6 +80,11 @@ void CFE_ES_Main(uint32 StartType, uint32 StartSubtype, uint32 ModeId, const cha
      */
     memset(&CFE_ES_Global, 0, sizeof(CFE_ES_Global));
 
+    /*
+    ** All startup timeline entries are relative to this point
+    */
+    CFE_PSP_GetTime(&CFE_ES_Global.StartupState.StartTime);
+
     /*
     ** Indicate that the CFE is the earliest initialization state
     */
@@ -151,6 +156,41 @@ void CFE_ES_Main(uint32 StartType, uint32 StartSubtype, uint32 ModeId, const cha
         return;
     }
 
+    /*
+    ** Set up the performance marker statistics
+    */
+    CFE_ES_PerfStatsInit();
+
+    /*
+    ** Start the shared data lock profiler, if enabled in this build
+    */
+    CFE_ES_LockProfileInit();
+
+    /*
+    ** Create the semaphore used to wake this task when apps change state during
+    ** startup.  This is not essential, without it the startup sync just polls.
+    */
+    OsStatus = OS_BinSemCreate(&CFE_ES_Global.StartupState.SyncSem, "ES_STARTUP_SYNC", 0, 0);
+    if (OsStatus != OS_SUCCESS)
+    {
+        CFE_ES_SysLogWrite_Unsync("%s: Error: ES Startup Sync Semaphore could not be created. RC=%ld\n", __func__,
+                                  (long)OsStatus);
+    }
+
+    /*
+    ** Create the condition variable that wakes tasks waiting for the system state
+    ** or for their own task record.  Without it those waits fall back to polling.
+    */
+    OsStatus = OS_CondVarCreate(&CFE_ES_Global.StartupState.StateCondVar, "ES_STATE_CV", 0);
+    if (OsStatus != OS_SUCCESS)
+    {
+        CFE_ES_SysLogWrite_Unsync("%s: Error: ES State Condition Variable could not be created. RC=%ld\n", __func__,
+                                  (long)OsStatus);
+    }
+
+    CFE_ES_Global.StartupState.Timeline.ResetType    = CFE_ES_Global.ResetDataPtr->ResetVars.ResetType;
+    CFE_ES_Global.StartupState.Timeline.ResetSubtype = CFE_ES_Global.ResetDataPtr->ResetVars.ResetSubtype;
+
     /*
     ** Announce the startup
     */
@@ -169,27 +209,29 @@ void CFE_ES_Main(uint32 StartType, uint32 StartSubtype, uint32 ModeId, const cha
     /*
     ** Initialize the Last Id
     */
-    CFE_ES_Global.LastAppId     = CFE_ResourceId_FromInteger(CFE_ES_APPID_BASE);
-    CFE_ES_Global.LastLibId     = CFE_ResourceId_FromInteger(CFE_ES_LIBID_BASE);
-    CFE_ES_Global.LastCounterId = CFE_ResourceId_FromInteger(CFE_ES_COUNTID_BASE);
-    CFE_ES_Global.LastMemPoolId = CFE_ResourceId_FromInteger(CFE_ES_POOLID_BASE);
+    CFE_ES_Global.LastAppId           = CFE_ResourceId_FromInteger(CFE_ES_APPID_BASE);
+    CFE_ES_Global.LastLibId           = CFE_ResourceId_FromInteger(CFE_ES_LIBID_BASE);
+    CFE_ES_Global.LastCounterId       = CFE_ResourceId_FromInteger(CFE_ES_COUNTID_BASE);
+    CFE_ES_Global.LastMemPoolId       = CFE_ResourceId_FromInteger(CFE_ES_POOLID_BASE);
+    CFE_ES_Global.LastBackgroundJobId = CFE_ResourceId_FromInteger(CFE_ES_BGJOBID_BASE);
 
     /*
     ** Indicate that the CFE core is now starting up / going multi-threaded
     */
     CFE_ES_WriteToSysLog("%s: CFE_ES_Main entering CORE_STARTUP state\n", __func__);
-    CFE_ES_Global.SystemState = CFE_ES_SystemState_CORE_STARTUP;
+    CFE_ES_SetSystemState(CFE_ES_SystemState_CORE_STARTUP);
 
     /*
     ** Create the tasks, OS objects, and initialize hardware
     */
     CFE_ES_CreateObjects();
+    CFE_ES_StartupTimeMark(&CFE_ES_Global.StartupState.Timeline.CoreReadyMsec);
 
     /*
     ** Indicate that the CFE core is ready
     */
     CFE_ES_WriteToSysLog("%s: CFE_ES_Main entering CORE_READY state\n", __func__);
-    CFE_ES_Global.SystemState = CFE_ES_SystemState_CORE_READY;
+    CFE_ES_SetSystemState(CFE_ES_SystemState_CORE_READY);
 
     /*
     ** Start the cFE Applications from the disk using the file
@@ -209,9 +251,10 @@ void CFE_ES_Main(uint32 StartType, uint32 StartSubtype, uint32 ModeId, const cha
     {
         CFE_ES_WriteToSysLog("%s: Startup Sync failed - Applications may not have all initialized\n", __func__);
     }
+    CFE_ES_StartupTimeMark(&CFE_ES_Global.StartupState.Timeline.AppsInitMsec);
 
     CFE_ES_WriteToSysLog("%s: CFE_ES_Main entering APPS_INIT state\n", __func__);
-    CFE_ES_Global.SystemState = CFE_ES_SystemState_APPS_INIT;
+    CFE_ES_SetSystemState(CFE_ES_SystemState_APPS_INIT);
 
     /*
      * Wait for applications to be "RUNNING" before moving to operational system state.
@@ -229,7 +272,8 @@ void CFE_ES_Main(uint32 StartType, uint32 StartSubtype, uint32 ModeId, const cha
     ** Startup is fully complete
     */
     CFE_ES_WriteToSysLog("%s: CFE_ES_Main entering OPERATIONAL state\n", __func__);
-    CFE_ES_Global.SystemState = CFE_ES_SystemState_OPERATIONAL;
+    CFE_ES_StartupTimeMark(&CFE_ES_Global.StartupState.Timeline.OperationalMsec);
+    CFE_ES_SetSystemState(CFE_ES_SystemState_OPERATIONAL);
 }
 
 /*----------------------------------------------------------------
@@ -725,8 +769,8 @@ void CFE_ES_CreateObjects(void)
                 */
                 CFE_ES_LockSharedData(__func__, __LINE__);
 
-                PendingAppId = CFE_ResourceId_FindNext(CFE_ES_Global.LastAppId, CFE_PLATFORM_ES_MAX_APPLICATIONS,
-                                                       CFE_ES_CheckAppIdSlotUsed);
+                PendingAppId = CFE_ResourceId_FindNextFree(CFE_ES_Global.LastAppId, CFE_PLATFORM_ES_MAX_APPLICATIONS,
+                                                           CFE_ES_Global.AppIdMap, CFE_ES_CheckAppIdSlotUsed);
                 AppRecPtr    = CFE_ES_LocateAppRecordByID(CFE_ES_APPID_C(PendingAppId));
                 if (AppRecPtr != NULL)
                 {
@@ -738,6 +782,8 @@ void CFE_ES_CreateObjects(void)
                     strncpy(AppRecPtr->AppName, CFE_ES_ObjectTable[i].ObjectName, sizeof(AppRecPtr->AppName) - 1);
                     AppRecPtr->AppName[sizeof(AppRecPtr->AppName) - 1] = '\0';
 
+                    CFE_PSP_GetTime(&AppRecPtr->CreateTime);
+
                     /* FileName and EntryPoint is not valid for core apps */
                     AppRecPtr->StartParams.MainTaskInfo.StackSize = CFE_ES_ObjectTable[i].ObjectSize;
                     AppRecPtr->StartParams.MainTaskInfo.Priority  = CFE_ES_ObjectTable[i].ObjectPriority;
@@ -748,6 +794,7 @@ void CFE_ES_CreateObjects(void)
                     */
                     AppRecPtr->ControlReq.AppControlRequest = CFE_ES_RunStatus_APP_RUN;
                     AppRecPtr->ControlReq.AppTimerMsec      = 0;
+                    AppRecPtr->ControlReq.JobWaitMsec       = 0;
 
                     CFE_ES_AppRecordSetUsed(AppRecPtr, CFE_RESOURCEID_RESERVED);
                     CFE_ES_Global.LastAppId = PendingAppId;
@@ -790,6 +837,8 @@ void CFE_ES_CreateObjects(void)
                          * This will set the AppType back to CFE_ES_ResourceType_INVALID (0),
                          * as well as clearing any other data that had been written */
                         memset(AppRecPtr, 0, sizeof(*AppRecPtr));
+                        CFE_ResourceId_MapRelease(PendingAppId, CFE_PLATFORM_ES_MAX_APPLICATIONS,
+                                                  CFE_ES_Global.AppIdMap);
                     }
 
                     CFE_ES_UnlockSharedData(__func__, __LINE__);
@@ -875,16 +924,22 @@ void CFE_ES_CreateObjects(void)
  * Internal helper routine only, not part of API.
  *
  * Waits for all of the applications that CFE has started thus far to
- * reach the indicated state, by polling the app counters in a delay loop.
+ * reach the indicated state.  The app table is checked again whenever an
+ * app changes state (see CFE_ES_StartupSyncNotify), or at least once per
+ * CFE_PLATFORM_ES_STARTUP_SYNC_POLL_MSEC.
  *
  *-----------------------------------------------------------------*/
 int32 CFE_ES_MainTaskSyncDelay(uint32 AppStateId, uint32 TimeOutMilliseconds)
 {
     int32               Status;
+    int32               OsStatus;
     uint32              i;
     uint32              WaitTime;
     uint32              WaitRemaining;
     uint32              AppNotReadyCounter;
+    int64               ElapsedMsec;
+    OS_time_t           WaitStart;
+    OS_time_t           WaitEnd;
     CFE_ES_AppRecord_t *AppRecPtr;
 
     Status        = CFE_ES_OPERATION_TIMED_OUT;
@@ -931,9 +986,199 @@ int32 CFE_ES_MainTaskSyncDelay(uint32 AppStateId, uint32 TimeOutMilliseconds)
             break;
         }
 
-        OS_TaskDelay(WaitTime);
+        CFE_PSP_GetTime(&WaitStart);
+        OsStatus = OS_BinSemTimedWait(CFE_ES_Global.StartupState.SyncSem, WaitTime);
+        if (OsStatus == OS_SUCCESS)
+        {
+            /*
+             * Woken early by an app state change, only charge the time actually
+             * spent waiting.  Always charge at least 1ms so this cannot spin forever.
+             */
+            CFE_PSP_GetTime(&WaitEnd);
+            ElapsedMsec = OS_TimeGetTotalMilliseconds(OS_TimeSubtract(WaitEnd, WaitStart));
+            if (ElapsedMsec < 1)
+            {
+                WaitTime = 1;
+            }
+            else if (ElapsedMsec < WaitTime)
+            {
+                WaitTime = (uint32)ElapsedMsec;
+            }
+        }
+        else if (OsStatus != OS_SEM_TIMEOUT)
+        {
+            /* No usable semaphore, fall back to a plain delay */
+            OS_TaskDelay(WaitTime);
+        }
+
         WaitRemaining -= WaitTime;
     }
 
     return Status;
 }
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_SetSystemState(uint32 NewState)
+{
+    int32 OsStatus;
+
+    /*
+     * The state is changed with the condition variable locked, so a waiter
+     * either sees the new state or is already waiting for the broadcast.
+     */
+    OsStatus                  = OS_CondVarLock(CFE_ES_Global.StartupState.StateCondVar);
+    CFE_ES_Global.SystemState = NewState;
+    if (OsStatus == OS_SUCCESS)
+    {
+        OS_CondVarBroadcast(CFE_ES_Global.StartupState.StateCondVar);
+        OS_CondVarUnlock(CFE_ES_Global.StartupState.StateCondVar);
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_StateBroadcast(void)
+{
+    if (OS_CondVarLock(CFE_ES_Global.StartupState.StateCondVar) == OS_SUCCESS)
+    {
+        OS_CondVarBroadcast(CFE_ES_Global.StartupState.StateCondVar);
+        OS_CondVarUnlock(CFE_ES_Global.StartupState.StateCondVar);
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_ES_StateWait(CFE_ES_StateCheckFunc_t CheckFunc, void *Arg, uint32 TimeOutMilliseconds)
+{
+    osal_id_t CondVar = CFE_ES_Global.StartupState.StateCondVar;
+    OS_time_t Deadline;
+    OS_time_t Now;
+    int64     RemainingMsec;
+    int32     OsStatus;
+    uint32    WaitTime;
+    uint32    WaitRemaining;
+    bool      Satisfied;
+
+    Satisfied     = false;
+    WaitRemaining = TimeOutMilliseconds;
+
+    OsStatus = OS_CondVarLock(CondVar);
+    if (OsStatus == OS_SUCCESS)
+    {
+        OS_GetLocalTime(&Deadline);
+        Deadline = OS_TimeAdd(Deadline, OS_TimeFromTotalMilliseconds(TimeOutMilliseconds));
+
+        while (true)
+        {
+            Satisfied = CheckFunc(Arg);
+            if (Satisfied || OsStatus != OS_SUCCESS)
+            {
+                break;
+            }
+
+            OS_GetLocalTime(&Now);
+            RemainingMsec = OS_TimeGetTotalMilliseconds(OS_TimeSubtract(Deadline, Now));
+            if (RemainingMsec <= 0)
+            {
+                OsStatus = OS_ERROR_TIMEOUT;
+            }
+            else
+            {
+                /* Spurious wakeups are fine, the deadline is absolute */
+                OsStatus = OS_CondVarTimedWait(CondVar, &Deadline);
+            }
+        }
+
+        OS_CondVarUnlock(CondVar);
+
+        /*
+         * If the wait itself failed, poll for whatever time is left
+         */
+        WaitRemaining = 0;
+        if (!Satisfied && OsStatus != OS_ERROR_TIMEOUT)
+        {
+            OS_GetLocalTime(&Now);
+            RemainingMsec = OS_TimeGetTotalMilliseconds(OS_TimeSubtract(Deadline, Now));
+            if (RemainingMsec > 0)
+            {
+                WaitRemaining = (uint32)RemainingMsec;
+            }
+        }
+    }
+
+    while (!Satisfied)
+    {
+        Satisfied = CheckFunc(Arg);
+        if (Satisfied || WaitRemaining == 0)
+        {
+            break;
+        }
+
+        if (WaitRemaining > CFE_PLATFORM_ES_STARTUP_SYNC_POLL_MSEC)
+        {
+            WaitTime = CFE_PLATFORM_ES_STARTUP_SYNC_POLL_MSEC;
+        }
+        else
+        {
+            WaitTime = WaitRemaining;
+        }
+
+        OS_TaskDelay(WaitTime);
+        WaitRemaining -= WaitTime;
+    }
+
+    if (!Satisfied)
+    {
+        return CFE_ES_OPERATION_TIMED_OUT;
+    }
+
+    return CFE_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_StartupSyncNotify(void)
+{
+    if (CFE_ES_Global.SystemState < CFE_ES_SystemState_OPERATIONAL)
+    {
+        OS_BinSemGive(CFE_ES_Global.StartupState.SyncSem);
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_StartupTimeMark(uint32 *MsecPtr)
+{
+    OS_time_t Now;
+    int64     ElapsedMsec;
+
+    CFE_PSP_GetTime(&Now);
+    ElapsedMsec = OS_TimeGetTotalMilliseconds(OS_TimeSubtract(Now, CFE_ES_Global.StartupState.StartTime));
+    if (ElapsedMsec < 1)
+    {
+        ElapsedMsec = 1;
+    }
+
+    *MsecPtr = (uint32)ElapsedMsec;
+}
@@ -57,6 +57,7 @@
 */
 
 typedef int32 (*CFE_ES_EarlyInitFuncPtr_t)(void); /**< \brief Req'd prototype of Early Init Functions */
+typedef bool (*CFE_ES_StateCheckFunc_t)(void *Arg); /**< \brief Condition checked by CFE_ES_StateWait() */
 
 typedef union
 {
@@ -117,4 +118,51 @@ void CFE_ES_InitializeFileSystems(uint32 StartType);
  */
 void CFE_ES_SetupPerfVariables(uint32 ResetType);
 
+/*
+ * Name: CFE_ES_SetSystemState
+ *
+ * Purpose: Advances the overall system state and wakes every task waiting
+ *          on it in CFE_ES_StateWait().
+ */
+void CFE_ES_SetSystemState(uint32 NewState);
+
+/*
+ * Name: CFE_ES_StateWait
+ *
+ * Purpose: Blocks the calling task until CheckFunc returns true or the timeout
+ *          expires.  The condition is checked again on every CFE_ES_StateBroadcast(),
+ *          or polled if the ES state condition variable is not available.
+ *          CheckFunc is called with the condition variable locked, it may take the
+ *          ES shared data lock but must not block otherwise.
+ *
+ *          Returns CFE_SUCCESS, or CFE_ES_OPERATION_TIMED_OUT
+ */
+int32 CFE_ES_StateWait(CFE_ES_StateCheckFunc_t CheckFunc, void *Arg, uint32 TimeOutMilliseconds);
+
+/*
+ * Name: CFE_ES_StateBroadcast
+ *
+ * Purpose: Wakes every task blocked in CFE_ES_StateWait() so it checks its
+ *          condition again.  Must not be called with the ES shared data lock held.
+ */
+void CFE_ES_StateBroadcast(void);
+
+/*
+ * Name: CFE_ES_StartupSyncNotify
+ *
+ * Purpose: Wakes up the ES main task if it is waiting for applications to
+ *          reach a startup state.  Called whenever an application state advances.
+ *          Does nothing once the system is OPERATIONAL.
+ */
+void CFE_ES_StartupSyncNotify(void);
+
+/*
+ * Name: CFE_ES_StartupTimeMark
+ *
+ * Purpose: Records the time elapsed since CFE_ES_Main was entered into a
+ *          startup timeline field, in milliseconds.  A zero elapsed time is
+ *          recorded as 1 so that it is distinguishable from "not reached".
+ */
+void CFE_ES_StartupTimeMark(uint32 *MsecPtr);
+
 #endif /* CFE_ES_START_H */
@@ -44,6 +44,12 @@
 **     The expectation is that the required level of synchronization can be achieved
 **     using the existing ES shared data lock.  However, if it becomes necessary, this
 **     could be replaced with a finer grained syslog-specific lock.
+**
+**     CFE_ES_WriteToSysLog() does not take the lock in the common case.  Messages are
+**     formatted into a staging ring (CFE_ES_SysLogStage()) and committed to the log
+**     under the lock by the ES background task.  On compilers without the __atomic
+**     builtins the ring falls back to taking the shared data lock for the short
+**     reserve and publish steps only.
 */
 
 /*
@@ -56,6 +62,22 @@
 #include <stdarg.h>
 #include <ctype.h>
 
+/*
+ * Memory ordering for the staging ring counters and entry flags.
+ *
+ * Without the __atomic builtins, all staging ring updates are made while
+ * holding the ES shared data lock, which provides the ordering instead.
+ */
+#ifdef __ATOMIC_ACQUIRE
+#define CFE_ES_SYSLOG_LOAD_ACQUIRE(x)     __atomic_load_n(&(x), __ATOMIC_ACQUIRE)
+#define CFE_ES_SYSLOG_STORE_RELEASE(x, v) __atomic_store_n(&(x), (v), __ATOMIC_RELEASE)
+#else
+#define CFE_ES_SYSLOG_LOAD_ACQUIRE(x)     (x)
+#define CFE_ES_SYSLOG_STORE_RELEASE(x, v) ((x) = (v))
+#endif
+
+#define CFE_ES_SYSLOG_STAGE_MASK (CFE_PLATFORM_ES_SYSLOG_STAGE_ENTRIES - 1)
+
 /*******************************************************************
  *
  * Non-synchronized helper functions
@@ -260,6 +282,16 @@ int32 CFE_ES_SysLogWrite_Unsync(const char *SpecStringPtr, ...)
     CFE_ES_SysLog_vsnprintf(TmpString, sizeof(TmpString), SpecStringPtr, ArgPtr);
     va_end(ArgPtr);
 
+    /*
+     * Anything staged before this message goes into the log first.  The caller
+     * holds the lock, so the background task echoes the staged entries later.
+     */
+    CFE_ES_SysLogCommit_Unsync();
+    if (CFE_ES_Global.SysLogStage.EchoCount != CFE_ES_Global.SysLogStage.CommitCount)
+    {
+        CFE_ES_BackgroundWakeup();
+    }
+
     /* Output the entry to the console */
     OS_printf("%s", TmpString);
 
@@ -269,6 +301,36 @@ int32 CFE_ES_SysLogWrite_Unsync(const char *SpecStringPtr, ...)
     return CFE_ES_SysLogAppend_Unsync(TmpString);
 }
 
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_SysLogCommit_Unsync(void)
+{
+    CFE_ES_SysLogStage_t *     Stage = &CFE_ES_Global.SysLogStage;
+    CFE_ES_SysLogStageEntry_t *Entry;
+    uint32                     Count;
+
+    Count = Stage->CommitCount;
+    while (true)
+    {
+        Entry = &Stage->Entries[Count & CFE_ES_SYSLOG_STAGE_MASK];
+        if (CFE_ES_SYSLOG_LOAD_ACQUIRE(Entry->Ready) == 0)
+        {
+            break;
+        }
+
+        CFE_ES_SysLogAppend_Unsync(Entry->Text);
+
+        /* The entry stays reserved until CFE_ES_SysLogEcho() has copied the text */
+        Entry->Ready = 0;
+        ++Count;
+        CFE_ES_SYSLOG_STORE_RELEASE(Stage->CommitCount, Count);
+    }
+}
+
 /*******************************************************************
  *
  * Additional helper functions
@@ -426,6 +488,224 @@ void CFE_ES_SysLog_vsnprintf(char *Buffer, size_t BufferSize, const char *SpecSt
     }
 }
 
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Reserves the next staging entry, if one is free.  Returns the
+ * number of entries reserved before this one, which identifies the
+ * entry, and whether the ring was empty at the time.
+ *
+ *-----------------------------------------------------------------*/
+static bool CFE_ES_SysLogStageReserve(CFE_ES_SysLogStage_t *Stage, uint32 *CountPtr, bool *WasEmptyPtr)
+{
+    uint32 Count;
+    uint32 Pending;
+
+#ifdef __ATOMIC_ACQUIRE
+    Count = __atomic_load_n(&Stage->ReserveCount, __ATOMIC_RELAXED);
+    do
+    {
+        Pending = Count - CFE_ES_SYSLOG_LOAD_ACQUIRE(Stage->EchoCount);
+        if (Pending >= CFE_PLATFORM_ES_SYSLOG_STAGE_ENTRIES)
+        {
+            return false;
+        }
+    } while (!__atomic_compare_exchange_n(&Stage->ReserveCount, &Count, Count + 1, true, __ATOMIC_ACQUIRE,
+                                          __ATOMIC_RELAXED));
+#else
+    CFE_ES_LockSharedData(__func__, __LINE__);
+    Count   = Stage->ReserveCount;
+    Pending = Count - Stage->EchoCount;
+    if (Pending < CFE_PLATFORM_ES_SYSLOG_STAGE_ENTRIES)
+    {
+        Stage->ReserveCount = Count + 1;
+    }
+    CFE_ES_UnlockSharedData(__func__, __LINE__);
+
+    if (Pending >= CFE_PLATFORM_ES_SYSLOG_STAGE_ENTRIES)
+    {
+        return false;
+    }
+#endif
+
+    *CountPtr    = Count;
+    *WasEmptyPtr = (Pending == 0);
+    return true;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_ES_SysLogStage(const char *SpecStringPtr, va_list ArgPtr)
+{
+    CFE_ES_SysLogStage_t *     Stage = &CFE_ES_Global.SysLogStage;
+    CFE_ES_SysLogStageEntry_t *Entry;
+    uint32                     Count;
+    bool                       WasEmpty;
+
+    if (!Stage->Active || !CFE_ES_SysLogStageReserve(Stage, &Count, &WasEmpty))
+    {
+        return CFE_STATUS_INCORRECT_STATE;
+    }
+
+    Entry = &Stage->Entries[Count & CFE_ES_SYSLOG_STAGE_MASK];
+    CFE_ES_SysLog_vsnprintf(Entry->Text, sizeof(Entry->Text), SpecStringPtr, ArgPtr);
+
+#ifdef __ATOMIC_ACQUIRE
+    CFE_ES_SYSLOG_STORE_RELEASE(Entry->Ready, 1);
+#else
+    CFE_ES_LockSharedData(__func__, __LINE__);
+    Entry->Ready = 1;
+    CFE_ES_UnlockSharedData(__func__, __LINE__);
+#endif
+
+    /*
+     * Only the writer that found the ring empty needs to wake the committer,
+     * anything reserved behind it is picked up in the same pass or the
+     * next active period of the background job.
+     */
+    if (WasEmpty)
+    {
+        CFE_ES_BackgroundWakeup();
+    }
+
+    /*
+     * The message is not in the log yet, so the result of the append is not known.
+     * Report what the append would most likely return based on a snapshot of
+     * the log state, so callers still see CFE_ES_ERR_SYS_LOG_FULL in discard mode.
+     */
+    if (CFE_ES_Global.ResetDataPtr->SystemLogMode == CFE_ES_LogMode_DISCARD &&
+        CFE_ES_Global.ResetDataPtr->SystemLogWriteIdx >= (CFE_PLATFORM_ES_SYSTEM_LOG_SIZE - CFE_TIME_PRINTED_STRING_SIZE))
+    {
+        return CFE_ES_ERR_SYS_LOG_FULL;
+    }
+
+    return CFE_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_SysLogFlush(void)
+{
+    CFE_ES_LockSharedData(__func__, __LINE__);
+    CFE_ES_SysLogCommit_Unsync();
+    CFE_ES_UnlockSharedData(__func__, __LINE__);
+
+    CFE_ES_SysLogEcho();
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Releases the entry identified by *CountPtr after its text was copied,
+ * unless another task already did.  Either way *CountPtr is updated to
+ * the next entry to be echoed.
+ *
+ *-----------------------------------------------------------------*/
+static bool CFE_ES_SysLogEchoRelease(CFE_ES_SysLogStage_t *Stage, uint32 *CountPtr)
+{
+    uint32 Count = *CountPtr;
+    bool   IsReleased;
+
+#ifdef __ATOMIC_ACQUIRE
+    IsReleased = __atomic_compare_exchange_n(&Stage->EchoCount, CountPtr, Count + 1, false, __ATOMIC_RELEASE,
+                                             __ATOMIC_ACQUIRE);
+#else
+    CFE_ES_LockSharedData(__func__, __LINE__);
+    IsReleased = (Stage->EchoCount == Count);
+    if (IsReleased)
+    {
+        Stage->EchoCount = Count + 1;
+    }
+    else
+    {
+        *CountPtr = Stage->EchoCount;
+    }
+    CFE_ES_UnlockSharedData(__func__, __LINE__);
+#endif
+
+    if (IsReleased)
+    {
+        *CountPtr = Count + 1;
+    }
+
+    return IsReleased;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_SysLogEcho(void)
+{
+    CFE_ES_SysLogStage_t *Stage = &CFE_ES_Global.SysLogStage;
+    char                  TmpString[CFE_ES_MAX_SYSLOG_MSG_SIZE];
+    uint32                Count;
+
+    Count = CFE_ES_SYSLOG_LOAD_ACQUIRE(Stage->EchoCount);
+    while (Count != CFE_ES_SYSLOG_LOAD_ACQUIRE(Stage->CommitCount))
+    {
+        /*
+         * The copy is only used if the entry is still unreleased afterwards,
+         * so a concurrent echo of the same entry cannot print it twice, and
+         * a copy of an entry that was already reused is discarded.
+         */
+        memcpy(TmpString, Stage->Entries[Count & CFE_ES_SYSLOG_STAGE_MASK].Text, sizeof(TmpString));
+        if (CFE_ES_SysLogEchoRelease(Stage, &Count))
+        {
+            OS_printf("%s", TmpString);
+        }
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+bool CFE_ES_RunSysLogCommit(uint32 ElapsedTime, void *Arg)
+{
+    CFE_ES_SysLogStage_t *Stage = Arg;
+
+    /* From here on, writers can rely on this job to commit what they stage */
+    Stage->Active = true;
+
+    if (CFE_ES_SYSLOG_LOAD_ACQUIRE(Stage->ReserveCount) != CFE_ES_SYSLOG_LOAD_ACQUIRE(Stage->EchoCount))
+    {
+        CFE_ES_SysLogFlush();
+    }
+
+    /*
+     * Stay active while anything is staged, including entries that were
+     * still being formatted during the commit above.
+     */
+    return (CFE_ES_SYSLOG_LOAD_ACQUIRE(Stage->ReserveCount) != CFE_ES_SYSLOG_LOAD_ACQUIRE(Stage->EchoCount));
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_SysLogStageStop(void)
+{
+    CFE_ES_Global.SysLogStage.Active = false;
+    CFE_ES_SysLogFlush();
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -469,10 +749,13 @@ int32 CFE_ES_SysLogDump(const char *Filename)
          * into the syslog buffer while getting the first block of log data.
          */
         CFE_ES_LockSharedData(__func__, __LINE__);
+        CFE_ES_SysLogCommit_Unsync();
         CFE_ES_SysLogReadStart_Unsync(&Buffer.LogData);
         CFE_ES_SysLogReadData(&Buffer.LogData);
         CFE_ES_UnlockSharedData(__func__, __LINE__);
 
+        CFE_ES_SysLogEcho();
+
         while (Buffer.LogData.BlockSize > 0)
         {
             WritePos = 0;
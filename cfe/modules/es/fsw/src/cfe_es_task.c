@@ -324,6 +324,24 @@ int32 CFE_ES_TaskInit(void)
     CFE_MSG_Init(CFE_MSG_PTR(CFE_ES_Global.TaskData.MemStatsPacket.TelemetryHeader),
                  CFE_SB_ValueToMsgId(CFE_ES_MEMSTATS_TLM_MID), sizeof(CFE_ES_Global.TaskData.MemStatsPacket));
 
+    /*
+    ** Initialize task statistics telemetry packet
+    */
+    CFE_MSG_Init(CFE_MSG_PTR(CFE_ES_Global.TaskData.TaskStatsPacket.TelemetryHeader),
+                 CFE_SB_ValueToMsgId(CFE_ES_TASK_STATS_TLM_MID), sizeof(CFE_ES_Global.TaskData.TaskStatsPacket));
+
+    /*
+    ** Initialize performance marker statistics telemetry packet
+    */
+    CFE_MSG_Init(CFE_MSG_PTR(CFE_ES_Global.TaskData.PerfStatsPacket.TelemetryHeader),
+                 CFE_SB_ValueToMsgId(CFE_ES_PERF_STATS_TLM_MID), sizeof(CFE_ES_Global.TaskData.PerfStatsPacket));
+
+    /*
+    ** Initialize startup timeline telemetry packet
+    */
+    CFE_MSG_Init(CFE_MSG_PTR(CFE_ES_Global.TaskData.StartupPacket.TelemetryHeader),
+                 CFE_SB_ValueToMsgId(CFE_ES_STARTUP_TLM_MID), sizeof(CFE_ES_Global.TaskData.StartupPacket));
+
     /*
     ** Create Software Bus message pipe
     */
@@ -540,6 +558,20 @@ int32 CFE_ES_HousekeepingCmd(const CFE_ES_SendHkCmd_t *data)
     CFE_SB_TimeStampMsg(CFE_MSG_PTR(CFE_ES_Global.TaskData.HkPacket.TelemetryHeader));
     CFE_SB_TransmitMsg(CFE_MSG_PTR(CFE_ES_Global.TaskData.HkPacket.TelemetryHeader), true);
 
+    /*
+    ** Send the busiest performance markers of this housekeeping interval.
+    */
+    CFE_ES_PerfStatsReport(&CFE_ES_Global.TaskData.PerfStatsPacket.Payload);
+    CFE_SB_TimeStampMsg(CFE_MSG_PTR(CFE_ES_Global.TaskData.PerfStatsPacket.TelemetryHeader));
+    CFE_SB_TransmitMsg(CFE_MSG_PTR(CFE_ES_Global.TaskData.PerfStatsPacket.TelemetryHeader), true);
+
+    /*
+    ** Send the startup timeline, it is small and the ground may have missed the boot.
+    */
+    CFE_ES_Global.TaskData.StartupPacket.Payload = CFE_ES_Global.StartupState.Timeline;
+    CFE_SB_TimeStampMsg(CFE_MSG_PTR(CFE_ES_Global.TaskData.StartupPacket.TelemetryHeader));
+    CFE_SB_TransmitMsg(CFE_MSG_PTR(CFE_ES_Global.TaskData.StartupPacket.TelemetryHeader), true);
+
     /*
     ** This command does not affect the command execution counter.
     */
@@ -1264,9 +1296,12 @@ int32 CFE_ES_ClearSysLogCmd(const CFE_ES_ClearSysLogCmd_t *data)
     */
 
     CFE_ES_LockSharedData(__func__, __LINE__);
+    CFE_ES_SysLogCommit_Unsync();
     CFE_ES_SysLogClear_Unsync();
     CFE_ES_UnlockSharedData(__func__, __LINE__);
 
+    CFE_ES_SysLogEcho();
+
     /*
     ** This command will always succeed...
     */
@@ -1614,6 +1649,94 @@ int32 CFE_ES_SendMemPoolStatsCmd(const CFE_ES_SendMemPoolStatsCmd_t *data)
     return CFE_SUCCESS;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_ES_SendTaskStatsCmd(const CFE_ES_SendTaskStatsCmd_t *data)
+{
+    CFE_ES_TaskStatsTlm_Payload_t *Payload = &CFE_ES_Global.TaskData.TaskStatsPacket.Payload;
+    CFE_ES_TaskId_t                TaskList[OS_MAX_TASKS];
+    CFE_ES_TaskRecord_t *          TaskRecPtr;
+    OS_time_t                      Now;
+    OS_time_t                      Interval;
+    uint32                         NumTasks;
+    uint32                         NumPackets;
+    uint32                         i;
+
+    /*
+     * Collect list of active task IDs while locked, the OS is
+     * queried for the statistics of each task while NOT locked.
+     */
+    CFE_ES_LockSharedData(__func__, __LINE__);
+    NumTasks   = 0;
+    TaskRecPtr = CFE_ES_Global.TaskTable;
+    for (i = 0; i < OS_MAX_TASKS; ++i)
+    {
+        if (CFE_ES_TaskRecordIsUsed(TaskRecPtr))
+        {
+            TaskList[NumTasks] = CFE_ES_TaskRecordGetID(TaskRecPtr);
+            ++NumTasks;
+        }
+        ++TaskRecPtr;
+    }
+    CFE_ES_UnlockSharedData(__func__, __LINE__);
+
+    /*
+     * CPU load is relative to the previous sample.  On the first
+     * sample there is no reference so the interval (and load) is zero.
+     */
+    OS_GetLocalTime(&Now);
+    if (OS_TimeGetTotalMilliseconds(CFE_ES_Global.TaskData.TaskStatsSampleTime) == 0)
+    {
+        Interval = OS_TimeFromTotalMilliseconds(0);
+    }
+    else
+    {
+        Interval = OS_TimeSubtract(Now, CFE_ES_Global.TaskData.TaskStatsSampleTime);
+    }
+    CFE_ES_Global.TaskData.TaskStatsSampleTime = Now;
+
+    Payload->TotalTasks         = NumTasks;
+    Payload->SampleIntervalMsec = (uint32)OS_TimeGetTotalMilliseconds(Interval);
+    Payload->FirstEntry         = 0;
+    Payload->NumEntries         = 0;
+    NumPackets                  = 0;
+
+    for (i = 0; i < NumTasks; ++i)
+    {
+        /* a task that exited since the list was collected is skipped */
+        if (CFE_ES_SampleTaskStats(&Payload->TaskStats[Payload->NumEntries], TaskList[i], Interval) == CFE_SUCCESS)
+        {
+            ++Payload->NumEntries;
+        }
+
+        if (Payload->NumEntries == CFE_MISSION_ES_TASK_STATS_MAX_ENTRIES || (i + 1) == NumTasks)
+        {
+            /* Unused entries of a partial packet are cleared */
+            memset(&Payload->TaskStats[Payload->NumEntries], 0,
+                   sizeof(Payload->TaskStats) - (Payload->NumEntries * sizeof(Payload->TaskStats[0])));
+
+            CFE_SB_TimeStampMsg(CFE_MSG_PTR(CFE_ES_Global.TaskData.TaskStatsPacket.TelemetryHeader));
+            CFE_SB_TransmitMsg(CFE_MSG_PTR(CFE_ES_Global.TaskData.TaskStatsPacket.TelemetryHeader), true);
+            ++NumPackets;
+
+            Payload->FirstEntry += Payload->NumEntries;
+
+            Payload->NumEntries = 0;
+        }
+    }
+
+    CFE_ES_Global.TaskData.CommandCounter++;
+    CFE_EVS_SendEvent(CFE_ES_TLM_TASK_STATS_INF_EID, CFE_EVS_EventType_DEBUG,
+                      "Telemetered statistics of %lu tasks in %lu packets", (unsigned long)NumTasks,
+                      (unsigned long)NumPackets);
+
+    return CFE_SUCCESS;
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -1740,6 +1863,96 @@ int32 CFE_ES_DumpCDSRegistryCmd(const CFE_ES_DumpCDSRegistryCmd_t *data)
     return CFE_SUCCESS;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_ES_WriteLockProfileCmd(const CFE_ES_WriteLockProfileCmd_t *data)
+{
+    CFE_FS_Header_t                             FileHeader;
+    osal_id_t                                   FileDescriptor = OS_OBJECT_ID_UNDEFINED;
+    const CFE_ES_WriteLockProfileCmd_Payload_t *CmdPtr         = &data->Payload;
+    char                                        LockProfFilename[OS_MAX_PATH_LEN];
+    uint32                                      NumRecords;
+    int32                                       OsStatus;
+    int32                                       Status;
+
+    if (!CFE_ES_Global.LockProfile.IsEnabled)
+    {
+        CFE_ES_Global.TaskData.CommandErrorCounter++;
+        CFE_EVS_SendEvent(CFE_ES_LOCKPROF_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Cannot write lock profile, profiling is not enabled");
+        return CFE_SUCCESS;
+    }
+
+    /*
+    ** Copy the filename into local buffer with default name/path/extension if not specified
+    */
+    Status = CFE_FS_ParseInputFileNameEx(LockProfFilename, CmdPtr->FileName, sizeof(LockProfFilename),
+                                         sizeof(CmdPtr->FileName), CFE_PLATFORM_ES_DEFAULT_LOCK_PROFILE_FILE,
+                                         CFE_FS_GetDefaultMountPoint(CFE_FS_FileCategory_BINARY_DATA_DUMP),
+                                         CFE_FS_GetDefaultExtension(CFE_FS_FileCategory_BINARY_DATA_DUMP));
+
+    if (Status != CFE_SUCCESS)
+    {
+        CFE_ES_Global.TaskData.CommandErrorCounter++;
+        CFE_EVS_SendEvent(CFE_ES_LOCKPROF_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Error parsing lock profile filename, Status=0x%08X", (unsigned int)Status);
+        return CFE_SUCCESS;
+    }
+
+    /* Create a new file, overwriting anything that may have existed previously */
+    OsStatus =
+        OS_OpenCreate(&FileDescriptor, LockProfFilename, OS_FILE_FLAG_CREATE | OS_FILE_FLAG_TRUNCATE, OS_WRITE_ONLY);
+
+    if (OsStatus != OS_SUCCESS)
+    {
+        CFE_ES_Global.TaskData.CommandErrorCounter++;
+        CFE_EVS_SendEvent(CFE_ES_LOCKPROF_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Error creating lock profile file '%s', Status=%ld", LockProfFilename, (long)OsStatus);
+        return CFE_SUCCESS;
+    }
+
+    CFE_FS_InitHeader(&FileHeader, CFE_ES_LOCKPROF_DESC, CFE_FS_SubType_ES_LOCKPROFILE);
+
+    Status = CFE_FS_WriteHeader(FileDescriptor, &FileHeader);
+    if (Status != sizeof(CFE_FS_Header_t))
+    {
+        OS_close(FileDescriptor);
+        CFE_ES_Global.TaskData.CommandErrorCounter++;
+        CFE_EVS_SendEvent(CFE_ES_WRITE_CFE_HDR_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Error writing cFE File Header to '%s', Status=0x%08X", LockProfFilename,
+                          (unsigned int)Status);
+        return CFE_SUCCESS;
+    }
+
+    OsStatus = CFE_ES_LockProfileWriteData(FileDescriptor, &NumRecords);
+    OS_close(FileDescriptor);
+
+    if (OsStatus != OS_SUCCESS)
+    {
+        CFE_ES_Global.TaskData.CommandErrorCounter++;
+        CFE_EVS_SendEvent(CFE_ES_LOCKPROF_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Error writing lock profile to '%s', Status=%ld", LockProfFilename, (long)OsStatus);
+        return CFE_SUCCESS;
+    }
+
+    /* The statistics are only cleared once they have been saved */
+    if (CmdPtr->ResetStats != 0)
+    {
+        CFE_ES_LockProfileReset();
+    }
+
+    CFE_ES_Global.TaskData.CommandCounter++;
+    CFE_EVS_SendEvent(CFE_ES_LOCKPROF_INF_EID, CFE_EVS_EventType_DEBUG,
+                      "Lock profile written to '%s', Records=%lu, Reset=%u", LockProfFilename,
+                      (unsigned long)NumRecords, (unsigned int)(CmdPtr->ResetStats != 0));
+
+    return CFE_SUCCESS;
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -59,6 +59,7 @@
 #define CFE_ES_APP_LOG_DESC  "ES Application Info file"
 #define CFE_ES_ER_LOG_DESC   "ES ERlog data file"
 #define CFE_ES_PERF_LOG_DESC "ES Performance data file"
+#define CFE_ES_LOCKPROF_DESC "ES Lock Profile file"
 
 /*
  * Limit for the total number of entries that may be
@@ -113,6 +114,27 @@ int32 CFE_ES_BackgroundInit(void);
  */
 void CFE_ES_BackgroundTask(void);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief ES background worker task main function
+ *
+ * Purpose: Additional tasks that share the background jobs with
+ * CFE_ES_BackgroundTask(), see CFE_PLATFORM_ES_BACKGROUND_WORKER_TASKS.
+ */
+void CFE_ES_BackgroundWorkerTask(void);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Delete all background jobs registered by an application
+ *
+ * Purpose: Called as part of the application cleanup.  If a worker is calling
+ * one of the jobs, this waits a bounded time for that call to return.
+ *
+ * \retval #CFE_SUCCESS            if no job of the app is being called anymore
+ * \retval #CFE_ES_APP_CLEANUP_ERR if a job is still being called, the app code must stay loaded
+ */
+int32 CFE_ES_BackgroundCleanUpApp(CFE_ES_AppId_t AppId);
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * \brief Exit/Stop the background task
@@ -261,12 +283,24 @@ int32 CFE_ES_SetPerfTriggerMaskCmd(const CFE_ES_SetPerfTriggerMaskCmd_t *data);
  */
 int32 CFE_ES_SendMemPoolStatsCmd(const CFE_ES_SendMemPoolStatsCmd_t *data);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief  Telemeter Task Statistics
+ */
+int32 CFE_ES_SendTaskStatsCmd(const CFE_ES_SendTaskStatsCmd_t *data);
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * \brief  Dump CDS Registry to a file
  */
 int32 CFE_ES_DumpCDSRegistryCmd(const CFE_ES_DumpCDSRegistryCmd_t *data);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief  Write the shared data lock profile to a file
+ */
+int32 CFE_ES_WriteLockProfileCmd(const CFE_ES_WriteLockProfileCmd_t *data);
+
 /*
 ** Message Handler Helper Functions
 */
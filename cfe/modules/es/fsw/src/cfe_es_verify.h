@@ -53,6 +53,26 @@
 #error CFE_PLATFORM_ES_SYSTEM_LOG_SIZE cannot be less than 512 Bytes!
 #endif
 
+#if CFE_PLATFORM_ES_SYSLOG_STAGE_ENTRIES < 2
+#error CFE_PLATFORM_ES_SYSLOG_STAGE_ENTRIES cannot be less than 2!
+#elif (CFE_PLATFORM_ES_SYSLOG_STAGE_ENTRIES & (CFE_PLATFORM_ES_SYSLOG_STAGE_ENTRIES - 1)) != 0
+#error CFE_PLATFORM_ES_SYSLOG_STAGE_ENTRIES must be a power of two!
+#endif
+
+#if CFE_PLATFORM_ES_STARTUP_LOADER_TASKS < 1
+#error CFE_PLATFORM_ES_STARTUP_LOADER_TASKS cannot be less than 1!
+#endif
+
+#if CFE_PLATFORM_ES_MAX_BACKGROUND_JOBS < 5
+#error CFE_PLATFORM_ES_MAX_BACKGROUND_JOBS cannot be less than 5!
+#elif CFE_PLATFORM_ES_MAX_BACKGROUND_JOBS > 65535
+#error CFE_PLATFORM_ES_MAX_BACKGROUND_JOBS cannot be greater than 65535!
+#endif
+
+#if CFE_PLATFORM_ES_BACKGROUND_WORKER_TASKS < 1
+#error CFE_PLATFORM_ES_BACKGROUND_WORKER_TASKS cannot be less than 1!
+#endif
+
 #if CFE_PLATFORM_ES_DEFAULT_STACK_SIZE < 2048
 #error CFE_PLATFORM_ES_DEFAULT_STACK_SIZE cannot be less than 2048 Bytes!
 #endif
@@ -117,6 +137,28 @@
 #error CFE_PLATFORM_ES_USER_RESERVED_SIZE cannot be greater than UINT32_MAX (4 Gigabytes)!
 #endif
 
+/*
+** Memory pool block sizes
+*/
+#if CFE_PLATFORM_ES_POOL_MAX_BUCKETS < 1
+#error CFE_PLATFORM_ES_POOL_MAX_BUCKETS cannot be less than 1!
+#elif CFE_PLATFORM_ES_POOL_MAX_BUCKETS > 32
+#error CFE_PLATFORM_ES_POOL_MAX_BUCKETS cannot be greater than 32!
+#endif
+
+/*
+** Per-task memory pool caches
+*/
+#if CFE_PLATFORM_ES_MEMPOOL_TASK_CACHES < 1
+#error CFE_PLATFORM_ES_MEMPOOL_TASK_CACHES cannot be less than 1!
+#endif
+
+#if CFE_PLATFORM_ES_MEMPOOL_TASK_CACHE_DEPTH < 2
+#error CFE_PLATFORM_ES_MEMPOOL_TASK_CACHE_DEPTH cannot be less than 2!
+#elif CFE_PLATFORM_ES_MEMPOOL_TASK_CACHE_DEPTH > 255
+#error CFE_PLATFORM_ES_MEMPOOL_TASK_CACHE_DEPTH cannot be greater than 255!
+#endif
+
 /*
 ** SysLog mode
 */
@@ -140,6 +182,56 @@
 #error CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE cannot be less than 1025 entries!
 #endif
 
+#if CFE_PLATFORM_ES_PERF_DUMP_BLOCK_ENTRIES < 1
+#error CFE_PLATFORM_ES_PERF_DUMP_BLOCK_ENTRIES cannot be less than 1!
+#elif CFE_PLATFORM_ES_PERF_DUMP_BLOCK_ENTRIES > CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE
+#error CFE_PLATFORM_ES_PERF_DUMP_BLOCK_ENTRIES cannot be greater than CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE!
+#endif
+
+/*
+** Performance marker statistics
+*/
+#if CFE_PLATFORM_ES_PERF_STATS_MAX_NESTING < 1
+#error CFE_PLATFORM_ES_PERF_STATS_MAX_NESTING cannot be less than 1!
+#endif
+
+#if CFE_PLATFORM_ES_PERF_STATS_MARKERS_PER_TASK < 1
+#error CFE_PLATFORM_ES_PERF_STATS_MARKERS_PER_TASK cannot be less than 1!
+#elif CFE_PLATFORM_ES_PERF_STATS_MARKERS_PER_TASK > CFE_MISSION_ES_PERF_MAX_IDS
+#error CFE_PLATFORM_ES_PERF_STATS_MARKERS_PER_TASK cannot be greater than CFE_MISSION_ES_PERF_MAX_IDS!
+#elif (CFE_PLATFORM_ES_PERF_STATS_MARKERS_PER_TASK & (CFE_PLATFORM_ES_PERF_STATS_MARKERS_PER_TASK - 1)) != 0
+#error CFE_PLATFORM_ES_PERF_STATS_MARKERS_PER_TASK must be a power of two!
+#endif
+
+#if CFE_MISSION_ES_PERF_STATS_TOP_N < 1
+#error CFE_MISSION_ES_PERF_STATS_TOP_N cannot be less than 1!
+#elif CFE_MISSION_ES_PERF_STATS_TOP_N > CFE_MISSION_ES_PERF_MAX_IDS
+#error CFE_MISSION_ES_PERF_STATS_TOP_N cannot be greater than CFE_MISSION_ES_PERF_MAX_IDS!
+#endif
+
+#if CFE_MISSION_ES_PERF_STATS_HIST_BINS < 2
+#error CFE_MISSION_ES_PERF_STATS_HIST_BINS cannot be less than 2!
+#elif CFE_MISSION_ES_PERF_STATS_HIST_BINS > 33
+#error CFE_MISSION_ES_PERF_STATS_HIST_BINS cannot be greater than 33!
+#endif
+
+/*
+** Shared data lock profiling
+*/
+#if CFE_PLATFORM_ES_LOCK_PROFILE_SITES < 1
+#error CFE_PLATFORM_ES_LOCK_PROFILE_SITES cannot be less than 1!
+#elif CFE_PLATFORM_ES_LOCK_PROFILE_SITES > 1024
+#error CFE_PLATFORM_ES_LOCK_PROFILE_SITES cannot be greater than 1024!
+#elif (CFE_PLATFORM_ES_LOCK_PROFILE_SITES & (CFE_PLATFORM_ES_LOCK_PROFILE_SITES - 1)) != 0
+#error CFE_PLATFORM_ES_LOCK_PROFILE_SITES must be a power of two!
+#endif
+
+#if CFE_MISSION_ES_LOCK_PROFILE_NAME_LEN < 8
+#error CFE_MISSION_ES_LOCK_PROFILE_NAME_LEN cannot be less than 8!
+#elif (CFE_MISSION_ES_LOCK_PROFILE_NAME_LEN % 4) != 0
+#error CFE_MISSION_ES_LOCK_PROFILE_NAME_LEN must be a multiple of 4!
+#endif
+
 /*
 ** Maximum number of Registered CDS blocks
 */
@@ -82,8 +82,15 @@ typedef struct
     uint8              Data[(sizeof(CFE_ES_GenPoolBD_t) * 4) + 157]; /* oddball size */
 } CFE_ES_GMP_IndirectBuffer_t;
 
+typedef union
+{
+    CFE_ES_PoolAlign_t Align; /* make aligned */
+    uint8              Data[2048];
+} CFE_ES_GMP_ArenaBuffer_t;
+
 CFE_ES_GMP_DirectBuffer_t   UT_MemPoolDirectBuffer;
 CFE_ES_GMP_IndirectBuffer_t UT_MemPoolIndirectBuffer;
+CFE_ES_GMP_ArenaBuffer_t    UT_MemPoolArenaBuffer;
 
 /* Create a startup script buffer for a maximum of 5 lines * 80 chars/line */
 char StartupScript[MAX_STARTUP_SCRIPT];
@@ -139,9 +146,13 @@ static const UT_TaskPipeDispatchId_t UT_TPID_CFE_ES_CMD_SEND_MEM_POOL_STATS_CC =
     .MsgId = CFE_SB_MSGID_WRAP_VALUE(CFE_ES_CMD_MID), .CommandCode = CFE_ES_SEND_MEM_POOL_STATS_CC};
 static const UT_TaskPipeDispatchId_t UT_TPID_CFE_ES_CMD_DUMP_CDS_REGISTRY_CC = {
     .MsgId = CFE_SB_MSGID_WRAP_VALUE(CFE_ES_CMD_MID), .CommandCode = CFE_ES_DUMP_CDS_REGISTRY_CC};
+static const UT_TaskPipeDispatchId_t UT_TPID_CFE_ES_CMD_SEND_TASK_STATS_CC = {
+    .MsgId = CFE_SB_MSGID_WRAP_VALUE(CFE_ES_CMD_MID), .CommandCode = CFE_ES_SEND_TASK_STATS_CC};
+static const UT_TaskPipeDispatchId_t UT_TPID_CFE_ES_CMD_WRITE_LOCK_PROFILE_CC = {
+    .MsgId = CFE_SB_MSGID_WRAP_VALUE(CFE_ES_CMD_MID), .CommandCode = CFE_ES_WRITE_LOCK_PROFILE_CC};
 
 static const UT_TaskPipeDispatchId_t UT_TPID_CFE_ES_CMD_INVALID_CC = {.MsgId = CFE_SB_MSGID_WRAP_VALUE(CFE_ES_CMD_MID),
-                                                                      .CommandCode = CFE_ES_DUMP_CDS_REGISTRY_CC + 2};
+                                                                      .CommandCode = CFE_ES_WRITE_LOCK_PROFILE_CC + 1};
 
 static const UT_TaskPipeDispatchId_t UT_TPID_CFE_ES_SEND_HK = {.MsgId = CFE_SB_MSGID_WRAP_VALUE(CFE_ES_SEND_HK_MID)};
 
@@ -394,6 +405,12 @@ int32 ES_UT_PoolDirectCommit(CFE_ES_GenPoolRecord_t *PoolRecPtr, size_t Offset,
     return CFE_SUCCESS;
 }
 
+int32 ES_UT_PoolArenaRetrieve(CFE_ES_GenPoolRecord_t *PoolRecPtr, size_t Offset, CFE_ES_GenPoolBD_t **BdPtr)
+{
+    *BdPtr = (CFE_ES_GenPoolBD_t *)((void *)&UT_MemPoolArenaBuffer.Data[Offset]);
+    return CFE_SUCCESS;
+}
+
 int32 ES_UT_PoolIndirectRetrieve(CFE_ES_GenPoolRecord_t *PoolRecPtr, size_t Offset, CFE_ES_GenPoolBD_t **BdPtr)
 {
     memcpy(&UT_MemPoolIndirectBuffer.BD, &UT_MemPoolIndirectBuffer.Data[Offset], sizeof(CFE_ES_GenPoolBD_t));
@@ -587,6 +604,59 @@ typedef struct
     uint32 AppState;
 } ES_UT_SetAppStateHook_t;
 
+/*
+ * Records the name of the first module loaded
+ */
+static int32 ES_UT_FirstModuleLoadHook(void *UserObj, int32 StubRetcode, uint32 CallCount,
+                                       const UT_StubContext_t *Context)
+{
+    char *      FirstName  = UserObj;
+    const char *ModuleName = UT_Hook_GetArgValueByName(Context, "module_name", const char *);
+
+    if (FirstName[0] == 0)
+    {
+        strncpy(FirstName, ModuleName, OS_MAX_API_NAME - 1);
+    }
+
+    return StubRetcode;
+}
+
+/*
+ * Advances the system state while a task is waiting on the state condition variable
+ */
+static int32 ES_UT_AdvanceSystemStateHook(void *UserObj, int32 StubRetcode, uint32 CallCount,
+                                          const UT_StubContext_t *Context)
+{
+    CFE_ES_Global.SystemState = *((uint32 *)UserObj);
+    return StubRetcode;
+}
+
+/*
+ * Frees the app record, as if the app was deleted while the task info was being obtained
+ */
+static int32 ES_UT_FreeAppRecordHook(void *UserObj, int32 StubRetcode, uint32 CallCount,
+                                     const UT_StubContext_t *Context)
+{
+    CFE_ES_AppRecordSetFree((CFE_ES_AppRecord_t *)UserObj);
+    return StubRetcode;
+}
+
+/*
+ * Counts console output made while the ES shared data lock is held
+ */
+static int32 ES_UT_CountLockedPrintfHook(void *UserObj, int32 StubRetcode, uint32 CallCount,
+                                         const UT_StubContext_t *Context)
+{
+    uint32 *LockedCount = UserObj;
+
+    if (UT_GetStubCount(UT_KEY(OS_MutSemTake)) != UT_GetStubCount(UT_KEY(OS_MutSemGive)))
+    {
+        ++(*LockedCount);
+    }
+
+    return StubRetcode;
+}
+
 static int32 ES_UT_SetAppStateHook(void *UserObj, int32 StubRetcode, uint32 CallCount, const UT_StubContext_t *Context)
 {
     ES_UT_SetAppStateHook_t *StateHook = UserObj;
@@ -627,14 +697,21 @@ void UtTest_Setup(void)
     UT_ADD_TEST(TestERLog);
     UT_ADD_TEST(TestTask);
     UT_ADD_TEST(TestPerf);
+    UT_ADD_TEST(TestLockProfile);
+    UT_ADD_TEST(TestTaskPool);
     UT_ADD_TEST(TestAPI);
     UT_ADD_TEST(TestGenericCounterAPI);
     UT_ADD_TEST(TestCDS);
     UT_ADD_TEST(TestGenericPool);
+    UT_ADD_TEST(TestGenericPoolCoalescing);
+    UT_ADD_TEST(TestGenericPoolCache);
     UT_ADD_TEST(TestCDSMempool);
     UT_ADD_TEST(TestESMempool);
+    UT_ADD_TEST(TestESMempoolTaskCache);
     UT_ADD_TEST(TestSysLog);
+    UT_ADD_TEST(TestSysLogStage);
     UT_ADD_TEST(TestBackground);
+    UT_ADD_TEST(TestBackgroundJobs);
     UT_ADD_TEST(TestStatusToString);
 }
 
@@ -654,6 +731,7 @@ void ES_ResetUnitTest(void)
     CFE_ES_Global.LastLibId              = CFE_ResourceId_FromInteger(CFE_ES_LIBID_BASE);
     CFE_ES_Global.LastCounterId          = CFE_ResourceId_FromInteger(CFE_ES_COUNTID_BASE);
     CFE_ES_Global.LastMemPoolId          = CFE_ResourceId_FromInteger(CFE_ES_POOLID_BASE);
+    CFE_ES_Global.LastBackgroundJobId    = CFE_ResourceId_FromInteger(CFE_ES_BGJOBID_BASE);
     CFE_ES_Global.CDSVars.LastCDSBlockId = CFE_ResourceId_FromInteger(CFE_ES_CDSBLOCKID_BASE);
 
     /*
@@ -691,6 +769,16 @@ void TestInit(void)
     UT_SetHookFunction(UT_KEY(OS_TaskCreate), ES_UT_SetAppStateHook, NULL);
     CFE_ES_Main(CFE_PSP_RST_TYPE_POWERON, CFE_PSP_RST_SUBTYPE_POWER_CYCLE, 1, "ut_startup");
     UtAssert_STUB_COUNT(CFE_PSP_Panic, 0);
+
+    /* Every startup phase should be on the timeline */
+    UtAssert_UINT32_EQ(CFE_ES_Global.StartupState.Timeline.ResetType, CFE_PSP_RST_TYPE_POWERON);
+    UtAssert_NONZERO(CFE_ES_Global.StartupState.Timeline.CoreReadyMsec);
+    UtAssert_NONZERO(CFE_ES_Global.StartupState.Timeline.LibsLoadedMsec);
+    UtAssert_NONZERO(CFE_ES_Global.StartupState.Timeline.AppsCreatedMsec);
+    UtAssert_NONZERO(CFE_ES_Global.StartupState.Timeline.AppsInitMsec);
+    UtAssert_NONZERO(CFE_ES_Global.StartupState.Timeline.OperationalMsec);
+    UtAssert_UINT32_EQ(CFE_ES_Global.StartupState.Timeline.LibsLoaded, 1);
+    UtAssert_UINT32_EQ(CFE_ES_Global.StartupState.Timeline.LoaderTasks, 1);
 }
 
 void TestStartupErrorPaths(void)
@@ -703,6 +791,8 @@ void TestStartupErrorPaths(void)
     CFE_ES_TaskRecord_t *   TaskRecPtr;
     CFE_ES_AppRecord_t *    AppRecPtr;
     void *                  TempBuff;
+    OS_time_t               SyncTimes[64];
+    uint32                  NewState;
 
     UtPrintf("Begin Test Startup Error Paths");
 
@@ -760,6 +850,58 @@ void TestStartupErrorPaths(void)
     CFE_UtAssert_PRINTF(UT_OSP_MESSAGES[UT_OSP_STARTUP_SYNC_FAIL_1]);
     CFE_UtAssert_PRINTF(UT_OSP_MESSAGES[UT_OSP_STARTUP_SYNC_FAIL_2]);
 
+    /* Startup sync failure where the sync semaphore is given early, by a growing amount */
+    ES_ResetUnitTest();
+    for (j = 0; j < (int)(sizeof(SyncTimes) / sizeof(SyncTimes[0])); ++j)
+    {
+        SyncTimes[j] = OS_TimeFromTotalMilliseconds(j * j);
+    }
+    UT_SetDataBuffer(UT_KEY(CFE_PSP_GetTime), SyncTimes, sizeof(SyncTimes), false);
+    UT_SetHookFunction(UT_KEY(OS_TaskCreate), ES_UT_SetAppStateHook, &StateHook);
+    UT_SetReadBuffer(StartupScript, strlen(StartupScript));
+    CFE_ES_Main(CFE_PSP_RST_TYPE_POWERON, 1, 1, "ut_startup");
+    CFE_UtAssert_PRINTF(UT_OSP_MESSAGES[UT_OSP_STARTUP_SYNC_FAIL_1]);
+    CFE_UtAssert_PRINTF(UT_OSP_MESSAGES[UT_OSP_STARTUP_SYNC_FAIL_2]);
+    UtAssert_STUB_COUNT(OS_TaskDelay, 0);
+
+    /* Startup sync failure where the sync semaphore times out */
+    ES_ResetUnitTest();
+    UT_SetDefaultReturnValue(UT_KEY(OS_BinSemTimedWait), OS_SEM_TIMEOUT);
+    UT_SetHookFunction(UT_KEY(OS_TaskCreate), ES_UT_SetAppStateHook, &StateHook);
+    UT_SetReadBuffer(StartupScript, strlen(StartupScript));
+    CFE_ES_Main(CFE_PSP_RST_TYPE_POWERON, 1, 1, "ut_startup");
+    CFE_UtAssert_PRINTF(UT_OSP_MESSAGES[UT_OSP_STARTUP_SYNC_FAIL_1]);
+    UtAssert_STUB_COUNT(OS_TaskDelay, 0);
+
+    /* Startup sync failure without a usable sync semaphore, falls back to polling */
+    ES_ResetUnitTest();
+    UT_SetDeferredRetcode(UT_KEY(OS_BinSemCreate), 1, OS_ERROR);
+    UT_SetDefaultReturnValue(UT_KEY(OS_BinSemTimedWait), OS_ERR_INVALID_ID);
+    UT_SetHookFunction(UT_KEY(OS_TaskCreate), ES_UT_SetAppStateHook, &StateHook);
+    UT_SetReadBuffer(StartupScript, strlen(StartupScript));
+    CFE_ES_Main(CFE_PSP_RST_TYPE_POWERON, 1, 1, "ut_startup");
+    CFE_UtAssert_PRINTF(UT_OSP_MESSAGES[UT_OSP_STARTUP_SYNC_FAIL_1]);
+    UtAssert_NONZERO(UT_GetStubCount(UT_KEY(OS_TaskDelay)));
+
+    /* Startup without a usable state condition variable still reaches operational */
+    ES_ResetUnitTest();
+    UT_SetDeferredRetcode(UT_KEY(OS_CondVarCreate), 1, OS_ERROR);
+    UT_SetDefaultReturnValue(UT_KEY(OS_CondVarLock), OS_ERR_INVALID_ID);
+    UT_SetHookFunction(UT_KEY(OS_TaskCreate), ES_UT_SetAppStateHook, NULL);
+    UT_SetReadBuffer(StartupScript, strlen(StartupScript));
+    CFE_ES_Main(CFE_PSP_RST_TYPE_POWERON, 1, 1, "ut_startup");
+    UtAssert_UINT32_EQ(CFE_ES_Global.SystemState, CFE_ES_SystemState_OPERATIONAL);
+    UtAssert_STUB_COUNT(OS_CondVarBroadcast, 0);
+
+    /* App state changes only wake the startup sync until the system is operational */
+    ES_ResetUnitTest();
+    CFE_ES_Global.SystemState = CFE_ES_SystemState_APPS_INIT;
+    CFE_ES_StartupSyncNotify();
+    UtAssert_STUB_COUNT(OS_BinSemGive, 1);
+    CFE_ES_Global.SystemState = CFE_ES_SystemState_OPERATIONAL;
+    CFE_ES_StartupSyncNotify();
+    UtAssert_STUB_COUNT(OS_BinSemGive, 1);
+
     /* Perform a power on reset with a hardware special sub-type */
     ES_ResetUnitTest();
     CFE_ES_SetupResetVariables(CFE_PSP_RST_TYPE_POWERON, CFE_PSP_RST_SUBTYPE_HW_SPECIAL_COMMAND, 1);
@@ -977,13 +1119,13 @@ void TestStartupErrorPaths(void)
     /* Test reading the object table where all app slots are taken */
     ES_ResetUnitTest();
 
-    UT_SetDefaultReturnValue(UT_KEY(CFE_ResourceId_FindNext), OS_ERROR);
+    UT_SetDefaultReturnValue(UT_KEY(CFE_ResourceId_FindNextFree), OS_ERROR);
     CFE_ES_CreateObjects();
     CFE_UtAssert_PRINTF(UT_OSP_MESSAGES[UT_OSP_NO_FREE_CORE_APP_SLOTS]);
 
     /* Test reading the object table with a NULL function pointer */
     ES_ResetUnitTest();
-    UT_SetDefaultReturnValue(UT_KEY(CFE_ResourceId_FindNext), OS_ERROR);
+    UT_SetDefaultReturnValue(UT_KEY(CFE_ResourceId_FindNextFree), OS_ERROR);
     CFE_ES_ObjectTable[1].ObjectType = CFE_ES_FUNCTION_CALL;
     CFE_ES_CreateObjects();
     CFE_UtAssert_PRINTF(UT_OSP_MESSAGES[UT_OSP_NO_FREE_CORE_APP_SLOTS]);
@@ -991,7 +1133,7 @@ void TestStartupErrorPaths(void)
 
     /* Test reading the object table with unknown object type */
     ES_ResetUnitTest();
-    UT_SetDefaultReturnValue(UT_KEY(CFE_ResourceId_FindNext), OS_ERROR);
+    UT_SetDefaultReturnValue(UT_KEY(CFE_ResourceId_FindNextFree), OS_ERROR);
     CFE_ES_ObjectTable[CFE_PLATFORM_ES_OBJECT_TABLE_SIZE - 1].ObjectType = -1;
     CFE_ES_CreateObjects();
     CFE_UtAssert_PRINTF(UT_OSP_MESSAGES[UT_OSP_NO_FREE_CORE_APP_SLOTS]);
@@ -1062,6 +1204,59 @@ void TestStartupErrorPaths(void)
     ES_UT_SetupSingleAppId(CFE_ES_AppType_CORE, CFE_ES_AppState_EARLY_INIT, NULL, &AppRecPtr, NULL);
     CFE_ES_Global.SystemState = CFE_ES_SystemState_EARLY_INIT;
     CFE_UtAssert_SUCCESS(CFE_ES_WaitForSystemState(CFE_ES_SystemState_EARLY_INIT, 0));
+
+    /* Wait that is satisfied by a state change broadcast, no polling */
+    ES_ResetUnitTest();
+    ES_UT_SetupSingleAppId(CFE_ES_AppType_EXTERNAL, CFE_ES_AppState_EARLY_INIT, NULL, &AppRecPtr, NULL);
+    CFE_ES_Global.SystemState = CFE_ES_SystemState_CORE_READY;
+    NewState                  = CFE_ES_SystemState_OPERATIONAL;
+    UT_SetHookFunction(UT_KEY(OS_CondVarTimedWait), ES_UT_AdvanceSystemStateHook, &NewState);
+    CFE_UtAssert_SUCCESS(
+        CFE_ES_WaitForSystemState(CFE_ES_SystemState_OPERATIONAL, CFE_PLATFORM_ES_STARTUP_SCRIPT_TIMEOUT_MSEC));
+    UtAssert_STUB_COUNT(OS_CondVarTimedWait, 1);
+    UtAssert_STUB_COUNT(OS_TaskDelay, 0);
+    UtAssert_UINT32_EQ(AppRecPtr->AppState, CFE_ES_AppState_RUNNING);
+
+    /* Condition variable wait fails, the rest of the timeout is polled */
+    ES_ResetUnitTest();
+    ES_UT_SetupSingleAppId(CFE_ES_AppType_EXTERNAL, CFE_ES_AppState_EARLY_INIT, NULL, &AppRecPtr, NULL);
+    CFE_ES_Global.SystemState = CFE_ES_SystemState_CORE_READY;
+    UT_SetDefaultReturnValue(UT_KEY(OS_CondVarTimedWait), OS_ERROR);
+    UtAssert_INT32_EQ(CFE_ES_WaitForSystemState(CFE_ES_SystemState_OPERATIONAL, 1000), CFE_ES_OPERATION_TIMED_OUT);
+    UtAssert_STUB_COUNT(OS_CondVarTimedWait, 1);
+    UtAssert_NONZERO(UT_GetStubCount(UT_KEY(OS_TaskDelay)));
+
+    /* Condition variable wait fails after the deadline, nothing left to poll */
+    ES_ResetUnitTest();
+    ES_UT_SetupSingleAppId(CFE_ES_AppType_EXTERNAL, CFE_ES_AppState_EARLY_INIT, NULL, &AppRecPtr, NULL);
+    CFE_ES_Global.SystemState = CFE_ES_SystemState_CORE_READY;
+    UT_SetDefaultReturnValue(UT_KEY(OS_CondVarTimedWait), OS_ERROR);
+    UtAssert_INT32_EQ(CFE_ES_WaitForSystemState(CFE_ES_SystemState_OPERATIONAL, 15), CFE_ES_OPERATION_TIMED_OUT);
+    UtAssert_STUB_COUNT(OS_TaskDelay, 0);
+
+    /* No usable condition variable, the whole timeout is polled */
+    ES_ResetUnitTest();
+    ES_UT_SetupSingleAppId(CFE_ES_AppType_EXTERNAL, CFE_ES_AppState_EARLY_INIT, NULL, &AppRecPtr, NULL);
+    CFE_ES_Global.SystemState = CFE_ES_SystemState_CORE_READY;
+    UT_SetDefaultReturnValue(UT_KEY(OS_CondVarLock), OS_ERR_INVALID_ID);
+    UtAssert_INT32_EQ(CFE_ES_WaitForSystemState(CFE_ES_SystemState_OPERATIONAL, 120), CFE_ES_OPERATION_TIMED_OUT);
+    UtAssert_STUB_COUNT(OS_CondVarTimedWait, 0);
+    UtAssert_STUB_COUNT(OS_TaskDelay, 3);
+
+    /* State changes wake all waiters */
+    ES_ResetUnitTest();
+    CFE_ES_SetSystemState(CFE_ES_SystemState_APPS_INIT);
+    UtAssert_UINT32_EQ(CFE_ES_Global.SystemState, CFE_ES_SystemState_APPS_INIT);
+    UtAssert_STUB_COUNT(OS_CondVarBroadcast, 1);
+    UtAssert_STUB_COUNT(OS_CondVarUnlock, 1);
+
+    /* State is still changed without a usable condition variable */
+    ES_ResetUnitTest();
+    UT_SetDefaultReturnValue(UT_KEY(OS_CondVarLock), OS_ERR_INVALID_ID);
+    CFE_ES_SetSystemState(CFE_ES_SystemState_OPERATIONAL);
+    CFE_ES_StateBroadcast();
+    UtAssert_UINT32_EQ(CFE_ES_Global.SystemState, CFE_ES_SystemState_OPERATIONAL);
+    UtAssert_STUB_COUNT(OS_CondVarBroadcast, 0);
 }
 
 static void ES_UT_UnusedAppTask(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
@@ -1097,6 +1292,20 @@ static void ES_UT_SetPerfIdle(void *UserObj, UT_EntryKey_t FuncKey, const UT_Stu
     CFE_ES_Global.ResetDataPtr->Perf.MetaData.State = CFE_ES_PERF_IDLE;
 }
 
+static void ES_UT_TaskGetIdUndefined(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    osal_id_t TaskId = OS_OBJECT_ID_UNDEFINED;
+
+    UT_Stub_SetReturnValue(FuncKey, TaskId);
+}
+
+static void ES_UT_SetTimebase(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    uint32 *Tbl = (uint32 *)Context->ArgPtr[1];
+
+    *Tbl = *((uint32 *)UserObj);
+}
+
 static void ES_UT_ForEachObjectIncrease(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
 {
     OS_ArgCallback_t callback_ptr = UT_Hook_GetArgValueByName(Context, "callback_ptr", OS_ArgCallback_t);
@@ -1145,7 +1354,10 @@ void TestApps(void)
     CFE_ES_MemPoolRecord_t *UtPoolRecPtr;
     char                    NameBuffer[OS_MAX_API_NAME + 5];
     CFE_ES_AppStartParams_t StartParams;
+    OS_task_prop_t          TaskProp;
+    CFE_ES_TaskStats_t      TaskStats;
     int                     ObjCount;
+    uint32                  i;
 
     UtPrintf("Begin Test Apps");
 
@@ -1165,6 +1377,7 @@ void TestApps(void)
     CFE_ES_StartApplications(CFE_PSP_RST_TYPE_PROCESSOR, "ut_startup");
     CFE_UtAssert_PRINTF(UT_OSP_MESSAGES[UT_OSP_FILE_LINE_TOO_LONG]);
     CFE_UtAssert_PRINTF(UT_OSP_MESSAGES[UT_OSP_ES_APP_STARTUP_OPEN]);
+    UtAssert_UINT32_EQ(CFE_ES_Global.StartupState.Timeline.ScriptErrors, 1);
 
     /* Test starting an application where the startup script has extra tokens */
     ES_ResetUnitTest();
@@ -1220,6 +1433,161 @@ void TestApps(void)
     UT_SetHookFunction(UT_KEY(OS_TaskCreate), ES_UT_SetAppStateHook, NULL);
     CFE_ES_StartApplications(CFE_PSP_RST_TYPE_PROCESSOR, "ut_startup");
     CFE_UtAssert_PRINTF(UT_OSP_MESSAGES[UT_OSP_ES_APP_STARTUP_OPEN]);
+    UtAssert_UINT32_EQ(CFE_ES_Global.StartupState.Timeline.LibsLoaded, 1);
+    UtAssert_UINT32_EQ(CFE_ES_Global.StartupState.Timeline.AppsCreated, 3);
+    UtAssert_UINT32_EQ(CFE_ES_Global.StartupState.Timeline.ScriptErrors, 0);
+    UtAssert_UINT32_EQ(CFE_ES_Global.StartupState.Timeline.LoaderTasks, 1);
+    UtAssert_NONZERO(CFE_ES_Global.StartupState.Timeline.LibsLoadedMsec);
+    UtAssert_NONZERO(CFE_ES_Global.StartupState.Timeline.AppsCreatedMsec);
+
+    /* Test that libraries are loaded before any application listed ahead of them */
+    ES_ResetUnitTest();
+    strncpy(StartupScript,
+            "CFE_APP, /cf/apps/ci.bundle, CI_task_main, CI_APP, 70, 4096, 0x0, 1; "
+            "CFE_LIB, /cf/apps/tst_lib.bundle, TST_LIB_Init, TST_LIB, 0, 0, 0x0, 1; !",
+            sizeof(StartupScript) - 1);
+    StartupScript[sizeof(StartupScript) - 1] = '\0';
+    UT_SetReadBuffer(StartupScript, strlen(StartupScript));
+    memset(NameBuffer, 0, sizeof(NameBuffer));
+    UT_SetHookFunction(UT_KEY(OS_ModuleLoad), ES_UT_FirstModuleLoadHook, NameBuffer);
+    CFE_ES_StartApplications(CFE_PSP_RST_TYPE_POWERON, "ut_startup");
+    UtAssert_UINT32_EQ(CFE_ES_Global.StartupState.Timeline.LibsLoaded, 1);
+    UtAssert_UINT32_EQ(CFE_ES_Global.StartupState.Timeline.AppsCreated, 1);
+    UtAssert_STRINGBUF_EQ(NameBuffer, sizeof(NameBuffer), "TST_LIB", -1);
+
+    /* Test the optional CPU affinity token */
+    ES_ResetUnitTest();
+    strncpy(StartupScript, "CFE_APP, /cf/apps/ci.bundle, CI_task_main, CI_APP, 70, 4096, 0x0, 1, 0x3; !",
+            sizeof(StartupScript) - 1);
+    StartupScript[sizeof(StartupScript) - 1] = '\0';
+    UT_SetReadBuffer(StartupScript, strlen(StartupScript));
+    CFE_ES_StartApplications(CFE_PSP_RST_TYPE_POWERON, "ut_startup");
+    UtAssert_UINT32_EQ(CFE_ES_Global.StartupState.Timeline.AppsCreated, 1);
+    UtAssert_UINT32_EQ(CFE_ES_Global.StartupState.Timeline.ScriptErrors, 0);
+    UtAppRecPtr = NULL;
+    for (i = 0; i < CFE_PLATFORM_ES_MAX_APPLICATIONS; ++i)
+    {
+        if (CFE_ES_AppRecordIsUsed(&CFE_ES_Global.AppTable[i]))
+        {
+            UtAppRecPtr = &CFE_ES_Global.AppTable[i];
+        }
+    }
+    UtAssert_NOT_NULL(UtAppRecPtr);
+    if (UtAppRecPtr != NULL)
+    {
+        UtAssert_UINT32_EQ(UtAppRecPtr->StartParams.MainTaskInfo.CpuAffinity, 0x3);
+    }
+
+    /* Test CPU affinity tokens that are out of range or not numeric */
+    ES_ResetUnitTest();
+    strncpy(StartupScript,
+            "CFE_APP, /cf/apps/ci.bundle, CI_task_main, CI_APP, 70, 4096, 0x0, 1, 0x10000; "
+            "CFE_APP, /cf/apps/sch.bundle, SCH_TaskMain, SCH_APP, 120, 4096, 0x0, 1, CPU1; "
+            "CFE_APP, /cf/apps/to.bundle, TO_task_main, TO_APP, 74, 4096, 0x0, 1, 0xFFFF; !",
+            sizeof(StartupScript) - 1);
+    StartupScript[sizeof(StartupScript) - 1] = '\0';
+    UT_SetReadBuffer(StartupScript, strlen(StartupScript));
+    CFE_ES_StartApplications(CFE_PSP_RST_TYPE_POWERON, "ut_startup");
+    UtAssert_UINT32_EQ(CFE_ES_Global.StartupState.Timeline.AppsCreated, 1);
+    UtAssert_UINT32_EQ(CFE_ES_Global.StartupState.Timeline.ScriptErrors, 2);
+
+    /* Test a failing library and a failing application entry */
+    ES_ResetUnitTest();
+    strncpy(StartupScript,
+            "CFE_LIB, /cf/apps/tst_lib.bundle, TST_LIB_Init, TST_LIB, 0, 0, 0x0, 1; "
+            "CFE_APP, /cf/apps/ci.bundle, CI_task_main, CI_APP, 70; !",
+            sizeof(StartupScript) - 1);
+    StartupScript[sizeof(StartupScript) - 1] = '\0';
+    UT_SetReadBuffer(StartupScript, strlen(StartupScript));
+    UT_SetDeferredRetcode(UT_KEY(OS_ModuleLoad), 1, OS_ERROR);
+    CFE_ES_StartApplications(CFE_PSP_RST_TYPE_POWERON, "ut_startup");
+    UtAssert_UINT32_EQ(CFE_ES_Global.StartupState.Timeline.LibsLoaded, 0);
+    UtAssert_UINT32_EQ(CFE_ES_Global.StartupState.Timeline.AppsCreated, 0);
+    UtAssert_UINT32_EQ(CFE_ES_Global.StartupState.Timeline.ScriptErrors, 2);
+
+    /* Restore the valid startup script */
+    strncpy(StartupScript,
+            "CFE_LIB, /cf/apps/tst_lib.bundle, TST_LIB_Init, TST_LIB, 0, 0, 0x0, 1; "
+            "CFE_APP, /cf/apps/ci.bundle, CI_task_main, CI_APP, 70, 4096, 0x0, 1; "
+            "CFE_APP, /cf/apps/sch.bundle, SCH_TaskMain, SCH_APP, 120, 4096, 0x0, 1; "
+            "CFE_APP, /cf/apps/to.bundle, TO_task_main, TO_APP, 74, 4096, 0x0, 1; !",
+            sizeof(StartupScript) - 1);
+    StartupScript[sizeof(StartupScript) - 1] = '\0';
+
+    /* Test a startup script with more applications than can be queued */
+    ES_ResetUnitTest();
+    UT_SetReadBuffer(StartupScript, strlen(StartupScript));
+    CFE_ES_Global.StartupState.NumAppEntries = CFE_PLATFORM_ES_MAX_APPLICATIONS;
+    CFE_ES_ProcessStartupScript(OS_OBJECT_ID_UNDEFINED);
+    UtAssert_UINT32_EQ(CFE_ES_Global.StartupState.NumAppEntries, CFE_PLATFORM_ES_MAX_APPLICATIONS);
+    UtAssert_UINT32_EQ(CFE_ES_Global.StartupState.Timeline.LibsLoaded, 1);
+    UtAssert_UINT32_EQ(CFE_ES_Global.StartupState.Timeline.ScriptErrors, 3);
+
+    /* Test an application line too short to have a name when no more applications can be queued */
+    ES_ResetUnitTest();
+    CFE_ES_SysLogClear_Unsync();
+    strncpy(StartupScript, "CFE_APP; !", sizeof(StartupScript) - 1);
+    StartupScript[sizeof(StartupScript) - 1] = '\0';
+    UT_SetReadBuffer(StartupScript, strlen(StartupScript));
+    CFE_ES_Global.StartupState.NumAppEntries = CFE_PLATFORM_ES_MAX_APPLICATIONS;
+    CFE_ES_ProcessStartupScript(OS_OBJECT_ID_UNDEFINED);
+    UtAssert_UINT32_EQ(CFE_ES_Global.StartupState.Timeline.ScriptErrors, 1);
+    UtAssert_NOT_NULL(strstr(CFE_ES_Global.ResetDataPtr->SystemLog, "line 1 not started"));
+
+    /* Restore the valid startup script */
+    strncpy(StartupScript,
+            "CFE_LIB, /cf/apps/tst_lib.bundle, TST_LIB_Init, TST_LIB, 0, 0, 0x0, 1; "
+            "CFE_APP, /cf/apps/ci.bundle, CI_task_main, CI_APP, 70, 4096, 0x0, 1; "
+            "CFE_APP, /cf/apps/sch.bundle, SCH_TaskMain, SCH_APP, 120, 4096, 0x0, 1; "
+            "CFE_APP, /cf/apps/to.bundle, TO_task_main, TO_APP, 74, 4096, 0x0, 1; !",
+            sizeof(StartupScript) - 1);
+    StartupScript[sizeof(StartupScript) - 1] = '\0';
+
+    /* Test creating the applications with several loader tasks */
+    ES_ResetUnitTest();
+    UT_SetReadBuffer(StartupScript, strlen(StartupScript));
+    CFE_ES_ProcessStartupScript(OS_OBJECT_ID_UNDEFINED);
+    UtAssert_UINT32_EQ(CFE_ES_Global.StartupState.NumAppEntries, 3);
+    CFE_ES_RunStartupLoaders(3);
+    UtAssert_STUB_COUNT(OS_CountSemCreate, 1);
+    UtAssert_STUB_COUNT(OS_CountSemTake, 2);
+    UtAssert_STUB_COUNT(OS_CountSemDelete, 1);
+    UtAssert_UINT32_EQ(CFE_ES_Global.StartupState.Timeline.LoaderTasks, 3);
+    UtAssert_UINT32_EQ(CFE_ES_Global.StartupState.Timeline.AppsCreated, 3);
+    UtAssert_UINT32_EQ(CFE_ES_Global.StartupState.NextAppEntry, 3);
+
+    /* Test a loader task that cannot be created, the others take its share */
+    ES_ResetUnitTest();
+    UT_SetReadBuffer(StartupScript, strlen(StartupScript));
+    CFE_ES_ProcessStartupScript(OS_OBJECT_ID_UNDEFINED);
+    UT_SetDeferredRetcode(UT_KEY(OS_TaskCreate), 1, OS_ERROR);
+    CFE_ES_RunStartupLoaders(3);
+    UtAssert_STUB_COUNT(OS_CountSemTake, 1);
+    UtAssert_UINT32_EQ(CFE_ES_Global.StartupState.Timeline.LoaderTasks, 2);
+    UtAssert_UINT32_EQ(CFE_ES_Global.StartupState.Timeline.AppsCreated, 3);
+
+    /* Test loading without the loader semaphore, the calling task does everything */
+    ES_ResetUnitTest();
+    UT_SetReadBuffer(StartupScript, strlen(StartupScript));
+    CFE_ES_ProcessStartupScript(OS_OBJECT_ID_UNDEFINED);
+    UT_SetDeferredRetcode(UT_KEY(OS_CountSemCreate), 1, OS_ERROR);
+    CFE_ES_RunStartupLoaders(3);
+    UtAssert_STUB_COUNT(OS_TaskCreate, 3);
+    UtAssert_STUB_COUNT(OS_CountSemDelete, 0);
+    UtAssert_UINT32_EQ(CFE_ES_Global.StartupState.Timeline.LoaderTasks, 1);
+    UtAssert_UINT32_EQ(CFE_ES_Global.StartupState.Timeline.AppsCreated, 3);
+
+    /* Test a loader task that finds the first two applications already claimed */
+    ES_ResetUnitTest();
+    UT_SetReadBuffer(StartupScript, strlen(StartupScript));
+    CFE_ES_ProcessStartupScript(OS_OBJECT_ID_UNDEFINED);
+    CFE_ES_Global.StartupState.NextAppEntry = 2;
+    CFE_ES_StartupLoaderTask();
+    UtAssert_STUB_COUNT(OS_CountSemGive, 1);
+    UtAssert_UINT32_EQ(CFE_ES_Global.StartupState.Timeline.AppsCreated, 1);
+    UtAssert_UINT32_EQ(CFE_ES_Global.StartupState.NextAppEntry, 3);
+    UtAssert_NOT_NULL(CFE_ES_LocateAppRecordByName("TO_APP"));
+    UtAssert_NULL(CFE_ES_LocateAppRecordByName("CI_APP"));
 
     /* Test parsing the startup script with an unknown entry type */
     ES_ResetUnitTest();
@@ -1275,7 +1643,7 @@ void TestApps(void)
 
     /* Test application loading and creation where all app slots are taken */
     ES_ResetUnitTest();
-    UT_SetDefaultReturnValue(UT_KEY(CFE_ResourceId_FindNext), OS_ERROR);
+    UT_SetDefaultReturnValue(UT_KEY(CFE_ResourceId_FindNextFree), OS_ERROR);
     ES_UT_SetupAppStartParams(&StartParams, "ut/filename.x", "EntryPoint", 170, 8192, 1);
     UtAssert_INT32_EQ(CFE_ES_AppCreate(&AppId, "AppName", &StartParams), CFE_ES_NO_RESOURCE_IDS_AVAILABLE);
     CFE_UtAssert_PRINTF(UT_OSP_MESSAGES[UT_OSP_NO_FREE_APP_SLOTS]);
@@ -1533,6 +1901,45 @@ void TestApps(void)
     AppId = CFE_ES_AppRecordGetID(UtAppRecPtr);
     CFE_UtAssert_SUCCESS(CFE_ES_GetAppInfo(&AppInfo, AppId));
 
+    /* Test that the scheduler statistics of the main task are reported */
+    ES_ResetUnitTest();
+    ES_UT_SetupSingleAppId(CFE_ES_AppType_EXTERNAL, CFE_ES_AppState_RUNNING, NULL, &UtAppRecPtr, &UtTaskRecPtr);
+    AppId                                 = CFE_ES_AppRecordGetID(UtAppRecPtr);
+    UtTaskRecPtr->StartParams.CpuAffinity = 0x2;
+    memset(&TaskProp, 0, sizeof(TaskProp));
+    TaskProp.migrations           = 5;
+    TaskProp.involuntary_switches = 7;
+    UT_SetDataBuffer(UT_KEY(OS_TaskGetInfo), &TaskProp, sizeof(TaskProp), false);
+    CFE_UtAssert_SUCCESS(CFE_ES_GetAppInfo(&AppInfo, AppId));
+    UtAssert_UINT32_EQ(AppInfo.CpuAffinity, 0x2);
+    UtAssert_UINT32_EQ(AppInfo.Migrations, 5);
+    UtAssert_UINT32_EQ(AppInfo.InvoluntaryCtxSwitches, 7);
+
+    /* Test sampling task statistics relative to the previous sample */
+    ES_ResetUnitTest();
+    ES_UT_SetupSingleAppId(CFE_ES_AppType_EXTERNAL, CFE_ES_AppState_RUNNING, NULL, NULL, &UtTaskRecPtr);
+    TaskId                    = CFE_ES_TaskRecordGetID(UtTaskRecPtr);
+    UtTaskRecPtr->LastCpuTime = OS_TimeFromTotalMilliseconds(50);
+    memset(&TaskProp, 0, sizeof(TaskProp));
+    TaskProp.cpu_time             = OS_TimeFromTotalMilliseconds(75);
+    TaskProp.voluntary_switches   = 4;
+    TaskProp.involuntary_switches = 2;
+    TaskProp.max_run_slice        = OS_TimeFromTotalMicroseconds(1500);
+    UT_SetDataBuffer(UT_KEY(OS_TaskGetInfo), &TaskProp, sizeof(TaskProp), false);
+    CFE_UtAssert_SUCCESS(CFE_ES_SampleTaskStats(&TaskStats, TaskId, OS_TimeFromTotalMilliseconds(100)));
+    CFE_UtAssert_RESOURCEID_EQ(TaskStats.TaskId, TaskId);
+    UtAssert_UINT32_EQ(TaskStats.CpuTimeMsec, 75);
+    UtAssert_UINT32_EQ(TaskStats.CpuLoad, 2500);
+    UtAssert_UINT32_EQ(TaskStats.VoluntaryCtxSwitches, 4);
+    UtAssert_UINT32_EQ(TaskStats.InvoluntaryCtxSwitches, 2);
+    UtAssert_UINT32_EQ(TaskStats.MaxRunSliceUsec, 1500);
+    UtAssert_INT32_EQ(OS_TimeGetTotalMilliseconds(UtTaskRecPtr->LastCpuTime), 75);
+
+    /* Test sampling task statistics of a task that no longer exists */
+    ES_ResetUnitTest();
+    UtAssert_INT32_EQ(CFE_ES_SampleTaskStats(&TaskStats, TaskId, OS_TimeFromTotalMilliseconds(100)),
+                      CFE_ES_ERR_RESOURCEID_NOT_VALID);
+
     /* Two main/child pairs, assert count of child tasks */
     ES_ResetUnitTest();
     ES_UT_SetupSingleAppId(CFE_ES_AppType_EXTERNAL, CFE_ES_AppState_RUNNING, NULL, &UtAppRecPtr, NULL);
@@ -1756,6 +2163,27 @@ void TestApps(void)
         CFE_UtAssert_SUCCESS(CFE_ES_ParseFileEntry(TokenList, 8));
     }
 
+    /* Test parsing the startup script with the optional CPU affinity field */
+    ES_ResetUnitTest();
+    {
+        const char *TokenList[] = {"CFE_APP", "/cf/apps/tst_lib.bundle", "TST_LIB_Init", "TST_LIB", "50", "0", "0x0",
+                                   "0",       "0x3"};
+        CFE_UtAssert_SUCCESS(CFE_ES_ParseFileEntry(TokenList, 9));
+        UtAppRecPtr = NULL;
+        for (i = 0; i < CFE_PLATFORM_ES_MAX_APPLICATIONS; ++i)
+        {
+            if (CFE_ES_AppRecordIsUsed(&CFE_ES_Global.AppTable[i]))
+            {
+                UtAppRecPtr = &CFE_ES_Global.AppTable[i];
+            }
+        }
+        UtAssert_NOT_NULL(UtAppRecPtr);
+        if (UtAppRecPtr != NULL)
+        {
+            UtAssert_UINT32_EQ(UtAppRecPtr->StartParams.MainTaskInfo.CpuAffinity, 0x3);
+        }
+    }
+
     /* Test scanning and acting on the application table where the timer
      * expires for a waiting application
      */
@@ -2023,7 +2451,7 @@ void TestLibs(void)
      * library slots available
      */
     ES_ResetUnitTest();
-    UT_SetDefaultReturnValue(UT_KEY(CFE_ResourceId_FindNext), OS_ERROR);
+    UT_SetDefaultReturnValue(UT_KEY(CFE_ResourceId_FindNextFree), OS_ERROR);
     UtAssert_INT32_EQ(CFE_ES_LoadLibrary(&Id, "LibName", &LoadParams), CFE_ES_NO_RESOURCE_IDS_AVAILABLE);
     CFE_UtAssert_PRINTF(UT_OSP_MESSAGES[UT_OSP_LIBRARY_SLOTS]);
 
@@ -2459,6 +2887,211 @@ void TestGenericPool(void)
     CFE_UtAssert_SUCCESS(CFE_ES_GenPoolRebuild(&Pool1));
 }
 
+void TestGenericPoolCoalescing(void)
+{
+    CFE_ES_GenPoolRecord_t Pool;
+    size_t                 Offset[8];
+    size_t                 SmallOffset1 = 0;
+    size_t                 SmallOffset2 = 0;
+    size_t                 BlockSize    = 0;
+    CFE_ES_MemOffset_t     FreeSize;
+    CFE_ES_MemOffset_t     TotalSize;
+    CFE_ES_BlockStats_t    BlockStats;
+    uint16                 i;
+    static const size_t    UT_POOL_BLOCK_SIZES[] = {4, 12, 48, 128};
+
+    ES_ResetUnitTest();
+
+    /* Test that the size class map selects the same bucket as a plain search would */
+    CFE_UtAssert_SUCCESS(CFE_ES_GenPoolInitialize(&Pool, 0, sizeof(UT_MemPoolArenaBuffer.Data), 16, 4,
+                                                  UT_POOL_BLOCK_SIZES, ES_UT_PoolArenaRetrieve,
+                                                  ES_UT_PoolDirectCommit));
+    UtAssert_UINT32_EQ(Pool.SizeClassMap[0], 0);
+    UtAssert_UINT32_EQ(Pool.SizeClassMap[3], 1);
+    UtAssert_UINT32_EQ(Pool.SizeClassMap[7], 3);
+    UtAssert_UINT32_EQ(Pool.SizeClassMap[8], 4);
+
+    CFE_ES_GenPoolEnableCoalescing(&Pool, (cpuaddr)UT_MemPoolArenaBuffer.Data);
+    UtAssert_BOOL_TRUE(Pool.IsCoalescing);
+
+    /* Rebuild is not supported for coalescing pools */
+    UtAssert_INT32_EQ(CFE_ES_GenPoolRebuild(&Pool), CFE_ES_BAD_ARGUMENT);
+
+    /* Fill the pool with large blocks */
+    for (i = 0; i < 7; ++i)
+    {
+        CFE_UtAssert_SUCCESS(CFE_ES_GenPoolGetBlock(&Pool, &Offset[i], 100));
+        UtAssert_True((Offset[i] & 0xF) == 0, "Offset[%u](%lu) 16 byte alignment", (unsigned int)i,
+                      (unsigned long)Offset[i]);
+        if (i > 0)
+        {
+            UtAssert_UINT32_GTEQ(Offset[i], Offset[i - 1] + 128 + CFE_ES_GENERIC_POOL_ARENA_DESCRIPTOR_SIZE);
+        }
+    }
+    UtAssert_INT32_EQ(CFE_ES_GenPoolGetBlock(&Pool, &Offset[7], 1000), CFE_ES_ERR_MEM_BLOCK_SIZE);
+
+    CFE_UtAssert_SUCCESS(CFE_ES_GenPoolGetBlock(&Pool, &Offset[7], 128));
+
+    /* Free a block, which goes on the free list, and confirm it cannot be freed twice */
+    CFE_UtAssert_SUCCESS(CFE_ES_GenPoolPutBlock(&Pool, &BlockSize, Offset[1]));
+    UtAssert_EQ(size_t, BlockSize, 100);
+    UtAssert_EQ(size_t, Pool.FreeBytes, 128);
+    UtAssert_INT32_EQ(CFE_ES_GenPoolPutBlock(&Pool, &BlockSize, Offset[1]), CFE_ES_POOL_BLOCK_INVALID);
+    CFE_ES_GenPoolGetBucketUsage(&Pool, 1, &BlockStats);
+    UtAssert_EQ(size_t, CFE_ES_MEMOFFSET_TO_SIZET(BlockStats.BlockSize), 128);
+    UtAssert_UINT32_EQ(BlockStats.NumFree, 1);
+
+    /* Small requests are served by splitting the free large block */
+    CFE_UtAssert_SUCCESS(CFE_ES_GenPoolGetBlock(&Pool, &SmallOffset1, 10));
+    UtAssert_EQ(size_t, SmallOffset1, Offset[1]);
+    CFE_UtAssert_SUCCESS(CFE_ES_GenPoolGetBlockSize(&Pool, &BlockSize, SmallOffset1));
+    UtAssert_EQ(size_t, BlockSize, 10);
+    CFE_UtAssert_SUCCESS(CFE_ES_GenPoolGetBlock(&Pool, &SmallOffset2, 10));
+    UtAssert_UINT32_GT(SmallOffset2, SmallOffset1);
+    UtAssert_UINT32_LT(SmallOffset2, Offset[2]);
+    UtAssert_ZERO(Pool.FreeListMask);
+
+    /* Releasing the small blocks merges them back into one large block */
+    CFE_UtAssert_SUCCESS(CFE_ES_GenPoolPutBlock(&Pool, &BlockSize, SmallOffset2));
+    CFE_UtAssert_SUCCESS(CFE_ES_GenPoolPutBlock(&Pool, &BlockSize, SmallOffset1));
+    CFE_UtAssert_SUCCESS(CFE_ES_GenPoolGetBlock(&Pool, &Offset[1], 128));
+    UtAssert_EQ(size_t, Offset[1], SmallOffset1);
+
+    /*
+     * Free several blocks of the same size so the free list has multiple
+     * entries, then release the blocks in between so they are merged
+     * with neighbors in the middle and at the head of the list
+     */
+    CFE_UtAssert_SUCCESS(CFE_ES_GenPoolPutBlock(&Pool, &BlockSize, Offset[5]));
+    CFE_UtAssert_SUCCESS(CFE_ES_GenPoolPutBlock(&Pool, &BlockSize, Offset[3]));
+    CFE_UtAssert_SUCCESS(CFE_ES_GenPoolPutBlock(&Pool, &BlockSize, Offset[1]));
+    CFE_UtAssert_SUCCESS(CFE_ES_GenPoolPutBlock(&Pool, &BlockSize, Offset[2]));
+    CFE_UtAssert_SUCCESS(CFE_ES_GenPoolPutBlock(&Pool, &BlockSize, Offset[0]));
+    CFE_UtAssert_SUCCESS(CFE_ES_GenPoolPutBlock(&Pool, &BlockSize, Offset[4]));
+
+    /* Now offsets 0-5 are one block, and the first gets should reuse it in order */
+    CFE_UtAssert_SUCCESS(CFE_ES_GenPoolGetBlock(&Pool, &SmallOffset1, 128));
+    UtAssert_EQ(size_t, SmallOffset1, Offset[0]);
+    CFE_UtAssert_SUCCESS(CFE_ES_GenPoolGetBlock(&Pool, &SmallOffset2, 128));
+    UtAssert_EQ(size_t, SmallOffset2, Offset[1]);
+    CFE_UtAssert_SUCCESS(CFE_ES_GenPoolPutBlock(&Pool, &BlockSize, SmallOffset1));
+    CFE_UtAssert_SUCCESS(CFE_ES_GenPoolPutBlock(&Pool, &BlockSize, SmallOffset2));
+
+    /* Releasing the last blocks returns everything to the unused area */
+    CFE_UtAssert_SUCCESS(CFE_ES_GenPoolPutBlock(&Pool, &BlockSize, Offset[7]));
+    CFE_UtAssert_SUCCESS(CFE_ES_GenPoolPutBlock(&Pool, &BlockSize, Offset[6]));
+    UtAssert_ZERO(Pool.TailPosition);
+    UtAssert_ZERO(Pool.LastBlockOffset);
+    UtAssert_ZERO(Pool.FreeListMask);
+    UtAssert_ZERO(Pool.FreeBytes);
+    CFE_ES_GenPoolGetUsage(&Pool, &FreeSize, &TotalSize);
+    UtAssert_EQ(size_t, CFE_ES_MEMOFFSET_TO_SIZET(FreeSize), CFE_ES_MEMOFFSET_TO_SIZET(TotalSize));
+
+    /* Released blocks that are no longer valid are rejected */
+    UtAssert_INT32_EQ(CFE_ES_GenPoolPutBlock(&Pool, &BlockSize, Offset[0]), CFE_ES_BUFFER_NOT_IN_POOL);
+
+    /* Releasing a block after the last one ending with a free block */
+    CFE_UtAssert_SUCCESS(CFE_ES_GenPoolGetBlock(&Pool, &Offset[0], 48));
+    CFE_UtAssert_SUCCESS(CFE_ES_GenPoolGetBlock(&Pool, &Offset[1], 48));
+    CFE_UtAssert_SUCCESS(CFE_ES_GenPoolGetBlock(&Pool, &Offset[2], 48));
+    CFE_UtAssert_SUCCESS(CFE_ES_GenPoolPutBlock(&Pool, &BlockSize, Offset[1]));
+    CFE_UtAssert_SUCCESS(CFE_ES_GenPoolPutBlock(&Pool, &BlockSize, Offset[2]));
+    UtAssert_EQ(size_t, Pool.TailPosition, Offset[0] + 48);
+    UtAssert_EQ(size_t, Pool.LastBlockOffset, Offset[0]);
+    UtAssert_ZERO(Pool.FreeBytes);
+
+    /* Allocations fail once the unused area is exhausted */
+    i = 0;
+    while (CFE_ES_GenPoolGetBlock(&Pool, &Offset[1], 128) == CFE_SUCCESS)
+    {
+        ++i;
+    }
+    UtAssert_NONZERO(i);
+    UtAssert_INT32_EQ(CFE_ES_GenPoolGetBlock(&Pool, &Offset[1], 128), CFE_ES_ERR_MEM_BLOCK_SIZE);
+}
+
+void TestGenericPoolCache(void)
+{
+    CFE_ES_GenPoolRecord_t Pool;
+    size_t                 Offset1 = 0;
+    size_t                 Offset2 = 0;
+    size_t                 OffsetList[4];
+    size_t                 BlockSize = 0;
+    uint16                 BucketId  = 0;
+    CFE_ES_BlockStats_t    BlockStats;
+    static const size_t    UT_POOL_BLOCK_SIZES[] = {16, 64};
+
+    ES_ResetUnitTest();
+    memset(&UT_MemPoolDirectBuffer, 0xee, sizeof(UT_MemPoolDirectBuffer));
+    CFE_UtAssert_SETUP(CFE_ES_GenPoolInitialize(&Pool, 0, sizeof(UT_MemPoolDirectBuffer.Data), 32, 2,
+                                                UT_POOL_BLOCK_SIZES, ES_UT_PoolDirectRetrieve, ES_UT_PoolDirectCommit));
+
+    /* Bucket lookup, the smallest block size has the highest ID */
+    UtAssert_UINT32_EQ(CFE_ES_GenPoolFindBucket(&Pool, 10), 2);
+    UtAssert_UINT32_EQ(CFE_ES_GenPoolFindBucket(&Pool, 64), 1);
+    UtAssert_ZERO(CFE_ES_GenPoolFindBucket(&Pool, 65));
+
+    /* A cached block can not be put, cached or queried again */
+    CFE_UtAssert_SETUP(CFE_ES_GenPoolGetBlock(&Pool, &Offset1, 10));
+    CFE_UtAssert_SUCCESS(CFE_ES_GenPoolCacheBlock(&Pool, &BucketId, &BlockSize, Offset1));
+    UtAssert_UINT32_EQ(BucketId, 2);
+    UtAssert_EQ(size_t, BlockSize, 10);
+    UtAssert_INT32_EQ(CFE_ES_GenPoolCacheBlock(&Pool, &BucketId, &BlockSize, Offset1), CFE_ES_POOL_BLOCK_INVALID);
+    UtAssert_INT32_EQ(CFE_ES_GenPoolPutBlock(&Pool, &BlockSize, Offset1), CFE_ES_POOL_BLOCK_INVALID);
+    UtAssert_INT32_EQ(CFE_ES_GenPoolGetBlockSize(&Pool, &BlockSize, Offset1), CFE_ES_POOL_BLOCK_INVALID);
+    UtAssert_INT32_EQ(CFE_ES_GenPoolCacheBlock(&Pool, &BucketId, &BlockSize, 0), CFE_ES_BUFFER_NOT_IN_POOL);
+    UtAssert_INT32_EQ(CFE_ES_GenPoolCacheBlock(&Pool, &BucketId, &BlockSize, Pool.TailPosition),
+                      CFE_ES_BUFFER_NOT_IN_POOL);
+
+    /* Handing it out again requires the same bucket and a size that fits */
+    UtAssert_INT32_EQ(CFE_ES_GenPoolUncacheBlock(&Pool, 1, 10, Offset1), CFE_ES_POOL_BLOCK_INVALID);
+    UtAssert_INT32_EQ(CFE_ES_GenPoolUncacheBlock(&Pool, 2, 17, Offset1), CFE_ES_POOL_BLOCK_INVALID);
+    UtAssert_INT32_EQ(CFE_ES_GenPoolUncacheBlock(&Pool, 2, 10, 0), CFE_ES_BUFFER_NOT_IN_POOL);
+    UtAssert_INT32_EQ(CFE_ES_GenPoolUncacheBlock(&Pool, 2, 10, Pool.TailPosition), CFE_ES_BUFFER_NOT_IN_POOL);
+    CFE_UtAssert_SUCCESS(CFE_ES_GenPoolUncacheBlock(&Pool, 2, 12, Offset1));
+    CFE_UtAssert_SUCCESS(CFE_ES_GenPoolGetBlockSize(&Pool, &BlockSize, Offset1));
+    UtAssert_EQ(size_t, BlockSize, 12);
+
+    /* Cached blocks are returned to the free list of their bucket */
+    CFE_UtAssert_SETUP(CFE_ES_GenPoolGetBlock(&Pool, &Offset2, 10));
+    CFE_UtAssert_SETUP(CFE_ES_GenPoolCacheBlock(&Pool, &BucketId, &BlockSize, Offset1));
+    CFE_UtAssert_SETUP(CFE_ES_GenPoolCacheBlock(&Pool, &BucketId, &BlockSize, Offset2));
+    OffsetList[0] = Offset1;
+    OffsetList[1] = Offset2;
+    CFE_UtAssert_SUCCESS(CFE_ES_GenPoolPutCachedBlocks(&Pool, 2, OffsetList, 2));
+    CFE_ES_GenPoolGetBucketUsage(&Pool, 2, &BlockStats);
+    UtAssert_UINT32_EQ(BlockStats.NumCreated, 2);
+    UtAssert_UINT32_EQ(BlockStats.NumFree, 2);
+
+    /* Returning blocks that are not cached fails and counts as a validation error */
+    Pool.ValidationErrorCount = 0;
+    UtAssert_INT32_EQ(CFE_ES_GenPoolPutCachedBlocks(&Pool, 2, OffsetList, 2), CFE_ES_POOL_BLOCK_INVALID);
+    UtAssert_UINT32_EQ(Pool.ValidationErrorCount, 2);
+    UtAssert_INT32_EQ(CFE_ES_GenPoolPutCachedBlocks(&Pool, 3, OffsetList, 2), CFE_ES_BUFFER_NOT_IN_POOL);
+
+    /* Only previously released blocks are moved into a cache */
+    UtAssert_ZERO(CFE_ES_GenPoolGetCachedBlocks(&Pool, 3, OffsetList, 4));
+    UtAssert_ZERO(CFE_ES_GenPoolGetCachedBlocks(&Pool, 2, OffsetList, 0));
+    Pool.IsCoalescing = true;
+    UtAssert_ZERO(CFE_ES_GenPoolGetCachedBlocks(&Pool, 2, OffsetList, 4));
+    Pool.IsCoalescing = false;
+    UtAssert_UINT32_EQ(CFE_ES_GenPoolGetCachedBlocks(&Pool, 2, OffsetList, 4), 2);
+    UtAssert_ZERO(CFE_ES_GenPoolGetCachedBlocks(&Pool, 2, &OffsetList[2], 2));
+    CFE_ES_GenPoolGetBucketUsage(&Pool, 2, &BlockStats);
+    UtAssert_ZERO(BlockStats.NumFree);
+    CFE_UtAssert_SUCCESS(CFE_ES_GenPoolUncacheBlock(&Pool, 2, 16, OffsetList[0]));
+
+    /* A rebuild treats blocks that were cached as released */
+    CFE_UtAssert_SETUP(CFE_ES_GenPoolInitialize(&Pool, 0, sizeof(UT_MemPoolDirectBuffer.Data), 32, 2,
+                                                UT_POOL_BLOCK_SIZES, ES_UT_PoolDirectRetrieve, ES_UT_PoolDirectCommit));
+    CFE_UtAssert_SUCCESS(CFE_ES_GenPoolRebuild(&Pool));
+    CFE_ES_GenPoolGetBucketUsage(&Pool, 2, &BlockStats);
+    UtAssert_UINT32_EQ(BlockStats.NumCreated, 2);
+    UtAssert_UINT32_EQ(BlockStats.NumFree, 1);
+    CFE_UtAssert_SUCCESS(CFE_ES_GenPoolGetBlock(&Pool, &Offset1, 16));
+    UtAssert_EQ(size_t, Offset1, OffsetList[1]);
+}
+
 void TestTask(void)
 {
     uint32    ResetType;
@@ -2487,7 +3120,9 @@ void TestTask(void)
         CFE_ES_SendMemPoolStatsCmd_t SendMemPoolStatsCmd;
         CFE_ES_DumpCDSRegistryCmd_t  DumpCDSRegistryCmd;
         CFE_ES_QueryAllTasksCmd_t    QueryAllTasksCmd;
+        CFE_ES_SendTaskStatsCmd_t    SendTaskStatsCmd;
     } CmdBuf;
+    OS_task_prop_t          TaskProp;
     CFE_ES_AppRecord_t *    UtAppRecPtr;
     CFE_ES_AppRecord_t *    UtAppRecPtr1;
     CFE_ES_TaskRecord_t *   UtTaskRecPtr;
@@ -2495,8 +3130,6 @@ void TestTask(void)
     CFE_ES_MemPoolRecord_t *UtPoolRecPtr;
     CFE_SB_MsgId_t          MsgId = CFE_SB_INVALID_MSG_ID;
     CFE_ES_TaskId_t         TaskId;
-    uint32                  Idx;
-    uint32                  Idx1;
 
     UtPrintf("Begin Test Task");
 
@@ -3169,12 +3802,9 @@ void TestTask(void)
     UT_SetDataBuffer(UT_KEY(CFE_PSP_Exception_GetSummary), &UT_ContextTask, sizeof(UT_ContextTask), false);
     UtAppRecPtr->ControlReq.AppControlRequest = CFE_ES_RunStatus_APP_RUN;
     UtAppRecPtr->StartParams.ExceptionAction  = CFE_ES_ExceptionAction_RESTART_APP;
-    CFE_UtAssert_SETUP(CFE_ES_AppID_ToIndex(UtAppRecPtr->AppId, &Idx));
-    CFE_UtAssert_SETUP(CFE_ES_AppID_ToIndex(UtAppRecPtr1->AppId, &Idx1));
 
-    /* Match on the first conversion, corrupt for the second */
-    UT_SetDataBuffer(UT_KEY(CFE_ResourceId_ToIndex), &Idx, sizeof(Idx1), false);
-    UT_SetDataBuffer(UT_KEY(CFE_ResourceId_ToIndex), &Idx1, sizeof(Idx), false);
+    /* App record matches while getting the task info, but is gone when checked again */
+    UT_SetHookFunction(UT_KEY(OS_TaskGetInfo), ES_UT_FreeAppRecordHook, UtAppRecPtr);
     UtAppRecPtr1->StartParams.ExceptionAction = CFE_ES_ExceptionAction_RESTART_APP;
     CFE_ES_RunExceptionScan(0, NULL);
     UtAssert_STUB_COUNT(CFE_PSP_Restart, 1);
@@ -3188,11 +3818,9 @@ void TestTask(void)
     UT_SetDataBuffer(UT_KEY(CFE_PSP_Exception_GetSummary), &UT_ContextTask, sizeof(UT_ContextTask), false);
     UtAppRecPtr->ControlReq.AppControlRequest = CFE_ES_RunStatus_APP_RUN;
     UtAppRecPtr->StartParams.ExceptionAction  = CFE_ES_ExceptionAction_RESTART_APP;
-    CFE_UtAssert_SETUP(CFE_ES_AppID_ToIndex(UtAppRecPtr->AppId, &Idx));
-    CFE_UtAssert_SETUP(CFE_ES_AppID_ToIndex(UtAppRecPtr1->AppId, &Idx1));
 
-    /* Corrupt first index */
-    UT_SetDataBuffer(UT_KEY(CFE_ResourceId_ToIndex), &Idx1, sizeof(Idx), false);
+    /* Parent app ID of the task does not refer to a valid app */
+    UtTaskRecPtr->AppId = CFE_ES_APPID_UNDEFINED;
     UtAppRecPtr1->StartParams.ExceptionAction = CFE_ES_ExceptionAction_RESTART_APP;
     CFE_ES_RunExceptionScan(0, NULL);
 
@@ -3329,6 +3957,28 @@ void TestTask(void)
                     UT_TPID_CFE_ES_CMD_SEND_MEM_POOL_STATS_CC);
     CFE_UtAssert_EVENTSENT(CFE_ES_TLM_POOL_STATS_INFO_EID);
 
+    /* Test telemetering task statistics; the first sample has no reference for the CPU load */
+    ES_ResetUnitTest();
+    ES_UT_SetupSingleAppId(CFE_ES_AppType_CORE, CFE_ES_AppState_RUNNING, NULL, NULL, NULL);
+    memset(&TaskProp, 0, sizeof(TaskProp));
+    TaskProp.cpu_time   = OS_TimeFromTotalMilliseconds(50);
+    TaskProp.run_slices = 3;
+    UT_SetDataBuffer(UT_KEY(OS_TaskGetInfo), &TaskProp, sizeof(TaskProp), false);
+    UT_CallTaskPipe(CFE_ES_TaskPipe, &CmdBuf.Msg, sizeof(CmdBuf.SendTaskStatsCmd),
+                    UT_TPID_CFE_ES_CMD_SEND_TASK_STATS_CC);
+    CFE_UtAssert_EVENTSENT(CFE_ES_TLM_TASK_STATS_INF_EID);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
+    UtAssert_UINT32_EQ(CFE_ES_Global.TaskData.TaskStatsPacket.Payload.TotalTasks, 1);
+    UtAssert_UINT32_EQ(CFE_ES_Global.TaskData.TaskStatsPacket.Payload.SampleIntervalMsec, 0);
+    UtAssert_UINT32_EQ(CFE_ES_Global.TaskData.TaskStatsPacket.Payload.TaskStats[0].CpuTimeMsec, 50);
+    UtAssert_UINT32_EQ(CFE_ES_Global.TaskData.TaskStatsPacket.Payload.TaskStats[0].RunSlices, 3);
+    UtAssert_UINT32_EQ(CFE_ES_Global.TaskData.TaskStatsPacket.Payload.TaskStats[0].CpuLoad, 0);
+
+    /* Test telemetering task statistics with an invalid command length */
+    ES_ResetUnitTest();
+    UT_CallTaskPipe(CFE_ES_TaskPipe, &CmdBuf.Msg, 0, UT_TPID_CFE_ES_CMD_SEND_TASK_STATS_CC);
+    CFE_UtAssert_EVENTSENT(CFE_ES_LEN_ERR_EID);
+
     /* Test the command pipe message process with an invalid command */
     ES_ResetUnitTest();
     UT_CallTaskPipe(CFE_ES_TaskPipe, &CmdBuf.Msg, sizeof(CmdBuf.NoopCmd), UT_TPID_CFE_ES_CMD_INVALID_CC);
@@ -3536,8 +4186,13 @@ void TestPerf(void)
 
     UtPrintf("Begin Test Performance Log");
 
-    CFE_ES_PerfData_t *Perf;
-    void *             TempBuff;
+    CFE_ES_PerfData_t *           Perf;
+    void *                        TempBuff;
+    CFE_ES_PerfStatsTlm_Payload_t PerfStatsPayload;
+    CFE_ES_TaskRecord_t *         UtTaskRecPtr;
+    CFE_ES_TaskId_t               TaskId;
+    uint32                        Timebase;
+    uint32                        i;
 
     /*
     ** Set the pointer to the data area
@@ -3897,6 +4552,63 @@ void TestPerf(void)
     UtAssert_UINT32_EQ(CFE_ES_Global.BackgroundPerfDumpState.DataPos, 2);
     /* should have written 4 entries to the log */
     UtAssert_UINT32_EQ(CFE_ES_Global.BackgroundPerfDumpState.FileSize, sizeof(CFE_ES_PerfDataEntry_t) * 4);
+    /* each contiguous segment should have been written as one block */
+    UtAssert_STUB_COUNT(OS_write, 2);
+
+    /* Test that a segment larger than the block size is split into multiple blocks */
+    ES_ResetUnitTest();
+    memset(&CFE_ES_Global.BackgroundPerfDumpState, 0, sizeof(CFE_ES_Global.BackgroundPerfDumpState));
+    OS_OpenCreate(&CFE_ES_Global.BackgroundPerfDumpState.FileDesc, "UT", 0, OS_WRITE_ONLY);
+    CFE_ES_Global.BackgroundPerfDumpState.CurrentState = CFE_ES_PerfDumpState_WRITE_PERF_ENTRIES;
+    CFE_ES_Global.BackgroundPerfDumpState.PendingState = CFE_ES_PerfDumpState_WRITE_PERF_ENTRIES;
+    CFE_ES_Global.BackgroundPerfDumpState.StateCounter = CFE_PLATFORM_ES_PERF_DUMP_BLOCK_ENTRIES + 1;
+    CFE_ES_RunPerfLogDump(1000, &CFE_ES_Global.BackgroundPerfDumpState);
+    UtAssert_UINT32_EQ(CFE_ES_Global.BackgroundPerfDumpState.DataPos, CFE_PLATFORM_ES_PERF_DUMP_BLOCK_ENTRIES + 1);
+    UtAssert_UINT32_EQ(CFE_ES_Global.BackgroundPerfDumpState.FileSize,
+                       sizeof(CFE_ES_PerfDataEntry_t) * (CFE_PLATFORM_ES_PERF_DUMP_BLOCK_ENTRIES + 1));
+    UtAssert_STUB_COUNT(OS_write, 2);
+
+    /* Test the compact format encoding, including a backwards step in time and a timer rollover */
+    ES_ResetUnitTest();
+    memset(&CFE_ES_Global.BackgroundPerfDumpState, 0, sizeof(CFE_ES_Global.BackgroundPerfDumpState));
+    OS_OpenCreate(&CFE_ES_Global.BackgroundPerfDumpState.FileDesc, "UT", 0, OS_WRITE_ONLY);
+    CFE_ES_Global.BackgroundPerfDumpState.Compact      = true;
+    CFE_ES_Global.BackgroundPerfDumpState.CurrentState = CFE_ES_PerfDumpState_WRITE_PERF_ENTRIES;
+    CFE_ES_Global.BackgroundPerfDumpState.PendingState = CFE_ES_PerfDumpState_WRITE_PERF_ENTRIES;
+    CFE_ES_Global.BackgroundPerfDumpState.StateCounter = 3;
+    Perf->MetaData.TimerLow32Rollover                  = 1000;
+    Perf->DataBuffer[0].Data                           = 1;
+    Perf->DataBuffer[0].TimerUpper32                   = 0;
+    Perf->DataBuffer[0].TimerLower32                   = 100;
+    Perf->DataBuffer[1].Data                           = 1 | (1U << CFE_MISSION_ES_PERF_EXIT_BIT);
+    Perf->DataBuffer[1].TimerUpper32                   = 0;
+    Perf->DataBuffer[1].TimerLower32                   = 90;
+    Perf->DataBuffer[2].Data                           = 2;
+    Perf->DataBuffer[2].TimerUpper32                   = 1;
+    Perf->DataBuffer[2].TimerLower32                   = 5;
+    CFE_ES_RunPerfLogDump(1000, &CFE_ES_Global.BackgroundPerfDumpState);
+    /* deltas of +100, -10 and +915 zigzag to 200, 19 and 1830; data words rotate to 2, 3 and 4 */
+    UtAssert_UINT32_EQ(CFE_ES_Global.BackgroundPerfDumpState.FileSize, 8);
+    UtAssert_UINT32_EQ(CFE_ES_Global.BackgroundPerfDumpState.LastTimestamp, 1005);
+    UtAssert_UINT32_EQ(CFE_ES_Global.BackgroundPerfDumpState.EncodeBuffer[0], 0xC8);
+    UtAssert_UINT32_EQ(CFE_ES_Global.BackgroundPerfDumpState.EncodeBuffer[1], 0x01);
+    UtAssert_UINT32_EQ(CFE_ES_Global.BackgroundPerfDumpState.EncodeBuffer[2], 2);
+    UtAssert_UINT32_EQ(CFE_ES_Global.BackgroundPerfDumpState.EncodeBuffer[3], 19);
+    UtAssert_UINT32_EQ(CFE_ES_Global.BackgroundPerfDumpState.EncodeBuffer[4], 3);
+    UtAssert_UINT32_EQ(CFE_ES_Global.BackgroundPerfDumpState.EncodeBuffer[7], 4);
+
+    /* Same with no rollover configured, where the timer words are simply concatenated */
+    ES_ResetUnitTest();
+    memset(&CFE_ES_Global.BackgroundPerfDumpState, 0, sizeof(CFE_ES_Global.BackgroundPerfDumpState));
+    OS_OpenCreate(&CFE_ES_Global.BackgroundPerfDumpState.FileDesc, "UT", 0, OS_WRITE_ONLY);
+    CFE_ES_Global.BackgroundPerfDumpState.Compact      = true;
+    CFE_ES_Global.BackgroundPerfDumpState.CurrentState = CFE_ES_PerfDumpState_WRITE_PERF_ENTRIES;
+    CFE_ES_Global.BackgroundPerfDumpState.PendingState = CFE_ES_PerfDumpState_WRITE_PERF_ENTRIES;
+    CFE_ES_Global.BackgroundPerfDumpState.StateCounter = 3;
+    Perf->MetaData.TimerLow32Rollover                  = 0;
+    CFE_ES_RunPerfLogDump(1000, &CFE_ES_Global.BackgroundPerfDumpState);
+    UtAssert_UINT32_EQ(CFE_ES_Global.BackgroundPerfDumpState.LastTimestamp >> 32, 1);
+    UtAssert_UINT32_EQ(CFE_ES_Global.BackgroundPerfDumpState.LastTimestamp & 0xFFFFFFFF, 5);
 
     /* Cover close file branch with undefined file descriptor */
     ES_ResetUnitTest();
@@ -3928,6 +4640,488 @@ void TestPerf(void)
     /* in WRITE_PERF_ENTRIES, it should report the StateCounter */
     CFE_ES_Global.BackgroundPerfDumpState.CurrentState = CFE_ES_PerfDumpState_WRITE_PERF_ENTRIES;
     UtAssert_UINT32_EQ(CFE_ES_GetPerfLogDumpRemaining(), 10);
+
+    /* Test the marker statistics are disabled without a timebase */
+    ES_ResetUnitTest();
+    Perf->MetaData.State               = CFE_ES_PERF_TRIGGERED;
+    Perf->MetaData.TimerTicksPerSecond = 0;
+    CFE_ES_PerfStatsInit();
+    UtAssert_BOOL_FALSE(CFE_ES_Global.PerfStats.IsEnabled);
+    CFE_ES_PerfLogAdd(1, 0);
+    UtAssert_UINT32_EQ(CFE_ES_Global.PerfStats.Task[0].Depth, 0);
+    CFE_ES_PerfStatsReport(&PerfStatsPayload);
+    UtAssert_UINT32_EQ(PerfStatsPayload.NumMarkers, 0);
+
+    /* Test that markers are timed but not traced while performance data collection is idle */
+    ES_ResetUnitTest();
+    Perf->MetaData.State               = CFE_ES_PERF_IDLE;
+    Perf->MetaData.TimerTicksPerSecond = 1000000;
+    Perf->MetaData.TimerLow32Rollover  = 0;
+    Perf->MetaData.DataCount           = 0;
+    CFE_ES_PerfStatsInit();
+    UtAssert_BOOL_TRUE(CFE_ES_Global.PerfStats.IsEnabled);
+    CFE_ES_PerfLogEntry(5);
+    CFE_ES_PerfLogExit(5);
+    CFE_ES_PerfLogAdd(CFE_MISSION_ES_PERF_MAX_IDS, 0);
+    UtAssert_STUB_COUNT(CFE_PSP_Get_Timebase, 2);
+    UtAssert_STUB_COUNT(OS_MutSemTake, 0);
+    UtAssert_STUB_COUNT(CFE_ES_WriteToSysLog, 0);
+    UtAssert_UINT32_EQ(Perf->MetaData.DataCount, 0);
+    CFE_ES_PerfStatsReport(&PerfStatsPayload);
+    UtAssert_UINT32_EQ(PerfStatsPayload.NumMarkers, 1);
+    UtAssert_UINT32_EQ(PerfStatsPayload.MarkerStats[0].PerfId, 5);
+    UtAssert_UINT32_EQ(PerfStatsPayload.MarkerStats[0].Count, 1);
+
+    /* Test nested, unmatched and non-task marker statistics, independent of the filter mask */
+    ES_ResetUnitTest();
+    Perf->MetaData.State = CFE_ES_PERF_WAITING_FOR_TRIGGER;
+    memset(Perf->MetaData.FilterMask, 0, sizeof(Perf->MetaData.FilterMask));
+    Perf->MetaData.TimerTicksPerSecond = 1000000;
+    Perf->MetaData.TimerLow32Rollover  = 0;
+    CFE_ES_PerfStatsInit();
+    UT_SetHandlerFunction(UT_KEY(CFE_PSP_Get_Timebase), ES_UT_SetTimebase, &Timebase);
+    Timebase = 100;
+    CFE_ES_PerfLogEntry(5);
+    Timebase = 110;
+    CFE_ES_PerfLogEntry(6);
+    Timebase = 150;
+    CFE_ES_PerfLogExit(6);
+    Timebase = 400;
+    CFE_ES_PerfLogExit(5);
+    CFE_ES_PerfLogExit(7);
+    UT_SetDeferredRetcode(UT_KEY(OS_ObjectIdToArrayIndex), 1, OS_ERROR);
+    CFE_ES_PerfLogEntry(8);
+    CFE_ES_PerfStatsReport(&PerfStatsPayload);
+    UtAssert_UINT32_EQ(PerfStatsPayload.NumMarkers, 2);
+    UtAssert_UINT32_EQ(PerfStatsPayload.ActiveMarkers, 2);
+    UtAssert_UINT32_EQ(PerfStatsPayload.UnmatchedExits, 1);
+    UtAssert_UINT32_EQ(PerfStatsPayload.MarkerStats[0].PerfId, 5);
+    UtAssert_UINT32_EQ(PerfStatsPayload.MarkerStats[0].TotalTimeUsec, 300);
+    UtAssert_UINT32_EQ(PerfStatsPayload.MarkerStats[0].Histogram[9], 1);
+    UtAssert_UINT32_EQ(PerfStatsPayload.MarkerStats[1].PerfId, 6);
+    UtAssert_UINT32_EQ(PerfStatsPayload.MarkerStats[1].Count, 1);
+    UtAssert_UINT32_EQ(PerfStatsPayload.MarkerStats[1].MinTimeUsec, 40);
+    UtAssert_UINT32_EQ(PerfStatsPayload.MarkerStats[1].MaxTimeUsec, 40);
+    UtAssert_UINT32_EQ(PerfStatsPayload.MarkerStats[1].MeanTimeUsec, 40);
+    UtAssert_UINT32_EQ(PerfStatsPayload.MarkerStats[1].Histogram[6], 1);
+
+    /* A report starts a new interval, which each task clears on its next marker */
+    CFE_ES_PerfStatsReport(&PerfStatsPayload);
+    UtAssert_UINT32_EQ(PerfStatsPayload.NumMarkers, 0);
+    UtAssert_UINT32_EQ(PerfStatsPayload.UnmatchedExits, 0);
+    CFE_ES_PerfLogExit(7);
+    CFE_ES_PerfStatsReport(&PerfStatsPayload);
+    UtAssert_UINT32_EQ(PerfStatsPayload.UnmatchedExits, 1);
+
+    /* Test the marker nesting limit and repeated samples with a rollover timebase */
+    CFE_ES_Global.PerfStats.TimerLow32Rollover = 1000000;
+    for (i = 0; i <= CFE_PLATFORM_ES_PERF_STATS_MAX_NESTING; ++i)
+    {
+        CFE_ES_PerfLogEntry(1);
+    }
+    CFE_ES_PerfLogExit(1);
+    for (i = 0; i < 3; ++i)
+    {
+        Timebase = 1000;
+        CFE_ES_PerfLogEntry(2);
+        Timebase += 10 * (i + 1);
+        CFE_ES_PerfLogExit(2);
+    }
+    CFE_ES_PerfStatsReport(&PerfStatsPayload);
+    UtAssert_UINT32_EQ(PerfStatsPayload.NestingOverflows, 1);
+    UtAssert_UINT32_EQ(PerfStatsPayload.NumMarkers, 2);
+    UtAssert_UINT32_EQ(PerfStatsPayload.MarkerStats[0].PerfId, 2);
+    UtAssert_UINT32_EQ(PerfStatsPayload.MarkerStats[0].Count, 3);
+    UtAssert_UINT32_EQ(PerfStatsPayload.MarkerStats[0].MinTimeUsec, 10);
+    UtAssert_UINT32_EQ(PerfStatsPayload.MarkerStats[0].MaxTimeUsec, 30);
+    UtAssert_UINT32_EQ(PerfStatsPayload.MarkerStats[0].MeanTimeUsec, 20);
+
+    /* Test the statistics of two tasks are merged, and a full task table drops samples */
+    ES_ResetUnitTest();
+    Perf->MetaData.State               = CFE_ES_PERF_TRIGGERED;
+    Perf->MetaData.TimerTicksPerSecond = 1000000;
+    Perf->MetaData.TimerLow32Rollover  = 0;
+    CFE_ES_PerfStatsInit();
+    UT_SetHandlerFunction(UT_KEY(CFE_PSP_Get_Timebase), ES_UT_SetTimebase, &Timebase);
+    for (i = 0; i <= CFE_PLATFORM_ES_PERF_STATS_MARKERS_PER_TASK; ++i)
+    {
+        Timebase = 0;
+        CFE_ES_PerfLogEntry(i);
+        Timebase = 10;
+        CFE_ES_PerfLogExit(i);
+    }
+    ES_UT_SetupSingleAppId(CFE_ES_AppType_EXTERNAL, CFE_ES_AppState_RUNNING, NULL, NULL, &UtTaskRecPtr);
+    TaskId = CFE_ES_TaskRecordGetID(UtTaskRecPtr);
+    UT_SetDefaultReturnValue(UT_KEY(OS_TaskGetId), OS_ObjectIdToInteger(CFE_ES_TaskId_ToOSAL(TaskId)));
+    Timebase = 0;
+    CFE_ES_PerfLogEntry(0);
+    Timebase = 50;
+    CFE_ES_PerfLogExit(0);
+    CFE_ES_PerfStatsReport(&PerfStatsPayload);
+    UtAssert_UINT32_EQ(PerfStatsPayload.DroppedSamples, 1);
+    UtAssert_UINT32_EQ(PerfStatsPayload.ActiveMarkers, CFE_PLATFORM_ES_PERF_STATS_MARKERS_PER_TASK);
+    UtAssert_UINT32_EQ(PerfStatsPayload.MarkerStats[0].PerfId, 0);
+    UtAssert_UINT32_EQ(PerfStatsPayload.MarkerStats[0].Count, 2);
+    UtAssert_UINT32_EQ(PerfStatsPayload.MarkerStats[0].MinTimeUsec, 10);
+    UtAssert_UINT32_EQ(PerfStatsPayload.MarkerStats[0].MaxTimeUsec, 50);
+    UtAssert_UINT32_EQ(PerfStatsPayload.MarkerStats[0].TotalTimeUsec, 60);
+
+    /* Test that stopping and starting a trace capture does not affect the open markers */
+    UT_ResetState(UT_KEY(OS_TaskGetId));
+    Timebase = 0;
+    CFE_ES_PerfLogEntry(3);
+    Perf->MetaData.State = CFE_ES_PERF_IDLE;
+    Timebase             = 20;
+    CFE_ES_PerfLogExit(3);
+    CFE_ES_PerfStatsReport(&PerfStatsPayload);
+    UtAssert_UINT32_EQ(PerfStatsPayload.NumMarkers, 1);
+    UtAssert_UINT32_EQ(PerfStatsPayload.MarkerStats[0].PerfId, 3);
+    UtAssert_UINT32_EQ(PerfStatsPayload.MarkerStats[0].TotalTimeUsec, 20);
+    UtAssert_UINT32_EQ(PerfStatsPayload.UnmatchedExits, 0);
+}
+
+static CFE_ES_LockProfileSite_t *ES_UT_FindLockProfileSite(CFE_ES_LockProfileLock_Enum_t LockId, uint32 LineNumber)
+{
+    CFE_ES_LockProfileSite_t *Site = CFE_ES_Global.LockProfile.Task[0].Sites;
+    uint32                    i;
+
+    for (i = 0; i < CFE_PLATFORM_ES_LOCK_PROFILE_SITES; ++i)
+    {
+        if (Site->FunctionName != NULL && Site->LockId == LockId && Site->LineNumber == LineNumber)
+        {
+            return Site;
+        }
+        ++Site;
+    }
+
+    return NULL;
+}
+
+static void ES_UT_LockProfileCycle(CFE_ES_LockProfileLock_Enum_t LockId, int32 LineNumber, uint32 *Timebase,
+                                   uint32 WaitTicks, uint32 HoldTicks)
+{
+    CFE_ES_LockProfileWait_t Wait;
+
+    CFE_ES_LockProfileWait(LockId, &Wait);
+    *Timebase += WaitTicks;
+    CFE_ES_LockProfileAcquired(LockId, &Wait, "ES_UT_LockProfileCycle", LineNumber);
+    *Timebase += HoldTicks;
+    CFE_ES_LockProfileRelease(LockId);
+}
+
+void TestLockProfile(void)
+{
+    union
+    {
+        CFE_MSG_Message_t            Msg;
+        CFE_ES_WriteLockProfileCmd_t WriteLockProfileCmd;
+    } CmdBuf;
+    struct
+    {
+        CFE_ES_LockProfileMetaData_t MetaData;
+        CFE_ES_LockProfileRecord_t   Records[2];
+        CFE_ES_LockProfileMetaData_t FinalMetaData;
+    } WriteBuf;
+    CFE_ES_LockProfileGlobal_t *Prof = &CFE_ES_Global.LockProfile;
+    CFE_ES_LockProfileWait_t    Wait;
+    CFE_ES_LockProfileSite_t *  Site;
+    uint32                      Timebase;
+    uint32                      NumRecords;
+    uint32                      i;
+
+    UtPrintf("Begin Test Lock Profile");
+
+    memset(&CmdBuf, 0, sizeof(CmdBuf));
+
+    /* Test the profiler is only enabled when configured and a timebase is known */
+    ES_ResetUnitTest();
+    CFE_ES_Global.ResetDataPtr->Perf.MetaData.TimerTicksPerSecond = 0;
+    CFE_ES_LockProfileInit();
+    UtAssert_BOOL_FALSE(Prof->IsEnabled);
+    CFE_ES_Global.ResetDataPtr->Perf.MetaData.TimerTicksPerSecond = 1000000;
+    CFE_ES_LockProfileInit();
+    UtAssert_True(Prof->IsEnabled == CFE_PLATFORM_ES_LOCK_PROFILE, "IsEnabled (%d) matches configuration",
+                  (int)Prof->IsEnabled);
+
+    /* Test nothing is recorded and the write command is rejected while disabled */
+    Prof->IsEnabled = false;
+    CFE_ES_LockProfileWait(CFE_ES_LockProfileLock_SB_SHARED_DATA, &Wait);
+    CFE_ES_LockProfileAcquired(CFE_ES_LockProfileLock_SB_SHARED_DATA, &Wait, __func__, __LINE__);
+    CFE_ES_LockProfileRelease(CFE_ES_LockProfileLock_SB_SHARED_DATA);
+    UtAssert_BOOL_FALSE(OS_ObjectIdDefined(Prof->Task[0].TaskId));
+    UtAssert_BOOL_FALSE(Prof->IsHeld[CFE_ES_LockProfileLock_SB_SHARED_DATA]);
+    UT_CallTaskPipe(CFE_ES_TaskPipe, &CmdBuf.Msg, sizeof(CmdBuf.WriteLockProfileCmd),
+                    UT_TPID_CFE_ES_CMD_WRITE_LOCK_PROFILE_CC);
+    CFE_UtAssert_EVENTSENT(CFE_ES_LOCKPROF_ERR_EID);
+
+    /* Test uncontended, nested and contended acquisitions are accounted per call site */
+    ES_ResetUnitTest();
+    CFE_ES_Global.ResetDataPtr->Perf.MetaData.TimerTicksPerSecond = 1000000;
+    CFE_ES_LockProfileInit();
+    Prof->IsEnabled = true;
+    UT_SetDefaultReturnValue(UT_KEY(OS_TaskGetId), 0);
+    UT_SetHandlerFunction(UT_KEY(CFE_PSP_Get_Timebase), ES_UT_SetTimebase, &Timebase);
+    Timebase = 100;
+    CFE_ES_LockProfileWait(CFE_ES_LockProfileLock_SB_SHARED_DATA, &Wait);
+    UtAssert_BOOL_FALSE(Wait.Contended);
+    Timebase = 110;
+    CFE_ES_LockProfileAcquired(CFE_ES_LockProfileLock_SB_SHARED_DATA, &Wait, "ES_UT_LockProfileCycle", 10);
+    UtAssert_BOOL_TRUE(Prof->IsHeld[CFE_ES_LockProfileLock_SB_SHARED_DATA]);
+
+    /* a nested take never counts as contended and is not accounted separately */
+    CFE_ES_LockProfileWait(CFE_ES_LockProfileLock_SB_SHARED_DATA, &Wait);
+    UtAssert_BOOL_FALSE(Wait.Contended);
+    CFE_ES_LockProfileAcquired(CFE_ES_LockProfileLock_SB_SHARED_DATA, &Wait, "ES_UT_LockProfileCycle", 11);
+    CFE_ES_LockProfileRelease(CFE_ES_LockProfileLock_SB_SHARED_DATA);
+    UtAssert_BOOL_TRUE(Prof->IsHeld[CFE_ES_LockProfileLock_SB_SHARED_DATA]);
+    Timebase = 150;
+    CFE_ES_LockProfileRelease(CFE_ES_LockProfileLock_SB_SHARED_DATA);
+    UtAssert_BOOL_FALSE(Prof->IsHeld[CFE_ES_LockProfileLock_SB_SHARED_DATA]);
+    UtAssert_NULL(ES_UT_FindLockProfileSite(CFE_ES_LockProfileLock_SB_SHARED_DATA, 11));
+
+    /* simulate another task holding the lock */
+    Prof->IsHeld[CFE_ES_LockProfileLock_SB_SHARED_DATA] = true;
+    Timebase                                            = 200;
+    ES_UT_LockProfileCycle(CFE_ES_LockProfileLock_SB_SHARED_DATA, 10, &Timebase, 30, 10);
+    ES_UT_LockProfileCycle(CFE_ES_LockProfileLock_TBL_REGISTRY, 20, &Timebase, 5, 7);
+
+    Site = ES_UT_FindLockProfileSite(CFE_ES_LockProfileLock_SB_SHARED_DATA, 10);
+    UtAssert_NOT_NULL(Site);
+    UtAssert_UINT32_EQ(Site->AcquireCount, 2);
+    UtAssert_UINT32_EQ(Site->ContendedCount, 1);
+    UtAssert_UINT32_EQ(Site->WaitTicksTotal, 40);
+    UtAssert_UINT32_EQ(Site->WaitTicksMax, 30);
+    UtAssert_UINT32_EQ(Site->HoldTicksTotal, 50);
+    UtAssert_UINT32_EQ(Site->HoldTicksMax, 40);
+    Site = ES_UT_FindLockProfileSite(CFE_ES_LockProfileLock_TBL_REGISTRY, 20);
+    UtAssert_NOT_NULL(Site);
+    UtAssert_UINT32_EQ(Site->AcquireCount, 1);
+    UtAssert_UINT32_EQ(Site->ContendedCount, 0);
+    UtAssert_UINT32_EQ(Site->HoldTicksTotal, 7);
+
+    /* Test the profile is written as metadata followed by one record per site */
+    memset(&WriteBuf, 0, sizeof(WriteBuf));
+    UT_SetDataBuffer(UT_KEY(OS_write), &WriteBuf, sizeof(WriteBuf), false);
+    CFE_UtAssert_SUCCESS(CFE_ES_LockProfileWriteData(OS_OBJECT_ID_UNDEFINED, &NumRecords));
+    UtAssert_UINT32_EQ(NumRecords, 2);
+    UtAssert_UINT32_EQ(WriteBuf.MetaData.NumRecords, 0);
+    UtAssert_UINT32_EQ(WriteBuf.FinalMetaData.ByteOrderMark, CFE_ES_LOCK_PROFILE_BYTE_ORDER_MARK);
+    UtAssert_UINT32_EQ(WriteBuf.FinalMetaData.RecordSize, sizeof(CFE_ES_LockProfileRecord_t));
+    UtAssert_UINT32_EQ(WriteBuf.FinalMetaData.TimerTicksPerSecond, 1000000);
+    UtAssert_UINT32_EQ(WriteBuf.FinalMetaData.NumRecords, 2);
+    UtAssert_UINT32_EQ(WriteBuf.Records[0].LineNumber + WriteBuf.Records[1].LineNumber, 30);
+    UtAssert_STRINGBUF_EQ(WriteBuf.Records[0].FunctionName, sizeof(WriteBuf.Records[0].FunctionName),
+                          "ES_UT_LockProfileCycle", -1);
+    UT_ResetState(UT_KEY(OS_write));
+
+    /* Test write failures, including a short write and a failure to rewrite the metadata */
+    UT_SetDeferredRetcode(UT_KEY(OS_write), 1, OS_ERROR);
+    UtAssert_INT32_EQ(CFE_ES_LockProfileWriteData(OS_OBJECT_ID_UNDEFINED, &NumRecords), OS_ERROR);
+    UT_SetDeferredRetcode(UT_KEY(OS_write), 2, 1);
+    UtAssert_INT32_EQ(CFE_ES_LockProfileWriteData(OS_OBJECT_ID_UNDEFINED, &NumRecords), OS_ERROR);
+    UtAssert_UINT32_EQ(NumRecords, 0);
+    UT_SetDeferredRetcode(UT_KEY(OS_lseek), 1, OS_ERROR);
+    UtAssert_INT32_EQ(CFE_ES_LockProfileWriteData(OS_OBJECT_ID_UNDEFINED, &NumRecords), OS_ERROR);
+
+    /* Test call sites beyond the table size are only counted as dropped */
+    for (i = 0; i < CFE_PLATFORM_ES_LOCK_PROFILE_SITES; ++i)
+    {
+        ES_UT_LockProfileCycle(CFE_ES_LockProfileLock_FS_SHARED_DATA, 1000 + i, &Timebase, 1, 1);
+    }
+    UtAssert_UINT32_EQ(Prof->Task[0].DroppedSites, 2);
+    UtAssert_BOOL_FALSE(Prof->IsHeld[CFE_ES_LockProfileLock_FS_SHARED_DATA]);
+
+    /* Test releases without acquisition, invalid locks and threads that are not tasks are ignored */
+    CFE_ES_LockProfileRelease(CFE_ES_LockProfileLock_ES_SHARED_DATA);
+    CFE_ES_LockProfileWait(CFE_ES_LockProfileLock_MAX, &Wait);
+    CFE_ES_LockProfileAcquired(CFE_ES_LockProfileLock_MAX, &Wait, __func__, __LINE__);
+    CFE_ES_LockProfileRelease(CFE_ES_LockProfileLock_MAX);
+    UT_SetDeferredRetcode(UT_KEY(OS_ObjectIdToArrayIndex), 1, OS_ERROR);
+    CFE_ES_LockProfileWait(CFE_ES_LockProfileLock_ES_SHARED_DATA, &Wait);
+    UtAssert_UINT32_EQ(Wait.StartTime, 0);
+    UtAssert_UINT32_EQ(Prof->Task[0].Held[CFE_ES_LockProfileLock_ES_SHARED_DATA].Depth, 0);
+
+    /* Test a reset clears the tables lazily, a hold across the reset is not accounted */
+    Prof->TimerLow32Rollover = 1000000;
+    CFE_ES_LockProfileWait(CFE_ES_LockProfileLock_ES_SHARED_DATA, &Wait);
+    CFE_ES_LockProfileAcquired(CFE_ES_LockProfileLock_ES_SHARED_DATA, &Wait, "ES_UT_LockProfileCycle", 30);
+    CFE_ES_LockProfileReset();
+    CFE_UtAssert_SUCCESS(CFE_ES_LockProfileWriteData(OS_OBJECT_ID_UNDEFINED, &NumRecords));
+    UtAssert_UINT32_EQ(NumRecords, 0);
+    CFE_ES_LockProfileRelease(CFE_ES_LockProfileLock_ES_SHARED_DATA);
+    UtAssert_BOOL_FALSE(Prof->IsHeld[CFE_ES_LockProfileLock_ES_SHARED_DATA]);
+    UtAssert_UINT32_EQ(Prof->Task[0].DroppedSites, 0);
+    UtAssert_NULL(ES_UT_FindLockProfileSite(CFE_ES_LockProfileLock_ES_SHARED_DATA, 30));
+    ES_UT_LockProfileCycle(CFE_ES_LockProfileLock_ES_SHARED_DATA, 31, &Timebase, 1, 1);
+    CFE_UtAssert_SUCCESS(CFE_ES_LockProfileWriteData(OS_OBJECT_ID_UNDEFINED, &NumRecords));
+    UtAssert_UINT32_EQ(NumRecords, 1);
+
+    /* Test a table left behind by a deleted task is cleared when the slot is reused */
+    Prof->Task[0].TaskId = OS_ObjectIdFromInteger(12345);
+    ES_UT_LockProfileCycle(CFE_ES_LockProfileLock_ES_SHARED_DATA, 32, &Timebase, 1, 1);
+    UtAssert_NULL(ES_UT_FindLockProfileSite(CFE_ES_LockProfileLock_ES_SHARED_DATA, 31));
+    UtAssert_NOT_NULL(ES_UT_FindLockProfileSite(CFE_ES_LockProfileLock_ES_SHARED_DATA, 32));
+
+    /* Test the write command with a bad file name */
+    UT_SetDeferredRetcode(UT_KEY(CFE_FS_ParseInputFileNameEx), 1, CFE_FS_INVALID_PATH);
+    UT_CallTaskPipe(CFE_ES_TaskPipe, &CmdBuf.Msg, sizeof(CmdBuf.WriteLockProfileCmd),
+                    UT_TPID_CFE_ES_CMD_WRITE_LOCK_PROFILE_CC);
+    CFE_UtAssert_EVENTSENT(CFE_ES_LOCKPROF_ERR_EID);
+
+    /* Test the write command with a file create failure */
+    UT_ClearEventHistory();
+    UT_SetDeferredRetcode(UT_KEY(OS_OpenCreate), 1, OS_ERROR);
+    UT_CallTaskPipe(CFE_ES_TaskPipe, &CmdBuf.Msg, sizeof(CmdBuf.WriteLockProfileCmd),
+                    UT_TPID_CFE_ES_CMD_WRITE_LOCK_PROFILE_CC);
+    CFE_UtAssert_EVENTSENT(CFE_ES_LOCKPROF_ERR_EID);
+
+    /* Test the write command with a file header write failure */
+    UT_SetDeferredRetcode(UT_KEY(CFE_FS_WriteHeader), 1, OS_ERROR);
+    UT_CallTaskPipe(CFE_ES_TaskPipe, &CmdBuf.Msg, sizeof(CmdBuf.WriteLockProfileCmd),
+                    UT_TPID_CFE_ES_CMD_WRITE_LOCK_PROFILE_CC);
+    CFE_UtAssert_EVENTSENT(CFE_ES_WRITE_CFE_HDR_ERR_EID);
+
+    /* Test the write command with a data write failure */
+    UT_ClearEventHistory();
+    UT_SetDeferredRetcode(UT_KEY(OS_write), 1, OS_ERROR);
+    UT_CallTaskPipe(CFE_ES_TaskPipe, &CmdBuf.Msg, sizeof(CmdBuf.WriteLockProfileCmd),
+                    UT_TPID_CFE_ES_CMD_WRITE_LOCK_PROFILE_CC);
+    CFE_UtAssert_EVENTSENT(CFE_ES_LOCKPROF_ERR_EID);
+    UtAssert_UINT32_EQ(Prof->Generation, 1);
+
+    /* Test a successful write command that clears the profile afterwards */
+    CmdBuf.WriteLockProfileCmd.Payload.ResetStats = 1;
+    UT_CallTaskPipe(CFE_ES_TaskPipe, &CmdBuf.Msg, sizeof(CmdBuf.WriteLockProfileCmd),
+                    UT_TPID_CFE_ES_CMD_WRITE_LOCK_PROFILE_CC);
+    CFE_UtAssert_EVENTSENT(CFE_ES_LOCKPROF_INF_EID);
+    UtAssert_UINT32_EQ(Prof->Generation, 2);
+
+    /* Test the write command with an invalid command length */
+    UT_CallTaskPipe(CFE_ES_TaskPipe, &CmdBuf.Msg, 0, UT_TPID_CFE_ES_CMD_WRITE_LOCK_PROFILE_CC);
+    CFE_UtAssert_EVENTSENT(CFE_ES_LEN_ERR_EID);
+}
+
+static void ES_UT_TaskPoolJob(void *JobArg)
+{
+    ++(*(uint32 *)JobArg);
+}
+
+void TestTaskPool(void)
+{
+    CFE_ES_AppRecord_t *        UtAppRecPtr;
+    CFE_ES_TaskPoolJobRecord_t *JobRecPtr;
+    CFE_ES_AppInfo_t            AppInfo;
+    CFE_ES_AppId_t              AppId;
+    uint32                      JobRuns;
+    uint32                      i;
+
+    UtPrintf("Begin Test Task Pool");
+
+    /* Test submitting a job with a NULL function pointer */
+    ES_ResetUnitTest();
+    ES_UT_SetupSingleAppId(CFE_ES_AppType_EXTERNAL, CFE_ES_AppState_RUNNING, NULL, &UtAppRecPtr, NULL);
+    UtAssert_INT32_EQ(CFE_ES_TaskPoolSubmit(NULL, &JobRuns), CFE_ES_BAD_ARGUMENT);
+    UtAssert_STUB_COUNT(OS_TaskPoolSubmit, 0);
+
+    /* Test submitting a job without a valid calling app */
+    ES_ResetUnitTest();
+    UtAssert_INT32_EQ(CFE_ES_TaskPoolSubmit(ES_UT_TaskPoolJob, &JobRuns), CFE_ES_ERR_RESOURCEID_NOT_VALID);
+    UtAssert_STUB_COUNT(OS_TaskPoolSubmit, 0);
+
+    /* Test submitting a job from an app that is being stopped */
+    ES_ResetUnitTest();
+    ES_UT_SetupSingleAppId(CFE_ES_AppType_EXTERNAL, CFE_ES_AppState_WAITING, NULL, &UtAppRecPtr, NULL);
+    UtAssert_INT32_EQ(CFE_ES_TaskPoolSubmit(ES_UT_TaskPoolJob, &JobRuns), CFE_ES_ERR_RESOURCEID_NOT_VALID);
+    UtAssert_STUB_COUNT(OS_TaskPoolSubmit, 0);
+
+    /* Test a successful submit, then run the job as a pool worker would */
+    ES_ResetUnitTest();
+    ES_UT_SetupSingleAppId(CFE_ES_AppType_EXTERNAL, CFE_ES_AppState_RUNNING, NULL, &UtAppRecPtr, NULL);
+    AppId   = CFE_ES_AppRecordGetID(UtAppRecPtr);
+    JobRuns = 0;
+    CFE_UtAssert_SUCCESS(CFE_ES_TaskPoolSubmit(ES_UT_TaskPoolJob, &JobRuns));
+    UtAssert_STUB_COUNT(OS_TaskPoolSubmit, 1);
+    UtAssert_UINT32_EQ(UtAppRecPtr->TaskPoolJobsPending, 1);
+    JobRecPtr = &CFE_ES_Global.TaskPoolJobTable[0];
+    CFE_UtAssert_RESOURCEID_EQ(JobRecPtr->AppId, AppId);
+
+    /* While the job is pending, an app whose kill timer has expired is not cleaned up */
+    UtAppRecPtr->AppState                     = CFE_ES_AppState_WAITING;
+    UtAppRecPtr->ControlReq.AppControlRequest = CFE_ES_RunStatus_SYS_DELETE;
+    UtAppRecPtr->ControlReq.AppTimerMsec      = 0;
+    UtAssert_BOOL_TRUE(CFE_ES_RunAppTableScan(0, &CFE_ES_Global.BackgroundAppScanState));
+    UtAssert_BOOL_TRUE(CFE_ES_AppRecordIsUsed(UtAppRecPtr));
+    CFE_UtAssert_EVENTNOTSENT(CFE_ES_STOP_INF_EID);
+
+    CFE_ES_TaskPoolJobEntry(JobRecPtr);
+    UtAssert_UINT32_EQ(JobRuns, 1);
+    UtAssert_UINT32_EQ(UtAppRecPtr->TaskPoolJobsPending, 0);
+    UtAssert_UINT32_EQ(UtAppRecPtr->TaskPoolJobsCompleted, 1);
+    CFE_UtAssert_RESOURCEID_EQ(JobRecPtr->AppId, CFE_ES_APPID_UNDEFINED);
+
+    CFE_UtAssert_SUCCESS(CFE_ES_GetAppInfo(&AppInfo, AppId));
+    UtAssert_UINT32_EQ(AppInfo.TaskPoolJobsPending, 0);
+    UtAssert_UINT32_EQ(AppInfo.TaskPoolJobsCompleted, 1);
+
+    /* Once the job has returned, the next scan cleans up the app */
+    UtAssert_BOOL_TRUE(CFE_ES_RunAppTableScan(0, &CFE_ES_Global.BackgroundAppScanState));
+    CFE_UtAssert_EVENTSENT(CFE_ES_STOP_INF_EID);
+
+    /* Test a job that completes after its app has been deleted */
+    JobRecPtr->AppId   = AppId;
+    JobRecPtr->JobFunc = ES_UT_TaskPoolJob;
+    JobRecPtr->JobArg  = &JobRuns;
+    CFE_ES_TaskPoolJobEntry(JobRecPtr);
+    UtAssert_UINT32_EQ(JobRuns, 2);
+    CFE_UtAssert_RESOURCEID_EQ(JobRecPtr->AppId, CFE_ES_APPID_UNDEFINED);
+
+    /* A job that does not return delays the cleanup only up to the drain timeout, and the module stays loaded */
+    ES_ResetUnitTest();
+    ES_UT_SetupSingleAppId(CFE_ES_AppType_EXTERNAL, CFE_ES_AppState_RUNNING, NULL, &UtAppRecPtr, NULL);
+    OS_ModuleLoad(&UtAppRecPtr->LoadStatus.ModuleId, NULL, NULL, 0);
+    CFE_UtAssert_SUCCESS(CFE_ES_TaskPoolSubmit(ES_UT_TaskPoolJob, &JobRuns));
+    UtAppRecPtr->AppState                     = CFE_ES_AppState_WAITING;
+    UtAppRecPtr->ControlReq.AppControlRequest = CFE_ES_RunStatus_SYS_DELETE;
+    UtAppRecPtr->ControlReq.AppTimerMsec      = 0;
+    UtAssert_BOOL_TRUE(CFE_ES_RunAppTableScan(CFE_ES_APP_JOB_DRAIN_TIMEOUT, &CFE_ES_Global.BackgroundAppScanState));
+    UtAssert_BOOL_TRUE(CFE_ES_AppRecordIsUsed(UtAppRecPtr));
+    UtAssert_UINT32_EQ(UtAppRecPtr->ControlReq.JobWaitMsec, CFE_ES_APP_JOB_DRAIN_TIMEOUT);
+    UtAssert_BOOL_TRUE(CFE_ES_RunAppTableScan(CFE_ES_APP_JOB_DRAIN_TIMEOUT, &CFE_ES_Global.BackgroundAppScanState));
+    UtAssert_BOOL_FALSE(CFE_ES_AppRecordIsUsed(UtAppRecPtr));
+    UtAssert_STUB_COUNT(OS_ModuleUnload, 0);
+    CFE_UtAssert_PRINTF("task pool job(s)");
+    CFE_UtAssert_PRINTF("not unloaded");
+
+    /* Test submitting a job when the job table is full */
+    ES_ResetUnitTest();
+    ES_UT_SetupSingleAppId(CFE_ES_AppType_EXTERNAL, CFE_ES_AppState_RUNNING, NULL, &UtAppRecPtr, NULL);
+    for (i = 0; i < OS_MAX_TASK_POOL_JOBS; ++i)
+    {
+        CFE_ES_Global.TaskPoolJobTable[i].AppId = CFE_ES_AppRecordGetID(UtAppRecPtr);
+    }
+    UtAssert_INT32_EQ(CFE_ES_TaskPoolSubmit(ES_UT_TaskPoolJob, &JobRuns), CFE_ES_NO_RESOURCE_IDS_AVAILABLE);
+    UtAssert_UINT32_EQ(UtAppRecPtr->TaskPoolJobsPending, 0);
+    UtAssert_STUB_COUNT(OS_TaskPoolSubmit, 0);
+
+    /* Test the OSAL pool queue being full */
+    ES_ResetUnitTest();
+    ES_UT_SetupSingleAppId(CFE_ES_AppType_EXTERNAL, CFE_ES_AppState_RUNNING, NULL, &UtAppRecPtr, NULL);
+    UT_SetDeferredRetcode(UT_KEY(OS_TaskPoolSubmit), 1, OS_QUEUE_FULL);
+    UtAssert_INT32_EQ(CFE_ES_TaskPoolSubmit(ES_UT_TaskPoolJob, &JobRuns), CFE_ES_NO_RESOURCE_IDS_AVAILABLE);
+    UtAssert_UINT32_EQ(UtAppRecPtr->TaskPoolJobsPending, 0);
+    CFE_UtAssert_RESOURCEID_EQ(CFE_ES_Global.TaskPoolJobTable[0].AppId, CFE_ES_APPID_UNDEFINED);
+
+    /* Test the OSAL pool not being available on this platform */
+    UT_SetDeferredRetcode(UT_KEY(OS_TaskPoolSubmit), 1, OS_ERR_NOT_IMPLEMENTED);
+    UtAssert_INT32_EQ(CFE_ES_TaskPoolSubmit(ES_UT_TaskPoolJob, &JobRuns), CFE_ES_NOT_IMPLEMENTED);
+    UtAssert_UINT32_EQ(UtAppRecPtr->TaskPoolJobsPending, 0);
+    CFE_UtAssert_RESOURCEID_EQ(CFE_ES_Global.TaskPoolJobTable[0].AppId, CFE_ES_APPID_UNDEFINED);
+
+    /* Test any other OSAL pool failure */
+    UT_SetDeferredRetcode(UT_KEY(OS_TaskPoolSubmit), 1, OS_ERROR);
+    UtAssert_INT32_EQ(CFE_ES_TaskPoolSubmit(ES_UT_TaskPoolJob, &JobRuns), CFE_STATUS_EXTERNAL_RESOURCE_FAIL);
+    UtAssert_UINT32_EQ(UtAppRecPtr->TaskPoolJobsPending, 0);
+    CFE_UtAssert_RESOURCEID_EQ(CFE_ES_Global.TaskPoolJobTable[0].AppId, CFE_ES_APPID_UNDEFINED);
 }
 
 void TestAPI(void)
@@ -3946,6 +5140,9 @@ void TestAPI(void)
     CFE_ES_AppInfo_t     AppInfo;
     CFE_ES_AppRecord_t * UtAppRecPtr;
     CFE_ES_TaskRecord_t *UtTaskRecPtr;
+    OS_time_t            UtTime;
+
+    CFE_ES_TaskEntryFuncPtr_t TaskFuncPtr;
 
     UtPrintf("Begin Test API");
 
@@ -3986,7 +5183,6 @@ void TestAPI(void)
 
     /* Test restarting an app with an ID out of range (high) */
     ES_ResetUnitTest();
-    UT_SetDeferredRetcode(UT_KEY(CFE_ResourceId_ToIndex), 1, -1);
     AppId = CFE_ES_APPID_C(ES_UT_MakeAppIdForIndex(99999));
     UtAssert_INT32_EQ(CFE_ES_RestartApp(AppId), CFE_ES_ERR_RESOURCEID_NOT_VALID);
 
@@ -4132,6 +5328,29 @@ void TestAPI(void)
     UtAssert_BOOL_TRUE(CFE_ES_RunLoop(&RunStatus));
     UtAssert_UINT32_EQ(UtAppRecPtr->AppState, CFE_ES_AppState_RUNNING);
 
+    /* Time to ready is recorded the first time the app reaches RUNNING, and reported in app info */
+    ES_ResetUnitTest();
+    ES_UT_SetupSingleAppId(CFE_ES_AppType_EXTERNAL, CFE_ES_AppState_LATE_INIT, NULL, &UtAppRecPtr, NULL);
+    UtAppRecPtr->CreateTime = OS_TimeFromTotalMilliseconds(100);
+    UtTime                  = OS_TimeFromTotalMilliseconds(350);
+    UT_SetDataBuffer(UT_KEY(CFE_PSP_GetTime), &UtTime, sizeof(UtTime), false);
+    RunStatus                                 = CFE_ES_RunStatus_APP_RUN;
+    UtAppRecPtr->ControlReq.AppControlRequest = CFE_ES_RunStatus_APP_RUN;
+    UtAssert_BOOL_TRUE(CFE_ES_RunLoop(&RunStatus));
+    UtAssert_UINT32_EQ(UtAppRecPtr->TimeToReadyMsec, 250);
+    UtAssert_BOOL_TRUE(CFE_ES_RunLoop(&RunStatus));
+    UtAssert_UINT32_EQ(UtAppRecPtr->TimeToReadyMsec, 250);
+    CFE_UtAssert_SUCCESS(CFE_ES_GetAppInfo(&AppInfo, CFE_ES_AppRecordGetID(UtAppRecPtr)));
+    UtAssert_UINT32_EQ(AppInfo.TimeToReadyMsec, 250);
+
+    /* An app that is ready immediately still reports a nonzero time */
+    ES_ResetUnitTest();
+    ES_UT_SetupSingleAppId(CFE_ES_AppType_EXTERNAL, CFE_ES_AppState_LATE_INIT, NULL, &UtAppRecPtr, NULL);
+    CFE_PSP_GetTime(&UtAppRecPtr->CreateTime);
+    UtAppRecPtr->ControlReq.AppControlRequest = CFE_ES_RunStatus_APP_RUN;
+    UtAssert_BOOL_TRUE(CFE_ES_RunLoop(&RunStatus));
+    UtAssert_UINT32_EQ(UtAppRecPtr->TimeToReadyMsec, 1);
+
     /* Hit NULL TaskRecPtr case */
     ES_ResetUnitTest();
     UT_SetDeferredRetcode(UT_KEY(OS_ObjectIdToArrayIndex), 1, OS_ERROR);
@@ -4265,6 +5484,7 @@ void TestAPI(void)
     ES_ResetUnitTest();
     ES_UT_SetupSingleAppId(CFE_ES_AppType_EXTERNAL, CFE_ES_AppState_RUNNING, NULL, &UtAppRecPtr, NULL);
     CFE_UtAssert_SUCCESS(CFE_ES_CreateChildTask(&TaskId, "TaskName", TestAPI, StackBuf, sizeof(StackBuf), 400, 0));
+    UtAssert_STUB_COUNT(OS_CondVarBroadcast, 1);
 
     /* Test common entry point */
     ES_ResetUnitTest();
@@ -4294,6 +5514,19 @@ void TestAPI(void)
     /* NULL pointer protection logic coverage */
     UtAssert_INT32_EQ(CFE_ES_GetTaskFunction(NULL), CFE_ES_ERR_APP_REGISTER);
 
+    /* Task record completed while waiting, entry function is returned */
+    UtTaskRecPtr->AppId = CFE_ES_AppRecordGetID(UtAppRecPtr);
+    CFE_UtAssert_SUCCESS(CFE_ES_GetTaskFunction(&TaskFuncPtr));
+    UtAssert_BOOL_TRUE(TaskFuncPtr == ES_UT_TaskFunction);
+    UtAssert_STUB_COUNT(OS_TaskDelay, 0);
+
+    /* Task record never completed */
+    ES_ResetUnitTest();
+    ES_UT_SetupSingleAppId(CFE_ES_AppType_EXTERNAL, CFE_ES_AppState_RUNNING, NULL, &UtAppRecPtr, &UtTaskRecPtr);
+    UtAssert_INT32_EQ(CFE_ES_GetTaskFunction(&TaskFuncPtr), CFE_ES_ERR_APP_REGISTER);
+    UtAssert_BOOL_TRUE(TaskFuncPtr == NULL);
+    UtAssert_NONZERO(UT_GetStubCount(UT_KEY(OS_CondVarTimedWait)));
+
     /* Test deleting a child task when task is not active/valid */
     ES_ResetUnitTest();
     ES_UT_SetupSingleAppId(CFE_ES_AppType_EXTERNAL, CFE_ES_AppState_RUNNING, "UT", NULL, &UtTaskRecPtr);
@@ -4565,9 +5798,9 @@ void TestGenericCounterAPI(void)
     UtAssert_INT32_EQ(i, CFE_PLATFORM_ES_MAX_GEN_COUNTERS);
 
     /* Test registering a generic counter after the maximum are registered */
-    UT_SetDefaultReturnValue(UT_KEY(CFE_ResourceId_FindNext), OS_ERROR);
+    UT_SetDefaultReturnValue(UT_KEY(CFE_ResourceId_FindNextFree), OS_ERROR);
     UtAssert_INT32_EQ(CFE_ES_RegisterGenCounter(&CounterId, "Counter999"), CFE_ES_NO_RESOURCE_IDS_AVAILABLE);
-    UT_ResetState(UT_KEY(CFE_ResourceId_FindNext));
+    UT_ResetState(UT_KEY(CFE_ResourceId_FindNextFree));
 
     /* Check operation of the CFE_ES_CheckCounterIdSlotUsed() helper function */
     CFE_ES_Global.CounterTable[1].CounterId = CFE_ES_COUNTERID_C(ES_UT_MakeCounterIdForIndex(1));
@@ -4775,7 +6008,7 @@ void TestCDS()
     ES_UT_SetupCDSGlobal(ES_UT_CDS_SMALL_TEST_SIZE);
 
     /* Set all the CDS registries to 'taken' */
-    UT_SetDefaultReturnValue(UT_KEY(CFE_ResourceId_FindNext), OS_ERROR);
+    UT_SetDefaultReturnValue(UT_KEY(CFE_ResourceId_FindNextFree), OS_ERROR);
     UtAssert_INT32_EQ(CFE_ES_RegisterCDS(&CDSHandle, 4, "Name2"), CFE_ES_NO_RESOURCE_IDS_AVAILABLE);
 
     /* Check operation of the CFE_ES_CheckCDSHandleSlotUsed() helper function */
@@ -4844,6 +6077,12 @@ void TestCDS()
     UT_SetDeferredRetcode(UT_KEY(CFE_PSP_WriteToCDS), 1, -1);
     UtAssert_INT32_EQ(CFE_ES_InitCDSRegistry(), CFE_ES_CDS_ACCESS_ERROR);
 
+    /* Test CDS registry initialization clears the registry usage map */
+    ES_ResetUnitTest();
+    CFE_ES_Global.CDSVars.RegistryMap[0] = 1;
+    CFE_UtAssert_SUCCESS(CFE_ES_InitCDSRegistry());
+    UtAssert_ZERO(CFE_ES_Global.CDSVars.RegistryMap[0]);
+
     /* Test successful CDS initialization */
     ES_ResetUnitTest();
     CFE_UtAssert_SUCCESS(CFE_ES_CDS_EarlyInit());
@@ -5297,7 +6536,7 @@ void TestESMempool(void)
      * Test creating a memory pool after the limit reached (no slots)
      */
     ES_ResetUnitTest();
-    UT_SetDefaultReturnValue(UT_KEY(CFE_ResourceId_FindNext), OS_ERROR);
+    UT_SetDefaultReturnValue(UT_KEY(CFE_ResourceId_FindNextFree), OS_ERROR);
     UtAssert_INT32_EQ(CFE_ES_PoolCreateEx(&PoolID1, Buffer1, sizeof(Buffer1), CFE_PLATFORM_ES_POOL_MAX_BUCKETS,
                                           BlockSizes, CFE_ES_USE_MUTEX),
                       CFE_ES_NO_RESOURCE_IDS_AVAILABLE);
@@ -5513,6 +6752,140 @@ void TestESMempool(void)
 }
 
 /* Tests to fill gaps in coverage in SysLog */
+void TestESMempoolTaskCache(void)
+{
+    CFE_ES_MemHandle_t         PoolID1 = CFE_ES_MEMHANDLE_UNDEFINED; /* Poo1 1 handle, no mutex */
+    CFE_ES_MemHandle_t         PoolID2 = CFE_ES_MEMHANDLE_UNDEFINED; /* Poo1 2 handle, with mutex */
+    uint8                      Buffer1[1024];
+    uint8                      Buffer2[2048];
+    CFE_ES_MemPoolBuf_t        Buf[CFE_PLATFORM_ES_MEMPOOL_TASK_CACHE_DEPTH + 1];
+    CFE_ES_MemPoolBuf_t        OtherBuf;
+    CFE_ES_MemPoolRecord_t *   PoolPtr;
+    CFE_ES_MemPoolTaskCache_t *CachePtr;
+    CFE_ES_MemPoolStats_t      Stats;
+    CFE_ES_GenPoolBD_t *       BdPtr;
+    osal_id_t                  TaskId;
+    uint16                     BucketId;
+    uint32                     Batch;
+    uint32                     i;
+
+    UtPrintf("Begin Test ES memory pool task caches");
+
+    Batch = CFE_PLATFORM_ES_MEMPOOL_TASK_CACHE_DEPTH / 2;
+
+    ES_ResetUnitTest();
+    CFE_UtAssert_SETUP(CFE_ES_PoolCreateNoSem(&PoolID1, Buffer1, sizeof(Buffer1)));
+    CFE_UtAssert_SETUP(CFE_ES_PoolCreate(&PoolID2, Buffer2, sizeof(Buffer2)));
+    PoolPtr  = CFE_ES_LocateMemPoolRecordByID(PoolID2);
+    CachePtr = &PoolPtr->TaskCache[0];
+    BucketId = CFE_ES_GenPoolFindBucket(&PoolPtr->Pool, 32);
+
+    /* Caches can only be enabled on valid pools that have a mutex */
+    UtAssert_INT32_EQ(CFE_ES_PoolEnableTaskCache(CFE_ES_MEMHANDLE_UNDEFINED), CFE_ES_ERR_RESOURCEID_NOT_VALID);
+    UtAssert_INT32_EQ(CFE_ES_PoolEnableTaskCache(PoolID1), CFE_ES_BAD_ARGUMENT);
+
+    /* ... and that keep free blocks per block size */
+    PoolPtr->Pool.IsCoalescing = true;
+    UtAssert_INT32_EQ(CFE_ES_PoolEnableTaskCache(PoolID2), CFE_ES_BAD_ARGUMENT);
+    UtAssert_BOOL_FALSE(PoolPtr->UseTaskCache);
+    PoolPtr->Pool.IsCoalescing = false;
+    CFE_UtAssert_SUCCESS(CFE_ES_PoolEnableTaskCache(PoolID2));
+
+    /* The first request goes to the pool and claims a cache for the task */
+    for (i = 0; i <= CFE_PLATFORM_ES_MEMPOOL_TASK_CACHE_DEPTH; ++i)
+    {
+        UtAssert_INT32_EQ(CFE_ES_GetPoolBuf(&Buf[i], PoolID2, 32), 32);
+    }
+    UtAssert_BOOL_TRUE(OS_ObjectIdDefined(CachePtr->OwnerTaskId));
+    UtAssert_ZERO(CachePtr->Depth[BucketId - 1]);
+
+    /* Released blocks are kept in the cache without taking the mutex */
+    UT_ResetState(UT_KEY(OS_MutSemTake));
+    for (i = 0; i < CFE_PLATFORM_ES_MEMPOOL_TASK_CACHE_DEPTH; ++i)
+    {
+        UtAssert_INT32_EQ(CFE_ES_PutPoolBuf(PoolID2, Buf[i]), 32);
+    }
+    UtAssert_STUB_COUNT(OS_MutSemTake, 0);
+    UtAssert_UINT32_EQ(CachePtr->Depth[BucketId - 1], CFE_PLATFORM_ES_MEMPOOL_TASK_CACHE_DEPTH);
+
+    /* Cached blocks are reported as free */
+    CFE_UtAssert_SUCCESS(CFE_ES_GetMemPoolStats(&Stats, PoolID2));
+    UtAssert_UINT32_EQ(Stats.BlockStats[PoolPtr->Pool.NumBuckets - BucketId].NumFree,
+                       CFE_PLATFORM_ES_MEMPOOL_TASK_CACHE_DEPTH);
+
+    /* Releasing a cached block again is still detected */
+    UtAssert_INT32_EQ(CFE_ES_PutPoolBuf(PoolID2, Buf[0]), CFE_ES_POOL_BLOCK_INVALID);
+
+    /* Releasing into a full cache returns a batch to the pool under the mutex */
+    UT_ResetState(UT_KEY(OS_MutSemTake));
+    UtAssert_INT32_EQ(CFE_ES_PutPoolBuf(PoolID2, Buf[CFE_PLATFORM_ES_MEMPOOL_TASK_CACHE_DEPTH]), 32);
+    UtAssert_STUB_COUNT(OS_MutSemTake, 1);
+    UtAssert_UINT32_EQ(CachePtr->Depth[BucketId - 1], CFE_PLATFORM_ES_MEMPOOL_TASK_CACHE_DEPTH - Batch + 1);
+    CFE_UtAssert_SUCCESS(CFE_ES_GetMemPoolStats(&Stats, PoolID2));
+    UtAssert_UINT32_EQ(Stats.BlockStats[PoolPtr->Pool.NumBuckets - BucketId].NumFree,
+                       CFE_PLATFORM_ES_MEMPOOL_TASK_CACHE_DEPTH + 1);
+
+    /* Requests of the same block size are served from the cache without taking the mutex */
+    UT_ResetState(UT_KEY(OS_MutSemTake));
+    for (i = 0; i < CFE_PLATFORM_ES_MEMPOOL_TASK_CACHE_DEPTH - Batch + 1; ++i)
+    {
+        UtAssert_INT32_EQ(CFE_ES_GetPoolBuf(&Buf[i], PoolID2, 20), 20);
+    }
+    UtAssert_STUB_COUNT(OS_MutSemTake, 0);
+    UtAssert_INT32_EQ(CFE_ES_GetPoolBufInfo(PoolID2, Buf[0]), 20);
+
+    /* An empty cache is refilled with released blocks */
+    UT_ResetState(UT_KEY(OS_MutSemTake));
+    UtAssert_INT32_EQ(CFE_ES_GetPoolBuf(&Buf[i], PoolID2, 32), 32);
+    UtAssert_STUB_COUNT(OS_MutSemTake, 1);
+    UtAssert_UINT32_EQ(CachePtr->Depth[BucketId - 1], Batch - 1);
+
+    /* A corrupted cache entry is dropped and counted, and the request served by the pool */
+    BdPtr = (CFE_ES_GenPoolBD_t *)(PoolPtr->BaseAddr + CachePtr->BlockOffset[BucketId - 1][Batch - 2] -
+                                   CFE_ES_GENERIC_POOL_DESCRIPTOR_SIZE);
+    BdPtr->Allocated = CFE_ES_MEMORY_ALLOCATED + BucketId;
+    i                = PoolPtr->Pool.ValidationErrorCount;
+    UtAssert_INT32_EQ(CFE_ES_GetPoolBuf(&OtherBuf, PoolID2, 32), 32);
+    UtAssert_UINT32_EQ(CachePtr->Depth[BucketId - 1], Batch - 2);
+    UtAssert_UINT32_EQ(PoolPtr->Pool.ValidationErrorCount, i + 1);
+
+    /* Requests that do not fit any block size are rejected as usual */
+    UtAssert_INT32_EQ(CFE_ES_GetPoolBuf(&OtherBuf, PoolID2, 100000), CFE_ES_ERR_MEM_BLOCK_SIZE);
+
+    /* Other tasks claim their own cache, until none are left */
+    for (i = 2; i <= CFE_PLATFORM_ES_MEMPOOL_TASK_CACHES + 1; ++i)
+    {
+        UT_SetDefaultReturnValue(UT_KEY(OS_TaskGetId), i);
+        UtAssert_INT32_EQ(CFE_ES_GetPoolBuf(&OtherBuf, PoolID2, 32), 32);
+        UtAssert_INT32_EQ(CFE_ES_PutPoolBuf(PoolID2, OtherBuf), 32);
+    }
+    UtAssert_UINT32_EQ(PoolPtr->TaskCache[CFE_PLATFORM_ES_MEMPOOL_TASK_CACHES - 1].Depth[BucketId - 1], 1);
+    CFE_UtAssert_SUCCESS(CFE_ES_GetMemPoolStats(&Stats, PoolID2));
+    UtAssert_UINT32_EQ(Stats.BlockStats[PoolPtr->Pool.NumBuckets - BucketId].NumFree,
+                       Batch - 2 + CFE_PLATFORM_ES_MEMPOOL_TASK_CACHES);
+
+    /* Blocks held by a task are returned to the pool when it is deleted, nothing to do for the last one */
+    TaskId = OS_TaskGetId();
+    CFE_ES_MemPoolReleaseTaskCaches(TaskId);
+    UT_SetDefaultReturnValue(UT_KEY(OS_TaskGetId), 2);
+    TaskId = OS_TaskGetId();
+    UT_SetDeferredRetcode(UT_KEY(OS_MutSemTake), 1, OS_ERROR);
+    CFE_ES_MemPoolReleaseTaskCaches(TaskId);
+    UtAssert_BOOL_TRUE(OS_ObjectIdDefined(PoolPtr->TaskCache[1].OwnerTaskId));
+    CFE_ES_MemPoolReleaseTaskCaches(TaskId);
+    UtAssert_BOOL_FALSE(OS_ObjectIdDefined(PoolPtr->TaskCache[1].OwnerTaskId));
+    UtAssert_ZERO(PoolPtr->TaskCache[1].Depth[BucketId - 1]);
+    CFE_UtAssert_SUCCESS(CFE_ES_GetMemPoolStats(&Stats, PoolID2));
+    UtAssert_UINT32_EQ(Stats.BlockStats[PoolPtr->Pool.NumBuckets - BucketId].NumFree,
+                       Batch - 2 + CFE_PLATFORM_ES_MEMPOOL_TASK_CACHES);
+
+    /* Callers that are not OSAL tasks never get a cache */
+    UT_SetHandlerFunction(UT_KEY(OS_TaskGetId), ES_UT_TaskGetIdUndefined, NULL);
+    UtAssert_INT32_EQ(CFE_ES_GetPoolBuf(&OtherBuf, PoolID2, 32), 32);
+    UtAssert_INT32_EQ(CFE_ES_PutPoolBuf(PoolID2, OtherBuf), 32);
+    UtAssert_BOOL_FALSE(OS_ObjectIdDefined(PoolPtr->TaskCache[1].OwnerTaskId));
+}
+
 void TestSysLog(void)
 {
     CFE_ES_SysLogReadBuffer_t SysLogBuffer;
@@ -5593,6 +6966,121 @@ void TestSysLog(void)
     CFE_UtAssert_SUCCESS(CFE_ES_WriteToSysLog("%s", TmpString));
 }
 
+void TestSysLogStage(void)
+{
+    CFE_ES_SysLogStage_t *Stage = &CFE_ES_Global.SysLogStage;
+    uint32                i;
+    uint32                LockedCount;
+
+    UtPrintf("Begin Test Sys Log Staging");
+
+    /* Before the commit job has run, messages are written directly */
+    ES_ResetUnitTest();
+    CFE_ES_SysLogClear_Unsync();
+    CFE_UtAssert_SUCCESS(CFE_ES_WriteToSysLog("UT direct"));
+    UtAssert_UINT32_EQ(CFE_ES_Global.ResetDataPtr->SystemLogEntryNum, 1);
+    UtAssert_ZERO(Stage->ReserveCount);
+
+    /* First run of the commit job enables staging, nothing pending */
+    ES_ResetUnitTest();
+    CFE_ES_SysLogClear_Unsync();
+    UtAssert_BOOL_FALSE(CFE_ES_RunSysLogCommit(0, Stage));
+    UtAssert_BOOL_TRUE(Stage->Active);
+
+    /* Staged messages are not in the log until committed, only the first wakes the background task */
+    CFE_UtAssert_SUCCESS(CFE_ES_WriteToSysLog("UT staged 1"));
+    CFE_UtAssert_SUCCESS(CFE_ES_WriteToSysLog("UT staged 2"));
+    UtAssert_UINT32_EQ(Stage->ReserveCount, 2);
+    UtAssert_ZERO(CFE_ES_Global.ResetDataPtr->SystemLogEntryNum);
+    UtAssert_STUB_COUNT(OS_BinSemGive, 1);
+    UtAssert_STUB_COUNT(OS_printf, 0);
+
+    /* Committed messages are echoed to the console after giving up the lock */
+    LockedCount = 0;
+    UT_SetHookFunction(UT_KEY(OS_printf), ES_UT_CountLockedPrintfHook, &LockedCount);
+    UtAssert_BOOL_FALSE(CFE_ES_RunSysLogCommit(0, Stage));
+    UtAssert_UINT32_EQ(Stage->CommitCount, 2);
+    UtAssert_UINT32_EQ(Stage->EchoCount, 2);
+    UtAssert_UINT32_EQ(CFE_ES_Global.ResetDataPtr->SystemLogEntryNum, 2);
+    UtAssert_STUB_COUNT(OS_printf, 2);
+    UtAssert_ZERO(LockedCount);
+    UT_SetHookFunction(UT_KEY(OS_printf), NULL, NULL);
+    UtAssert_ZERO(strncmp(strstr(CFE_ES_Global.ResetDataPtr->SystemLog, "UT staged"), "UT staged 1\n", 12));
+
+    /* An entry that is reserved but still being written keeps the job active */
+    ++Stage->ReserveCount;
+    UtAssert_BOOL_TRUE(CFE_ES_RunSysLogCommit(0, Stage));
+    UtAssert_UINT32_EQ(Stage->CommitCount, 2);
+    --Stage->ReserveCount;
+
+    /* Once the background task stops, staging stops and anything staged is committed */
+    CFE_UtAssert_SUCCESS(CFE_ES_WriteToSysLog("UT stop"));
+    UtAssert_VOIDCALL(CFE_ES_SysLogStageStop());
+    UtAssert_BOOL_FALSE(Stage->Active);
+    UtAssert_UINT32_EQ(Stage->CommitCount, 3);
+
+    /* When the ring is full, the writer commits the staged entries and appends directly */
+    ES_ResetUnitTest();
+    CFE_ES_SysLogClear_Unsync();
+    Stage->Active = true;
+    for (i = 0; i < CFE_PLATFORM_ES_SYSLOG_STAGE_ENTRIES; ++i)
+    {
+        CFE_UtAssert_SUCCESS(CFE_ES_WriteToSysLog("UT fill %u", (unsigned int)i));
+    }
+    UtAssert_ZERO(CFE_ES_Global.ResetDataPtr->SystemLogEntryNum);
+    CFE_UtAssert_SUCCESS(CFE_ES_WriteToSysLog("UT overflow"));
+    UtAssert_UINT32_EQ(Stage->CommitCount, CFE_PLATFORM_ES_SYSLOG_STAGE_ENTRIES);
+    UtAssert_UINT32_EQ(CFE_ES_Global.ResetDataPtr->SystemLogEntryNum, CFE_PLATFORM_ES_SYSLOG_STAGE_ENTRIES + 1);
+
+    /* Staged entries go ahead of messages written while holding the lock */
+    ES_ResetUnitTest();
+    CFE_ES_SysLogClear_Unsync();
+    Stage->Active = true;
+    CFE_UtAssert_SUCCESS(CFE_ES_WriteToSysLog("UT first"));
+    CFE_UtAssert_SUCCESS(CFE_ES_SysLogWrite_Unsync("UT second"));
+    UtAssert_UINT32_EQ(Stage->CommitCount, 1);
+    UtAssert_NOT_NULL(strstr(CFE_ES_Global.ResetDataPtr->SystemLog, "UT first\n"));
+    UtAssert_True(strstr(CFE_ES_Global.ResetDataPtr->SystemLog, "UT first") <
+                      strstr(CFE_ES_Global.ResetDataPtr->SystemLog, "UT second"),
+                  "Staged message committed first");
+
+    /* The staged entry is left for the background task to echo, as the caller holds the lock */
+    UtAssert_ZERO(Stage->EchoCount);
+    UtAssert_STUB_COUNT(OS_BinSemGive, 2);
+    UtAssert_STUB_COUNT(OS_printf, 1);
+    UtAssert_BOOL_FALSE(CFE_ES_RunSysLogCommit(0, Stage));
+    UtAssert_UINT32_EQ(Stage->EchoCount, 1);
+    UtAssert_STUB_COUNT(OS_printf, 2);
+
+    /* An entry that was already echoed and released is not echoed again */
+    CFE_UtAssert_SUCCESS(CFE_ES_WriteToSysLog("UT echoed"));
+    CFE_ES_SysLogCommit_Unsync();
+    Stage->EchoCount = Stage->CommitCount;
+    UtAssert_VOIDCALL(CFE_ES_SysLogEcho());
+    UtAssert_STUB_COUNT(OS_printf, 2);
+
+    /* Clearing and dumping the log commit staged entries first */
+    ES_ResetUnitTest();
+    CFE_ES_SysLogClear_Unsync();
+    Stage->Active = true;
+    CFE_UtAssert_SUCCESS(CFE_ES_WriteToSysLog("UT clear"));
+    UtAssert_INT32_EQ(CFE_ES_ClearSysLogCmd(NULL), CFE_SUCCESS);
+    UtAssert_UINT32_EQ(Stage->CommitCount, 1);
+    UtAssert_ZERO(CFE_ES_Global.ResetDataPtr->SystemLogEntryNum);
+    CFE_UtAssert_SUCCESS(CFE_ES_WriteToSysLog("UT dump"));
+    UtAssert_VOIDCALL(CFE_ES_SysLogDump("fakefilename"));
+    UtAssert_UINT32_EQ(Stage->CommitCount, 2);
+
+    /* In discard mode, a staged write reports a full log */
+    ES_ResetUnitTest();
+    CFE_ES_SysLogClear_Unsync();
+    Stage->Active                                 = true;
+    CFE_ES_Global.ResetDataPtr->SystemLogMode     = CFE_ES_LogMode_DISCARD;
+    CFE_ES_Global.ResetDataPtr->SystemLogWriteIdx = CFE_PLATFORM_ES_SYSTEM_LOG_SIZE - 1;
+    UtAssert_INT32_EQ(CFE_ES_WriteToSysLog("UT discard"), CFE_ES_ERR_SYS_LOG_FULL);
+    UtAssert_UINT32_EQ(Stage->ReserveCount, 1);
+}
+
 void TestBackground(void)
 {
     /* CFE_ES_BackgroundInit() with default setup
@@ -5618,6 +7106,7 @@ void TestBackground(void)
      * execute the code which counts the number of active jobs.
      */
     ES_ResetUnitTest();
+    UtAssert_INT32_EQ(CFE_ES_BackgroundInit(), CFE_ES_ERR_RESOURCEID_NOT_VALID);
     memset(&CFE_ES_Global.BackgroundPerfDumpState, 0, sizeof(CFE_ES_Global.BackgroundPerfDumpState));
     UT_SetDefaultReturnValue(UT_KEY(OS_write), -10);
     CFE_ES_Global.BackgroundPerfDumpState.CurrentState = CFE_ES_PerfDumpState_INIT;
@@ -5628,6 +7117,235 @@ void TestBackground(void)
 
     /* The number of jobs running should be 1 (perf log dump) */
     UtAssert_UINT32_EQ(CFE_ES_Global.BackgroundTask.NumJobsRunning, 1);
+
+    /* Failure to create the semaphore */
+    ES_ResetUnitTest();
+    UT_SetDeferredRetcode(UT_KEY(OS_BinSemCreate), 1, OS_ERROR);
+    UtAssert_INT32_EQ(CFE_ES_BackgroundInit(), CFE_STATUS_EXTERNAL_RESOURCE_FAIL);
+
+    /* Failure to register a built-in job, because it already exists */
+    ES_ResetUnitTest();
+    UtAssert_INT32_EQ(CFE_ES_BackgroundInit(), CFE_ES_ERR_RESOURCEID_NOT_VALID);
+    UtAssert_INT32_EQ(CFE_ES_BackgroundInit(), CFE_ES_ERR_DUPLICATE_NAME);
+
+    /* Successful init, with the built-in jobs owned by ES */
+    ES_ResetUnitTest();
+    ES_UT_SetupSingleAppId(CFE_ES_AppType_CORE, CFE_ES_AppState_RUNNING, "CFE_ES", NULL, NULL);
+    CFE_UtAssert_SUCCESS(CFE_ES_BackgroundInit());
+    UtAssert_STUB_COUNT(OS_TaskCreate, 2);
+
+    /* Cleanup also stops any additional workers */
+    CFE_ES_Global.BackgroundTask.NumWorkers = 1;
+    UtAssert_VOIDCALL(CFE_ES_BackgroundCleanup());
+    UtAssert_UINT32_EQ(CFE_ES_Global.BackgroundTask.NumWorkers, 0);
+
+    /* An additional worker runs the same loop */
+    ES_ResetUnitTest();
+    UT_SetDeferredRetcode(UT_KEY(OS_BinSemTimedWait), 1, -4);
+    UtAssert_VOIDCALL(CFE_ES_BackgroundWorkerTask());
+    CFE_UtAssert_PRINTF(UT_OSP_MESSAGES[UT_OSP_BACKGROUND_TAKE]);
+}
+
+/*
+ * Background job functions for the scheduler tests.  Each call appends
+ * the job argument to a log so the call order can be checked.
+ */
+static uint32 UT_BackgroundJobLog[8];
+static uint32 UT_BackgroundJobLogCount;
+static bool   UT_BackgroundJobIsActive;
+
+static bool UT_BackgroundJob(uint32 ElapsedTime, void *Arg)
+{
+    if (UT_BackgroundJobLogCount < (sizeof(UT_BackgroundJobLog) / sizeof(UT_BackgroundJobLog[0])))
+    {
+        UT_BackgroundJobLog[UT_BackgroundJobLogCount] = *((uint32 *)Arg);
+        ++UT_BackgroundJobLogCount;
+    }
+
+    return UT_BackgroundJobIsActive;
+}
+
+static bool UT_BackgroundJobDeleteSelf(uint32 ElapsedTime, void *Arg)
+{
+    CFE_ES_BackgroundJobId_t *JobIdPtr = Arg;
+
+    /* The first delete is deferred until the call returns, a second one is rejected */
+    CFE_UtAssert_SUCCESS(CFE_ES_DeleteBackgroundJob(*JobIdPtr));
+    UtAssert_INT32_EQ(CFE_ES_DeleteBackgroundJob(*JobIdPtr), CFE_ES_ERR_RESOURCEID_NOT_VALID);
+
+    return true;
+}
+
+static void UT_BackgroundResetJobLog(bool IsActive)
+{
+    memset(UT_BackgroundJobLog, 0, sizeof(UT_BackgroundJobLog));
+    UT_BackgroundJobLogCount = 0;
+    UT_BackgroundJobIsActive = IsActive;
+}
+
+void TestBackgroundJobs(void)
+{
+    CFE_ES_BackgroundJobId_t      JobId[3];
+    CFE_ES_BackgroundJobInfo_t    JobInfo;
+    CFE_ES_BackgroundJobRecord_t *JobRecPtr;
+    CFE_ES_AppRecord_t *          AppRecPtr;
+    uint32                        JobArg[3] = {1, 2, 3};
+    uint32                        Idx;
+    char                          LongName[OS_MAX_API_NAME + 1];
+
+    UtPrintf("Begin Test Background Jobs");
+
+    /* Invalid arguments */
+    ES_ResetUnitTest();
+    memset(LongName, 'x', sizeof(LongName) - 1);
+    LongName[sizeof(LongName) - 1] = 0;
+    UtAssert_INT32_EQ(CFE_ES_RegisterBackgroundJob(NULL, "UT", UT_BackgroundJob, NULL, 1, 1, 1), CFE_ES_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(CFE_ES_RegisterBackgroundJob(&JobId[0], NULL, UT_BackgroundJob, NULL, 1, 1, 1),
+                      CFE_ES_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(CFE_ES_RegisterBackgroundJob(&JobId[0], "UT", NULL, NULL, 1, 1, 1), CFE_ES_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(CFE_ES_RegisterBackgroundJob(&JobId[0], LongName, UT_BackgroundJob, NULL, 1, 1, 1),
+                      CFE_ES_BAD_ARGUMENT);
+    UtAssert_BOOL_FALSE(CFE_RESOURCEID_TEST_DEFINED(JobId[0]));
+    UtAssert_INT32_EQ(CFE_ES_RegisterBackgroundJob(&JobId[0], "UT", UT_BackgroundJob, NULL, 0, 1, 1),
+                      CFE_ES_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(CFE_ES_RegisterBackgroundJob(&JobId[0], "UT", UT_BackgroundJob, NULL, 1, 0, 1),
+                      CFE_ES_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(CFE_ES_GetBackgroundJobInfo(NULL, JobId[0]), CFE_ES_BAD_ARGUMENT);
+
+    /* The caller must be an app */
+    UtAssert_INT32_EQ(CFE_ES_RegisterBackgroundJob(&JobId[0], "UT", UT_BackgroundJob, NULL, 1, 1, 1),
+                      CFE_ES_ERR_RESOURCEID_NOT_VALID);
+
+    /* Nominal registration, lookup and deletion */
+    ES_ResetUnitTest();
+    ES_UT_SetupSingleAppId(CFE_ES_AppType_EXTERNAL, CFE_ES_AppState_RUNNING, "UT", &AppRecPtr, NULL);
+    CFE_UtAssert_SUCCESS(CFE_ES_RegisterBackgroundJob(&JobId[0], "UT1", UT_BackgroundJob, &JobArg[0], 10, 100, 5));
+    CFE_UtAssert_RESOURCEID_EQ(CFE_ES_BackgroundJobRecordGetID(CFE_ES_LocateBackgroundJobRecordByName("UT1")),
+                               JobId[0]);
+    UtAssert_NULL(CFE_ES_LocateBackgroundJobRecordByName("UT2"));
+    CFE_UtAssert_SUCCESS(CFE_ES_BackgroundJobID_ToIndex(JobId[0], &Idx));
+    UtAssert_UINT32_LT(Idx, CFE_PLATFORM_ES_MAX_BACKGROUND_JOBS);
+    UtAssert_INT32_EQ(CFE_ES_RegisterBackgroundJob(&JobId[1], "UT1", UT_BackgroundJob, NULL, 10, 100, 5),
+                      CFE_ES_ERR_DUPLICATE_NAME);
+    UtAssert_BOOL_FALSE(CFE_RESOURCEID_TEST_DEFINED(JobId[1]));
+
+    CFE_UtAssert_SUCCESS(CFE_ES_GetBackgroundJobInfo(&JobInfo, JobId[0]));
+    CFE_UtAssert_RESOURCEID_EQ(JobInfo.JobId, JobId[0]);
+    CFE_UtAssert_RESOURCEID_EQ(JobInfo.AppId, CFE_ES_AppRecordGetID(AppRecPtr));
+    UtAssert_STRINGBUF_EQ(JobInfo.JobName, sizeof(JobInfo.JobName), "UT1", -1);
+    UtAssert_UINT32_EQ(JobInfo.Priority, 5);
+    UtAssert_UINT32_EQ(JobInfo.ActivePeriod, 10);
+    UtAssert_UINT32_EQ(JobInfo.IdlePeriod, 100);
+    UtAssert_UINT32_EQ(JobInfo.RunCount, 0);
+
+    CFE_UtAssert_SUCCESS(CFE_ES_DeleteBackgroundJob(JobId[0]));
+    UtAssert_INT32_EQ(CFE_ES_DeleteBackgroundJob(JobId[0]), CFE_ES_ERR_RESOURCEID_NOT_VALID);
+    UtAssert_INT32_EQ(CFE_ES_GetBackgroundJobInfo(&JobInfo, JobId[0]), CFE_ES_ERR_RESOURCEID_NOT_VALID);
+    UtAssert_BOOL_FALSE(CFE_RESOURCEID_TEST_DEFINED(JobInfo.JobId));
+    UtAssert_INT32_EQ(CFE_ES_BackgroundJobID_ToIndex(CFE_ES_BGJOBID_UNDEFINED, &Idx),
+                      CFE_ES_ERR_RESOURCEID_NOT_VALID);
+
+    /* No free slots */
+    ES_ResetUnitTest();
+    ES_UT_SetupSingleAppId(CFE_ES_AppType_EXTERNAL, CFE_ES_AppState_RUNNING, "UT", NULL, NULL);
+    UT_SetDefaultReturnValue(UT_KEY(CFE_ResourceId_FindNextFree), OS_ERROR);
+    UtAssert_INT32_EQ(CFE_ES_RegisterBackgroundJob(&JobId[0], "UTX", UT_BackgroundJob, NULL, 10, 100, 5),
+                      CFE_ES_NO_RESOURCE_IDS_AVAILABLE);
+    CFE_UtAssert_PRINTF("No free Background Job slots available");
+
+    /*
+     * Jobs that are due together are called lowest priority value first,
+     * then in order of their due time.  With the time held constant, every
+     * job is called once and is then not due until its period has passed.
+     */
+    ES_ResetUnitTest();
+    ES_UT_SetupSingleAppId(CFE_ES_AppType_EXTERNAL, CFE_ES_AppState_RUNNING, "UT", NULL, NULL);
+    UT_BackgroundResetJobLog(false);
+    CFE_UtAssert_SUCCESS(CFE_ES_RegisterBackgroundJob(&JobId[0], "UT1", UT_BackgroundJob, &JobArg[0], 10, 100, 50));
+    CFE_UtAssert_SUCCESS(CFE_ES_RegisterBackgroundJob(&JobId[1], "UT2", UT_BackgroundJob, &JobArg[1], 10, 100, 5));
+    CFE_UtAssert_SUCCESS(CFE_ES_RegisterBackgroundJob(&JobId[2], "UT3", UT_BackgroundJob, &JobArg[2], 10, 100, 50));
+    JobRecPtr              = CFE_ES_LocateBackgroundJobRecordByID(JobId[0]);
+    JobRecPtr->NextRunTime = OS_TimeAdd(JobRecPtr->NextRunTime, OS_TimeFromTotalMilliseconds(-1));
+    UT_SetDeferredRetcode(UT_KEY(OS_BinSemTimedWait), 1, -4);
+    UtAssert_VOIDCALL(CFE_ES_BackgroundTask());
+    UtAssert_UINT32_EQ(UT_BackgroundJobLogCount, 3);
+    UtAssert_UINT32_EQ(UT_BackgroundJobLog[0], 2);
+    UtAssert_UINT32_EQ(UT_BackgroundJobLog[1], 1);
+    UtAssert_UINT32_EQ(UT_BackgroundJobLog[2], 3);
+    CFE_UtAssert_SUCCESS(CFE_ES_GetBackgroundJobInfo(&JobInfo, JobId[1]));
+    UtAssert_UINT32_EQ(JobInfo.RunCount, 1);
+    UtAssert_UINT32_EQ(JobInfo.ActiveCount, 0);
+    UtAssert_UINT32_EQ(JobInfo.LateCount, 0);
+    UtAssert_BOOL_FALSE(JobInfo.IsRunning);
+
+    /* A wakeup makes all jobs due right away, and extra workers are passed the baton */
+    UT_BackgroundResetJobLog(true);
+    CFE_ES_Global.BackgroundTask.NumWorkers = 1;
+    UT_ResetState(UT_KEY(OS_BinSemGive));
+    UtAssert_VOIDCALL(CFE_ES_BackgroundWakeup());
+    UT_SetDeferredRetcode(UT_KEY(OS_BinSemTimedWait), 1, -4);
+    UtAssert_VOIDCALL(CFE_ES_BackgroundTask());
+    UtAssert_UINT32_EQ(UT_BackgroundJobLogCount, 3);
+    UtAssert_STUB_COUNT(OS_BinSemGive, 3);
+    UtAssert_UINT32_EQ(CFE_ES_Global.BackgroundTask.NumJobsRunning, 3);
+    CFE_UtAssert_SUCCESS(CFE_ES_GetBackgroundJobInfo(&JobInfo, JobId[1]));
+    UtAssert_UINT32_EQ(JobInfo.RunCount, 2);
+    UtAssert_UINT32_EQ(JobInfo.ActiveCount, 1);
+    UtAssert_BOOL_TRUE(JobInfo.IsActive);
+
+    /* Deleting an active job also updates the number of active jobs */
+    CFE_UtAssert_SUCCESS(CFE_ES_DeleteBackgroundJob(JobId[0]));
+    UtAssert_UINT32_EQ(CFE_ES_Global.BackgroundTask.NumJobsRunning, 2);
+
+    /* A job that started a whole period late is counted as late */
+    JobRecPtr              = CFE_ES_LocateBackgroundJobRecordByID(JobId[1]);
+    JobRecPtr->NextRunTime = OS_TimeAdd(JobRecPtr->LastRunTime, OS_TimeFromTotalMilliseconds(-500));
+    UT_BackgroundResetJobLog(false);
+    UT_SetDeferredRetcode(UT_KEY(OS_BinSemTimedWait), 1, -4);
+    UtAssert_VOIDCALL(CFE_ES_BackgroundTask());
+    UtAssert_UINT32_EQ(UT_BackgroundJobLogCount, 1);
+    CFE_UtAssert_SUCCESS(CFE_ES_GetBackgroundJobInfo(&JobInfo, JobId[1]));
+    UtAssert_UINT32_EQ(JobInfo.LateCount, 1);
+    UtAssert_UINT32_EQ(JobInfo.MaxStartDelayMsec, 500);
+
+    /* A job that deletes itself while it is being called is freed when it returns */
+    ES_ResetUnitTest();
+    ES_UT_SetupSingleAppId(CFE_ES_AppType_EXTERNAL, CFE_ES_AppState_RUNNING, "UT", NULL, NULL);
+    CFE_UtAssert_SUCCESS(
+        CFE_ES_RegisterBackgroundJob(&JobId[0], "UT1", UT_BackgroundJobDeleteSelf, &JobId[0], 10, 100, 5));
+    UT_SetDeferredRetcode(UT_KEY(OS_BinSemTimedWait), 1, -4);
+    UtAssert_VOIDCALL(CFE_ES_BackgroundTask());
+    UtAssert_INT32_EQ(CFE_ES_GetBackgroundJobInfo(&JobInfo, JobId[0]), CFE_ES_ERR_RESOURCEID_NOT_VALID);
+    UtAssert_UINT32_EQ(CFE_ES_Global.BackgroundTask.NumJobsRunning, 0);
+    UtAssert_NULL(CFE_ES_LocateBackgroundJobRecordByName("UT1"));
+
+    /* Jobs are deleted along with the app that registered them */
+    ES_ResetUnitTest();
+    ES_UT_SetupSingleAppId(CFE_ES_AppType_EXTERNAL, CFE_ES_AppState_RUNNING, "UT", &AppRecPtr, NULL);
+    CFE_UtAssert_SUCCESS(CFE_ES_RegisterBackgroundJob(&JobId[0], "UT1", UT_BackgroundJob, &JobArg[0], 10, 100, 5));
+    CFE_UtAssert_SUCCESS(CFE_ES_RegisterBackgroundJob(&JobId[1], "UT2", UT_BackgroundJob, &JobArg[1], 10, 100, 5));
+    CFE_UtAssert_SUCCESS(CFE_ES_BackgroundCleanUpApp(CFE_ES_AppRecordGetID(AppRecPtr)));
+    UtAssert_INT32_EQ(CFE_ES_GetBackgroundJobInfo(&JobInfo, JobId[0]), CFE_ES_ERR_RESOURCEID_NOT_VALID);
+    UtAssert_INT32_EQ(CFE_ES_GetBackgroundJobInfo(&JobInfo, JobId[1]), CFE_ES_ERR_RESOURCEID_NOT_VALID);
+    UtAssert_STUB_COUNT(OS_TaskDelay, 0);
+
+    /* A job of the app that does not return in time is reported */
+    CFE_UtAssert_SUCCESS(CFE_ES_RegisterBackgroundJob(&JobId[0], "UT1", UT_BackgroundJob, &JobArg[0], 10, 100, 5));
+    CFE_ES_LocateBackgroundJobRecordByID(JobId[0])->IsRunning = true;
+    UtAssert_INT32_EQ(CFE_ES_BackgroundCleanUpApp(CFE_ES_AppRecordGetID(AppRecPtr)), CFE_ES_APP_CLEANUP_ERR);
+    UtAssert_STUB_COUNT(OS_TaskDelay, 100);
+    CFE_UtAssert_PRINTF("still running");
+    UtAssert_BOOL_TRUE(CFE_ES_LocateBackgroundJobRecordByID(JobId[0])->DeletePending);
+
+    /* The app cleanup fails and its module stays loaded while one of its jobs is still being called */
+    ES_ResetUnitTest();
+    ES_UT_SetupSingleAppId(CFE_ES_AppType_EXTERNAL, CFE_ES_AppState_RUNNING, "UT", &AppRecPtr, NULL);
+    OS_ModuleLoad(&AppRecPtr->LoadStatus.ModuleId, NULL, NULL, 0);
+    CFE_UtAssert_SUCCESS(CFE_ES_RegisterBackgroundJob(&JobId[0], "UT1", UT_BackgroundJob, &JobArg[0], 10, 100, 5));
+    CFE_ES_LocateBackgroundJobRecordByID(JobId[0])->IsRunning = true;
+    UtAssert_INT32_EQ(CFE_ES_CleanUpApp(CFE_ES_AppRecordGetID(AppRecPtr)), CFE_ES_APP_CLEANUP_ERR);
+    UtAssert_STUB_COUNT(OS_ModuleUnload, 0);
+    CFE_UtAssert_PRINTF("not unloaded");
 }
 
 /*--------------------------------------------------------------------------------*
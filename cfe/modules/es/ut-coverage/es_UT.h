@@ -162,6 +162,22 @@ void TestTask(void);
 ******************************************************************************/
 void TestBackground(void);
 
+/*****************************************************************************/
+/**
+** \brief Performs tests on the background job registration and scheduler
+**
+** \par Description
+**        This function tests registering, scheduling and deleting background
+**        jobs.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void TestBackgroundJobs(void);
+
 /*****************************************************************************/
 /**
 ** \brief Performs tests on the functions that implement the software timing
@@ -178,6 +194,39 @@ void TestBackground(void);
 ******************************************************************************/
 void TestPerf(void);
 
+/*****************************************************************************/
+/**
+** \brief Performs tests on the shared data lock profiler functions
+**        contained in cfe_es_lockprof.c
+**
+** \par Description
+**        This function tests the lock profile accounting and the command
+**        to write it to a file.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void TestLockProfile(void);
+
+/*****************************************************************************/
+/**
+** \brief Perform tests on the ES task pool job submission and accounting
+**
+** \par Description
+**        This function tests submitting jobs to the shared task pool on
+**        behalf of an application and the per-app job accounting.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void TestTaskPool(void);
+
 /*****************************************************************************/
 /**
 ** \brief Perform tests on the ES API functions contained in cfe_es_api.c
@@ -242,11 +291,15 @@ void TestCDSMempool(void);
 **        This function does not return a value.
 ******************************************************************************/
 void TestESMempool(void);
+void TestESMempoolTaskCache(void);
 
 void TestSysLog(void);
+void TestSysLogStage(void);
 void TestResourceID(void);
 void TestGenericCounterAPI(void);
 void TestGenericPool(void);
+void TestGenericPoolCoalescing(void);
+void TestGenericPoolCache(void);
 void TestLibs(void);
 void TestStatusToString(void);
 
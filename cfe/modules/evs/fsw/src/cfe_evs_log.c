@@ -40,7 +40,7 @@
 void EVS_AddLog(CFE_EVS_LongEventTlm_t *EVS_PktPtr)
 {
     /* Serialize access to event log control variables */
-    OS_MutSemTake(CFE_EVS_Global.EVS_SharedDataMutexID);
+    CFE_EVS_LockSharedData(__func__, __LINE__);
 
     if ((CFE_EVS_Global.EVS_LogPtr->LogFullFlag == true) &&
         (CFE_EVS_Global.EVS_LogPtr->LogMode == CFE_EVS_LogMode_DISCARD))
@@ -80,7 +80,7 @@ void EVS_AddLog(CFE_EVS_LongEventTlm_t *EVS_PktPtr)
         }
     }
 
-    OS_MutSemGive(CFE_EVS_Global.EVS_SharedDataMutexID);
+    CFE_EVS_UnlockSharedData(__func__, __LINE__);
 }
 
 /*----------------------------------------------------------------
@@ -92,7 +92,7 @@ void EVS_AddLog(CFE_EVS_LongEventTlm_t *EVS_PktPtr)
 void EVS_ClearLog(void)
 {
     /* Serialize access to event log control variables */
-    OS_MutSemTake(CFE_EVS_Global.EVS_SharedDataMutexID);
+    CFE_EVS_LockSharedData(__func__, __LINE__);
 
     /* Clears everything but LogMode (overwrite vs discard) */
     CFE_EVS_Global.EVS_LogPtr->Next               = 0;
@@ -102,7 +102,7 @@ void EVS_ClearLog(void)
 
     memset(CFE_EVS_Global.EVS_LogPtr->LogEntry, 0, sizeof(CFE_EVS_Global.EVS_LogPtr->LogEntry));
 
-    OS_MutSemGive(CFE_EVS_Global.EVS_SharedDataMutexID);
+    CFE_EVS_UnlockSharedData(__func__, __LINE__);
 }
 
 /*----------------------------------------------------------------
@@ -164,7 +164,7 @@ int32 CFE_EVS_WriteLogDataFileCmd(const CFE_EVS_WriteLogDataFileCmd_t *data)
         if (BytesWritten == sizeof(LogFileHdr))
         {
             /* Serialize access to event log control variables */
-            OS_MutSemTake(CFE_EVS_Global.EVS_SharedDataMutexID);
+            CFE_EVS_LockSharedData(__func__, __LINE__);
 
             /* Is the log full? -- Doesn't matter if wrap mode is enabled */
             if (CFE_EVS_Global.EVS_LogPtr->LogCount == CFE_PLATFORM_EVS_LOG_MAX)
@@ -199,7 +199,7 @@ int32 CFE_EVS_WriteLogDataFileCmd(const CFE_EVS_WriteLogDataFileCmd_t *data)
                 }
             }
 
-            OS_MutSemGive(CFE_EVS_Global.EVS_SharedDataMutexID);
+            CFE_EVS_UnlockSharedData(__func__, __LINE__);
 
             /* Process command handler success result */
             if (i == CFE_EVS_Global.EVS_LogPtr->LogCount)
@@ -243,9 +243,9 @@ int32 CFE_EVS_SetLogModeCmd(const CFE_EVS_SetLogModeCmd_t *data)
     if ((CmdPtr->LogMode == CFE_EVS_LogMode_OVERWRITE) || (CmdPtr->LogMode == CFE_EVS_LogMode_DISCARD))
     {
         /* Serialize access to event log control variables */
-        OS_MutSemTake(CFE_EVS_Global.EVS_SharedDataMutexID);
+        CFE_EVS_LockSharedData(__func__, __LINE__);
         CFE_EVS_Global.EVS_LogPtr->LogMode = CmdPtr->LogMode;
-        OS_MutSemGive(CFE_EVS_Global.EVS_SharedDataMutexID);
+        CFE_EVS_UnlockSharedData(__func__, __LINE__);
 
         EVS_SendEvent(CFE_EVS_LOGMODE_EID, CFE_EVS_EventType_DEBUG, "Set Log Mode Command: Log Mode = %d",
                       (int)CmdPtr->LogMode);
@@ -45,4 +45,9 @@
 #include "cfe_evs_utils.h"    /* EVS utility function definitions */
 #include "cfe_evs_dispatch.h"
 
+/*
+ * Additionally EVS reports its shared data lock to the ES lock profiler
+ */
+#include "cfe_es_core_internal.h"
+
 #endif /* CFE_EVS_MODULE_ALL_H */
@@ -314,7 +314,7 @@ bool EVS_CheckAndIncrementSquelchTokens(EVS_AppData_t *AppDataPtr)
          * We use a timer here since configurations are not guaranteed to send EVS HK wakeups at 1Hz
          * Use a non-settable timer to prevent this from breaking w/ time changes
          */
-        OS_MutSemTake(CFE_EVS_Global.EVS_SharedDataMutexID);
+        CFE_EVS_LockSharedData(__func__, __LINE__);
         CFE_PSP_GetTime(&CurrentTime);
         DeltaTimeMs = OS_TimeGetTotalMilliseconds(OS_TimeSubtract(CurrentTime, AppDataPtr->LastSquelchCreditableTime));
 
@@ -382,7 +382,7 @@ bool EVS_CheckAndIncrementSquelchTokens(EVS_AppData_t *AppDataPtr)
             AppDataPtr->SquelchTokens -= EVENT_COST;
         }
 
-        OS_MutSemGive(CFE_EVS_Global.EVS_SharedDataMutexID);
+        CFE_EVS_UnlockSharedData(__func__, __LINE__);
 
         if (SendSquelchEvent)
         {
@@ -620,3 +620,58 @@ int32 EVS_SendEvent(uint16 EventID, uint16 EventType, const char *Spec, ...)
 
     return CFE_SUCCESS;
 }
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_EVS_LockSharedData(const char *FunctionName, int32 LineNumber)
+{
+    int32                    OsStatus;
+    CFE_ES_AppId_t           AppId;
+    CFE_ES_LockProfileWait_t ProfileWait;
+
+    if (CFE_PLATFORM_ES_LOCK_PROFILE)
+    {
+        CFE_ES_LockProfileWait(CFE_ES_LockProfileLock_EVS_SHARED_DATA, &ProfileWait);
+    }
+
+    OsStatus = OS_MutSemTake(CFE_EVS_Global.EVS_SharedDataMutexID);
+    if (OsStatus != OS_SUCCESS)
+    {
+        CFE_ES_GetAppID(&AppId);
+        CFE_ES_WriteToSysLog("%s: SharedData Mutex Take Err Stat=%ld,App=%lu,Function=%s\n", __func__, (long)OsStatus,
+                             CFE_RESOURCEID_TO_ULONG(AppId), FunctionName);
+    }
+    else if (CFE_PLATFORM_ES_LOCK_PROFILE)
+    {
+        CFE_ES_LockProfileAcquired(CFE_ES_LockProfileLock_EVS_SHARED_DATA, &ProfileWait, FunctionName, LineNumber);
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_EVS_UnlockSharedData(const char *FunctionName, int32 LineNumber)
+{
+    int32          OsStatus;
+    CFE_ES_AppId_t AppId;
+
+    if (CFE_PLATFORM_ES_LOCK_PROFILE)
+    {
+        CFE_ES_LockProfileRelease(CFE_ES_LockProfileLock_EVS_SHARED_DATA);
+    }
+
+    OsStatus = OS_MutSemGive(CFE_EVS_Global.EVS_SharedDataMutexID);
+    if (OsStatus != OS_SUCCESS)
+    {
+        CFE_ES_GetAppID(&AppId);
+        CFE_ES_WriteToSysLog("%s: SharedData Mutex Give Err Stat=%ld,App=%lu,Function=%s\n", __func__, (long)OsStatus,
+                             CFE_RESOURCEID_TO_ULONG(AppId), FunctionName);
+    }
+}
@@ -252,4 +252,22 @@ void EVS_GenerateEventTelemetry(EVS_AppData_t *AppDataPtr, uint16 EventID, uint1
  */
 int32 EVS_SendEvent(uint16 EventID, uint16 EventType, const char *Spec, ...);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Obtains exclusive access to the EVS shared data (log and squelch state)
+ *
+ * @param FunctionName The name of the calling function
+ * @param LineNumber   The line number of the call
+ */
+void CFE_EVS_LockSharedData(const char *FunctionName, int32 LineNumber);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Releases exclusive access to the EVS shared data (log and squelch state)
+ *
+ * @param FunctionName The name of the calling function
+ * @param LineNumber   The line number of the call
+ */
+void CFE_EVS_UnlockSharedData(const char *FunctionName, int32 LineNumber);
+
 #endif /* CFE_EVS_UTILS_H */
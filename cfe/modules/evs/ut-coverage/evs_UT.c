@@ -55,7 +55,9 @@ static const char *EVS_SYSLOG_MSGS[] = {
     "%s: Call to CFE_EVS_Register Failed:RC=0x%08X\n",
     "%s: Call to CFE_SB_CreatePipe Failed:RC=0x%08X\n",
     "%s: Subscribing to Cmds Failed:RC=0x%08X\n",
-    "%s: Subscribing to HK Request Failed:RC=0x%08X\n"};
+    "%s: Subscribing to HK Request Failed:RC=0x%08X\n",
+    "%s: SharedData Mutex Take Err Stat=%ld,App=%lu,Function=%s\n",
+    "%s: SharedData Mutex Give Err Stat=%ld,App=%lu,Function=%s\n"};
 
 static const UT_TaskPipeDispatchId_t UT_TPID_CFE_EVS_CMD_NOOP_CC = {.MsgId = CFE_SB_MSGID_WRAP_VALUE(CFE_EVS_CMD_MID),
                                                                     .CommandCode = CFE_EVS_NOOP_CC};
@@ -2124,4 +2126,20 @@ void Test_Misc(void)
         EVS_AppDataSetUsed(&CFE_EVS_Global.AppData[i], AppID);
     }
     UtAssert_UINT32_EQ(CFE_EVS_ReportHousekeepingCmd(NULL), CFE_STATUS_NO_COUNTER_INCREMENT);
+
+    /* Test locking and unlocking of the shared data */
+    UT_InitData_EVS();
+    CFE_EVS_LockSharedData(__func__, __LINE__);
+    CFE_EVS_UnlockSharedData(__func__, __LINE__);
+    UtAssert_STUB_COUNT(CFE_ES_WriteToSysLog, 0);
+
+    /* Test locking and unlocking of the shared data with mutex errors */
+    UT_InitData_EVS();
+    UT_SetDeferredRetcode(UT_KEY(OS_MutSemTake), 1, OS_ERROR);
+    CFE_EVS_LockSharedData(__func__, __LINE__);
+    CFE_UtAssert_SYSLOG(EVS_SYSLOG_MSGS[15]);
+    UT_InitData_EVS();
+    UT_SetDeferredRetcode(UT_KEY(OS_MutSemGive), 1, OS_ERROR);
+    CFE_EVS_UnlockSharedData(__func__, __LINE__);
+    CFE_UtAssert_SYSLOG(EVS_SYSLOG_MSGS[16]);
 }
@@ -0,0 +1,31 @@
+###########################################################
+#
+# FS Core Module platform build setup
+#
+# This file is evaluated as part of the "prepare" stage
+# and can be used to set up prerequisites for the build,
+# such as generating header files
+#
+###########################################################
+
+# The list of header files that control the FS configuration
+set(FS_PLATFORM_CONFIG_FILE_LIST
+  cfe_fs_internal_cfg.h
+  cfe_fs_platform_cfg.h
+)
+
+# Create wrappers around the all the config header files
+# This makes them individually overridable by the missions, without modifying
+# the distribution default copies
+foreach(FS_CFGFILE ${FS_PLATFORM_CONFIG_FILE_LIST})
+  get_filename_component(CFGKEY "${FS_CFGFILE}" NAME_WE)
+  if (DEFINED FS_CFGFILE_SRC_${CFGKEY})
+    set(DEFAULT_SOURCE "${FS_CFGFILE_SRC_${CFGKEY}}")
+  else()
+    set(DEFAULT_SOURCE "${CMAKE_CURRENT_LIST_DIR}/config/default_${FS_CFGFILE}")
+  endif()
+  generate_config_includefile(
+    FILE_NAME           "${FS_CFGFILE}"
+    FALLBACK_FILE       ${DEFAULT_SOURCE}
+  )
+endforeach()
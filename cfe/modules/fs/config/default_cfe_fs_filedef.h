@@ -165,7 +165,28 @@ enum CFE_FS_SubType
      * command.
      *
      */
-    CFE_FS_SubType_ES_QUERYALLTASKS = 23
+    CFE_FS_SubType_ES_QUERYALLTASKS = 23,
+
+    /**
+     * @brief Executive Services Compact Performance Data File
+     *
+     * Executive Services Performance Analyzer Data File using the compact
+     * delta-encoded entry format, generated in response to a
+     * \link #CFE_ES_STOP_PERF_DATA_CC \ES_STOPLADATA \endlink
+     * command when #CFE_PLATFORM_ES_PERF_DUMP_COMPACT is enabled.
+     *
+     */
+    CFE_FS_SubType_ES_PERFDATA_COMPACT = 24,
+
+    /**
+     * @brief Executive Services Lock Profile Data File
+     *
+     * Executive Services shared data lock profile which is generated in response to a
+     * \link #CFE_ES_WRITE_LOCK_PROFILE_CC \ES_WRITELOCKPROF \endlink
+     * command.
+     *
+     */
+    CFE_FS_SubType_ES_LOCKPROFILE = 25
 };
 
 /**
@@ -0,0 +1,67 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   CFE File Services (CFE_FS) Application Private Config Definitions
+ *
+ * This provides default values for configurable items that are internal
+ * to this module and do NOT affect the interface(s) of this module.  Changes
+ * to items in this file only affect the local module and will be transparent
+ * to external entities that are using the public interface(s).
+ *
+ * @note This file may be overridden/superceded by mission-provided defintions
+ * either by overriding this header or by generating definitions from a command/data
+ * dictionary tool.
+ */
+#ifndef CFE_FS_INTERNAL_CFG_H
+#define CFE_FS_INTERNAL_CFG_H
+
+/**
+**  \cfeescfg Define Background File Write Block Size
+**
+**  \par Description:
+**       Records of a background file write (such as the ER log, SB info and
+**       TBL registry dumps) are staged in a buffer of this size and written
+**       to the file one block at a time, rather than one write call per record.
+**       Records larger than the block size are written directly.
+**
+**  \par Limits
+**       There is a lower limit of 1.  The buffer is allocated statically, so
+**       the upper limit is only bounded by the available memory.  A multiple
+**       of the file system block size is most efficient.
+*/
+#define CFE_PLATFORM_FS_BACKGROUND_WRITE_BLOCK_SIZE 4096
+
+/**
+**  \cfeescfg Sync Background File Writes to Storage on Completion
+**
+**  \par Description:
+**       When set to true, the data of a background file write is flushed to
+**       the storage device before the file is closed and the complete event is
+**       generated, so a file that was reported complete survives a reset or
+**       power loss.  This is done with an asynchronous OSAL fsync, which the
+**       background task waits for.  If the OS does not support asynchronous
+**       file I/O, the file is completed without the sync.
+**
+**  \par Limits
+**       Must be true or false.
+*/
+#define CFE_PLATFORM_FS_BACKGROUND_WRITE_FSYNC false
+
+#endif /* CFE_FS_INTERNAL_CFG_H */
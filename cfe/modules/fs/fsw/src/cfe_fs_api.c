@@ -664,6 +664,109 @@ CFE_Status_t CFE_FS_ExtractFilenameFromPath(const char *OriginalPath, char *File
     return ReturnCode;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Writes a block of data to the current background file.  On failure the
+ * file is closed and the record write error event is generated.
+ *
+ * Returns true if the complete block was written.
+ *
+ *-----------------------------------------------------------------*/
+static bool CFE_FS_BackgroundWriteBlock(CFE_FS_CurrentFileState_t *State, CFE_FS_FileWriteMetaData_t *Meta,
+                                        const void *BlockPtr, size_t BlockSize)
+{
+    int32 OsStatus;
+
+    OsStatus = OS_write(State->Fd, BlockPtr, BlockSize);
+    ++State->WriteCount;
+
+    if (OsStatus != BlockSize)
+    {
+        /* end the file early (cannot set "IsEOF" as this would cause the complete event to be generated too) */
+        OS_close(State->Fd);
+        State->Fd = OS_OBJECT_ID_UNDEFINED;
+
+        /* generate write error event */
+        /* NOTE: This converts the OSAL status directly into a CFE status for logging */
+        Meta->OnEvent(Meta, CFE_FS_FileWriteEvent_RECORD_WRITE_ERROR, (long)OsStatus, State->RecordNum, BlockSize,
+                      State->FileSize);
+        return false;
+    }
+
+    State->FileSize += BlockSize;
+    return true;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Writes out the staging buffer of the current background file, if
+ * anything is staged.
+ *
+ * Returns true if the buffer is empty afterwards, i.e. no write error.
+ *
+ *-----------------------------------------------------------------*/
+static bool CFE_FS_BackgroundFlush(CFE_FS_CurrentFileState_t *State, CFE_FS_FileWriteMetaData_t *Meta)
+{
+    size_t BlockSize;
+
+    BlockSize         = State->BufferUsed;
+    State->BufferUsed = 0;
+
+    return (BlockSize == 0 || CFE_FS_BackgroundWriteBlock(State, Meta, State->Buffer, BlockSize));
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+bool CFE_FS_BackgroundSync(CFE_FS_CurrentFileState_t *State, CFE_FS_FileWriteMetaData_t *Meta)
+{
+    OS_file_async_request_t    Request;
+    OS_file_async_completion_t Completion;
+    size_t                     SizeCopied;
+    int32                      OsStatus;
+
+    memset(&Request, 0, sizeof(Request));
+    Request.filedes = State->Fd;
+    Request.opcode  = OS_FILE_ASYNC_FSYNC;
+
+    OsStatus = OS_FileAsyncSubmit(&Request, CFE_FS_Global.FileDump.SyncQueueId);
+    if (OsStatus == OS_SUCCESS)
+    {
+        /* All blocks were written synchronously, so the fsync covers the whole file */
+        OsStatus = OS_QueueGet(CFE_FS_Global.FileDump.SyncQueueId, &Completion, sizeof(Completion), &SizeCopied,
+                               OS_PEND);
+        if (OsStatus == OS_SUCCESS && Completion.result < 0)
+        {
+            OsStatus = Completion.result;
+        }
+    }
+    else if (OsStatus == OS_ERR_NOT_IMPLEMENTED)
+    {
+        /* Nothing more can be done on this OS, complete the file without the sync */
+        OsStatus = OS_SUCCESS;
+    }
+
+    if (OsStatus != OS_SUCCESS)
+    {
+        OS_close(State->Fd);
+        State->Fd = OS_OBJECT_ID_UNDEFINED;
+
+        /* NOTE: This converts the OSAL status directly into a CFE status for logging */
+        Meta->OnEvent(Meta, CFE_FS_FileWriteEvent_RECORD_WRITE_ERROR, (long)OsStatus, State->RecordNum, 0,
+                      State->FileSize);
+        return false;
+    }
+
+    return true;
+}
+
 /*----------------------------------------------------------------
  *
  * Implemented per public API
@@ -678,6 +781,7 @@ bool CFE_FS_RunBackgroundFileDump(uint32 ElapsedTime, void *Arg)
     int32                             OsStatus;
     int32                             Status;
     CFE_FS_Header_t                   FileHdr;
+    OS_time_t                         EndTime;
     void *                            RecordPtr;
     size_t                            RecordSize;
     bool                              IsEOF;
@@ -699,7 +803,7 @@ bool CFE_FS_RunBackgroundFileDump(uint32 ElapsedTime, void *Arg)
      * Not strictly necessary as the "CompleteCount" is only updated
      * by this task but this helps in case the access isn't atomic.
      */
-    CFE_FS_LockSharedData(__func__);
+    CFE_FS_LockSharedData(__func__, __LINE__);
 
     if (CFE_FS_Global.FileDump.CompleteCount != CFE_FS_Global.FileDump.RequestCount)
     {
@@ -707,7 +811,7 @@ bool CFE_FS_RunBackgroundFileDump(uint32 ElapsedTime, void *Arg)
                     .Entries[CFE_FS_Global.FileDump.CompleteCount & (CFE_FS_MAX_BACKGROUND_FILE_WRITES - 1)];
     }
 
-    CFE_FS_UnlockSharedData(__func__);
+    CFE_FS_UnlockSharedData(__func__, __LINE__);
 
     if (Curr == NULL)
     {
@@ -719,6 +823,10 @@ bool CFE_FS_RunBackgroundFileDump(uint32 ElapsedTime, void *Arg)
     if (!OS_ObjectIdDefined(State->Fd) && Meta->IsPending)
     {
         /* First time processing this entry - open the file */
+        CFE_PSP_GetTime(&State->StartTime);
+        State->BufferUsed = 0;
+        State->WriteCount = 0;
+
         OsStatus =
             OS_OpenCreate(&State->Fd, Meta->FileName, OS_FILE_FLAG_CREATE | OS_FILE_FLAG_TRUNCATE, OS_WRITE_ONLY);
         if (OsStatus != OS_SUCCESS)
@@ -733,6 +841,7 @@ bool CFE_FS_RunBackgroundFileDump(uint32 ElapsedTime, void *Arg)
 
             /* write the cFE header to the file */
             Status = CFE_FS_WriteHeader(State->Fd, &FileHdr);
+            ++State->WriteCount;
             if (Status != sizeof(CFE_FS_Header_t))
             {
                 OS_close(State->Fd);
@@ -766,37 +875,56 @@ bool CFE_FS_RunBackgroundFileDump(uint32 ElapsedTime, void *Arg)
             State->Credit -= RecordSize;
 
             /*
-             * Now write to file
+             * Stage the record in the buffer, writing out the buffer first if the
+             * record does not fit.  The getter may reuse its own buffer for the
+             * next record, so the data is always copied or written right away.
              */
-            OsStatus = OS_write(State->Fd, RecordPtr, RecordSize);
-
-            if (OsStatus != RecordSize)
+            if ((State->BufferUsed + RecordSize) > sizeof(State->Buffer) && !CFE_FS_BackgroundFlush(State, Meta))
             {
-                /* end the file early (cannot set "IsEOF" as this would cause the complete event to be generated too) */
-                OS_close(State->Fd);
-                State->Fd = OS_OBJECT_ID_UNDEFINED;
-
-                /* generate write error event */
-                /* NOTE: This converts the OSAL status directly into a CFE status for logging */
-                Meta->OnEvent(Meta, CFE_FS_FileWriteEvent_RECORD_WRITE_ERROR, (long)OsStatus, State->RecordNum,
-                              RecordSize, State->FileSize);
+                IsEOF = false;
                 break;
             }
+
+            if (RecordSize > sizeof(State->Buffer))
+            {
+                if (!CFE_FS_BackgroundWriteBlock(State, Meta, RecordPtr, RecordSize))
+                {
+                    IsEOF = false;
+                    break;
+                }
+            }
             else
             {
-                State->FileSize += RecordSize;
+                memcpy(&State->Buffer[State->BufferUsed], RecordPtr, RecordSize);
+                State->BufferUsed += RecordSize;
             }
         }
 
         ++State->RecordNum;
     }
 
+    /* Write out whatever is staged before returning to the background task */
+    if (OS_ObjectIdDefined(State->Fd) && !CFE_FS_BackgroundFlush(State, Meta))
+    {
+        IsEOF = false;
+    }
+
+    /* On normal EOF, optionally sync the data to storage, a sync error is reported as a write error */
+    if (IsEOF && CFE_PLATFORM_FS_BACKGROUND_WRITE_FSYNC && !CFE_FS_BackgroundSync(State, Meta))
+    {
+        IsEOF = false;
+    }
+
     /* On normal EOF close the file and generate the complete event */
     if (IsEOF)
     {
         OS_close(State->Fd);
         State->Fd = OS_OBJECT_ID_UNDEFINED;
 
+        CFE_PSP_GetTime(&EndTime);
+        Meta->WriteCount  = State->WriteCount;
+        Meta->ElapsedMsec = OS_TimeGetTotalMilliseconds(OS_TimeSubtract(EndTime, State->StartTime));
+
         /* generate complete event */
         Meta->OnEvent(Meta, CFE_FS_FileWriteEvent_COMPLETE, CFE_SUCCESS, State->RecordNum, 0, State->FileSize);
     }
@@ -807,7 +935,7 @@ bool CFE_FS_RunBackgroundFileDump(uint32 ElapsedTime, void *Arg)
      */
     if (!OS_ObjectIdDefined(State->Fd))
     {
-        CFE_FS_LockSharedData(__func__);
+        CFE_FS_LockSharedData(__func__, __LINE__);
 
         /* Wipe the entry structure, as it will be reused */
         memset(Curr, 0, sizeof(*Curr));
@@ -816,7 +944,7 @@ bool CFE_FS_RunBackgroundFileDump(uint32 ElapsedTime, void *Arg)
         /* Set the "IsPending" flag to false - this indicates that the originator may re-post now */
         Meta->IsPending = false;
 
-        CFE_FS_UnlockSharedData(__func__);
+        CFE_FS_UnlockSharedData(__func__, __LINE__);
     }
 
     return !IsEOF;
@@ -858,7 +986,7 @@ int32 CFE_FS_BackgroundFileDumpRequest(CFE_FS_FileWriteMetaData_t *Meta)
         return CFE_STATUS_REQUEST_ALREADY_PENDING;
     }
 
-    CFE_FS_LockSharedData(__func__);
+    CFE_FS_LockSharedData(__func__, __LINE__);
 
     PendingRequestCount = CFE_FS_Global.FileDump.RequestCount + 1;
 
@@ -892,7 +1020,7 @@ int32 CFE_FS_BackgroundFileDumpRequest(CFE_FS_FileWriteMetaData_t *Meta)
         Status = CFE_SUCCESS;
     }
 
-    CFE_FS_UnlockSharedData(__func__);
+    CFE_FS_UnlockSharedData(__func__, __LINE__);
 
     if (Status == CFE_SUCCESS)
     {
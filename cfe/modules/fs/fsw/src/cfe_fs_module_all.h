@@ -36,4 +36,10 @@
 #include "cfe_fs_priv.h"
 #include "cfe_fs_core_internal.h"
 
+/*
+ * Additionally FS reports its shared data lock to the ES lock profiler
+ */
+#include "cfe_platform_cfg.h"
+#include "cfe_es_core_internal.h"
+
 #endif /* CFE_FS_MODULE_ALL_H */
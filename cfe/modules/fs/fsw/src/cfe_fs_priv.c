@@ -31,6 +31,7 @@
 ** Required header files
 */
 #include "cfe_fs_module_all.h"
+#include "cfe_fs_verify.h"
 
 #include <string.h>
 
@@ -59,6 +60,18 @@ int32 CFE_FS_EarlyInit(void)
         return CFE_STATUS_EXTERNAL_RESOURCE_FAIL;
     }
 
+    if (CFE_PLATFORM_FS_BACKGROUND_WRITE_FSYNC)
+    {
+        /* Only one fsync is outstanding at a time */
+        OsStatus = OS_QueueCreate(&CFE_FS_Global.FileDump.SyncQueueId, "CFE_FS_SyncQueue", 1,
+                                  sizeof(OS_file_async_completion_t), 0);
+        if (OsStatus != OS_SUCCESS)
+        {
+            CFE_ES_WriteToSysLog("%s: Sync Queue creation failed! RC=%ld\n", __func__, (long)OsStatus);
+            return CFE_STATUS_EXTERNAL_RESOURCE_FAIL;
+        }
+    }
+
     return CFE_SUCCESS;
 }
 
@@ -68,10 +81,16 @@ int32 CFE_FS_EarlyInit(void)
  * See description in header file for argument/return detail
  *
  *-----------------------------------------------------------------*/
-void CFE_FS_LockSharedData(const char *FunctionName)
+void CFE_FS_LockSharedData(const char *FunctionName, int32 LineNumber)
 {
-    int32          OsStatus;
-    CFE_ES_AppId_t AppId;
+    int32                    OsStatus;
+    CFE_ES_AppId_t           AppId;
+    CFE_ES_LockProfileWait_t ProfileWait;
+
+    if (CFE_PLATFORM_ES_LOCK_PROFILE)
+    {
+        CFE_ES_LockProfileWait(CFE_ES_LockProfileLock_FS_SHARED_DATA, &ProfileWait);
+    }
 
     OsStatus = OS_MutSemTake(CFE_FS_Global.SharedDataMutexId);
     if (OsStatus != OS_SUCCESS)
@@ -80,6 +99,10 @@ void CFE_FS_LockSharedData(const char *FunctionName)
         CFE_ES_WriteToSysLog("%s: SharedData Mutex Take Err Stat=%ld,App=%lu,Function=%s\n", __func__, (long)OsStatus,
                              CFE_RESOURCEID_TO_ULONG(AppId), FunctionName);
     }
+    else if (CFE_PLATFORM_ES_LOCK_PROFILE)
+    {
+        CFE_ES_LockProfileAcquired(CFE_ES_LockProfileLock_FS_SHARED_DATA, &ProfileWait, FunctionName, LineNumber);
+    }
 }
 
 /*----------------------------------------------------------------
@@ -88,11 +111,16 @@ void CFE_FS_LockSharedData(const char *FunctionName)
  * See description in header file for argument/return detail
  *
  *-----------------------------------------------------------------*/
-void CFE_FS_UnlockSharedData(const char *FunctionName)
+void CFE_FS_UnlockSharedData(const char *FunctionName, int32 LineNumber)
 {
     int32          OsStatus;
     CFE_ES_AppId_t AppId;
 
+    if (CFE_PLATFORM_ES_LOCK_PROFILE)
+    {
+        CFE_ES_LockProfileRelease(CFE_ES_LockProfileLock_FS_SHARED_DATA);
+    }
+
     OsStatus = OS_MutSemGive(CFE_FS_Global.SharedDataMutexId);
     if (OsStatus != OS_SUCCESS)
     {
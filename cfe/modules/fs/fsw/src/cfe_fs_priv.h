@@ -36,6 +36,7 @@
 #include "common_types.h"
 #include "cfe_fs_api_typedefs.h"
 #include "cfe_es_api_typedefs.h"
+#include "cfe_platform_cfg.h"
 
 /*
 ** Macro Definitions
@@ -93,7 +94,17 @@ typedef struct
     osal_id_t Fd;
     int32     Credit;
     uint32    RecordNum;
-    size_t    FileSize;
+    size_t    FileSize;   /**< Bytes written to the file so far, not including the staging buffer */
+    size_t    BufferUsed; /**< Bytes staged in the buffer but not yet written */
+    uint32    WriteCount; /**< Number of write calls made for the current file */
+    OS_time_t StartTime;  /**< Time the current file was opened */
+
+    /*
+     * Records from the data getter are staged here and written to the file one
+     * block at a time.  The buffer is always written out before the background
+     * job returns, so a file never lags the getter by more than one call.
+     */
+    uint8 Buffer[CFE_PLATFORM_FS_BACKGROUND_WRITE_BLOCK_SIZE];
 } CFE_FS_CurrentFileState_t;
 
 /*---------------------------------------------------------------------------------------*/
@@ -123,6 +134,12 @@ typedef struct
      * (reused for each file)
      */
     CFE_FS_CurrentFileState_t Current;
+
+    /**
+     * Receives the completion of the fsync of a finished file,
+     * only created if CFE_PLATFORM_FS_BACKGROUND_WRITE_FSYNC is enabled
+     */
+    osal_id_t SyncQueueId;
 } CFE_FS_BackgroundFileDumpState_t;
 
 /******************************************************************************
@@ -149,16 +166,18 @@ extern CFE_FS_Global_t CFE_FS_Global;
  * @brief Obtains exclusive access to the FS global data structures
  *
  * @param FunctionName The name of the calling function
+ * @param LineNumber   The line number of the call
  */
-void CFE_FS_LockSharedData(const char *FunctionName);
+void CFE_FS_LockSharedData(const char *FunctionName, int32 LineNumber);
 
 /*---------------------------------------------------------------------------------------*/
 /**
  * @brief Releases exclusive access to the FS global data structures
  *
  * @param FunctionName The name of the calling function
+ * @param LineNumber   The line number of the call
  */
-void CFE_FS_UnlockSharedData(const char *FunctionName);
+void CFE_FS_UnlockSharedData(const char *FunctionName, int32 LineNumber);
 
 /*---------------------------------------------------------------------------------------*/
 /**
@@ -176,4 +195,19 @@ void CFE_FS_ByteSwapCFEHeader(CFE_FS_Header_t *Hdr);
  */
 void CFE_FS_ByteSwapUint32(uint32 *Uint32ToSwapPtr);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Flushes the data of the current background file to the storage device
+ *
+ * Waits for an asynchronous fsync of the file, used when
+ * CFE_PLATFORM_FS_BACKGROUND_WRITE_FSYNC is enabled.  On failure the file
+ * is closed and the record write error event is generated.
+ *
+ * @param State The state of the current background file
+ * @param Meta  The write request of the current background file
+ *
+ * @returns true if the data was synced, or the OS does not support it
+ */
+bool CFE_FS_BackgroundSync(CFE_FS_CurrentFileState_t *State, CFE_FS_FileWriteMetaData_t *Meta);
+
 #endif /* CFE_FS_PRIV_H */
@@ -0,0 +1,39 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * Purpose:
+ *   This header file performs compile time checking for FS configuration
+ *   parameters.
+ *
+ */
+
+#ifndef CFE_FS_VERIFY_H
+#define CFE_FS_VERIFY_H
+
+#if CFE_PLATFORM_FS_BACKGROUND_WRITE_BLOCK_SIZE < 1
+#error CFE_PLATFORM_FS_BACKGROUND_WRITE_BLOCK_SIZE cannot be less than 1!
+#endif
+
+#if (CFE_PLATFORM_FS_BACKGROUND_WRITE_FSYNC != true) && (CFE_PLATFORM_FS_BACKGROUND_WRITE_FSYNC != false)
+#error CFE_PLATFORM_FS_BACKGROUND_WRITE_FSYNC must be true or false!
+#endif
+
+#endif /* CFE_FS_VERIFY_H */
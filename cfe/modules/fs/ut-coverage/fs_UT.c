@@ -83,6 +83,8 @@ void UtTest_Setup(void)
     UT_ADD_TEST(Test_CFE_FS_Private);
 
     UT_ADD_TEST(Test_CFE_FS_BackgroundFileDump);
+    UT_ADD_TEST(Test_CFE_FS_BackgroundFileDumpBuffering);
+    UT_ADD_TEST(Test_CFE_FS_BackgroundSync);
 }
 
 /*
@@ -490,25 +492,25 @@ void Test_CFE_FS_Private(void)
 
     /* Test successful locking of shared data */
     UT_InitData();
-    CFE_FS_LockSharedData("FunctionName");
+    CFE_FS_LockSharedData("FunctionName", 1234);
     UtAssert_STUB_COUNT(CFE_ES_WriteToSysLog, 0);
 
     /* Test locking of shared data with a mutex take error */
     UT_InitData();
     UT_SetDeferredRetcode(UT_KEY(OS_MutSemTake), 1, -1);
-    CFE_FS_LockSharedData("FunctionName");
+    CFE_FS_LockSharedData("FunctionName", 1234);
     CFE_UtAssert_SYSLOG(FS_SYSLOG_MSGS[1]);
     UtAssert_STUB_COUNT(CFE_ES_WriteToSysLog, 1);
 
     /* Test successful unlocking of shared data */
     UT_InitData();
-    CFE_FS_UnlockSharedData("FunctionName");
+    CFE_FS_UnlockSharedData("FunctionName", 1234);
     UtAssert_STUB_COUNT(CFE_ES_WriteToSysLog, 0);
 
     /* Test unlocking of shared data with a mutex give error */
     UT_InitData();
     UT_SetDeferredRetcode(UT_KEY(OS_MutSemGive), 1, -1);
-    CFE_FS_UnlockSharedData("FunctionName");
+    CFE_FS_UnlockSharedData("FunctionName", 1234);
     CFE_UtAssert_SYSLOG(FS_SYSLOG_MSGS[2]);
     UtAssert_STUB_COUNT(CFE_ES_WriteToSysLog, 1);
 
@@ -654,3 +656,151 @@ void Test_CFE_FS_BackgroundFileDump(void)
     UT_SetDeferredRetcode(UT_KEY(UT_FS_DataGetter), 2, true); /* avoid infinite loop */
     UtAssert_BOOL_FALSE(CFE_FS_RunBackgroundFileDump(100, NULL));
 }
+
+void Test_CFE_FS_BackgroundFileDumpBuffering(void)
+{
+    /*
+     * Test routine for the write staging in:
+     * bool CFE_FS_RunBackgroundFileDump(uint32 ElapsedTime, void *Arg)
+     */
+    CFE_FS_FileWriteMetaData_t State;
+    uint32                     MyBuffer[2];
+    static uint8               LargeBuffer[CFE_PLATFORM_FS_BACKGROUND_WRITE_BLOCK_SIZE + 1];
+    uint32                     NumRecords;
+
+    memset(UT_FS_FileWriteEventCount, 0, sizeof(UT_FS_FileWriteEventCount));
+    memset(&State, 0, sizeof(State));
+    memset(&CFE_FS_Global.FileDump, 0, sizeof(CFE_FS_Global.FileDump));
+    memset(MyBuffer, 0, sizeof(MyBuffer));
+
+    State.GetData = UT_FS_DataGetter;
+    State.OnEvent = UT_FS_OnEvent;
+    strncpy(State.FileName, "/ram/UT.bin", sizeof(State.FileName));
+    strncpy(State.Description, "UT", sizeof(State.Description));
+
+    /* Enough small records to fill the staging buffer once, plus a partial block */
+    NumRecords = (CFE_PLATFORM_FS_BACKGROUND_WRITE_BLOCK_SIZE / sizeof(MyBuffer)) + 10;
+
+    /*
+     * Small records are coalesced - one write for the header, one for the full
+     * block and one for the remainder at EOF.
+     */
+    UT_InitData();
+    CFE_UtAssert_SETUP(CFE_FS_BackgroundFileDumpRequest(&State));
+    UT_SetDataBuffer(UT_KEY(UT_FS_DataGetter), MyBuffer, sizeof(MyBuffer), false);
+    UT_SetDeferredRetcode(UT_KEY(UT_FS_DataGetter), NumRecords, true);
+    UtAssert_BOOL_FALSE(CFE_FS_RunBackgroundFileDump(100000, NULL));
+    UtAssert_STUB_COUNT(UT_FS_DataGetter, NumRecords);
+    UtAssert_STUB_COUNT(OS_write, 3);
+    UtAssert_UINT32_EQ(UT_FS_FileWriteEventCount[CFE_FS_FileWriteEvent_COMPLETE], 1);
+    UtAssert_UINT32_EQ(State.WriteCount, 3);
+    UtAssert_UINT32_EQ(CFE_FS_Global.FileDump.Current.FileSize,
+                       sizeof(CFE_FS_Header_t) + (NumRecords * sizeof(MyBuffer)));
+    UtAssert_BOOL_FALSE(CFE_FS_BackgroundFileDumpIsPending(&State));
+
+    /* A partial block is written out when the credit runs out, before returning */
+    UT_InitData();
+    CFE_UtAssert_SETUP(CFE_FS_BackgroundFileDumpRequest(&State));
+    CFE_FS_Global.FileDump.Current.Credit = 0;
+    UT_SetDataBuffer(UT_KEY(UT_FS_DataGetter), MyBuffer, sizeof(MyBuffer), false);
+    UtAssert_BOOL_TRUE(CFE_FS_RunBackgroundFileDump(100, NULL));
+    UtAssert_STUB_COUNT(OS_write, 2);
+    UtAssert_UINT32_EQ(CFE_FS_Global.FileDump.Current.BufferUsed, 0);
+    UT_SetDeferredRetcode(UT_KEY(UT_FS_DataGetter), 1, true);
+    UtAssert_BOOL_FALSE(CFE_FS_RunBackgroundFileDump(100, NULL));
+    UtAssert_UINT32_EQ(UT_FS_FileWriteEventCount[CFE_FS_FileWriteEvent_COMPLETE], 2);
+    UtAssert_UINT32_EQ(State.WriteCount, 3);
+
+    /* Error writing a full block - the file is not completed */
+    UT_InitData();
+    CFE_UtAssert_SETUP(CFE_FS_BackgroundFileDumpRequest(&State));
+    UT_SetDataBuffer(UT_KEY(UT_FS_DataGetter), MyBuffer, sizeof(MyBuffer), false);
+    UT_SetDeferredRetcode(UT_KEY(UT_FS_DataGetter), NumRecords, true);
+    UT_SetDeferredRetcode(UT_KEY(OS_write), 2, OS_ERROR);
+    UtAssert_BOOL_TRUE(CFE_FS_RunBackgroundFileDump(100000, NULL));
+    UtAssert_UINT32_EQ(UT_FS_FileWriteEventCount[CFE_FS_FileWriteEvent_RECORD_WRITE_ERROR], 1);
+    UtAssert_UINT32_EQ(UT_FS_FileWriteEventCount[CFE_FS_FileWriteEvent_COMPLETE], 2);
+    UtAssert_BOOL_FALSE(CFE_FS_BackgroundFileDumpIsPending(&State));
+
+    /* Error writing the last partial block at EOF - the file is not completed */
+    UT_InitData();
+    CFE_UtAssert_SETUP(CFE_FS_BackgroundFileDumpRequest(&State));
+    UT_SetDataBuffer(UT_KEY(UT_FS_DataGetter), MyBuffer, sizeof(MyBuffer), false);
+    UT_SetDeferredRetcode(UT_KEY(UT_FS_DataGetter), 1, true);
+    UT_SetDeferredRetcode(UT_KEY(OS_write), 2, OS_ERROR);
+    UtAssert_BOOL_TRUE(CFE_FS_RunBackgroundFileDump(100000, NULL));
+    UtAssert_UINT32_EQ(UT_FS_FileWriteEventCount[CFE_FS_FileWriteEvent_RECORD_WRITE_ERROR], 2);
+    UtAssert_UINT32_EQ(UT_FS_FileWriteEventCount[CFE_FS_FileWriteEvent_COMPLETE], 2);
+
+    /* Records larger than the staging buffer are written directly */
+    UT_InitData();
+    CFE_UtAssert_SETUP(CFE_FS_BackgroundFileDumpRequest(&State));
+    UT_SetDataBuffer(UT_KEY(UT_FS_DataGetter), LargeBuffer, sizeof(LargeBuffer), false);
+    UT_SetDeferredRetcode(UT_KEY(UT_FS_DataGetter), 2, true);
+    UtAssert_BOOL_FALSE(CFE_FS_RunBackgroundFileDump(100000, NULL));
+    UtAssert_STUB_COUNT(OS_write, 3);
+    UtAssert_UINT32_EQ(UT_FS_FileWriteEventCount[CFE_FS_FileWriteEvent_COMPLETE], 3);
+    UtAssert_UINT32_EQ(CFE_FS_Global.FileDump.Current.FileSize, sizeof(CFE_FS_Header_t) + (2 * sizeof(LargeBuffer)));
+
+    /* Error writing a large record directly */
+    UT_InitData();
+    CFE_UtAssert_SETUP(CFE_FS_BackgroundFileDumpRequest(&State));
+    UT_SetDataBuffer(UT_KEY(UT_FS_DataGetter), LargeBuffer, sizeof(LargeBuffer), false);
+    UT_SetDeferredRetcode(UT_KEY(UT_FS_DataGetter), 1, true);
+    UT_SetDeferredRetcode(UT_KEY(OS_write), 2, OS_ERROR);
+    UtAssert_BOOL_TRUE(CFE_FS_RunBackgroundFileDump(100000, NULL));
+    UtAssert_UINT32_EQ(UT_FS_FileWriteEventCount[CFE_FS_FileWriteEvent_RECORD_WRITE_ERROR], 3);
+    UtAssert_BOOL_FALSE(CFE_FS_BackgroundFileDumpIsPending(&State));
+}
+
+void Test_CFE_FS_BackgroundSync(void)
+{
+    CFE_FS_FileWriteMetaData_t Meta;
+    CFE_FS_CurrentFileState_t *Current;
+    OS_file_async_completion_t Completion;
+
+    memset(UT_FS_FileWriteEventCount, 0, sizeof(UT_FS_FileWriteEventCount));
+    memset(&Meta, 0, sizeof(Meta));
+    memset(&CFE_FS_Global.FileDump, 0, sizeof(CFE_FS_Global.FileDump));
+    memset(&Completion, 0, sizeof(Completion));
+
+    Meta.OnEvent                       = UT_FS_OnEvent;
+    Current                            = &CFE_FS_Global.FileDump.Current;
+    CFE_FS_Global.FileDump.SyncQueueId = OS_ObjectIdFromInteger(1);
+
+    /* Successful sync, waiting for the completion */
+    UT_InitData();
+    OS_OpenCreate(&Current->Fd, "/ram/UT.bin", OS_FILE_FLAG_CREATE, OS_WRITE_ONLY);
+    UT_SetDataBuffer((UT_EntryKey_t)OS_ObjectIdToInteger(CFE_FS_Global.FileDump.SyncQueueId), &Completion,
+                     sizeof(Completion), false);
+    UtAssert_BOOL_TRUE(CFE_FS_BackgroundSync(Current, &Meta));
+    UtAssert_STUB_COUNT(OS_FileAsyncSubmit, 1);
+    UtAssert_STUB_COUNT(OS_QueueGet, 1);
+    UtAssert_STUB_COUNT(OS_close, 0);
+
+    /* The OS does not support asynchronous I/O, the file is completed without the sync */
+    UT_InitData();
+    UT_SetDefaultReturnValue(UT_KEY(OS_FileAsyncSubmit), OS_ERR_NOT_IMPLEMENTED);
+    UtAssert_BOOL_TRUE(CFE_FS_BackgroundSync(Current, &Meta));
+    UtAssert_STUB_COUNT(OS_QueueGet, 0);
+    UtAssert_UINT32_EQ(UT_FS_FileWriteEventCount[CFE_FS_FileWriteEvent_RECORD_WRITE_ERROR], 0);
+
+    /* The fsync itself failed */
+    UT_InitData();
+    OS_OpenCreate(&Current->Fd, "/ram/UT.bin", OS_FILE_FLAG_CREATE, OS_WRITE_ONLY);
+    Completion.result = OS_ERROR;
+    UT_SetDataBuffer((UT_EntryKey_t)OS_ObjectIdToInteger(CFE_FS_Global.FileDump.SyncQueueId), &Completion,
+                     sizeof(Completion), false);
+    UtAssert_BOOL_FALSE(CFE_FS_BackgroundSync(Current, &Meta));
+    UtAssert_STUB_COUNT(OS_close, 1);
+    UtAssert_BOOL_FALSE(OS_ObjectIdDefined(Current->Fd));
+    UtAssert_UINT32_EQ(UT_FS_FileWriteEventCount[CFE_FS_FileWriteEvent_RECORD_WRITE_ERROR], 1);
+
+    /* The fsync could not be submitted */
+    UT_InitData();
+    OS_OpenCreate(&Current->Fd, "/ram/UT.bin", OS_FILE_FLAG_CREATE, OS_WRITE_ONLY);
+    UT_SetDefaultReturnValue(UT_KEY(OS_FileAsyncSubmit), OS_ERROR);
+    UtAssert_BOOL_FALSE(CFE_FS_BackgroundSync(Current, &Meta));
+    UtAssert_STUB_COUNT(OS_QueueGet, 0);
+    UtAssert_UINT32_EQ(UT_FS_FileWriteEventCount[CFE_FS_FileWriteEvent_RECORD_WRITE_ERROR], 2);
+}
@@ -312,4 +312,30 @@ void Test_CFE_FS_GetUncompressedFile(void);
 ******************************************************************************/
 void Test_CFE_FS_BackgroundFileDump(void);
 
+/*****************************************************************************/
+/**
+** \brief Tests for the write staging buffer of the FS background file dump
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+**
+******************************************************************************/
+void Test_CFE_FS_BackgroundFileDumpBuffering(void);
+
+/*****************************************************************************/
+/**
+** \brief Tests syncing the data of a completed background file to storage
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+**
+******************************************************************************/
+void Test_CFE_FS_BackgroundSync(void);
+
 #endif /* FS_UT_H */
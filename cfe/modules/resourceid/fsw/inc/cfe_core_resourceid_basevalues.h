@@ -70,6 +70,9 @@ enum
 
     /* configuration registry */
     CFE_RESOURCEID_CONFIGID_BASE_OFFSET = OS_OBJECT_TYPE_USER + 7,
+
+    /* ES background jobs */
+    CFE_RESOURCEID_ES_BGJOBID_BASE_OFFSET = OS_OBJECT_TYPE_USER + 8,
 };
 
 /*
@@ -92,6 +95,9 @@ enum
 
     /* configuration registry */
     CFE_CONFIGID_BASE = CFE_RESOURCEID_MAKE_BASE(CFE_RESOURCEID_CONFIGID_BASE_OFFSET),
+
+    /* ES background jobs */
+    CFE_ES_BGJOBID_BASE = CFE_RESOURCEID_MAKE_BASE(CFE_RESOURCEID_ES_BGJOBID_BASE_OFFSET),
 };
 
 /** @} */
@@ -43,6 +43,8 @@
 ** Include Files
 */
 #include "cfe_resourceid_typedef.h"
+#include "cfe_resourceid.h"
+#include "cfe_error.h"
 
 /*
  * In this configuration, CFE resource IDs are tailored to not
@@ -72,4 +74,78 @@
  */
 #define CFE_RESOURCEID_MAKE_BASE(offset) (CFE_RESOURCEID_MARK | ((offset) << CFE_RESOURCEID_SHIFT))
 
+/**
+ * @brief A macro to check at compile time that a table size can be indexed by resource IDs
+ *
+ * The table must have at least one entry, and no more entries than there
+ * are serial numbers, otherwise some entries can never be referenced.
+ * The size must be a constant expression, an invalid size fails to compile.
+ */
+#define CFE_RESOURCEID_TABLE_SIZE_CHECK(size) \
+    ((void)sizeof(char[((size) > 0 && (size) <= (CFE_RESOURCEID_MAX + 1)) ? 1 : -1]))
+
+/**
+ * @brief A macro to check if a table size is a power of two
+ *
+ * Serial numbers are then converted to table indices with a mask rather than
+ * an integer division.  Evaluated at compile time for a constant size.
+ */
+#define CFE_RESOURCEID_TABLE_SIZE_IS_POW2(size) (((size) & ((size) - 1)) == 0)
+
+/**
+ * @brief Convert a resource ID to an index in a table of constant size
+ *
+ * Inline form of CFE_ResourceId_ToIndex() for use by the per-type conversion
+ * helpers, through #CFE_RESOURCEID_TO_INDEX which supplies IsPow2.
+ *
+ * @param[in]  Id        The resource ID
+ * @param[in]  BaseValue The respective ID base value corresponding to the ID type
+ * @param[in]  TableSize The size of the table, a nonzero constant
+ * @param[in]  IsPow2    Whether TableSize is a power of two, a constant
+ * @param[out] Idx       The output index
+ *
+ * @retval #CFE_SUCCESS                     @copybrief CFE_SUCCESS
+ * @retval #CFE_ES_BAD_ARGUMENT             @copybrief CFE_ES_BAD_ARGUMENT
+ * @retval #CFE_ES_ERR_RESOURCEID_NOT_VALID @copybrief CFE_ES_ERR_RESOURCEID_NOT_VALID
+ */
+static inline int32 CFE_ResourceId_ToIndexInline(CFE_ResourceId_t Id, uint32 BaseValue, uint32 TableSize, bool IsPow2,
+                                                 uint32 *Idx)
+{
+    uint32 Serial;
+
+    if (Idx == NULL)
+    {
+        return CFE_ES_BAD_ARGUMENT;
+    }
+
+    Serial = CFE_ResourceId_ToInteger(Id) - BaseValue;
+    if (Serial > CFE_RESOURCEID_MAX)
+    {
+        return CFE_ES_ERR_RESOURCEID_NOT_VALID;
+    }
+
+    if (IsPow2)
+    {
+        *Idx = Serial & (TableSize - 1);
+    }
+    else
+    {
+        *Idx = Serial % TableSize;
+    }
+
+    return CFE_SUCCESS;
+}
+
+/**
+ * @brief A macro to convert a typed resource ID to an index in a table of constant size
+ *
+ * This is the single place where the platform configured table sizes are
+ * checked, at compile time, when used by the per-type conversion helpers.
+ * The choice between a mask and an integer division is also made at compile time.
+ */
+#define CFE_RESOURCEID_TO_INDEX(id, base, size, idx)                                       \
+    (CFE_RESOURCEID_TABLE_SIZE_CHECK(size),                                                \
+     CFE_ResourceId_ToIndexInline(CFE_RESOURCEID_UNWRAP(id), base, size,                   \
+                                  CFE_RESOURCEID_TABLE_SIZE_IS_POW2(size), idx))
+
 #endif /* CFE_RESOURCEID_BASEVALUE_H */
@@ -48,6 +48,108 @@
  */
 CompileTimeAssert(((CFE_RESOURCEID_MAX + 1) & CFE_RESOURCEID_MAX) == 0, CFE_RESOURCEID_MAX_BITMASK);
 
+/*
+ * Number of slots tracked by each word of a slot usage map
+ */
+#define CFE_RESOURCEID_MAP_WORD_BITS 32
+
+/*----------------------------------------------------------------
+ *
+ * Local helper routine, not part of API.
+ *
+ * Get the position of the lowest set bit in a nonzero word
+ *
+ *-----------------------------------------------------------------*/
+static uint32 CFE_ResourceId_LowestBit(uint32 Word)
+{
+    uint32 Position;
+    uint32 Shift;
+
+    Position = 0;
+    Shift    = CFE_RESOURCEID_MAP_WORD_BITS / 2;
+    while (Shift > 0)
+    {
+        if ((Word & ((1U << Shift) - 1)) == 0)
+        {
+            Word >>= Shift;
+            Position += Shift;
+        }
+        Shift >>= 1;
+    }
+
+    return Position;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Local helper routine, not part of API.
+ *
+ * Find the first slot at or after StartIdx which is free in the usage map.
+ * Returns TableSize if there is none before the end of the table.
+ *
+ *-----------------------------------------------------------------*/
+static uint32 CFE_ResourceId_MapFindFree(const uint32 *UsedMap, uint32 TableSize, uint32 StartIdx)
+{
+    uint32 WordIdx;
+    uint32 NumWords;
+    uint32 FreeBits;
+
+    WordIdx  = StartIdx / CFE_RESOURCEID_MAP_WORD_BITS;
+    NumWords = CFE_RESOURCEID_MAP_WORDS(TableSize);
+
+    /* the first word is partial, ignore the slots before StartIdx */
+    FreeBits = ~UsedMap[WordIdx] & ~((1U << (StartIdx % CFE_RESOURCEID_MAP_WORD_BITS)) - 1);
+    while (FreeBits == 0)
+    {
+        ++WordIdx;
+        if (WordIdx >= NumWords)
+        {
+            return TableSize;
+        }
+        FreeBits = ~UsedMap[WordIdx];
+    }
+
+    /* note this may point beyond the table in the last word, which the caller treats as not found */
+    return (WordIdx * CFE_RESOURCEID_MAP_WORD_BITS) + CFE_ResourceId_LowestBit(FreeBits);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Local helper routine, not part of API.
+ *
+ * Advance a serial number by the given number of steps, wrapping around
+ * in the same way as CFE_ResourceId_FindNext() does one step at a time.
+ *
+ *-----------------------------------------------------------------*/
+static uint32 CFE_ResourceId_AdvanceSerial(uint32 Serial, uint32 Steps, uint32 TableSize)
+{
+    uint32 Span;
+
+    while (Steps > 0)
+    {
+        /* number of steps until the serial number wraps */
+        if (Serial < CFE_RESOURCEID_MAX)
+        {
+            Span = CFE_RESOURCEID_MAX - Serial;
+        }
+        else
+        {
+            Span = 1;
+        }
+
+        if (Steps < Span)
+        {
+            Serial += Steps;
+            break;
+        }
+
+        Steps -= Span;
+        Serial = (Serial + Span) % TableSize;
+    }
+
+    return Serial;
+}
+
 /*----------------------------------------------------------------
  *
  * Implemented per public API
@@ -143,3 +245,104 @@ CFE_ResourceId_t CFE_ResourceId_FindNext(CFE_ResourceId_t StartId, uint32 TableS
 
     return CheckId;
 }
+
+/*----------------------------------------------------------------
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_ResourceId_t CFE_ResourceId_FindNextFree(CFE_ResourceId_t StartId, uint32 TableSize, uint32 *UsedMap,
+                                             bool (*CheckFunc)(CFE_ResourceId_t))
+{
+    uint32           ResourceType;
+    uint32           Serial;
+    uint32           NextIdx;
+    uint32           FreeIdx;
+    uint32           Steps;
+    CFE_ResourceId_t CheckId;
+
+    if (CheckFunc == NULL || UsedMap == NULL || TableSize == 0)
+    {
+        return CFE_RESOURCEID_UNDEFINED;
+    }
+
+    ResourceType = CFE_ResourceId_GetBase(StartId);
+    Serial       = CFE_ResourceId_GetSerial(StartId);
+
+    /*
+     * Serial numbers map to consecutive table slots, so searching the map
+     * forward from the slot after StartId visits candidates in the same
+     * order as CFE_ResourceId_FindNext() would, skipping the used ones.
+     */
+    NextIdx = (Serial % TableSize) + 1;
+    if (NextIdx >= TableSize)
+    {
+        NextIdx = 0;
+    }
+    Steps = 0;
+
+    while (Steps < TableSize)
+    {
+        FreeIdx = CFE_ResourceId_MapFindFree(UsedMap, TableSize, NextIdx);
+        if (FreeIdx >= TableSize)
+        {
+            /* nothing free up to the end of the table, continue from the start */
+            Steps += TableSize - NextIdx;
+            NextIdx = 0;
+            continue;
+        }
+
+        Steps += FreeIdx - NextIdx + 1;
+
+        /*
+         * The map is only a hint, entries may have been marked used without
+         * going through here (e.g. restored after a reset).  The check function
+         * is authoritative, and stale map entries are corrected as they are found.
+         */
+        CheckId = CFE_ResourceId_FromInteger(ResourceType + CFE_ResourceId_AdvanceSerial(Serial, Steps, TableSize));
+        CFE_ResourceId_MapSetUsed(UsedMap, FreeIdx);
+        if (!CheckFunc(CheckId))
+        {
+            return CheckId;
+        }
+
+        NextIdx = FreeIdx + 1;
+        if (NextIdx >= TableSize)
+        {
+            NextIdx = 0;
+        }
+    }
+
+    /*
+     * Every slot is marked used.  Entries that were released without updating
+     * the map would otherwise be lost, so confirm with a full scan.
+     */
+    CheckId = CFE_ResourceId_FindNext(StartId, TableSize, CheckFunc);
+    if (CFE_ResourceId_IsDefined(CheckId))
+    {
+        CFE_ResourceId_MapSetUsed(UsedMap, CFE_ResourceId_GetSerial(CheckId) % TableSize);
+    }
+
+    return CheckId;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ResourceId_MapRelease(CFE_ResourceId_t Id, uint32 TableSize, uint32 *UsedMap)
+{
+    uint32 Serial;
+
+    if (UsedMap == NULL || TableSize == 0 || !CFE_ResourceId_IsDefined(Id) ||
+        CFE_ResourceId_Equal(Id, CFE_RESOURCEID_RESERVED))
+    {
+        return;
+    }
+
+    Serial = CFE_ResourceId_GetSerial(Id);
+    CFE_ResourceId_MapSetFree(UsedMap, Serial % TableSize);
+}
@@ -19,6 +19,8 @@
 /*
  * Includes
  */
+#include <string.h>
+
 #include "cfe.h"
 #include "cfe_resourceid.h"
 #include "cfe_resourceid_basevalue.h"
@@ -28,12 +30,150 @@
 
 #define UT_RESOURCEID_BASE_OFFSET 37
 #define UT_RESOURCEID_TEST_SLOTS  149 /* oddball for test purposes */
+#define UT_RESOURCEID_MAP_SLOTS   70  /* spans several slot usage map words */
+
+static bool   UT_ResourceId_SlotUsed[UT_RESOURCEID_MAP_SLOTS];
+static uint32 UT_ResourceId_MapBase;
 
 static bool UT_ResourceId_CheckIdSlotUsed(CFE_ResourceId_t Id)
 {
     return UT_DEFAULT_IMPL(UT_ResourceId_CheckIdSlotUsed) != 0;
 }
 
+static bool UT_ResourceId_CheckMapSlotUsed(CFE_ResourceId_t Id)
+{
+    uint32 Idx;
+
+    if (CFE_ResourceId_ToIndex(Id, UT_ResourceId_MapBase, UT_RESOURCEID_MAP_SLOTS, &Idx) != CFE_SUCCESS)
+    {
+        return true;
+    }
+
+    return UT_ResourceId_SlotUsed[Idx];
+}
+
+/*
+ * Allocate the next ID with both CFE_ResourceId_FindNextFree() and CFE_ResourceId_FindNext()
+ * and confirm they agree.  Marks the slot as used and returns the ID.
+ */
+static CFE_ResourceId_t UT_ResourceId_AllocateFromMap(CFE_ResourceId_t LastId, uint32 *UsedMap)
+{
+    CFE_ResourceId_t RefId;
+    CFE_ResourceId_t Id;
+    uint32           Idx;
+
+    RefId = CFE_ResourceId_FindNext(LastId, UT_RESOURCEID_MAP_SLOTS, UT_ResourceId_CheckMapSlotUsed);
+    Id    = CFE_ResourceId_FindNextFree(LastId, UT_RESOURCEID_MAP_SLOTS, UsedMap, UT_ResourceId_CheckMapSlotUsed);
+    UtAssert_True(CFE_ResourceId_Equal(Id, RefId), "CFE_ResourceId_FindNextFree() after id=%lx: expected=%lx, got=%lx",
+                  CFE_ResourceId_ToInteger(LastId), CFE_ResourceId_ToInteger(RefId), CFE_ResourceId_ToInteger(Id));
+
+    if (CFE_ResourceId_ToIndex(Id, UT_ResourceId_MapBase, UT_RESOURCEID_MAP_SLOTS, &Idx) == CFE_SUCCESS)
+    {
+        UT_ResourceId_SlotUsed[Idx] = true;
+    }
+
+    return Id;
+}
+
+void TestResourceIdMap(void)
+{
+    uint32           UsedMap[CFE_RESOURCEID_MAP_WORDS(UT_RESOURCEID_MAP_SLOTS)];
+    CFE_ResourceId_t IdList[UT_RESOURCEID_MAP_SLOTS];
+    CFE_ResourceId_t LastId;
+    CFE_ResourceId_t Id;
+    uint32           i;
+
+    UT_ResourceId_MapBase = CFE_RESOURCEID_MAKE_BASE(UT_RESOURCEID_BASE_OFFSET);
+    memset(UT_ResourceId_SlotUsed, 0, sizeof(UT_ResourceId_SlotUsed));
+    memset(UsedMap, 0, sizeof(UsedMap));
+
+    /* Filling the table issues the same IDs as the probing search, starting at index 0 */
+    LastId = CFE_ResourceId_FromInteger(UT_ResourceId_MapBase + UT_RESOURCEID_MAP_SLOTS - 1);
+    for (i = 0; i < UT_RESOURCEID_MAP_SLOTS; ++i)
+    {
+        IdList[i] = UT_ResourceId_AllocateFromMap(LastId, UsedMap);
+        LastId    = IdList[i];
+    }
+    UtAssert_UINT32_EQ(UsedMap[0], 0xFFFFFFFF);
+    UtAssert_UINT32_EQ(UsedMap[1], 0xFFFFFFFF);
+    UtAssert_UINT32_EQ(UsedMap[2], 0x3F);
+
+    /* Table is full */
+    Id = CFE_ResourceId_FindNextFree(LastId, UT_RESOURCEID_MAP_SLOTS, UsedMap, UT_ResourceId_CheckMapSlotUsed);
+    UtAssert_True(!CFE_ResourceId_IsDefined(Id), "CFE_ResourceId_FindNextFree() on full table");
+
+    /* Released slots are found in order, with new serial numbers */
+    for (i = 0; i < UT_RESOURCEID_MAP_SLOTS; i += 23)
+    {
+        UT_ResourceId_SlotUsed[i] = false;
+        CFE_ResourceId_MapRelease(IdList[i], UT_RESOURCEID_MAP_SLOTS, UsedMap);
+    }
+    for (i = 0; i < UT_RESOURCEID_MAP_SLOTS; i += 23)
+    {
+        Id = UT_ResourceId_AllocateFromMap(LastId, UsedMap);
+        UtAssert_True(CFE_ResourceId_ToInteger(Id) > CFE_ResourceId_ToInteger(IdList[i]),
+                      "ID not reused: previous=%lx, got=%lx", CFE_ResourceId_ToInteger(IdList[i]),
+                      CFE_ResourceId_ToInteger(Id));
+        IdList[i] = Id;
+        LastId    = Id;
+    }
+
+    /* A slot released without updating the map is still found */
+    UT_ResourceId_SlotUsed[10] = false;
+    IdList[10]                 = UT_ResourceId_AllocateFromMap(LastId, UsedMap);
+    LastId                     = IdList[10];
+    UtAssert_True(CFE_ResourceId_IsDefined(LastId), "CFE_ResourceId_FindNextFree() with stale map");
+
+    /* Slots used without updating the map are skipped, and the map is corrected */
+    memset(UsedMap, 0, sizeof(UsedMap));
+    UT_ResourceId_SlotUsed[50] = false;
+    IdList[50]                 = UT_ResourceId_AllocateFromMap(LastId, UsedMap);
+    LastId                     = IdList[50];
+    UtAssert_UINT32_EQ(UsedMap[0], 0xFFFFF800);
+    UtAssert_UINT32_EQ(UsedMap[1], 0x0007FFFF);
+    UtAssert_UINT32_EQ(UsedMap[2], 0x00);
+
+    /* Serial numbers wrap around the same way as the probing search */
+    memset(UT_ResourceId_SlotUsed, 0, sizeof(UT_ResourceId_SlotUsed));
+    memset(UsedMap, 0, sizeof(UsedMap));
+    UT_ResourceId_SlotUsed[0] = true;
+    CFE_ResourceId_MapSetUsed(UsedMap, 0);
+    LastId = CFE_ResourceId_FromInteger(UT_ResourceId_MapBase + CFE_RESOURCEID_MAX - 2);
+    for (i = 0; i < 5; ++i)
+    {
+        LastId = UT_ResourceId_AllocateFromMap(LastId, UsedMap);
+    }
+    UtAssert_True(CFE_ResourceId_GetSerial(LastId) < UT_RESOURCEID_MAP_SLOTS, "ID serial after wrap: id=%lx",
+                  CFE_ResourceId_ToInteger(LastId));
+    LastId = CFE_ResourceId_FromInteger(UT_ResourceId_MapBase + CFE_RESOURCEID_MAX);
+    LastId = UT_ResourceId_AllocateFromMap(LastId, UsedMap);
+
+    /* Table size filling the last map word, with a stale entry in the last slot */
+    UsedMap[0] = 0xFFFFFFFF;
+    UsedMap[1] = 0x7FFFFFFF;
+    UT_SetDefaultReturnValue(UT_KEY(UT_ResourceId_CheckIdSlotUsed), true);
+    Id = CFE_ResourceId_FindNextFree(CFE_ResourceId_FromInteger(UT_ResourceId_MapBase + 62), 64, UsedMap,
+                                     UT_ResourceId_CheckIdSlotUsed);
+    UtAssert_True(!CFE_ResourceId_IsDefined(Id), "CFE_ResourceId_FindNextFree() on full table with stale map");
+    UtAssert_UINT32_EQ(UsedMap[1], 0xFFFFFFFF);
+
+    /* Releasing undefined and reserved IDs, or with bad arguments, does nothing */
+    memset(UsedMap, 0xFF, sizeof(UsedMap));
+    CFE_ResourceId_MapRelease(CFE_RESOURCEID_UNDEFINED, UT_RESOURCEID_MAP_SLOTS, UsedMap);
+    CFE_ResourceId_MapRelease(CFE_RESOURCEID_RESERVED, UT_RESOURCEID_MAP_SLOTS, UsedMap);
+    CFE_ResourceId_MapRelease(LastId, 0, UsedMap);
+    CFE_ResourceId_MapRelease(LastId, UT_RESOURCEID_MAP_SLOTS, NULL);
+    UtAssert_UINT32_EQ(UsedMap[0] & UsedMap[1] & UsedMap[2], 0xFFFFFFFF);
+
+    /* Validate off-nominal inputs */
+    Id = CFE_ResourceId_FindNextFree(LastId, UT_RESOURCEID_MAP_SLOTS, NULL, UT_ResourceId_CheckMapSlotUsed);
+    UtAssert_True(!CFE_ResourceId_IsDefined(Id), "CFE_ResourceId_FindNextFree() without map");
+    Id = CFE_ResourceId_FindNextFree(LastId, UT_RESOURCEID_MAP_SLOTS, UsedMap, NULL);
+    UtAssert_True(!CFE_ResourceId_IsDefined(Id), "CFE_ResourceId_FindNextFree() without check function");
+    Id = CFE_ResourceId_FindNextFree(LastId, 0, UsedMap, UT_ResourceId_CheckMapSlotUsed);
+    UtAssert_True(!CFE_ResourceId_IsDefined(Id), "CFE_ResourceId_FindNextFree() on empty table");
+}
+
 void TestResourceID(void)
 {
     /*
@@ -161,6 +301,21 @@ void TestResourceID(void)
     UtAssert_True(TestIndex == RefIndex, "ID index after search: id=%lx, expected=%lu, got=%lu",
                   CFE_ResourceId_ToInteger(Id), (unsigned long)RefIndex, (unsigned long)TestIndex);
 
+    /* The inline conversion for tables of constant size must match the generic calculation */
+    UtAssert_BOOL_TRUE(CFE_RESOURCEID_TABLE_SIZE_IS_POW2(64));
+    UtAssert_BOOL_FALSE(CFE_RESOURCEID_TABLE_SIZE_IS_POW2(UT_RESOURCEID_TEST_SLOTS));
+    UtAssert_INT32_EQ(CFE_ResourceId_ToIndexInline(Id, RefBase, 64, CFE_RESOURCEID_TABLE_SIZE_IS_POW2(64), &TestIndex),
+                      CFE_SUCCESS);
+    UtAssert_UINT32_EQ(TestIndex, TestSerial % 64);
+    UtAssert_INT32_EQ(CFE_ResourceId_ToIndexInline(Id, RefBase, UT_RESOURCEID_TEST_SLOTS,
+                                                   CFE_RESOURCEID_TABLE_SIZE_IS_POW2(UT_RESOURCEID_TEST_SLOTS),
+                                                   &TestIndex),
+                      CFE_SUCCESS);
+    UtAssert_UINT32_EQ(TestIndex, TestSerial % UT_RESOURCEID_TEST_SLOTS);
+    UtAssert_INT32_EQ(CFE_ResourceId_ToIndexInline(Id, RefBase, 64, true, NULL), CFE_ES_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(CFE_ResourceId_ToIndexInline(Id, ~RefBase, 64, true, &TestIndex),
+                      CFE_ES_ERR_RESOURCEID_NOT_VALID);
+
     /* For valid Id check other invalid inputs */
     UtAssert_INT32_EQ(CFE_ResourceId_ToIndex(Id, RefBase, 1, NULL), CFE_ES_BAD_ARGUMENT);
     UtAssert_INT32_EQ(CFE_ResourceId_ToIndex(Id, RefBase, 0, &TestIndex), CFE_ES_ERR_RESOURCEID_NOT_VALID);
@@ -179,4 +334,5 @@ void TestResourceID(void)
 void UtTest_Setup(void)
 {
     UtTest_Add(TestResourceID, NULL, NULL, "Resource ID");
+    UtTest_Add(TestResourceIdMap, NULL, NULL, "Resource ID usage map");
 }
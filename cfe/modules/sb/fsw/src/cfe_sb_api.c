@@ -83,7 +83,7 @@ typedef struct
  *-----------------------------------------------------------------*/
 CFE_Status_t CFE_SB_PipeId_ToIndex(CFE_SB_PipeId_t PipeID, uint32 *Idx)
 {
-    return CFE_ResourceId_ToIndex(CFE_RESOURCEID_UNWRAP(PipeID), CFE_SB_PIPEID_BASE, CFE_PLATFORM_SB_MAX_PIPES, Idx);
+    return CFE_SB_PipeDescIdToIndex(PipeID, Idx);
 }
 
 /*----------------------------------------------------------------
@@ -134,8 +134,8 @@ CFE_Status_t CFE_SB_CreatePipe(CFE_SB_PipeId_t *PipeIdPtr, uint16 Depth, const c
         CFE_SB_LockSharedData(__func__, __LINE__);
 
         /* get first available entry in pipe table */
-        PendingPipeId =
-            CFE_ResourceId_FindNext(CFE_SB_Global.LastPipeId, CFE_PLATFORM_SB_MAX_PIPES, CFE_SB_CheckPipeDescSlotUsed);
+        PendingPipeId = CFE_ResourceId_FindNextFree(CFE_SB_Global.LastPipeId, CFE_PLATFORM_SB_MAX_PIPES,
+                                                    CFE_SB_Global.PipeIdMap, CFE_SB_CheckPipeDescSlotUsed);
         PipeDscPtr = CFE_SB_LocatePipeDescByID(CFE_SB_PIPEID_C(PendingPipeId));
 
         /* if pipe table is full, send event and return error */
@@ -212,6 +212,7 @@ CFE_Status_t CFE_SB_CreatePipe(CFE_SB_PipeId_t *PipeIdPtr, uint16 Depth, const c
          */
         if (PipeDscPtr != NULL)
         {
+            CFE_ResourceId_MapRelease(PendingPipeId, CFE_PLATFORM_SB_MAX_PIPES, CFE_SB_Global.PipeIdMap);
             CFE_SB_PipeDescSetFree(PipeDscPtr);
             PipeDscPtr = NULL;
         }
@@ -427,6 +428,7 @@ int32 CFE_SB_DeletePipeFull(CFE_SB_PipeId_t PipeId, CFE_ES_AppId_t AppId)
 
     if (Status == CFE_SUCCESS)
     {
+        CFE_ResourceId_MapRelease(CFE_RESOURCEID_UNWRAP(PipeId), CFE_PLATFORM_SB_MAX_PIPES, CFE_SB_Global.PipeIdMap);
         CFE_SB_PipeDescSetFree(PipeDscPtr);
         --CFE_SB_Global.StatTlmMsg.Payload.PipesInUse;
     }
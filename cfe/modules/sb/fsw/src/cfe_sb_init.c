@@ -60,7 +60,12 @@ int32 CFE_SB_EarlyInit(void)
     /* Clear task global */
     memset(&CFE_SB_Global, 0, sizeof(CFE_SB_Global));
 
-    OsStatus = OS_MutSemCreate(&CFE_SB_Global.SharedDataMutexId, "CFE_SB_DataMutex", 0);
+    /*
+     * SB never takes the shared data lock again while holding it; events
+     * are deferred until after the unlock, so no send path reenters SB.
+     */
+    OsStatus = OS_MutSemCreate(&CFE_SB_Global.SharedDataMutexId, "CFE_SB_DataMutex",
+                               OS_MUTEX_OPTION_ADAPTIVE | OS_MUTEX_OPTION_STATISTICS);
     if (OsStatus != OS_SUCCESS)
     {
         CFE_ES_WriteToSysLog("%s: Shared data mutex creation failed! RC=%ld\n", __func__, (long)OsStatus);
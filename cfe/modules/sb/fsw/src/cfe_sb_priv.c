@@ -128,8 +128,14 @@ int32 CFE_SB_CleanUpApp(CFE_ES_AppId_t AppId)
  *-----------------------------------------------------------------*/
 void CFE_SB_LockSharedData(const char *FuncName, int32 LineNumber)
 {
-    int32          OsStatus;
-    CFE_ES_AppId_t AppId;
+    int32                    OsStatus;
+    CFE_ES_AppId_t           AppId;
+    CFE_ES_LockProfileWait_t ProfileWait;
+
+    if (CFE_PLATFORM_ES_LOCK_PROFILE)
+    {
+        CFE_ES_LockProfileWait(CFE_ES_LockProfileLock_SB_SHARED_DATA, &ProfileWait);
+    }
 
     OsStatus = OS_MutSemTake(CFE_SB_Global.SharedDataMutexId);
     if (OsStatus != OS_SUCCESS)
@@ -138,6 +144,10 @@ void CFE_SB_LockSharedData(const char *FuncName, int32 LineNumber)
         CFE_ES_WriteToSysLog("%s: SharedData Mutex Take Err Stat=%ld,App=%lu,Func=%s,Line=%d\n", __func__,
                              (long)OsStatus, CFE_RESOURCEID_TO_ULONG(AppId), FuncName, (int)LineNumber);
     }
+    else if (CFE_PLATFORM_ES_LOCK_PROFILE)
+    {
+        CFE_ES_LockProfileAcquired(CFE_ES_LockProfileLock_SB_SHARED_DATA, &ProfileWait, FuncName, LineNumber);
+    }
 }
 
 /*----------------------------------------------------------------
@@ -151,6 +161,11 @@ void CFE_SB_UnlockSharedData(const char *FuncName, int32 LineNumber)
     int32          OsStatus;
     CFE_ES_AppId_t AppId;
 
+    if (CFE_PLATFORM_ES_LOCK_PROFILE)
+    {
+        CFE_ES_LockProfileRelease(CFE_ES_LockProfileLock_SB_SHARED_DATA);
+    }
+
     OsStatus = OS_MutSemGive(CFE_SB_Global.SharedDataMutexId);
     if (OsStatus != OS_SUCCESS)
     {
@@ -216,7 +231,7 @@ CFE_SB_PipeD_t *CFE_SB_LocatePipeDescByID(CFE_SB_PipeId_t PipeId)
     CFE_SB_PipeD_t *PipeDscPtr;
     uint32          Idx;
 
-    if (CFE_SB_PipeId_ToIndex(PipeId, &Idx) == CFE_SUCCESS)
+    if (CFE_SB_PipeDescIdToIndex(PipeId, &Idx) == CFE_SUCCESS)
     {
         PipeDscPtr = &CFE_SB_Global.PipeTbl[Idx];
     }
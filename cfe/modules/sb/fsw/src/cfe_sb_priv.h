@@ -41,6 +41,7 @@
 #include "cfe_msg_api_typedefs.h"
 #include "cfe_fs_api_typedefs.h"
 #include "cfe_resourceid_api_typedefs.h"
+#include "cfe_core_resourceid_basevalues.h"
 #include "cfe_sb_destination_typedef.h"
 #include "cfe_sb_msg.h"
 
@@ -248,6 +249,7 @@ typedef struct
     CFE_EVS_BinFilter_t          EventFilters[CFE_SB_MAX_CFG_FILE_EVENTS_TO_FILTER];
     CFE_SB_Qos_t                 Default_Qos;
     CFE_ResourceId_t             LastPipeId;
+    uint32                       PipeIdMap[CFE_RESOURCEID_MAP_WORDS(CFE_PLATFORM_SB_MAX_PIPES)];
 
     CFE_SB_BackgroundFileStateInfo_t BackgroundFile;
 
@@ -905,6 +907,21 @@ int32 CFE_SB_SendPrevSubsCmd(const CFE_SB_SendPrevSubsCmd_t *data);
  */
 CFE_SB_PipeD_t *CFE_SB_LocatePipeDescByID(CFE_SB_PipeId_t PipeId);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Convert a pipe ID to an index in its table
+ *
+ * Inline form of the conversion routine, for use within SB.
+ *
+ * @param[in]   PipeID  the ID to convert
+ * @param[out]  Idx     the table index
+ * @returns CFE_SUCCESS, or an error if the ID could never refer to a table entry
+ */
+static inline CFE_Status_t CFE_SB_PipeDescIdToIndex(CFE_SB_PipeId_t PipeID, uint32 *Idx)
+{
+    return CFE_RESOURCEID_TO_INDEX(PipeID, CFE_SB_PIPEID_BASE, CFE_PLATFORM_SB_MAX_PIPES, Idx);
+}
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * @brief Check if a Pipe descriptor is in use or free/empty
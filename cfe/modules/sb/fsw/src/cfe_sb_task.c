@@ -735,8 +735,9 @@ void CFE_SB_BackgroundFileEventHandler(void *Meta, CFE_FS_FileWriteEvent_t Event
     {
         case CFE_FS_FileWriteEvent_COMPLETE:
             CFE_EVS_SendEventWithAppID(CFE_SB_SND_RTG_EID, CFE_EVS_EventType_DEBUG, CFE_SB_Global.AppId,
-                                       "%s written:Size=%d,Entries=%d", BgFilePtr->FileWrite.FileName, (int)Position,
-                                       (int)RecordNum);
+                                       "%s written:Size=%d,Entries=%d,Writes=%d,Time=%dms",
+                                       BgFilePtr->FileWrite.FileName, (int)Position, (int)RecordNum,
+                                       (int)BgFilePtr->FileWrite.WriteCount, (int)BgFilePtr->FileWrite.ElapsedMsec);
             break;
 
         case CFE_FS_FileWriteEvent_HEADER_WRITE_ERROR:
@@ -1725,7 +1725,7 @@ void Test_CreatePipe_MaxPipes(void)
     /* Create maximum number of pipes + 1. Only one 'create pipe' failure
      * expected
      */
-    UT_SetDeferredRetcode(UT_KEY(CFE_ResourceId_ToIndex), 1 + CFE_PLATFORM_SB_MAX_PIPES, -1);
+    UT_SetDeferredRetcode(UT_KEY(CFE_ResourceId_FindNextFree), 1 + CFE_PLATFORM_SB_MAX_PIPES, -1);
     for (i = 0; i < (CFE_PLATFORM_SB_MAX_PIPES + 1); i++)
     {
         snprintf(PipeName, sizeof(PipeName), "TestPipe%ld", (long)i);
@@ -1762,8 +1762,7 @@ void Test_CreatePipe_MaxPipes(void)
     CFE_SB_Global.PipeTbl[2].PipeId = CFE_SB_INVALID_PIPE;
     UtAssert_BOOL_TRUE(CFE_SB_CheckPipeDescSlotUsed(UT_SB_MakePipeIdForIndex(1)));
     UtAssert_BOOL_FALSE(CFE_SB_CheckPipeDescSlotUsed(UT_SB_MakePipeIdForIndex(2)));
-    UT_SetDeferredRetcode(UT_KEY(CFE_ResourceId_ToIndex), 1, -1);
-    UtAssert_BOOL_TRUE(CFE_SB_CheckPipeDescSlotUsed(UT_SB_MakePipeIdForIndex(1)));
+    UtAssert_BOOL_TRUE(CFE_SB_CheckPipeDescSlotUsed(CFE_RESOURCEID_UNDEFINED));
 }
 
 /*
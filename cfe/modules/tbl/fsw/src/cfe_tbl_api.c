@@ -152,7 +152,7 @@ CFE_Status_t CFE_TBL_Register(CFE_TBL_Handle_t *TblHandlePtr, const char *Name,
     {
         /* Lock Registry for update.  This prevents two applications from        */
         /* trying to register/share tables at the same location at the same time */
-        CFE_TBL_LockRegistry();
+        CFE_TBL_LockRegistry(__func__, __LINE__);
 
         /* Check for duplicate table name */
         RegIndx = CFE_TBL_FindTableInRegistry(TblName);
@@ -478,7 +478,7 @@ CFE_Status_t CFE_TBL_Register(CFE_TBL_Handle_t *TblHandlePtr, const char *Name,
         }
 
         /* Unlock Registry for update */
-        CFE_TBL_UnlockRegistry();
+        CFE_TBL_UnlockRegistry(__func__, __LINE__);
     }
 
     /* On Error conditions, notify ground of screw up */
@@ -524,7 +524,7 @@ CFE_Status_t CFE_TBL_Share(CFE_TBL_Handle_t *TblHandlePtr, const char *TblName)
     {
         /* Lock Registry for update.  This prevents two applications from        */
         /* trying to register/share tables at the same location at the same time */
-        CFE_TBL_LockRegistry();
+        CFE_TBL_LockRegistry(__func__, __LINE__);
 
         RegIndx = CFE_TBL_FindTableInRegistry(TblName);
 
@@ -578,7 +578,7 @@ CFE_Status_t CFE_TBL_Share(CFE_TBL_Handle_t *TblHandlePtr, const char *TblName)
             CFE_ES_WriteToSysLog("%s: Table '%s' not found in Registry\n", __func__, TblName);
         }
 
-        CFE_TBL_UnlockRegistry();
+        CFE_TBL_UnlockRegistry(__func__, __LINE__);
     }
     else /* Application ID was invalid */
     {
@@ -300,7 +300,7 @@ int32 CFE_TBL_RemoveAccessLink(CFE_TBL_Handle_t TblHandle)
     CFE_TBL_RegistryRec_t *     RegRecPtr     = &CFE_TBL_Global.Registry[AccessDescPtr->RegIndex];
 
     /* Lock Access to the table while we modify the linked list */
-    CFE_TBL_LockRegistry();
+    CFE_TBL_LockRegistry(__func__, __LINE__);
 
     /* If we are removing the head of the linked list, then point */
     /* the head pointer to the link after this one                */
@@ -374,7 +374,7 @@ int32 CFE_TBL_RemoveAccessLink(CFE_TBL_Handle_t TblHandle)
     }
 
     /* Unlock the registry to allow others to modify it */
-    CFE_TBL_UnlockRegistry();
+    CFE_TBL_UnlockRegistry(__func__, __LINE__);
 
     return Status;
 }
@@ -586,15 +586,26 @@ void CFE_TBL_FormTableName(char *FullTblName, const char *TblName, CFE_ES_AppId_
  * See description in header file for argument/return detail
  *
  *-----------------------------------------------------------------*/
-int32 CFE_TBL_LockRegistry(void)
+int32 CFE_TBL_LockRegistry(const char *FunctionName, int32 LineNumber)
 {
-    int32 OsStatus;
-    int32 Status;
+    int32                    OsStatus;
+    int32                    Status;
+    CFE_ES_LockProfileWait_t ProfileWait;
+
+    if (CFE_PLATFORM_ES_LOCK_PROFILE)
+    {
+        CFE_ES_LockProfileWait(CFE_ES_LockProfileLock_TBL_REGISTRY, &ProfileWait);
+    }
 
     OsStatus = OS_MutSemTake(CFE_TBL_Global.RegistryMutex);
 
     if (OsStatus == OS_SUCCESS)
     {
+        if (CFE_PLATFORM_ES_LOCK_PROFILE)
+        {
+            CFE_ES_LockProfileAcquired(CFE_ES_LockProfileLock_TBL_REGISTRY, &ProfileWait, FunctionName, LineNumber);
+        }
+
         Status = CFE_SUCCESS;
     }
     else
@@ -611,11 +622,16 @@ int32 CFE_TBL_LockRegistry(void)
  * See description in header file for argument/return detail
  *
  *-----------------------------------------------------------------*/
-int32 CFE_TBL_UnlockRegistry(void)
+int32 CFE_TBL_UnlockRegistry(const char *FunctionName, int32 LineNumber)
 {
     int32 OsStatus;
     int32 Status;
 
+    if (CFE_PLATFORM_ES_LOCK_PROFILE)
+    {
+        CFE_ES_LockProfileRelease(CFE_ES_LockProfileLock_TBL_REGISTRY);
+    }
+
     OsStatus = OS_MutSemGive(CFE_TBL_Global.RegistryMutex);
 
     if (OsStatus == OS_SUCCESS)
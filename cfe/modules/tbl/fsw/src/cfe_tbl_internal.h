@@ -268,9 +268,12 @@ void CFE_TBL_FormTableName(char *FullTblName, const char *TblName, CFE_ES_AppId_
 ** \par Assumptions, External Events, and Notes:
 **          None
 **
+** \param[in] FunctionName  The name of the calling function
+** \param[in] LineNumber    The line number of the call
+**
 ** \retval #CFE_SUCCESS                     \copydoc CFE_SUCCESS
 */
-int32 CFE_TBL_LockRegistry(void);
+int32 CFE_TBL_LockRegistry(const char *FunctionName, int32 LineNumber);
 
 /*---------------------------------------------------------------------------------------*/
 /**
@@ -283,10 +286,13 @@ int32 CFE_TBL_LockRegistry(void);
 ** \par Assumptions, External Events, and Notes:
 **          None
 **
+** \param[in] FunctionName  The name of the calling function
+** \param[in] LineNumber    The line number of the call
+**
 ** \retval #CFE_SUCCESS                     \copydoc CFE_SUCCESS
 **
 */
-int32 CFE_TBL_UnlockRegistry(void);
+int32 CFE_TBL_UnlockRegistry(const char *FunctionName, int32 LineNumber);
 
 /*---------------------------------------------------------------------------------------*/
 /**
@@ -42,8 +42,9 @@
 */
 /** \name Registry Mutex Definitions */
 /**  \{ */
-#define CFE_TBL_MUT_REG_NAME   "TBL_REG_MUT" /**< \brief Name of Mutex controlling Registry Access */
-#define CFE_TBL_MUT_REG_VALUE  0             /**< \brief Initial Value of Registry Access Mutex */
+#define CFE_TBL_MUT_REG_NAME "TBL_REG_MUT" /**< \brief Name of Mutex controlling Registry Access */
+/** \brief Options of Registry Access Mutex, the registry lock is never taken again while held */
+#define CFE_TBL_MUT_REG_VALUE  (OS_MUTEX_OPTION_ADAPTIVE | OS_MUTEX_OPTION_STATISTICS)
 #define CFE_TBL_MUT_WORK_NAME  "TBL_WRK_MUT" /**< \brief Name of Mutex controlling Working Buffer Assignment */
 #define CFE_TBL_MUT_WORK_VALUE 0             /**< \brief Initial Value of Working Buffer Assignment Mutex */
 /** \} */
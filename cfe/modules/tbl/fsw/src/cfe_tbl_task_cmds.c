@@ -1030,7 +1030,7 @@ bool CFE_TBL_DumpRegistryGetter(void *Meta, uint32 RecordNum, void **Buffer, siz
         RegRecPtr = &CFE_TBL_Global.Registry[RecordNum];
 
         /* should lock registry while copying out data to ensure its in consistent state */
-        CFE_TBL_LockRegistry();
+        CFE_TBL_LockRegistry(__func__, __LINE__);
 
         /* Check to see if the Registry entry is empty */
         if (!CFE_RESOURCEID_TEST_EQUAL(RegRecPtr->OwnerAppId, CFE_TBL_NOT_OWNED) ||
@@ -1090,7 +1090,7 @@ bool CFE_TBL_DumpRegistryGetter(void *Meta, uint32 RecordNum, void **Buffer, siz
         }
 
         /* Unlock now - remainder of data gathering uses ES */
-        CFE_TBL_UnlockRegistry();
+        CFE_TBL_UnlockRegistry(__func__, __LINE__);
     }
 
     /*
@@ -1150,15 +1150,19 @@ void CFE_TBL_DumpRegistryEventHandler(void *Meta, CFE_FS_FileWriteEvent_t Event,
             {
                 CFE_EVS_SendEventWithAppID(CFE_TBL_OVERWRITE_REG_DUMP_INF_EID, CFE_EVS_EventType_DEBUG,
                                            CFE_TBL_Global.TableTaskAppId,
-                                           "Successfully overwrote '%s' with Table Registry:Size=%d,Entries=%d",
-                                           StatePtr->FileWrite.FileName, (int)Position, (int)RecordNum);
+                                           "Successfully overwrote '%s' with Table Registry:Size=%d,Entries=%d,"
+                                           "Writes=%d,Time=%dms",
+                                           StatePtr->FileWrite.FileName, (int)Position, (int)RecordNum,
+                                           (int)StatePtr->FileWrite.WriteCount, (int)StatePtr->FileWrite.ElapsedMsec);
             }
             else
             {
                 CFE_EVS_SendEventWithAppID(CFE_TBL_WRITE_REG_DUMP_INF_EID, CFE_EVS_EventType_DEBUG,
                                            CFE_TBL_Global.TableTaskAppId,
-                                           "Successfully dumped Table Registry to '%s':Size=%d,Entries=%d",
-                                           StatePtr->FileWrite.FileName, (int)Position, (int)RecordNum);
+                                           "Successfully dumped Table Registry to '%s':Size=%d,Entries=%d,"
+                                           "Writes=%d,Time=%dms",
+                                           StatePtr->FileWrite.FileName, (int)Position, (int)RecordNum,
+                                           (int)StatePtr->FileWrite.WriteCount, (int)StatePtr->FileWrite.ElapsedMsec);
             }
             break;
 
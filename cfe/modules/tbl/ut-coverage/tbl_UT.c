@@ -3790,7 +3790,7 @@ void Test_CFE_TBL_Internal(void)
      */
     UT_InitData();
     UT_SetDeferredRetcode(UT_KEY(OS_MutSemTake), 1, OS_ERROR);
-    UtAssert_INT32_EQ(CFE_TBL_LockRegistry(), CFE_STATUS_EXTERNAL_RESOURCE_FAIL);
+    UtAssert_INT32_EQ(CFE_TBL_LockRegistry(__func__, __LINE__), CFE_STATUS_EXTERNAL_RESOURCE_FAIL);
     CFE_UtAssert_EVENTCOUNT(0);
 
     /* Test CFE_TBL_UnlockRegistry response when an error occurs giving the
@@ -3798,7 +3798,7 @@ void Test_CFE_TBL_Internal(void)
      */
     UT_InitData();
     UT_SetDeferredRetcode(UT_KEY(OS_MutSemGive), 1, OS_ERROR);
-    UtAssert_INT32_EQ(CFE_TBL_UnlockRegistry(), CFE_STATUS_EXTERNAL_RESOURCE_FAIL);
+    UtAssert_INT32_EQ(CFE_TBL_UnlockRegistry(__func__, __LINE__), CFE_STATUS_EXTERNAL_RESOURCE_FAIL);
     CFE_UtAssert_EVENTCOUNT(0);
 
     /* Test CFE_TBL_LoadFromFile response to an invalid header length */
@@ -206,6 +206,45 @@ set(OSAL_CONFIG_CONSOLE_ASYNC                   TRUE
     CACHE BOOL "Controls spawning of a separate utility task for OS_printf"
 )
 
+#
+# OSAL_CONFIG_POSIX_FUTEX_SEMAPHORES
+# ----------------------------------
+#
+# Controls the binary/counting semaphore implementation of the POSIX OSAL on Linux
+#
+# If set TRUE (default), semaphores are built directly on a futex word.  An
+# uncontended give or take is then a single atomic operation without any
+# system call, and the kernel is only entered to block or to wake a waiter.
+#
+# If set FALSE, binary semaphores use a priority-inheriting pthread mutex plus
+# a condition variable and counting semaphores use POSIX sem_t.  This may be
+# useful to compare performance (see sem-speed-test) or where the mutex
+# priority inheritance on the binary semaphore internals is wanted.
+#
+# This option has no effect on other operating systems or on non-Linux POSIX.
+#
+set(OSAL_CONFIG_POSIX_FUTEX_SEMAPHORES          TRUE
+    CACHE BOOL "Use futex-based semaphores in the POSIX OSAL on Linux"
+)
+
+#
+# OSAL_CONFIG_POSIX_IO_URING
+# --------------------------
+#
+# Controls the OS_FileAsyncSubmit() implementation of the POSIX OSAL on Linux
+#
+# If set TRUE (default), asynchronous file requests are handed to the kernel
+# through an io_uring instance, and a single thread collects the completions.
+# If the running kernel does not provide io_uring (or it is disabled), the
+# implementation falls back to the worker thread pool at run time.
+#
+# If set FALSE, a small pool of worker threads always performs the requests
+# with pread()/pwrite()/fsync(), which is also what other POSIX systems use.
+#
+set(OSAL_CONFIG_POSIX_IO_URING                  TRUE
+    CACHE BOOL "Use io_uring for asynchronous file I/O in the POSIX OSAL on Linux"
+)
+
 #############################################
 # Resource Limits for the OS API
 #############################################
@@ -243,6 +282,11 @@ set(OSAL_CONFIG_MAX_CONDVARS             4
     CACHE STRING "Maximum Number of Condition Variables to support"
 )
 
+# The maximum number of stream pollers to support
+set(OSAL_CONFIG_MAX_POLLERS              4
+    CACHE STRING "Maximum Number of Stream Pollers to support"
+)
+
 # The maximum number of loadable modules to support
 # Note that emulating module loading for statically-linked objects also
 # requires a slot in this table, as it still assigns an OSAL ID.
@@ -265,6 +309,22 @@ set(OSAL_CONFIG_MAX_NUM_OPEN_FILES      50
     CACHE STRING "Maximum Number of Open Files to support"
 )
 
+# The maximum number of OS_FileAsyncSubmit() requests that may be pending at once
+set(OSAL_CONFIG_MAX_FILE_ASYNC_OPS      32
+    CACHE STRING "Maximum Number of pending asynchronous file operations"
+)
+
+# The maximum number of OS_TaskPoolSubmit() jobs that may be queued or running at once
+set(OSAL_CONFIG_MAX_TASK_POOL_JOBS      64
+    CACHE STRING "Maximum Number of outstanding task pool jobs"
+)
+
+# The maximum number of task pool worker threads.  Fewer are started if the
+# system has fewer CPUs online.
+set(OSAL_CONFIG_MAX_TASK_POOL_WORKERS   4
+    CACHE STRING "Maximum Number of task pool worker threads"
+)
+
 # The maximum number of concurrently open directory descriptors to support
 set(OSAL_CONFIG_MAX_NUM_OPEN_DIRS       4
     CACHE STRING "Maximum Number of Open Directories to support"
@@ -326,6 +386,14 @@ set(OSAL_CONFIG_UTILITYTASK_PRIORITY    245
     CACHE STRING "Priority level for the background utility task"
 )
 
+# Priority level of the task pool worker threads
+#
+# Jobs submitted with OS_TaskPoolSubmit() all run at this priority,
+# regardless of the priority of the submitting task.
+set(OSAL_CONFIG_TASK_POOL_PRIORITY      200
+    CACHE STRING "Priority level for the task pool worker threads"
+)
+
 # Stack size of console output task.
 #
 # This applies to RTOS layers with precise stack control,
@@ -109,6 +109,45 @@ typedef enum
     OS_FILE_FLAG_TRUNCATE = 0x02
 } OS_file_flag_t;
 
+/**
+ * @brief Operations that can be requested with OS_FileAsyncSubmit()
+ */
+typedef enum
+{
+    OS_FILE_ASYNC_READ  = 1, /**< Read nbytes at offset into buffer, like OS_pread() */
+    OS_FILE_ASYNC_WRITE = 2, /**< Write nbytes from buffer at offset, like OS_pwrite() */
+    OS_FILE_ASYNC_FSYNC = 3  /**< Flush written data of the file to the storage device */
+} OS_file_async_op_t;
+
+/**
+ * @brief An asynchronous file I/O request
+ *
+ * The buffer must remain valid, and must not be otherwise accessed,
+ * until the completion for the request has been received.
+ */
+typedef struct
+{
+    osal_id_t filedes;  /**< Open file handle to operate on */
+    uint32    opcode;   /**< Operation to perform, see @ref OS_file_async_op_t */
+    void *    buffer;   /**< Data buffer, not used for OS_FILE_ASYNC_FSYNC */
+    size_t    nbytes;   /**< Number of bytes to transfer, not used for OS_FILE_ASYNC_FSYNC */
+    size_t    offset;   /**< Position in the file, relative to the start of the file */
+    void *    user_arg; /**< Opaque value passed back in the completion */
+} OS_file_async_request_t;
+
+/**
+ * @brief The completion of an asynchronous file I/O request
+ *
+ * This is the message posted to the completion queue given to OS_FileAsyncSubmit().
+ */
+typedef struct
+{
+    void *    user_arg; /**< The user_arg of the request */
+    osal_id_t filedes;  /**< The file handle of the request */
+    uint32    opcode;   /**< The opcode of the request */
+    int32     result;   /**< Byte count transferred (0 for fsync), or an OSAL error code if negative */
+} OS_file_async_completion_t;
+
 /*
  * Exported Functions
  */
@@ -147,7 +186,8 @@ int32 OS_OpenCreate(osal_id_t *filedes, const char *path, int32 flags, int32 acc
  * @brief Closes an open file handle
  *
  * This closes regular file handles and any other file-like resource, such as
- * network streams or pipes.
+ * network streams or pipes.  A memory mapping of the file made with OS_FileMap()
+ * is removed as well.
  *
  * @param[in] filedes   The handle ID to operate on
  *
@@ -283,6 +323,147 @@ int32 OS_TimedRead(osal_id_t filedes, void *buffer, size_t nbytes, int32 timeout
  */
 int32 OS_TimedWrite(osal_id_t filedes, const void *buffer, size_t nbytes, int32 timeout);
 
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Read from a file handle at a given offset
+ *
+ * Reads up to nbytes from the file, starting at offset bytes from the beginning
+ * of the file, and puts them into buffer.  The file position is neither used nor
+ * changed, so no OS_lseek() is needed beforehand, and several tasks may read
+ * from the same handle.
+ *
+ * This is intended for regular files.  Handles that cannot seek, such as pipes
+ * and sockets, do not support it.
+ *
+ * @param[in]  filedes  The handle ID to operate on
+ * @param[out] buffer   Storage location for file data @nonnull
+ * @param[in]  nbytes   Maximum number of bytes to read @nonzero
+ * @param[in]  offset   Position in the file to read from, relative to the start of the file
+ *
+ * @note All OSAL error codes are negative int32 values.  Failure of this
+ * call can be checked by testing if the result is less than 0.
+ *
+ * @return A non-negative byte count or appropriate error code, see @ref OSReturnCodes
+ * @retval #OS_INVALID_POINTER if buffer is a null pointer
+ * @retval #OS_ERR_INVALID_SIZE if the passed-in size is not valid
+ * @retval #OS_ERR_INVALID_ID if the file descriptor passed in is invalid
+ * @retval #OS_ERR_OPERATION_NOT_SUPPORTED if the handle does not support positioned I/O
+ * @retval #OS_ERROR if OS call failed @covtest
+ * @retval 0 if the offset is at or beyond the end of file
+ */
+int32 OS_pread(osal_id_t filedes, void *buffer, size_t nbytes, size_t offset);
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Write to a file handle at a given offset
+ *
+ * Writes up to nbytes from buffer to the file, starting at offset bytes from
+ * the beginning of the file.  The file position is neither used nor changed.
+ *
+ * This is intended for regular files.  Handles that cannot seek, such as pipes
+ * and sockets, do not support it.
+ *
+ * @param[in] filedes   The handle ID to operate on
+ * @param[in] buffer    Source location for file data @nonnull
+ * @param[in] nbytes    Maximum number of bytes to write @nonzero
+ * @param[in] offset    Position in the file to write to, relative to the start of the file
+ *
+ * @note All OSAL error codes are negative int32 values.  Failure of this
+ * call can be checked by testing if the result is less than 0.
+ *
+ * @return A non-negative byte count or appropriate error code, see @ref OSReturnCodes
+ * @retval #OS_INVALID_POINTER if buffer is NULL
+ * @retval #OS_ERR_INVALID_SIZE if the passed-in size is not valid
+ * @retval #OS_ERR_INVALID_ID if the file descriptor passed in is invalid
+ * @retval #OS_ERR_OPERATION_NOT_SUPPORTED if the handle does not support positioned I/O
+ * @retval #OS_ERROR if OS call failed @covtest
+ */
+int32 OS_pwrite(osal_id_t filedes, const void *buffer, size_t nbytes, size_t offset);
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Map part of an open file into memory for reading
+ *
+ * Makes length bytes of the file, starting at offset bytes from the beginning of
+ * the file, readable at the address output in addr without copying them into a
+ * separate buffer.  The mapped memory must only be read.
+ *
+ * A file handle can have one mapping at a time.  The mapping stays valid until
+ * OS_FileUnmap() is called or the handle is closed.
+ *
+ * @note Not every OS supports mapping files.  If #OS_ERR_NOT_IMPLEMENTED is
+ *       returned, the caller should read the data with OS_pread() instead.
+ *
+ * @param[in]  filedes  The handle ID to operate on, opened with read access
+ * @param[in]  offset   Position of the first byte to map, relative to the start of the file
+ * @param[in]  length   Number of bytes to map @nonzero
+ * @param[out] addr     Set to the address of the first mapped byte @nonnull
+ *
+ * @return Execution status, see @ref OSReturnCodes
+ * @retval #OS_SUCCESS @copybrief OS_SUCCESS
+ * @retval #OS_INVALID_POINTER if addr is NULL
+ * @retval #OS_ERR_INVALID_SIZE if length is zero, or the range extends beyond the end of file
+ * @retval #OS_ERR_INVALID_ID if the file descriptor passed in is invalid
+ * @retval #OS_ERR_INCORRECT_OBJ_STATE if the handle is already mapped
+ * @retval #OS_ERR_NOT_IMPLEMENTED if the OS does not support mapping files
+ * @retval #OS_ERROR if OS call failed @covtest
+ */
+int32 OS_FileMap(osal_id_t filedes, size_t offset, size_t length, void **addr);
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Remove the memory mapping of a file
+ *
+ * Removes the mapping that was created by OS_FileMap() for the file handle.
+ * The address output by OS_FileMap() must not be used afterwards.
+ *
+ * @param[in] filedes   The handle ID to operate on
+ *
+ * @return Execution status, see @ref OSReturnCodes
+ * @retval #OS_SUCCESS @copybrief OS_SUCCESS
+ * @retval #OS_ERR_INVALID_ID if the file descriptor passed in is invalid
+ * @retval #OS_ERR_INCORRECT_OBJ_STATE if the handle is not mapped
+ * @retval #OS_ERROR if OS call failed @covtest
+ */
+int32 OS_FileUnmap(osal_id_t filedes);
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Start an asynchronous read, write or fsync on a file handle
+ *
+ * Queues the request and returns without waiting for the I/O.  When the
+ * operation finishes, an OS_file_async_completion_t is put on the
+ * completion queue, which must be an OSAL queue created with a data size of
+ * at least sizeof(OS_file_async_completion_t).  The queue should be deep
+ * enough for every request the caller keeps outstanding, otherwise a
+ * completion may be lost.
+ *
+ * Reads and writes are positioned, like OS_pread() and OS_pwrite(), so
+ * several requests on the same handle may be in flight and may complete in
+ * any order.  An fsync is not ordered against requests submitted before it;
+ * wait for those completions first if it must cover them.
+ *
+ * A pending request holds a reference to the file handle, so OS_close()
+ * waits until it has completed.
+ *
+ * @note Not every OS supports asynchronous I/O.  If #OS_ERR_NOT_IMPLEMENTED is
+ *       returned, the caller should use OS_pread()/OS_pwrite() directly.
+ *
+ * @param[in] request           The operation to perform @nonnull
+ * @param[in] completion_queue  Queue to receive the completion
+ *
+ * @return Execution status, see @ref OSReturnCodes
+ * @retval #OS_SUCCESS if the request was queued, the completion reports the I/O result
+ * @retval #OS_INVALID_POINTER if request is NULL, or the buffer of a read or write is NULL
+ * @retval #OS_ERR_INVALID_SIZE if nbytes of a read or write is not valid
+ * @retval #OS_ERR_INVALID_ID if the file handle or completion queue is invalid
+ * @retval #OS_ERR_OPERATION_NOT_SUPPORTED if the opcode is not known
+ * @retval #OS_ERR_NO_FREE_IDS if #OS_MAX_FILE_ASYNC_OPS requests are already pending
+ * @retval #OS_ERR_NOT_IMPLEMENTED if the OS does not support asynchronous file I/O
+ * @retval #OS_ERROR if OS call failed @covtest
+ */
+int32 OS_FileAsyncSubmit(const OS_file_async_request_t *request, osal_id_t completion_queue);
+
 /*-------------------------------------------------------------------------------------*/
 /**
  * @brief Changes the permissions of a file
@@ -27,12 +27,71 @@
 
 #include "osconfig.h"
 #include "common_types.h"
+#include "osapi-clock.h"
 
-/** @brief OSAL mutex properties */
+/**
+ * @brief Create a mutex that cannot be taken again by the task that holds it
+ *
+ * When supplied in the "options" argument to OS_MutSemCreate(), nested takes
+ * by the owner are not supported, which allows a cheaper lock on some
+ * operating systems.  Only use this for critical sections that are known not
+ * to nest.  Ignored where the OS mutex is always recursive.
+ */
+#define OS_MUTEX_OPTION_NONRECURSIVE 0x01
+
+/**
+ * @brief Create a mutex that spins briefly before blocking
+ *
+ * Intended for short critical sections where the holder is likely to release
+ * the mutex before a context switch would complete.  Implies
+ * #OS_MUTEX_OPTION_NONRECURSIVE.  This is a hint: on POSIX it is ignored
+ * while real-time task priorities are in effect, so that priority inheritance
+ * is kept, and it is ignored entirely where the OS does not support it.
+ */
+#define OS_MUTEX_OPTION_ADAPTIVE 0x02
+
+/**
+ * @brief Create a mutex that uses the priority ceiling protocol
+ *
+ * A task holding the mutex runs at the highest OSAL task priority, instead
+ * of inheriting the priority of a blocked waiter.  This bounds priority
+ * inversion without any waiter bookkeeping, at the cost of a priority change
+ * on every take.  Takes precedence over #OS_MUTEX_OPTION_ADAPTIVE.  Ignored
+ * where the OS does not support it or real-time priorities are not available.
+ *
+ * @note On POSIX, only tasks running under a real-time scheduling policy may
+ * take such a mutex; a take from any other thread fails with #OS_SEM_FAILURE.
+ */
+#define OS_MUTEX_OPTION_PRIO_CEILING 0x04
+
+/**
+ * @brief Collect usage statistics for the mutex
+ *
+ * The statistics in #OS_mut_sem_prop_t are only maintained for a mutex
+ * created with this option.  This adds a contention check and two clock
+ * reads to every take and give, so it is meant for characterizing locks,
+ * not for general use.  Ignored where the OS implementation does not
+ * support statistics.  Does not change the type or protocol of the mutex.
+ */
+#define OS_MUTEX_OPTION_STATISTICS 0x08
+
+/**
+ * @brief OSAL mutex properties
+ *
+ * The usage statistics are cumulative since the mutex was created and are
+ * only maintained for a mutex created with #OS_MUTEX_OPTION_STATISTICS,
+ * where the OS implementation supports it; otherwise they read as zero.
+ * They are sampled without taking the mutex, so the values may be slightly
+ * inconsistent with each other while the mutex is in use.
+ */
 typedef struct
 {
     char      name[OS_MAX_API_NAME];
     osal_id_t creator;
+    uint32    take_count;       /**< Number of successful takes */
+    uint32    contention_count; /**< Number of takes that had to wait for another task */
+    OS_time_t total_hold_time;  /**< Total time the mutex was held, from outermost take to give */
+    OS_time_t max_hold_time;    /**< Longest single time the mutex was held */
 } OS_mut_sem_prop_t;
 
 /** @defgroup OSAPIMutex OSAL Mutex APIs
@@ -47,7 +106,8 @@ typedef struct
  *
  * @param[out]  sem_id will be set to the non-zero ID of the newly-created resource @nonnull
  * @param[in]   sem_name the name of the new resource to create @nonnull
- * @param[in]   options reserved for future use.  Should be passed as 0.
+ * @param[in]   options Zero for the default recursive mutex with priority inheritance,
+ *                      or a combination of the OS_MUTEX_OPTION_* flags
  *
  * @return Execution status, see @ref OSReturnCodes
  * @retval #OS_SUCCESS @copybrief OS_SUCCESS
@@ -134,8 +194,8 @@ int32 OS_MutSemGetIdByName(osal_id_t *sem_id, const char *sem_name);
  * @brief Fill a property object buffer with details regarding the resource
  *
  * This function will pass back a pointer to structure that contains
- * all of the relevant info( name and creator) about the specified mutex
- * semaphore.
+ * all of the relevant info (name, creator and usage statistics) about the
+ * specified mutex semaphore.
  *
  * @param[in]  sem_id The object ID to operate on
  * @param[out] mut_prop The property object buffer to fill @nonnull
@@ -0,0 +1,163 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * \file
+ *
+ * Declarations and prototypes for persistent stream pollers
+ */
+
+#ifndef OSAPI_POLLER_H
+#define OSAPI_POLLER_H
+
+#include "osconfig.h"
+#include "common_types.h"
+
+#include "osapi-select.h" /* required for OS_StreamState_t flag values */
+
+/**
+ * @brief A single readiness event reported by OS_PollerWait()
+ *
+ * @sa OS_PollerWait()
+ */
+typedef struct
+{
+    osal_id_t objid;      /**< @brief The file or socket that is ready */
+    uint32    StateFlags; /**< @brief Combination of #OS_STREAM_STATE_READABLE and #OS_STREAM_STATE_WRITABLE */
+} OS_poller_event_t;
+
+/** @defgroup OSAPIPoller OSAL Stream Poller APIs
+ * @{
+ */
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Creates a persistent stream poller
+ *
+ * A poller holds a set of file or socket IDs that are watched for readability
+ * and/or writability.  Unlike OS_SelectMultiple(), the set is registered once
+ * and retained between calls to OS_PollerWait(), so the cost of each wait is
+ * proportional to the number of ready streams rather than the number watched,
+ * where the underlying OS supports it (e.g. epoll on Linux).  On other systems
+ * the poller is implemented on top of select().
+ *
+ * @param[out]  poller_id will be set to the non-zero ID of the newly-created resource @nonnull
+ * @param[in]   poller_name the name of the new resource to create @nonnull
+ * @param[in]   options reserved for future use.  Should be passed as 0.
+ *
+ * @return Execution status, see @ref OSReturnCodes
+ * @retval #OS_SUCCESS @copybrief OS_SUCCESS
+ * @retval #OS_INVALID_POINTER if poller_id or poller_name are NULL
+ * @retval #OS_ERR_NAME_TOO_LONG name length including null terminator greater than #OS_MAX_API_NAME
+ * @retval #OS_ERR_NO_FREE_IDS if there are no more free poller Ids
+ * @retval #OS_ERR_NAME_TAKEN if there is already a poller with the same name
+ * @retval #OS_ERROR if the underlying OS resource could not be created
+ */
+int32 OS_PollerCreate(osal_id_t *poller_id, const char *poller_name, uint32 options);
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Deletes a stream poller
+ *
+ * Streams registered with the poller are not affected.
+ *
+ * @param[in] poller_id The object ID to delete
+ *
+ * @return Execution status, see @ref OSReturnCodes
+ * @retval #OS_SUCCESS @copybrief OS_SUCCESS
+ * @retval #OS_ERR_INVALID_ID if the id passed in is not a valid poller
+ * @retval #OS_ERROR if the underlying OS resource could not be released
+ */
+int32 OS_PollerDelete(osal_id_t poller_id);
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Registers a stream with a poller, or changes the states it is watched for
+ *
+ * @note A stream should be removed from all pollers before it is closed.
+ *
+ * @param[in] poller_id The poller to modify
+ * @param[in] objid     The file or socket to watch
+ * @param[in] StateFlags Combination of #OS_STREAM_STATE_READABLE and #OS_STREAM_STATE_WRITABLE
+ *
+ * @return Execution status, see @ref OSReturnCodes
+ * @retval #OS_SUCCESS @copybrief OS_SUCCESS
+ * @retval #OS_ERR_INVALID_ID if either id is not valid
+ * @retval #OS_ERR_INVALID_ARGUMENT if StateFlags does not contain a readable or writable state
+ * @retval #OS_ERR_OPERATION_NOT_SUPPORTED if the stream cannot be polled
+ */
+int32 OS_PollerAdd(osal_id_t poller_id, osal_id_t objid, uint32 StateFlags);
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Removes a stream from a poller
+ *
+ * @param[in] poller_id The poller to modify
+ * @param[in] objid     The file or socket to stop watching
+ *
+ * @return Execution status, see @ref OSReturnCodes
+ * @retval #OS_SUCCESS @copybrief OS_SUCCESS
+ * @retval #OS_ERR_INVALID_ID if either id is not valid
+ * @retval #OS_ERR_INCORRECT_OBJ_STATE if the stream is not registered with the poller
+ */
+int32 OS_PollerRemove(osal_id_t poller_id, osal_id_t objid);
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Waits for any registered stream to become ready
+ *
+ * Blocks until at least one registered stream reaches a state it is watched for,
+ * or the timeout elapses.  Up to max_events ready streams are reported; any
+ * others remain ready and will be reported by the next call.
+ *
+ * @param[in]  poller_id  The poller to wait on
+ * @param[out] events     Buffer to receive the ready streams @nonnull
+ * @param[in]  max_events Number of entries in the events buffer @nonzero
+ * @param[out] num_events Set to the number of entries written to events @nonnull
+ * @param[in]  msecs      Timeout in milliseconds: positive values wait at most this long,
+ *                        0 polls, and negative values wait forever
+ *
+ * @return Execution status, see @ref OSReturnCodes
+ * @retval #OS_SUCCESS if at least one stream is ready
+ * @retval #OS_ERROR_TIMEOUT if no stream became ready within the timeout
+ * @retval #OS_INVALID_POINTER if events or num_events are NULL
+ * @retval #OS_ERR_INVALID_SIZE if max_events is zero
+ * @retval #OS_ERR_INVALID_ID if the id passed in is not a valid poller
+ * @retval #OS_ERROR if the underlying OS call failed
+ */
+int32 OS_PollerWait(osal_id_t poller_id, OS_poller_event_t *events, uint32 max_events, uint32 *num_events,
+                    int32 msecs);
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Find an existing poller ID by name
+ *
+ * @param[out] poller_id will be set to the ID of the existing resource
+ * @param[in]  poller_name the name of the existing resource to find @nonnull
+ *
+ * @return Execution status, see @ref OSReturnCodes
+ * @retval #OS_SUCCESS @copybrief OS_SUCCESS
+ * @retval #OS_INVALID_POINTER is id or name are NULL pointers
+ * @retval #OS_ERR_NAME_TOO_LONG name length including null terminator greater than #OS_MAX_API_NAME
+ * @retval #OS_ERR_NAME_NOT_FOUND if the name was not found in the table
+ */
+int32 OS_PollerGetIdByName(osal_id_t *poller_id, const char *poller_name);
+
+/**@}*/
+
+#endif /* OSAPI_POLLER_H */
@@ -28,6 +28,21 @@
 #include "osconfig.h"
 #include "common_types.h"
 
+/**
+ * @brief OSAL console output statistics
+ *
+ * Counters are cumulative since OSAL initialization.
+ */
+typedef struct
+{
+    uint32 MessageCount;     /**< Lines accepted into the console buffer */
+    uint32 OverflowEvents;   /**< Lines dropped because the console buffer was full */
+    uint32 ContentionEvents; /**< Lines dropped after too many concurrent writers */
+    uint32 DroppedBytes;     /**< Total length of all dropped lines */
+    uint32 HighWaterMark;    /**< Largest number of console buffer bytes in use */
+    uint32 BufferSize;       /**< Total size of the console buffer */
+} OS_printf_stats_t;
+
 /** @defgroup OSAPIPrintf OSAL Printf APIs
  * @{
  */
@@ -50,6 +65,13 @@
  * The output of this routine also may be dynamically enabled or disabled by
  * the OS_printf_enable() and OS_printf_disable() calls, respectively.
  *
+ * The formatted line is placed in a console buffer without taking any lock,
+ * and the call never waits for the output device when the console is
+ * configured for asynchronous output (OSAL_CONFIG_CONSOLE_ASYNC).  A line
+ * that cannot be buffered within a fixed number of attempts, either because
+ * the buffer is full or because of other concurrent writers, is dropped and
+ * counted rather than delaying the caller.  See OS_printf_GetStats().
+ *
  * @param[in] string Format string, followed by additional arguments
  */
 void OS_printf(const char *string, ...) OS_PRINTF(1, 2);
@@ -66,6 +88,22 @@ void OS_printf_disable(void);
  *
  */
 void OS_printf_enable(void);
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Obtain the OS_printf() console statistics
+ *
+ * Reports the number of lines accepted and dropped and the buffer usage,
+ * which may be used to size OS_BUFFER_MSG_DEPTH for a given workload.
+ *
+ * @param[out] stats Buffer to hold the statistics @nonnull
+ *
+ * @return Execution status, see @ref OSReturnCodes
+ * @retval #OS_SUCCESS @copybrief OS_SUCCESS
+ * @retval #OS_INVALID_POINTER if stats is NULL
+ * @retval #OS_ERR_INVALID_ID if the console is not initialized
+ */
+int32 OS_printf_GetStats(OS_printf_stats_t *stats);
 /**@}*/
 
 #endif /* OSAPI_PRINTF_H */
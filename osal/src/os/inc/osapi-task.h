@@ -28,12 +28,49 @@
 #include "osconfig.h"
 #include "common_types.h"
 
+#include "osapi-clock.h" /* required for OS_time_t definition */
+
 /** @brief Upper limit for OSAL task priorities */
 #define OS_MAX_TASK_PRIORITY 255
 
 /** @brief Floating point enabled state for a task */
 #define OS_FP_ENABLED 1
 
+/**
+ * @brief Run the task under the round-robin real-time policy
+ *
+ * Overrides the policy OSAL selected at startup for this task only.  Ignored
+ * where the OS does not support per-task policies or real-time priorities are
+ * not available (e.g. insufficient privilege on POSIX).
+ */
+#define OS_TASK_SCHED_RR 0x02
+
+/**
+ * @brief Run the task under the first-in first-out real-time policy
+ *
+ * @copydetails OS_TASK_SCHED_RR
+ */
+#define OS_TASK_SCHED_FIFO 0x04
+
+/** @brief Bit position of the CPU affinity mask within the task flags */
+#define OS_TASK_CPU_AFFINITY_SHIFT 16
+
+/** @brief Bits of the task flags that hold the CPU affinity mask */
+#define OS_TASK_CPU_AFFINITY_MASK 0xFFFF0000
+
+/**
+ * @brief Encode a CPU affinity mask into task creation flags
+ *
+ * Bit N of the mask allows the task to run on CPU N, for CPUs 0-15.
+ * A mask of zero places no restriction on the task.  Combine the
+ * result with the other task flags, e.g.
+ * `OS_FP_ENABLED | OS_TASK_CPU_AFFINITY(0x2)` to pin a task to CPU 1.
+ */
+#define OS_TASK_CPU_AFFINITY(mask) ((((uint32)(mask)) << OS_TASK_CPU_AFFINITY_SHIFT) & OS_TASK_CPU_AFFINITY_MASK)
+
+/** @brief Extract the CPU affinity mask from task creation flags */
+#define OS_TASK_CPU_AFFINITY_GET(flags) ((((uint32)(flags)) & OS_TASK_CPU_AFFINITY_MASK) >> OS_TASK_CPU_AFFINITY_SHIFT)
+
 /**
  * @brief Type to be used for OSAL task priorities.
  *
@@ -60,6 +97,13 @@ typedef struct
     osal_id_t       creator;
     size_t          stack_size;
     osal_priority_t priority;
+    uint32          cpu_affinity;         /**< CPU mask requested at creation, 0 if unrestricted */
+    uint32          migrations;           /**< Times the task moved between CPUs, if known */
+    uint32          voluntary_switches;   /**< Context switches where the task blocked, if known */
+    uint32          involuntary_switches; /**< Context switches where the task was preempted, if known */
+    uint32          run_slices;           /**< Times the task was scheduled onto a CPU, if known */
+    OS_time_t       cpu_time;             /**< Total CPU time consumed by the task, if known */
+    OS_time_t       max_run_slice;        /**< Longest single run on a CPU before switching out, if known */
 } OS_task_prop_t;
 
 /*
@@ -68,6 +112,25 @@ typedef struct
 typedef void osal_task;                      /**< @brief For task entry point */
 typedef osal_task((*osal_task_entry)(void)); /**< @brief For task entry point */
 
+/**
+ * @brief Function run by a task pool worker for each job
+ *
+ * @param[in] arg The job_arg given to OS_TaskPoolSubmit()
+ */
+typedef void (*OS_TaskPoolJob_t)(void *arg);
+
+/** @brief Task pool statistics */
+typedef struct
+{
+    uint32 num_workers;    /**< Worker threads started, 0 until the first job is submitted */
+    uint32 jobs_queued;    /**< Jobs waiting for a worker */
+    uint32 jobs_running;   /**< Jobs currently being run by a worker */
+    uint32 jobs_submitted; /**< Jobs accepted since startup */
+    uint32 jobs_completed; /**< Jobs that have returned since startup */
+    uint32 jobs_stolen;    /**< Jobs taken by a worker from the queue of another worker */
+    uint32 jobs_rejected;  /**< Submissions refused because the pool was full */
+} OS_task_pool_prop_t;
+
 /** @defgroup OSAPITask OSAL Task APIs
  * @{
  */
@@ -89,6 +152,12 @@ typedef osal_task((*osal_task_entry)(void)); /**< @brief For task entry point */
  * In that case, a stack of the requested size will be dynamically allocated from
  * the system heap.
  *
+ * The flags may request a specific real-time scheduling policy with
+ * #OS_TASK_SCHED_RR or #OS_TASK_SCHED_FIFO, and may restrict the CPUs the
+ * task runs on with #OS_TASK_CPU_AFFINITY.  Affinity is honored where the
+ * underlying OS supports it and is otherwise ignored.  Where it is honored,
+ * a mask that names a CPU the system does not have is rejected.
+ *
  * @param[out]  task_id will be set to the non-zero ID of the newly-created resource @nonnull
  * @param[in]   task_name the name of the new resource to create @nonnull
  * @param[in]   function_pointer the entry point of the new task @nonnull
@@ -104,6 +173,8 @@ typedef osal_task((*osal_task_entry)(void)); /**< @brief For task entry point */
  * @retval #OS_ERR_INVALID_SIZE if the stack_size argument is zero
  * @retval #OS_ERR_NAME_TOO_LONG name length including null terminator greater than #OS_MAX_API_NAME
  * @retval #OS_ERR_INVALID_PRIORITY if the priority is bad @covtest
+ * @retval #OS_ERR_INVALID_ARGUMENT if both #OS_TASK_SCHED_RR and #OS_TASK_SCHED_FIFO are set,
+ *                                   or the affinity mask names a CPU that does not exist
  * @retval #OS_ERR_NO_FREE_IDS if there can be no more tasks created
  * @retval #OS_ERR_NAME_TAKEN if the name specified is already used by a task
  * @retval #OS_ERROR if an unspecified/other error occurs @covtest
@@ -216,6 +287,10 @@ int32 OS_TaskGetIdByName(osal_id_t *task_id, const char *task_name);
  * all of the relevant info (creator, stack size, priority, name) about the
  * specified task.
  *
+ * Where the OS provides them, the CPU time consumed by the task along with
+ * its CPU migration, context switch and run slice statistics are also
+ * reported.  Otherwise these are zero.
+ *
  * @param[in]   task_id The object ID to operate on
  * @param[out]  task_prop The property object buffer to fill @nonnull
  *
@@ -247,6 +322,59 @@ int32 OS_TaskGetInfo(osal_id_t task_id, OS_task_prop_t *task_prop);
  */
 int32 OS_TaskFindIdBySystemData(osal_id_t *task_id, const void *sysdata, size_t sysdata_size);
 
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Run a function on the shared task pool
+ *
+ * Queues job_func(job_arg) to be run by one of a fixed set of worker
+ * threads, and returns without waiting for it.  This avoids the cost of
+ * creating and deleting a task for each piece of short-lived work, and lets
+ * independent jobs run in parallel on different CPUs.
+ *
+ * Each worker has its own job queue.  Jobs from other tasks are spread
+ * across the queues in turn.  A job submitted from within another job goes
+ * on the queue of the worker running it, and is run next by that worker
+ * unless an idle worker takes it first.  A worker with an empty queue takes
+ * the oldest job from the queue of a busy worker, so the order in which
+ * jobs start is not guaranteed.
+ *
+ * The workers are started on the first call and run at #OS_TASK_POOL_PRIORITY.
+ * They are not OSAL tasks: a job must not call OS_TaskGetId() or any other
+ * function that acts on the calling task, and should not block for long,
+ * since that holds up other jobs.  Completion must be signaled by the job
+ * itself, e.g. with a semaphore or queue.
+ *
+ * @note Not every OS provides a task pool.  If #OS_ERR_NOT_IMPLEMENTED is
+ *       returned, the caller should run the job itself or create a task.
+ *
+ * @param[in] job_func  The function to run @nonnull
+ * @param[in] job_arg   Opaque argument passed to job_func
+ *
+ * @return Execution status, see @ref OSReturnCodes
+ * @retval #OS_SUCCESS if the job was queued
+ * @retval #OS_INVALID_POINTER if job_func is NULL
+ * @retval #OS_QUEUE_FULL if #OS_MAX_TASK_POOL_JOBS jobs are already queued or running
+ * @retval #OS_ERR_NOT_IMPLEMENTED if the OS does not provide a task pool
+ * @retval #OS_ERROR if the worker threads could not be started @covtest
+ */
+int32 OS_TaskPoolSubmit(OS_TaskPoolJob_t job_func, void *job_arg);
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Obtain the statistics of the shared task pool
+ *
+ * The counts are sampled without stopping the workers, so they may not be
+ * exactly consistent with each other while jobs are being submitted.
+ *
+ * @param[out]  pool_prop The property object buffer to fill @nonnull
+ *
+ * @return Execution status, see @ref OSReturnCodes
+ * @retval #OS_SUCCESS @copybrief OS_SUCCESS
+ * @retval #OS_INVALID_POINTER if the pool_prop pointer is NULL
+ * @retval #OS_ERR_NOT_IMPLEMENTED if the OS does not provide a task pool
+ */
+int32 OS_TaskPoolGetInfo(OS_task_pool_prop_t *pool_prop);
+
 /**@}*/
 
 #endif /* OSAPI_TASK_H */
@@ -77,6 +77,7 @@ extern "C"
 #include "osapi-module.h"
 #include "osapi-mutex.h"
 #include "osapi-network.h"
+#include "osapi-poller.h"
 #include "osapi-printf.h"
 #include "osapi-queue.h"
 #include "osapi-select.h"
@@ -53,41 +53,24 @@
  *-----------------------------------------------------------------*/
 void OS_ConsoleOutput_Impl(const OS_object_token_t *token)
 {
-    size_t                        StartPos;
-    size_t                        EndPos;
-    size_t                        WriteSize;
-    OS_console_internal_record_t *console;
-
-    console  = OS_OBJECT_TABLE_GET(OS_console_table, *token);
-    StartPos = console->ReadPos;
-    EndPos   = console->WritePos;
+    /* batch several lines per device write; only accessed under the BSP lock */
+    static char OutputBuffer[4 * OS_CONSOLE_MAX_RECORD];
+    size_t      WriteSize;
 
+    /*
+     * The BSP lock serializes the readers of the console buffer as well as
+     * access to the device.  Writers never take it.
+     */
     OS_BSP_Lock_Impl();
 
-    while (StartPos != EndPos)
+    do
     {
-        if (StartPos > EndPos)
-        {
-            /* handle wrap */
-            WriteSize = console->BufSize - StartPos;
-        }
-        else
-        {
-            WriteSize = EndPos - StartPos;
-        }
-
-        OS_BSP_ConsoleOutput_Impl(&console->BufBase[StartPos], WriteSize);
-
-        StartPos += WriteSize;
-        if (StartPos >= console->BufSize)
+        WriteSize = OS_ConsoleRead(token, OutputBuffer, sizeof(OutputBuffer));
+        if (WriteSize > 0)
         {
-            /* handle wrap */
-            StartPos = 0;
+            OS_BSP_ConsoleOutput_Impl(OutputBuffer, WriteSize);
         }
-    }
+    } while (WriteSize > 0);
 
     OS_BSP_Unlock_Impl();
-
-    /* Update the global with the new read location */
-    console->ReadPos = StartPos;
 }
@@ -0,0 +1,260 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * \file
+ *
+ * Purpose: This file contains the stream poller implementation based on
+ *          the Linux epoll() family of system calls
+ */
+
+/****************************************************************************************
+                                    INCLUDE FILES
+ ***************************************************************************************/
+
+/*
+ * Inclusions Defined by OSAL layer.
+ *
+ * This must include whatever is required to get the prototypes of these functions:
+ *
+ *   epoll_create1(), epoll_ctl(), epoll_wait()
+ *   close()
+ */
+#include <string.h>
+#include <errno.h>
+#include <unistd.h>
+#include <sys/epoll.h>
+
+#include "os-impl-io.h"
+#include "os-impl-poller.h"
+#include "os-shared-poller.h"
+#include "os-shared-idmap.h"
+
+/****************************************************************************************
+                                   GLOBAL DATA
+ ***************************************************************************************/
+
+/* Tables where the OS object information is stored */
+OS_impl_poller_internal_record_t OS_impl_poller_table[OS_MAX_POLLERS];
+
+/****************************************************************************************
+                                POLLER API
+ ***************************************************************************************/
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_PollerCreate_Impl(const OS_object_token_t *token, uint32 options)
+{
+    OS_impl_poller_internal_record_t *impl;
+
+    impl = OS_OBJECT_TABLE_GET(OS_impl_poller_table, *token);
+
+    impl->fd = epoll_create1(EPOLL_CLOEXEC);
+    if (impl->fd < 0)
+    {
+        OS_DEBUG("epoll_create1: %s\n", strerror(errno));
+        return OS_ERROR;
+    }
+
+    return OS_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_PollerDelete_Impl(const OS_object_token_t *token)
+{
+    OS_impl_poller_internal_record_t *impl;
+
+    impl = OS_OBJECT_TABLE_GET(OS_impl_poller_table, *token);
+
+    if (close(impl->fd) < 0)
+    {
+        OS_DEBUG("close: %s\n", strerror(errno));
+        return OS_ERROR;
+    }
+
+    impl->fd = -1;
+
+    return OS_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_PollerAdd_Impl(const OS_object_token_t *token, const OS_object_token_t *stream_token, uint32 StateFlags,
+                        bool IsMember)
+{
+    OS_impl_poller_internal_record_t *impl;
+    OS_impl_file_internal_record_t *  stream;
+    struct epoll_event                ev;
+    int                               op;
+
+    impl   = OS_OBJECT_TABLE_GET(OS_impl_poller_table, *token);
+    stream = OS_OBJECT_TABLE_GET(OS_impl_filehandle_table, *stream_token);
+
+    if (!stream->selectable || stream->fd < 0)
+    {
+        return OS_ERR_OPERATION_NOT_SUPPORTED;
+    }
+
+    memset(&ev, 0, sizeof(ev));
+    if (StateFlags & OS_STREAM_STATE_READABLE)
+    {
+        ev.events |= EPOLLIN;
+    }
+    if (StateFlags & OS_STREAM_STATE_WRITABLE)
+    {
+        ev.events |= EPOLLOUT;
+    }
+
+    /* The OSAL ID is carried in the event so no lookup is needed on wakeup */
+    ev.data.u32 = OS_ObjectIdToInteger(OS_ObjectIdFromToken(stream_token));
+
+    /* an existing registration is changed in place, so no events are lost in between */
+    if (IsMember)
+    {
+        op = EPOLL_CTL_MOD;
+    }
+    else
+    {
+        op = EPOLL_CTL_ADD;
+    }
+
+    if (epoll_ctl(impl->fd, op, stream->fd, &ev) < 0)
+    {
+        OS_DEBUG("epoll_ctl(%s): %s\n", IsMember ? "MOD" : "ADD", strerror(errno));
+        return OS_ERROR;
+    }
+
+    return OS_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_PollerRemove_Impl(const OS_object_token_t *token, const OS_object_token_t *stream_token)
+{
+    OS_impl_poller_internal_record_t *impl;
+    OS_impl_file_internal_record_t *  stream;
+    struct epoll_event                ev;
+
+    impl   = OS_OBJECT_TABLE_GET(OS_impl_poller_table, *token);
+    stream = OS_OBJECT_TABLE_GET(OS_impl_filehandle_table, *stream_token);
+
+    /* a non-NULL event is required by kernels before 2.6.9 */
+    memset(&ev, 0, sizeof(ev));
+
+    /*
+     * The kernel drops a descriptor from the interest list when it is
+     * closed, so a descriptor that is no longer registered is not an error.
+     */
+    if (epoll_ctl(impl->fd, EPOLL_CTL_DEL, stream->fd, &ev) < 0 && errno != ENOENT && errno != EBADF)
+    {
+        OS_DEBUG("epoll_ctl(DEL): %s\n", strerror(errno));
+        return OS_ERROR;
+    }
+
+    return OS_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_PollerWait_Impl(const OS_object_token_t *token, OS_poller_event_t *events, uint32 max_events,
+                         uint32 *num_events, int32 msecs)
+{
+    OS_impl_poller_internal_record_t *impl;
+    struct epoll_event                ev[OS_MAX_NUM_OPEN_FILES];
+    int                               count;
+    int                               i;
+    int                               timeout;
+
+    impl = OS_OBJECT_TABLE_GET(OS_impl_poller_table, *token);
+
+    /* there can never be more ready descriptors than OSAL streams */
+    if (max_events > OS_MAX_NUM_OPEN_FILES)
+    {
+        max_events = OS_MAX_NUM_OPEN_FILES;
+    }
+
+    if (msecs < 0)
+    {
+        timeout = -1;
+    }
+    else
+    {
+        timeout = msecs;
+    }
+
+    /*
+     * Note that a signal interrupting the wait restarts it with the
+     * full timeout, same as the select() based implementation.
+     */
+    do
+    {
+        count = epoll_wait(impl->fd, ev, max_events, timeout);
+    } while (count < 0 && errno == EINTR);
+
+    if (count < 0)
+    {
+        OS_DEBUG("epoll_wait: %s\n", strerror(errno));
+        return OS_ERROR;
+    }
+
+    if (count == 0)
+    {
+        return OS_ERROR_TIMEOUT;
+    }
+
+    for (i = 0; i < count; ++i)
+    {
+        events[i].objid      = OS_ObjectIdFromInteger(ev[i].data.u32);
+        events[i].StateFlags = 0;
+
+        /* hangup and error conditions are reported as readable so the next read returns them */
+        if (ev[i].events & (EPOLLIN | EPOLLHUP | EPOLLERR))
+        {
+            events[i].StateFlags |= OS_STREAM_STATE_READABLE;
+        }
+        if (ev[i].events & EPOLLOUT)
+        {
+            events[i].StateFlags |= OS_STREAM_STATE_WRITABLE;
+        }
+    }
+
+    *num_events = count;
+
+    return OS_SUCCESS;
+}
@@ -0,0 +1,39 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * \file
+ *
+ * This file contains an asynchronous file I/O implementation for systems
+ * that do not provide one.  It returns OS_ERR_NOT_IMPLEMENTED, so callers
+ * fall back to OS_pread()/OS_pwrite().
+ */
+
+#include "os-shared-file.h"
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_FileAsyncSubmit_Impl(OS_object_token_t *token, const OS_file_async_request_t *request,
+                              osal_id_t completion_queue)
+{
+    return OS_ERR_NOT_IMPLEMENTED;
+}
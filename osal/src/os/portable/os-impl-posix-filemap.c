@@ -0,0 +1,128 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * \file
+ *
+ * This file contains a read-only file mapping implementation for
+ * systems that provide the POSIX mmap() API.
+ */
+
+/****************************************************************************************
+                                    INCLUDE FILES
+ ***************************************************************************************/
+
+/*
+ * Inclusions Defined by OSAL layer.
+ *
+ * This must include whatever is required to get the prototypes of these functions:
+ *
+ *   fstat()
+ *   sysconf()
+ *   mmap()
+ *   munmap()
+ */
+#include <string.h>
+#include <errno.h>
+#include <sys/mman.h>
+
+#include "os-impl-files.h"
+#include "os-shared-file.h"
+#include "os-shared-idmap.h"
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Returns the mapping granularity of the system
+ *
+ *-----------------------------------------------------------------*/
+static size_t OS_Posix_FileMapPageSize(void)
+{
+    long pagesize;
+
+    pagesize = sysconf(_SC_PAGESIZE);
+    if (pagesize <= 0)
+    {
+        pagesize = 4096;
+    }
+
+    return (size_t)pagesize;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_FileMap_Impl(const OS_object_token_t *token, size_t offset, size_t length, void **addr)
+{
+    OS_impl_file_internal_record_t *impl;
+    struct stat                     st;
+    size_t                          delta;
+    void *                          base;
+
+    impl = OS_OBJECT_TABLE_GET(OS_impl_filehandle_table, *token);
+
+    if (fstat(impl->fd, &st) < 0)
+    {
+        OS_DEBUG("fstat: %s\n", strerror(errno));
+        return OS_ERROR;
+    }
+
+    /* Pages past EOF would fault on access, so refuse to map them */
+    if (offset > (size_t)st.st_size || length > ((size_t)st.st_size - offset))
+    {
+        return OS_ERR_INVALID_SIZE;
+    }
+
+    /* mmap() requires a page aligned offset; map from the start of the page */
+    delta = offset % OS_Posix_FileMapPageSize();
+
+    base = mmap(NULL, length + delta, PROT_READ, MAP_SHARED, impl->fd, (off_t)(offset - delta));
+    if (base == MAP_FAILED)
+    {
+        OS_DEBUG("mmap: %s\n", strerror(errno));
+        return OS_ERROR;
+    }
+
+    *addr = (uint8 *)base + delta;
+
+    return OS_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_FileUnmap_Impl(const OS_object_token_t *token, void *addr, size_t length)
+{
+    size_t delta;
+
+    delta = (size_t)((cpuaddr)addr % OS_Posix_FileMapPageSize());
+
+    if (munmap((uint8 *)addr - delta, length + delta) < 0)
+    {
+        OS_DEBUG("munmap: %s\n", strerror(errno));
+        return OS_ERROR;
+    }
+
+    return OS_SUCCESS;
+}
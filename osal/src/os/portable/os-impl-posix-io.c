@@ -263,3 +263,79 @@ int32 OS_GenericWrite_Impl(const OS_object_token_t *token, const void *buffer, s
 
     return return_code;
 }
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_GenericPread_Impl(const OS_object_token_t *token, void *buffer, size_t nbytes, size_t offset)
+{
+    int32                           return_code;
+    ssize_t                         os_result;
+    OS_impl_file_internal_record_t *impl;
+
+    impl = OS_OBJECT_TABLE_GET(OS_impl_filehandle_table, *token);
+
+    /*
+     * pread() does not use or update the file position, so concurrent
+     * callers sharing one handle do not need to serialize a seek+read pair.
+     */
+    os_result = pread(impl->fd, buffer, nbytes, (off_t)offset);
+    if (os_result < 0)
+    {
+        OS_DEBUG("pread: %s\n", strerror(errno));
+        if (errno == ESPIPE)
+        {
+            return_code = OS_ERR_OPERATION_NOT_SUPPORTED;
+        }
+        else
+        {
+            return_code = OS_ERROR;
+        }
+    }
+    else
+    {
+        /* type conversion from ssize_t to int32 for return */
+        return_code = (int32)os_result;
+    }
+
+    return return_code;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_GenericPwrite_Impl(const OS_object_token_t *token, const void *buffer, size_t nbytes, size_t offset)
+{
+    int32                           return_code;
+    ssize_t                         os_result;
+    OS_impl_file_internal_record_t *impl;
+
+    impl = OS_OBJECT_TABLE_GET(OS_impl_filehandle_table, *token);
+
+    os_result = pwrite(impl->fd, GENERIC_IO_CONST_DATA_CAST buffer, nbytes, (off_t)offset);
+    if (os_result < 0)
+    {
+        OS_DEBUG("pwrite: %s\n", strerror(errno));
+        if (errno == ESPIPE)
+        {
+            return_code = OS_ERR_OPERATION_NOT_SUPPORTED;
+        }
+        else
+        {
+            return_code = OS_ERROR;
+        }
+    }
+    else
+    {
+        /* type conversion from ssize_t to int32 for return */
+        return_code = (int32)os_result;
+    }
+
+    return return_code;
+}
@@ -0,0 +1,158 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * \file
+ *
+ * Purpose: This file contains a stream poller implementation for systems
+ *          without a dedicated event notification facility.  Each wait is
+ *          carried out as a single OS_SelectMultiple() call on the member set.
+ */
+
+/****************************************************************************************
+                                    INCLUDE FILES
+ ***************************************************************************************/
+
+#include <string.h>
+
+#include "os-impl-io.h"
+#include "os-shared-poller.h"
+#include "os-shared-select.h"
+#include "os-shared-idmap.h"
+
+/****************************************************************************************
+                                POLLER API
+ ***************************************************************************************/
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_PollerCreate_Impl(const OS_object_token_t *token, uint32 options)
+{
+    /* the member sets kept by the shared layer are all that is needed */
+    return OS_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_PollerDelete_Impl(const OS_object_token_t *token)
+{
+    return OS_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_PollerAdd_Impl(const OS_object_token_t *token, const OS_object_token_t *stream_token, uint32 StateFlags,
+                        bool IsMember)
+{
+    OS_impl_file_internal_record_t *stream;
+
+    stream = OS_OBJECT_TABLE_GET(OS_impl_filehandle_table, *stream_token);
+
+    if (!stream->selectable)
+    {
+        return OS_ERR_OPERATION_NOT_SUPPORTED;
+    }
+
+    return OS_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_PollerRemove_Impl(const OS_object_token_t *token, const OS_object_token_t *stream_token)
+{
+    return OS_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_PollerWait_Impl(const OS_object_token_t *token, OS_poller_event_t *events, uint32 max_events,
+                         uint32 *num_events, int32 msecs)
+{
+    OS_poller_internal_record_t *poller;
+    OS_object_token_t            lock_token;
+    OS_FdSet                     ReadSet;
+    OS_FdSet                     WriteSet;
+    osal_index_t                 idx;
+    uint32                       count;
+    uint32                       flags;
+    int32                        return_code;
+
+    poller = OS_OBJECT_TABLE_GET(OS_poller_table, *token);
+
+    /*
+     * Take a snapshot of the member sets, as other tasks may add or remove
+     * members while this one is blocked in select().
+     */
+    lock_token           = *token;
+    lock_token.lock_mode = OS_LOCK_MODE_GLOBAL;
+    OS_Lock_Global(&lock_token);
+    memcpy(&ReadSet, &poller->ReadSet, sizeof(ReadSet));
+    memcpy(&WriteSet, &poller->WriteSet, sizeof(WriteSet));
+    OS_Unlock_Global(&lock_token);
+
+    return_code = OS_SelectMultiple_Impl(&ReadSet, &WriteSet, msecs);
+    if (return_code != OS_SUCCESS)
+    {
+        return return_code;
+    }
+
+    count = 0;
+    for (idx = 0; idx < OS_MAX_NUM_OPEN_FILES && count < max_events; ++idx)
+    {
+        flags = 0;
+        if ((ReadSet.object_ids[idx >> 3] >> (idx & 0x7)) & 0x1)
+        {
+            flags |= OS_STREAM_STATE_READABLE;
+        }
+        if ((WriteSet.object_ids[idx >> 3] >> (idx & 0x7)) & 0x1)
+        {
+            flags |= OS_STREAM_STATE_WRITABLE;
+        }
+
+        if (flags != 0)
+        {
+            events[count].objid      = OS_global_stream_table[idx].active_id;
+            events[count].StateFlags = flags;
+            ++count;
+        }
+    }
+
+    *num_events = count;
+
+    return OS_SUCCESS;
+}
@@ -27,9 +27,28 @@
 #define OS_IMPL_BINSEM_H
 
 #include "osconfig.h"
+#include "common_types.h"
 #include <pthread.h>
 #include <signal.h>
 
+#ifdef OS_POSIX_FUTEX_SEMAPHORES
+
+/*
+ * Futex flavor of a binary semaphore.  Bit 0 of "state" is the semaphore
+ * value, the remaining bits count flush operations, so a single futex word
+ * changes on both give and flush.
+ */
+#define OS_POSIX_BINSEM_VALUE_BIT 0x1U
+#define OS_POSIX_BINSEM_FLUSH_INC 0x2U
+
+typedef struct
+{
+    uint32 state;
+    uint32 waiters;
+} OS_impl_binsem_internal_record_t;
+
+#else
+
 /* Binary Semaphores */
 typedef struct
 {
@@ -39,6 +58,8 @@ typedef struct
     volatile sig_atomic_t current_value;
 } OS_impl_binsem_internal_record_t;
 
+#endif
+
 /* Tables where the OS object information is stored */
 extern OS_impl_binsem_internal_record_t OS_impl_bin_sem_table[OS_MAX_BIN_SEMAPHORES];
 
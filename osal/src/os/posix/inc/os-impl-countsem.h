@@ -27,13 +27,27 @@
 #define OS_IMPL_COUNTSEM_H
 
 #include "osconfig.h"
+#include "common_types.h"
 #include <semaphore.h>
 
+#ifdef OS_POSIX_FUTEX_SEMAPHORES
+
+/* Futex flavor of a counting semaphore: "count" is the futex word */
+typedef struct
+{
+    uint32 count;
+    uint32 waiters;
+} OS_impl_countsem_internal_record_t;
+
+#else
+
 typedef struct
 {
     sem_t id;
 } OS_impl_countsem_internal_record_t;
 
+#endif
+
 /* Tables where the OS object information is stored */
 extern OS_impl_countsem_internal_record_t OS_impl_count_sem_table[OS_MAX_COUNT_SEMAPHORES];
 
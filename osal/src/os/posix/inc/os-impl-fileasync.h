@@ -0,0 +1,98 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * \file
+ *
+ * \ingroup  posix
+ *
+ * Asynchronous file I/O state shared between the worker thread pool and
+ * the io_uring backend
+ */
+
+#ifndef OS_IMPL_FILEASYNC_H
+#define OS_IMPL_FILEASYNC_H
+
+#include "os-posix.h"
+#include "os-shared-file.h"
+#include "os-shared-idmap.h"
+
+#include <sys/uio.h>
+
+/*
+ * Number of worker threads started when the thread pool backend is in use.
+ * More than one lets requests on different files (or a read behind an
+ * fsync) proceed in parallel.
+ */
+#define OS_POSIX_FILEASYNC_NUM_WORKERS 4
+
+/*
+ * Worker and completion threads run at the same priority as the console task
+ */
+#define OS_POSIX_FILEASYNC_TASK_PRIORITY OS_UTILITYTASK_PRIORITY
+
+/*
+ * Marks the end of the free list and the pending list
+ */
+#define OS_POSIX_FILEASYNC_SLOT_NONE 0xFFFFFFFF
+
+/*
+ * One pending request.  The slot owns the reference on the file handle
+ * from submission until OS_Posix_FileAsyncFinish().
+ */
+typedef struct
+{
+    OS_object_token_t       token;
+    OS_file_async_request_t request;
+    osal_id_t               completion_queue;
+    int                     fd;
+    struct iovec            iov; /**< Buffer descriptor for io_uring READV/WRITEV */
+    uint32                  next;
+} OS_impl_fileasync_slot_t;
+
+typedef struct
+{
+    pthread_mutex_t          lock;
+    pthread_cond_t           work_cond;
+    int32                    init_status;
+    bool                     use_uring;
+    uint32                   free_head;
+    uint32                   pending_head;
+    uint32                   pending_tail;
+    OS_impl_fileasync_slot_t slots[OS_MAX_FILE_ASYNC_OPS];
+} OS_impl_fileasync_state_t;
+
+extern OS_impl_fileasync_state_t OS_impl_fileasync;
+
+/*
+ * Return a slot to the free list and post the completion of its request.
+ * Must be called without the lock held.
+ */
+void OS_Posix_FileAsyncFinish(uint32 slot_idx, int32 result);
+
+/*
+ * io_uring backend, only built on Linux with OSAL_CONFIG_POSIX_IO_URING
+ *
+ * Init sets up the ring and starts the completion thread, and returns an
+ * error if the kernel does not support io_uring.  Submit is called with the
+ * lock held, and hands one filled-in slot to the kernel.
+ */
+int32 OS_Posix_FileAsyncUringInit(void);
+int32 OS_Posix_FileAsyncUringSubmit(OS_impl_fileasync_slot_t *slot, uint32 slot_idx);
+
+#endif /* OS_IMPL_FILEASYNC_H */
@@ -0,0 +1,71 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * \file
+ *
+ * \ingroup  posix
+ *
+ * Futex primitives used by the Linux semaphore implementation
+ */
+
+#ifndef OS_IMPL_FUTEX_H
+#define OS_IMPL_FUTEX_H
+
+#include "osconfig.h"
+#include "common_types.h"
+#include "os-shared-atomic.h"
+#include <time.h>
+
+/*
+ * Atomic accessors for futex words.  All of these are sequentially
+ * consistent, which the waiter accounting in the semaphore code relies on:
+ * a waiter publishes itself before re-checking the word, and a giver
+ * changes the word before checking for waiters, so at least one side
+ * always observes the other.
+ */
+#define OS_POSIX_ATOMIC_LOAD(ptr)           OS_ATOMIC_LOAD(ptr)
+#define OS_POSIX_ATOMIC_CAS(ptr, exp, want) OS_ATOMIC_CAS(ptr, exp, want)
+#define OS_POSIX_ATOMIC_ADD(ptr, val)       OS_ATOMIC_ADD(ptr, val)
+#define OS_POSIX_ATOMIC_SUB(ptr, val)       OS_ATOMIC_SUB(ptr, val)
+#define OS_POSIX_ATOMIC_OR(ptr, val)        OS_ATOMIC_OR(ptr, val)
+
+/*
+ * Compute an absolute CLOCK_MONOTONIC deadline "msecs" from now,
+ * for use with OS_Posix_FutexWait().
+ */
+void OS_Posix_FutexCompAbsDelayTime(uint32 msecs, struct timespec *tm);
+
+/*
+ * Block while *word still equals "expected", until woken or until the
+ * absolute CLOCK_MONOTONIC deadline passes (NULL waits forever).
+ *
+ * The wait is a cancellation point, so tasks pending on a semaphore can
+ * still be deleted.  Returns OS_SUCCESS if the caller should re-check the
+ * word (woken, word changed, or interrupted), OS_SEM_TIMEOUT once the
+ * deadline has passed, or OS_SEM_FAILURE on any other error.
+ */
+int32 OS_Posix_FutexWait(uint32 *word, uint32 expected, const struct timespec *abs_timeout);
+
+/*
+ * Wake up to "count" tasks blocked in OS_Posix_FutexWait() on word.
+ * This is async-signal-safe.
+ */
+void OS_Posix_FutexWake(uint32 *word, int count);
+
+#endif /* OS_IMPL_FUTEX_H */
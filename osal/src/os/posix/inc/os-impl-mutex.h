@@ -33,6 +33,17 @@
 typedef struct
 {
     pthread_mutex_t id;
+    bool            collect_stats; /**< Set if created with OS_MUTEX_OPTION_STATISTICS */
+
+    /*
+     * Usage statistics, only modified by the task holding the mutex
+     */
+    uint32 nest_depth;       /**< Current number of nested takes by the holder */
+    uint32 take_count;       /**< Number of successful takes */
+    uint32 contention_count; /**< Number of takes that found the mutex held */
+    uint64 hold_start_ns;    /**< Monotonic time of the outermost take */
+    uint64 total_hold_ns;    /**< Total time held */
+    uint64 max_hold_ns;      /**< Longest single time held */
 } OS_impl_mutex_internal_record_t;
 
 /* Tables where the OS object information is stored */
@@ -35,12 +35,13 @@
 typedef struct
 {
     pthread_t id;
+    pid_t     tid; /**< Kernel thread ID, where available, used to locate per-thread statistics */
 } OS_impl_task_internal_record_t;
 
 /* Tables where the OS object information is stored */
 extern OS_impl_task_internal_record_t OS_impl_task_table[OS_MAX_TASKS];
 
-int32 OS_Posix_InternalTaskCreate_Impl(pthread_t *pthr, osal_priority_t priority, size_t stacksz,
+int32 OS_Posix_InternalTaskCreate_Impl(pthread_t *pthr, osal_priority_t priority, size_t stacksz, uint32 flags,
                                        PthreadFuncPtr_t entry, void *entry_arg);
 
 #endif /* OS_IMPL_TASKS_H */
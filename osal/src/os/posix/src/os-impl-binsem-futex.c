@@ -0,0 +1,284 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * \file
+ * \ingroup  posix
+ *
+ * Purpose: Binary semaphores built directly on a Linux futex word.
+ *
+ * An uncontended give or take is a single atomic operation in user space;
+ * the kernel is only entered to block a taker or to wake one that is
+ * actually waiting.  Unlike the pthread mutex/condvar based version, give
+ * never blocks and is usable from a signal handler.
+ */
+
+/****************************************************************************************
+                                    INCLUDE FILES
+ ***************************************************************************************/
+
+#include "os-posix.h"
+#include "os-shared-idmap.h"
+#include "os-shared-binsem.h"
+#include "os-impl-binsem.h"
+#include "os-impl-futex.h"
+
+/* Tables where the OS object information is stored */
+OS_impl_binsem_internal_record_t OS_impl_bin_sem_table[OS_MAX_BIN_SEMAPHORES];
+
+/*---------------------------------------------------------------------------------------
+ * Helper function for dropping the waiter count in case the thread
+ * blocked in the futex wait is canceled.
+ ----------------------------------------------------------------------------------------*/
+static void OS_Posix_BinSemReleaseWaiter(void *arg)
+{
+    OS_impl_binsem_internal_record_t *sem = arg;
+
+    OS_POSIX_ATOMIC_SUB(&sem->waiters, 1);
+}
+
+/****************************************************************************************
+                               BINARY SEMAPHORE API
+ ***************************************************************************************/
+
+/*---------------------------------------------------------------------------------------
+   Name: OS_Posix_BinSemAPI_Impl_Init
+
+   Purpose: Initialize the Binary Semaphore data structures
+
+ ----------------------------------------------------------------------------------------*/
+int32 OS_Posix_BinSemAPI_Impl_Init(void)
+{
+    memset(OS_impl_bin_sem_table, 0, sizeof(OS_impl_bin_sem_table));
+    return OS_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_BinSemCreate_Impl(const OS_object_token_t *token, uint32 initial_value, uint32 options)
+{
+    OS_impl_binsem_internal_record_t *sem;
+
+    sem = OS_OBJECT_TABLE_GET(OS_impl_bin_sem_table, *token);
+    memset(sem, 0, sizeof(*sem));
+
+    /*
+     * As with the pthread version, an initial value greater
+     * than 1 silently becomes 1
+     */
+    if (initial_value > 0)
+    {
+        sem->state = OS_POSIX_BINSEM_VALUE_BIT;
+    }
+
+    return OS_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_BinSemDelete_Impl(const OS_object_token_t *token)
+{
+    /* A futex word has no kernel resources to release */
+    return OS_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_BinSemGive_Impl(const OS_object_token_t *token)
+{
+    OS_impl_binsem_internal_record_t *sem;
+
+    sem = OS_OBJECT_TABLE_GET(OS_impl_bin_sem_table, *token);
+
+    /* Binary semaphores are always set as "1" when given */
+    OS_POSIX_ATOMIC_OR(&sem->state, OS_POSIX_BINSEM_VALUE_BIT);
+
+    /* Only enter the kernel if someone is actually pending */
+    if (OS_POSIX_ATOMIC_LOAD(&sem->waiters) != 0)
+    {
+        OS_Posix_FutexWake(&sem->state, 1);
+    }
+
+    return OS_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_BinSemFlush_Impl(const OS_object_token_t *token)
+{
+    OS_impl_binsem_internal_record_t *sem;
+
+    sem = OS_OBJECT_TABLE_GET(OS_impl_bin_sem_table, *token);
+
+    /* Bump the flush counter.  Any other threads that are
+     * currently pending in SemTake() will see the counter change and
+     * return _without_ modifying the semaphore value.
+     */
+    OS_POSIX_ATOMIC_ADD(&sem->state, OS_POSIX_BINSEM_FLUSH_INC);
+
+    /* unblock all threads that are be waiting on this sem */
+    if (OS_POSIX_ATOMIC_LOAD(&sem->waiters) != 0)
+    {
+        OS_Posix_FutexWake(&sem->state, INT_MAX);
+    }
+
+    return OS_SUCCESS;
+}
+
+/*---------------------------------------------------------------------------------------
+   Name: OS_GenericBinSemTake_Impl
+
+   Purpose: Helper function that takes a futex binary semaphore with an absolute
+            CLOCK_MONOTONIC timeout.  If the value is zero this will block until
+            either the value becomes nonzero (via SemGive) or the semaphore gets flushed.
+
+---------------------------------------------------------------------------------------*/
+static int32 OS_GenericBinSemTake_Impl(const OS_object_token_t *token, const struct timespec *timeout)
+{
+    uint32                            state;
+    uint32                            flush_count;
+    int32                             return_code;
+    OS_impl_binsem_internal_record_t *sem;
+
+    sem = OS_OBJECT_TABLE_GET(OS_impl_bin_sem_table, *token);
+
+    /* Fast path: the value is set, so just clear it */
+    state = OS_POSIX_ATOMIC_LOAD(&sem->state);
+    while ((state & OS_POSIX_BINSEM_VALUE_BIT) != 0)
+    {
+        if (OS_POSIX_ATOMIC_CAS(&sem->state, &state, state & ~OS_POSIX_BINSEM_VALUE_BIT))
+        {
+            return OS_SUCCESS;
+        }
+    }
+
+    /*
+     * Slow path.  As with the pthread version, stop pending under two circumstances:
+     *
+     *  a) the value was set by a give - clear it and return.
+     *  b) the semaphore got "flushed" - return without modifying the value.
+     *
+     * The flush count at entry is remembered so a flush is detected
+     * even if a give happens right after it.
+     */
+    flush_count = state & ~OS_POSIX_BINSEM_VALUE_BIT;
+    return_code = OS_SUCCESS;
+
+    OS_POSIX_ATOMIC_ADD(&sem->waiters, 1);
+    pthread_cleanup_push(OS_Posix_BinSemReleaseWaiter, sem);
+
+    while (true)
+    {
+        state = OS_POSIX_ATOMIC_LOAD(&sem->state);
+
+        if ((state & ~OS_POSIX_BINSEM_VALUE_BIT) != flush_count)
+        {
+            /* flushed */
+            break;
+        }
+
+        if ((state & OS_POSIX_BINSEM_VALUE_BIT) != 0)
+        {
+            if (OS_POSIX_ATOMIC_CAS(&sem->state, &state, state & ~OS_POSIX_BINSEM_VALUE_BIT))
+            {
+                break;
+            }
+
+            /* lost a race with another taker or a flush, re-evaluate */
+            continue;
+        }
+
+        /* Must pend until something changes */
+        return_code = OS_Posix_FutexWait(&sem->state, state, timeout);
+        if (return_code != OS_SUCCESS)
+        {
+            break;
+        }
+    }
+
+    /*
+     * Pop the cleanup handler.
+     * Passing "true" means it will be executed, which
+     * handles dropping the waiter count.
+     */
+    pthread_cleanup_pop(true);
+
+    return return_code;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_BinSemTake_Impl(const OS_object_token_t *token)
+{
+    return (OS_GenericBinSemTake_Impl(token, NULL));
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_BinSemTimedWait_Impl(const OS_object_token_t *token, uint32 msecs)
+{
+    struct timespec ts;
+
+    /*
+     ** Compute an absolute time for the delay
+     */
+    OS_Posix_FutexCompAbsDelayTime(msecs, &ts);
+
+    return (OS_GenericBinSemTake_Impl(token, &ts));
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_BinSemGetInfo_Impl(const OS_object_token_t *token, OS_bin_sem_prop_t *sem_prop)
+{
+    OS_impl_binsem_internal_record_t *sem;
+
+    sem = OS_OBJECT_TABLE_GET(OS_impl_bin_sem_table, *token);
+
+    /* put the info into the structure */
+    sem_prop->value = OS_POSIX_ATOMIC_LOAD(&sem->state) & OS_POSIX_BINSEM_VALUE_BIT;
+    return OS_SUCCESS;
+}
@@ -0,0 +1,247 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * \file
+ * \ingroup  posix
+ *
+ * Purpose: Counting semaphores built directly on a Linux futex word.
+ *
+ * Give and an uncontended take are a single atomic operation in user
+ * space; the kernel is only entered to block a taker or to wake one that
+ * is actually waiting.  Give remains usable from a signal handler.
+ */
+
+/****************************************************************************************
+                                    INCLUDE FILES
+ ***************************************************************************************/
+
+#include "os-posix.h"
+#include "os-impl-countsem.h"
+#include "os-impl-futex.h"
+#include "os-shared-countsem.h"
+#include "os-shared-idmap.h"
+
+/*
+ * Added SEM_VALUE_MAX Define
+ */
+#ifndef SEM_VALUE_MAX
+#define SEM_VALUE_MAX (UINT32_MAX / 2)
+#endif
+
+/* Tables where the OS object information is stored */
+OS_impl_countsem_internal_record_t OS_impl_count_sem_table[OS_MAX_COUNT_SEMAPHORES];
+
+/*---------------------------------------------------------------------------------------
+ * Helper function for dropping the waiter count in case the thread
+ * blocked in the futex wait is canceled.
+ ----------------------------------------------------------------------------------------*/
+static void OS_Posix_CountSemReleaseWaiter(void *arg)
+{
+    OS_impl_countsem_internal_record_t *impl = arg;
+
+    OS_POSIX_ATOMIC_SUB(&impl->waiters, 1);
+}
+
+/*---------------------------------------------------------------------------------------
+ * Helper function to decrement the count if it is nonzero.
+ * Returns true if the semaphore was taken.
+ ----------------------------------------------------------------------------------------*/
+static bool OS_Posix_CountSemTryTake(OS_impl_countsem_internal_record_t *impl, uint32 *count)
+{
+    *count = OS_POSIX_ATOMIC_LOAD(&impl->count);
+    while (*count != 0)
+    {
+        if (OS_POSIX_ATOMIC_CAS(&impl->count, count, *count - 1))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/*---------------------------------------------------------------------------------------
+   Name: OS_GenericCountSemTake_Impl
+
+   Purpose: Helper function that takes a futex counting semaphore with an absolute
+            CLOCK_MONOTONIC timeout (NULL to wait forever)
+
+---------------------------------------------------------------------------------------*/
+static int32 OS_GenericCountSemTake_Impl(const OS_object_token_t *token, const struct timespec *timeout)
+{
+    uint32                              count;
+    int32                               return_code;
+    OS_impl_countsem_internal_record_t *impl;
+
+    impl = OS_OBJECT_TABLE_GET(OS_impl_count_sem_table, *token);
+
+    /* Fast path: no kernel entry if the count is nonzero */
+    if (OS_Posix_CountSemTryTake(impl, &count))
+    {
+        return OS_SUCCESS;
+    }
+
+    return_code = OS_SUCCESS;
+
+    OS_POSIX_ATOMIC_ADD(&impl->waiters, 1);
+    pthread_cleanup_push(OS_Posix_CountSemReleaseWaiter, impl);
+
+    while (!OS_Posix_CountSemTryTake(impl, &count))
+    {
+        /* Count is zero here, pend until a give changes it */
+        return_code = OS_Posix_FutexWait(&impl->count, count, timeout);
+        if (return_code != OS_SUCCESS)
+        {
+            break;
+        }
+    }
+
+    pthread_cleanup_pop(true);
+
+    return return_code;
+}
+
+/****************************************************************************************
+                               COUNTING SEMAPHORE API
+ ***************************************************************************************/
+
+/*---------------------------------------------------------------------------------------
+   Name: OS_Posix_CountSemAPI_Impl_Init
+
+   Purpose: Initialize the Counting Semaphore data structures
+
+---------------------------------------------------------------------------------------*/
+int32 OS_Posix_CountSemAPI_Impl_Init(void)
+{
+    memset(OS_impl_count_sem_table, 0, sizeof(OS_impl_count_sem_table));
+    return OS_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_CountSemCreate_Impl(const OS_object_token_t *token, uint32 sem_initial_value, uint32 options)
+{
+    OS_impl_countsem_internal_record_t *impl;
+
+    impl = OS_OBJECT_TABLE_GET(OS_impl_count_sem_table, *token);
+
+    if (sem_initial_value > SEM_VALUE_MAX)
+    {
+        return OS_INVALID_SEM_VALUE;
+    }
+
+    memset(impl, 0, sizeof(*impl));
+    impl->count = sem_initial_value;
+
+    return OS_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_CountSemDelete_Impl(const OS_object_token_t *token)
+{
+    /* A futex word has no kernel resources to release */
+    return OS_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_CountSemGive_Impl(const OS_object_token_t *token)
+{
+    uint32                              count;
+    OS_impl_countsem_internal_record_t *impl;
+
+    impl = OS_OBJECT_TABLE_GET(OS_impl_count_sem_table, *token);
+
+    /* Same overflow limit as sem_post() */
+    count = OS_POSIX_ATOMIC_LOAD(&impl->count);
+    do
+    {
+        if (count >= SEM_VALUE_MAX)
+        {
+            return OS_SEM_FAILURE;
+        }
+    } while (!OS_POSIX_ATOMIC_CAS(&impl->count, &count, count + 1));
+
+    /* Only enter the kernel if someone is actually pending */
+    if (OS_POSIX_ATOMIC_LOAD(&impl->waiters) != 0)
+    {
+        OS_Posix_FutexWake(&impl->count, 1);
+    }
+
+    return OS_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_CountSemTake_Impl(const OS_object_token_t *token)
+{
+    return OS_GenericCountSemTake_Impl(token, NULL);
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_CountSemTimedWait_Impl(const OS_object_token_t *token, uint32 msecs)
+{
+    struct timespec ts;
+
+    /*
+     ** Compute an absolute time for the delay
+     */
+    OS_Posix_FutexCompAbsDelayTime(msecs, &ts);
+
+    return OS_GenericCountSemTake_Impl(token, &ts);
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_CountSemGetInfo_Impl(const OS_object_token_t *token, OS_count_sem_prop_t *count_prop)
+{
+    OS_impl_countsem_internal_record_t *impl;
+
+    impl = OS_OBJECT_TABLE_GET(OS_impl_count_sem_table, *token);
+
+    /* put the info into the structure */
+    count_prop->value = OS_POSIX_ATOMIC_LOAD(&impl->count);
+    return OS_SUCCESS;
+}
@@ -0,0 +1,375 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * \file
+ * \ingroup  posix
+ *
+ * Purpose: io_uring backend for asynchronous file I/O on Linux.
+ *
+ *    The rings are driven directly through the system calls, so there is
+ *    no dependency on liburing.  Submitting tasks fill in one SQE each under
+ *    the OS_impl_fileasync lock and enter the kernel immediately; a single
+ *    completion thread blocks for CQEs and posts them.  The ring is sized
+ *    for OS_MAX_FILE_ASYNC_OPS, which also bounds the number of requests in
+ *    flight, so neither ring can overflow.
+ *
+ *    If the completion thread can no longer wait for CQEs, it fails all
+ *    requests in flight and the backend rejects any further submits.
+ */
+
+/****************************************************************************************
+                                    INCLUDE FILES
+ ***************************************************************************************/
+
+#include "os-impl-fileasync.h"
+#include "os-impl-tasks.h"
+
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+
+/****************************************************************************************
+                                     TYPEDEFS
+ ***************************************************************************************/
+
+typedef struct
+{
+    int                  ring_fd;
+    void *               sq_ring;
+    size_t               sq_ring_size;
+    void *               cq_ring;
+    size_t               cq_ring_size;
+    struct io_uring_sqe *sqes;
+    size_t               sqes_size;
+
+    uint32 *sq_head;
+    uint32 *sq_tail;
+    uint32 *sq_mask;
+    uint32 *sq_array;
+
+    uint32 *             cq_head;
+    uint32 *             cq_tail;
+    uint32 *             cq_mask;
+    struct io_uring_cqe *cqes;
+} OS_impl_fileasync_uring_t;
+
+/****************************************************************************************
+                                   GLOBAL DATA
+ ***************************************************************************************/
+
+static OS_impl_fileasync_uring_t OS_impl_fileasync_uring;
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Wrapper for the io_uring_enter system call, retried on EINTR
+ *
+ *-----------------------------------------------------------------*/
+static int OS_Posix_FileAsyncUringEnter(unsigned int to_submit, unsigned int min_complete, unsigned int flags)
+{
+    long status;
+
+    do
+    {
+        status = syscall(__NR_io_uring_enter, OS_impl_fileasync_uring.ring_fd, to_submit, min_complete, flags, NULL,
+                         0);
+    } while (status < 0 && errno == EINTR);
+
+    return (int)status;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Unmaps the rings and closes the ring fd after a failed setup,
+ *           or when the backend shuts down
+ *
+ *-----------------------------------------------------------------*/
+static void OS_Posix_FileAsyncUringRelease(void)
+{
+    OS_impl_fileasync_uring_t *ring = &OS_impl_fileasync_uring;
+
+    if (ring->sqes != NULL)
+    {
+        munmap(ring->sqes, ring->sqes_size);
+    }
+    if (ring->cq_ring != NULL && ring->cq_ring != ring->sq_ring)
+    {
+        munmap(ring->cq_ring, ring->cq_ring_size);
+    }
+    if (ring->sq_ring != NULL)
+    {
+        munmap(ring->sq_ring, ring->sq_ring_size);
+    }
+
+    close(ring->ring_fd);
+    memset(ring, 0, sizeof(*ring));
+    ring->ring_fd = -1;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Shuts the backend down after the completion thread can no
+ *           longer wait for CQEs, failing every request still in flight
+ *
+ *-----------------------------------------------------------------*/
+static void OS_Posix_FileAsyncUringShutdown(void)
+{
+    bool   in_flight[OS_MAX_FILE_ASYNC_OPS];
+    uint32 slot_idx;
+
+    memset(in_flight, true, sizeof(in_flight));
+
+    pthread_mutex_lock(&OS_impl_fileasync.lock);
+
+    /* submitters re-check this under the lock, so nothing new reaches the ring */
+    OS_impl_fileasync.init_status = OS_ERROR;
+
+    for (slot_idx = OS_impl_fileasync.free_head; slot_idx != OS_POSIX_FILEASYNC_SLOT_NONE;
+         slot_idx = OS_impl_fileasync.slots[slot_idx].next)
+    {
+        in_flight[slot_idx] = false;
+    }
+
+    /* closing the ring also cancels whatever the kernel still holds */
+    OS_Posix_FileAsyncUringRelease();
+
+    pthread_mutex_unlock(&OS_impl_fileasync.lock);
+
+    /* nothing will reap these any more, so release their file handles here */
+    for (slot_idx = 0; slot_idx < OS_MAX_FILE_ASYNC_OPS; ++slot_idx)
+    {
+        if (in_flight[slot_idx])
+        {
+            OS_Posix_FileAsyncFinish(slot_idx, OS_ERROR);
+        }
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Entry point of the completion thread
+ *
+ *-----------------------------------------------------------------*/
+static void *OS_Posix_FileAsyncUringReaper(void *arg)
+{
+    OS_impl_fileasync_uring_t *ring = &OS_impl_fileasync_uring;
+    struct io_uring_cqe *      cqe;
+    uint32                     head;
+    uint32                     slot_idx;
+    int32                      result;
+
+    while (true)
+    {
+        /* this thread is the only consumer, so the head can be read plainly */
+        head = *ring->cq_head;
+        if (head == __atomic_load_n(ring->cq_tail, __ATOMIC_ACQUIRE))
+        {
+            if (OS_Posix_FileAsyncUringEnter(0, 1, IORING_ENTER_GETEVENTS) < 0)
+            {
+                OS_DEBUG("io_uring_enter() failed: %s\n", strerror(errno));
+                OS_Posix_FileAsyncUringShutdown();
+                break;
+            }
+            continue;
+        }
+
+        cqe      = &ring->cqes[head & *ring->cq_mask];
+        slot_idx = (uint32)cqe->user_data;
+        if (cqe->res < 0)
+        {
+            OS_DEBUG("Async file op failed: %s\n", strerror(-cqe->res));
+            result = OS_ERROR;
+        }
+        else
+        {
+            result = cqe->res;
+        }
+
+        /* hand the CQE back to the kernel before the (possibly slow) queue put */
+        __atomic_store_n(ring->cq_head, head + 1, __ATOMIC_RELEASE);
+
+        if (slot_idx < OS_MAX_FILE_ASYNC_OPS)
+        {
+            OS_Posix_FileAsyncFinish(slot_idx, result);
+        }
+    }
+
+    return NULL;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_Posix_FileAsyncUringInit(void)
+{
+    OS_impl_fileasync_uring_t *ring = &OS_impl_fileasync_uring;
+    struct io_uring_params     params;
+    pthread_t                  reaper;
+    uint8 *                    sq_ptr;
+    uint8 *                    cq_ptr;
+
+    memset(ring, 0, sizeof(*ring));
+    memset(&params, 0, sizeof(params));
+
+    ring->ring_fd = (int)syscall(__NR_io_uring_setup, OS_MAX_FILE_ASYNC_OPS, &params);
+    if (ring->ring_fd < 0)
+    {
+        OS_DEBUG("io_uring_setup() failed: %s\n", strerror(errno));
+        ring->ring_fd = -1;
+        return OS_ERROR;
+    }
+
+    ring->sq_ring_size = params.sq_off.array + params.sq_entries * sizeof(uint32);
+    ring->cq_ring_size = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+    ring->sqes_size    = params.sq_entries * sizeof(struct io_uring_sqe);
+
+    /* newer kernels map both rings with one call */
+    if ((params.features & IORING_FEAT_SINGLE_MMAP) != 0 && ring->cq_ring_size > ring->sq_ring_size)
+    {
+        ring->sq_ring_size = ring->cq_ring_size;
+    }
+
+    ring->sq_ring = mmap(NULL, ring->sq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                         ring->ring_fd, IORING_OFF_SQ_RING);
+    if (ring->sq_ring == MAP_FAILED)
+    {
+        ring->sq_ring = NULL;
+        OS_Posix_FileAsyncUringRelease();
+        return OS_ERROR;
+    }
+
+    if ((params.features & IORING_FEAT_SINGLE_MMAP) != 0)
+    {
+        ring->cq_ring = ring->sq_ring;
+    }
+    else
+    {
+        ring->cq_ring = mmap(NULL, ring->cq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                             ring->ring_fd, IORING_OFF_CQ_RING);
+        if (ring->cq_ring == MAP_FAILED)
+        {
+            ring->cq_ring = NULL;
+            OS_Posix_FileAsyncUringRelease();
+            return OS_ERROR;
+        }
+    }
+
+    ring->sqes = mmap(NULL, ring->sqes_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring->ring_fd,
+                      IORING_OFF_SQES);
+    if (ring->sqes == MAP_FAILED)
+    {
+        ring->sqes = NULL;
+        OS_Posix_FileAsyncUringRelease();
+        return OS_ERROR;
+    }
+
+    sq_ptr         = ring->sq_ring;
+    ring->sq_head  = (uint32 *)(sq_ptr + params.sq_off.head);
+    ring->sq_tail  = (uint32 *)(sq_ptr + params.sq_off.tail);
+    ring->sq_mask  = (uint32 *)(sq_ptr + params.sq_off.ring_mask);
+    ring->sq_array = (uint32 *)(sq_ptr + params.sq_off.array);
+
+    cq_ptr        = ring->cq_ring;
+    ring->cq_head = (uint32 *)(cq_ptr + params.cq_off.head);
+    ring->cq_tail = (uint32 *)(cq_ptr + params.cq_off.tail);
+    ring->cq_mask = (uint32 *)(cq_ptr + params.cq_off.ring_mask);
+    ring->cqes    = (struct io_uring_cqe *)(cq_ptr + params.cq_off.cqes);
+
+    if (OS_Posix_InternalTaskCreate_Impl(&reaper, OS_POSIX_FILEASYNC_TASK_PRIORITY, 0, 0,
+                                         OS_Posix_FileAsyncUringReaper, NULL) != OS_SUCCESS)
+    {
+        OS_Posix_FileAsyncUringRelease();
+        return OS_ERROR;
+    }
+
+    pthread_detach(reaper);
+
+    return OS_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_Posix_FileAsyncUringSubmit(OS_impl_fileasync_slot_t *slot, uint32 slot_idx)
+{
+    OS_impl_fileasync_uring_t *ring = &OS_impl_fileasync_uring;
+    struct io_uring_sqe *      sqe;
+    uint32                     tail;
+    uint32                     sqe_idx;
+
+    /* submitters are serialized by the caller, so the tail can be read plainly */
+    tail    = *ring->sq_tail;
+    sqe_idx = tail & *ring->sq_mask;
+    sqe     = &ring->sqes[sqe_idx];
+
+    memset(sqe, 0, sizeof(*sqe));
+    switch (slot->request.opcode)
+    {
+        case OS_FILE_ASYNC_READ:
+            sqe->opcode = IORING_OP_READV;
+            break;
+        case OS_FILE_ASYNC_WRITE:
+            sqe->opcode = IORING_OP_WRITEV;
+            break;
+        default:
+            sqe->opcode = IORING_OP_FSYNC;
+            break;
+    }
+
+    if (sqe->opcode != IORING_OP_FSYNC)
+    {
+        slot->iov.iov_base = slot->request.buffer;
+        slot->iov.iov_len  = slot->request.nbytes;
+
+        sqe->addr = (unsigned long)&slot->iov;
+        sqe->len  = 1;
+        sqe->off  = slot->request.offset;
+    }
+
+    sqe->fd        = slot->fd;
+    sqe->user_data = slot_idx;
+
+    ring->sq_array[sqe_idx] = sqe_idx;
+    __atomic_store_n(ring->sq_tail, tail + 1, __ATOMIC_RELEASE);
+
+    if (OS_Posix_FileAsyncUringEnter(1, 0, 0) < 1)
+    {
+        /*
+         * If the kernel did not consume the entry, take it back out so it
+         * is not picked up by a later submit after the caller has failed it.
+         */
+        if (__atomic_load_n(ring->sq_head, __ATOMIC_ACQUIRE) == tail)
+        {
+            OS_DEBUG("io_uring_enter() failed: %s\n", strerror(errno));
+            __atomic_store_n(ring->sq_tail, tail, __ATOMIC_RELEASE);
+            return OS_ERROR;
+        }
+    }
+
+    return OS_SUCCESS;
+}
@@ -0,0 +1,282 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * \file
+ * \ingroup  posix
+ *
+ * Purpose: Asynchronous file I/O.  Requests are handed to io_uring where
+ *    that is built in and supported by the kernel, otherwise they are
+ *    carried out by a small pool of worker threads using pread()/pwrite().
+ */
+
+/****************************************************************************************
+                                    INCLUDE FILES
+ ***************************************************************************************/
+
+#include "os-impl-fileasync.h"
+#include "os-impl-io.h"
+#include "os-impl-tasks.h"
+
+/****************************************************************************************
+                                   GLOBAL DATA
+ ***************************************************************************************/
+
+OS_impl_fileasync_state_t OS_impl_fileasync;
+
+static pthread_once_t OS_impl_fileasync_once = PTHREAD_ONCE_INIT;
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Carries out one request in the calling thread
+ *
+ *-----------------------------------------------------------------*/
+static int32 OS_Posix_FileAsyncPerform(const OS_impl_fileasync_slot_t *slot)
+{
+    const OS_file_async_request_t *req = &slot->request;
+    ssize_t                        status;
+
+    do
+    {
+        switch (req->opcode)
+        {
+            case OS_FILE_ASYNC_READ:
+                status = pread(slot->fd, req->buffer, req->nbytes, (off_t)req->offset);
+                break;
+            case OS_FILE_ASYNC_WRITE:
+                status = pwrite(slot->fd, req->buffer, req->nbytes, (off_t)req->offset);
+                break;
+            default:
+                status = fsync(slot->fd);
+                break;
+        }
+    } while (status < 0 && errno == EINTR);
+
+    if (status < 0)
+    {
+        OS_DEBUG("Async file op %u failed: %s\n", (unsigned int)req->opcode, strerror(errno));
+        return OS_ERROR;
+    }
+
+    return (int32)status;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Entry point of the thread pool workers
+ *
+ *-----------------------------------------------------------------*/
+static void *OS_Posix_FileAsyncWorker(void *arg)
+{
+    OS_impl_fileasync_slot_t *slot;
+    uint32                    slot_idx;
+
+    while (true)
+    {
+        pthread_mutex_lock(&OS_impl_fileasync.lock);
+        while (OS_impl_fileasync.pending_head == OS_POSIX_FILEASYNC_SLOT_NONE)
+        {
+            pthread_cond_wait(&OS_impl_fileasync.work_cond, &OS_impl_fileasync.lock);
+        }
+
+        slot_idx                       = OS_impl_fileasync.pending_head;
+        slot                           = &OS_impl_fileasync.slots[slot_idx];
+        OS_impl_fileasync.pending_head = slot->next;
+        if (OS_impl_fileasync.pending_head == OS_POSIX_FILEASYNC_SLOT_NONE)
+        {
+            OS_impl_fileasync.pending_tail = OS_POSIX_FILEASYNC_SLOT_NONE;
+        }
+        pthread_mutex_unlock(&OS_impl_fileasync.lock);
+
+        OS_Posix_FileAsyncFinish(slot_idx, OS_Posix_FileAsyncPerform(slot));
+    }
+
+    return NULL;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           One-time setup, run on the first OS_FileAsyncSubmit()
+ *
+ *-----------------------------------------------------------------*/
+static void OS_Posix_FileAsyncInit(void)
+{
+    pthread_t worker;
+    uint32    i;
+    uint32    num_workers;
+
+    memset(&OS_impl_fileasync, 0, sizeof(OS_impl_fileasync));
+
+    OS_impl_fileasync.init_status = OS_ERROR;
+
+    if (pthread_mutex_init(&OS_impl_fileasync.lock, NULL) != 0)
+    {
+        return;
+    }
+
+    if (pthread_cond_init(&OS_impl_fileasync.work_cond, NULL) != 0)
+    {
+        pthread_mutex_destroy(&OS_impl_fileasync.lock);
+        return;
+    }
+
+    for (i = 0; i < OS_MAX_FILE_ASYNC_OPS; ++i)
+    {
+        OS_impl_fileasync.slots[i].next = i + 1;
+    }
+    OS_impl_fileasync.slots[OS_MAX_FILE_ASYNC_OPS - 1].next = OS_POSIX_FILEASYNC_SLOT_NONE;
+    OS_impl_fileasync.free_head                             = 0;
+    OS_impl_fileasync.pending_head                          = OS_POSIX_FILEASYNC_SLOT_NONE;
+    OS_impl_fileasync.pending_tail                          = OS_POSIX_FILEASYNC_SLOT_NONE;
+
+#ifdef OS_POSIX_IO_URING
+    if (OS_Posix_FileAsyncUringInit() == OS_SUCCESS)
+    {
+        OS_impl_fileasync.use_uring   = true;
+        OS_impl_fileasync.init_status = OS_SUCCESS;
+        return;
+    }
+
+    OS_DEBUG("io_uring not available, using worker threads for async file I/O\n");
+#endif
+
+    num_workers = 0;
+    for (i = 0; i < OS_POSIX_FILEASYNC_NUM_WORKERS; ++i)
+    {
+        if (OS_Posix_InternalTaskCreate_Impl(&worker, OS_POSIX_FILEASYNC_TASK_PRIORITY, 0, 0,
+                                             OS_Posix_FileAsyncWorker, NULL) == OS_SUCCESS)
+        {
+            pthread_detach(worker);
+            ++num_workers;
+        }
+    }
+
+    /* Fewer workers only means less parallelism */
+    if (num_workers > 0)
+    {
+        OS_impl_fileasync.init_status = OS_SUCCESS;
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void OS_Posix_FileAsyncFinish(uint32 slot_idx, int32 result)
+{
+    OS_impl_fileasync_slot_t *slot;
+    OS_object_token_t         token;
+    OS_file_async_request_t   request;
+    osal_id_t                 completion_queue;
+
+    pthread_mutex_lock(&OS_impl_fileasync.lock);
+    slot = &OS_impl_fileasync.slots[slot_idx];
+    OS_ObjectIdTransferToken(&slot->token, &token);
+    request          = slot->request;
+    completion_queue = slot->completion_queue;
+
+    slot->next                  = OS_impl_fileasync.free_head;
+    OS_impl_fileasync.free_head = slot_idx;
+    pthread_mutex_unlock(&OS_impl_fileasync.lock);
+
+    OS_FileAsyncComplete(&token, &request, completion_queue, result);
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_FileAsyncSubmit_Impl(OS_object_token_t *token, const OS_file_async_request_t *request,
+                              osal_id_t completion_queue)
+{
+    OS_impl_file_internal_record_t *impl;
+    OS_impl_fileasync_slot_t *      slot;
+    uint32                          slot_idx;
+    int32                           return_code;
+
+    pthread_once(&OS_impl_fileasync_once, OS_Posix_FileAsyncInit);
+    if (OS_impl_fileasync.init_status != OS_SUCCESS)
+    {
+        return OS_impl_fileasync.init_status;
+    }
+
+    impl = OS_OBJECT_TABLE_GET(OS_impl_filehandle_table, *token);
+
+    pthread_mutex_lock(&OS_impl_fileasync.lock);
+
+    slot_idx = OS_impl_fileasync.free_head;
+    if (OS_impl_fileasync.init_status != OS_SUCCESS)
+    {
+        /* the io_uring completion thread has shut down since the check above */
+        return_code = OS_impl_fileasync.init_status;
+    }
+    else if (slot_idx == OS_POSIX_FILEASYNC_SLOT_NONE)
+    {
+        return_code = OS_ERR_NO_FREE_IDS;
+    }
+    else
+    {
+        slot                        = &OS_impl_fileasync.slots[slot_idx];
+        OS_impl_fileasync.free_head = slot->next;
+
+        slot->request          = *request;
+        slot->completion_queue = completion_queue;
+        slot->fd               = impl->fd;
+        slot->next             = OS_POSIX_FILEASYNC_SLOT_NONE;
+        OS_ObjectIdTransferToken(token, &slot->token);
+
+        if (OS_impl_fileasync.use_uring)
+        {
+            return_code = OS_Posix_FileAsyncUringSubmit(slot, slot_idx);
+        }
+        else
+        {
+            if (OS_impl_fileasync.pending_tail == OS_POSIX_FILEASYNC_SLOT_NONE)
+            {
+                OS_impl_fileasync.pending_head = slot_idx;
+            }
+            else
+            {
+                OS_impl_fileasync.slots[OS_impl_fileasync.pending_tail].next = slot_idx;
+            }
+            OS_impl_fileasync.pending_tail = slot_idx;
+
+            pthread_cond_signal(&OS_impl_fileasync.work_cond);
+            return_code = OS_SUCCESS;
+        }
+
+        if (return_code != OS_SUCCESS)
+        {
+            /* give the reference back to the caller, who releases it */
+            OS_ObjectIdTransferToken(&slot->token, token);
+            slot->next                  = OS_impl_fileasync.free_head;
+            OS_impl_fileasync.free_head = slot_idx;
+        }
+    }
+
+    pthread_mutex_unlock(&OS_impl_fileasync.lock);
+
+    return return_code;
+}
@@ -0,0 +1,114 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * \file
+ * \ingroup  posix
+ *
+ * Purpose: Thin wrappers around the Linux futex system call, which
+ *    provides the blocking slow path for the semaphore implementation.
+ */
+
+/****************************************************************************************
+                                    INCLUDE FILES
+ ***************************************************************************************/
+
+#include "os-posix.h"
+#include "os-impl-futex.h"
+
+#include <linux/futex.h>
+#include <sys/syscall.h>
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *
+ *-----------------------------------------------------------------*/
+void OS_Posix_FutexCompAbsDelayTime(uint32 msecs, struct timespec *tm)
+{
+    /*
+     * The monotonic clock is used so that a change to the wall clock
+     * (e.g. by CFE_TIME or NTP) does not stretch or cut short a timed wait
+     */
+    clock_gettime(CLOCK_MONOTONIC, tm);
+
+    tm->tv_sec += (time_t)(msecs / 1000);
+    tm->tv_nsec += (msecs % 1000) * 1000000L;
+
+    if (tm->tv_nsec >= 1000000000L)
+    {
+        tm->tv_nsec -= 1000000000L;
+        tm->tv_sec++;
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_Posix_FutexWait(uint32 *word, uint32 expected, const struct timespec *abs_timeout)
+{
+    long  ret;
+    int   err;
+    int   old_type;
+    int32 return_code;
+
+    /*
+     * A raw syscall is not a cancellation point by itself.  Like the C library
+     * does for its own blocking calls, allow asynchronous cancellation only for
+     * the duration of the wait so OS_TaskDelete() still works on a pending task.
+     */
+    pthread_setcanceltype(PTHREAD_CANCEL_ASYNCHRONOUS, &old_type);
+
+    /*
+     * FUTEX_WAIT_BITSET takes an absolute CLOCK_MONOTONIC timeout,
+     * so retrying after a spurious wakeup does not extend the deadline
+     */
+    ret = syscall(SYS_futex, word, FUTEX_WAIT_BITSET | FUTEX_PRIVATE_FLAG, expected, abs_timeout, NULL,
+                  FUTEX_BITSET_MATCH_ANY);
+    err = errno;
+
+    pthread_setcanceltype(old_type, NULL);
+
+    if (ret == 0 || err == EAGAIN || err == EINTR)
+    {
+        return_code = OS_SUCCESS;
+    }
+    else if (err == ETIMEDOUT)
+    {
+        return_code = OS_SEM_TIMEOUT;
+    }
+    else
+    {
+        OS_DEBUG("futex wait: %s\n", strerror(err));
+        return_code = OS_SEM_FAILURE;
+    }
+
+    return return_code;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *
+ *-----------------------------------------------------------------*/
+void OS_Posix_FutexWake(uint32 *word, int count)
+{
+    syscall(SYS_futex, word, FUTEX_WAKE | FUTEX_PRIVATE_FLAG, count, NULL, NULL, 0);
+}
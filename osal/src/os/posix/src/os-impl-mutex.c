@@ -39,6 +39,20 @@ OS_impl_mutex_internal_record_t OS_impl_mutex_table[OS_MAX_MUTEXES];
                                   MUTEX API
  ***************************************************************************************/
 
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Monotonic time in nanoseconds, for the hold time statistics
+ *
+ *-----------------------------------------------------------------*/
+static inline uint64 OS_Posix_MutexTimeNs(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return ((uint64)now.tv_sec * 1000000000) + (uint64)now.tv_nsec;
+}
+
 /*----------------------------------------------------------------
  *
  *  Purpose: Local helper routine, not part of OSAL API.
@@ -59,11 +73,17 @@ int32 OS_Posix_MutexAPI_Impl_Init(void)
 int32 OS_MutSemCreate_Impl(const OS_object_token_t *token, uint32 options)
 {
     int                              return_code;
+    int                              protocol;
+    int                              mutex_type;
     pthread_mutexattr_t              mutex_attr;
     OS_impl_mutex_internal_record_t *impl;
 
     impl = OS_OBJECT_TABLE_GET(OS_impl_mutex_table, *token);
 
+    memset(impl, 0, sizeof(*impl));
+    impl->collect_stats = ((options & OS_MUTEX_OPTION_STATISTICS) != 0);
+    options &= ~OS_MUTEX_OPTION_STATISTICS;
+
     /*
     ** initialize the attribute with default values
     */
@@ -76,9 +96,26 @@ int32 OS_MutSemCreate_Impl(const OS_object_token_t *token, uint32 options)
     }
 
     /*
-    ** Allow the mutex to use priority inheritance
+    ** Select the protocol.  Priority inheritance is the default.  A mutex
+    ** created with any of the performance options drops to the plain
+    ** protocol when real-time priorities are not in effect, since neither
+    ** inheritance nor a ceiling does anything useful then.  Adaptive
+    ** mutexes otherwise keep inheritance; glibc does not spin on those.
     */
-    return_code = pthread_mutexattr_setprotocol(&mutex_attr, PTHREAD_PRIO_INHERIT);
+    if ((options & OS_MUTEX_OPTION_PRIO_CEILING) != 0 && POSIX_GlobalVars.EnableTaskPriorities)
+    {
+        protocol = PTHREAD_PRIO_PROTECT;
+    }
+    else if (options != 0 && !POSIX_GlobalVars.EnableTaskPriorities)
+    {
+        protocol = PTHREAD_PRIO_NONE;
+    }
+    else
+    {
+        protocol = PTHREAD_PRIO_INHERIT;
+    }
+
+    return_code = pthread_mutexattr_setprotocol(&mutex_attr, protocol);
     if (return_code != 0)
     {
         OS_DEBUG("Error: Mutex could not be created. pthread_mutexattr_setprotocol failed ID = %lu: %s\n",
@@ -86,10 +123,39 @@ int32 OS_MutSemCreate_Impl(const OS_object_token_t *token, uint32 options)
         return OS_SEM_FAILURE;
     }
 
+    if (protocol == PTHREAD_PRIO_PROTECT)
+    {
+        return_code = pthread_mutexattr_setprioceiling(&mutex_attr, POSIX_GlobalVars.PriLimits.PriorityMax);
+        if (return_code != 0)
+        {
+            OS_DEBUG("Error: Mutex could not be created. pthread_mutexattr_setprioceiling failed ID = %lu: %s\n",
+                     OS_ObjectIdToInteger(OS_ObjectIdFromToken(token)), strerror(return_code));
+            return OS_SEM_FAILURE;
+        }
+    }
+
     /*
-    **  Set the mutex type to RECURSIVE so a thread can do nested locks
+    **  Set the mutex type.  By default it is RECURSIVE so a thread can do
+    **  nested locks.
     */
-    return_code = pthread_mutexattr_settype(&mutex_attr, PTHREAD_MUTEX_RECURSIVE);
+    if ((options & OS_MUTEX_OPTION_ADAPTIVE) != 0 && protocol == PTHREAD_PRIO_NONE)
+    {
+#if defined(_GNU_SOURCE) && defined(__GLIBC__)
+        mutex_type = PTHREAD_MUTEX_ADAPTIVE_NP;
+#else
+        mutex_type = PTHREAD_MUTEX_NORMAL;
+#endif
+    }
+    else if ((options & (OS_MUTEX_OPTION_NONRECURSIVE | OS_MUTEX_OPTION_ADAPTIVE)) != 0)
+    {
+        mutex_type = PTHREAD_MUTEX_NORMAL;
+    }
+    else
+    {
+        mutex_type = PTHREAD_MUTEX_RECURSIVE;
+    }
+
+    return_code = pthread_mutexattr_settype(&mutex_attr, mutex_type);
     if (return_code != 0)
     {
         OS_DEBUG("Error: Mutex could not be created. pthread_mutexattr_settype failed ID = %lu: %s\n",
@@ -146,8 +212,28 @@ int32 OS_MutSemGive_Impl(const OS_object_token_t *token)
     int                              status;
     OS_impl_mutex_internal_record_t *impl;
 
+    uint64                           hold_ns;
+
     impl = OS_OBJECT_TABLE_GET(OS_impl_mutex_table, *token);
 
+    /*
+     * Account for the hold time while the mutex is still held,
+     * so the statistics need no other protection.
+     */
+    if (impl->collect_stats && impl->nest_depth > 0)
+    {
+        --impl->nest_depth;
+        if (impl->nest_depth == 0)
+        {
+            hold_ns = OS_Posix_MutexTimeNs() - impl->hold_start_ns;
+            impl->total_hold_ns += hold_ns;
+            if (hold_ns > impl->max_hold_ns)
+            {
+                impl->max_hold_ns = hold_ns;
+            }
+        }
+    }
+
     /*
      ** Unlock the mutex
      */
@@ -171,17 +257,52 @@ int32 OS_MutSemTake_Impl(const OS_object_token_t *token)
     int                              status;
     OS_impl_mutex_internal_record_t *impl;
 
+    bool                             contended;
+
     impl = OS_OBJECT_TABLE_GET(OS_impl_mutex_table, *token);
 
+    if (!impl->collect_stats)
+    {
+        /*
+        ** Lock the mutex
+        */
+        status = pthread_mutex_lock(&(impl->id));
+        if (status != 0)
+        {
+            return OS_SEM_FAILURE;
+        }
+
+        return OS_SUCCESS;
+    }
+
     /*
-    ** Lock the mutex
+    ** Lock the mutex, trying without waiting first to detect contention
     */
-    status = pthread_mutex_lock(&(impl->id));
+    status    = pthread_mutex_trylock(&(impl->id));
+    contended = (status == EBUSY);
+    if (contended)
+    {
+        status = pthread_mutex_lock(&(impl->id));
+    }
+
     if (status != 0)
     {
         return OS_SEM_FAILURE;
     }
 
+    /* The statistics are protected by the mutex itself */
+    ++impl->take_count;
+    if (contended)
+    {
+        ++impl->contention_count;
+    }
+
+    if (impl->nest_depth == 0)
+    {
+        impl->hold_start_ns = OS_Posix_MutexTimeNs();
+    }
+    ++impl->nest_depth;
+
     return OS_SUCCESS;
 }
 
@@ -193,5 +314,14 @@ int32 OS_MutSemTake_Impl(const OS_object_token_t *token)
  *-----------------------------------------------------------------*/
 int32 OS_MutSemGetInfo_Impl(const OS_object_token_t *token, OS_mut_sem_prop_t *mut_prop)
 {
+    OS_impl_mutex_internal_record_t *impl;
+
+    impl = OS_OBJECT_TABLE_GET(OS_impl_mutex_table, *token);
+
+    mut_prop->take_count       = impl->take_count;
+    mut_prop->contention_count = impl->contention_count;
+    mut_prop->total_hold_time  = OS_TimeFromTotalNanoseconds(impl->total_hold_ns);
+    mut_prop->max_hold_time    = OS_TimeFromTotalNanoseconds(impl->max_hold_ns);
+
     return OS_SUCCESS;
 }
@@ -0,0 +1,347 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * \file
+ * \ingroup  posix
+ *
+ * Purpose: Work-stealing task pool.  Each worker thread owns a double-ended
+ *    job queue.  A worker runs its own jobs newest first, and when it has
+ *    none takes the oldest job from another worker.  Idle workers sleep on
+ *    a condition variable, which is only signaled when one of them is idle.
+ */
+
+/****************************************************************************************
+                                    INCLUDE FILES
+ ***************************************************************************************/
+
+#include "os-posix.h"
+#include "os-shared-task.h"
+#include "os-impl-tasks.h"
+
+/****************************************************************************************
+                                     DEFINES
+ ***************************************************************************************/
+
+/*
+ * The sum of all queues is bounded by OS_MAX_TASK_POOL_JOBS, so each queue
+ * is sized to hold every job in case they were all submitted from one worker.
+ */
+#define OS_POSIX_TASKPOOL_QUEUE_DEPTH OS_MAX_TASK_POOL_JOBS
+
+/****************************************************************************************
+                                   TYPEDEFS
+ ***************************************************************************************/
+
+typedef struct
+{
+    OS_TaskPoolJob_t job_func;
+    void *           job_arg;
+} OS_impl_taskpool_job_t;
+
+/*
+ * Job queue of one worker.  The owner pushes and pops at the tail, other
+ * workers steal from the head.  Only held while moving one entry.
+ */
+typedef struct
+{
+    pthread_mutex_t        lock;
+    uint32                 head;
+    uint32                 count;
+    OS_impl_taskpool_job_t jobs[OS_POSIX_TASKPOOL_QUEUE_DEPTH];
+} OS_impl_taskpool_worker_t;
+
+typedef struct
+{
+    int32                     init_status;
+    uint32                    num_workers;
+    pthread_key_t             worker_key;
+    pthread_mutex_t           idle_lock;
+    pthread_cond_t            idle_cond;
+    uint32                    num_idle;
+    uint32                    outstanding; /**< Jobs queued or running, limited to OS_MAX_TASK_POOL_JOBS */
+    uint32                    queued;      /**< Jobs in a queue, the condition idle workers wait on */
+    uint32                    next_worker; /**< Queue for the next job from outside the pool */
+    uint32                    submitted;
+    uint32                    completed;
+    uint32                    stolen;
+    uint32                    rejected;
+    OS_impl_taskpool_worker_t workers[OS_MAX_TASK_POOL_WORKERS];
+} OS_impl_taskpool_state_t;
+
+/****************************************************************************************
+                                   GLOBAL DATA
+ ***************************************************************************************/
+
+static OS_impl_taskpool_state_t OS_impl_taskpool;
+
+static pthread_once_t OS_impl_taskpool_once = PTHREAD_ONCE_INIT;
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Takes the next job for the given worker, from its own queue if
+ *           possible, otherwise from another worker.  Returns false if all
+ *           queues were empty.
+ *
+ *-----------------------------------------------------------------*/
+static bool OS_Posix_TaskPoolTake(uint32 self, OS_impl_taskpool_job_t *job)
+{
+    OS_impl_taskpool_worker_t *worker;
+    uint32                     i;
+    bool                       found;
+
+    /* Own queue: newest first, as its data is most likely still in cache */
+    worker = &OS_impl_taskpool.workers[self];
+    pthread_mutex_lock(&worker->lock);
+    found = (worker->count > 0);
+    if (found)
+    {
+        --worker->count;
+        *job = worker->jobs[(worker->head + worker->count) % OS_POSIX_TASKPOOL_QUEUE_DEPTH];
+        __atomic_sub_fetch(&OS_impl_taskpool.queued, 1, __ATOMIC_SEQ_CST);
+    }
+    pthread_mutex_unlock(&worker->lock);
+
+    /* Other queues: oldest first, starting with the next worker along */
+    for (i = 1; !found && i < OS_impl_taskpool.num_workers; ++i)
+    {
+        worker = &OS_impl_taskpool.workers[(self + i) % OS_impl_taskpool.num_workers];
+        pthread_mutex_lock(&worker->lock);
+        found = (worker->count > 0);
+        if (found)
+        {
+            *job         = worker->jobs[worker->head];
+            worker->head = (worker->head + 1) % OS_POSIX_TASKPOOL_QUEUE_DEPTH;
+            --worker->count;
+            __atomic_sub_fetch(&OS_impl_taskpool.queued, 1, __ATOMIC_SEQ_CST);
+            __atomic_add_fetch(&OS_impl_taskpool.stolen, 1, __ATOMIC_RELAXED);
+        }
+        pthread_mutex_unlock(&worker->lock);
+    }
+
+    return found;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Entry point of the worker threads
+ *
+ *-----------------------------------------------------------------*/
+static void *OS_Posix_TaskPoolWorker(void *arg)
+{
+    OS_impl_taskpool_job_t job;
+    uint32                 self;
+
+    self = (uint32)(uintptr_t)arg;
+
+    /* Stored plus one, so that NULL means "not a worker" */
+    pthread_setspecific(OS_impl_taskpool.worker_key, (void *)(uintptr_t)(self + 1));
+
+    while (true)
+    {
+        if (OS_Posix_TaskPoolTake(self, &job))
+        {
+            job.job_func(job.job_arg);
+
+            __atomic_add_fetch(&OS_impl_taskpool.completed, 1, __ATOMIC_RELAXED);
+            __atomic_sub_fetch(&OS_impl_taskpool.outstanding, 1, __ATOMIC_RELEASE);
+            continue;
+        }
+
+        /*
+         * Announce being idle before checking for work.  A submitter adds to
+         * "queued" before checking "num_idle", so either this worker sees the
+         * new job or the submitter sees this worker and signals it.  Both
+         * are sequentially consistent to make that hold.
+         */
+        pthread_mutex_lock(&OS_impl_taskpool.idle_lock);
+        __atomic_add_fetch(&OS_impl_taskpool.num_idle, 1, __ATOMIC_SEQ_CST);
+        while (__atomic_load_n(&OS_impl_taskpool.queued, __ATOMIC_SEQ_CST) == 0)
+        {
+            pthread_cond_wait(&OS_impl_taskpool.idle_cond, &OS_impl_taskpool.idle_lock);
+        }
+        __atomic_sub_fetch(&OS_impl_taskpool.num_idle, 1, __ATOMIC_SEQ_CST);
+        pthread_mutex_unlock(&OS_impl_taskpool.idle_lock);
+    }
+
+    return NULL;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           One-time setup, run on the first OS_TaskPoolSubmit()
+ *
+ *-----------------------------------------------------------------*/
+static void OS_Posix_TaskPoolInit(void)
+{
+    pthread_t thread;
+    uint32    max_workers;
+    uint32    i;
+    uint32    num_started;
+
+    memset(&OS_impl_taskpool, 0, sizeof(OS_impl_taskpool));
+
+    OS_impl_taskpool.init_status = OS_ERROR;
+
+    max_workers = OS_MAX_TASK_POOL_WORKERS;
+#ifdef _SC_NPROCESSORS_ONLN
+    {
+        long num_cpus = sysconf(_SC_NPROCESSORS_ONLN);
+
+        /* More workers than CPUs would only add switching */
+        if (num_cpus > 0 && num_cpus < max_workers)
+        {
+            max_workers = (uint32)num_cpus;
+        }
+    }
+#endif
+
+    if (pthread_key_create(&OS_impl_taskpool.worker_key, NULL) != 0)
+    {
+        return;
+    }
+
+    if (pthread_mutex_init(&OS_impl_taskpool.idle_lock, NULL) != 0)
+    {
+        return;
+    }
+
+    if (pthread_cond_init(&OS_impl_taskpool.idle_cond, NULL) != 0)
+    {
+        return;
+    }
+
+    for (i = 0; i < max_workers; ++i)
+    {
+        if (pthread_mutex_init(&OS_impl_taskpool.workers[i].lock, NULL) != 0)
+        {
+            break;
+        }
+    }
+    max_workers = i;
+
+    /*
+     * Each worker only looks at the queues below num_workers, so it must
+     * be final before the first one starts.  If some fail to start, their
+     * queues stay empty except for jobs given to them by submitters, which
+     * the other workers steal.
+     */
+    OS_impl_taskpool.num_workers = max_workers;
+
+    num_started = 0;
+    for (i = 0; i < max_workers; ++i)
+    {
+        if (OS_Posix_InternalTaskCreate_Impl(&thread, OS_TASK_POOL_PRIORITY, 0, 0, OS_Posix_TaskPoolWorker,
+                                             (void *)(uintptr_t)i) == OS_SUCCESS)
+        {
+            pthread_detach(thread);
+            ++num_started;
+        }
+    }
+
+    if (num_started > 0)
+    {
+        OS_impl_taskpool.init_status = OS_SUCCESS;
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_TaskPoolSubmit_Impl(OS_TaskPoolJob_t job_func, void *job_arg)
+{
+    OS_impl_taskpool_worker_t *worker;
+    uint32                     target;
+    uintptr_t                  self;
+
+    pthread_once(&OS_impl_taskpool_once, OS_Posix_TaskPoolInit);
+    if (OS_impl_taskpool.init_status != OS_SUCCESS)
+    {
+        return OS_impl_taskpool.init_status;
+    }
+
+    if (__atomic_add_fetch(&OS_impl_taskpool.outstanding, 1, __ATOMIC_ACQUIRE) > OS_MAX_TASK_POOL_JOBS)
+    {
+        __atomic_sub_fetch(&OS_impl_taskpool.outstanding, 1, __ATOMIC_RELAXED);
+        __atomic_add_fetch(&OS_impl_taskpool.rejected, 1, __ATOMIC_RELAXED);
+        return OS_QUEUE_FULL;
+    }
+
+    /* A job submitted by a job stays with that worker, others are spread out */
+    self = (uintptr_t)pthread_getspecific(OS_impl_taskpool.worker_key);
+    if (self != 0)
+    {
+        target = (uint32)(self - 1);
+    }
+    else
+    {
+        target = __atomic_fetch_add(&OS_impl_taskpool.next_worker, 1, __ATOMIC_RELAXED) % OS_impl_taskpool.num_workers;
+    }
+
+    worker = &OS_impl_taskpool.workers[target];
+    pthread_mutex_lock(&worker->lock);
+    worker->jobs[(worker->head + worker->count) % OS_POSIX_TASKPOOL_QUEUE_DEPTH].job_func = job_func;
+    worker->jobs[(worker->head + worker->count) % OS_POSIX_TASKPOOL_QUEUE_DEPTH].job_arg  = job_arg;
+    ++worker->count;
+    __atomic_add_fetch(&OS_impl_taskpool.queued, 1, __ATOMIC_SEQ_CST);
+    pthread_mutex_unlock(&worker->lock);
+
+    __atomic_add_fetch(&OS_impl_taskpool.submitted, 1, __ATOMIC_RELAXED);
+
+    /* See OS_Posix_TaskPoolWorker() for why this check does not lose a wakeup */
+    if (__atomic_load_n(&OS_impl_taskpool.num_idle, __ATOMIC_SEQ_CST) != 0)
+    {
+        pthread_mutex_lock(&OS_impl_taskpool.idle_lock);
+        pthread_cond_signal(&OS_impl_taskpool.idle_cond);
+        pthread_mutex_unlock(&OS_impl_taskpool.idle_lock);
+    }
+
+    return OS_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_TaskPoolGetInfo_Impl(OS_task_pool_prop_t *pool_prop)
+{
+    uint32 outstanding;
+    uint32 queued;
+
+    /* Not started here; before the first submit the counts are all still zero */
+    outstanding = __atomic_load_n(&OS_impl_taskpool.outstanding, __ATOMIC_RELAXED);
+    queued      = __atomic_load_n(&OS_impl_taskpool.queued, __ATOMIC_RELAXED);
+
+    pool_prop->num_workers    = OS_impl_taskpool.num_workers;
+    pool_prop->jobs_queued    = queued;
+    pool_prop->jobs_running   = (outstanding > queued) ? (outstanding - queued) : 0;
+    pool_prop->jobs_submitted = __atomic_load_n(&OS_impl_taskpool.submitted, __ATOMIC_RELAXED);
+    pool_prop->jobs_completed = __atomic_load_n(&OS_impl_taskpool.completed, __ATOMIC_RELAXED);
+    pool_prop->jobs_stolen    = __atomic_load_n(&OS_impl_taskpool.stolen, __ATOMIC_RELAXED);
+    pool_prop->jobs_rejected  = __atomic_load_n(&OS_impl_taskpool.rejected, __ATOMIC_RELAXED);
+
+    return OS_SUCCESS;
+}
@@ -31,6 +31,10 @@
 #include "bsp-impl.h"
 #include <sched.h>
 
+#ifdef __linux__
+#include <sys/syscall.h>
+#endif
+
 #include "os-impl-tasks.h"
 
 #include "os-shared-task.h"
@@ -113,9 +117,24 @@ static void OS_NoopSigHandler(int signal) {} /* end OS_NoopSigHandler */
 static void *OS_PthreadTaskEntry(void *arg)
 {
     OS_VoidPtrValueWrapper_t local_arg;
+    osal_index_t             idx;
 
     /* cppcheck-suppress unreadVariable // intentional use of other union member */
     local_arg.opaque_arg = arg;
+
+#ifdef __linux__
+    /*
+     * The kernel thread ID is only obtainable from within the thread itself.
+     * It is needed to find the per-thread scheduler statistics under /proc.
+     */
+    if (OS_ObjectIdToArrayIndex(OS_OBJECT_TYPE_OS_TASK, local_arg.id, &idx) == OS_SUCCESS)
+    {
+        __atomic_store_n(&OS_impl_task_table[idx].tid, (pid_t)syscall(SYS_gettid), __ATOMIC_RELEASE);
+    }
+#else
+    (void)idx;
+#endif
+
     OS_TaskEntryPoint(local_arg.id); /* Never returns */
 
     return NULL;
@@ -431,12 +450,19 @@ int32 OS_Posix_TaskAPI_Impl_Init(void)
  *  Purpose: Local helper routine, not part of OSAL API.
  *
  *-----------------------------------------------------------------*/
-int32 OS_Posix_InternalTaskCreate_Impl(pthread_t *pthr, osal_priority_t priority, size_t stacksz,
+int32 OS_Posix_InternalTaskCreate_Impl(pthread_t *pthr, osal_priority_t priority, size_t stacksz, uint32 flags,
                                        PthreadFuncPtr_t entry, void *entry_arg)
 {
     int                return_code = 0;
     pthread_attr_t     custom_attr;
     struct sched_param priority_holder;
+    int                sched_policy;
+    uint32             cpu_mask;
+#ifdef CPU_SETSIZE
+    cpu_set_t cpuset;
+    uint32    cpu;
+    long      num_cpus;
+#endif
 
     /*
      ** Initialize the pthread_attr structure.
@@ -508,9 +534,24 @@ int32 OS_Posix_InternalTaskCreate_Impl(pthread_t *pthr, osal_priority_t priority
 
         /*
         ** Set the scheduling policy
-        ** The best policy is determined during initialization
+        ** The best policy is determined during initialization, unless the
+        ** caller asked for a specific one.  FIFO and RR share the same
+        ** priority range on all supported systems so the remap still applies.
         */
-        return_code = pthread_attr_setschedpolicy(&custom_attr, POSIX_GlobalVars.SelectedRtScheduler);
+        if (flags & OS_TASK_SCHED_RR)
+        {
+            sched_policy = SCHED_RR;
+        }
+        else if (flags & OS_TASK_SCHED_FIFO)
+        {
+            sched_policy = SCHED_FIFO;
+        }
+        else
+        {
+            sched_policy = POSIX_GlobalVars.SelectedRtScheduler;
+        }
+
+        return_code = pthread_attr_setschedpolicy(&custom_attr, sched_policy);
         if (return_code != 0)
         {
             OS_DEBUG("pthread_attr_setschedpolity error in OS_TaskCreate: %s\n", strerror(return_code));
@@ -537,6 +578,42 @@ int32 OS_Posix_InternalTaskCreate_Impl(pthread_t *pthr, osal_priority_t priority
 
     } /* End if user is root */
 
+    /*
+    ** Restrict the set of CPUs the thread may run on, if requested.
+    ** This is applied via the attributes so the thread never runs elsewhere.
+    */
+    cpu_mask = OS_TASK_CPU_AFFINITY_GET(flags);
+    if (cpu_mask != 0)
+    {
+#ifdef CPU_SETSIZE
+        /* a mask naming only CPUs that do not exist would fail later, or silently on some kernels */
+        num_cpus = sysconf(_SC_NPROCESSORS_CONF);
+        if (num_cpus > 0 && num_cpus < 32 && (cpu_mask >> num_cpus) != 0)
+        {
+            OS_DEBUG("CPU affinity 0x%lx invalid, system has %ld CPUs\n", (unsigned long)cpu_mask, num_cpus);
+            return OS_ERR_INVALID_ARGUMENT;
+        }
+
+        CPU_ZERO(&cpuset);
+        for (cpu = 0; cpu < 32 && cpu < CPU_SETSIZE; ++cpu)
+        {
+            if (cpu_mask & (1U << cpu))
+            {
+                CPU_SET(cpu, &cpuset);
+            }
+        }
+
+        return_code = pthread_attr_setaffinity_np(&custom_attr, sizeof(cpuset), &cpuset);
+        if (return_code != 0)
+        {
+            OS_DEBUG("pthread_attr_setaffinity_np error in OS_TaskCreate: %s\n", strerror(return_code));
+            return OS_ERROR;
+        }
+#else
+        OS_DEBUG("CPU affinity 0x%lx ignored, not supported on this system\n", (unsigned long)cpu_mask);
+#endif
+    }
+
     /*
      ** Create thread
      */
@@ -583,8 +660,9 @@ int32 OS_TaskCreate_Impl(const OS_object_token_t *token, uint32 flags)
     task = OS_OBJECT_TABLE_GET(OS_task_table, *token);
     impl = OS_OBJECT_TABLE_GET(OS_impl_task_table, *token);
 
-    return_code = OS_Posix_InternalTaskCreate_Impl(&impl->id, task->priority, task->stack_size, OS_PthreadTaskEntry,
-                                                   arg.opaque_arg);
+    impl->tid   = 0;
+    return_code = OS_Posix_InternalTaskCreate_Impl(&impl->id, task->priority, task->stack_size, flags,
+                                                   OS_PthreadTaskEntry, arg.opaque_arg);
 
     return return_code;
 }
@@ -825,6 +903,98 @@ osal_id_t OS_TaskGetId_Impl(void)
     return self_record.id;
 }
 
+#ifdef __linux__
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Samples the scheduler statistics of a kernel thread.
+ *
+ *           All values are read into locals and only copied to the
+ *           output once every file has been parsed, so a thread that
+ *           exits part way through never yields a mix of fields.
+ *
+ *-----------------------------------------------------------------*/
+static void OS_Posix_TaskReadSchedStats(pid_t tid, OS_task_prop_t *task_prop)
+{
+    char               path[64];
+    char               line[512];
+    const char *       pos;
+    unsigned long      value;
+    unsigned long      frac;
+    unsigned long long run_ns;
+    unsigned long long wait_ns;
+    long               clk_tck;
+    FILE *             fp;
+    OS_time_t          cpu_time;
+    OS_time_t          max_run_slice;
+    uint32             run_slices;
+    uint32             migrations;
+
+    cpu_time      = task_prop->cpu_time;
+    max_run_slice = task_prop->max_run_slice;
+    run_slices    = task_prop->run_slices;
+    migrations    = task_prop->migrations;
+
+    /*
+     * schedstat gives nanosecond CPU time and the number of run slices.  Fall back to the
+     * tick-granular utime/stime fields of the stat file on kernels without it.
+     */
+    snprintf(path, sizeof(path), "/proc/self/task/%ld/schedstat", (long)tid);
+    fp = fopen(path, "r");
+    if (fp != NULL)
+    {
+        if (fscanf(fp, "%llu %llu %lu", &run_ns, &wait_ns, &value) == 3)
+        {
+            cpu_time   = OS_TimeFromTotalNanoseconds((int64)run_ns);
+            run_slices = value;
+        }
+        fclose(fp);
+    }
+    else
+    {
+        snprintf(path, sizeof(path), "/proc/self/task/%ld/stat", (long)tid);
+        fp = fopen(path, "r");
+        if (fp != NULL)
+        {
+            clk_tck = sysconf(_SC_CLK_TCK);
+
+            /* the command name may contain spaces, so parse from the closing parenthesis */
+            if (clk_tck > 0 && fgets(line, sizeof(line), fp) != NULL && (pos = strrchr(line, ')')) != NULL &&
+                sscanf(pos + 1, " %*c %*d %*d %*d %*d %*d %*u %*u %*u %*u %*u %lu %lu", &value, &frac) == 2)
+            {
+                cpu_time = OS_TimeFromTotalMilliseconds(((int64)value + frac) * 1000 / clk_tck);
+            }
+            fclose(fp);
+        }
+    }
+
+    snprintf(path, sizeof(path), "/proc/self/task/%ld/sched", (long)tid);
+    fp = fopen(path, "r");
+    if (fp != NULL)
+    {
+        while (fgets(line, sizeof(line), fp) != NULL)
+        {
+            if (sscanf(line, "se.nr_migrations : %lu", &value) == 1)
+            {
+                migrations = value;
+            }
+            else if (strstr(line, "slice_max") != NULL && (pos = strchr(line, ':')) != NULL &&
+                     sscanf(pos + 1, " %lu.%lu", &value, &frac) == 2)
+            {
+                /* reported in milliseconds with six fractional (nanosecond) digits */
+                max_run_slice = OS_TimeFromTotalNanoseconds((int64)value * 1000000 + frac);
+            }
+        }
+        fclose(fp);
+    }
+
+    task_prop->cpu_time      = cpu_time;
+    task_prop->max_run_slice = max_run_slice;
+    task_prop->run_slices    = run_slices;
+    task_prop->migrations    = migrations;
+}
+#endif
+
 /*----------------------------------------------------------------
  *
  *  Purpose: Implemented per internal OSAL API
@@ -833,6 +1003,53 @@ osal_id_t OS_TaskGetId_Impl(void)
  *-----------------------------------------------------------------*/
 int32 OS_TaskGetInfo_Impl(const OS_object_token_t *token, OS_task_prop_t *task_prop)
 {
+#ifdef __linux__
+    OS_impl_task_internal_record_t *impl;
+    char                            path[64];
+    char                            line[512];
+    unsigned long                   value;
+    pid_t                           tid;
+    FILE *                          fp;
+
+    impl = OS_OBJECT_TABLE_GET(OS_impl_task_table, *token);
+
+    /*
+     * This is called without the task table lock, and the thread stores its
+     * own ID when it starts, so read it exactly once.
+     */
+    tid = __atomic_load_n(&impl->tid, __ATOMIC_ACQUIRE);
+
+    /* the thread has not reached its entry point yet */
+    if (tid == 0)
+    {
+        return OS_SUCCESS;
+    }
+
+    /*
+     * Statistics are best-effort: if the files are unavailable (e.g. no /proc
+     * or a kernel without scheduler debug) the counters are simply left at zero.
+     */
+    snprintf(path, sizeof(path), "/proc/self/task/%ld/status", (long)tid);
+    fp = fopen(path, "r");
+    if (fp != NULL)
+    {
+        while (fgets(line, sizeof(line), fp) != NULL)
+        {
+            if (sscanf(line, "voluntary_ctxt_switches: %lu", &value) == 1)
+            {
+                task_prop->voluntary_switches = value;
+            }
+            else if (sscanf(line, "nonvoluntary_ctxt_switches: %lu", &value) == 1)
+            {
+                task_prop->involuntary_switches = value;
+            }
+        }
+        fclose(fp);
+    }
+
+    OS_Posix_TaskReadSchedStats(tid, task_prop);
+#endif
+
     return OS_SUCCESS;
 }
 
@@ -56,6 +56,7 @@ static OS_impl_objtype_lock_t OS_module_table_lock;
 static OS_impl_objtype_lock_t OS_filesys_table_lock;
 static OS_impl_objtype_lock_t OS_console_lock;
 static OS_impl_objtype_lock_t OS_condvar_lock;
+static OS_impl_objtype_lock_t OS_poller_lock;
 
 OS_impl_objtype_lock_t *const OS_impl_objtype_lock_table[OS_OBJECT_TYPE_USER] = {
     [OS_OBJECT_TYPE_UNDEFINED]   = NULL,
@@ -72,6 +73,7 @@ OS_impl_objtype_lock_t *const OS_impl_objtype_lock_table[OS_OBJECT_TYPE_USER] =
     [OS_OBJECT_TYPE_OS_FILESYS]  = &OS_filesys_table_lock,
     [OS_OBJECT_TYPE_OS_CONSOLE]  = &OS_console_lock,
     [OS_OBJECT_TYPE_OS_CONDVAR]  = &OS_condvar_lock,
+    [OS_OBJECT_TYPE_OS_POLLER]   = &OS_poller_lock,
 };
 
 /*----------------------------------------------------------------
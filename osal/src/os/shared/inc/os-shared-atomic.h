@@ -0,0 +1,65 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * \file
+ *
+ * \ingroup  shared
+ *
+ * Atomic access helpers for the lock-free paths in the shared layer
+ */
+
+#ifndef OS_SHARED_ATOMIC_H
+#define OS_SHARED_ATOMIC_H
+
+#include "common_types.h"
+
+/*
+ * These map onto the GNU __atomic builtins, which GCC and Clang both
+ * provide.  There is no lock-based fallback; a compiler without them
+ * would silently lose the ordering the callers depend on, so refuse to
+ * build instead.
+ */
+#ifndef __ATOMIC_SEQ_CST
+#error "OSAL requires a compiler providing the GNU __atomic builtins"
+#endif
+
+/*
+ * Relaxed and acquire/release variants, for statistics counters and for
+ * publish/consume handoffs such as the console ring buffer records.
+ */
+#define OS_ATOMIC_LOAD_RELAXED(ptr)       __atomic_load_n(ptr, __ATOMIC_RELAXED)
+#define OS_ATOMIC_LOAD_ACQUIRE(ptr)       __atomic_load_n(ptr, __ATOMIC_ACQUIRE)
+#define OS_ATOMIC_STORE_RELEASE(ptr, val) __atomic_store_n(ptr, val, __ATOMIC_RELEASE)
+#define OS_ATOMIC_ADD_RELAXED(ptr, val)   __atomic_fetch_add(ptr, val, __ATOMIC_RELAXED)
+#define OS_ATOMIC_CAS_RELAXED(ptr, exp, want) \
+    __atomic_compare_exchange_n(ptr, exp, want, false, __ATOMIC_RELAXED, __ATOMIC_RELAXED)
+
+/*
+ * Sequentially consistent variants, for code that relies on a total order
+ * (e.g. the futex waiter accounting, or a seqlock style generation count).
+ */
+#define OS_ATOMIC_LOAD(ptr)           __atomic_load_n(ptr, __ATOMIC_SEQ_CST)
+#define OS_ATOMIC_CAS(ptr, exp, want) \
+    __atomic_compare_exchange_n(ptr, exp, want, false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST)
+#define OS_ATOMIC_ADD(ptr, val) __atomic_fetch_add(ptr, val, __ATOMIC_SEQ_CST)
+#define OS_ATOMIC_SUB(ptr, val) __atomic_fetch_sub(ptr, val, __ATOMIC_SEQ_CST)
+#define OS_ATOMIC_OR(ptr, val)  __atomic_fetch_or(ptr, val, __ATOMIC_SEQ_CST)
+#define OS_ATOMIC_FENCE()       __atomic_thread_fence(__ATOMIC_SEQ_CST)
+
+#endif /* OS_SHARED_ATOMIC_H */
@@ -38,19 +38,36 @@
 #include "os-shared-printf.h"
 #include "os-shared-globaldefs.h"
 
+/**
+ * Largest payload of one console record: the device name prefix plus one message
+ */
+#define OS_CONSOLE_MAX_RECORD (OS_MAX_API_NAME + OS_BUFFER_SIZE)
+
 /**
  * The generic console data record
+ *
+ * The buffer holds variable length records, each a 32-bit header followed
+ * by the text, padded to a multiple of 4 bytes.  Writers claim space by
+ * advancing ReservePos with compare-and-swap, copy their text in, and then
+ * publish the header with the commit flag set.  The output side (one at a
+ * time) copies out committed records in order, zeroes them, and advances
+ * ReadPos.  Both positions are running byte counts, so BufSize must be a
+ * power of two.
  */
 typedef struct
 {
     char device_name[OS_MAX_API_NAME];
 
-    char *          BufBase;        /**< Start of the buffer memory */
-    size_t          BufSize;        /**< Total size of the buffer */
-    volatile size_t ReadPos;        /**< Offset of next byte to read */
-    volatile size_t WritePos;       /**< Offset of next byte to write */
-    uint32          OverflowEvents; /**< Number of lines dropped due to overflow */
-    bool            IsAsync;        /**< Whether to write data via deferred utility task */
+    char * BufBase;          /**< Start of the buffer memory, 4-byte aligned */
+    uint32 BufSize;          /**< Total size of the buffer, a power of two */
+    uint32 ReservePos;       /**< Running count of bytes claimed by writers */
+    uint32 ReadPos;          /**< Running count of bytes released by the output side */
+    uint32 MessageCount;     /**< Number of lines accepted */
+    uint32 OverflowEvents;   /**< Number of lines dropped because the buffer was full */
+    uint32 ContentionEvents; /**< Number of lines dropped after losing every reservation attempt */
+    uint32 DroppedBytes;     /**< Total length of the dropped lines */
+    uint32 HighWaterMark;    /**< Largest number of buffer bytes in use */
+    bool   IsAsync;          /**< Whether to write data via deferred utility task */
 } OS_console_internal_record_t;
 
 extern OS_console_internal_record_t OS_console_table[OS_MAX_CONSOLES];
@@ -87,4 +104,19 @@ int32 OS_ConsoleCreate_Impl(const OS_object_token_t *token);
  ------------------------------------------------------------------*/
 void OS_ConsoleWakeup_Impl(const OS_object_token_t *token);
 
+/*----------------------------------------------------------------
+
+    Purpose: Copy committed console text out of the buffer
+
+   Copies the text of whole records, oldest first, into Buf until the
+   next record is not yet committed or would not fit, and releases their
+   space to writers.  BufSize must be at least OS_CONSOLE_MAX_RECORD.
+
+   Only one caller may consume from a console at a time; the
+   implementation serializes this with the BSP console lock.
+
+   Returns: Number of bytes copied to Buf, 0 if nothing was ready
+ ------------------------------------------------------------------*/
+size_t OS_ConsoleRead(const OS_object_token_t *token, char *Buf, size_t BufSize);
+
 #endif /* OS_SHARED_CONSOLE_H */
@@ -35,6 +35,8 @@ typedef struct
     uint8  socket_domain;
     uint8  socket_type;
     uint16 stream_state;
+    void * map_addr; /**< Address of the OS_FileMap() mapping, NULL if not mapped */
+    size_t map_size; /**< Size of the OS_FileMap() mapping */
 } OS_stream_internal_record_t;
 
 /*
@@ -96,6 +98,24 @@ int32 OS_GenericRead_Impl(const OS_object_token_t *token, void *buffer, size_t n
  ------------------------------------------------------------------*/
 int32 OS_GenericWrite_Impl(const OS_object_token_t *token, const void *buffer, size_t nbytes, int32 timeout);
 
+/*----------------------------------------------------------------
+
+    Purpose: Read from a file descriptor at the given offset,
+             without using or changing the file position
+
+    Returns: Number of bytes read (non-negative) on success, or relevant error code (negative)
+ ------------------------------------------------------------------*/
+int32 OS_GenericPread_Impl(const OS_object_token_t *token, void *buffer, size_t nbytes, size_t offset);
+
+/*----------------------------------------------------------------
+
+    Purpose: Write to a file descriptor at the given offset,
+             without using or changing the file position
+
+    Returns: Number of bytes written (non-negative) on success, or relevant error code (negative)
+ ------------------------------------------------------------------*/
+int32 OS_GenericPwrite_Impl(const OS_object_token_t *token, const void *buffer, size_t nbytes, size_t offset);
+
 /*----------------------------------------------------------------
 
     Purpose: Close a file descriptor
@@ -114,6 +134,50 @@ int32 OS_GenericClose_Impl(const OS_object_token_t *token);
  ------------------------------------------------------------------*/
 int32 OS_FileOpen_Impl(const OS_object_token_t *token, const char *local_path, int32 flags, int32 access_mode);
 
+/*----------------------------------------------------------------
+
+    Purpose: Maps "length" bytes of the file starting at "offset" into memory
+             for reading, and outputs the address of the first byte
+
+    Returns: OS_SUCCESS on success, or relevant error code
+ ------------------------------------------------------------------*/
+int32 OS_FileMap_Impl(const OS_object_token_t *token, size_t offset, size_t length, void **addr);
+
+/*----------------------------------------------------------------
+
+    Purpose: Removes a mapping made by OS_FileMap_Impl(), given the
+             address and length that were mapped
+
+    Returns: OS_SUCCESS on success, or relevant error code
+ ------------------------------------------------------------------*/
+int32 OS_FileUnmap_Impl(const OS_object_token_t *token, void *addr, size_t length);
+
+/*----------------------------------------------------------------
+
+    Purpose: Starts an asynchronous read/write/fsync on the file.  The request
+             has already been validated by the shared layer.
+
+             If the request is accepted, the implementation takes over the
+             reference held by "token" (see OS_ObjectIdTransferToken) and must
+             eventually pass it to OS_FileAsyncComplete().  Otherwise the token
+             must be left with the caller.
+
+    Returns: OS_SUCCESS if the request was accepted, or relevant error code
+ ------------------------------------------------------------------*/
+int32 OS_FileAsyncSubmit_Impl(OS_object_token_t *token, const OS_file_async_request_t *request,
+                              osal_id_t completion_queue);
+
+/*----------------------------------------------------------------
+
+    Purpose: Called by the implementation when an asynchronous request has
+             finished.  Releases the reference on the file handle, then posts
+             the completion to the queue.
+
+             "result" is the byte count transferred, or an OSAL error code.
+ ------------------------------------------------------------------*/
+void OS_FileAsyncComplete(OS_object_token_t *token, const OS_file_async_request_t *request,
+                          osal_id_t completion_queue, int32 result);
+
 /*----------------------------------------------------------------
 
     Purpose: Takes a shell command in and writes the output of that command to the specified file
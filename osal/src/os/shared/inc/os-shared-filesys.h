@@ -103,6 +103,38 @@ typedef struct
  */
 extern OS_filesys_internal_record_t OS_filesys_table[OS_MAX_FILE_SYSTEMS];
 
+/*
+ * A snapshot of one mounted virtual path prefix, as used for path translation
+ */
+typedef struct
+{
+    size_t virtual_len; /**< Length of virtual_mountpt, not including the terminator */
+    size_t system_len;  /**< Length of system_mountpt, not including the terminator */
+    bool   is_system;   /**< Whether the system side is also mounted */
+    char   virtual_mountpt[OS_MAX_PATH_LEN];
+    char   system_mountpt[OS_MAX_LOCAL_PATH_LEN];
+} OS_filesys_mount_entry_t;
+
+/*
+ * The mount point prefix table used by OS_TranslatePath()
+ *
+ * This is rebuilt from OS_filesys_table whenever a file system is mounted
+ * or unmounted, with entries ordered from the longest virtual prefix to the
+ * shortest so the first match is also the most specific one.
+ *
+ * Writers hold the filesys table lock and make the generation number odd
+ * while the entries are being changed.  Readers do not take the lock; they
+ * retry if the generation number was odd or changed during the lookup.
+ */
+typedef struct
+{
+    volatile uint32          generation;
+    uint32                   count;
+    OS_filesys_mount_entry_t entries[OS_MAX_FILE_SYSTEMS];
+} OS_filesys_mount_table_t;
+
+extern OS_filesys_mount_table_t OS_filesys_mount_table;
+
 /*
  * File system abstraction layer
  */
@@ -182,5 +214,7 @@ bool  OS_FileSys_FindVirtMountPoint(void *ref, const OS_object_token_t *token, c
 int32 OS_FileSys_Initialize(char *address, const char *fsdevname, const char *fsvolname, size_t blocksize,
                             osal_blockcount_t numblocks, bool should_format);
 bool  OS_FileSysFilterFree(void *ref, const OS_object_token_t *token, const OS_common_record_t *obj);
+void  OS_FileSys_RefreshMountTable(void);
+int32 OS_FileSys_FindMountEntry(const char *VirtualPath, OS_filesys_mount_entry_t *entry);
 
 #endif /* OS_SHARED_FILESYS_H */
@@ -57,7 +57,8 @@ typedef enum
     OS_FILESYS_BASE      = OS_MODULE_BASE + OS_MAX_MODULES,
     OS_CONSOLE_BASE      = OS_FILESYS_BASE + OS_MAX_FILE_SYSTEMS,
     OS_CONDVAR_BASE      = OS_CONSOLE_BASE + OS_MAX_CONSOLES,
-    OS_MAX_TOTAL_RECORDS = OS_CONDVAR_BASE + OS_MAX_CONDVARS
+    OS_POLLER_BASE       = OS_CONDVAR_BASE + OS_MAX_CONDVARS,
+    OS_MAX_TOTAL_RECORDS = OS_POLLER_BASE + OS_MAX_POLLERS
 } OS_ObjectIndex_t;
 
 /*
@@ -155,6 +156,7 @@ extern OS_common_record_t *const OS_global_module_table;
 extern OS_common_record_t *const OS_global_filesys_table;
 extern OS_common_record_t *const OS_global_console_table;
 extern OS_common_record_t *const OS_global_condvar_table;
+extern OS_common_record_t *const OS_global_poller_table;
 
 /****************************************************************************************
                                 ID MAPPING FUNCTIONS
@@ -425,6 +427,20 @@ int32 OS_ObjectIdGetById(OS_lock_mode_t lock_mode, osal_objtype_t idtype, osal_i
  ------------------------------------------------------------------*/
 void OS_ObjectIdRelease(OS_object_token_t *token);
 
+/*----------------------------------------------------------------
+
+    Purpose: Re-files an object in the name lookup index after its name
+             was changed in place outside of an exclusive transaction.
+             The global table lock for the object type must be held.
+
+             Objects are indexed automatically when an exclusive
+             transaction (create, delete, etc) finishes, so this is
+             only needed for other in-place renames.
+
+    Returns: none
+ ------------------------------------------------------------------*/
+void OS_ObjectIdNameIndexUpdate(const OS_object_token_t *token);
+
 /*----------------------------------------------------------------
 
     Purpose: Transfers ownership of an object token without unlocking/releasing.
@@ -532,5 +548,7 @@ bool  OS_ObjectFilterActive(void *ref, const OS_object_token_t *token, const OS_
 bool  OS_ObjectNameMatch(void *ref, const OS_object_token_t *token, const OS_common_record_t *obj);
 int32 OS_ObjectIdFindNextMatch(OS_ObjectMatchFunc_t MatchFunc, void *arg, OS_object_token_t *token);
 int32 OS_ObjectIdFindNextFree(OS_object_token_t *token);
+uint32 OS_ObjectNameHash(const char *name);
+int32  OS_ObjectIdFindNameIndex(const char *name, OS_object_token_t *token);
 
 #endif /* OS_SHARED_IDMAP_H */
@@ -0,0 +1,115 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * \file
+ *
+ * \ingroup  shared
+ *
+ */
+
+#ifndef OS_SHARED_POLLER_H
+#define OS_SHARED_POLLER_H
+
+#include "osapi-poller.h"
+#include "os-shared-globaldefs.h"
+
+typedef struct
+{
+    char     obj_name[OS_MAX_API_NAME];
+    OS_FdSet ReadSet;  /**< Streams watched for readability */
+    OS_FdSet WriteSet; /**< Streams watched for writability */
+} OS_poller_internal_record_t;
+
+/*
+ * These record types have extra information with each entry.  These tables are used
+ * to share extra data between the common layer and the OS-specific implementation.
+ */
+extern OS_poller_internal_record_t OS_poller_table[OS_MAX_POLLERS];
+
+/*---------------------------------------------------------------------------------------
+   Name: OS_PollerAPI_Init
+
+   Purpose: Initialize the OS-independent layer for poller objects
+
+   returns: OS_SUCCESS on success, or relevant error code
+---------------------------------------------------------------------------------------*/
+int32 OS_PollerAPI_Init(void);
+
+/*---------------------------------------------------------------------------------------
+   Name: OS_PollerStreamClose
+
+   Purpose: Removes a stream from all pollers it is a member of
+
+            Called while closing the stream, so its slot is not polled
+            on behalf of the next stream that reuses it.
+---------------------------------------------------------------------------------------*/
+void OS_PollerStreamClose(const OS_object_token_t *stream_token);
+
+/*----------------------------------------------------------------
+
+    Purpose: Prepare/allocate OS resources for a poller object
+
+    Returns: OS_SUCCESS on success, or relevant error code
+ ------------------------------------------------------------------*/
+int32 OS_PollerCreate_Impl(const OS_object_token_t *token, uint32 options);
+
+/*----------------------------------------------------------------
+
+    Purpose: Free the OS resources associated with a poller object
+
+    Returns: OS_SUCCESS on success, or relevant error code
+ ------------------------------------------------------------------*/
+int32 OS_PollerDelete_Impl(const OS_object_token_t *token);
+
+/*----------------------------------------------------------------
+
+    Purpose: Start watching a stream for the states in StateFlags
+
+             If IsMember is set, the stream is already watched by the poller
+             and only the states it is watched for change.
+
+    Returns: OS_SUCCESS on success, or relevant error code
+             OS_ERR_OPERATION_NOT_SUPPORTED if the stream cannot be polled
+ ------------------------------------------------------------------*/
+int32 OS_PollerAdd_Impl(const OS_object_token_t *token, const OS_object_token_t *stream_token, uint32 StateFlags,
+                        bool IsMember);
+
+/*----------------------------------------------------------------
+
+    Purpose: Stop watching a stream that is a member of the poller
+
+    Returns: OS_SUCCESS on success, or relevant error code
+ ------------------------------------------------------------------*/
+int32 OS_PollerRemove_Impl(const OS_object_token_t *token, const OS_object_token_t *stream_token);
+
+/*----------------------------------------------------------------
+
+    Purpose: Wait for member streams to become ready, up to "msecs"
+             (negative to wait forever, zero to poll)
+
+             Ready streams are written to "events", at most "max_events"
+             of them, and the count is written to "num_events"
+
+    Returns: OS_SUCCESS if any stream is ready
+             OS_ERROR_TIMEOUT if none became ready, or relevant error code
+ ------------------------------------------------------------------*/
+int32 OS_PollerWait_Impl(const OS_object_token_t *token, OS_poller_event_t *events, uint32 max_events,
+                         uint32 *num_events, int32 msecs);
+
+#endif /* OS_SHARED_POLLER_H */
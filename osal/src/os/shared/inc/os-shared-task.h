@@ -35,6 +35,7 @@ typedef struct
     char            task_name[OS_MAX_API_NAME];
     size_t          stack_size;
     osal_priority_t priority;
+    uint32          cpu_affinity;
     osal_task_entry entry_function_pointer;
     osal_task_entry delete_hook_pointer;
     void *          entry_arg;
@@ -142,6 +143,9 @@ osal_id_t OS_TaskGetId_Impl(void);
 
     Purpose: Obtain OS-specific information about a task
 
+             Called with a reference to the task held, but not the
+             global task table lock.
+
     Returns: OS_SUCCESS on success, or relevant error code
  ------------------------------------------------------------------*/
 int32 OS_TaskGetInfo_Impl(const OS_object_token_t *token, OS_task_prop_t *task_prop);
@@ -173,4 +177,22 @@ bool OS_TaskIdMatchSystemData_Impl(void *ref, const OS_object_token_t *token, co
  ------------------------------------------------------------------*/
 int32 OS_TaskValidateSystemData_Impl(const void *sysdata, size_t sysdata_size);
 
+/*----------------------------------------------------------------
+
+    Purpose: Queues a job on the task pool, starting the workers if this is
+             the first job.  job_func has already been checked by the shared layer.
+
+    Returns: OS_SUCCESS if the job was queued, or relevant error code
+ ------------------------------------------------------------------*/
+int32 OS_TaskPoolSubmit_Impl(OS_TaskPoolJob_t job_func, void *job_arg);
+
+/*----------------------------------------------------------------
+
+    Purpose: Fills in the task pool statistics.  The buffer has already been
+             zeroed by the shared layer.
+
+    Returns: OS_SUCCESS on success, or relevant error code
+ ------------------------------------------------------------------*/
+int32 OS_TaskPoolGetInfo_Impl(OS_task_pool_prop_t *pool_prop);
+
 #endif /* OS_SHARED_TASK_H */
@@ -38,11 +38,13 @@
  */
 #include "os-shared-file.h"
 #include "os-shared-idmap.h"
+#include "os-shared-poller.h"
 
 /*
  * Other OSAL public APIs used by this module
  */
 #include "osapi-filesys.h"
+#include "osapi-queue.h"
 #include "osapi-sockets.h"
 
 /*
@@ -160,13 +162,27 @@ int32 OS_OpenCreate(osal_id_t *filedes, const char *path, int32 flags, int32 acc
  *-----------------------------------------------------------------*/
 int32 OS_close(osal_id_t filedes)
 {
-    OS_object_token_t token;
-    int32             return_code;
+    OS_object_token_t            token;
+    OS_stream_internal_record_t *stream;
+    int32                        return_code;
 
     /* Make sure the file descriptor is legit before using it */
     return_code = OS_ObjectIdGetById(OS_LOCK_MODE_EXCLUSIVE, LOCAL_OBJID_TYPE, filedes, &token);
     if (return_code == OS_SUCCESS)
     {
+        stream = OS_OBJECT_TABLE_GET(OS_stream_table, token);
+
+        /* A mapping does not outlive the handle */
+        if (stream->map_addr != NULL)
+        {
+            OS_FileUnmap_Impl(&token, stream->map_addr, stream->map_size);
+            stream->map_addr = NULL;
+            stream->map_size = 0;
+        }
+
+        /* Pollers must not keep watching the slot once the stream is gone */
+        OS_PollerStreamClose(&token);
+
         return_code = OS_GenericClose_Impl(&token);
 
         /* Complete the operation via the common routine */
@@ -227,6 +243,214 @@ int32 OS_TimedWrite(osal_id_t filedes, const void *buffer, size_t nbytes, int32
     return return_code;
 }
 
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_pread(osal_id_t filedes, void *buffer, size_t nbytes, size_t offset)
+{
+    OS_object_token_t token;
+    int32             return_code;
+
+    /* Check Parameters */
+    OS_CHECK_POINTER(buffer);
+    OS_CHECK_SIZE(nbytes);
+
+    return_code = OS_ObjectIdGetById(OS_LOCK_MODE_REFCOUNT, LOCAL_OBJID_TYPE, filedes, &token);
+    if (return_code == OS_SUCCESS)
+    {
+        return_code = OS_GenericPread_Impl(&token, buffer, nbytes, offset);
+        OS_ObjectIdRelease(&token);
+    }
+
+    return return_code;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_pwrite(osal_id_t filedes, const void *buffer, size_t nbytes, size_t offset)
+{
+    OS_object_token_t token;
+    int32             return_code;
+
+    /* Check Parameters */
+    OS_CHECK_POINTER(buffer);
+    OS_CHECK_SIZE(nbytes);
+
+    return_code = OS_ObjectIdGetById(OS_LOCK_MODE_REFCOUNT, LOCAL_OBJID_TYPE, filedes, &token);
+    if (return_code == OS_SUCCESS)
+    {
+        return_code = OS_GenericPwrite_Impl(&token, buffer, nbytes, offset);
+        OS_ObjectIdRelease(&token);
+    }
+
+    return return_code;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_FileMap(osal_id_t filedes, size_t offset, size_t length, void **addr)
+{
+    OS_object_token_t            token;
+    OS_stream_internal_record_t *stream;
+    int32                        return_code;
+
+    /* Check Parameters */
+    OS_CHECK_POINTER(addr);
+    OS_CHECK_SIZE(length);
+
+    *addr = NULL;
+
+    return_code = OS_ObjectIdGetById(OS_LOCK_MODE_GLOBAL, LOCAL_OBJID_TYPE, filedes, &token);
+    if (return_code == OS_SUCCESS)
+    {
+        stream = OS_OBJECT_TABLE_GET(OS_stream_table, token);
+
+        if (stream->map_addr != NULL)
+        {
+            return_code = OS_ERR_INCORRECT_OBJ_STATE;
+        }
+        else
+        {
+            return_code = OS_FileMap_Impl(&token, offset, length, addr);
+            if (return_code == OS_SUCCESS)
+            {
+                stream->map_addr = *addr;
+                stream->map_size = length;
+            }
+            else
+            {
+                *addr = NULL;
+            }
+        }
+
+        OS_ObjectIdRelease(&token);
+    }
+
+    return return_code;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_FileUnmap(osal_id_t filedes)
+{
+    OS_object_token_t            token;
+    OS_stream_internal_record_t *stream;
+    int32                        return_code;
+
+    return_code = OS_ObjectIdGetById(OS_LOCK_MODE_GLOBAL, LOCAL_OBJID_TYPE, filedes, &token);
+    if (return_code == OS_SUCCESS)
+    {
+        stream = OS_OBJECT_TABLE_GET(OS_stream_table, token);
+
+        if (stream->map_addr == NULL)
+        {
+            return_code = OS_ERR_INCORRECT_OBJ_STATE;
+        }
+        else
+        {
+            return_code = OS_FileUnmap_Impl(&token, stream->map_addr, stream->map_size);
+            if (return_code == OS_SUCCESS)
+            {
+                stream->map_addr = NULL;
+                stream->map_size = 0;
+            }
+        }
+
+        OS_ObjectIdRelease(&token);
+    }
+
+    return return_code;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_FileAsyncSubmit(const OS_file_async_request_t *request, osal_id_t completion_queue)
+{
+    OS_object_token_t token;
+    int32             return_code;
+
+    /* Check Parameters */
+    OS_CHECK_POINTER(request);
+
+    switch (request->opcode)
+    {
+        case OS_FILE_ASYNC_READ:
+        case OS_FILE_ASYNC_WRITE:
+            OS_CHECK_POINTER(request->buffer);
+            OS_CHECK_SIZE(request->nbytes);
+            break;
+        case OS_FILE_ASYNC_FSYNC:
+            break;
+        default:
+            return OS_ERR_OPERATION_NOT_SUPPORTED;
+    }
+
+    /* The queue is only checked here; the completion is put by ID when the I/O finishes */
+    return_code = OS_ObjectIdGetById(OS_LOCK_MODE_NONE, OS_OBJECT_TYPE_OS_QUEUE, completion_queue, &token);
+    if (return_code != OS_SUCCESS)
+    {
+        return return_code;
+    }
+
+    return_code = OS_ObjectIdGetById(OS_LOCK_MODE_REFCOUNT, LOCAL_OBJID_TYPE, request->filedes, &token);
+    if (return_code == OS_SUCCESS)
+    {
+        return_code = OS_FileAsyncSubmit_Impl(&token, request, completion_queue);
+
+        /* no-op if the implementation took over the reference */
+        OS_ObjectIdRelease(&token);
+    }
+
+    return return_code;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void OS_FileAsyncComplete(OS_object_token_t *token, const OS_file_async_request_t *request,
+                          osal_id_t completion_queue, int32 result)
+{
+    OS_file_async_completion_t completion;
+    int32                      return_code;
+
+    /* Drop the reference first, so the handle can be closed as soon as the completion is seen */
+    OS_ObjectIdRelease(token);
+
+    memset(&completion, 0, sizeof(completion));
+    completion.user_arg = request->user_arg;
+    completion.filedes  = request->filedes;
+    completion.opcode   = request->opcode;
+    completion.result   = result;
+
+    return_code = OS_QueuePut(completion_queue, &completion, sizeof(completion), 0);
+    if (return_code != OS_SUCCESS)
+    {
+        OS_DEBUG("Completion of async file request lost, OS_QueuePut() returned %ld\n", (long)return_code);
+    }
+}
+
 /*----------------------------------------------------------------
  *
  *  Purpose: Implemented per public OSAL API
@@ -373,6 +597,7 @@ int32 OS_rename(const char *old, const char *new)
             {
                 strncpy(stream->stream_name, new, sizeof(stream->stream_name) - 1);
                 stream->stream_name[sizeof(stream->stream_name) - 1] = 0;
+                OS_ObjectIdNameIndexUpdate(&iter.token);
             }
         }
 
@@ -41,6 +41,7 @@
 #include "os-shared-filesys.h"
 #include "os-shared-idmap.h"
 #include "os-shared-common.h"
+#include "os-shared-atomic.h"
 
 enum
 {
@@ -48,11 +49,28 @@ enum
     LOCAL_OBJID_TYPE  = OS_OBJECT_TYPE_OS_FILESYS
 };
 
+/*
+ * Number of times a path lookup is retried without the table lock,
+ * if the mount table is changing, before falling back to taking the lock.
+ */
+#define OS_FILESYS_MOUNT_TABLE_RETRIES 4
+
+/*
+ * Ensures the mount table generation number is read/written in
+ * order with respect to the table contents.
+ */
+#define OS_FILESYS_MOUNT_TABLE_BARRIER() OS_ATOMIC_FENCE()
+
 /*
  * Internal filesystem state table entries
  */
 OS_filesys_internal_record_t OS_filesys_table[LOCAL_NUM_OBJECTS];
 
+/*
+ * Mount point prefix table used for path translation
+ */
+OS_filesys_mount_table_t OS_filesys_mount_table;
+
 /*
  * A string that should be the prefix of RAM disk volume names, which
  * provides a hint that the file system refers to a RAM disk.
@@ -120,6 +138,182 @@ bool OS_FileSys_FindVirtMountPoint(void *ref, const OS_object_token_t *token, co
     return (target[mplen] == '/' || target[mplen] == 0);
 }
 
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Rebuilds the mount point prefix table from the current state
+ *           of the filesys table.  Must be called after any change to the
+ *           mount state of a file system, without the table lock held.
+ *
+ *-----------------------------------------------------------------*/
+void OS_FileSys_RefreshMountTable(void)
+{
+    OS_object_iter_t              iter;
+    OS_filesys_internal_record_t *filesys;
+    OS_filesys_mount_entry_t      entries[LOCAL_NUM_OBJECTS];
+    OS_filesys_mount_entry_t *    entry;
+    uint32                        count;
+    uint32                        i;
+    size_t                        mplen;
+
+    count = 0;
+
+    if (OS_ObjectIdIterateActive(LOCAL_OBJID_TYPE, &iter) != OS_SUCCESS)
+    {
+        return;
+    }
+
+    while (OS_ObjectIdIteratorGetNext(&iter) && count < LOCAL_NUM_OBJECTS)
+    {
+        filesys = OS_OBJECT_TABLE_GET(OS_filesys_table, iter.token);
+
+        if ((filesys->flags & OS_FILESYS_FLAG_IS_MOUNTED_VIRTUAL) == 0)
+        {
+            continue;
+        }
+
+        mplen = OS_strnlen(filesys->virtual_mountpt, sizeof(filesys->virtual_mountpt));
+        if (mplen == 0 || mplen >= sizeof(filesys->virtual_mountpt))
+        {
+            continue;
+        }
+
+        /* keep the entries sorted by descending virtual prefix length */
+        i = count;
+        while (i > 0 && entries[i - 1].virtual_len < mplen)
+        {
+            entries[i] = entries[i - 1];
+            --i;
+        }
+
+        entry = &entries[i];
+        memset(entry, 0, sizeof(*entry));
+        entry->virtual_len = mplen;
+        memcpy(entry->virtual_mountpt, filesys->virtual_mountpt, mplen);
+
+        if ((filesys->flags & OS_FILESYS_FLAG_IS_MOUNTED_SYSTEM) != 0)
+        {
+            entry->system_len = OS_strnlen(filesys->system_mountpt, sizeof(filesys->system_mountpt));
+            if (entry->system_len < sizeof(entry->system_mountpt))
+            {
+                memcpy(entry->system_mountpt, filesys->system_mountpt, entry->system_len);
+                entry->is_system = true;
+            }
+        }
+
+        ++count;
+    }
+
+    /*
+     * Publish the new table.  The iterator holds the table lock so there is
+     * only ever one writer, but lookups may be running concurrently.
+     */
+    ++OS_filesys_mount_table.generation;
+    OS_FILESYS_MOUNT_TABLE_BARRIER();
+
+    memcpy(OS_filesys_mount_table.entries, entries, sizeof(entries[0]) * count);
+    OS_filesys_mount_table.count = count;
+
+    OS_FILESYS_MOUNT_TABLE_BARRIER();
+    ++OS_filesys_mount_table.generation;
+
+    OS_ObjectIdIteratorDestroy(&iter);
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Searches the mount point prefix table for the longest virtual
+ *           prefix matching the path, and copies it to the entry buffer.
+ *
+ *  Returns: OS_SUCCESS if found, OS_FS_ERR_PATH_INVALID otherwise
+ *
+ *-----------------------------------------------------------------*/
+static int32 OS_FileSys_SearchMountTable(const char *VirtualPath, OS_filesys_mount_entry_t *entry)
+{
+    const OS_filesys_mount_entry_t *candidate;
+    uint32                          count;
+    uint32                          i;
+
+    count = OS_filesys_mount_table.count;
+    if (count > LOCAL_NUM_OBJECTS)
+    {
+        /* table is being rewritten */
+        return OS_FS_ERR_PATH_INVALID;
+    }
+
+    for (i = 0; i < count; ++i)
+    {
+        candidate = &OS_filesys_mount_table.entries[i];
+
+        /*
+         * Same match rule as OS_FileSys_FindVirtMountPoint(), the prefix must
+         * end at a directory separator or at the end of the path.
+         */
+        if (candidate->virtual_len < sizeof(candidate->virtual_mountpt) &&
+            strncmp(VirtualPath, candidate->virtual_mountpt, candidate->virtual_len) == 0 &&
+            (VirtualPath[candidate->virtual_len] == '/' || VirtualPath[candidate->virtual_len] == 0))
+        {
+            *entry = *candidate;
+            return OS_SUCCESS;
+        }
+    }
+
+    return OS_FS_ERR_PATH_INVALID;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Finds the mount point that applies to a virtual path, normally
+ *           without locking the filesys table.
+ *
+ *  Returns: OS_SUCCESS if found, OS_FS_ERR_PATH_INVALID otherwise
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_FileSys_FindMountEntry(const char *VirtualPath, OS_filesys_mount_entry_t *entry)
+{
+    OS_object_token_t token;
+    int32             return_code;
+    uint32            generation;
+    uint32            attempts;
+
+    for (attempts = 0; attempts < OS_FILESYS_MOUNT_TABLE_RETRIES; ++attempts)
+    {
+        generation = OS_filesys_mount_table.generation;
+        OS_FILESYS_MOUNT_TABLE_BARRIER();
+
+        if ((generation & 1) == 0)
+        {
+            return_code = OS_FileSys_SearchMountTable(VirtualPath, entry);
+
+            OS_FILESYS_MOUNT_TABLE_BARRIER();
+            if (generation == OS_filesys_mount_table.generation)
+            {
+                return return_code;
+            }
+        }
+    }
+
+    /*
+     * The table kept changing, or the task rebuilding it was preempted part
+     * way through.  Holding the table lock excludes any writer, so waiting
+     * on it also avoids spinning on a lower priority task.
+     */
+    return_code = OS_ObjectIdTransactionInit(OS_LOCK_MODE_GLOBAL, LOCAL_OBJID_TYPE, &token);
+    if (return_code == OS_SUCCESS)
+    {
+        return_code = OS_FileSys_SearchMountTable(VirtualPath, entry);
+        OS_ObjectIdTransactionCancel(&token);
+    }
+    else
+    {
+        return_code = OS_FS_ERR_PATH_INVALID;
+    }
+
+    return return_code;
+}
+
 /*----------------------------------------------------------------
  *
  *  Purpose: Local helper routine, not part of OSAL API.
@@ -229,6 +423,7 @@ int32 OS_FileSysAPI_Init(void)
     int32 return_code = OS_SUCCESS;
 
     memset(OS_filesys_table, 0, sizeof(OS_filesys_table));
+    memset(&OS_filesys_mount_table, 0, sizeof(OS_filesys_mount_table));
 
     return return_code;
 }
@@ -311,6 +506,11 @@ int32 OS_FileSysAddFixedMap(osal_id_t *filesys_id, const char *phys_path, const
 
         /* Check result, finalize record, and unlock global table. */
         return_code = OS_ObjectIdFinalizeNew(return_code, &token, filesys_id);
+
+        if (return_code == OS_SUCCESS)
+        {
+            OS_FileSys_RefreshMountTable();
+        }
     }
 
     return return_code;
@@ -372,6 +572,11 @@ int32 OS_rmfs(const char *devname)
 
         /* Free the entry in the master table  */
         return_code = OS_ObjectIdFinalizeDelete(return_code, &token);
+
+        if (return_code == OS_SUCCESS)
+        {
+            OS_FileSys_RefreshMountTable();
+        }
     }
     else
     {
@@ -463,6 +668,11 @@ int32 OS_mount(const char *devname, const char *mountpoint)
         }
 
         OS_ObjectIdRelease(&token);
+
+        if (return_code == OS_SUCCESS)
+        {
+            OS_FileSys_RefreshMountTable();
+        }
     }
 
     if (return_code != OS_SUCCESS)
@@ -521,6 +731,11 @@ int32 OS_unmount(const char *mountpoint)
         }
 
         OS_ObjectIdRelease(&token);
+
+        if (return_code == OS_SUCCESS)
+        {
+            OS_FileSys_RefreshMountTable();
+        }
     }
 
     if (return_code != OS_SUCCESS)
@@ -674,13 +889,10 @@ int32 OS_GetFsInfo(os_fsinfo_t *filesys_info)
  *-----------------------------------------------------------------*/
 int32 OS_TranslatePath(const char *VirtualPath, char *LocalPath)
 {
-    OS_object_token_t             token;
-    int32                         return_code;
-    const char *                  name_ptr;
-    OS_filesys_internal_record_t *filesys;
-    size_t                        SysMountPointLen;
-    size_t                        VirtPathLen;
-    size_t                        VirtPathBegin;
+    OS_filesys_mount_entry_t mount;
+    int32                    return_code;
+    const char *             name_ptr;
+    size_t                   VirtPathLen;
 
     /*
     ** Check to see if the path pointers are NULL
@@ -712,9 +924,6 @@ int32 OS_TranslatePath(const char *VirtualPath, char *LocalPath)
         return OS_FS_ERR_NAME_TOO_LONG;
     }
 
-    SysMountPointLen = 0;
-    VirtPathBegin    = VirtPathLen;
-
     /*
     ** All valid Virtual paths must start with a '/' character
     */
@@ -723,53 +932,30 @@ int32 OS_TranslatePath(const char *VirtualPath, char *LocalPath)
         return OS_FS_ERR_PATH_INVALID;
     }
 
-    /* Get a reference lock, as a filesystem check could take some time. */
-    return_code = OS_ObjectIdGetBySearch(OS_LOCK_MODE_GLOBAL, LOCAL_OBJID_TYPE, OS_FileSys_FindVirtMountPoint,
-                                         (void *)VirtualPath, &token);
+    /*
+     * Find the longest mounted prefix of the path.  The lengths in the
+     * entry are already known, so no further scanning is needed below.
+     */
+    return_code = OS_FileSys_FindMountEntry(VirtualPath, &mount);
 
-    if (return_code != OS_SUCCESS)
-    {
-        return_code = OS_FS_ERR_PATH_INVALID;
-    }
-    else
+    if (return_code == OS_SUCCESS && !mount.is_system)
     {
-        filesys = OS_OBJECT_TABLE_GET(OS_filesys_table, token);
-
-        if ((filesys->flags & OS_FILESYS_FLAG_IS_MOUNTED_SYSTEM) != 0)
-        {
-            SysMountPointLen = OS_strnlen(filesys->system_mountpt, sizeof(filesys->system_mountpt));
-            VirtPathBegin    = OS_strnlen(filesys->virtual_mountpt, sizeof(filesys->virtual_mountpt));
-            if (SysMountPointLen < OS_MAX_LOCAL_PATH_LEN)
-            {
-                memcpy(LocalPath, filesys->system_mountpt, SysMountPointLen);
-            }
-        }
-        else
-        {
-            return_code = OS_ERR_INCORRECT_OBJ_STATE;
-        }
-
-        OS_ObjectIdRelease(&token);
+        return_code = OS_ERR_INCORRECT_OBJ_STATE;
     }
 
     if (return_code == OS_SUCCESS)
     {
-        if (VirtPathLen < VirtPathBegin)
+        /* the matched prefix is always part of the path */
+        VirtPathLen -= mount.virtual_len;
+        if ((mount.system_len + VirtPathLen) < OS_MAX_LOCAL_PATH_LEN)
         {
-            return_code = OS_FS_ERR_PATH_INVALID;
+            memcpy(LocalPath, mount.system_mountpt, mount.system_len);
+            memcpy(&LocalPath[mount.system_len], &VirtualPath[mount.virtual_len], VirtPathLen);
+            LocalPath[mount.system_len + VirtPathLen] = 0;
         }
         else
         {
-            VirtPathLen -= VirtPathBegin;
-            if ((SysMountPointLen + VirtPathLen) < OS_MAX_LOCAL_PATH_LEN)
-            {
-                memcpy(&LocalPath[SysMountPointLen], &VirtualPath[VirtPathBegin], VirtPathLen);
-                LocalPath[SysMountPointLen + VirtPathLen] = 0;
-            }
-            else
-            {
-                return_code = OS_FS_ERR_PATH_TOO_LONG;
-            }
+            return_code = OS_FS_ERR_PATH_TOO_LONG;
         }
     }
 
@@ -75,6 +75,25 @@ typedef struct
 /* Tables where the OS object information is stored */
 static OS_common_record_t OS_common_table[OS_MAX_TOTAL_RECORDS];
 
+/*
+ * Name lookup index
+ *
+ * This parallels OS_common_table, so each object type uses the same slice
+ * of entries as it does in the common table.  Within a slice, entry "n" serves
+ * both as the head of hash bucket "n" and as the chain link for record "n",
+ * so every type has one bucket per record.  Links are stored as the local
+ * index plus one, such that zero means the end of the chain.
+ */
+typedef struct
+{
+    uint32 bucket_head; /**< First record in the bucket with this index */
+    uint32 next;        /**< Next record in the same bucket as this record */
+    uint32 hash;        /**< Hash of the name this record was indexed under */
+    bool   linked;      /**< Whether this record is currently in a bucket */
+} OS_name_index_entry_t;
+
+static OS_name_index_entry_t OS_name_index[OS_MAX_TOTAL_RECORDS];
+
 typedef struct
 {
     /* Keep track of the last successfully-issued object ID of each type */
@@ -102,6 +121,7 @@ OS_common_record_t *const OS_global_module_table    = &OS_common_table[OS_MODULE
 OS_common_record_t *const OS_global_filesys_table   = &OS_common_table[OS_FILESYS_BASE];
 OS_common_record_t *const OS_global_console_table   = &OS_common_table[OS_CONSOLE_BASE];
 OS_common_record_t *const OS_global_condvar_table   = &OS_common_table[OS_CONDVAR_BASE];
+OS_common_record_t *const OS_global_poller_table    = &OS_common_table[OS_POLLER_BASE];
 
 /*
  *********************************************************************************
@@ -118,6 +138,7 @@ OS_common_record_t *const OS_global_condvar_table   = &OS_common_table[OS_CONDVA
 int32 OS_ObjectIdInit(void)
 {
     memset(OS_common_table, 0, sizeof(OS_common_table));
+    memset(OS_name_index, 0, sizeof(OS_name_index));
     memset(OS_objtype_state, 0, sizeof(OS_objtype_state));
     return OS_SUCCESS;
 }
@@ -157,6 +178,8 @@ uint32 OS_GetMaxForObjectType(osal_objtype_t idtype)
             return OS_MAX_CONSOLES;
         case OS_OBJECT_TYPE_OS_CONDVAR:
             return OS_MAX_CONDVARS;
+        case OS_OBJECT_TYPE_OS_POLLER:
+            return OS_MAX_POLLERS;
         default:
             return 0;
     }
@@ -197,6 +220,8 @@ uint32 OS_GetBaseForObjectType(osal_objtype_t idtype)
             return OS_CONSOLE_BASE;
         case OS_OBJECT_TYPE_OS_CONDVAR:
             return OS_CONDVAR_BASE;
+        case OS_OBJECT_TYPE_OS_POLLER:
+            return OS_POLLER_BASE;
         default:
             return 0;
     }
@@ -271,6 +296,160 @@ bool OS_ObjectNameMatch(void *ref, const OS_object_token_t *token, const OS_comm
     return (obj->name_entry != NULL && strcmp((const char *)ref, obj->name_entry) == 0);
 }
 
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Computes the 32-bit FNV-1a hash of an object name, which is
+ *           used to select its bucket in the name lookup index.
+ *
+ *  returns: hash value
+ *
+ *-----------------------------------------------------------------*/
+uint32 OS_ObjectNameHash(const char *name)
+{
+    uint32 hash;
+    size_t i;
+
+    hash = 2166136261U;
+    for (i = 0; i < OS_MAX_API_NAME && name[i] != 0; ++i)
+    {
+        hash ^= (uint8)name[i];
+        hash *= 16777619U;
+    }
+
+    return hash;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Removes the record referred to by the token from the name
+ *           lookup index, then re-adds it under the given name.  If the
+ *           name is NULL then the record is only removed.
+ *
+ *           The global table lock for the object type must be held.
+ *
+ *-----------------------------------------------------------------*/
+static void OS_ObjectIdNameIndexLink(const OS_object_token_t *token, const char *name)
+{
+    uint32                 base_idx;
+    uint32                 max_idx;
+    uint32                 local_idx;
+    uint32 *               link;
+    OS_name_index_entry_t *base;
+    OS_name_index_entry_t *entry;
+
+    max_idx = OS_GetMaxForObjectType(token->obj_type);
+    if (token->obj_idx >= max_idx)
+    {
+        return;
+    }
+
+    base_idx  = OS_GetBaseForObjectType(token->obj_type);
+    base      = &OS_name_index[base_idx];
+    local_idx = token->obj_idx;
+    entry     = &base[local_idx];
+
+    if (entry->linked)
+    {
+        link = &base[entry->hash % max_idx].bucket_head;
+        while (*link != 0)
+        {
+            if (*link == (local_idx + 1))
+            {
+                *link = entry->next;
+                break;
+            }
+            link = &base[*link - 1].next;
+        }
+
+        entry->next   = 0;
+        entry->linked = false;
+    }
+
+    if (name != NULL)
+    {
+        entry->hash                             = OS_ObjectNameHash(name);
+        entry->next                             = base[entry->hash % max_idx].bucket_head;
+        base[entry->hash % max_idx].bucket_head = local_idx + 1;
+        entry->linked                           = true;
+    }
+}
+
+/*----------------------------------------------------------------
+
+    Purpose: Helper routine, not part of OSAL public API.
+             See description in prototype
+ ------------------------------------------------------------------*/
+void OS_ObjectIdNameIndexUpdate(const OS_object_token_t *token)
+{
+    OS_common_record_t *record;
+    const char *        name;
+
+    if (token->obj_idx >= OS_GetMaxForObjectType(token->obj_type))
+    {
+        return;
+    }
+
+    record = OS_ObjectIdGlobalFromToken(token);
+    name   = NULL;
+
+    if (OS_ObjectIdDefined(record->active_id))
+    {
+        name = record->name_entry;
+    }
+
+    OS_ObjectIdNameIndexLink(token, name);
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Locate an existing object of the token type by name, using
+ *           the name lookup index rather than searching the whole table.
+ *           Matching index and object ID are stored in the token.
+ *
+ *           This is an internal function and no table locking is performed here.
+ *           Locking must be done by the calling function.
+ *
+ *  returns: OS_ERR_NAME_NOT_FOUND if not found, OS_SUCCESS if match is found
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_ObjectIdFindNameIndex(const char *name, OS_object_token_t *token)
+{
+    uint32                 max_idx;
+    uint32                 link;
+    OS_common_record_t *   record;
+    OS_name_index_entry_t *base;
+
+    token->obj_id = OS_OBJECT_ID_UNDEFINED;
+
+    max_idx = OS_GetMaxForObjectType(token->obj_type);
+    if (max_idx == 0)
+    {
+        return OS_ERR_NAME_NOT_FOUND;
+    }
+
+    base = &OS_name_index[OS_GetBaseForObjectType(token->obj_type)];
+    link = base[OS_ObjectNameHash(name) % max_idx].bucket_head;
+
+    while (link != 0)
+    {
+        token->obj_idx = OSAL_INDEX_C(link - 1);
+        record         = OS_ObjectIdGlobalFromToken(token);
+
+        if (OS_ObjectIdDefined(record->active_id) && OS_ObjectNameMatch((void *)name, token, record))
+        {
+            token->obj_id = record->active_id;
+            return OS_SUCCESS;
+        }
+
+        link = base[link - 1].next;
+    }
+
+    return OS_ERR_NAME_NOT_FOUND;
+}
+
 /*----------------------------------------------------------------
  *
  *  Purpose: Local helper routine, not part of OSAL API.
@@ -947,7 +1126,22 @@ int32 OS_ObjectIdGetBySearch(OS_lock_mode_t lock_mode, osal_objtype_t idtype, OS
  *-----------------------------------------------------------------*/
 int32 OS_ObjectIdGetByName(OS_lock_mode_t lock_mode, osal_objtype_t idtype, const char *name, OS_object_token_t *token)
 {
-    return OS_ObjectIdGetBySearch(lock_mode, idtype, OS_ObjectNameMatch, (void *)name, token);
+    int32 return_code;
+
+    OS_ObjectIdTransactionInit(lock_mode, idtype, token);
+
+    return_code = OS_ObjectIdFindNameIndex(name, token);
+
+    if (return_code == OS_SUCCESS)
+    {
+        return_code = OS_ObjectIdConvertToken(token);
+    }
+    else
+    {
+        OS_ObjectIdTransactionCancel(token);
+    }
+
+    return return_code;
 }
 
 /*----------------------------------------------------------------
@@ -1088,6 +1282,16 @@ void OS_ObjectIdTransactionFinish(OS_object_token_t *token, const osal_id_t *fin
         record->active_id = token->obj_id;
     }
 
+    /*
+     * Create, delete and other exclusive operations are the points
+     * where the name of an object may change, so refresh its entry
+     * in the name lookup index while the table is still locked.
+     */
+    if (final_id != NULL || token->lock_mode == OS_LOCK_MODE_EXCLUSIVE)
+    {
+        OS_ObjectIdNameIndexUpdate(token);
+    }
+
     /* always unlock (this also covers OS_LOCK_MODE_GLOBAL case) */
     OS_Unlock_Global(token);
 
@@ -1167,7 +1371,7 @@ int32 OS_ObjectIdAllocateNew(osal_objtype_t idtype, const char *name, OS_object_
      */
     if (name != NULL)
     {
-        return_code = OS_ObjectIdFindNextMatch(OS_ObjectNameMatch, (void *)name, token);
+        return_code = OS_ObjectIdFindNameIndex(name, token);
     }
     else
     {
@@ -1183,6 +1387,16 @@ int32 OS_ObjectIdAllocateNew(osal_objtype_t idtype, const char *name, OS_object_
         return_code = OS_ObjectIdFindNextFree(token);
     }
 
+    /*
+     * Index the new record under the requested name right away, so that
+     * a concurrent create with the same name will see it as soon as the
+     * caller fills in the name, before the create is finalized.
+     */
+    if (return_code == OS_SUCCESS)
+    {
+        OS_ObjectIdNameIndexLink(token, name);
+    }
+
     /* If allocation failed, abort the operation now - no ID was allocated.
      * After this point, if a future step fails, the allocated ID must be
      * released. */
@@ -0,0 +1,337 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * \file
+ * \ingroup  shared
+ *
+ *         This file  contains some of the OS APIs abstraction layer code
+ *         that is shared/common across all OS-specific implementations.
+ */
+
+/****************************************************************************************
+                                    INCLUDE FILES
+ ***************************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*
+ * User defined include files
+ */
+#include "os-shared-idmap.h"
+#include "os-shared-poller.h"
+
+/*
+ * Sanity checks on the user-supplied configuration
+ * The relevant OS_MAX limit should be defined and greater than zero
+ */
+#if !defined(OS_MAX_POLLERS) || (OS_MAX_POLLERS <= 0)
+#error "osconfig.h must define OS_MAX_POLLERS to a valid value"
+#endif
+
+OS_poller_internal_record_t OS_poller_table[OS_MAX_POLLERS];
+
+/****************************************************************************************
+                                  LOCAL FUNCTIONS
+ ***************************************************************************************/
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Sets or clears the membership bit of a stream in an OS_FdSet
+ *
+ *-----------------------------------------------------------------*/
+static void OS_PollerSetMember(OS_FdSet *Set, osal_index_t stream_idx, bool is_member)
+{
+    if (is_member)
+    {
+        Set->object_ids[stream_idx >> 3] |= 1 << (stream_idx & 0x7);
+    }
+    else
+    {
+        Set->object_ids[stream_idx >> 3] &= ~(1 << (stream_idx & 0x7));
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Checks the membership bit of a stream in an OS_FdSet
+ *
+ *-----------------------------------------------------------------*/
+static bool OS_PollerIsMember(const OS_FdSet *Set, osal_index_t stream_idx)
+{
+    return ((Set->object_ids[stream_idx >> 3] >> (stream_idx & 0x7)) & 0x1);
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Removes a stream that is being closed from every poller
+ *
+ *-----------------------------------------------------------------*/
+void OS_PollerStreamClose(const OS_object_token_t *stream_token)
+{
+    OS_object_iter_t             iter;
+    OS_poller_internal_record_t *poller;
+
+    OS_ObjectIdIterateActive(OS_OBJECT_TYPE_OS_POLLER, &iter);
+
+    while (OS_ObjectIdIteratorGetNext(&iter))
+    {
+        poller = OS_OBJECT_TABLE_GET(OS_poller_table, iter.token);
+
+        if (OS_PollerIsMember(&poller->ReadSet, stream_token->obj_idx) ||
+            OS_PollerIsMember(&poller->WriteSet, stream_token->obj_idx))
+        {
+            /*
+             * The stream is going away regardless, so the membership is
+             * dropped even if the implementation fails to deregister it.
+             * Otherwise a stream that later reuses this slot would be polled.
+             */
+            OS_PollerRemove_Impl(OS_ObjectIdIteratorRef(&iter), stream_token);
+
+            OS_PollerSetMember(&poller->ReadSet, stream_token->obj_idx, false);
+            OS_PollerSetMember(&poller->WriteSet, stream_token->obj_idx, false);
+        }
+    }
+
+    OS_ObjectIdIteratorDestroy(&iter);
+}
+
+/****************************************************************************************
+                                  POLLER API
+ ***************************************************************************************/
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Init function for OS-independent layer
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_PollerAPI_Init(void)
+{
+    memset(OS_poller_table, 0, sizeof(OS_poller_table));
+    return OS_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_PollerCreate(osal_id_t *poller_id, const char *poller_name, uint32 options)
+{
+    int32                        return_code;
+    OS_object_token_t            token;
+    OS_poller_internal_record_t *poller;
+
+    /* Check parameters */
+    OS_CHECK_POINTER(poller_id);
+    OS_CHECK_APINAME(poller_name);
+
+    /* Note - the common ObjectIdAllocate routine will lock the object type and leave it locked. */
+    return_code = OS_ObjectIdAllocateNew(OS_OBJECT_TYPE_OS_POLLER, poller_name, &token);
+    if (return_code == OS_SUCCESS)
+    {
+        poller = OS_OBJECT_TABLE_GET(OS_poller_table, token);
+
+        /* Reset the table entry and save the name */
+        OS_OBJECT_INIT(token, poller, obj_name, poller_name);
+
+        /* Now call the OS-specific implementation.  This reads info from the table. */
+        return_code = OS_PollerCreate_Impl(&token, options);
+
+        /* Check result, finalize record, and unlock global table. */
+        return_code = OS_ObjectIdFinalizeNew(return_code, &token, poller_id);
+    }
+
+    return return_code;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_PollerDelete(osal_id_t poller_id)
+{
+    OS_object_token_t token;
+    int32             return_code;
+
+    return_code = OS_ObjectIdGetById(OS_LOCK_MODE_EXCLUSIVE, OS_OBJECT_TYPE_OS_POLLER, poller_id, &token);
+    if (return_code == OS_SUCCESS)
+    {
+        return_code = OS_PollerDelete_Impl(&token);
+
+        /* Complete the operation via the common routine */
+        return_code = OS_ObjectIdFinalizeDelete(return_code, &token);
+    }
+
+    return return_code;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_PollerAdd(osal_id_t poller_id, osal_id_t objid, uint32 StateFlags)
+{
+    OS_object_token_t            token;
+    OS_object_token_t            stream_token;
+    OS_poller_internal_record_t *poller;
+    bool                         is_member;
+    int32                        return_code;
+
+    /* Check parameters */
+    ARGCHECK((StateFlags & (OS_STREAM_STATE_READABLE | OS_STREAM_STATE_WRITABLE)) != 0, OS_ERR_INVALID_ARGUMENT);
+
+    /* Hold a reference so the stream cannot be closed while it is being registered */
+    return_code = OS_ObjectIdGetById(OS_LOCK_MODE_REFCOUNT, OS_OBJECT_TYPE_OS_STREAM, objid, &stream_token);
+    if (return_code == OS_SUCCESS)
+    {
+        return_code = OS_ObjectIdGetById(OS_LOCK_MODE_GLOBAL, OS_OBJECT_TYPE_OS_POLLER, poller_id, &token);
+        if (return_code == OS_SUCCESS)
+        {
+            poller = OS_OBJECT_TABLE_GET(OS_poller_table, token);
+
+            /* Re-adding a member changes the states it is watched for */
+            is_member = OS_PollerIsMember(&poller->ReadSet, stream_token.obj_idx) ||
+                        OS_PollerIsMember(&poller->WriteSet, stream_token.obj_idx);
+
+            return_code = OS_PollerAdd_Impl(&token, &stream_token, StateFlags, is_member);
+            if (return_code == OS_SUCCESS)
+            {
+                OS_PollerSetMember(&poller->ReadSet, stream_token.obj_idx,
+                                   (StateFlags & OS_STREAM_STATE_READABLE) != 0);
+                OS_PollerSetMember(&poller->WriteSet, stream_token.obj_idx,
+                                   (StateFlags & OS_STREAM_STATE_WRITABLE) != 0);
+            }
+
+            OS_ObjectIdRelease(&token);
+        }
+
+        OS_ObjectIdRelease(&stream_token);
+    }
+
+    return return_code;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_PollerRemove(osal_id_t poller_id, osal_id_t objid)
+{
+    OS_object_token_t            token;
+    OS_object_token_t            stream_token;
+    OS_poller_internal_record_t *poller;
+    int32                        return_code;
+
+    return_code = OS_ObjectIdGetById(OS_LOCK_MODE_REFCOUNT, OS_OBJECT_TYPE_OS_STREAM, objid, &stream_token);
+    if (return_code == OS_SUCCESS)
+    {
+        return_code = OS_ObjectIdGetById(OS_LOCK_MODE_GLOBAL, OS_OBJECT_TYPE_OS_POLLER, poller_id, &token);
+        if (return_code == OS_SUCCESS)
+        {
+            poller = OS_OBJECT_TABLE_GET(OS_poller_table, token);
+
+            if (!OS_PollerIsMember(&poller->ReadSet, stream_token.obj_idx) &&
+                !OS_PollerIsMember(&poller->WriteSet, stream_token.obj_idx))
+            {
+                return_code = OS_ERR_INCORRECT_OBJ_STATE;
+            }
+            else
+            {
+                return_code = OS_PollerRemove_Impl(&token, &stream_token);
+            }
+
+            if (return_code == OS_SUCCESS)
+            {
+                OS_PollerSetMember(&poller->ReadSet, stream_token.obj_idx, false);
+                OS_PollerSetMember(&poller->WriteSet, stream_token.obj_idx, false);
+            }
+
+            OS_ObjectIdRelease(&token);
+        }
+
+        OS_ObjectIdRelease(&stream_token);
+    }
+
+    return return_code;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_PollerWait(osal_id_t poller_id, OS_poller_event_t *events, uint32 max_events, uint32 *num_events,
+                    int32 msecs)
+{
+    OS_object_token_t token;
+    int32             return_code;
+
+    /* Check parameters */
+    OS_CHECK_POINTER(events);
+    OS_CHECK_POINTER(num_events);
+    OS_CHECK_SIZE(max_events);
+
+    *num_events = 0;
+
+    /*
+     * The refcount prevents the poller from being deleted during the wait,
+     * while still allowing other tasks to add and remove members.
+     */
+    return_code = OS_ObjectIdGetById(OS_LOCK_MODE_REFCOUNT, OS_OBJECT_TYPE_OS_POLLER, poller_id, &token);
+    if (return_code == OS_SUCCESS)
+    {
+        return_code = OS_PollerWait_Impl(&token, events, max_events, num_events, msecs);
+
+        OS_ObjectIdRelease(&token);
+    }
+
+    return return_code;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_PollerGetIdByName(osal_id_t *poller_id, const char *poller_name)
+{
+    int32 return_code;
+
+    /* Check parameters */
+    OS_CHECK_POINTER(poller_id);
+    OS_CHECK_POINTER(poller_name);
+
+    return_code = OS_ObjectIdFindByName(OS_OBJECT_TYPE_OS_POLLER, poller_name, poller_id);
+
+    return return_code;
+}
@@ -50,6 +50,7 @@
 /*
  * User defined include files
  */
+#include "os-shared-atomic.h"
 #include "os-shared-common.h"
 #include "os-shared-idmap.h"
 #include "os-shared-printf.h"
@@ -64,8 +65,37 @@
 #define OS_CONSOLE_IS_ASYNC false
 #endif
 
-/* reserve buffer memory for the printf console device */
-static char OS_printf_buffer_mem[(sizeof(OS_PRINTF_CONSOLE_NAME) + OS_BUFFER_SIZE) * OS_BUFFER_MSG_DEPTH];
+/*
+ * Console buffer size: room for OS_BUFFER_MSG_DEPTH maximum-length lines plus
+ * their record headers, rounded up to a power of two as the ring requires.
+ */
+#define OS_CONSOLE_MIN_BUFFER_SIZE ((sizeof(OS_PRINTF_CONSOLE_NAME) + OS_BUFFER_SIZE + 4) * OS_BUFFER_MSG_DEPTH)
+
+#define OS_CONSOLE_P2_1(x)      ((x) | ((x) >> 1))
+#define OS_CONSOLE_P2_2(x)      (OS_CONSOLE_P2_1(x) | (OS_CONSOLE_P2_1(x) >> 2))
+#define OS_CONSOLE_P2_4(x)      (OS_CONSOLE_P2_2(x) | (OS_CONSOLE_P2_2(x) >> 4))
+#define OS_CONSOLE_P2_8(x)      (OS_CONSOLE_P2_4(x) | (OS_CONSOLE_P2_4(x) >> 8))
+#define OS_CONSOLE_P2_16(x)     (OS_CONSOLE_P2_8(x) | (OS_CONSOLE_P2_8(x) >> 16))
+#define OS_CONSOLE_BUFFER_SIZE  (OS_CONSOLE_P2_16(OS_CONSOLE_MIN_BUFFER_SIZE - 1) + 1)
+
+/*
+ * Record header layout: the commit flag plus the length of the text.
+ * A header of zero means the record has not been committed yet, which is
+ * why the output side zeroes the buffer space it releases.
+ */
+#define OS_CONSOLE_RECORD_COMMIT 0x80000000U
+#define OS_CONSOLE_RECORD_LENGTH 0x0000FFFFU
+#define OS_CONSOLE_RECORD_SPAN(len) (sizeof(uint32) + (((len) + 3U) & ~3U))
+
+/*
+ * A writer gives up and drops its line after losing this many reservation
+ * races in a row.  This bounds the time OS_printf() can spend under heavy
+ * contention; each lost race means another task made progress.
+ */
+#define OS_CONSOLE_RESERVE_ATTEMPTS 32
+
+/* reserve buffer memory for the printf console device (uint32 for header alignment) */
+static uint32 OS_printf_buffer_mem[OS_CONSOLE_BUFFER_SIZE / sizeof(uint32)];
 
 /* The global console state table */
 OS_console_internal_record_t OS_console_table[OS_MAX_CONSOLES];
@@ -103,7 +133,7 @@ int32 OS_ConsoleAPI_Init(void)
         /*
          * Initialize the ring buffer pointers
          */
-        console->BufBase = OS_printf_buffer_mem;
+        console->BufBase = (char *)OS_printf_buffer_mem;
         console->BufSize = sizeof(OS_printf_buffer_mem);
         console->IsAsync = OS_CONSOLE_IS_ASYNC;
 
@@ -130,53 +160,150 @@ int32 OS_ConsoleAPI_Init(void)
 /*----------------------------------------------------------------
  *
  *  Purpose: Local helper routine, not part of OSAL API.
- *    Write into the console ring buffer
+ *    Copy text into the console buffer at the given running position,
+ *    wrapping around the end of the buffer as needed
  *
- *    The NextWritePos is an input-output and contains the position
- *    in the ring buffer to start writing into.  This may or may not
- *    be the same as the value in the global.  It is only updated
- *    if the string is written in its entirety.
+ *-----------------------------------------------------------------*/
+static void OS_Console_CopyIn(OS_console_internal_record_t *console, uint32 Pos, const char *Str, size_t Len)
+{
+    size_t Offset;
+    size_t Chunk;
+
+    Offset = Pos & (console->BufSize - 1);
+    Chunk  = console->BufSize - Offset;
+    if (Chunk > Len)
+    {
+        Chunk = Len;
+    }
+
+    memcpy(&console->BufBase[Offset], Str, Chunk);
+    memcpy(console->BufBase, Str + Chunk, Len - Chunk);
+}
+
+/*----------------------------------------------------------------
  *
- *    The intent is to avoid truncating a string if it does not fit.
- *    Either the entire string should be written, or none of it.
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *    Copy text out of the console buffer at the given running position,
+ *    and zero the source so that it reads as uncommitted when reused
  *
  *-----------------------------------------------------------------*/
-static int32 OS_Console_CopyOut(OS_console_internal_record_t *console, const char *Str, size_t *NextWritePos)
+static void OS_Console_CopyOut(OS_console_internal_record_t *console, uint32 Pos, char *Dest, size_t Len,
+                               size_t Span)
 {
-    const char *pmsg;
-    size_t      WriteOffset;
-    int32       return_code;
+    size_t Offset;
+    size_t Chunk;
 
-    return_code = OS_ERROR;
-    pmsg        = Str;
-    WriteOffset = *NextWritePos;
-    while (true)
+    Offset = Pos & (console->BufSize - 1);
+    Chunk  = console->BufSize - Offset;
+    if (Chunk > Len)
+    {
+        Chunk = Len;
+    }
+
+    memcpy(Dest, &console->BufBase[Offset], Chunk);
+    memcpy(Dest + Chunk, console->BufBase, Len - Chunk);
+
+    Chunk = console->BufSize - Offset;
+    if (Chunk > Span)
     {
-        if (*pmsg == 0)
+        Chunk = Span;
+    }
+
+    memset(&console->BufBase[Offset], 0, Chunk);
+    memset(console->BufBase, 0, Span - Chunk);
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *    Claim Span bytes of buffer space for a new record
+ *
+ *    This never blocks.  On success the start position is output in
+ *    *Pos.  Otherwise the line is counted as dropped, either because
+ *    the buffer is full (OS_QUEUE_FULL) or because every attempt lost
+ *    the race against other writers (OS_ERROR).
+ *
+ *-----------------------------------------------------------------*/
+static int32 OS_Console_Reserve(OS_console_internal_record_t *console, uint32 Span, uint32 *Pos)
+{
+    uint32 Reserve;
+    uint32 InUse;
+    uint32 HighWater;
+    uint32 Attempt;
+
+    Reserve = OS_ATOMIC_LOAD_RELAXED(&console->ReservePos);
+    for (Attempt = 0; Attempt < OS_CONSOLE_RESERVE_ATTEMPTS; ++Attempt)
+    {
+        /* acquire pairs with the release of ReadPos, so the zeroed space is seen */
+        InUse = Reserve - OS_ATOMIC_LOAD_ACQUIRE(&console->ReadPos) + Span;
+        if (InUse > console->BufSize)
         {
-            /* String is complete */
-            *NextWritePos = WriteOffset;
-            return_code   = OS_SUCCESS;
-            break;
+            OS_ATOMIC_ADD_RELAXED(&console->OverflowEvents, 1);
+            return OS_QUEUE_FULL;
         }
-        console->BufBase[WriteOffset] = *pmsg;
-        WriteOffset                   = WriteOffset + 1;
-        if (WriteOffset >= console->BufSize)
+
+        /* on failure this reloads Reserve with the current value */
+        if (OS_ATOMIC_CAS_RELAXED(&console->ReservePos, &Reserve, Reserve + Span))
         {
-            WriteOffset = 0;
+            HighWater = OS_ATOMIC_LOAD_RELAXED(&console->HighWaterMark);
+            while (InUse > HighWater && !OS_ATOMIC_CAS_RELAXED(&console->HighWaterMark, &HighWater, InUse))
+            {
+                /* retry only while this is still the larger value */
+            }
+
+            *Pos = Reserve;
+            return OS_SUCCESS;
         }
+    }
 
-        if (WriteOffset == console->ReadPos)
+    OS_ATOMIC_ADD_RELAXED(&console->ContentionEvents, 1);
+    return OS_ERROR;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+size_t OS_ConsoleRead(const OS_object_token_t *token, char *Buf, size_t BufSize)
+{
+    OS_console_internal_record_t *console;
+    uint32                        Pos;
+    uint32                        Header;
+    uint32                        Len;
+    size_t                        Total;
+
+    console = OS_OBJECT_TABLE_GET(OS_console_table, *token);
+    Pos     = console->ReadPos;
+    Total   = 0;
+
+    while (true)
+    {
+        Header = OS_ATOMIC_LOAD_ACQUIRE((uint32 *)&console->BufBase[Pos & (console->BufSize - 1)]);
+        if ((Header & OS_CONSOLE_RECORD_COMMIT) == 0)
+        {
+            /* empty, or the next writer has not finished yet */
+            break;
+        }
+
+        Len = Header & OS_CONSOLE_RECORD_LENGTH;
+        if ((Total + Len) > BufSize)
         {
-            /* out of space */
-            return_code = OS_QUEUE_FULL;
             break;
         }
 
-        ++pmsg;
+        OS_Console_CopyOut(console, Pos + sizeof(uint32), &Buf[Total], Len, OS_CONSOLE_RECORD_SPAN(Len) - sizeof(uint32));
+        *(uint32 *)&console->BufBase[Pos & (console->BufSize - 1)] = 0;
+
+        Total += Len;
+        Pos += OS_CONSOLE_RECORD_SPAN(Len);
     }
 
-    return return_code;
+    /* hand the zeroed space back to writers */
+    OS_ATOMIC_STORE_RELEASE(&console->ReadPos, Pos);
+
+    return Total;
 }
 
 /*
@@ -196,46 +323,50 @@ int32 OS_ConsoleWrite(osal_id_t console_id, const char *Str)
     int32                         return_code;
     OS_object_token_t             token;
     OS_console_internal_record_t *console;
-    size_t                        PendingWritePos;
+    size_t                        NameLen;
+    size_t                        MsgLen;
+    uint32                        Pos;
 
-    return_code = OS_ObjectIdGetById(OS_LOCK_MODE_GLOBAL, OS_OBJECT_TYPE_OS_CONSOLE, console_id, &token);
+    /*
+     * No lock is taken here: the console is never deleted, and writers
+     * coordinate through the reservation in the buffer itself.
+     */
+    return_code = OS_ObjectIdGetById(OS_LOCK_MODE_NONE, OS_OBJECT_TYPE_OS_CONSOLE, console_id, &token);
     if (return_code == OS_SUCCESS)
     {
         console = OS_OBJECT_TABLE_GET(OS_console_table, token);
 
+        NameLen = OS_strnlen(console->device_name, sizeof(console->device_name));
+        MsgLen  = OS_strnlen(Str, OS_BUFFER_SIZE);
+
         /*
-         * The entire string should be put to the ring buffer,
-         * or none of it.  Therefore the WritePos in the table
-         * is not updated until complete success.
+         * The entire string should be put to the buffer, or none of it.
          */
-        PendingWritePos = console->WritePos;
-
-        if (console->device_name[0] != 0)
-        {
-            return_code = OS_Console_CopyOut(console, console->device_name, &PendingWritePos);
-        }
+        return_code = OS_Console_Reserve(console, OS_CONSOLE_RECORD_SPAN(NameLen + MsgLen), &Pos);
         if (return_code == OS_SUCCESS)
         {
-            return_code = OS_Console_CopyOut(console, Str, &PendingWritePos);
-        }
+            OS_Console_CopyIn(console, Pos + sizeof(uint32), console->device_name, NameLen);
+            OS_Console_CopyIn(console, Pos + sizeof(uint32) + NameLen, Str, MsgLen);
 
-        if (return_code == OS_SUCCESS)
-        {
-            /* the entire message was successfully written */
-            console->WritePos = PendingWritePos;
+            /* publish the record; the text must be visible before the commit flag */
+            OS_ATOMIC_STORE_RELEASE((uint32 *)&console->BufBase[Pos & (console->BufSize - 1)],
+                                    OS_CONSOLE_RECORD_COMMIT | (uint32)(NameLen + MsgLen));
+
+            OS_ATOMIC_ADD_RELAXED(&console->MessageCount, 1);
         }
         else
         {
             /* the message did not fit */
-            ++console->OverflowEvents;
+            OS_ATOMIC_ADD_RELAXED(&console->DroppedBytes, (uint32)(NameLen + MsgLen));
         }
 
         /*
          * Notify the underlying console implementation of new data.
          * This will forward the data to the actual console device.
          *
-         * This is done while still locked, so it can support
-         * either a synchronous or asynchronous implementation.
+         * In async mode this only wakes the utility task, so the caller
+         * never waits for the device.  In sync mode the output side is
+         * serialized by the BSP console lock.
          */
         if (console->IsAsync)
         {
@@ -247,8 +378,39 @@ int32 OS_ConsoleWrite(osal_id_t console_id, const char *Str)
             /* output directly */
             OS_ConsoleOutput_Impl(&token);
         }
+    }
+
+    return return_code;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_printf_GetStats(OS_printf_stats_t *stats)
+{
+    int32                         return_code;
+    OS_object_token_t             token;
+    OS_console_internal_record_t *console;
+
+    /* Check parameters */
+    OS_CHECK_POINTER(stats);
+
+    return_code =
+        OS_ObjectIdGetById(OS_LOCK_MODE_NONE, OS_OBJECT_TYPE_OS_CONSOLE, OS_SharedGlobalVars.PrintfConsoleId, &token);
+    if (return_code == OS_SUCCESS)
+    {
+        console = OS_OBJECT_TABLE_GET(OS_console_table, token);
 
-        OS_ObjectIdRelease(&token);
+        memset(stats, 0, sizeof(*stats));
+        stats->MessageCount     = OS_ATOMIC_LOAD_RELAXED(&console->MessageCount);
+        stats->OverflowEvents   = OS_ATOMIC_LOAD_RELAXED(&console->OverflowEvents);
+        stats->ContentionEvents = OS_ATOMIC_LOAD_RELAXED(&console->ContentionEvents);
+        stats->DroppedBytes     = OS_ATOMIC_LOAD_RELAXED(&console->DroppedBytes);
+        stats->HighWaterMark    = OS_ATOMIC_LOAD_RELAXED(&console->HighWaterMark);
+        stats->BufferSize       = console->BufSize;
     }
 
     return return_code;
@@ -177,6 +177,8 @@ int32 OS_TaskCreate(osal_id_t *task_id, const char *task_name, osal_task_entry f
     OS_CHECK_POINTER(function_pointer);
     OS_CHECK_APINAME(task_name);
     OS_CHECK_SIZE(stack_size);
+    ARGCHECK((flags & (OS_TASK_SCHED_RR | OS_TASK_SCHED_FIFO)) != (OS_TASK_SCHED_RR | OS_TASK_SCHED_FIFO),
+             OS_ERR_INVALID_ARGUMENT);
 
     /* Note - the common ObjectIdAllocate routine will lock the object type and leave it locked. */
     return_code = OS_ObjectIdAllocateNew(LOCAL_OBJID_TYPE, task_name, &token);
@@ -189,6 +191,7 @@ int32 OS_TaskCreate(osal_id_t *task_id, const char *task_name, osal_task_entry f
 
         task->stack_size             = stack_size;
         task->priority               = priority;
+        task->cpu_affinity           = OS_TASK_CPU_AFFINITY_GET(flags);
         task->entry_function_pointer = function_pointer;
         task->stack_pointer          = stack_pointer;
 
@@ -377,13 +380,26 @@ int32 OS_TaskGetInfo(osal_id_t task_id, OS_task_prop_t *task_prop)
             strncpy(task_prop->name, record->name_entry, sizeof(task_prop->name) - 1);
             task_prop->name[sizeof(task_prop->name) - 1] = 0;
         }
-        task_prop->creator    = record->creator;
-        task_prop->stack_size = task->stack_size;
-        task_prop->priority   = task->priority;
-
-        return_code = OS_TaskGetInfo_Impl(&token, task_prop);
+        task_prop->creator      = record->creator;
+        task_prop->stack_size   = task->stack_size;
+        task_prop->priority     = task->priority;
+        task_prop->cpu_affinity = task->cpu_affinity;
 
         OS_ObjectIdRelease(&token);
+
+        /*
+         * The implementation may sample statistics from the OS, which can be slow
+         * (e.g. reading files under /proc).  Only a reference is held while it
+         * does so, which keeps the task from being deleted without blocking
+         * other task operations behind the global lock.
+         */
+        return_code = OS_ObjectIdGetById(OS_LOCK_MODE_REFCOUNT, LOCAL_OBJID_TYPE, task_id, &token);
+        if (return_code == OS_SUCCESS)
+        {
+            return_code = OS_TaskGetInfo_Impl(&token, task_prop);
+
+            OS_ObjectIdRelease(&token);
+        }
     }
 
     return return_code;
@@ -451,3 +467,33 @@ int32 OS_TaskFindIdBySystemData(osal_id_t *task_id, const void *sysdata, size_t
 
     return return_code;
 }
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_TaskPoolSubmit(OS_TaskPoolJob_t job_func, void *job_arg)
+{
+    /* Check parameters */
+    OS_CHECK_POINTER(job_func);
+
+    return OS_TaskPoolSubmit_Impl(job_func, job_arg);
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_TaskPoolGetInfo(OS_task_pool_prop_t *pool_prop)
+{
+    /* Check parameters */
+    OS_CHECK_POINTER(pool_prop);
+
+    memset(pool_prop, 0, sizeof(*pool_prop));
+
+    return OS_TaskPoolGetInfo_Impl(pool_prop);
+}
@@ -33,6 +33,7 @@ void TestCreatRemove(void);
 void TestOpenClose(void);
 void TestChmod(void);
 void TestReadWriteLseek(void);
+void TestPositionedIO(void);
 void TestMkRmDirFreeBytes(void);
 void TestOpenReadCloseDir(void);
 void TestRename(void);
@@ -79,6 +80,7 @@ void UtTest_Setup(void)
     UtTest_Add(TestOpenClose, NULL, NULL, "TestOpenClose");
     UtTest_Add(TestChmod, NULL, NULL, "TestChmod");
     UtTest_Add(TestReadWriteLseek, NULL, NULL, "TestReadWriteLseek");
+    UtTest_Add(TestPositionedIO, NULL, NULL, "TestPositionedIO");
     UtTest_Add(TestMkRmDirFreeBytes, NULL, NULL, "TestMkRmDirFreeBytes");
     UtTest_Add(TestOpenReadCloseDir, NULL, NULL, "TestOpenReadCloseDir");
     UtTest_Add(TestStat, NULL, NULL, "TestStat");
@@ -434,6 +436,80 @@ void TestReadWriteLseek(void)
     UtAssert_True(status == OS_SUCCESS, "status after remove = %d", (int)status);
 }
 
+/*---------------------------------------------------------------------------------------
+ *  Name TestPositionedIO()
+---------------------------------------------------------------------------------------*/
+void TestPositionedIO(void)
+{
+    char      filename[OS_MAX_PATH_LEN];
+    char      buffer[30];
+    char      readbuffer[30];
+    size_t    size;
+    void *    addr;
+    int32     status;
+    osal_id_t fd = OS_OBJECT_ID_UNDEFINED;
+
+    strncpy(filename, "/drive0/Filename1", sizeof(filename) - 1);
+    filename[sizeof(filename) - 1] = 0;
+
+    strcpy(buffer, "ValueToWriteInTheFile");
+    size = strlen(buffer) + 1;
+
+    status = OS_OpenCreate(&fd, filename, OS_FILE_FLAG_CREATE | OS_FILE_FLAG_TRUNCATE, OS_READ_WRITE);
+    UtAssert_True(status >= OS_SUCCESS, "status after creat = %d", (int)status);
+
+    /* Write the tail first, then the head, without ever seeking */
+    UtAssert_INT32_EQ(OS_pwrite(fd, &buffer[12], size - 12, 12), size - 12);
+    UtAssert_INT32_EQ(OS_pwrite(fd, buffer, 12, 0), 12);
+
+    /* Positioned I/O leaves the file pointer alone */
+    UtAssert_INT32_EQ(OS_lseek(fd, 0, OS_SEEK_CUR), 0);
+
+    memset(readbuffer, 0, sizeof(readbuffer));
+    UtAssert_INT32_EQ(OS_pread(fd, readbuffer, size, 0), size);
+    UtAssert_STRINGBUF_EQ(readbuffer, sizeof(readbuffer), buffer, sizeof(buffer));
+
+    memset(readbuffer, 0, sizeof(readbuffer));
+    UtAssert_INT32_EQ(OS_pread(fd, readbuffer, size - 12, 12), size - 12);
+    UtAssert_STRINGBUF_EQ(readbuffer, sizeof(readbuffer), &buffer[12], sizeof(buffer) - 12);
+
+    /* Reading at EOF returns no data */
+    UtAssert_INT32_EQ(OS_pread(fd, readbuffer, size, size), 0);
+
+    /* Mapping is optional; where supported the content must match */
+    status = OS_FileMap(fd, 12, size - 12, &addr);
+    if (status == OS_ERR_NOT_IMPLEMENTED)
+    {
+        UtAssert_NA("OS_FileMap not implemented");
+    }
+    else
+    {
+        UtAssert_INT32_EQ(status, OS_SUCCESS);
+        UtAssert_NOT_NULL(addr);
+        if (addr != NULL)
+        {
+            UtAssert_MemCmp(addr, &buffer[12], size - 12, "Mapped content matches");
+        }
+
+        UtAssert_INT32_EQ(OS_FileMap(fd, 0, size, &addr), OS_ERR_INCORRECT_OBJ_STATE);
+        UtAssert_INT32_EQ(OS_FileUnmap(fd), OS_SUCCESS);
+        UtAssert_INT32_EQ(OS_FileUnmap(fd), OS_ERR_INCORRECT_OBJ_STATE);
+
+        /* Beyond end of file */
+        UtAssert_INT32_EQ(OS_FileMap(fd, 0, size + 1, &addr), OS_ERR_INVALID_SIZE);
+
+        /* A mapping still in place is released by close */
+        UtAssert_INT32_EQ(OS_FileMap(fd, 0, size, &addr), OS_SUCCESS);
+    }
+
+    UtAssert_INT32_EQ(OS_close(fd), OS_SUCCESS);
+
+    UtAssert_INT32_EQ(OS_pread(fd, readbuffer, size, 0), OS_ERR_INVALID_ID);
+    UtAssert_INT32_EQ(OS_FileUnmap(fd), OS_ERR_INVALID_ID);
+
+    UtAssert_INT32_EQ(OS_remove(filename), OS_SUCCESS);
+}
+
 /*---------------------------------------------------------------------------------------
  *  Name TestMkRmDir()
 ---------------------------------------------------------------------------------------*/
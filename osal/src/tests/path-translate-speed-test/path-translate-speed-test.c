@@ -0,0 +1,278 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/*
+** Path Translation Speed Test
+**
+** This gauges the cost of OS_TranslatePath(), which is called
+** on every file open, stat, remove, directory open, etc.
+**
+** A number of fixed mappings are registered, including nested
+** ones, and paths under each of them are translated in a loop
+** for a fixed time.  This is done first from a single task and
+** then from several tasks at once, to show how well lookups
+** scale when many tasks are doing file I/O.  The results are
+** reported as translations per second; higher numbers indicate
+** better performance.
+**
+*/
+#include <stdio.h>
+#include <string.h>
+#include "common_types.h"
+#include "osapi.h"
+#include "utassert.h"
+#include "uttest.h"
+#include "utbsp.h"
+
+/*
+ * Note the worker priority must be lower than that of
+ * the executive (init) task, so it can stop the test.
+ */
+#define PATHTEST_TASK_PRIORITY 150
+
+/* Duration of each throughput run */
+#define PATHTEST_RUN_MSEC 1000
+
+/* Number of fixed mappings to register, half of which are nested */
+#define PATHTEST_NUM_MOUNTS 6
+
+/* Number of concurrent translating tasks */
+#define PATHTEST_NUM_TASKS 4
+
+/* How many translations to do between checks of the clock/stop flag */
+#define PATHTEST_BATCH 256
+
+osal_id_t mount_ids[PATHTEST_NUM_MOUNTS];
+uint32    num_mounts;
+
+char test_paths[PATHTEST_NUM_MOUNTS][OS_MAX_PATH_LEN];
+
+volatile bool start_request;
+volatile bool stop_request;
+osal_id_t     task_ids[PATHTEST_NUM_TASKS];
+uint32        task_work[PATHTEST_NUM_TASKS];
+int32         task_status[PATHTEST_NUM_TASKS];
+
+/*
+ * Translate each test path in turn, "count" times in total.
+ */
+int32 TranslateBatch(uint32 count)
+{
+    char   local_path[OS_MAX_LOCAL_PATH_LEN];
+    int32  status;
+    uint32 i;
+
+    status = OS_SUCCESS;
+    for (i = 0; i < count && status == OS_SUCCESS; ++i)
+    {
+        status = OS_TranslatePath(test_paths[i % num_mounts], local_path);
+    }
+
+    return status;
+}
+
+void translate_task(void)
+{
+    osal_id_t self_id;
+    uint32    idx;
+
+    /* wait for all tasks to be created, so the IDs are known */
+    while (!start_request)
+    {
+        OS_TaskDelay(1);
+    }
+
+    self_id = OS_TaskGetId();
+    for (idx = 0; idx < PATHTEST_NUM_TASKS; ++idx)
+    {
+        if (OS_ObjectIdEqual(self_id, task_ids[idx]))
+        {
+            break;
+        }
+    }
+
+    if (idx >= PATHTEST_NUM_TASKS)
+    {
+        return;
+    }
+
+    while (!stop_request && task_status[idx] == OS_SUCCESS)
+    {
+        task_status[idx] = TranslateBatch(PATHTEST_BATCH);
+        task_work[idx] += PATHTEST_BATCH;
+    }
+}
+
+void PathSetup(void)
+{
+    char   phys_path[OS_MAX_LOCAL_PATH_LEN];
+    char   virt_path[OS_MAX_PATH_LEN];
+    int32  status;
+    uint32 i;
+
+    num_mounts    = 0;
+    start_request = false;
+    stop_request  = false;
+    memset(task_work, 0, sizeof(task_work));
+    memset(task_status, 0, sizeof(task_status));
+
+    for (i = 0; i < PATHTEST_NUM_MOUNTS; ++i)
+    {
+        snprintf(phys_path, sizeof(phys_path), "./ptest%u", (unsigned int)i);
+
+        /* Every odd mount is nested under the one before it */
+        if ((i & 1) == 0)
+        {
+            snprintf(virt_path, sizeof(virt_path), "/ptest%u", (unsigned int)i);
+        }
+        else
+        {
+            snprintf(virt_path, sizeof(virt_path), "/ptest%u/nested", (unsigned int)(i - 1));
+        }
+
+        status = OS_FileSysAddFixedMap(&mount_ids[i], phys_path, virt_path);
+        if (status != OS_SUCCESS)
+        {
+            /* may have run out of file system slots, just use what is there */
+            UtPrintf("Mapping %s -> %s failed: %d\n", virt_path, phys_path, (int)status);
+            break;
+        }
+
+        snprintf(test_paths[i], sizeof(test_paths[i]), "%s/data/file%u.dat", virt_path, (unsigned int)i);
+        ++num_mounts;
+    }
+
+    UtAssert_True(num_mounts > 0, "Mounted %u file systems", (unsigned int)num_mounts);
+}
+
+void PathTeardown(void)
+{
+    char   dev_name[OS_MAX_API_NAME];
+    uint32 i;
+
+    for (i = 0; i < num_mounts; ++i)
+    {
+        snprintf(dev_name, sizeof(dev_name), "ptest%u", (unsigned int)i);
+        UtAssert_INT32_EQ(OS_rmfs(dev_name), OS_SUCCESS);
+    }
+}
+
+void PathReport(const char *label, uint64 total_ops, int64 elapsed_usec)
+{
+    if (elapsed_usec > 0 && total_ops > 0)
+    {
+        UtPrintf("%s: %lu translations in %ld usec = %lu/sec, %lu nsec each\n", label, (unsigned long)total_ops,
+                 (long)elapsed_usec, (unsigned long)((total_ops * 1000000) / (uint64)elapsed_usec),
+                 (unsigned long)(((uint64)elapsed_usec * 1000) / total_ops));
+    }
+}
+
+void PathSingleTaskRun(void)
+{
+    char      local_path[OS_MAX_LOCAL_PATH_LEN];
+    OS_time_t start_time;
+    OS_time_t now;
+    int64     elapsed_usec;
+    uint64    total_ops;
+    int32     status;
+
+    if (num_mounts == 0)
+    {
+        return;
+    }
+
+    /* Confirm the nested mapping is the one that is used */
+    if (num_mounts > 1)
+    {
+        UtAssert_INT32_EQ(OS_TranslatePath(test_paths[1], local_path), OS_SUCCESS);
+        UtAssert_StrCmp(local_path, "./ptest1/data/file1.dat", "%s == ./ptest1/data/file1.dat", local_path);
+    }
+
+    total_ops = 0;
+    status    = OS_SUCCESS;
+    OS_GetLocalTime(&start_time);
+    do
+    {
+        status = TranslateBatch(PATHTEST_BATCH);
+        total_ops += PATHTEST_BATCH;
+        OS_GetLocalTime(&now);
+        elapsed_usec = OS_TimeGetTotalMicroseconds(OS_TimeSubtract(now, start_time));
+    } while (status == OS_SUCCESS && elapsed_usec < (PATHTEST_RUN_MSEC * 1000));
+
+    UtAssert_INT32_EQ(status, OS_SUCCESS);
+    PathReport("Single task", total_ops, elapsed_usec);
+}
+
+void PathMultiTaskRun(void)
+{
+    char      task_name[OS_MAX_API_NAME];
+    OS_time_t start_time;
+    OS_time_t end_time;
+    uint64    total_ops;
+    int32     status;
+    uint32    i;
+
+    if (num_mounts == 0)
+    {
+        return;
+    }
+
+    for (i = 0; i < PATHTEST_NUM_TASKS; ++i)
+    {
+        snprintf(task_name, sizeof(task_name), "Translate%u", (unsigned int)i);
+        status = OS_TaskCreate(&task_ids[i], task_name, translate_task, OSAL_TASK_STACK_ALLOCATE, OSAL_SIZE_C(8192),
+                               OSAL_PRIORITY_C(PATHTEST_TASK_PRIORITY), 0);
+        UtAssert_True(status == OS_SUCCESS, "%s create Rc=%d", task_name, (int)status);
+    }
+
+    OS_GetLocalTime(&start_time);
+    start_request = true;
+
+    /* Time Limited Execution */
+    OS_TaskDelay(PATHTEST_RUN_MSEC);
+    stop_request = true;
+    OS_TaskDelay(50);
+    OS_GetLocalTime(&end_time);
+
+    total_ops = 0;
+    for (i = 0; i < PATHTEST_NUM_TASKS; ++i)
+    {
+        OS_TaskDelete(task_ids[i]);
+        UtAssert_INT32_EQ(task_status[i], OS_SUCCESS);
+        total_ops += task_work[i];
+    }
+
+    PathReport("Concurrent tasks", total_ops, OS_TimeGetTotalMicroseconds(OS_TimeSubtract(end_time, start_time)));
+}
+
+void UtTest_Setup(void)
+{
+    if (OS_API_Init() != OS_SUCCESS)
+    {
+        UtAssert_Abort("OS_API_Init() failed");
+    }
+
+    /* the test should call OS_API_Teardown() before exiting */
+    UtTest_AddTeardown(OS_API_Teardown, "Cleanup");
+
+    /*
+     * Register the test setup and check routines in UT assert
+     */
+    UtTest_Add(PathSingleTaskRun, PathSetup, PathTeardown, "PathTranslateSingleTask");
+    UtTest_Add(PathMultiTaskRun, PathSetup, PathTeardown, "PathTranslateMultiTask");
+}
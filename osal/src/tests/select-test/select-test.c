@@ -295,6 +295,71 @@ void TestSelectMultipleRead(void)
     UtAssert_INT32_EQ(OS_SelectFdIsSet(&ReadSet, c2_socket_id), true);
 }
 
+void TestPollerMultipleRead(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_PollerWait(osal_id_t poller_id, OS_poller_event_t *events, uint32 max_events, uint32 *num_events,
+     *                     int32 msecs);
+     */
+    osal_id_t         poller_id;
+    OS_poller_event_t events[4];
+    uint32            num_events;
+    uint32            i;
+    bool              c1_ready;
+    bool              c2_ready;
+
+    if (!networkImplemented)
+    {
+        UtAssert_NA("Network API not implemented");
+        return;
+    }
+
+    UtAssert_INT32_EQ(OS_PollerCreate(&poller_id, "Poller1", 0), OS_SUCCESS);
+    UtAssert_INT32_EQ(OS_PollerAdd(poller_id, c1_socket_id, OS_STREAM_STATE_READABLE), OS_SUCCESS);
+
+    /* server1 is waiting on the sem, so nothing is ready yet */
+    UtAssert_INT32_EQ(OS_PollerWait(poller_id, events, 4, &num_events, UT_TIMEOUT), OS_ERROR_TIMEOUT);
+    UtAssert_UINT32_EQ(num_events, 0);
+
+    /* server2 closes its end right away, which makes c2 readable */
+    UtAssert_INT32_EQ(OS_PollerAdd(poller_id, c2_socket_id, OS_STREAM_STATE_READABLE), OS_SUCCESS);
+    UtAssert_INT32_EQ(OS_PollerWait(poller_id, events, 4, &num_events, UT_TIMEOUT), OS_SUCCESS);
+    UtAssert_UINT32_EQ(num_events, 1);
+    UtAssert_True(OS_ObjectIdEqual(events[0].objid, c2_socket_id), "events[0].objid == c2_socket_id");
+    UtAssert_UINT32_EQ(events[0].StateFlags, OS_STREAM_STATE_READABLE);
+
+    UtAssert_INT32_EQ(OS_BinSemGive(bin_sem_id), OS_SUCCESS);
+    OS_TaskDelay(10); /* Give server time to run and close the socket */
+
+    UtAssert_INT32_EQ(OS_PollerWait(poller_id, events, 4, &num_events, UT_TIMEOUT), OS_SUCCESS);
+    UtAssert_UINT32_EQ(num_events, 2);
+    c1_ready = false;
+    c2_ready = false;
+    for (i = 0; i < num_events; ++i)
+    {
+        c1_ready |= OS_ObjectIdEqual(events[i].objid, c1_socket_id);
+        c2_ready |= OS_ObjectIdEqual(events[i].objid, c2_socket_id);
+    }
+    UtAssert_True(c1_ready && c2_ready, "Both sockets reported ready");
+
+    /* a removed stream is no longer reported */
+    UtAssert_INT32_EQ(OS_PollerRemove(poller_id, c2_socket_id), OS_SUCCESS);
+    UtAssert_INT32_EQ(OS_PollerRemove(poller_id, c2_socket_id), OS_ERR_INCORRECT_OBJ_STATE);
+    UtAssert_INT32_EQ(OS_PollerWait(poller_id, events, 4, &num_events, UT_TIMEOUT), OS_SUCCESS);
+    UtAssert_UINT32_EQ(num_events, 1);
+    UtAssert_True(OS_ObjectIdEqual(events[0].objid, c1_socket_id), "events[0].objid == c1_socket_id");
+
+    /* parameter checks */
+    UtAssert_INT32_EQ(OS_PollerAdd(poller_id, c1_socket_id, 0), OS_ERR_INVALID_ARGUMENT);
+    UtAssert_INT32_EQ(OS_PollerAdd(poller_id, OS_OBJECT_ID_UNDEFINED, OS_STREAM_STATE_READABLE), OS_ERR_INVALID_ID);
+    UtAssert_INT32_EQ(OS_PollerWait(poller_id, NULL, 4, &num_events, 0), OS_INVALID_POINTER);
+    UtAssert_INT32_EQ(OS_PollerWait(poller_id, events, 0, &num_events, 0), OS_ERR_INVALID_SIZE);
+
+    UtAssert_INT32_EQ(OS_PollerDelete(poller_id), OS_SUCCESS);
+    UtAssert_INT32_EQ(OS_PollerWait(poller_id, events, 4, &num_events, 0), OS_ERR_INVALID_ID);
+}
+
 void TestSelectSingleWrite(void)
 {
     /*
@@ -426,4 +491,5 @@ void UtTest_Setup(void)
     UtTest_Add(TestSelectMultipleRead, Setup_Multi, Teardown_Multi, "TestSelectMultipleRead");
     UtTest_Add(TestSelectSingleWrite, Setup_Single, Teardown_Single, "TestSelectSingleWrite");
     UtTest_Add(TestSelectMultipleWrite, Setup_Multi, Teardown_Multi, "TestSelectMultipleWrite");
+    UtTest_Add(TestPollerMultipleRead, Setup_Multi, Teardown_Multi, "TestPollerMultipleRead");
 }
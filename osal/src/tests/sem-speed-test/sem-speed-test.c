@@ -23,18 +23,24 @@
 ** OS/kernel task switching and semaphore implementations
 ** on a given machine.
 **
-** This implements a flip-flop between two tasks using
-** two semaphores.  Task 1 waits for semaphore 1 and
-** gives semaphore 2, while task 2 waits for semaphore 2
-** and gives semaphore 1.
+** The throughput test implements a flip-flop between two
+** tasks using two semaphores.  Task 1 waits for semaphore 1
+** and gives semaphore 2, while task 2 waits for semaphore 2
+** and gives semaphore 1.  The two tasks run continuously,
+** each pending on each other and swapping between them, for
+** a fixed time.  The total number of give/take operations is
+** reported as operations per second; higher numbers indicate
+** better performance.
 **
-** The two tasks will run continuously, each pending
-** on each other and swapping between them, for 5 seconds.
-**
-** At the end of the test, the total number of "work"
-** cycles for each task is indicated.  Higher numbers
-** indicate better performance.
+** The latency test measures the time from a give until the
+** task pending on the semaphore resumes, over a number of
+** samples, and reports the minimum/average/maximum.
 **
+** Both tests are run for binary and counting semaphores.  To
+** compare semaphore implementations (e.g. the futex and
+** pthread flavors of the POSIX OSAL on Linux, selected by
+** OSAL_CONFIG_POSIX_FUTEX_SEMAPHORES) build the test against
+** each one and compare the reported figures.
 **
 */
 #include <stdio.h>
@@ -62,23 +68,36 @@
  */
 #define SEMTEST_WORK_LIMIT 10000000
 
-/* Define setup and test functions for UT assert */
-void SemSetup(void);
-void SemRun(void);
+/* Duration of each throughput run */
+#define SEMTEST_RUN_MSEC 2500
 
-/*
- * A macro for semaphore operation depending on type.
- *
- * This resolves to a function name like e.g. OS_BinSemTake.
- */
-#define SEMCALL(type, op) OS_##type##Sem##op
+/* Number of wake latency samples per semaphore type */
+#define SEMTEST_LATENCY_SAMPLES 1000
 
 /*
- * This test works with either binary or counting
- * semaphores.  To switch between them, set this
- * to either "Bin" or "Count" without quotes.
+ * The operations under test.  Binary and counting semaphores
+ * share the same call signatures, so one table entry per type
+ * lets each test body run against both.
  */
-#define SEMOP(op) SEMCALL(Count, op)
+typedef struct
+{
+    const char *Name;
+    int32 (*Create)(osal_id_t *sem_id, const char *sem_name, uint32 sem_initial_value, uint32 options);
+    int32 (*Give)(osal_id_t sem_id);
+    int32 (*Take)(osal_id_t sem_id);
+    int32 (*Delete)(osal_id_t sem_id);
+} SemTestOps_t;
+
+static const SemTestOps_t SEMTEST_BIN_OPS   = {"Bin", OS_BinSemCreate, OS_BinSemGive, OS_BinSemTake, OS_BinSemDelete};
+static const SemTestOps_t SEMTEST_COUNT_OPS = {"Count", OS_CountSemCreate, OS_CountSemGive, OS_CountSemTake,
+                                               OS_CountSemDelete};
+
+/* Define setup and test functions for UT assert */
+void SemSetup(void);
+void SemRun(void);
+void SemLatency(void);
+
+const SemTestOps_t *SemOps;
 
 osal_id_t task_1_id;
 uint32    task_1_work;
@@ -89,15 +108,17 @@ uint32    task_2_work;
 osal_id_t sem_id_1;
 osal_id_t sem_id_2;
 
+OS_time_t wake_time;
+
 void task_1(void)
 {
-    uint32 status;
+    int32 status;
 
     OS_printf("Starting task 1\n");
 
     while (task_1_work < SEMTEST_WORK_LIMIT)
     {
-        status = SEMOP(Take)(sem_id_1);
+        status = SemOps->Take(sem_id_1);
         if (status != OS_SUCCESS)
         {
             OS_printf("TASK 1: Error calling SemTake 1: %d\n", (int)status);
@@ -106,7 +127,7 @@ void task_1(void)
 
         ++task_1_work;
 
-        status = SEMOP(Give)(sem_id_2);
+        status = SemOps->Give(sem_id_2);
         if (status != OS_SUCCESS)
         {
             OS_printf("TASK 1: Error calling SemGive 2: %d\n", (int)status);
@@ -117,13 +138,13 @@ void task_1(void)
 
 void task_2(void)
 {
-    uint32 status;
+    int32 status;
 
     OS_printf("Starting task 2\n");
 
     while (task_2_work < SEMTEST_WORK_LIMIT)
     {
-        status = SEMOP(Take)(sem_id_2);
+        status = SemOps->Take(sem_id_2);
         if (status != OS_SUCCESS)
         {
             OS_printf("TASK 2: Error calling SemTake 2: %d\n", (int)status);
@@ -132,7 +153,7 @@ void task_2(void)
 
         ++task_2_work;
 
-        status = SEMOP(Give)(sem_id_1);
+        status = SemOps->Give(sem_id_1);
         if (status != OS_SUCCESS)
         {
             OS_printf("TASK 2: Error calling SemGive 1: %d\n", (int)status);
@@ -141,36 +162,57 @@ void task_2(void)
     }
 }
 
-void UtTest_Setup(void)
+/*
+ * Latency test worker: records the time it resumed
+ * after each take, then acknowledges via the second sem
+ */
+void wake_task(void)
 {
-    if (OS_API_Init() != OS_SUCCESS)
+    while (true)
     {
-        UtAssert_Abort("OS_API_Init() failed");
-    }
+        if (SemOps->Take(sem_id_1) != OS_SUCCESS)
+        {
+            break;
+        }
 
-    /* the test should call OS_API_Teardown() before exiting */
-    UtTest_AddTeardown(OS_API_Teardown, "Cleanup");
+        OS_GetLocalTime(&wake_time);
 
-    /*
-     * Register the test setup and check routines in UT assert
-     */
-    UtTest_Add(SemRun, SemSetup, NULL, "SemSpeedTest");
+        if (SemOps->Give(sem_id_2) != OS_SUCCESS)
+        {
+            break;
+        }
+    }
 }
 
 void SemSetup(void)
 {
-    uint32 status;
+    int32 status;
 
     task_1_work = 0;
     task_2_work = 0;
 
     /*
-    ** Create the Bin semaphore
+    ** Create the semaphores
     */
-    status = SEMOP(Create)(&sem_id_1, "Sem1", 0, 0);
+    status = SemOps->Create(&sem_id_1, "Sem1", 0, 0);
     UtAssert_True(status == OS_SUCCESS, "Sem 1 create Id=%lx Rc=%d", OS_ObjectIdToInteger(sem_id_1), (int)status);
-    status = SEMOP(Create)(&sem_id_2, "Sem2", 0, 0);
+    status = SemOps->Create(&sem_id_2, "Sem2", 0, 0);
     UtAssert_True(status == OS_SUCCESS, "Sem 2 create Id=%lx Rc=%d", OS_ObjectIdToInteger(sem_id_2), (int)status);
+}
+
+void SemTeardown(void)
+{
+    UtAssert_INT32_EQ(SemOps->Delete(sem_id_1), OS_SUCCESS);
+    UtAssert_INT32_EQ(SemOps->Delete(sem_id_2), OS_SUCCESS);
+}
+
+void SemRun(void)
+{
+    int32     status;
+    OS_time_t start_time;
+    OS_time_t end_time;
+    int64     elapsed_usec;
+    uint64    total_ops;
 
     /*
     ** Create the tasks
@@ -186,17 +228,13 @@ void SemSetup(void)
     /* A small delay just to allow the tasks
      * to start and pend on the sem */
     OS_TaskDelay(10);
-}
-
-void SemRun(void)
-{
-    int32 status;
 
     /* Give the initial sem that starts the loop */
-    SEMOP(Give)(sem_id_1);
+    OS_GetLocalTime(&start_time);
+    SemOps->Give(sem_id_1);
 
     /* Time Limited Execution */
-    OS_TaskDelay(5000);
+    OS_TaskDelay(SEMTEST_RUN_MSEC);
 
     /*
     ** Delete resources
@@ -210,12 +248,103 @@ void SemRun(void)
     status = OS_TaskDelete(task_2_id);
     UtAssert_True(status == OS_SUCCESS, "Task 2 delete Rc=%d", (int)status);
 
-    status = SEMOP(Delete)(sem_id_1);
-    UtAssert_True(status == OS_SUCCESS, "Sem 1 delete Rc=%d", (int)status);
-    status = SEMOP(Delete)(sem_id_2);
-    UtAssert_True(status == OS_SUCCESS, "Sem 2 delete Rc=%d", (int)status);
+    OS_GetLocalTime(&end_time);
 
     /* Task 1 and 2 should have both executed */
     UtAssert_True(task_1_work != 0, "Task 1 work counter = %u", (unsigned int)task_1_work);
     UtAssert_True(task_2_work != 0, "Task 2 work counter = %u", (unsigned int)task_2_work);
+
+    /* Each unit of work is one take plus one give */
+    elapsed_usec = OS_TimeGetTotalMicroseconds(OS_TimeSubtract(end_time, start_time));
+    total_ops    = 2 * ((uint64)task_1_work + task_2_work);
+    if (elapsed_usec > 0)
+    {
+        UtPrintf("%sSem throughput: %lu ops in %ld usec = %lu ops/sec\n", SemOps->Name, (unsigned long)total_ops,
+                 (long)elapsed_usec, (unsigned long)((total_ops * 1000000) / (uint64)elapsed_usec));
+    }
+}
+
+void SemLatency(void)
+{
+    int32     status;
+    osal_id_t wake_task_id;
+    OS_time_t give_time;
+    int64     latency_nsec;
+    int64     min_nsec;
+    int64     max_nsec;
+    int64     total_nsec;
+    uint32    samples;
+
+    status = OS_TaskCreate(&wake_task_id, "WakeTask", wake_task, OSAL_TASK_STACK_ALLOCATE, OSAL_SIZE_C(4096),
+                           OSAL_PRIORITY_C(SEMTEST_TASK_PRIORITY), 0);
+    UtAssert_True(status == OS_SUCCESS, "Wake task create Id=%lx Rc=%d", OS_ObjectIdToInteger(wake_task_id),
+                  (int)status);
+
+    /* let the task start and pend on the sem */
+    OS_TaskDelay(10);
+
+    min_nsec   = 0;
+    max_nsec   = 0;
+    total_nsec = 0;
+    for (samples = 0; samples < SEMTEST_LATENCY_SAMPLES; ++samples)
+    {
+        OS_GetLocalTime(&give_time);
+        if (SemOps->Give(sem_id_1) != OS_SUCCESS || SemOps->Take(sem_id_2) != OS_SUCCESS)
+        {
+            break;
+        }
+
+        latency_nsec = OS_TimeGetTotalNanoseconds(OS_TimeSubtract(wake_time, give_time));
+        if (samples == 0 || latency_nsec < min_nsec)
+        {
+            min_nsec = latency_nsec;
+        }
+        if (latency_nsec > max_nsec)
+        {
+            max_nsec = latency_nsec;
+        }
+        total_nsec += latency_nsec;
+    }
+
+    UtAssert_UINT32_EQ(samples, SEMTEST_LATENCY_SAMPLES);
+
+    status = OS_TaskDelete(wake_task_id);
+    UtAssert_True(status == OS_SUCCESS, "Wake task delete Rc=%d", (int)status);
+
+    if (samples > 0)
+    {
+        UtPrintf("%sSem wake latency over %u samples: min %ld nsec, avg %ld nsec, max %ld nsec\n", SemOps->Name,
+                 (unsigned int)samples, (long)min_nsec, (long)(total_nsec / samples), (long)max_nsec);
+    }
+}
+
+void BinSemSetup(void)
+{
+    SemOps = &SEMTEST_BIN_OPS;
+    SemSetup();
+}
+
+void CountSemSetup(void)
+{
+    SemOps = &SEMTEST_COUNT_OPS;
+    SemSetup();
+}
+
+void UtTest_Setup(void)
+{
+    if (OS_API_Init() != OS_SUCCESS)
+    {
+        UtAssert_Abort("OS_API_Init() failed");
+    }
+
+    /* the test should call OS_API_Teardown() before exiting */
+    UtTest_AddTeardown(OS_API_Teardown, "Cleanup");
+
+    /*
+     * Register the test setup and check routines in UT assert
+     */
+    UtTest_Add(SemRun, BinSemSetup, SemTeardown, "BinSemSpeedTest");
+    UtTest_Add(SemLatency, BinSemSetup, SemTeardown, "BinSemLatencyTest");
+    UtTest_Add(SemRun, CountSemSetup, SemTeardown, "CountSemSpeedTest");
+    UtTest_Add(SemLatency, CountSemSetup, SemTeardown, "CountSemLatencyTest");
 }
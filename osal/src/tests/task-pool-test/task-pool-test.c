@@ -0,0 +1,352 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/*
+** Task Pool Test
+**
+** Checks that jobs given to OS_TaskPoolSubmit() are all run, including
+** jobs submitted from within other jobs, and that the pool refuses jobs
+** beyond OS_MAX_TASK_POOL_JOBS.
+**
+** It then compares the cost of running a short job on the pool with
+** creating a task for it, first one job at a time and then with a
+** batch of jobs in flight.  The results are reported in microseconds
+** per job; lower numbers indicate better performance.
+**
+*/
+#include <stdio.h>
+#include <string.h>
+#include "common_types.h"
+#include "osapi.h"
+#include "utassert.h"
+#include "uttest.h"
+#include "utbsp.h"
+
+/* Number of jobs in the basic test, and children of each job in the fan-out test */
+#define POOLTEST_NUM_JOBS 32
+
+/*
+ * Number of jobs timed in each speed run.  A task that has signaled
+ * completion may not have exited yet, so this stays below OS_MAX_TASKS.
+ */
+#define POOLTEST_SPEED_JOBS 48
+
+/* Jobs kept in flight for the batched speed run */
+#define POOLTEST_BATCH 16
+
+/* Amount of work done by each job in the speed runs */
+#define POOLTEST_WORK_WORDS 1024
+
+/* Priority of the tasks created in the speed run, same as the pool workers */
+#define POOLTEST_TASK_PRIORITY OS_TASK_POOL_PRIORITY
+
+/* Time to wait for all jobs of a test to complete */
+#define POOLTEST_TIMEOUT_MSEC 5000
+
+osal_id_t done_sem;
+osal_id_t block_sem;
+uint32    job_runs;
+uint32    job_results[POOLTEST_NUM_JOBS];
+uint32    work_data[POOLTEST_WORK_WORDS];
+uint32    task_index;
+
+void CountJob(void *arg)
+{
+    uint32 *result = arg;
+
+    *result = 1;
+    __atomic_add_fetch(&job_runs, 1, __ATOMIC_RELAXED);
+    OS_CountSemGive(done_sem);
+}
+
+void FanOutJob(void *arg)
+{
+    uint32 i;
+
+    /* These go on the queue of the worker running this job, others may steal them */
+    for (i = 0; i < POOLTEST_NUM_JOBS; ++i)
+    {
+        if (OS_TaskPoolSubmit(CountJob, &job_results[i]) != OS_SUCCESS)
+        {
+            break;
+        }
+    }
+
+    OS_CountSemGive(done_sem);
+}
+
+void BlockedJob(void *arg)
+{
+    OS_CountSemTake(block_sem);
+    OS_CountSemGive(done_sem);
+}
+
+/*
+ * A small checksum over a shared buffer, standing in for real work
+ */
+void SpeedJob(void *arg)
+{
+    uint32 sum;
+    uint32 i;
+
+    sum = 0;
+    for (i = 0; i < POOLTEST_WORK_WORDS; ++i)
+    {
+        sum = (sum << 1 | sum >> 31) ^ work_data[i];
+    }
+
+    *((volatile uint32 *)arg) = sum;
+    OS_CountSemGive(done_sem);
+}
+
+void SpeedTask(void)
+{
+    uint32 sum;
+
+    SpeedJob(&sum);
+}
+
+/*
+ * Wait for "count" jobs to signal completion
+ */
+int32 WaitJobs(uint32 count)
+{
+    int32 status;
+
+    status = OS_SUCCESS;
+    while (count > 0 && status == OS_SUCCESS)
+    {
+        status = OS_CountSemTimedWait(done_sem, POOLTEST_TIMEOUT_MSEC);
+        --count;
+    }
+
+    return status;
+}
+
+void PoolSetup(void)
+{
+    uint32 i;
+
+    job_runs = 0;
+    memset(job_results, 0, sizeof(job_results));
+    for (i = 0; i < POOLTEST_WORK_WORDS; ++i)
+    {
+        work_data[i] = i * 2654435761U;
+    }
+
+    UtAssert_INT32_EQ(OS_CountSemCreate(&done_sem, "PoolDone", 0, 0), OS_SUCCESS);
+    UtAssert_INT32_EQ(OS_CountSemCreate(&block_sem, "PoolBlock", 0, 0), OS_SUCCESS);
+}
+
+void PoolTeardown(void)
+{
+    UtAssert_INT32_EQ(OS_CountSemDelete(done_sem), OS_SUCCESS);
+    UtAssert_INT32_EQ(OS_CountSemDelete(block_sem), OS_SUCCESS);
+}
+
+void PoolReport(const char *label, uint32 num_jobs, int64 elapsed_usec)
+{
+    if (num_jobs > 0)
+    {
+        UtPrintf("%s: %lu jobs in %ld usec = %lu nsec each\n", label, (unsigned long)num_jobs, (long)elapsed_usec,
+                 (unsigned long)((elapsed_usec * 1000) / num_jobs));
+    }
+}
+
+void PoolBasicRun(void)
+{
+    OS_task_pool_prop_t before;
+    OS_task_pool_prop_t after;
+    int32               status;
+    uint32              i;
+
+    UtAssert_INT32_EQ(OS_TaskPoolGetInfo(&before), OS_SUCCESS);
+
+    status = OS_SUCCESS;
+    for (i = 0; i < POOLTEST_NUM_JOBS && status == OS_SUCCESS; ++i)
+    {
+        status = OS_TaskPoolSubmit(CountJob, &job_results[i]);
+    }
+    UtAssert_INT32_EQ(status, OS_SUCCESS);
+    UtAssert_INT32_EQ(WaitJobs(POOLTEST_NUM_JOBS), OS_SUCCESS);
+
+    UtAssert_UINT32_EQ(job_runs, POOLTEST_NUM_JOBS);
+    for (i = 0; i < POOLTEST_NUM_JOBS; ++i)
+    {
+        UtAssert_UINT32_EQ(job_results[i], 1);
+    }
+
+    /* The last job gives the semaphore just before returning, allow it to finish */
+    OS_TaskDelay(10);
+
+    UtAssert_INT32_EQ(OS_TaskPoolGetInfo(&after), OS_SUCCESS);
+    UtAssert_True(after.num_workers > 0 && after.num_workers <= OS_MAX_TASK_POOL_WORKERS, "%u workers",
+                  (unsigned int)after.num_workers);
+    UtAssert_UINT32_EQ(after.jobs_submitted - before.jobs_submitted, POOLTEST_NUM_JOBS);
+    UtAssert_UINT32_EQ(after.jobs_completed - before.jobs_completed, POOLTEST_NUM_JOBS);
+    UtAssert_UINT32_EQ(after.jobs_queued, 0);
+    UtAssert_UINT32_EQ(after.jobs_running, 0);
+
+    UtAssert_INT32_EQ(OS_TaskPoolSubmit(NULL, NULL), OS_INVALID_POINTER);
+    UtAssert_INT32_EQ(OS_TaskPoolGetInfo(NULL), OS_INVALID_POINTER);
+}
+
+void PoolFanOutRun(void)
+{
+    OS_task_pool_prop_t prop;
+    uint32              i;
+
+    UtAssert_INT32_EQ(OS_TaskPoolSubmit(FanOutJob, NULL), OS_SUCCESS);
+
+    /* the parent and all its children */
+    UtAssert_INT32_EQ(WaitJobs(POOLTEST_NUM_JOBS + 1), OS_SUCCESS);
+    UtAssert_UINT32_EQ(job_runs, POOLTEST_NUM_JOBS);
+    for (i = 0; i < POOLTEST_NUM_JOBS; ++i)
+    {
+        UtAssert_UINT32_EQ(job_results[i], 1);
+    }
+
+    UtAssert_INT32_EQ(OS_TaskPoolGetInfo(&prop), OS_SUCCESS);
+    UtPrintf("Pool has %u workers, %lu jobs stolen so far\n", (unsigned int)prop.num_workers,
+             (unsigned long)prop.jobs_stolen);
+}
+
+void PoolLimitRun(void)
+{
+    OS_task_pool_prop_t before;
+    OS_task_pool_prop_t after;
+    int32               status;
+    uint32              accepted;
+    uint32              i;
+
+    OS_TaskDelay(10);
+    UtAssert_INT32_EQ(OS_TaskPoolGetInfo(&before), OS_SUCCESS);
+
+    /* Jobs that wait on a semaphore keep their places until released */
+    accepted = 0;
+    status   = OS_SUCCESS;
+    while (status == OS_SUCCESS && accepted <= OS_MAX_TASK_POOL_JOBS)
+    {
+        status = OS_TaskPoolSubmit(BlockedJob, NULL);
+        if (status == OS_SUCCESS)
+        {
+            ++accepted;
+        }
+    }
+
+    UtAssert_INT32_EQ(status, OS_QUEUE_FULL);
+    UtAssert_UINT32_EQ(accepted, OS_MAX_TASK_POOL_JOBS);
+
+    UtAssert_INT32_EQ(OS_TaskPoolGetInfo(&after), OS_SUCCESS);
+    UtAssert_UINT32_EQ(after.jobs_queued + after.jobs_running, OS_MAX_TASK_POOL_JOBS);
+    UtAssert_UINT32_EQ(after.jobs_rejected - before.jobs_rejected, 1);
+
+    for (i = 0; i < accepted; ++i)
+    {
+        OS_CountSemGive(block_sem);
+    }
+    UtAssert_INT32_EQ(WaitJobs(accepted), OS_SUCCESS);
+
+    /* Space is available again */
+    OS_TaskDelay(10);
+    UtAssert_INT32_EQ(OS_TaskPoolSubmit(CountJob, &job_results[0]), OS_SUCCESS);
+    UtAssert_INT32_EQ(WaitJobs(1), OS_SUCCESS);
+}
+
+/*
+ * Start one speed job on the pool or in a new task
+ */
+int32 StartSpeedJob(bool use_pool, uint32 *result)
+{
+    char      task_name[OS_MAX_API_NAME];
+    osal_id_t task_id;
+
+    if (use_pool)
+    {
+        return OS_TaskPoolSubmit(SpeedJob, result);
+    }
+
+    /* Task names must be unique, while an exiting task may still hold its name */
+    snprintf(task_name, sizeof(task_name), "PoolSpeed%u", (unsigned int)(task_index++ % 1000));
+    return OS_TaskCreate(&task_id, task_name, SpeedTask, OSAL_TASK_STACK_ALLOCATE, OSAL_SIZE_C(16384),
+                         OSAL_PRIORITY_C(POOLTEST_TASK_PRIORITY), 0);
+}
+
+void SpeedRun(bool use_pool, uint32 in_flight, const char *label)
+{
+    OS_time_t start_time;
+    OS_time_t end_time;
+    uint32    results[POOLTEST_BATCH];
+    uint32    started;
+    uint32    finished;
+    int32     status;
+
+    started  = 0;
+    finished = 0;
+    status   = OS_SUCCESS;
+    OS_GetLocalTime(&start_time);
+    while (finished < POOLTEST_SPEED_JOBS && status == OS_SUCCESS)
+    {
+        if (started < POOLTEST_SPEED_JOBS && (started - finished) < in_flight)
+        {
+            status = StartSpeedJob(use_pool, &results[started % POOLTEST_BATCH]);
+            ++started;
+        }
+        else
+        {
+            status = OS_CountSemTimedWait(done_sem, POOLTEST_TIMEOUT_MSEC);
+            ++finished;
+        }
+    }
+    OS_GetLocalTime(&end_time);
+
+    UtAssert_INT32_EQ(status, OS_SUCCESS);
+    PoolReport(label, finished, OS_TimeGetTotalMicroseconds(OS_TimeSubtract(end_time, start_time)));
+
+    /* allow the last created tasks to exit before the next run */
+    OS_TaskDelay(50);
+}
+
+void PoolSpeedRun(void)
+{
+    task_index = 0;
+
+    SpeedRun(false, 1, "Task per job, one at a time");
+    SpeedRun(true, 1, "Task pool, one at a time");
+    SpeedRun(false, POOLTEST_BATCH, "Task per job, batched");
+    SpeedRun(true, POOLTEST_BATCH, "Task pool, batched");
+}
+
+void UtTest_Setup(void)
+{
+    if (OS_API_Init() != OS_SUCCESS)
+    {
+        UtAssert_Abort("OS_API_Init() failed");
+    }
+
+    /* the test should call OS_API_Teardown() before exiting */
+    UtTest_AddTeardown(OS_API_Teardown, "Cleanup");
+
+    /*
+     * Register the test setup and check routines in UT assert
+     */
+    UtTest_Add(PoolBasicRun, PoolSetup, PoolTeardown, "TaskPoolBasic");
+    UtTest_Add(PoolFanOutRun, PoolSetup, PoolTeardown, "TaskPoolFanOut");
+    UtTest_Add(PoolLimitRun, PoolSetup, PoolTeardown, "TaskPoolLimit");
+    UtTest_Add(PoolSpeedRun, PoolSetup, PoolTeardown, "TaskPoolSpeed");
+}
@@ -30,34 +30,27 @@
 #include "OCS_stdio.h"
 #include "OCS_bsp-impl.h"
 
-#define TEST_BUFFER_LEN 16
-
-const char TEST_BUF_INITIALIZER[1 + TEST_BUFFER_LEN] = "abcdefghijklmnop";
-
 void Test_OS_ConsoleOutput_Impl(void)
 {
-    char              TestConsoleBspBuffer[TEST_BUFFER_LEN];
-    char              TestOutputBuffer[32];
     OS_object_token_t token;
 
     memset(&token, 0, sizeof(token));
 
-    memcpy(TestConsoleBspBuffer, TEST_BUF_INITIALIZER, sizeof(TestConsoleBspBuffer));
-    memset(TestOutputBuffer, 0, sizeof(TestOutputBuffer));
-
-    OS_console_table[0].BufBase = TestConsoleBspBuffer;
-    OS_console_table[0].BufSize = sizeof(TestConsoleBspBuffer);
-
-    UT_SetDataBuffer(UT_KEY(OCS_OS_BSP_ConsoleOutput_Impl), TestOutputBuffer, sizeof(TestOutputBuffer), false);
-
-    OS_console_table[0].WritePos = 4;
+    /* nothing ready to output */
     OS_ConsoleOutput_Impl(&token);
-    UtAssert_True(strcmp(TestOutputBuffer, "abcd") == 0, "TestOutputBuffer (%s) == abcd", TestOutputBuffer);
-
-    OS_console_table[0].WritePos = 2;
+    UtAssert_STUB_COUNT(OS_ConsoleRead, 1);
+    UtAssert_STUB_COUNT(OCS_OS_BSP_ConsoleOutput_Impl, 0);
+    UtAssert_STUB_COUNT(OCS_OS_BSP_Lock_Impl, 1);
+    UtAssert_STUB_COUNT(OCS_OS_BSP_Unlock_Impl, 1);
+
+    /* output batches until the buffer is drained */
+    UT_SetDeferredRetcode(UT_KEY(OS_ConsoleRead), 1, 4);
+    UT_SetDeferredRetcode(UT_KEY(OS_ConsoleRead), 1, 2);
     OS_ConsoleOutput_Impl(&token);
-    UtAssert_True(strcmp(TestOutputBuffer, "abcdefghijklmnopab") == 0, "TestOutputBuffer (%s) == abcdefghijklmnopab",
-                  TestOutputBuffer);
+    UtAssert_STUB_COUNT(OS_ConsoleRead, 4);
+    UtAssert_STUB_COUNT(OCS_OS_BSP_ConsoleOutput_Impl, 2);
+    UtAssert_STUB_COUNT(OCS_OS_BSP_Lock_Impl, 2);
+    UtAssert_STUB_COUNT(OCS_OS_BSP_Unlock_Impl, 2);
 }
 
 /* ------------------- End of test cases --------------------------------------*/
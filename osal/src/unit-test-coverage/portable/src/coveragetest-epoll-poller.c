@@ -0,0 +1,217 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * \file
+ * \ingroup  portable
+ *
+ */
+
+#include "os-portable-coveragetest.h"
+#include "ut-adaptor-portable-posix-io.h"
+
+#include "os-shared-poller.h"
+#include "os-shared-idmap.h"
+
+#include "OCS_sys_epoll.h"
+#include "OCS_unistd.h"
+#include "OCS_errno.h"
+
+/* Captures the operation passed to epoll_ctl() */
+static int32 UT_Hook_epoll_ctl(void *UserObj, int32 StubRetcode, uint32 CallCount, const UT_StubContext_t *Context)
+{
+    *((int *)UserObj) = UT_Hook_GetArgValueByName(Context, "op", int);
+
+    return StubRetcode;
+}
+
+void Test_OS_PollerCreate_Impl(void)
+{
+    /* Test Case For:
+     * int32 OS_PollerCreate_Impl(const OS_object_token_t *token, uint32 options)
+     */
+    OS_object_token_t token;
+
+    memset(&token, 0, sizeof(token));
+
+    OSAPI_TEST_FUNCTION_RC(OS_PollerCreate_Impl, (&token, 0), OS_SUCCESS);
+
+    UT_SetDefaultReturnValue(UT_KEY(OCS_epoll_create1), -1);
+    OSAPI_TEST_FUNCTION_RC(OS_PollerCreate_Impl, (&token, 0), OS_ERROR);
+}
+
+void Test_OS_PollerDelete_Impl(void)
+{
+    /* Test Case For:
+     * int32 OS_PollerDelete_Impl(const OS_object_token_t *token)
+     */
+    OS_object_token_t token;
+
+    memset(&token, 0, sizeof(token));
+
+    OSAPI_TEST_FUNCTION_RC(OS_PollerDelete_Impl, (&token), OS_SUCCESS);
+
+    UT_SetDefaultReturnValue(UT_KEY(OCS_close), -1);
+    OSAPI_TEST_FUNCTION_RC(OS_PollerDelete_Impl, (&token), OS_ERROR);
+}
+
+void Test_OS_PollerAdd_Impl(void)
+{
+    /* Test Case For:
+     * int32 OS_PollerAdd_Impl(const OS_object_token_t *token, const OS_object_token_t *stream_token,
+     *                         uint32 StateFlags, bool IsMember)
+     */
+    OS_object_token_t token;
+    OS_object_token_t stream_token;
+    int               op;
+
+    memset(&token, 0, sizeof(token));
+    memset(&stream_token, 0, sizeof(stream_token));
+    UT_SetHookFunction(UT_KEY(OCS_epoll_ctl), UT_Hook_epoll_ctl, &op);
+
+    /* streams that are not selectable, or not open, cannot be polled */
+    OSAPI_TEST_FUNCTION_RC(OS_PollerAdd_Impl, (&token, &stream_token, OS_STREAM_STATE_READABLE, false),
+                           OS_ERR_OPERATION_NOT_SUPPORTED);
+    UT_PortablePosixIOTest_Set_Selectable(UT_INDEX_0, true);
+    OSAPI_TEST_FUNCTION_RC(OS_PollerAdd_Impl, (&token, &stream_token, OS_STREAM_STATE_READABLE, false),
+                           OS_ERR_OPERATION_NOT_SUPPORTED);
+    UtAssert_STUB_COUNT(OCS_epoll_ctl, 0);
+
+    /* a new member is added */
+    UT_PortablePosixIOTest_Set_FD(UT_INDEX_0, 3);
+    op = 0;
+    OSAPI_TEST_FUNCTION_RC(OS_PollerAdd_Impl,
+                           (&token, &stream_token, OS_STREAM_STATE_READABLE | OS_STREAM_STATE_WRITABLE, false),
+                           OS_SUCCESS);
+    UtAssert_INT32_EQ(op, OCS_EPOLL_CTL_ADD);
+
+    /* an existing member is modified in place */
+    op = 0;
+    OSAPI_TEST_FUNCTION_RC(OS_PollerAdd_Impl, (&token, &stream_token, OS_STREAM_STATE_WRITABLE, true), OS_SUCCESS);
+    UtAssert_INT32_EQ(op, OCS_EPOLL_CTL_MOD);
+    UtAssert_STUB_COUNT(OCS_epoll_ctl, 2);
+
+    /* failure mode */
+    UT_SetDefaultReturnValue(UT_KEY(OCS_epoll_ctl), -1);
+    OSAPI_TEST_FUNCTION_RC(OS_PollerAdd_Impl, (&token, &stream_token, OS_STREAM_STATE_READABLE, false), OS_ERROR);
+    OSAPI_TEST_FUNCTION_RC(OS_PollerAdd_Impl, (&token, &stream_token, OS_STREAM_STATE_READABLE, true), OS_ERROR);
+}
+
+void Test_OS_PollerRemove_Impl(void)
+{
+    /* Test Case For:
+     * int32 OS_PollerRemove_Impl(const OS_object_token_t *token, const OS_object_token_t *stream_token)
+     */
+    OS_object_token_t token;
+    OS_object_token_t stream_token;
+
+    memset(&token, 0, sizeof(token));
+    memset(&stream_token, 0, sizeof(stream_token));
+
+    OSAPI_TEST_FUNCTION_RC(OS_PollerRemove_Impl, (&token, &stream_token), OS_SUCCESS);
+
+    /* descriptors the kernel already dropped are not an error */
+    UT_SetDefaultReturnValue(UT_KEY(OCS_epoll_ctl), -1);
+    OCS_errno = OCS_ENOENT;
+    OSAPI_TEST_FUNCTION_RC(OS_PollerRemove_Impl, (&token, &stream_token), OS_SUCCESS);
+    OCS_errno = OCS_EBADF;
+    OSAPI_TEST_FUNCTION_RC(OS_PollerRemove_Impl, (&token, &stream_token), OS_SUCCESS);
+
+    /* failure mode */
+    OCS_errno = OCS_EINVAL;
+    OSAPI_TEST_FUNCTION_RC(OS_PollerRemove_Impl, (&token, &stream_token), OS_ERROR);
+}
+
+void Test_OS_PollerWait_Impl(void)
+{
+    /* Test Case For:
+     * int32 OS_PollerWait_Impl(const OS_object_token_t *token, OS_poller_event_t *events, uint32 max_events,
+     *                          uint32 *num_events, int32 msecs)
+     */
+    OS_object_token_t      token;
+    OS_poller_event_t      events[3];
+    struct OCS_epoll_event ev[3];
+    uint32                 num_events;
+
+    memset(&token, 0, sizeof(token));
+
+    /* an interrupted wait is restarted, then times out */
+    UT_SetDeferredRetcode(UT_KEY(OCS_epoll_wait), 1, -1);
+    OCS_errno = OCS_EINTR;
+    OSAPI_TEST_FUNCTION_RC(OS_PollerWait_Impl, (&token, events, 3, &num_events, OS_PEND), OS_ERROR_TIMEOUT);
+    UtAssert_STUB_COUNT(OCS_epoll_wait, 2);
+
+    /* failure mode */
+    UT_SetDeferredRetcode(UT_KEY(OCS_epoll_wait), 1, -1);
+    OCS_errno = OCS_EINVAL;
+    OSAPI_TEST_FUNCTION_RC(OS_PollerWait_Impl, (&token, events, 3, &num_events, 100), OS_ERROR);
+
+    /* nominal, hangup and error conditions are reported as readable */
+    memset(ev, 0, sizeof(ev));
+    ev[0].events   = OCS_EPOLLIN;
+    ev[0].data.u32 = 0x10001;
+    ev[1].events   = OCS_EPOLLOUT | OCS_EPOLLHUP;
+    ev[1].data.u32 = 0x10002;
+    ev[2].events   = OCS_EPOLLERR;
+    ev[2].data.u32 = 0x10003;
+    UT_SetDataBuffer(UT_KEY(OCS_epoll_wait), ev, sizeof(ev), false);
+    UT_SetDeferredRetcode(UT_KEY(OCS_epoll_wait), 1, 3);
+    OSAPI_TEST_FUNCTION_RC(OS_PollerWait_Impl, (&token, events, 1000, &num_events, 100), OS_SUCCESS);
+    UtAssert_UINT32_EQ(num_events, 3);
+    UtAssert_UINT32_EQ(OS_ObjectIdToInteger(events[0].objid), 0x10001);
+    UtAssert_UINT32_EQ(events[0].StateFlags, OS_STREAM_STATE_READABLE);
+    UtAssert_UINT32_EQ(OS_ObjectIdToInteger(events[1].objid), 0x10002);
+    UtAssert_UINT32_EQ(events[1].StateFlags, OS_STREAM_STATE_READABLE | OS_STREAM_STATE_WRITABLE);
+    UtAssert_UINT32_EQ(OS_ObjectIdToInteger(events[2].objid), 0x10003);
+    UtAssert_UINT32_EQ(events[2].StateFlags, OS_STREAM_STATE_READABLE);
+}
+
+/* ------------------- End of test cases --------------------------------------*/
+
+/* Osapi_Test_Setup
+ *
+ * Purpose:
+ *   Called by the unit test tool to set up the app prior to each test
+ */
+void Osapi_Test_Setup(void)
+{
+    UT_ResetState(0);
+    UT_PortablePosixIOTest_ResetImpl(UT_INDEX_0);
+}
+
+/*
+ * Osapi_Test_Teardown
+ *
+ * Purpose:
+ *   Called by the unit test tool to tear down the app after each test
+ */
+void Osapi_Test_Teardown(void) {}
+
+/* UtTest_Setup
+ *
+ * Purpose:
+ *   Registers the test cases to execute with the unit test tool
+ */
+void UtTest_Setup(void)
+{
+    ADD_TEST(OS_PollerCreate_Impl);
+    ADD_TEST(OS_PollerDelete_Impl);
+    ADD_TEST(OS_PollerAdd_Impl);
+    ADD_TEST(OS_PollerRemove_Impl);
+    ADD_TEST(OS_PollerWait_Impl);
+}
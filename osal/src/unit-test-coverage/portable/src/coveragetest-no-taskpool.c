@@ -0,0 +1,79 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * \file
+ * \ingroup  portable
+ *
+ */
+
+#include "os-portable-coveragetest.h"
+#include "os-shared-task.h"
+
+static void UT_TaskPoolTestJob(void *arg) {}
+
+void Test_OS_TaskPoolSubmit_Impl(void)
+{
+    /* Test Case For:
+     * int32 OS_TaskPoolSubmit_Impl(OS_TaskPoolJob_t job_func, void *job_arg)
+     */
+    OSAPI_TEST_FUNCTION_RC(OS_TaskPoolSubmit_Impl, (UT_TaskPoolTestJob, NULL), OS_ERR_NOT_IMPLEMENTED);
+}
+
+void Test_OS_TaskPoolGetInfo_Impl(void)
+{
+    /* Test Case For:
+     * int32 OS_TaskPoolGetInfo_Impl(OS_task_pool_prop_t *pool_prop)
+     */
+    OS_task_pool_prop_t pool_prop;
+
+    memset(&pool_prop, 0, sizeof(pool_prop));
+
+    OSAPI_TEST_FUNCTION_RC(OS_TaskPoolGetInfo_Impl, (&pool_prop), OS_ERR_NOT_IMPLEMENTED);
+}
+
+/* ------------------- End of test cases --------------------------------------*/
+
+/* Osapi_Test_Setup
+ *
+ * Purpose:
+ *   Called by the unit test tool to set up the app prior to each test
+ */
+void Osapi_Test_Setup(void)
+{
+    UT_ResetState(0);
+}
+
+/*
+ * Osapi_Test_Teardown
+ *
+ * Purpose:
+ *   Called by the unit test tool to tear down the app after each test
+ */
+void Osapi_Test_Teardown(void) {}
+
+/* UtTest_Setup
+ *
+ * Purpose:
+ *   Registers the test cases to execute with the unit test tool
+ */
+void UtTest_Setup(void)
+{
+    ADD_TEST(OS_TaskPoolSubmit_Impl);
+    ADD_TEST(OS_TaskPoolGetInfo_Impl);
+}
@@ -0,0 +1,130 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * \file
+ * \ingroup  portable
+ *
+ */
+
+#include "os-portable-coveragetest.h"
+
+#include "os-shared-file.h"
+#include "os-shared-idmap.h"
+
+#include "OCS_sys_mman.h"
+#include "OCS_unistd.h"
+#include "OCS_stat.h"
+
+void Test_OS_FileMap_Impl(void)
+{
+    /* Test Case For:
+     * int32 OS_FileMap_Impl(const OS_object_token_t *token, size_t offset, size_t length, void **addr)
+     */
+    OS_object_token_t token;
+    struct OCS_stat   RefStat;
+    uint8             MapBuf[64];
+    void *            MapPtr;
+    void *            addr;
+
+    memset(&token, 0, sizeof(token));
+    memset(&RefStat, 0, sizeof(RefStat));
+    RefStat.st_size = 100;
+    MapPtr          = MapBuf;
+
+    /* fstat failure */
+    UT_SetDefaultReturnValue(UT_KEY(OCS_fstat), -1);
+    OSAPI_TEST_FUNCTION_RC(OS_FileMap_Impl, (&token, 0, 16, &addr), OS_ERROR);
+    UT_ClearDefaultReturnValue(UT_KEY(OCS_fstat));
+
+    /* ranges that start or end past EOF */
+    UT_SetDataBuffer(UT_KEY(OCS_fstat), &RefStat, sizeof(RefStat), false);
+    OSAPI_TEST_FUNCTION_RC(OS_FileMap_Impl, (&token, 101, 0, &addr), OS_ERR_INVALID_SIZE);
+    UT_SetDataBuffer(UT_KEY(OCS_fstat), &RefStat, sizeof(RefStat), false);
+    OSAPI_TEST_FUNCTION_RC(OS_FileMap_Impl, (&token, 50, 51, &addr), OS_ERR_INVALID_SIZE);
+    UtAssert_STUB_COUNT(OCS_mmap, 0);
+
+    /* mmap failure */
+    UT_SetDataBuffer(UT_KEY(OCS_fstat), &RefStat, sizeof(RefStat), false);
+    UT_SetDefaultReturnValue(UT_KEY(OCS_mmap), -1);
+    OSAPI_TEST_FUNCTION_RC(OS_FileMap_Impl, (&token, 0, 16, &addr), OS_ERROR);
+    UT_ClearDefaultReturnValue(UT_KEY(OCS_mmap));
+
+    /* nominal, an unaligned offset is mapped from the start of its page */
+    UT_SetDefaultReturnValue(UT_KEY(OCS_sysconf), 16);
+    UT_SetDataBuffer(UT_KEY(OCS_fstat), &RefStat, sizeof(RefStat), false);
+    UT_SetDataBuffer(UT_KEY(OCS_mmap), &MapPtr, sizeof(MapPtr), false);
+    OSAPI_TEST_FUNCTION_RC(OS_FileMap_Impl, (&token, 20, 30, &addr), OS_SUCCESS);
+    UtAssert_ADDRESS_EQ(addr, &MapBuf[4]);
+
+    /* nominal, the whole file, with the page size not available */
+    UT_SetDefaultReturnValue(UT_KEY(OCS_sysconf), -1);
+    UT_SetDataBuffer(UT_KEY(OCS_fstat), &RefStat, sizeof(RefStat), false);
+    UT_SetDataBuffer(UT_KEY(OCS_mmap), &MapPtr, sizeof(MapPtr), false);
+    OSAPI_TEST_FUNCTION_RC(OS_FileMap_Impl, (&token, 0, 100, &addr), OS_SUCCESS);
+    UtAssert_ADDRESS_EQ(addr, MapBuf);
+}
+
+void Test_OS_FileUnmap_Impl(void)
+{
+    /* Test Case For:
+     * int32 OS_FileUnmap_Impl(const OS_object_token_t *token, void *addr, size_t length)
+     */
+    OS_object_token_t token;
+    uint8             MapBuf[16];
+
+    memset(&token, 0, sizeof(token));
+
+    OSAPI_TEST_FUNCTION_RC(OS_FileUnmap_Impl, (&token, MapBuf, sizeof(MapBuf)), OS_SUCCESS);
+    UtAssert_STUB_COUNT(OCS_munmap, 1);
+
+    /* munmap failure */
+    UT_SetDefaultReturnValue(UT_KEY(OCS_munmap), -1);
+    OSAPI_TEST_FUNCTION_RC(OS_FileUnmap_Impl, (&token, MapBuf, sizeof(MapBuf)), OS_ERROR);
+}
+
+/* ------------------- End of test cases --------------------------------------*/
+
+/* Osapi_Test_Setup
+ *
+ * Purpose:
+ *   Called by the unit test tool to set up the app prior to each test
+ */
+void Osapi_Test_Setup(void)
+{
+    UT_ResetState(0);
+}
+
+/*
+ * Osapi_Test_Teardown
+ *
+ * Purpose:
+ *   Called by the unit test tool to tear down the app after each test
+ */
+void Osapi_Test_Teardown(void) {}
+
+/* UtTest_Setup
+ *
+ * Purpose:
+ *   Registers the test cases to execute with the unit test tool
+ */
+void UtTest_Setup(void)
+{
+    ADD_TEST(OS_FileMap_Impl);
+    ADD_TEST(OS_FileUnmap_Impl);
+}
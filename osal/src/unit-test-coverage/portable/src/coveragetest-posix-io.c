@@ -183,6 +183,63 @@ void Test_OS_GenericWrite_Impl(void)
     UT_SetHookFunction(UT_KEY(OS_SelectSingle_Impl), NULL, NULL);
 }
 
+void Test_OS_GenericPread_Impl(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_GenericPread_Impl(const OS_object_token_t *token, void *buffer, size_t nbytes, size_t offset)
+     */
+    char              SrcData[] = "ABCDEFGHIJKL";
+    char              DestData[sizeof(SrcData)];
+    OS_object_token_t token;
+
+    memset(&token, 0, sizeof(token));
+
+    UT_SetDataBuffer(UT_KEY(OCS_pread), SrcData, sizeof(SrcData), false);
+    OSAPI_TEST_FUNCTION_RC(OS_GenericPread_Impl, (&token, DestData, sizeof(DestData), 8), sizeof(DestData));
+    UtAssert_MemCmp(SrcData, DestData, sizeof(SrcData), "pread() data valid");
+
+    /* positioned reads never go through select() */
+    UtAssert_STUB_COUNT(OS_SelectSingle_Impl, 0);
+
+    /* pread() failure */
+    UT_SetDefaultReturnValue(UT_KEY(OCS_pread), -1);
+    OCS_errno = OCS_EINVAL;
+    OSAPI_TEST_FUNCTION_RC(OS_GenericPread_Impl, (&token, DestData, sizeof(DestData), 8), OS_ERROR);
+
+    /* not a seekable stream */
+    OCS_errno = OCS_ESPIPE;
+    OSAPI_TEST_FUNCTION_RC(OS_GenericPread_Impl, (&token, DestData, sizeof(DestData), 8),
+                           OS_ERR_OPERATION_NOT_SUPPORTED);
+}
+
+void Test_OS_GenericPwrite_Impl(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_GenericPwrite_Impl(const OS_object_token_t *token, const void *buffer, size_t nbytes, size_t offset)
+     */
+    char              SrcData[]                 = "ABCDEFGHIJKL";
+    char              DestData[sizeof(SrcData)] = {0};
+    OS_object_token_t token;
+
+    memset(&token, 0, sizeof(token));
+
+    UT_SetDataBuffer(UT_KEY(OCS_pwrite), DestData, sizeof(DestData), false);
+    OSAPI_TEST_FUNCTION_RC(OS_GenericPwrite_Impl, (&token, SrcData, sizeof(SrcData), 8), sizeof(SrcData));
+    UtAssert_MemCmp(SrcData, DestData, sizeof(SrcData), "pwrite() data valid");
+
+    /* pwrite() failure */
+    UT_SetDefaultReturnValue(UT_KEY(OCS_pwrite), -1);
+    OCS_errno = OCS_EINVAL;
+    OSAPI_TEST_FUNCTION_RC(OS_GenericPwrite_Impl, (&token, SrcData, sizeof(SrcData), 8), OS_ERROR);
+
+    /* not a seekable stream */
+    OCS_errno = OCS_ESPIPE;
+    OSAPI_TEST_FUNCTION_RC(OS_GenericPwrite_Impl, (&token, SrcData, sizeof(SrcData), 8),
+                           OS_ERR_OPERATION_NOT_SUPPORTED);
+}
+
 /* ------------------- End of test cases --------------------------------------*/
 
 /* Osapi_Test_Setup
@@ -218,4 +275,6 @@ void UtTest_Setup(void)
     ADD_TEST(OS_GenericSeek_Impl);
     ADD_TEST(OS_GenericRead_Impl);
     ADD_TEST(OS_GenericWrite_Impl);
+    ADD_TEST(OS_GenericPread_Impl);
+    ADD_TEST(OS_GenericPwrite_Impl);
 }
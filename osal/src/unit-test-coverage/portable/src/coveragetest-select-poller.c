@@ -0,0 +1,163 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * \file
+ * \ingroup  portable
+ *
+ */
+
+#include "os-portable-coveragetest.h"
+#include "ut-adaptor-portable-posix-io.h"
+
+#include "os-shared-poller.h"
+#include "os-shared-select.h"
+#include "os-shared-idmap.h"
+
+#include "OCS_string.h"
+
+void Test_OS_PollerCreate_Impl(void)
+{
+    /* Test Case For:
+     * int32 OS_PollerCreate_Impl(const OS_object_token_t *token, uint32 options)
+     */
+    OS_object_token_t token;
+
+    memset(&token, 0, sizeof(token));
+
+    OSAPI_TEST_FUNCTION_RC(OS_PollerCreate_Impl, (&token, 0), OS_SUCCESS);
+}
+
+void Test_OS_PollerDelete_Impl(void)
+{
+    /* Test Case For:
+     * int32 OS_PollerDelete_Impl(const OS_object_token_t *token)
+     */
+    OS_object_token_t token;
+
+    memset(&token, 0, sizeof(token));
+
+    OSAPI_TEST_FUNCTION_RC(OS_PollerDelete_Impl, (&token), OS_SUCCESS);
+}
+
+void Test_OS_PollerAdd_Impl(void)
+{
+    /* Test Case For:
+     * int32 OS_PollerAdd_Impl(const OS_object_token_t *token, const OS_object_token_t *stream_token,
+     *                         uint32 StateFlags, bool IsMember)
+     */
+    OS_object_token_t token;
+    OS_object_token_t stream_token;
+
+    memset(&token, 0, sizeof(token));
+    memset(&stream_token, 0, sizeof(stream_token));
+
+    OSAPI_TEST_FUNCTION_RC(OS_PollerAdd_Impl, (&token, &stream_token, OS_STREAM_STATE_READABLE, false),
+                           OS_ERR_OPERATION_NOT_SUPPORTED);
+
+    UT_PortablePosixIOTest_Set_Selectable(UT_INDEX_0, true);
+    OSAPI_TEST_FUNCTION_RC(OS_PollerAdd_Impl, (&token, &stream_token, OS_STREAM_STATE_READABLE, false), OS_SUCCESS);
+    OSAPI_TEST_FUNCTION_RC(OS_PollerAdd_Impl, (&token, &stream_token, OS_STREAM_STATE_WRITABLE, true), OS_SUCCESS);
+}
+
+void Test_OS_PollerRemove_Impl(void)
+{
+    /* Test Case For:
+     * int32 OS_PollerRemove_Impl(const OS_object_token_t *token, const OS_object_token_t *stream_token)
+     */
+    OS_object_token_t token;
+    OS_object_token_t stream_token;
+
+    memset(&token, 0, sizeof(token));
+    memset(&stream_token, 0, sizeof(stream_token));
+
+    OSAPI_TEST_FUNCTION_RC(OS_PollerRemove_Impl, (&token, &stream_token), OS_SUCCESS);
+}
+
+void Test_OS_PollerWait_Impl(void)
+{
+    /* Test Case For:
+     * int32 OS_PollerWait_Impl(const OS_object_token_t *token, OS_poller_event_t *events, uint32 max_events,
+     *                          uint32 *num_events, int32 msecs)
+     */
+    OS_object_token_t token;
+    OS_poller_event_t events[2];
+    uint32            num_events;
+
+    memset(&token, 0, sizeof(token));
+
+    /* stream 0 is watched for reading, stream 1 for writing, stream 2 for both */
+    OS_poller_table[0].ReadSet.object_ids[0]  = 0x05;
+    OS_poller_table[0].WriteSet.object_ids[0] = 0x06;
+    OS_global_stream_table[0].active_id       = OS_ObjectIdFromInteger(0x10000);
+    OS_global_stream_table[1].active_id       = OS_ObjectIdFromInteger(0x10001);
+    OS_global_stream_table[2].active_id       = OS_ObjectIdFromInteger(0x10002);
+
+    /* failure of the underlying select is passed back */
+    UT_SetDeferredRetcode(UT_KEY(OS_SelectMultiple_Impl), 1, OS_ERROR_TIMEOUT);
+    OSAPI_TEST_FUNCTION_RC(OS_PollerWait_Impl, (&token, events, 2, &num_events, 100), OS_ERROR_TIMEOUT);
+    UtAssert_STUB_COUNT(OS_Lock_Global, 1);
+    UtAssert_STUB_COUNT(OS_Unlock_Global, 1);
+
+    /* the stub leaves the sets as they are, so all members are ready; events beyond max_events wait */
+    OSAPI_TEST_FUNCTION_RC(OS_PollerWait_Impl, (&token, events, 2, &num_events, OS_PEND), OS_SUCCESS);
+    UtAssert_UINT32_EQ(num_events, 2);
+    UtAssert_UINT32_EQ(OS_ObjectIdToInteger(events[0].objid), 0x10000);
+    UtAssert_UINT32_EQ(events[0].StateFlags, OS_STREAM_STATE_READABLE);
+    UtAssert_UINT32_EQ(OS_ObjectIdToInteger(events[1].objid), 0x10001);
+    UtAssert_UINT32_EQ(events[1].StateFlags, OS_STREAM_STATE_WRITABLE);
+
+    OSAPI_TEST_FUNCTION_RC(OS_PollerWait_Impl, (&token, events, 1000, &num_events, OS_PEND), OS_SUCCESS);
+    UtAssert_UINT32_EQ(num_events, 3);
+}
+
+/* ------------------- End of test cases --------------------------------------*/
+
+/* Osapi_Test_Setup
+ *
+ * Purpose:
+ *   Called by the unit test tool to set up the app prior to each test
+ */
+void Osapi_Test_Setup(void)
+{
+    UT_ResetState(0);
+    UT_PortablePosixIOTest_ResetImpl(UT_INDEX_0);
+    memset(OS_poller_table, 0, sizeof(OS_poller_table));
+}
+
+/*
+ * Osapi_Test_Teardown
+ *
+ * Purpose:
+ *   Called by the unit test tool to tear down the app after each test
+ */
+void Osapi_Test_Teardown(void) {}
+
+/* UtTest_Setup
+ *
+ * Purpose:
+ *   Registers the test cases to execute with the unit test tool
+ */
+void UtTest_Setup(void)
+{
+    ADD_TEST(OS_PollerCreate_Impl);
+    ADD_TEST(OS_PollerDelete_Impl);
+    ADD_TEST(OS_PollerAdd_Impl);
+    ADD_TEST(OS_PollerRemove_Impl);
+    ADD_TEST(OS_PollerWait_Impl);
+}
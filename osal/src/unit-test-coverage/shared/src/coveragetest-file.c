@@ -24,10 +24,28 @@
  */
 #include "os-shared-coveragetest.h"
 #include "os-shared-file.h"
+#include "os-shared-poller.h"
 #include "os-shared-idmap.h"
 
 #include "OCS_string.h"
 
+static char UT_FileMapData[32];
+
+/*
+ * Stands in for a successful mapping by handing back a local buffer
+ */
+static int32 UT_FileMapImplHook(void *UserObj, int32 StubRetcode, uint32 CallCount, const UT_StubContext_t *Context)
+{
+    void **addr = UT_Hook_GetArgValueByName(Context, "addr", void **);
+
+    if (StubRetcode == OS_SUCCESS)
+    {
+        *addr = UT_FileMapData;
+    }
+
+    return StubRetcode;
+}
+
 /*
 **********************************************************************************
 **          PUBLIC API FUNCTIONS
@@ -90,6 +108,15 @@ void Test_OS_close(void)
      * int32 OS_close (uint32 filedes)
      */
     OSAPI_TEST_FUNCTION_RC(OS_close(UT_OBJID_1), OS_SUCCESS);
+    UtAssert_STUB_COUNT(OS_FileUnmap_Impl, 0);
+    UtAssert_STUB_COUNT(OS_PollerStreamClose, 1);
+
+    /* An outstanding mapping is released along with the handle */
+    OS_stream_table[1].map_addr = UT_FileMapData;
+    OS_stream_table[1].map_size = sizeof(UT_FileMapData);
+    OSAPI_TEST_FUNCTION_RC(OS_close(UT_OBJID_1), OS_SUCCESS);
+    UtAssert_STUB_COUNT(OS_FileUnmap_Impl, 1);
+    UtAssert_NULL(OS_stream_table[1].map_addr);
 
     UT_SetDefaultReturnValue(UT_KEY(OS_ObjectIdGetById), OS_ERR_INVALID_ID);
     OSAPI_TEST_FUNCTION_RC(OS_close(UT_OBJID_1), OS_ERR_INVALID_ID);
@@ -144,6 +171,205 @@ void Test_OS_TimedWrite(void)
     OSAPI_TEST_FUNCTION_RC(OS_TimedWrite(UT_OBJID_1, Buf, OSAL_SIZE_C(UINT32_MAX), 10), OS_ERR_INVALID_SIZE);
 }
 
+void Test_OS_pread(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_pread(osal_id_t filedes, void *buffer, size_t nbytes, size_t offset)
+     */
+    char  Buf[4]    = "zzz";
+    char  SrcBuf[8] = "ppppppp";
+    int32 expected  = sizeof(Buf);
+    int32 actual    = 0;
+
+    UT_SetDataBuffer(UT_KEY(OS_GenericPread_Impl), SrcBuf, sizeof(SrcBuf), false);
+    actual = OS_pread(UT_OBJID_1, Buf, sizeof(Buf), 100);
+    UtAssert_True(actual == expected, "OS_pread() (%ld) == %ld", (long)actual, (long)expected);
+    UtAssert_True(memcmp(Buf, SrcBuf, actual) == 0, "buffer content match");
+
+    /* The file position is not involved */
+    UtAssert_STUB_COUNT(OS_GenericSeek_Impl, 0);
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_ObjectIdGetById), OS_ERR_INVALID_ID);
+    OSAPI_TEST_FUNCTION_RC(OS_pread(UT_OBJID_1, Buf, sizeof(Buf), 100), OS_ERR_INVALID_ID);
+
+    OSAPI_TEST_FUNCTION_RC(OS_pread(UT_OBJID_1, NULL, sizeof(Buf), 100), OS_INVALID_POINTER);
+    OSAPI_TEST_FUNCTION_RC(OS_pread(UT_OBJID_1, Buf, OSAL_SIZE_C(0), 100), OS_ERR_INVALID_SIZE);
+    OSAPI_TEST_FUNCTION_RC(OS_pread(UT_OBJID_1, Buf, OSAL_SIZE_C(UINT32_MAX), 100), OS_ERR_INVALID_SIZE);
+}
+
+void Test_OS_pwrite(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_pwrite(osal_id_t filedes, const void *buffer, size_t nbytes, size_t offset)
+     */
+    const char Buf[4]    = "www";
+    char       DstBuf[8] = "zzz";
+    int32      expected  = sizeof(Buf);
+    int32      actual    = 0;
+
+    UT_SetDataBuffer(UT_KEY(OS_GenericPwrite_Impl), DstBuf, sizeof(DstBuf), false);
+    actual = OS_pwrite(UT_OBJID_1, Buf, sizeof(Buf), 100);
+    UtAssert_True(actual == expected, "OS_pwrite() (%ld) == %ld", (long)actual, (long)expected);
+    UtAssert_True(memcmp(Buf, DstBuf, actual) == 0, "buffer content match");
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_ObjectIdGetById), OS_ERR_INVALID_ID);
+    OSAPI_TEST_FUNCTION_RC(OS_pwrite(UT_OBJID_1, Buf, sizeof(Buf), 100), OS_ERR_INVALID_ID);
+
+    OSAPI_TEST_FUNCTION_RC(OS_pwrite(UT_OBJID_1, NULL, sizeof(Buf), 100), OS_INVALID_POINTER);
+    OSAPI_TEST_FUNCTION_RC(OS_pwrite(UT_OBJID_1, Buf, OSAL_SIZE_C(0), 100), OS_ERR_INVALID_SIZE);
+    OSAPI_TEST_FUNCTION_RC(OS_pwrite(UT_OBJID_1, Buf, OSAL_SIZE_C(UINT32_MAX), 100), OS_ERR_INVALID_SIZE);
+}
+
+void Test_OS_FileMap(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_FileMap(osal_id_t filedes, size_t offset, size_t length, void **addr)
+     */
+    void *addr;
+
+    UT_SetHookFunction(UT_KEY(OS_FileMap_Impl), UT_FileMapImplHook, NULL);
+    OSAPI_TEST_FUNCTION_RC(OS_FileMap(UT_OBJID_1, 0, sizeof(UT_FileMapData), &addr), OS_SUCCESS);
+    UtAssert_ADDRESS_EQ(addr, UT_FileMapData);
+    UtAssert_ADDRESS_EQ(OS_stream_table[1].map_addr, UT_FileMapData);
+    UtAssert_EQ(size_t, OS_stream_table[1].map_size, sizeof(UT_FileMapData));
+
+    /* Only one mapping per handle */
+    OSAPI_TEST_FUNCTION_RC(OS_FileMap(UT_OBJID_1, 0, sizeof(UT_FileMapData), &addr), OS_ERR_INCORRECT_OBJ_STATE);
+    UtAssert_NULL(addr);
+    UtAssert_STUB_COUNT(OS_FileMap_Impl, 1);
+
+    /* Failure in the implementation leaves the handle unmapped */
+    OS_stream_table[1].map_addr = NULL;
+    UT_SetDefaultReturnValue(UT_KEY(OS_FileMap_Impl), OS_ERR_NOT_IMPLEMENTED);
+    OSAPI_TEST_FUNCTION_RC(OS_FileMap(UT_OBJID_1, 0, sizeof(UT_FileMapData), &addr), OS_ERR_NOT_IMPLEMENTED);
+    UtAssert_NULL(addr);
+    UtAssert_NULL(OS_stream_table[1].map_addr);
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_ObjectIdGetById), OS_ERR_INVALID_ID);
+    OSAPI_TEST_FUNCTION_RC(OS_FileMap(UT_OBJID_1, 0, sizeof(UT_FileMapData), &addr), OS_ERR_INVALID_ID);
+
+    OSAPI_TEST_FUNCTION_RC(OS_FileMap(UT_OBJID_1, 0, sizeof(UT_FileMapData), NULL), OS_INVALID_POINTER);
+    OSAPI_TEST_FUNCTION_RC(OS_FileMap(UT_OBJID_1, 0, OSAL_SIZE_C(0), &addr), OS_ERR_INVALID_SIZE);
+}
+
+void Test_OS_FileUnmap(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_FileUnmap(osal_id_t filedes)
+     */
+
+    /* Not mapped */
+    OSAPI_TEST_FUNCTION_RC(OS_FileUnmap(UT_OBJID_1), OS_ERR_INCORRECT_OBJ_STATE);
+    UtAssert_STUB_COUNT(OS_FileUnmap_Impl, 0);
+
+    OS_stream_table[1].map_addr = UT_FileMapData;
+    OS_stream_table[1].map_size = sizeof(UT_FileMapData);
+
+    /* Failure in the implementation keeps the mapping */
+    UT_SetDeferredRetcode(UT_KEY(OS_FileUnmap_Impl), 1, OS_ERROR);
+    OSAPI_TEST_FUNCTION_RC(OS_FileUnmap(UT_OBJID_1), OS_ERROR);
+    UtAssert_ADDRESS_EQ(OS_stream_table[1].map_addr, UT_FileMapData);
+
+    OSAPI_TEST_FUNCTION_RC(OS_FileUnmap(UT_OBJID_1), OS_SUCCESS);
+    UtAssert_NULL(OS_stream_table[1].map_addr);
+    UtAssert_ZERO(OS_stream_table[1].map_size);
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_ObjectIdGetById), OS_ERR_INVALID_ID);
+    OSAPI_TEST_FUNCTION_RC(OS_FileUnmap(UT_OBJID_1), OS_ERR_INVALID_ID);
+}
+
+void Test_OS_FileAsyncSubmit(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_FileAsyncSubmit(const OS_file_async_request_t *request, osal_id_t completion_queue)
+     */
+    OS_file_async_request_t request;
+    char                    Buf[8];
+
+    memset(&request, 0, sizeof(request));
+    request.filedes = UT_OBJID_1;
+    request.opcode  = OS_FILE_ASYNC_READ;
+    request.buffer  = Buf;
+    request.nbytes  = sizeof(Buf);
+
+    OSAPI_TEST_FUNCTION_RC(OS_FileAsyncSubmit(&request, UT_OBJID_2), OS_SUCCESS);
+    UtAssert_STUB_COUNT(OS_FileAsyncSubmit_Impl, 1);
+    UtAssert_STUB_COUNT(OS_ObjectIdRelease, 1);
+
+    /* fsync does not need a buffer */
+    request.opcode = OS_FILE_ASYNC_FSYNC;
+    request.buffer = NULL;
+    request.nbytes = 0;
+    OSAPI_TEST_FUNCTION_RC(OS_FileAsyncSubmit(&request, UT_OBJID_2), OS_SUCCESS);
+
+    /* read/write do */
+    request.opcode = OS_FILE_ASYNC_WRITE;
+    OSAPI_TEST_FUNCTION_RC(OS_FileAsyncSubmit(&request, UT_OBJID_2), OS_INVALID_POINTER);
+    request.buffer = Buf;
+    OSAPI_TEST_FUNCTION_RC(OS_FileAsyncSubmit(&request, UT_OBJID_2), OS_ERR_INVALID_SIZE);
+    request.nbytes = sizeof(Buf);
+
+    request.opcode = 0;
+    OSAPI_TEST_FUNCTION_RC(OS_FileAsyncSubmit(&request, UT_OBJID_2), OS_ERR_OPERATION_NOT_SUPPORTED);
+    request.opcode = OS_FILE_ASYNC_WRITE;
+
+    OSAPI_TEST_FUNCTION_RC(OS_FileAsyncSubmit(NULL, UT_OBJID_2), OS_INVALID_POINTER);
+    UtAssert_STUB_COUNT(OS_FileAsyncSubmit_Impl, 2);
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_FileAsyncSubmit_Impl), OS_ERR_NO_FREE_IDS);
+    OSAPI_TEST_FUNCTION_RC(OS_FileAsyncSubmit(&request, UT_OBJID_2), OS_ERR_NO_FREE_IDS);
+    UT_ClearDefaultReturnValue(UT_KEY(OS_FileAsyncSubmit_Impl));
+
+    /* bad completion queue, then bad file handle */
+    UT_SetDeferredRetcode(UT_KEY(OS_ObjectIdGetById), 1, OS_ERR_INVALID_ID);
+    OSAPI_TEST_FUNCTION_RC(OS_FileAsyncSubmit(&request, UT_OBJID_2), OS_ERR_INVALID_ID);
+    UT_SetDeferredRetcode(UT_KEY(OS_ObjectIdGetById), 2, OS_ERR_INVALID_ID);
+    OSAPI_TEST_FUNCTION_RC(OS_FileAsyncSubmit(&request, UT_OBJID_2), OS_ERR_INVALID_ID);
+    UtAssert_STUB_COUNT(OS_FileAsyncSubmit_Impl, 3);
+}
+
+void Test_OS_FileAsyncComplete(void)
+{
+    /*
+     * Test Case For:
+     * void OS_FileAsyncComplete(OS_object_token_t *token, const OS_file_async_request_t *request,
+     *                           osal_id_t completion_queue, int32 result)
+     */
+    OS_object_token_t          token;
+    OS_file_async_request_t    request;
+    OS_file_async_completion_t completion;
+
+    memset(&token, 0, sizeof(token));
+    memset(&request, 0, sizeof(request));
+    memset(&completion, 0, sizeof(completion));
+    request.filedes  = UT_OBJID_1;
+    request.opcode   = OS_FILE_ASYNC_WRITE;
+    request.user_arg = &request;
+
+    OS_FileAsyncComplete(&token, &request, UT_OBJID_2, 8);
+    UtAssert_STUB_COUNT(OS_ObjectIdRelease, 1);
+    UtAssert_STUB_COUNT(OS_QueuePut, 1);
+
+    /* the queue stub keeps the message under the queue ID */
+    UtAssert_EQ(size_t,
+                UT_Stub_CopyToLocal((UT_EntryKey_t)OS_ObjectIdToInteger(UT_OBJID_2), &completion, sizeof(completion)),
+                sizeof(completion));
+    UtAssert_ADDRESS_EQ(completion.user_arg, &request);
+    UtAssert_True(OS_ObjectIdEqual(completion.filedes, UT_OBJID_1), "completion.filedes == UT_OBJID_1");
+    UtAssert_UINT32_EQ(completion.opcode, OS_FILE_ASYNC_WRITE);
+    UtAssert_INT32_EQ(completion.result, 8);
+
+    /* a full queue is only reported */
+    UT_SetDefaultReturnValue(UT_KEY(OS_QueuePut), OS_QUEUE_FULL);
+    OS_FileAsyncComplete(&token, &request, UT_OBJID_2, OS_ERROR);
+    UtAssert_STUB_COUNT(OS_ObjectIdRelease, 2);
+}
+
 void Test_OS_read(void)
 {
     /*
@@ -409,6 +635,12 @@ void UtTest_Setup(void)
     ADD_TEST(OS_close);
     ADD_TEST(OS_TimedRead);
     ADD_TEST(OS_TimedWrite);
+    ADD_TEST(OS_pread);
+    ADD_TEST(OS_pwrite);
+    ADD_TEST(OS_FileMap);
+    ADD_TEST(OS_FileUnmap);
+    ADD_TEST(OS_FileAsyncSubmit);
+    ADD_TEST(OS_FileAsyncComplete);
     ADD_TEST(OS_read);
     ADD_TEST(OS_write);
     ADD_TEST(OS_chmod);
@@ -63,7 +63,7 @@ void Test_OS_FileSysAddFixedMap(void)
     UT_SetDeferredRetcode(UT_KEY(OCS_memchr), 2, OS_ERROR);
     OSAPI_TEST_FUNCTION_RC(OS_FileSysAddFixedMap(&id, "/phys", "/virt"), OS_FS_ERR_PATH_TOO_LONG);
 
-    UT_SetDefaultReturnValue(UT_KEY(OCS_strrchr), -1);
+    UT_SetDefaultReturnValue(UT_KEY(OCS_strrchr), UTASSERT_STRINGBUF_NULL_TERM);
     UT_SetDeferredRetcode(UT_KEY(OCS_memchr), 3, OS_ERROR);
     OSAPI_TEST_FUNCTION_RC(OS_FileSysAddFixedMap(&id, "/phys", "/virt"), OS_ERR_NAME_TOO_LONG);
     UT_ResetState(UT_KEY(OCS_memchr));
@@ -302,7 +302,7 @@ void Test_OS_FileSysStatVolume(void)
     UT_ResetState(UT_KEY(OS_FileSysStatVolume_Impl));
 
     /* Verify OS_FS_ERR_PATH_TOO_LONG */
-    UT_SetDefaultReturnValue(UT_KEY(OCS_memchr), -1);
+    UT_SetDefaultReturnValue(UT_KEY(OCS_memchr), UTASSERT_STRINGBUF_NULL_TERM);
     expected = OS_FS_ERR_PATH_TOO_LONG;
     actual   = OS_FileSysStatVolume("/cf", &statbuf);
     UtAssert_True(actual == expected, "OS_FileSysStatVolume() (%ld) == OS_FS_ERR_PATH_TOO_LONG", (long)actual);
@@ -426,12 +426,18 @@ void Test_OS_TranslatePath(void)
         OS_FILESYS_FLAG_IS_READY | OS_FILESYS_FLAG_IS_MOUNTED_SYSTEM | OS_FILESYS_FLAG_IS_MOUNTED_VIRTUAL;
     strcpy(OS_filesys_table[1].virtual_mountpt, "/cf");
     strcpy(OS_filesys_table[1].system_mountpt, "/mnt/cf");
+    OS_UT_SetupIterator(OS_OBJECT_TYPE_OS_FILESYS, UT_INDEX_1, 1);
+    OS_FileSys_RefreshMountTable();
 
     actual = OS_TranslatePath("/cf/test", LocalBuffer);
     UtAssert_True(actual == expected, "OS_TranslatePath(/cf/test) (%ld) == OS_SUCCESS", (long)actual);
     UtAssert_True(strcmp(LocalBuffer, "/mnt/cf/test") == 0, "OS_TranslatePath(/cf/test) (%s)  == /mnt/cf/test",
                   LocalBuffer);
 
+    /* Exact mount point */
+    UtAssert_INT32_EQ(OS_TranslatePath("/cf", LocalBuffer), OS_SUCCESS);
+    UtAssert_STRINGBUF_EQ(LocalBuffer, sizeof(LocalBuffer), "/mnt/cf", UTASSERT_STRINGBUF_NULL_TERM);
+
     /* Check various error paths */
     UtAssert_INT32_EQ(OS_TranslatePath("/cf/test", NULL), OS_INVALID_POINTER);
     UtAssert_INT32_EQ(OS_TranslatePath(NULL, LocalBuffer), OS_INVALID_POINTER);
@@ -457,29 +463,89 @@ void Test_OS_TranslatePath(void)
     actual   = OS_TranslatePath("invalid/", LocalBuffer);
     UtAssert_True(actual == expected, "OS_TranslatePath() (%ld) == OS_FS_ERR_PATH_INVALID", (long)actual);
 
-    UT_SetDefaultReturnValue(UT_KEY(OS_ObjectIdGetBySearch), OS_ERR_NAME_NOT_FOUND);
-    actual = OS_TranslatePath("/cf/test", LocalBuffer);
-    UtAssert_True(actual == expected, "OS_TranslatePath() (%ld) == OS_FS_ERR_PATH_INVALID", (long)actual);
-    UT_ClearDefaultReturnValue(UT_KEY(OS_ObjectIdGetBySearch));
-
-    /* VirtPathLen < VirtPathBegin */
-    UT_SetDeferredRetcode(UT_KEY(OCS_memchr), 4, OS_ERROR);
-    expected = OS_FS_ERR_PATH_INVALID;
-    actual   = OS_TranslatePath("/cf/test", LocalBuffer);
-    UtAssert_True(actual == expected, "OS_TranslatePath(/cf/test) (%ld) == OS_FS_ERR_PATH_INVALID", (long)actual);
+    /* Not under any mount point, including a partial match of the last component */
+    UtAssert_INT32_EQ(OS_TranslatePath("/xx/test", LocalBuffer), OS_FS_ERR_PATH_INVALID);
+    UtAssert_INT32_EQ(OS_TranslatePath("/cfx/test", LocalBuffer), OS_FS_ERR_PATH_INVALID);
 
     /* (SysMountPointLen + VirtPathLen) > OS_MAX_LOCAL_PATH_LEN */
-    UT_SetDeferredRetcode(UT_KEY(OCS_memchr), 3, OS_ERROR);
-    expected = OS_FS_ERR_PATH_TOO_LONG;
-    actual   = OS_TranslatePath("/cf/test", LocalBuffer);
+    OS_filesys_mount_table.entries[0].system_len = OS_MAX_LOCAL_PATH_LEN - 1;
+    expected                                     = OS_FS_ERR_PATH_TOO_LONG;
+    actual                                       = OS_TranslatePath("/cf/test", LocalBuffer);
     UtAssert_True(actual == expected, "OS_TranslatePath(/cf/test) (%ld) == OS_FS_ERR_PATH_TOO_LONG", (long)actual);
 
-    OS_filesys_table[1].flags = 0;
-    expected                  = OS_ERR_INCORRECT_OBJ_STATE;
-    actual                    = OS_TranslatePath("/cf/test", LocalBuffer);
+    OS_filesys_mount_table.entries[0].is_system = false;
+    expected                                    = OS_ERR_INCORRECT_OBJ_STATE;
+    actual                                      = OS_TranslatePath("/cf/test", LocalBuffer);
     UtAssert_True(actual == expected, "OS_TranslatePath(/cf/test) (%ld) == OS_ERR_INCORRECT_OBJ_STATE", (long)actual);
 }
 
+void Test_OS_FileSys_MountTable(void)
+{
+    /*
+     * Test Case For:
+     * void OS_FileSys_RefreshMountTable(void)
+     * int32 OS_FileSys_FindMountEntry(const char *VirtualPath, OS_filesys_mount_entry_t *entry)
+     */
+    OS_filesys_mount_entry_t entry;
+    char                     LocalBuffer[OS_MAX_PATH_LEN];
+    uint32                   generation;
+
+    /* A nested mount, an unmounted FS, a virtual-only mount, and an empty mount point */
+    OS_filesys_table[1].flags =
+        OS_FILESYS_FLAG_IS_READY | OS_FILESYS_FLAG_IS_MOUNTED_SYSTEM | OS_FILESYS_FLAG_IS_MOUNTED_VIRTUAL;
+    strcpy(OS_filesys_table[1].virtual_mountpt, "/cf");
+    strcpy(OS_filesys_table[1].system_mountpt, "/mnt/cf");
+    OS_filesys_table[2].flags = OS_filesys_table[1].flags;
+    strcpy(OS_filesys_table[2].virtual_mountpt, "/cf/sub");
+    strcpy(OS_filesys_table[2].system_mountpt, "/mnt/sub");
+    OS_filesys_table[3].flags = OS_FILESYS_FLAG_IS_READY;
+    strcpy(OS_filesys_table[3].virtual_mountpt, "/old");
+    OS_filesys_table[4].flags = OS_FILESYS_FLAG_IS_READY | OS_FILESYS_FLAG_IS_MOUNTED_VIRTUAL;
+    strcpy(OS_filesys_table[4].virtual_mountpt, "/ram");
+    OS_filesys_table[5].flags = OS_FILESYS_FLAG_IS_READY | OS_FILESYS_FLAG_IS_MOUNTED_VIRTUAL;
+
+    OS_UT_SetupIterator(OS_OBJECT_TYPE_OS_FILESYS, UT_INDEX_1, 5);
+    OS_FileSys_RefreshMountTable();
+
+    UtAssert_UINT32_EQ(OS_filesys_mount_table.count, 3);
+    UtAssert_UINT32_EQ(OS_filesys_mount_table.generation, 2);
+    UtAssert_STRINGBUF_EQ(OS_filesys_mount_table.entries[0].virtual_mountpt, OS_MAX_PATH_LEN, "/cf/sub",
+                          UTASSERT_STRINGBUF_NULL_TERM);
+
+    /* The longest matching prefix wins, regardless of table order */
+    UtAssert_INT32_EQ(OS_TranslatePath("/cf/sub/file", LocalBuffer), OS_SUCCESS);
+    UtAssert_STRINGBUF_EQ(LocalBuffer, sizeof(LocalBuffer), "/mnt/sub/file", UTASSERT_STRINGBUF_NULL_TERM);
+    UtAssert_INT32_EQ(OS_TranslatePath("/cf/subx/file", LocalBuffer), OS_SUCCESS);
+    UtAssert_STRINGBUF_EQ(LocalBuffer, sizeof(LocalBuffer), "/mnt/cf/subx/file", UTASSERT_STRINGBUF_NULL_TERM);
+    UtAssert_INT32_EQ(OS_TranslatePath("/ram/file", LocalBuffer), OS_ERR_INCORRECT_OBJ_STATE);
+    UtAssert_INT32_EQ(OS_TranslatePath("/old/file", LocalBuffer), OS_FS_ERR_PATH_INVALID);
+
+    /* If a rebuild is in progress the lookup is done under the table lock */
+    generation                        = OS_filesys_mount_table.generation;
+    OS_filesys_mount_table.generation = generation + 1;
+    UtAssert_INT32_EQ(OS_FileSys_FindMountEntry("/cf/file", &entry), OS_SUCCESS);
+    UtAssert_STRINGBUF_EQ(entry.system_mountpt, sizeof(entry.system_mountpt), "/mnt/cf", UTASSERT_STRINGBUF_NULL_TERM);
+    UT_SetDeferredRetcode(UT_KEY(OS_ObjectIdTransactionInit), 1, OS_ERROR);
+    UtAssert_INT32_EQ(OS_FileSys_FindMountEntry("/cf/file", &entry), OS_FS_ERR_PATH_INVALID);
+    OS_filesys_mount_table.generation = generation;
+
+    /* A count that is out of range is never trusted */
+    OS_filesys_mount_table.count = OS_MAX_FILE_SYSTEMS + 1;
+    UtAssert_INT32_EQ(OS_FileSys_FindMountEntry("/cf/file", &entry), OS_FS_ERR_PATH_INVALID);
+
+    /* Failure to lock the table leaves it unchanged */
+    UT_SetDeferredRetcode(UT_KEY(OS_ObjectIdIterateActive), 1, OS_ERROR);
+    OS_FileSys_RefreshMountTable();
+    UtAssert_UINT32_EQ(OS_filesys_mount_table.generation, generation);
+
+    /* A system mount point that is too long is treated as not mounted */
+    OS_UT_SetupIterator(OS_OBJECT_TYPE_OS_FILESYS, UT_INDEX_1, 1);
+    UT_SetDeferredRetcode(UT_KEY(OCS_memchr), 2, OS_ERROR);
+    OS_FileSys_RefreshMountTable();
+    UtAssert_UINT32_EQ(OS_filesys_mount_table.count, 1);
+    UtAssert_BOOL_FALSE(OS_filesys_mount_table.entries[0].is_system);
+}
+
 void Test_OS_FileSys_FindVirtMountPoint(void)
 {
     /*
@@ -549,6 +615,7 @@ void Osapi_Test_Setup(void)
 {
     UT_ResetState(0);
     memset(OS_filesys_table, 0, sizeof(OS_filesys_table));
+    memset(&OS_filesys_mount_table, 0, sizeof(OS_filesys_mount_table));
 }
 
 /*
@@ -575,6 +642,7 @@ void UtTest_Setup(void)
     ADD_TEST(OS_FS_GetPhysDriveName);
     ADD_TEST(OS_GetFsInfo);
     ADD_TEST(OS_TranslatePath);
+    ADD_TEST(OS_FileSys_MountTable);
     ADD_TEST(OS_FileSys_FindVirtMountPoint);
     ADD_TEST(OS_FileSysStatVolume);
 }
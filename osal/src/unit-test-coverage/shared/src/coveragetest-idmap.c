@@ -459,9 +459,10 @@ void Test_OS_ObjectIdFindByName(void)
      * Nominal case (with no additional setup) should return OS_ERR_NAME_NOT_FOUND
      * Setting up a special matching entry should yield OS_SUCCESS
      */
-    char      TaskName[] = "UT_find";
-    osal_id_t objid;
-    int32     expected = OS_ERR_NAME_NOT_FOUND;
+    char              TaskName[] = "UT_find";
+    osal_id_t         objid;
+    OS_object_token_t token;
+    int32             expected = OS_ERR_NAME_NOT_FOUND;
     int32     actual   = OS_ObjectIdFindByName(OS_OBJECT_TYPE_UNDEFINED, NULL, &objid);
     UtAssert_True(actual == expected, "OS_ObjectFindIdByName(%s) (%ld) == OS_ERR_NAME_NOT_FOUND", "NULL", (long)actual);
 
@@ -488,16 +489,116 @@ void Test_OS_ObjectIdFindByName(void)
     /*
      * Set up for the ObjectIdSearch function to return success
      */
+    memset(&token, 0, sizeof(token));
+    token.obj_type                     = OS_OBJECT_TYPE_OS_TASK;
     OS_global_task_table[0].active_id  = UT_OBJID_OTHER;
     OS_global_task_table[0].name_entry = TaskName;
+    OS_ObjectIdNameIndexUpdate(&token);
     actual                             = OS_ObjectIdFindByName(OS_OBJECT_TYPE_OS_TASK, TaskName, &objid);
     expected                           = OS_SUCCESS;
     OS_global_task_table[0].active_id  = OS_OBJECT_ID_UNDEFINED;
     OS_global_task_table[0].name_entry = NULL;
+    OS_ObjectIdNameIndexUpdate(&token);
 
     UtAssert_True(actual == expected, "OS_ObjectFindIdByName(%s) (%ld) == OS_SUCCESS", TaskName, (long)actual);
 }
 
+void Test_OS_ObjectIdNameIndex(void)
+{
+    /*
+     * Test Case For:
+     * void OS_ObjectIdNameIndexUpdate(const OS_object_token_t *token)
+     * int32 OS_ObjectIdFindNameIndex(const char *name, OS_object_token_t *token)
+     * uint32 OS_ObjectNameHash(const char *name)
+     */
+    char              Names[3][OS_MAX_API_NAME];
+    uint32            bucket;
+    uint32            i;
+    OS_object_token_t token[3];
+    OS_object_token_t lookup;
+
+    /* The hash of an empty name is the FNV offset basis */
+    UtAssert_UINT32_EQ(OS_ObjectNameHash(""), 2166136261U);
+    UtAssert_True(OS_ObjectNameHash("UT_a") != OS_ObjectNameHash("UT_b"), "Different names hash differently");
+
+    /*
+     * Find three names that land in the same bucket, so that
+     * removal from the head, middle and tail of a chain are all exercised.
+     */
+    snprintf(Names[0], sizeof(Names[0]), "UT_idx");
+    bucket = OS_ObjectNameHash(Names[0]) % OS_MAX_TASKS;
+    for (i = 0; i < 1000; ++i)
+    {
+        snprintf(Names[1], sizeof(Names[1]), "UT_idx%u", (unsigned int)i);
+        if (OS_ObjectNameHash(Names[1]) % OS_MAX_TASKS == bucket)
+        {
+            break;
+        }
+    }
+    for (++i; i < 2000; ++i)
+    {
+        snprintf(Names[2], sizeof(Names[2]), "UT_idx%u", (unsigned int)i);
+        if (OS_ObjectNameHash(Names[2]) % OS_MAX_TASKS == bucket)
+        {
+            break;
+        }
+    }
+    UtAssert_UINT32_EQ(OS_ObjectNameHash(Names[1]) % OS_MAX_TASKS, bucket);
+    UtAssert_UINT32_EQ(OS_ObjectNameHash(Names[2]) % OS_MAX_TASKS, bucket);
+
+    for (i = 0; i < 3; ++i)
+    {
+        memset(&token[i], 0, sizeof(token[i]));
+        token[i].obj_type                      = OS_OBJECT_TYPE_OS_TASK;
+        token[i].obj_idx                       = OSAL_INDEX_C(i + 1);
+        OS_global_task_table[i + 1].active_id  = OS_ObjectIdFromInteger(0x10000 + i);
+        OS_global_task_table[i + 1].name_entry = Names[i];
+        OS_ObjectIdNameIndexUpdate(&token[i]);
+    }
+
+    /* All three should be found, with the matching ID */
+    memset(&lookup, 0, sizeof(lookup));
+    lookup.obj_type = OS_OBJECT_TYPE_OS_TASK;
+    for (i = 0; i < 3; ++i)
+    {
+        UtAssert_INT32_EQ(OS_ObjectIdFindNameIndex(Names[i], &lookup), OS_SUCCESS);
+        UtAssert_UINT32_EQ(lookup.obj_idx, i + 1);
+        UtAssert_UINT32_EQ(OS_ObjectIdToInteger(lookup.obj_id), 0x10000 + i);
+    }
+    UtAssert_INT32_EQ(OS_ObjectIdFindNameIndex("UT_nothere", &lookup), OS_ERR_NAME_NOT_FOUND);
+    UtAssert_Bool(!OS_ObjectIdDefined(lookup.obj_id), "!OS_ObjectIdDefined(lookup.obj_id)");
+
+    /* Renaming in place requires an update, after which only the new name is found */
+    OS_global_task_table[2].name_entry = "UT_renamed";
+    OS_ObjectIdNameIndexUpdate(&token[1]);
+    UtAssert_INT32_EQ(OS_ObjectIdFindNameIndex(Names[1], &lookup), OS_ERR_NAME_NOT_FOUND);
+    UtAssert_INT32_EQ(OS_ObjectIdFindNameIndex("UT_renamed", &lookup), OS_SUCCESS);
+    UtAssert_UINT32_EQ(lookup.obj_idx, 2);
+
+    /* Records that are no longer active are removed from the index */
+    for (i = 0; i < 3; ++i)
+    {
+        OS_global_task_table[i + 1].active_id = OS_OBJECT_ID_UNDEFINED;
+        OS_ObjectIdNameIndexUpdate(&token[i]);
+        UtAssert_INT32_EQ(OS_ObjectIdFindNameIndex(Names[i], &lookup), OS_ERR_NAME_NOT_FOUND);
+        OS_global_task_table[i + 1].name_entry = NULL;
+    }
+    UtAssert_INT32_EQ(OS_ObjectIdFindNameIndex("UT_renamed", &lookup), OS_ERR_NAME_NOT_FOUND);
+
+    /* An active record whose index entry is stale must not be matched */
+    OS_global_task_table[1].active_id  = UT_OBJID_OTHER;
+    OS_global_task_table[1].name_entry = "UT_stale";
+    UtAssert_INT32_EQ(OS_ObjectIdFindNameIndex("UT_stale", &lookup), OS_ERR_NAME_NOT_FOUND);
+    OS_global_task_table[1].active_id  = OS_OBJECT_ID_UNDEFINED;
+    OS_global_task_table[1].name_entry = NULL;
+
+    /* Out of range tokens and unsupported types are ignored */
+    token[0].obj_idx = OSAL_INDEX_C(OS_MAX_TASKS);
+    OS_ObjectIdNameIndexUpdate(&token[0]);
+    lookup.obj_type = OS_OBJECT_TYPE_UNDEFINED;
+    UtAssert_INT32_EQ(OS_ObjectIdFindNameIndex("UT_idx", &lookup), OS_ERR_NAME_NOT_FOUND);
+}
+
 void Test_OS_ObjectIdGetById(void)
 {
     /*
@@ -1041,7 +1142,7 @@ void Test_OS_ForEachObject(void)
     UtAssert_True(Count.TaskCount == 1, "OS_ForEachObject() TaskCount (%lu) == 1", (unsigned long)Count.TaskCount);
     UtAssert_True(Count.QueueCount == 1, "OS_ForEachObject() QueueCount (%lu) == 1", (unsigned long)Count.QueueCount);
     UtAssert_True(Count.MutexCount == 1, "OS_ForEachObject() MutexCount (%lu) == 1", (unsigned long)Count.MutexCount);
-    UtAssert_True(Count.OtherCount == 10, "OS_ForEachObject() OtherCount (%lu) == 9", (unsigned long)Count.OtherCount);
+    UtAssert_True(Count.OtherCount == 11, "OS_ForEachObject() OtherCount (%lu) == 11", (unsigned long)Count.OtherCount);
 
     OS_ForEachObjectOfType(OS_OBJECT_TYPE_OS_QUEUE, self_id.id, ObjTypeCounter, &Count);
     UtAssert_True(Count.TaskCount == 1, "OS_ForEachObjectOfType(), creator %08lx TaskCount (%lu) == 1",
@@ -1253,6 +1354,7 @@ void UtTest_Setup(void)
     ADD_TEST(OS_ObjectIdFindNextFree);
     ADD_TEST(OS_ObjectIdToArrayIndex);
     ADD_TEST(OS_ObjectIdFindByName);
+    ADD_TEST(OS_ObjectIdNameIndex);
     ADD_TEST(OS_ObjectIdGetById);
     ADD_TEST(OS_ObjectIdTransaction);
     ADD_TEST(OS_ObjectIdAllocateNew);
@@ -0,0 +1,240 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * \file
+ * \ingroup  shared
+ */
+#include "os-shared-coveragetest.h"
+#include "os-shared-poller.h"
+
+#include "OCS_string.h"
+
+/*
+**********************************************************************************
+**          PUBLIC API FUNCTIONS
+**********************************************************************************
+*/
+
+void Test_OS_PollerAPI_Init(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_PollerAPI_Init(void)
+     */
+    OSAPI_TEST_FUNCTION_RC(OS_PollerAPI_Init(), OS_SUCCESS);
+}
+
+void Test_OS_PollerCreate(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_PollerCreate(osal_id_t *poller_id, const char *poller_name, uint32 options)
+     */
+    osal_id_t objid = OS_OBJECT_ID_UNDEFINED;
+
+    OSAPI_TEST_FUNCTION_RC(OS_PollerCreate(&objid, "UT", 0), OS_SUCCESS);
+    OSAPI_TEST_OBJID(objid, !=, OS_OBJECT_ID_UNDEFINED);
+
+    OSAPI_TEST_FUNCTION_RC(OS_PollerCreate(NULL, "UT", 0), OS_INVALID_POINTER);
+    OSAPI_TEST_FUNCTION_RC(OS_PollerCreate(&objid, NULL, 0), OS_INVALID_POINTER);
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_ObjectIdAllocateNew), OS_ERROR);
+    OSAPI_TEST_FUNCTION_RC(OS_PollerCreate(&objid, "UT", 0), OS_ERROR);
+
+    UT_SetDefaultReturnValue(UT_KEY(OCS_memchr), OS_ERROR);
+    OSAPI_TEST_FUNCTION_RC(OS_PollerCreate(&objid, "UT", 0), OS_ERR_NAME_TOO_LONG);
+}
+
+void Test_OS_PollerDelete(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_PollerDelete(osal_id_t poller_id)
+     */
+    OSAPI_TEST_FUNCTION_RC(OS_PollerDelete(UT_OBJID_1), OS_SUCCESS);
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_ObjectIdGetById), OS_ERROR);
+    OSAPI_TEST_FUNCTION_RC(OS_PollerDelete(UT_OBJID_1), OS_ERROR);
+}
+
+void Test_OS_PollerAdd(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_PollerAdd(osal_id_t poller_id, osal_id_t objid, uint32 StateFlags)
+     */
+
+    /* first add makes the stream a member, no removal needed */
+    OSAPI_TEST_FUNCTION_RC(OS_PollerAdd(UT_OBJID_1, UT_OBJID_1, OS_STREAM_STATE_READABLE), OS_SUCCESS);
+    UtAssert_STUB_COUNT(OS_PollerAdd_Impl, 1);
+    UtAssert_STUB_COUNT(OS_PollerRemove_Impl, 0);
+
+    /* adding again changes the watched states of the existing registration */
+    OSAPI_TEST_FUNCTION_RC(OS_PollerAdd(UT_OBJID_1, UT_OBJID_1, OS_STREAM_STATE_WRITABLE), OS_SUCCESS);
+    UtAssert_STUB_COUNT(OS_PollerAdd_Impl, 2);
+    UtAssert_STUB_COUNT(OS_PollerRemove_Impl, 0);
+
+    /* failure to change the registration leaves the stream a member */
+    UT_SetDeferredRetcode(UT_KEY(OS_PollerAdd_Impl), 1, OS_ERROR);
+    OSAPI_TEST_FUNCTION_RC(OS_PollerAdd(UT_OBJID_1, UT_OBJID_1, OS_STREAM_STATE_READABLE), OS_ERROR);
+    OSAPI_TEST_FUNCTION_RC(OS_PollerRemove(UT_OBJID_1, UT_OBJID_1), OS_SUCCESS);
+
+    UT_SetDeferredRetcode(UT_KEY(OS_PollerAdd_Impl), 1, OS_ERR_OPERATION_NOT_SUPPORTED);
+    OSAPI_TEST_FUNCTION_RC(OS_PollerAdd(UT_OBJID_1, UT_OBJID_2, OS_STREAM_STATE_READABLE),
+                           OS_ERR_OPERATION_NOT_SUPPORTED);
+
+    OSAPI_TEST_FUNCTION_RC(OS_PollerAdd(UT_OBJID_1, UT_OBJID_2, 0), OS_ERR_INVALID_ARGUMENT);
+
+    UT_SetDeferredRetcode(UT_KEY(OS_ObjectIdGetById), 2, OS_ERR_INVALID_ID);
+    OSAPI_TEST_FUNCTION_RC(OS_PollerAdd(UT_OBJID_1, UT_OBJID_2, OS_STREAM_STATE_READABLE), OS_ERR_INVALID_ID);
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_ObjectIdGetById), OS_ERR_INVALID_ID);
+    OSAPI_TEST_FUNCTION_RC(OS_PollerAdd(UT_OBJID_1, UT_OBJID_2, OS_STREAM_STATE_READABLE), OS_ERR_INVALID_ID);
+}
+
+void Test_OS_PollerRemove(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_PollerRemove(osal_id_t poller_id, osal_id_t objid)
+     */
+    OS_PollerAPI_Init();
+
+    /* stream is not a member yet */
+    OSAPI_TEST_FUNCTION_RC(OS_PollerRemove(UT_OBJID_1, UT_OBJID_1), OS_ERR_INCORRECT_OBJ_STATE);
+
+    OSAPI_TEST_FUNCTION_RC(OS_PollerAdd(UT_OBJID_1, UT_OBJID_1, OS_STREAM_STATE_READABLE), OS_SUCCESS);
+
+    UT_SetDeferredRetcode(UT_KEY(OS_PollerRemove_Impl), 1, OS_ERROR);
+    OSAPI_TEST_FUNCTION_RC(OS_PollerRemove(UT_OBJID_1, UT_OBJID_1), OS_ERROR);
+
+    OSAPI_TEST_FUNCTION_RC(OS_PollerRemove(UT_OBJID_1, UT_OBJID_1), OS_SUCCESS);
+    OSAPI_TEST_FUNCTION_RC(OS_PollerRemove(UT_OBJID_1, UT_OBJID_1), OS_ERR_INCORRECT_OBJ_STATE);
+
+    UT_SetDeferredRetcode(UT_KEY(OS_ObjectIdGetById), 2, OS_ERR_INVALID_ID);
+    OSAPI_TEST_FUNCTION_RC(OS_PollerRemove(UT_OBJID_1, UT_OBJID_1), OS_ERR_INVALID_ID);
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_ObjectIdGetById), OS_ERR_INVALID_ID);
+    OSAPI_TEST_FUNCTION_RC(OS_PollerRemove(UT_OBJID_1, UT_OBJID_1), OS_ERR_INVALID_ID);
+}
+
+void Test_OS_PollerStreamClose(void)
+{
+    /*
+     * Test Case For:
+     * void OS_PollerStreamClose(const OS_object_token_t *stream_token)
+     */
+    OS_object_token_t stream_token;
+
+    memset(&stream_token, 0, sizeof(stream_token));
+    stream_token.obj_type = OS_OBJECT_TYPE_OS_STREAM;
+    stream_token.obj_idx  = UT_INDEX_1;
+
+    /* no pollers */
+    UtAssert_VOIDCALL(OS_PollerStreamClose(&stream_token));
+    UtAssert_STUB_COUNT(OS_PollerRemove_Impl, 0);
+
+    /* stream is a member of the second of two pollers */
+    OSAPI_TEST_FUNCTION_RC(OS_PollerAdd(UT_OBJID_2, UT_OBJID_1, OS_STREAM_STATE_READABLE), OS_SUCCESS);
+    OS_UT_SetupIterator(OS_OBJECT_TYPE_OS_POLLER, UT_INDEX_1, 2);
+    UT_SetDeferredRetcode(UT_KEY(OS_PollerRemove_Impl), 1, OS_ERROR);
+    UtAssert_VOIDCALL(OS_PollerStreamClose(&stream_token));
+    UtAssert_STUB_COUNT(OS_PollerRemove_Impl, 1);
+
+    /* membership is dropped even though the removal failed */
+    OSAPI_TEST_FUNCTION_RC(OS_PollerRemove(UT_OBJID_2, UT_OBJID_1), OS_ERR_INCORRECT_OBJ_STATE);
+}
+
+void Test_OS_PollerWait(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_PollerWait(osal_id_t poller_id, OS_poller_event_t *events, uint32 max_events, uint32 *num_events,
+     *                     int32 msecs)
+     */
+    OS_poller_event_t events[2];
+    uint32            num_events;
+
+    num_events = 99;
+    OSAPI_TEST_FUNCTION_RC(OS_PollerWait(UT_OBJID_1, events, 2, &num_events, 0), OS_SUCCESS);
+    UtAssert_UINT32_EQ(num_events, 0);
+
+    OSAPI_TEST_FUNCTION_RC(OS_PollerWait(UT_OBJID_1, NULL, 2, &num_events, 0), OS_INVALID_POINTER);
+    OSAPI_TEST_FUNCTION_RC(OS_PollerWait(UT_OBJID_1, events, 2, NULL, 0), OS_INVALID_POINTER);
+    OSAPI_TEST_FUNCTION_RC(OS_PollerWait(UT_OBJID_1, events, 0, &num_events, 0), OS_ERR_INVALID_SIZE);
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_PollerWait_Impl), OS_ERROR_TIMEOUT);
+    OSAPI_TEST_FUNCTION_RC(OS_PollerWait(UT_OBJID_1, events, 2, &num_events, 0), OS_ERROR_TIMEOUT);
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_ObjectIdGetById), OS_ERR_INVALID_ID);
+    OSAPI_TEST_FUNCTION_RC(OS_PollerWait(UT_OBJID_1, events, 2, &num_events, 0), OS_ERR_INVALID_ID);
+}
+
+void Test_OS_PollerGetIdByName(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_PollerGetIdByName(osal_id_t *poller_id, const char *poller_name)
+     */
+    osal_id_t objid = OS_OBJECT_ID_UNDEFINED;
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_ObjectIdFindByName), OS_SUCCESS);
+    OSAPI_TEST_FUNCTION_RC(OS_PollerGetIdByName(&objid, "UT"), OS_SUCCESS);
+    OSAPI_TEST_OBJID(objid, !=, OS_OBJECT_ID_UNDEFINED);
+    UT_ClearDefaultReturnValue(UT_KEY(OS_ObjectIdFindByName));
+
+    OSAPI_TEST_FUNCTION_RC(OS_PollerGetIdByName(&objid, "NF"), OS_ERR_NAME_NOT_FOUND);
+
+    OSAPI_TEST_FUNCTION_RC(OS_PollerGetIdByName(NULL, "UT"), OS_INVALID_POINTER);
+    OSAPI_TEST_FUNCTION_RC(OS_PollerGetIdByName(&objid, NULL), OS_INVALID_POINTER);
+}
+
+/* Osapi_Test_Setup
+ *
+ * Purpose:
+ *   Called by the unit test tool to set up the app prior to each test
+ */
+void Osapi_Test_Setup(void)
+{
+    UT_ResetState(0);
+    memset(OS_poller_table, 0, sizeof(OS_poller_table));
+}
+
+/*
+ * Osapi_Test_Teardown
+ *
+ * Purpose:
+ *   Called by the unit test tool to tear down the app after each test
+ */
+void Osapi_Test_Teardown(void) {}
+
+/*
+ * Register the test cases to execute with the unit test tool
+ */
+void UtTest_Setup(void)
+{
+    ADD_TEST(OS_PollerAPI_Init);
+    ADD_TEST(OS_PollerCreate);
+    ADD_TEST(OS_PollerDelete);
+    ADD_TEST(OS_PollerAdd);
+    ADD_TEST(OS_PollerRemove);
+    ADD_TEST(OS_PollerStreamClose);
+    ADD_TEST(OS_PollerWait);
+    ADD_TEST(OS_PollerGetIdByName);
+}
@@ -28,7 +28,8 @@
 
 #include "OCS_stdio.h"
 
-char TestConsoleBuffer[16];
+/* must be a power of two in size, and aligned for the record headers */
+uint32 TestConsoleBuffer[8];
 
 void Test_OS_ConsoleAPI_Init(void)
 {
@@ -70,48 +71,49 @@ void Test_OS_printf(void)
     OS_SharedGlobalVars.PrintfConsoleId = OS_OBJECT_ID_UNDEFINED;
     OS_SharedGlobalVars.GlobalState     = 0;
     OS_printf("UnitTest1");
-    UtAssert_True(OS_console_table[0].WritePos == 0, "WritePos (%lu) >= 0",
-                  (unsigned long)OS_console_table[0].WritePos);
+    UtAssert_UINT32_EQ(OS_console_table[0].ReservePos, 0);
 
     /* because printf is disabled, the call count should _not_ increase here */
     OS_SharedGlobalVars.GlobalState = OS_INIT_MAGIC_NUMBER;
     OS_printf_disable();
     OS_printf("UnitTest2");
-    UtAssert_True(OS_console_table[0].WritePos == 0, "WritePos (%lu) >= 0",
-                  (unsigned long)OS_console_table[0].WritePos);
+    UtAssert_UINT32_EQ(OS_console_table[0].ReservePos, 0);
 
-    /* normal case - sync mode */
+    /* normal case - sync mode, 10 chars use a 16 byte record */
     OS_console_table[0].IsAsync = false;
     OS_printf_enable();
     OS_printf("UnitTest3s");
     UtAssert_STUB_COUNT(OS_ConsoleWakeup_Impl, 0);
     UtAssert_STUB_COUNT(OS_ConsoleOutput_Impl, 1);
-    UtAssert_True(OS_console_table[0].WritePos >= 10, "WritePos (%lu) >= 10",
-                  (unsigned long)OS_console_table[0].WritePos);
+    UtAssert_UINT32_EQ(OS_console_table[0].ReservePos, 16);
+    UtAssert_UINT32_EQ(OS_console_table[0].MessageCount, 1);
 
-    /* normal case - async mode */
-    OS_console_table[0].IsAsync  = true;
-    OS_console_table[0].WritePos = 0;
+    /* normal case - async mode, this fills the 32 byte buffer */
+    OS_console_table[0].IsAsync = true;
     OS_printf("UnitTest3a");
     UtAssert_STUB_COUNT(OS_ConsoleWakeup_Impl, 1);
     UtAssert_STUB_COUNT(OS_ConsoleOutput_Impl, 1);
-    UtAssert_True(OS_console_table[0].WritePos >= 10, "WritePos (%lu) >= 10",
-                  (unsigned long)OS_console_table[0].WritePos);
+    UtAssert_UINT32_EQ(OS_console_table[0].ReservePos, 32);
+    UtAssert_UINT32_EQ(OS_console_table[0].MessageCount, 2);
+    UtAssert_UINT32_EQ(OS_console_table[0].HighWaterMark, 32);
 
-    /* print a long string that does not fit in the 16-char buffer */
-    OS_printf_enable();
-    OS_printf("UnitTest4BufferLengthExceeded");
+    /* nothing has been read, so the next line does not fit */
+    OS_printf("UnitTest4");
     UtAssert_UINT32_EQ(OS_console_table[0].OverflowEvents, 1);
+    UtAssert_UINT32_EQ(OS_console_table[0].DroppedBytes, 9);
+    UtAssert_UINT32_EQ(OS_console_table[0].ReservePos, 32);
+    UtAssert_UINT32_EQ(OS_console_table[0].MessageCount, 2);
+
+    /* a line longer than the entire buffer never fits */
+    OS_console_table[0].ReservePos = 0;
+    OS_printf("UnitTest4BufferLengthExceeded");
+    UtAssert_UINT32_EQ(OS_console_table[0].OverflowEvents, 2);
 
     /* test writing with a non-empty console name */
     strncpy(OS_console_table[0].device_name, "ut", sizeof(OS_console_table[0].device_name) - 1);
     OS_printf("UnitTest5");
-
-    /* Cover branch for console name overflowing buffer*/
-    OS_console_table[0].WritePos = 0;
-    OS_console_table[0].ReadPos  = 1;
-    OS_printf("UnitTest5.5");
-    UtAssert_UINT32_EQ(OS_console_table[0].OverflowEvents, 3);
+    UtAssert_UINT32_EQ(OS_console_table[0].ReservePos, 16);
+    UtAssert_UINT32_EQ(OS_console_table[0].MessageCount, 3);
 
     /*
      * For coverage, exercise different paths depending on the return value
@@ -132,6 +134,89 @@ void Test_OS_printf(void)
     UtAssert_STUB_COUNT(OS_ConsoleWakeup_Impl, 0);
 }
 
+void Test_OS_ConsoleRead(void)
+{
+    /*
+     * Test Case For:
+     * size_t OS_ConsoleRead(const OS_object_token_t *token, char *Buf, size_t BufSize)
+     */
+    OS_object_token_t token;
+    char              ReadBuf[32];
+
+    memset(&token, 0, sizeof(token));
+    token.obj_type = OS_OBJECT_TYPE_OS_CONSOLE;
+    token.obj_idx  = UT_INDEX_0;
+
+    OS_SharedGlobalVars.GlobalState   = OS_INIT_MAGIC_NUMBER;
+    OS_SharedGlobalVars.PrintfEnabled = true;
+    OS_console_table[0].IsAsync       = true;
+
+    /* nothing written */
+    UtAssert_UINT32_EQ(OS_ConsoleRead(&token, ReadBuf, sizeof(ReadBuf)), 0);
+
+    /* two records, both returned in order */
+    OS_printf("UnitTest1");
+    OS_printf("UnitTest2");
+    memset(ReadBuf, 0, sizeof(ReadBuf));
+    UtAssert_UINT32_EQ(OS_ConsoleRead(&token, ReadBuf, sizeof(ReadBuf)), 18);
+    UtAssert_STRINGBUF_EQ(ReadBuf, sizeof(ReadBuf), "UnitTest1UnitTest2", 18);
+    UtAssert_UINT32_EQ(OS_console_table[0].ReadPos, 32);
+    UtAssert_UINT32_EQ(TestConsoleBuffer[0], 0);
+    UtAssert_UINT32_EQ(TestConsoleBuffer[4], 0);
+
+    /* the freed space can be reused */
+    OS_printf("UnitTest3");
+    UtAssert_UINT32_EQ(OS_console_table[0].OverflowEvents, 0);
+
+    /* does not fit in the output buffer, so it stays in the console buffer */
+    UtAssert_UINT32_EQ(OS_ConsoleRead(&token, ReadBuf, 4), 0);
+    UtAssert_UINT32_EQ(OS_console_table[0].ReadPos, 32);
+    UtAssert_UINT32_EQ(OS_ConsoleRead(&token, ReadBuf, sizeof(ReadBuf)), 9);
+
+    /* a record that wraps around the end of the buffer */
+    OS_console_table[0].ReservePos = 24;
+    OS_console_table[0].ReadPos    = 24;
+    OS_printf("UnitTest4ab");
+    memset(ReadBuf, 0, sizeof(ReadBuf));
+    UtAssert_UINT32_EQ(OS_ConsoleRead(&token, ReadBuf, sizeof(ReadBuf)), 11);
+    UtAssert_STRINGBUF_EQ(ReadBuf, sizeof(ReadBuf), "UnitTest4ab", 11);
+    UtAssert_UINT32_EQ(OS_console_table[0].ReadPos, 40);
+    UtAssert_UINT32_EQ(TestConsoleBuffer[0], 0);
+
+    /* space reserved but the writer has not committed yet */
+    OS_console_table[0].ReservePos += 16;
+    UtAssert_UINT32_EQ(OS_ConsoleRead(&token, ReadBuf, sizeof(ReadBuf)), 0);
+    UtAssert_UINT32_EQ(OS_console_table[0].ReadPos, 40);
+}
+
+void Test_OS_printf_GetStats(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_printf_GetStats(OS_printf_stats_t *stats)
+     */
+    OS_printf_stats_t stats;
+
+    OS_console_table[0].MessageCount     = 1;
+    OS_console_table[0].OverflowEvents   = 2;
+    OS_console_table[0].ContentionEvents = 3;
+    OS_console_table[0].DroppedBytes     = 4;
+    OS_console_table[0].HighWaterMark    = 5;
+
+    OSAPI_TEST_FUNCTION_RC(OS_printf_GetStats(&stats), OS_SUCCESS);
+    UtAssert_UINT32_EQ(stats.MessageCount, 1);
+    UtAssert_UINT32_EQ(stats.OverflowEvents, 2);
+    UtAssert_UINT32_EQ(stats.ContentionEvents, 3);
+    UtAssert_UINT32_EQ(stats.DroppedBytes, 4);
+    UtAssert_UINT32_EQ(stats.HighWaterMark, 5);
+    UtAssert_UINT32_EQ(stats.BufferSize, sizeof(TestConsoleBuffer));
+
+    OSAPI_TEST_FUNCTION_RC(OS_printf_GetStats(NULL), OS_INVALID_POINTER);
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_ObjectIdGetById), OS_ERR_INVALID_ID);
+    OSAPI_TEST_FUNCTION_RC(OS_printf_GetStats(&stats), OS_ERR_INVALID_ID);
+}
+
 /* Osapi_Test_Setup
  *
  * Purpose:
@@ -142,7 +227,8 @@ void Osapi_Test_Setup(void)
     UT_ResetState(0);
     memset(OS_console_table, 0, sizeof(OS_console_table));
     memset(&OS_SharedGlobalVars, 0, sizeof(OS_SharedGlobalVars));
-    OS_console_table[0].BufBase = TestConsoleBuffer;
+    memset(TestConsoleBuffer, 0, sizeof(TestConsoleBuffer));
+    OS_console_table[0].BufBase = (char *)TestConsoleBuffer;
     OS_console_table[0].BufSize = sizeof(TestConsoleBuffer);
 }
 
@@ -161,4 +247,6 @@ void UtTest_Setup(void)
 {
     ADD_TEST(OS_ConsoleAPI_Init);
     ADD_TEST(OS_printf);
+    ADD_TEST(OS_ConsoleRead);
+    ADD_TEST(OS_printf_GetStats);
 }
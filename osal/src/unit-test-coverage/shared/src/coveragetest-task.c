@@ -128,6 +128,15 @@ void Test_OS_TaskCreate(void)
     OSAPI_TEST_FUNCTION_RC(
         OS_TaskCreate(&objid, "UT", UT_TestHook, OSAL_TASK_STACK_ALLOCATE, OSAL_SIZE_C(128), OSAL_PRIORITY_C(0), 0),
         OS_ERR_NO_FREE_IDS);
+
+    /* Policy and affinity flags */
+    OSAPI_TEST_FUNCTION_RC(OS_TaskCreate(&objid, "UT", UT_TestHook, OSAL_TASK_STACK_ALLOCATE, OSAL_SIZE_C(128),
+                                         OSAL_PRIORITY_C(0), OS_TASK_SCHED_RR | OS_TASK_CPU_AFFINITY(0x3)),
+                           OS_SUCCESS);
+    UtAssert_UINT32_EQ(OS_task_table[UT_GetStubCount(UT_KEY(OS_ObjectIdAllocateNew))].cpu_affinity, 0x3);
+    OSAPI_TEST_FUNCTION_RC(OS_TaskCreate(&objid, "UT", UT_TestHook, OSAL_TASK_STACK_ALLOCATE, OSAL_SIZE_C(128),
+                                         OSAL_PRIORITY_C(0), OS_TASK_SCHED_RR | OS_TASK_SCHED_FIFO),
+                           OS_ERR_INVALID_ARGUMENT);
 }
 
 void Test_OS_TaskDelete(void)
@@ -244,7 +253,11 @@ void Test_OS_TaskGetInfo(void)
     OS_task_table[1].stack_size = OSAL_SIZE_C(222);
     OS_task_table[1].priority   = OSAL_PRIORITY_C(133);
 
+    OS_task_table[1].cpu_affinity = 0x4;
+
     OSAPI_TEST_FUNCTION_RC(OS_TaskGetInfo(UT_OBJID_1, &task_prop), OS_SUCCESS);
+    UtAssert_UINT32_EQ(task_prop.cpu_affinity, 0x4);
+    UtAssert_STUB_COUNT(OS_TaskGetInfo_Impl, 1);
     OSAPI_TEST_OBJID(task_prop.creator, ==, UT_OBJID_OTHER);
     UtAssert_True(strcmp(task_prop.name, "ABC") == 0, "task_prop.name (%s) == ABC", task_prop.name);
     UtAssert_True(task_prop.stack_size == 222, "task_prop.stack_size (%lu) == 222",
@@ -264,6 +277,11 @@ void Test_OS_TaskGetInfo(void)
 
     UT_SetDeferredRetcode(UT_KEY(OS_ObjectIdGetById), 1, OS_ERR_INVALID_ID);
     OSAPI_TEST_FUNCTION_RC(OS_TaskGetInfo(UT_OBJID_1, &task_prop), OS_ERR_INVALID_ID);
+
+    /* Task deleted after the common properties were read, before the OS was queried */
+    UT_SetDeferredRetcode(UT_KEY(OS_ObjectIdGetById), 2, OS_ERR_INVALID_ID);
+    OSAPI_TEST_FUNCTION_RC(OS_TaskGetInfo(UT_OBJID_1, &task_prop), OS_ERR_INVALID_ID);
+    UtAssert_STUB_COUNT(OS_TaskGetInfo_Impl, 2);
 }
 
 void Test_OS_TaskInstallDeleteHandler(void)
@@ -318,6 +336,47 @@ void Test_OS_TaskFindIdBySystemData(void)
                            OS_ERR_NAME_NOT_FOUND);
 }
 
+static void UT_TaskPoolTestJob(void *arg) {}
+
+void Test_OS_TaskPoolSubmit(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_TaskPoolSubmit(OS_TaskPoolJob_t job_func, void *job_arg)
+     */
+    int32 job_arg;
+
+    OSAPI_TEST_FUNCTION_RC(OS_TaskPoolSubmit(UT_TaskPoolTestJob, &job_arg), OS_SUCCESS);
+    UtAssert_STUB_COUNT(OS_TaskPoolSubmit_Impl, 1);
+
+    /* The implementation status is passed through */
+    UT_SetDeferredRetcode(UT_KEY(OS_TaskPoolSubmit_Impl), 1, OS_QUEUE_FULL);
+    OSAPI_TEST_FUNCTION_RC(OS_TaskPoolSubmit(UT_TaskPoolTestJob, NULL), OS_QUEUE_FULL);
+
+    /* Test parameter validation */
+    OSAPI_TEST_FUNCTION_RC(OS_TaskPoolSubmit(NULL, &job_arg), OS_INVALID_POINTER);
+    UtAssert_STUB_COUNT(OS_TaskPoolSubmit_Impl, 2);
+}
+
+void Test_OS_TaskPoolGetInfo(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_TaskPoolGetInfo(OS_task_pool_prop_t *pool_prop)
+     */
+    OS_task_pool_prop_t pool_prop;
+
+    memset(&pool_prop, 0xFF, sizeof(pool_prop));
+    OSAPI_TEST_FUNCTION_RC(OS_TaskPoolGetInfo(&pool_prop), OS_SUCCESS);
+    UtAssert_UINT32_EQ(pool_prop.num_workers, 0);
+    UtAssert_UINT32_EQ(pool_prop.jobs_submitted, 0);
+
+    UT_SetDeferredRetcode(UT_KEY(OS_TaskPoolGetInfo_Impl), 1, OS_ERR_NOT_IMPLEMENTED);
+    OSAPI_TEST_FUNCTION_RC(OS_TaskPoolGetInfo(&pool_prop), OS_ERR_NOT_IMPLEMENTED);
+
+    OSAPI_TEST_FUNCTION_RC(OS_TaskPoolGetInfo(NULL), OS_INVALID_POINTER);
+}
+
 /* Osapi_Test_Setup
  *
  * Purpose:
@@ -353,4 +412,6 @@ void UtTest_Setup(void)
     ADD_TEST(OS_TaskGetInfo);
     ADD_TEST(OS_TaskInstallDeleteHandler);
     ADD_TEST(OS_TaskFindIdBySystemData);
+    ADD_TEST(OS_TaskPoolSubmit);
+    ADD_TEST(OS_TaskPoolGetInfo);
 }
@@ -42,6 +42,8 @@
 #define OCS_ENOTSUP   0x1807
 #define OCS_ENOSYS    0x1808
 #define OCS_EROFS     0x1809
+#define OCS_ENOENT    0x180b
+#define OCS_EBADF     0x180c
 
 /* ----------------------------------------- */
 /* types normally defined in errno.h */
@@ -0,0 +1,67 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * \file
+ * \ingroup ut-stubs
+ *
+ * OSAL coverage stub replacement for sys/epoll.h
+ */
+
+#ifndef OCS_SYS_EPOLL_H
+#define OCS_SYS_EPOLL_H
+
+#include "OCS_basetypes.h"
+
+/* ----------------------------------------- */
+/* constants normally defined in sys/epoll.h */
+/* ----------------------------------------- */
+#define OCS_EPOLL_CLOEXEC 0x2101
+#define OCS_EPOLL_CTL_ADD 0x2102
+#define OCS_EPOLL_CTL_DEL 0x2103
+#define OCS_EPOLL_CTL_MOD 0x2104
+#define OCS_EPOLLIN       0x0001
+#define OCS_EPOLLOUT      0x0002
+#define OCS_EPOLLERR      0x0004
+#define OCS_EPOLLHUP      0x0008
+
+/* ----------------------------------------- */
+/* types normally defined in sys/epoll.h */
+/* ----------------------------------------- */
+typedef union OCS_epoll_data
+{
+    void *   ptr;
+    int      fd;
+    uint32_t u32;
+    uint64_t u64;
+} OCS_epoll_data_t;
+
+struct OCS_epoll_event
+{
+    uint32_t         events;
+    OCS_epoll_data_t data;
+};
+
+/* ----------------------------------------- */
+/* prototypes normally declared in sys/epoll.h */
+/* ----------------------------------------- */
+extern int OCS_epoll_create1(int flags);
+extern int OCS_epoll_ctl(int epfd, int op, int fd, struct OCS_epoll_event *event);
+extern int OCS_epoll_wait(int epfd, struct OCS_epoll_event *events, int maxevents, int timeout);
+
+#endif /* OCS_SYS_EPOLL_H */
@@ -27,6 +27,7 @@
 #define OCS_SYS_MMAN_H
 
 #include "OCS_basetypes.h"
+#include "OCS_sys_types.h"
 
 /* ----------------------------------------- */
 /* constants normally defined in sys/mman.h */
@@ -38,6 +39,7 @@
 #define OCS_PROT_WRITE  0x2010
 #define OCS_PROT_NONE   0x2020
 #define OCS_MAP_FIXED   0x2080
+#define OCS_MAP_FAILED  ((void *)-1)
 
 /* ----------------------------------------- */
 /* types normally defined in sys/mman.h */
@@ -41,6 +41,8 @@
 #define ENOTSUP   OCS_ENOTSUP
 #define ENOSYS    OCS_ENOSYS
 #define EROFS     OCS_EROFS
+#define ENOENT    OCS_ENOENT
+#define EBADF     OCS_EBADF
 
 #define errno OCS_errno
 
@@ -0,0 +1,50 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * \file
+ * \ingroup ut-stubs
+ *
+ * OSAL coverage stub replacement for sys/epoll.h
+ */
+
+#ifndef OVERRIDE_SYS_EPOLL_H
+#define OVERRIDE_SYS_EPOLL_H
+
+#include "OCS_sys_epoll.h"
+
+/* ----------------------------------------- */
+/* mappings for declarations in sys/epoll.h */
+/* ----------------------------------------- */
+
+#define EPOLL_CLOEXEC OCS_EPOLL_CLOEXEC
+#define EPOLL_CTL_ADD OCS_EPOLL_CTL_ADD
+#define EPOLL_CTL_DEL OCS_EPOLL_CTL_DEL
+#define EPOLL_CTL_MOD OCS_EPOLL_CTL_MOD
+#define EPOLLIN       OCS_EPOLLIN
+#define EPOLLOUT      OCS_EPOLLOUT
+#define EPOLLERR      OCS_EPOLLERR
+#define EPOLLHUP      OCS_EPOLLHUP
+
+#define epoll_data_t  OCS_epoll_data_t
+#define epoll_event   OCS_epoll_event
+#define epoll_create1 OCS_epoll_create1
+#define epoll_ctl     OCS_epoll_ctl
+#define epoll_wait    OCS_epoll_wait
+
+#endif /* OVERRIDE_SYS_EPOLL_H */
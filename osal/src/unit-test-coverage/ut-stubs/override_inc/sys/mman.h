@@ -39,6 +39,7 @@
 #define PROT_WRITE  OCS_PROT_WRITE
 #define PROT_NONE   OCS_PROT_NONE
 #define MAP_FIXED   OCS_MAP_FIXED
+#define MAP_FAILED  OCS_MAP_FAILED
 #define mmap        OCS_mmap
 #define munmap      OCS_munmap
 
@@ -38,6 +38,7 @@
 #define STDIN_FILENO  OCS_STDIN_FILENO
 #define STDOUT_FILENO OCS_STDOUT_FILENO
 #define STDERR_FILENO OCS_STDERR_FILENO
+#define _SC_PAGESIZE  OCS_SC_PAGESIZE
 
 #define close       OCS_close
 #define getegid     OCS_getegid
@@ -46,6 +47,8 @@
 #define gethostname OCS_gethostname
 #define getpid      OCS_getpid
 #define lseek       OCS_lseek
+#define pread       OCS_pread
+#define pwrite      OCS_pwrite
 #define read        OCS_read
 #define rmdir       OCS_rmdir
 #define sysconf     OCS_sysconf
@@ -67,3 +67,39 @@ void UT_DefaultHandler_OS_GenericWrite_Impl(void *UserObj, UT_EntryKey_t FuncKey
         UT_Stub_SetReturnValue(FuncKey, status);
     }
 }
+
+/*
+ * -----------------------------------------------------------------
+ * Default handler implementation for 'OS_GenericPread_Impl' stub
+ * -----------------------------------------------------------------
+ */
+void UT_DefaultHandler_OS_GenericPread_Impl(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    void * buffer = UT_Hook_GetArgValueByName(Context, "buffer", void *);
+    size_t nbytes = UT_Hook_GetArgValueByName(Context, "nbytes", size_t);
+    int32  status;
+
+    if (!UT_Stub_GetInt32StatusCode(Context, &status))
+    {
+        status = UT_Stub_CopyToLocal(UT_KEY(OS_GenericPread_Impl), buffer, nbytes);
+        UT_Stub_SetReturnValue(FuncKey, status);
+    }
+}
+
+/*
+ * -----------------------------------------------------------------
+ * Default handler implementation for 'OS_GenericPwrite_Impl' stub
+ * -----------------------------------------------------------------
+ */
+void UT_DefaultHandler_OS_GenericPwrite_Impl(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    const void *buffer = UT_Hook_GetArgValueByName(Context, "buffer", const void *);
+    size_t      nbytes = UT_Hook_GetArgValueByName(Context, "nbytes", size_t);
+    int32       status;
+
+    if (!UT_Stub_GetInt32StatusCode(Context, &status))
+    {
+        status = UT_Stub_CopyFromLocal(UT_KEY(OS_GenericPwrite_Impl), buffer, nbytes);
+        UT_Stub_SetReturnValue(FuncKey, status);
+    }
+}
@@ -25,9 +25,30 @@
 #include "os-shared-file.h"
 #include "utgenstub.h"
 
+void UT_DefaultHandler_OS_GenericPread_Impl(void *, UT_EntryKey_t, const UT_StubContext_t *);
+void UT_DefaultHandler_OS_GenericPwrite_Impl(void *, UT_EntryKey_t, const UT_StubContext_t *);
 void UT_DefaultHandler_OS_GenericRead_Impl(void *, UT_EntryKey_t, const UT_StubContext_t *);
 void UT_DefaultHandler_OS_GenericWrite_Impl(void *, UT_EntryKey_t, const UT_StubContext_t *);
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_FileAsyncSubmit_Impl()
+ * ----------------------------------------------------
+ */
+int32 OS_FileAsyncSubmit_Impl(OS_object_token_t *token, const OS_file_async_request_t *request,
+                              osal_id_t completion_queue)
+{
+    UT_GenStub_SetupReturnBuffer(OS_FileAsyncSubmit_Impl, int32);
+
+    UT_GenStub_AddParam(OS_FileAsyncSubmit_Impl, OS_object_token_t *, token);
+    UT_GenStub_AddParam(OS_FileAsyncSubmit_Impl, const OS_file_async_request_t *, request);
+    UT_GenStub_AddParam(OS_FileAsyncSubmit_Impl, osal_id_t, completion_queue);
+
+    UT_GenStub_Execute(OS_FileAsyncSubmit_Impl, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_FileAsyncSubmit_Impl, int32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for OS_FileChmod_Impl()
@@ -45,6 +66,25 @@ int32 OS_FileChmod_Impl(const char *local_path, uint32 access_mode)
     return UT_GenStub_GetReturnValue(OS_FileChmod_Impl, int32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_FileMap_Impl()
+ * ----------------------------------------------------
+ */
+int32 OS_FileMap_Impl(const OS_object_token_t *token, size_t offset, size_t length, void **addr)
+{
+    UT_GenStub_SetupReturnBuffer(OS_FileMap_Impl, int32);
+
+    UT_GenStub_AddParam(OS_FileMap_Impl, const OS_object_token_t *, token);
+    UT_GenStub_AddParam(OS_FileMap_Impl, size_t, offset);
+    UT_GenStub_AddParam(OS_FileMap_Impl, size_t, length);
+    UT_GenStub_AddParam(OS_FileMap_Impl, void **, addr);
+
+    UT_GenStub_Execute(OS_FileMap_Impl, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_FileMap_Impl, int32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for OS_FileOpen_Impl()
@@ -114,6 +154,24 @@ int32 OS_FileStat_Impl(const char *local_path, os_fstat_t *filestat)
     return UT_GenStub_GetReturnValue(OS_FileStat_Impl, int32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_FileUnmap_Impl()
+ * ----------------------------------------------------
+ */
+int32 OS_FileUnmap_Impl(const OS_object_token_t *token, void *addr, size_t length)
+{
+    UT_GenStub_SetupReturnBuffer(OS_FileUnmap_Impl, int32);
+
+    UT_GenStub_AddParam(OS_FileUnmap_Impl, const OS_object_token_t *, token);
+    UT_GenStub_AddParam(OS_FileUnmap_Impl, void *, addr);
+    UT_GenStub_AddParam(OS_FileUnmap_Impl, size_t, length);
+
+    UT_GenStub_Execute(OS_FileUnmap_Impl, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_FileUnmap_Impl, int32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for OS_GenericClose_Impl()
@@ -130,6 +188,44 @@ int32 OS_GenericClose_Impl(const OS_object_token_t *token)
     return UT_GenStub_GetReturnValue(OS_GenericClose_Impl, int32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_GenericPread_Impl()
+ * ----------------------------------------------------
+ */
+int32 OS_GenericPread_Impl(const OS_object_token_t *token, void *buffer, size_t nbytes, size_t offset)
+{
+    UT_GenStub_SetupReturnBuffer(OS_GenericPread_Impl, int32);
+
+    UT_GenStub_AddParam(OS_GenericPread_Impl, const OS_object_token_t *, token);
+    UT_GenStub_AddParam(OS_GenericPread_Impl, void *, buffer);
+    UT_GenStub_AddParam(OS_GenericPread_Impl, size_t, nbytes);
+    UT_GenStub_AddParam(OS_GenericPread_Impl, size_t, offset);
+
+    UT_GenStub_Execute(OS_GenericPread_Impl, Basic, UT_DefaultHandler_OS_GenericPread_Impl);
+
+    return UT_GenStub_GetReturnValue(OS_GenericPread_Impl, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_GenericPwrite_Impl()
+ * ----------------------------------------------------
+ */
+int32 OS_GenericPwrite_Impl(const OS_object_token_t *token, const void *buffer, size_t nbytes, size_t offset)
+{
+    UT_GenStub_SetupReturnBuffer(OS_GenericPwrite_Impl, int32);
+
+    UT_GenStub_AddParam(OS_GenericPwrite_Impl, const OS_object_token_t *, token);
+    UT_GenStub_AddParam(OS_GenericPwrite_Impl, const void *, buffer);
+    UT_GenStub_AddParam(OS_GenericPwrite_Impl, size_t, nbytes);
+    UT_GenStub_AddParam(OS_GenericPwrite_Impl, size_t, offset);
+
+    UT_GenStub_Execute(OS_GenericPwrite_Impl, Basic, UT_DefaultHandler_OS_GenericPwrite_Impl);
+
+    return UT_GenStub_GetReturnValue(OS_GenericPwrite_Impl, int32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for OS_GenericRead_Impl()
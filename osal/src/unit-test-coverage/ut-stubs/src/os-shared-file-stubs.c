@@ -25,6 +25,22 @@
 #include "os-shared-file.h"
 #include "utgenstub.h"
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_FileAsyncComplete()
+ * ----------------------------------------------------
+ */
+void OS_FileAsyncComplete(OS_object_token_t *token, const OS_file_async_request_t *request,
+                          osal_id_t completion_queue, int32 result)
+{
+    UT_GenStub_AddParam(OS_FileAsyncComplete, OS_object_token_t *, token);
+    UT_GenStub_AddParam(OS_FileAsyncComplete, const OS_file_async_request_t *, request);
+    UT_GenStub_AddParam(OS_FileAsyncComplete, osal_id_t, completion_queue);
+    UT_GenStub_AddParam(OS_FileAsyncComplete, int32, result);
+
+    UT_GenStub_Execute(OS_FileAsyncComplete, Basic, NULL);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for OS_FileIteratorClose()
@@ -43,6 +43,23 @@ bool OS_FileSysFilterFree(void *ref, const OS_object_token_t *token, const OS_co
     return UT_GenStub_GetReturnValue(OS_FileSysFilterFree, bool);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_FileSys_FindMountEntry()
+ * ----------------------------------------------------
+ */
+int32 OS_FileSys_FindMountEntry(const char *VirtualPath, OS_filesys_mount_entry_t *entry)
+{
+    UT_GenStub_SetupReturnBuffer(OS_FileSys_FindMountEntry, int32);
+
+    UT_GenStub_AddParam(OS_FileSys_FindMountEntry, const char *, VirtualPath);
+    UT_GenStub_AddParam(OS_FileSys_FindMountEntry, OS_filesys_mount_entry_t *, entry);
+
+    UT_GenStub_Execute(OS_FileSys_FindMountEntry, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_FileSys_FindMountEntry, int32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for OS_FileSys_FindVirtMountPoint()
@@ -82,3 +99,14 @@ int32 OS_FileSys_Initialize(char *address, const char *fsdevname, const char *fs
 
     return UT_GenStub_GetReturnValue(OS_FileSys_Initialize, int32);
 }
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_FileSys_RefreshMountTable()
+ * ----------------------------------------------------
+ */
+void OS_FileSys_RefreshMountTable(void)
+{
+
+    UT_GenStub_Execute(OS_FileSys_RefreshMountTable, Basic, NULL);
+}
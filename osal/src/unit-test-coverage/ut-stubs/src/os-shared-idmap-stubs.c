@@ -190,6 +190,23 @@ int32 OS_ObjectIdFindByName(osal_objtype_t idtype, const char *name, osal_id_t *
     return UT_GenStub_GetReturnValue(OS_ObjectIdFindByName, int32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_ObjectIdFindNameIndex()
+ * ----------------------------------------------------
+ */
+int32 OS_ObjectIdFindNameIndex(const char *name, OS_object_token_t *token)
+{
+    UT_GenStub_SetupReturnBuffer(OS_ObjectIdFindNameIndex, int32);
+
+    UT_GenStub_AddParam(OS_ObjectIdFindNameIndex, const char *, name);
+    UT_GenStub_AddParam(OS_ObjectIdFindNameIndex, OS_object_token_t *, token);
+
+    UT_GenStub_Execute(OS_ObjectIdFindNameIndex, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_ObjectIdFindNameIndex, int32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for OS_ObjectIdFindNextFree()
@@ -395,6 +412,18 @@ int32 OS_ObjectIdIteratorProcessEntry(OS_object_iter_t *iter, OS_ObjectIdIterato
     return UT_GenStub_GetReturnValue(OS_ObjectIdIteratorProcessEntry, int32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_ObjectIdNameIndexUpdate()
+ * ----------------------------------------------------
+ */
+void OS_ObjectIdNameIndexUpdate(const OS_object_token_t *token)
+{
+    UT_GenStub_AddParam(OS_ObjectIdNameIndexUpdate, const OS_object_token_t *, token);
+
+    UT_GenStub_Execute(OS_ObjectIdNameIndexUpdate, Basic, NULL);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for OS_ObjectIdRelease()
@@ -463,6 +492,22 @@ void OS_ObjectIdTransferToken(OS_object_token_t *token_from, OS_object_token_t *
     UT_GenStub_Execute(OS_ObjectIdTransferToken, Basic, UT_DefaultHandler_OS_ObjectIdTransferToken);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_ObjectNameHash()
+ * ----------------------------------------------------
+ */
+uint32 OS_ObjectNameHash(const char *name)
+{
+    UT_GenStub_SetupReturnBuffer(OS_ObjectNameHash, uint32);
+
+    UT_GenStub_AddParam(OS_ObjectNameHash, const char *, name);
+
+    UT_GenStub_Execute(OS_ObjectNameHash, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_ObjectNameHash, uint32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for OS_ObjectNameMatch()
@@ -0,0 +1,118 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * Auto-Generated stub implementations for functions defined in os-shared-poller header
+ */
+
+#include "os-shared-poller.h"
+#include "utgenstub.h"
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_PollerAdd_Impl()
+ * ----------------------------------------------------
+ */
+int32 OS_PollerAdd_Impl(const OS_object_token_t *token, const OS_object_token_t *stream_token, uint32 StateFlags,
+                        bool IsMember)
+{
+    UT_GenStub_SetupReturnBuffer(OS_PollerAdd_Impl, int32);
+
+    UT_GenStub_AddParam(OS_PollerAdd_Impl, const OS_object_token_t *, token);
+    UT_GenStub_AddParam(OS_PollerAdd_Impl, const OS_object_token_t *, stream_token);
+    UT_GenStub_AddParam(OS_PollerAdd_Impl, uint32, StateFlags);
+    UT_GenStub_AddParam(OS_PollerAdd_Impl, bool, IsMember);
+
+    UT_GenStub_Execute(OS_PollerAdd_Impl, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_PollerAdd_Impl, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_PollerCreate_Impl()
+ * ----------------------------------------------------
+ */
+int32 OS_PollerCreate_Impl(const OS_object_token_t *token, uint32 options)
+{
+    UT_GenStub_SetupReturnBuffer(OS_PollerCreate_Impl, int32);
+
+    UT_GenStub_AddParam(OS_PollerCreate_Impl, const OS_object_token_t *, token);
+    UT_GenStub_AddParam(OS_PollerCreate_Impl, uint32, options);
+
+    UT_GenStub_Execute(OS_PollerCreate_Impl, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_PollerCreate_Impl, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_PollerDelete_Impl()
+ * ----------------------------------------------------
+ */
+int32 OS_PollerDelete_Impl(const OS_object_token_t *token)
+{
+    UT_GenStub_SetupReturnBuffer(OS_PollerDelete_Impl, int32);
+
+    UT_GenStub_AddParam(OS_PollerDelete_Impl, const OS_object_token_t *, token);
+
+    UT_GenStub_Execute(OS_PollerDelete_Impl, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_PollerDelete_Impl, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_PollerRemove_Impl()
+ * ----------------------------------------------------
+ */
+int32 OS_PollerRemove_Impl(const OS_object_token_t *token, const OS_object_token_t *stream_token)
+{
+    UT_GenStub_SetupReturnBuffer(OS_PollerRemove_Impl, int32);
+
+    UT_GenStub_AddParam(OS_PollerRemove_Impl, const OS_object_token_t *, token);
+    UT_GenStub_AddParam(OS_PollerRemove_Impl, const OS_object_token_t *, stream_token);
+
+    UT_GenStub_Execute(OS_PollerRemove_Impl, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_PollerRemove_Impl, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_PollerWait_Impl()
+ * ----------------------------------------------------
+ */
+int32 OS_PollerWait_Impl(const OS_object_token_t *token, OS_poller_event_t *events, uint32 max_events,
+                         uint32 *num_events, int32 msecs)
+{
+    UT_GenStub_SetupReturnBuffer(OS_PollerWait_Impl, int32);
+
+    UT_GenStub_AddParam(OS_PollerWait_Impl, const OS_object_token_t *, token);
+    UT_GenStub_AddParam(OS_PollerWait_Impl, OS_poller_event_t *, events);
+    UT_GenStub_AddParam(OS_PollerWait_Impl, uint32, max_events);
+    UT_GenStub_AddParam(OS_PollerWait_Impl, uint32 *, num_events);
+    UT_GenStub_AddParam(OS_PollerWait_Impl, int32, msecs);
+
+    UT_GenStub_Execute(OS_PollerWait_Impl, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_PollerWait_Impl, int32);
+}
+
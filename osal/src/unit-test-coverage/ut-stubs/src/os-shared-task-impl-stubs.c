@@ -166,6 +166,39 @@ int32 OS_TaskMatch_Impl(const OS_object_token_t *token)
     return UT_GenStub_GetReturnValue(OS_TaskMatch_Impl, int32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_TaskPoolGetInfo_Impl()
+ * ----------------------------------------------------
+ */
+int32 OS_TaskPoolGetInfo_Impl(OS_task_pool_prop_t *pool_prop)
+{
+    UT_GenStub_SetupReturnBuffer(OS_TaskPoolGetInfo_Impl, int32);
+
+    UT_GenStub_AddParam(OS_TaskPoolGetInfo_Impl, OS_task_pool_prop_t *, pool_prop);
+
+    UT_GenStub_Execute(OS_TaskPoolGetInfo_Impl, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_TaskPoolGetInfo_Impl, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_TaskPoolSubmit_Impl()
+ * ----------------------------------------------------
+ */
+int32 OS_TaskPoolSubmit_Impl(OS_TaskPoolJob_t job_func, void *job_arg)
+{
+    UT_GenStub_SetupReturnBuffer(OS_TaskPoolSubmit_Impl, int32);
+
+    UT_GenStub_AddParam(OS_TaskPoolSubmit_Impl, OS_TaskPoolJob_t, job_func);
+    UT_GenStub_AddParam(OS_TaskPoolSubmit_Impl, void *, job_arg);
+
+    UT_GenStub_Execute(OS_TaskPoolSubmit_Impl, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_TaskPoolSubmit_Impl, int32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for OS_TaskRegister_Impl()
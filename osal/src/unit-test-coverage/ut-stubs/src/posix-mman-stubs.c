@@ -0,0 +1,52 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/* OSAL coverage stub replacement for functions in sys/mman.h */
+#include <string.h>
+#include <stdlib.h>
+#include "utstubs.h"
+
+#include "OCS_sys_mman.h"
+
+void *OCS_mmap(void *addr, size_t length, int prot, int flags, int fd, OCS_off_t offset)
+{
+    int32 Status;
+    void *retval;
+
+    Status = UT_DEFAULT_IMPL(OCS_mmap);
+
+    if (Status != 0)
+    {
+        retval = OCS_MAP_FAILED;
+    }
+    else if (UT_Stub_CopyToLocal(UT_KEY(OCS_mmap), &retval, sizeof(retval)) < sizeof(retval))
+    {
+        retval = NULL;
+    }
+
+    return retval;
+}
+
+int OCS_munmap(void *addr, size_t length)
+{
+    int32 Status;
+
+    Status = UT_DEFAULT_IMPL(OCS_munmap);
+
+    return Status;
+}
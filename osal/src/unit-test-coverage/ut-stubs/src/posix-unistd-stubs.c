@@ -94,6 +94,60 @@ OCS_off_t OCS_lseek(int fd, OCS_off_t offset, int whence)
     return Status;
 }
 
+OCS_ssize_t OCS_pread(int fd, void *buf, size_t n, OCS_off_t offset)
+{
+    int32  Status;
+    size_t CopySize;
+
+    Status = UT_DEFAULT_IMPL_RC(OCS_pread, OCS_MAX_RDWR_SIZE);
+
+    if (Status > 0)
+    {
+        if (Status > n)
+        {
+            Status = n;
+        }
+
+        CopySize = UT_Stub_CopyToLocal(UT_KEY(OCS_pread), buf, Status);
+
+        if (CopySize != 0)
+        {
+            Status = CopySize;
+        }
+        else
+        {
+            memset(buf, 'r', Status);
+        }
+    }
+
+    return Status;
+}
+
+OCS_ssize_t OCS_pwrite(int fd, const void *buf, size_t n, OCS_off_t offset)
+{
+    int32  Status;
+    size_t CopySize;
+
+    Status = UT_DEFAULT_IMPL_RC(OCS_pwrite, OCS_MAX_RDWR_SIZE);
+
+    if (Status > 0)
+    {
+        if (Status > n)
+        {
+            Status = n;
+        }
+
+        CopySize = UT_Stub_CopyFromLocal(UT_KEY(OCS_pwrite), buf, Status);
+
+        if (CopySize != 0)
+        {
+            Status = CopySize;
+        }
+    }
+
+    return Status;
+}
+
 OCS_ssize_t OCS_read(int fd, void *buf, size_t n)
 {
     int32  Status;
@@ -0,0 +1,62 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/* OSAL coverage stub replacement for functions in sys/epoll.h */
+#include <string.h>
+#include <stdlib.h>
+#include "utstubs.h"
+
+#include "OCS_sys_epoll.h"
+
+int OCS_epoll_create1(int flags)
+{
+    int32 Status;
+
+    Status = UT_DEFAULT_IMPL(OCS_epoll_create1);
+
+    return Status;
+}
+
+int OCS_epoll_ctl(int epfd, int op, int fd, struct OCS_epoll_event *event)
+{
+    int32 Status;
+
+    UT_Stub_RegisterContextGenericArg(UT_KEY(OCS_epoll_ctl), epfd);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(OCS_epoll_ctl), op);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(OCS_epoll_ctl), fd);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(OCS_epoll_ctl), event);
+
+    Status = UT_DEFAULT_IMPL(OCS_epoll_ctl);
+
+    return Status;
+}
+
+int OCS_epoll_wait(int epfd, struct OCS_epoll_event *events, int maxevents, int timeout)
+{
+    int32 Status;
+
+    Status = UT_DEFAULT_IMPL(OCS_epoll_wait);
+
+    /* a positive count is filled in from the data buffer, if one was set */
+    if (Status > 0 && Status <= maxevents)
+    {
+        UT_Stub_CopyToLocal(UT_KEY(OCS_epoll_wait), events, sizeof(*events) * Status);
+    }
+
+    return Status;
+}
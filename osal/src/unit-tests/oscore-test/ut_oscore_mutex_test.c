@@ -128,6 +128,27 @@ void UT_os_mut_sem_create_test()
 
     /* Reset test environment */
     UT_TEARDOWN(OS_MutSemDelete(mut_sem_id));
+
+    /*-----------------------------------------------------*/
+    /* #8 Options */
+
+    if (UT_SETUP(OS_MutSemCreate(&mut_sem_id, "NonRecursive", OS_MUTEX_OPTION_NONRECURSIVE)))
+    {
+        UT_NOMINAL(OS_MutSemTake(mut_sem_id));
+        UT_NOMINAL(OS_MutSemGive(mut_sem_id));
+        UT_TEARDOWN(OS_MutSemDelete(mut_sem_id));
+    }
+
+    if (UT_SETUP(OS_MutSemCreate(&mut_sem_id, "Adaptive", OS_MUTEX_OPTION_ADAPTIVE)))
+    {
+        UT_NOMINAL(OS_MutSemTake(mut_sem_id));
+        UT_NOMINAL(OS_MutSemGive(mut_sem_id));
+        UT_TEARDOWN(OS_MutSemDelete(mut_sem_id));
+    }
+
+    /* The test runs in the main thread, which may not be allowed to take a ceiling mutex */
+    UT_NOMINAL(OS_MutSemCreate(&mut_sem_id, "Ceiling", OS_MUTEX_OPTION_PRIO_CEILING));
+    UT_TEARDOWN(OS_MutSemDelete(mut_sem_id));
 }
 
 /*--------------------------------------------------------------------------------*
@@ -306,6 +327,44 @@ void UT_os_mut_sem_get_info_test()
 
         UT_TEARDOWN(OS_MutSemDelete(mut_sem_id));
     }
+
+    /*-----------------------------------------------------*/
+    /* #4 Statistics, which read as zero where not supported */
+
+    if (UT_SETUP(OS_MutSemCreate(&mut_sem_id, "GetInfoStats", OS_MUTEX_OPTION_STATISTICS)))
+    {
+        UT_SETUP(OS_MutSemTake(mut_sem_id));
+        UT_SETUP(OS_MutSemTake(mut_sem_id));
+        UT_SETUP(OS_MutSemGive(mut_sem_id));
+        UT_SETUP(OS_MutSemGive(mut_sem_id));
+
+        if (UT_NOMINAL(OS_MutSemGetInfo(mut_sem_id, &mut_sem_prop)))
+        {
+            UtAssert_True(mut_sem_prop.take_count == 0 || mut_sem_prop.take_count == 2, "take_count (%lu) is 0 or 2",
+                          (unsigned long)mut_sem_prop.take_count);
+            UtAssert_UINT32_EQ(mut_sem_prop.contention_count, 0);
+            UtAssert_True(OS_TimeGetTotalNanoseconds(mut_sem_prop.max_hold_time) <=
+                              OS_TimeGetTotalNanoseconds(mut_sem_prop.total_hold_time),
+                          "max_hold_time <= total_hold_time");
+        }
+
+        UT_TEARDOWN(OS_MutSemDelete(mut_sem_id));
+    }
+
+    /* Statistics are not collected unless requested at creation */
+    if (UT_SETUP(OS_MutSemCreate(&mut_sem_id, "GetInfoNoStats", 0)))
+    {
+        UT_SETUP(OS_MutSemTake(mut_sem_id));
+        UT_SETUP(OS_MutSemGive(mut_sem_id));
+
+        if (UT_NOMINAL(OS_MutSemGetInfo(mut_sem_id, &mut_sem_prop)))
+        {
+            UtAssert_UINT32_EQ(mut_sem_prop.take_count, 0);
+            UtAssert_UINT32_EQ(mut_sem_prop.contention_count, 0);
+        }
+
+        UT_TEARDOWN(OS_MutSemDelete(mut_sem_id));
+    }
 }
 
 /*================================================================================*
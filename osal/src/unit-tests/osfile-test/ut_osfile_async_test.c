@@ -0,0 +1,426 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/*================================================================================*
+** File:  ut_osfile_async_test.c
+**================================================================================*/
+
+/*--------------------------------------------------------------------------------*
+** Includes
+**--------------------------------------------------------------------------------*/
+
+#include "ut_osfile_async_test.h"
+
+/*--------------------------------------------------------------------------------*
+** Macros
+**--------------------------------------------------------------------------------*/
+
+/* Requests kept in flight; small enough for the default POSIX mqueue msg_max */
+#define UT_OS_ASYNC_DEPTH 8
+
+#define UT_OS_ASYNC_BLOCK_SIZE 4096
+
+/* Size of the benchmark file, in blocks */
+#define UT_OS_ASYNC_BENCH_BLOCKS 2048
+
+/* Upper bound on the wait for any single completion, in milliseconds */
+#define UT_OS_ASYNC_TIMEOUT 5000
+
+/*--------------------------------------------------------------------------------*
+** External global variables
+**--------------------------------------------------------------------------------*/
+
+extern char *g_mntName;
+
+/*--------------------------------------------------------------------------------*
+** Global variables
+**--------------------------------------------------------------------------------*/
+
+static char UT_os_async_fname[UT_OS_FILE_BUFF_SIZE];
+
+static uint8 UT_os_async_buffers[UT_OS_ASYNC_DEPTH][UT_OS_ASYNC_BLOCK_SIZE];
+
+/*--------------------------------------------------------------------------------*
+** Local function definitions
+**--------------------------------------------------------------------------------*/
+
+/*
+ * Fills a block with a pattern that depends on its position in the file
+ */
+static void UT_os_async_fill(uint8 *buf, uint32 block)
+{
+    uint32 i;
+
+    for (i = 0; i < UT_OS_ASYNC_BLOCK_SIZE; ++i)
+    {
+        buf[i] = (uint8)(block + i);
+    }
+}
+
+/*--------------------------------------------------------------------------------*/
+
+static int32 UT_os_async_submit(osal_id_t fd, uint32 opcode, void *buf, uint32 block, osal_id_t cq)
+{
+    OS_file_async_request_t req;
+
+    memset(&req, 0, sizeof(req));
+    req.filedes  = fd;
+    req.opcode   = opcode;
+    req.buffer   = buf;
+    req.nbytes   = UT_OS_ASYNC_BLOCK_SIZE;
+    req.offset   = (size_t)block * UT_OS_ASYNC_BLOCK_SIZE;
+    req.user_arg = buf;
+
+    return OS_FileAsyncSubmit(&req, cq);
+}
+
+/*--------------------------------------------------------------------------------*/
+
+static int32 UT_os_async_wait(osal_id_t cq, OS_file_async_completion_t *comp)
+{
+    size_t size_copied;
+    int32  status;
+
+    status = OS_QueueGet(cq, comp, sizeof(*comp), &size_copied, UT_OS_ASYNC_TIMEOUT);
+    if (status == OS_SUCCESS && size_copied != sizeof(*comp))
+    {
+        status = OS_QUEUE_INVALID_SIZE;
+    }
+
+    return status;
+}
+
+/*--------------------------------------------------------------------------------*/
+
+/*
+ * Transfers the whole benchmark file one block at a time with OS_pread/OS_pwrite,
+ * returns the number of failed transfers
+ */
+static uint32 UT_os_async_run_sync(osal_id_t fd, uint32 opcode)
+{
+    uint32 block;
+    uint32 errors = 0;
+    int32  status;
+
+    for (block = 0; block < UT_OS_ASYNC_BENCH_BLOCKS; ++block)
+    {
+        if (opcode == OS_FILE_ASYNC_WRITE)
+        {
+            status = OS_pwrite(fd, UT_os_async_buffers[0], UT_OS_ASYNC_BLOCK_SIZE,
+                               (size_t)block * UT_OS_ASYNC_BLOCK_SIZE);
+        }
+        else
+        {
+            status = OS_pread(fd, UT_os_async_buffers[0], UT_OS_ASYNC_BLOCK_SIZE,
+                              (size_t)block * UT_OS_ASYNC_BLOCK_SIZE);
+        }
+
+        if (status != UT_OS_ASYNC_BLOCK_SIZE)
+        {
+            ++errors;
+        }
+    }
+
+    return errors;
+}
+
+/*--------------------------------------------------------------------------------*/
+
+/*
+ * Transfers the whole benchmark file with up to UT_OS_ASYNC_DEPTH requests
+ * in flight, returns the number of failed transfers
+ */
+static uint32 UT_os_async_run_async(osal_id_t fd, uint32 opcode, osal_id_t cq)
+{
+    OS_file_async_completion_t comp;
+    void *                     free_bufs[UT_OS_ASYNC_DEPTH];
+    uint32                     num_free;
+    uint32                     next_block = 0;
+    uint32                     in_flight  = 0;
+    uint32                     errors     = 0;
+
+    for (num_free = 0; num_free < UT_OS_ASYNC_DEPTH; ++num_free)
+    {
+        free_bufs[num_free] = UT_os_async_buffers[num_free];
+    }
+
+    while (next_block < UT_OS_ASYNC_BENCH_BLOCKS || in_flight > 0)
+    {
+        while (next_block < UT_OS_ASYNC_BENCH_BLOCKS && num_free > 0)
+        {
+            --num_free;
+            if (UT_os_async_submit(fd, opcode, free_bufs[num_free], next_block, cq) == OS_SUCCESS)
+            {
+                ++in_flight;
+            }
+            else
+            {
+                ++errors;
+                ++num_free;
+            }
+            ++next_block;
+        }
+
+        if (in_flight == 0)
+        {
+            continue;
+        }
+
+        if (UT_os_async_wait(cq, &comp) != OS_SUCCESS)
+        {
+            /* completions are missing, nothing more can be expected */
+            errors += in_flight;
+            break;
+        }
+
+        --in_flight;
+        free_bufs[num_free] = comp.user_arg;
+        ++num_free;
+
+        if (comp.result != UT_OS_ASYNC_BLOCK_SIZE)
+        {
+            ++errors;
+        }
+    }
+
+    return errors;
+}
+
+/*--------------------------------------------------------------------------------*/
+
+static void UT_os_async_report(const char *label, OS_time_t start, OS_time_t end)
+{
+    int64 usec;
+
+    usec = OS_TimeGetTotalMicroseconds(OS_TimeSubtract(end, start));
+    if (usec <= 0)
+    {
+        usec = 1;
+    }
+
+    UtPrintf("%s: %lu KiB in %ld usec = %lu KiB/sec\n", label,
+             (unsigned long)(UT_OS_ASYNC_BENCH_BLOCKS * (UT_OS_ASYNC_BLOCK_SIZE / 1024)), (long)usec,
+             (unsigned long)(((int64)UT_OS_ASYNC_BENCH_BLOCKS * (UT_OS_ASYNC_BLOCK_SIZE / 1024) * 1000000) / usec));
+}
+
+/*--------------------------------------------------------------------------------*
+** Syntax: int32 OS_FileAsyncSubmit(const OS_file_async_request_t *request, osal_id_t completion_queue)
+** Purpose: Starts an asynchronous read, write or fsync; the completion is posted
+**          to the given queue
+** Returns: OS_INVALID_POINTER if the request or its buffer is null
+**          OS_ERR_INVALID_SIZE if the transfer size is zero
+**          OS_ERR_INVALID_ID if the file handle or queue is invalid
+**          OS_ERR_OPERATION_NOT_SUPPORTED if the opcode is not known
+**          OS_ERR_NOT_IMPLEMENTED if not implemented
+**          OS_SUCCESS if the request was queued
+** -----------------------------------------------------
+** Test #0: Not-implemented condition
+**   1) Call this routine with an fsync request on an open file
+**   2) If the returned value is OS_ERR_NOT_IMPLEMENTED, then exit test
+** -----------------------------------------------------
+** Test #1: Invalid-arg conditions
+**   1) Call this routine with null request/buffer, zero size, unknown opcode,
+**      and invalid file handle and queue
+**   2) Expect the matching error codes
+** -----------------------------------------------------
+** Test #2: Nominal condition
+**   1) Submit UT_OS_ASYNC_DEPTH writes of distinct blocks and an fsync
+**   2) Expect a completion with the full block size for each write and 0 for the fsync
+**   3) Submit reads of the same blocks, expect the written content back
+**   4) Read past the end of file, expect a result of 0
+**--------------------------------------------------------------------------------*/
+void UT_os_asyncfile_test(void)
+{
+    OS_file_async_request_t    req;
+    OS_file_async_completion_t comp;
+    osal_id_t                  cq;
+    osal_id_t                  fd;
+    uint8                      expected[UT_OS_ASYNC_BLOCK_SIZE];
+    uint32                     block;
+    uint32                     num_ok;
+    uint32                     i;
+    int32                      status;
+
+    if (!UT_SETUP(OS_QueueCreate(&cq, "AsyncCQ", UT_OS_ASYNC_DEPTH, sizeof(OS_file_async_completion_t), 0)))
+    {
+        return;
+    }
+
+    memset(UT_os_async_fname, '\0', sizeof(UT_os_async_fname));
+    UT_os_sprintf(UT_os_async_fname, "%s/Async_Test.dat", g_mntName);
+
+    if (UT_SETUP(OS_OpenCreate(&fd, UT_os_async_fname, OS_FILE_FLAG_CREATE | OS_FILE_FLAG_TRUNCATE, OS_READ_WRITE)))
+    {
+        memset(&req, 0, sizeof(req));
+        req.filedes = fd;
+        req.opcode  = OS_FILE_ASYNC_FSYNC;
+
+        /*-----------------------------------------------------*/
+        /* #0 Not-implemented */
+        status = OS_FileAsyncSubmit(&req, cq);
+        if (UT_IMPL(status) && UT_NOMINAL(status))
+        {
+            UT_RETVAL(UT_os_async_wait(cq, &comp), OS_SUCCESS);
+
+            /*-----------------------------------------------------*/
+            /* #1 Invalid-arg */
+            UT_RETVAL(OS_FileAsyncSubmit(NULL, cq), OS_INVALID_POINTER);
+            UT_RETVAL(OS_FileAsyncSubmit(&req, UT_OBJID_INCORRECT), OS_ERR_INVALID_ID);
+
+            req.opcode = OS_FILE_ASYNC_READ;
+            UT_RETVAL(OS_FileAsyncSubmit(&req, cq), OS_INVALID_POINTER);
+            req.buffer = UT_os_async_buffers[0];
+            UT_RETVAL(OS_FileAsyncSubmit(&req, cq), OS_ERR_INVALID_SIZE);
+            req.nbytes = UT_OS_ASYNC_BLOCK_SIZE;
+            req.opcode = 0;
+            UT_RETVAL(OS_FileAsyncSubmit(&req, cq), OS_ERR_OPERATION_NOT_SUPPORTED);
+            req.opcode  = OS_FILE_ASYNC_READ;
+            req.filedes = UT_OBJID_INCORRECT;
+            UT_RETVAL(OS_FileAsyncSubmit(&req, cq), OS_ERR_INVALID_ID);
+
+            /*-----------------------------------------------------*/
+            /* #2 Nominal */
+            for (block = 0; block < UT_OS_ASYNC_DEPTH; ++block)
+            {
+                UT_os_async_fill(UT_os_async_buffers[block], block);
+                UT_NOMINAL(UT_os_async_submit(fd, OS_FILE_ASYNC_WRITE, UT_os_async_buffers[block], block, cq));
+            }
+
+            num_ok = 0;
+            for (block = 0; block < UT_OS_ASYNC_DEPTH; ++block)
+            {
+                if (UT_os_async_wait(cq, &comp) == OS_SUCCESS && comp.opcode == OS_FILE_ASYNC_WRITE &&
+                    OS_ObjectIdEqual(comp.filedes, fd) && comp.result == UT_OS_ASYNC_BLOCK_SIZE)
+                {
+                    ++num_ok;
+                }
+            }
+            UtAssert_UINT32_EQ(num_ok, UT_OS_ASYNC_DEPTH);
+
+            req.filedes = fd;
+            req.opcode  = OS_FILE_ASYNC_FSYNC;
+            UT_NOMINAL(OS_FileAsyncSubmit(&req, cq));
+            UT_RETVAL(UT_os_async_wait(cq, &comp), OS_SUCCESS);
+            UtAssert_INT32_EQ(comp.result, 0);
+
+            memset(UT_os_async_buffers, 0, sizeof(UT_os_async_buffers));
+            for (block = 0; block < UT_OS_ASYNC_DEPTH; ++block)
+            {
+                UT_NOMINAL(UT_os_async_submit(fd, OS_FILE_ASYNC_READ, UT_os_async_buffers[block], block, cq));
+            }
+
+            num_ok = 0;
+            for (i = 0; i < UT_OS_ASYNC_DEPTH; ++i)
+            {
+                if (UT_os_async_wait(cq, &comp) == OS_SUCCESS && comp.result == UT_OS_ASYNC_BLOCK_SIZE)
+                {
+                    /* the user_arg is the buffer, which identifies the block */
+                    block = (uint32)(((uint8 *)comp.user_arg - UT_os_async_buffers[0]) / UT_OS_ASYNC_BLOCK_SIZE);
+                    UT_os_async_fill(expected, block);
+                    if (memcmp(comp.user_arg, expected, sizeof(expected)) == 0)
+                    {
+                        ++num_ok;
+                    }
+                }
+            }
+            UtAssert_UINT32_EQ(num_ok, UT_OS_ASYNC_DEPTH);
+
+            UT_NOMINAL(UT_os_async_submit(fd, OS_FILE_ASYNC_READ, UT_os_async_buffers[0], UT_OS_ASYNC_DEPTH, cq));
+            UT_RETVAL(UT_os_async_wait(cq, &comp), OS_SUCCESS);
+            UtAssert_INT32_EQ(comp.result, 0);
+        }
+
+        /* Reset test environment */
+        UT_TEARDOWN(OS_close(fd));
+        UT_TEARDOWN(OS_remove(UT_os_async_fname));
+    }
+
+    UT_TEARDOWN(OS_QueueDelete(cq));
+}
+
+/*--------------------------------------------------------------------------------*
+** Throughput benchmark
+**
+** Writes and then reads a UT_OS_ASYNC_BENCH_BLOCKS block file, first with one
+** blocking OS_pwrite()/OS_pread() per block, then with UT_OS_ASYNC_DEPTH
+** OS_FileAsyncSubmit() requests kept in flight, and reports the rate of each.
+** Only failed transfers are treated as test failures; the rates are for
+** inspection since they depend heavily on the host.
+**--------------------------------------------------------------------------------*/
+void UT_os_asyncfile_benchmark(void)
+{
+    OS_file_async_request_t    req;
+    OS_file_async_completion_t comp;
+    OS_time_t                  start;
+    OS_time_t                  end;
+    osal_id_t                  cq;
+    osal_id_t                  fd;
+    int32                      status;
+
+    if (!UT_SETUP(OS_QueueCreate(&cq, "AsyncBenchCQ", UT_OS_ASYNC_DEPTH, sizeof(OS_file_async_completion_t), 0)))
+    {
+        return;
+    }
+
+    memset(UT_os_async_fname, '\0', sizeof(UT_os_async_fname));
+    UT_os_sprintf(UT_os_async_fname, "%s/Async_Bench.dat", g_mntName);
+
+    if (UT_SETUP(OS_OpenCreate(&fd, UT_os_async_fname, OS_FILE_FLAG_CREATE | OS_FILE_FLAG_TRUNCATE, OS_READ_WRITE)))
+    {
+        memset(&req, 0, sizeof(req));
+        req.filedes = fd;
+        req.opcode  = OS_FILE_ASYNC_FSYNC;
+
+        status = OS_FileAsyncSubmit(&req, cq);
+        if (UT_IMPL(status) && UT_SETUP(status))
+        {
+            UT_RETVAL(UT_os_async_wait(cq, &comp), OS_SUCCESS);
+            memset(UT_os_async_buffers, 0xA5, sizeof(UT_os_async_buffers));
+
+            OS_GetLocalTime(&start);
+            UtAssert_UINT32_EQ(UT_os_async_run_sync(fd, OS_FILE_ASYNC_WRITE), 0);
+            OS_GetLocalTime(&end);
+            UT_os_async_report("Blocking write", start, end);
+
+            OS_GetLocalTime(&start);
+            UtAssert_UINT32_EQ(UT_os_async_run_async(fd, OS_FILE_ASYNC_WRITE, cq), 0);
+            OS_GetLocalTime(&end);
+            UT_os_async_report("Async write", start, end);
+
+            OS_GetLocalTime(&start);
+            UtAssert_UINT32_EQ(UT_os_async_run_sync(fd, OS_FILE_ASYNC_READ), 0);
+            OS_GetLocalTime(&end);
+            UT_os_async_report("Blocking read", start, end);
+
+            OS_GetLocalTime(&start);
+            UtAssert_UINT32_EQ(UT_os_async_run_async(fd, OS_FILE_ASYNC_READ, cq), 0);
+            OS_GetLocalTime(&end);
+            UT_os_async_report("Async read", start, end);
+        }
+
+        /* Reset test environment */
+        UT_TEARDOWN(OS_close(fd));
+        UT_TEARDOWN(OS_remove(UT_os_async_fname));
+    }
+
+    UT_TEARDOWN(OS_QueueDelete(cq));
+}
+
+/*================================================================================*
+** End of File: ut_osfile_async_test.c
+**================================================================================*/
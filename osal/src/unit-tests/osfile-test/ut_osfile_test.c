@@ -171,6 +171,10 @@ void UtTest_Setup(void)
         UtTest_Add(UT_os_closeallfiles_test, NULL, NULL, "OS_CloseAllFiles");
         UtTest_Add(UT_os_closefilebyname_test, NULL, NULL, "OS_CloseFileByName");
 
+        /* Asynchronous file I/O */
+        UtTest_Add(UT_os_asyncfile_test, NULL, NULL, "OS_FileAsyncSubmit");
+        UtTest_Add(UT_os_asyncfile_benchmark, NULL, NULL, "OS_FileAsyncSubmit throughput");
+
         UtTest_Add(NULL, NULL, UT_os_teardown_fs, "TEARDOWN");
     }
 }
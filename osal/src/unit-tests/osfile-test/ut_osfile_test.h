@@ -33,6 +33,7 @@
 #include "ut_os_support.h"
 #include "ut_osfile_fileio_test.h"
 #include "ut_osfile_dirio_test.h"
+#include "ut_osfile_async_test.h"
 
 /*--------------------------------------------------------------------------------*
 ** Macros
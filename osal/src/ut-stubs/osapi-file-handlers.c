@@ -152,6 +152,48 @@ void UT_DefaultHandler_OS_read(void *UserObj, UT_EntryKey_t FuncKey, const UT_St
     UT_GenericReadStub(FuncKey, Context);
 }
 
+/*
+ * -----------------------------------------------------------------
+ * Default handler implementation for 'OS_pread' stub
+ * -----------------------------------------------------------------
+ */
+void UT_DefaultHandler_OS_pread(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    UT_GenericReadStub(FuncKey, Context);
+}
+
+/*
+ * -----------------------------------------------------------------
+ * Default handler implementation for 'OS_pwrite' stub
+ * -----------------------------------------------------------------
+ */
+void UT_DefaultHandler_OS_pwrite(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    UT_GenericWriteStub(FuncKey, Context);
+}
+
+/*
+ * -----------------------------------------------------------------
+ * Default handler implementation for 'OS_FileMap' stub
+ * -----------------------------------------------------------------
+ */
+void UT_DefaultHandler_OS_FileMap(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    void **addr = UT_Hook_GetArgValueByName(Context, "addr", void **);
+    int32  status;
+    void * DataBuffer;
+
+    *addr = NULL;
+
+    /* If the test registered a data buffer, it stands in for the mapped file content */
+    UT_Stub_GetInt32StatusCode(Context, &status);
+    if (status == OS_SUCCESS)
+    {
+        UT_GetDataBuffer(FuncKey, &DataBuffer, NULL, NULL);
+        *addr = DataBuffer;
+    }
+}
+
 /*
  * -----------------------------------------------------------------
  * Default handler implementation for 'OS_write' stub
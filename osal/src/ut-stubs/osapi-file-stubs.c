@@ -26,11 +26,14 @@
 #include "utgenstub.h"
 
 void UT_DefaultHandler_OS_FDGetInfo(void *, UT_EntryKey_t, const UT_StubContext_t *);
+void UT_DefaultHandler_OS_FileMap(void *, UT_EntryKey_t, const UT_StubContext_t *);
 void UT_DefaultHandler_OS_OpenCreate(void *, UT_EntryKey_t, const UT_StubContext_t *);
 void UT_DefaultHandler_OS_TimedRead(void *, UT_EntryKey_t, const UT_StubContext_t *);
 void UT_DefaultHandler_OS_TimedWrite(void *, UT_EntryKey_t, const UT_StubContext_t *);
 void UT_DefaultHandler_OS_close(void *, UT_EntryKey_t, const UT_StubContext_t *);
 void UT_DefaultHandler_OS_lseek(void *, UT_EntryKey_t, const UT_StubContext_t *);
+void UT_DefaultHandler_OS_pread(void *, UT_EntryKey_t, const UT_StubContext_t *);
+void UT_DefaultHandler_OS_pwrite(void *, UT_EntryKey_t, const UT_StubContext_t *);
 void UT_DefaultHandler_OS_read(void *, UT_EntryKey_t, const UT_StubContext_t *);
 void UT_DefaultHandler_OS_stat(void *, UT_EntryKey_t, const UT_StubContext_t *);
 void UT_DefaultHandler_OS_write(void *, UT_EntryKey_t, const UT_StubContext_t *);
@@ -82,6 +85,23 @@ int32 OS_FDGetInfo(osal_id_t filedes, OS_file_prop_t *fd_prop)
     return UT_GenStub_GetReturnValue(OS_FDGetInfo, int32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_FileAsyncSubmit()
+ * ----------------------------------------------------
+ */
+int32 OS_FileAsyncSubmit(const OS_file_async_request_t *request, osal_id_t completion_queue)
+{
+    UT_GenStub_SetupReturnBuffer(OS_FileAsyncSubmit, int32);
+
+    UT_GenStub_AddParam(OS_FileAsyncSubmit, const OS_file_async_request_t *, request);
+    UT_GenStub_AddParam(OS_FileAsyncSubmit, osal_id_t, completion_queue);
+
+    UT_GenStub_Execute(OS_FileAsyncSubmit, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_FileAsyncSubmit, int32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for OS_FileOpenCheck()
@@ -98,6 +118,41 @@ int32 OS_FileOpenCheck(const char *Filename)
     return UT_GenStub_GetReturnValue(OS_FileOpenCheck, int32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_FileMap()
+ * ----------------------------------------------------
+ */
+int32 OS_FileMap(osal_id_t filedes, size_t offset, size_t length, void **addr)
+{
+    UT_GenStub_SetupReturnBuffer(OS_FileMap, int32);
+
+    UT_GenStub_AddParam(OS_FileMap, osal_id_t, filedes);
+    UT_GenStub_AddParam(OS_FileMap, size_t, offset);
+    UT_GenStub_AddParam(OS_FileMap, size_t, length);
+    UT_GenStub_AddParam(OS_FileMap, void **, addr);
+
+    UT_GenStub_Execute(OS_FileMap, Basic, UT_DefaultHandler_OS_FileMap);
+
+    return UT_GenStub_GetReturnValue(OS_FileMap, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_FileUnmap()
+ * ----------------------------------------------------
+ */
+int32 OS_FileUnmap(osal_id_t filedes)
+{
+    UT_GenStub_SetupReturnBuffer(OS_FileUnmap, int32);
+
+    UT_GenStub_AddParam(OS_FileUnmap, osal_id_t, filedes);
+
+    UT_GenStub_Execute(OS_FileUnmap, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_FileUnmap, int32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for OS_OpenCreate()
@@ -240,6 +295,44 @@ int32 OS_mv(const char *src, const char *dest)
     return UT_GenStub_GetReturnValue(OS_mv, int32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_pread()
+ * ----------------------------------------------------
+ */
+int32 OS_pread(osal_id_t filedes, void *buffer, size_t nbytes, size_t offset)
+{
+    UT_GenStub_SetupReturnBuffer(OS_pread, int32);
+
+    UT_GenStub_AddParam(OS_pread, osal_id_t, filedes);
+    UT_GenStub_AddParam(OS_pread, void *, buffer);
+    UT_GenStub_AddParam(OS_pread, size_t, nbytes);
+    UT_GenStub_AddParam(OS_pread, size_t, offset);
+
+    UT_GenStub_Execute(OS_pread, Basic, UT_DefaultHandler_OS_pread);
+
+    return UT_GenStub_GetReturnValue(OS_pread, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_pwrite()
+ * ----------------------------------------------------
+ */
+int32 OS_pwrite(osal_id_t filedes, const void *buffer, size_t nbytes, size_t offset)
+{
+    UT_GenStub_SetupReturnBuffer(OS_pwrite, int32);
+
+    UT_GenStub_AddParam(OS_pwrite, osal_id_t, filedes);
+    UT_GenStub_AddParam(OS_pwrite, const void *, buffer);
+    UT_GenStub_AddParam(OS_pwrite, size_t, nbytes);
+    UT_GenStub_AddParam(OS_pwrite, size_t, offset);
+
+    UT_GenStub_Execute(OS_pwrite, Basic, UT_DefaultHandler_OS_pwrite);
+
+    return UT_GenStub_GetReturnValue(OS_pwrite, int32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for OS_read()
@@ -0,0 +1,133 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * Auto-Generated stub implementations for functions defined in osapi-poller header
+ */
+
+#include "osapi-poller.h"
+#include "utgenstub.h"
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_PollerAdd()
+ * ----------------------------------------------------
+ */
+int32 OS_PollerAdd(osal_id_t poller_id, osal_id_t objid, uint32 StateFlags)
+{
+    UT_GenStub_SetupReturnBuffer(OS_PollerAdd, int32);
+
+    UT_GenStub_AddParam(OS_PollerAdd, osal_id_t, poller_id);
+    UT_GenStub_AddParam(OS_PollerAdd, osal_id_t, objid);
+    UT_GenStub_AddParam(OS_PollerAdd, uint32, StateFlags);
+
+    UT_GenStub_Execute(OS_PollerAdd, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_PollerAdd, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_PollerCreate()
+ * ----------------------------------------------------
+ */
+int32 OS_PollerCreate(osal_id_t *poller_id, const char *poller_name, uint32 options)
+{
+    UT_GenStub_SetupReturnBuffer(OS_PollerCreate, int32);
+
+    UT_GenStub_AddParam(OS_PollerCreate, osal_id_t *, poller_id);
+    UT_GenStub_AddParam(OS_PollerCreate, const char *, poller_name);
+    UT_GenStub_AddParam(OS_PollerCreate, uint32, options);
+
+    UT_GenStub_Execute(OS_PollerCreate, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_PollerCreate, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_PollerDelete()
+ * ----------------------------------------------------
+ */
+int32 OS_PollerDelete(osal_id_t poller_id)
+{
+    UT_GenStub_SetupReturnBuffer(OS_PollerDelete, int32);
+
+    UT_GenStub_AddParam(OS_PollerDelete, osal_id_t, poller_id);
+
+    UT_GenStub_Execute(OS_PollerDelete, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_PollerDelete, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_PollerGetIdByName()
+ * ----------------------------------------------------
+ */
+int32 OS_PollerGetIdByName(osal_id_t *poller_id, const char *poller_name)
+{
+    UT_GenStub_SetupReturnBuffer(OS_PollerGetIdByName, int32);
+
+    UT_GenStub_AddParam(OS_PollerGetIdByName, osal_id_t *, poller_id);
+    UT_GenStub_AddParam(OS_PollerGetIdByName, const char *, poller_name);
+
+    UT_GenStub_Execute(OS_PollerGetIdByName, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_PollerGetIdByName, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_PollerRemove()
+ * ----------------------------------------------------
+ */
+int32 OS_PollerRemove(osal_id_t poller_id, osal_id_t objid)
+{
+    UT_GenStub_SetupReturnBuffer(OS_PollerRemove, int32);
+
+    UT_GenStub_AddParam(OS_PollerRemove, osal_id_t, poller_id);
+    UT_GenStub_AddParam(OS_PollerRemove, osal_id_t, objid);
+
+    UT_GenStub_Execute(OS_PollerRemove, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_PollerRemove, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_PollerWait()
+ * ----------------------------------------------------
+ */
+int32 OS_PollerWait(osal_id_t poller_id, OS_poller_event_t *events, uint32 max_events, uint32 *num_events, int32 msecs)
+{
+    UT_GenStub_SetupReturnBuffer(OS_PollerWait, int32);
+
+    UT_GenStub_AddParam(OS_PollerWait, osal_id_t, poller_id);
+    UT_GenStub_AddParam(OS_PollerWait, OS_poller_event_t *, events);
+    UT_GenStub_AddParam(OS_PollerWait, uint32, max_events);
+    UT_GenStub_AddParam(OS_PollerWait, uint32 *, num_events);
+    UT_GenStub_AddParam(OS_PollerWait, int32, msecs);
+
+    UT_GenStub_Execute(OS_PollerWait, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_PollerWait, int32);
+}
+
@@ -66,3 +66,19 @@ void OS_printf_enable(void)
 
     UT_GenStub_Execute(OS_printf_enable, Basic, NULL);
 }
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_printf_GetStats()
+ * ----------------------------------------------------
+ */
+int32 OS_printf_GetStats(OS_printf_stats_t *stats)
+{
+    UT_GenStub_SetupReturnBuffer(OS_printf_GetStats, int32);
+
+    UT_GenStub_AddParam(OS_printf_GetStats, OS_printf_stats_t *, stats);
+
+    UT_GenStub_Execute(OS_printf_GetStats, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_printf_GetStats, int32);
+}
@@ -180,6 +180,39 @@ int32 OS_TaskInstallDeleteHandler(osal_task_entry function_pointer)
     return UT_GenStub_GetReturnValue(OS_TaskInstallDeleteHandler, int32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_TaskPoolGetInfo()
+ * ----------------------------------------------------
+ */
+int32 OS_TaskPoolGetInfo(OS_task_pool_prop_t *pool_prop)
+{
+    UT_GenStub_SetupReturnBuffer(OS_TaskPoolGetInfo, int32);
+
+    UT_GenStub_AddParam(OS_TaskPoolGetInfo, OS_task_pool_prop_t *, pool_prop);
+
+    UT_GenStub_Execute(OS_TaskPoolGetInfo, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_TaskPoolGetInfo, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_TaskPoolSubmit()
+ * ----------------------------------------------------
+ */
+int32 OS_TaskPoolSubmit(OS_TaskPoolJob_t job_func, void *job_arg)
+{
+    UT_GenStub_SetupReturnBuffer(OS_TaskPoolSubmit, int32);
+
+    UT_GenStub_AddParam(OS_TaskPoolSubmit, OS_TaskPoolJob_t, job_func);
+    UT_GenStub_AddParam(OS_TaskPoolSubmit, void *, job_arg);
+
+    UT_GenStub_Execute(OS_TaskPoolSubmit, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_TaskPoolSubmit, int32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for OS_TaskSetPriority()
@@ -32,6 +32,12 @@
  * nanoseconds, but this is converted down to units of microseconds for
  * consistency with previous versions of PSP where CFE_PSP_Get_Timebase()
  * returned units of microseconds.
+ *
+ * Optionally (see CFE_PSP_TIMEBASE_CPU_COUNTER) the time can instead be
+ * computed from a user-readable CPU counter, which avoids calling into
+ * the C library/kernel for every timestamp.  The counter is calibrated
+ * against the POSIX clock at init and periodically re-synchronized to it,
+ * so the output keeps the same epoch and rate as the POSIX clock.
  */
 
 /*
@@ -39,10 +45,12 @@
 */
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <time.h>
 
 #include "cfe_psp.h"
 #include "cfe_psp_module.h"
+#include "cfe_psp_config.h"
 
 /*
  * The specific clock ID to use with clock_gettime
@@ -59,10 +67,439 @@
  */
 #define CFE_PSP_TIMEBASE_REF_CLOCK CLOCK_MONOTONIC
 
+/*
+ * The CPU counter time source is opt-in, and the re-sync interval
+ * may be tuned, via cfe_psp_config.h.  Provide defaults for PSPs
+ * that do not configure it.
+ */
+#ifndef CFE_PSP_TIMEBASE_CPU_COUNTER
+#define CFE_PSP_TIMEBASE_CPU_COUNTER false
+#endif
+
+#ifndef CFE_PSP_TIMEBASE_RESYNC_MSEC
+#define CFE_PSP_TIMEBASE_RESYNC_MSEC 1000
+#endif
+
+/*
+ * The counter is only used on architectures where it is readable from
+ * user mode and runs at a fixed rate:
+ *
+ * x86_64  - the time stamp counter (RDTSC), if the CPU reports it as invariant
+ * aarch64 - the architected generic timer virtual count (CNTVCT_EL0)
+ *
+ * Both provide 128-bit integer arithmetic, which is used for the scaling.
+ */
+#if defined(__x86_64__)
+#include <cpuid.h>
+#define CFE_PSP_TIMEBASE_HAVE_CPU_COUNTER
+#elif defined(__aarch64__)
+#define CFE_PSP_TIMEBASE_HAVE_CPU_COUNTER
+#endif
+
+#define CFE_PSP_TIMEBASE_NSEC_PER_SEC 1000000000
+
+/*
+ * Duration of the initial rate calibration at init.  This only needs to be
+ * good enough for the first re-sync interval, each re-sync measures the
+ * rate again over the whole interval.
+ */
+#define CFE_PSP_TIMEBASE_CALIBRATE_NSEC 20000000
+
+/*
+ * Upper limit of the rate correction used to slew out an offset against the
+ * reference clock at a re-sync, in parts per million.  Offsets are slewed
+ * rather than stepped so the output remains continuous and monotonic.
+ */
+#define CFE_PSP_TIMEBASE_MAX_SLEW_PPM 500
+
+/*
+ * Offset beyond which the output is stepped forward to the reference clock
+ * instead of being slewed (e.g. the counter stopped while the CPU was halted)
+ */
+#define CFE_PSP_TIMEBASE_MAX_SLEW_NSEC 1000000
+
+/*
+ * Number of attempts a reader makes to copy a consistent scale before it
+ * falls back to the reference clock.  The scale is only inconsistent while
+ * a re-sync stores it, so this is only reached if that task was preempted.
+ */
+#define CFE_PSP_TIMEBASE_READ_RETRIES 4
+
+/*
+ * Conversion from counter values to nanoseconds.  The output at a given counter
+ * value is NsecBase + ((Counter - CounterBase) * NsecMult) >> 32.
+ */
+typedef struct
+{
+    uint64 CounterBase; /**< Counter value at the last re-sync */
+    uint64 NsecBase;    /**< Output time in nanoseconds at CounterBase */
+    uint64 NsecMult;    /**< Nanoseconds per count, as 32.32 fixed point */
+} PSP_TimebasePosixClock_Scale_t;
+
+/*
+ * Global state data for this module (not exposed publicly)
+ */
+static struct
+{
+    bool   CounterEnabled;
+    uint64 ResyncCounts; /**< Counter interval after which the next read re-syncs */
+
+    /*
+     * Sequence count protecting Scale.  It is odd while a re-sync is storing
+     * Scale; readers retry if it changed while they were copying it.
+     */
+    uint32                         ScaleSeq;
+    PSP_TimebasePosixClock_Scale_t Scale;
+
+    /* Set by the reader that claimed the next re-sync, until it has published the new scale */
+    bool ResyncBusy;
+
+    /* Reference clock sample from the last re-sync, only accessed by the re-sync holder */
+    uint64 RefCounter;
+    uint64 RefNsec;
+} PSP_TimebasePosixClock_Global;
+
 CFE_PSP_MODULE_DECLARE_SIMPLE(timebase_posix_clock);
 
+/*
+ * ----------------------------------------------------------------------
+ * Reads the reference POSIX clock, converted to nanoseconds
+ * ----------------------------------------------------------------------
+ */
+static uint64 timebase_posix_clock_ReadRefNsec(void)
+{
+    struct timespec now;
+
+    if (clock_gettime(CFE_PSP_TIMEBASE_REF_CLOCK, &now) != 0)
+    {
+        /* unlikely - but avoids undefined behavior */
+        now.tv_sec  = 0;
+        now.tv_nsec = 0;
+    }
+
+    return ((uint64)now.tv_sec * CFE_PSP_TIMEBASE_NSEC_PER_SEC) + (uint64)now.tv_nsec;
+}
+
+#ifdef CFE_PSP_TIMEBASE_HAVE_CPU_COUNTER
+
+/* Intermediate type for counter scaling, the extension keyword keeps pedantic builds quiet */
+__extension__ typedef unsigned __int128 PSP_TimebasePosixClock_Wide_t;
+
+/*
+ * ----------------------------------------------------------------------
+ * Reads the raw CPU counter
+ * ----------------------------------------------------------------------
+ */
+static inline uint64 timebase_posix_clock_ReadCounter(void)
+{
+#if defined(__x86_64__)
+    uint32 lo;
+    uint32 hi;
+
+    __asm__ __volatile__("rdtsc" : "=a"(lo), "=d"(hi));
+
+    return ((uint64)hi << 32) | lo;
+#else
+    uint64 val;
+
+    __asm__ __volatile__("isb\n\tmrs %0, cntvct_el0" : "=r"(val) : : "memory");
+
+    return val;
+#endif
+}
+
+/*
+ * ----------------------------------------------------------------------
+ * Checks whether the CPU counter runs at a constant rate
+ * ----------------------------------------------------------------------
+ */
+static bool timebase_posix_clock_CounterIsInvariant(void)
+{
+#if defined(__x86_64__)
+    unsigned int eax;
+    unsigned int ebx;
+    unsigned int ecx;
+    unsigned int edx;
+
+    /* CPUID.80000007H:EDX[8] indicates an invariant TSC */
+    if (__get_cpuid(0x80000007, &eax, &ebx, &ecx, &edx) == 0)
+    {
+        return false;
+    }
+
+    return ((edx & (1U << 8)) != 0);
+#else
+    /* The generic timer always counts at the fixed CNTFRQ rate */
+    return true;
+#endif
+}
+
+/*
+ * ----------------------------------------------------------------------
+ * Samples the reference clock along with the CPU counter value
+ * at the (approximate) same instant
+ * ----------------------------------------------------------------------
+ */
+static uint64 timebase_posix_clock_SampleRef(uint64 *Counter)
+{
+    uint64 Before;
+    uint64 Nsec;
+
+    Before   = timebase_posix_clock_ReadCounter();
+    Nsec     = timebase_posix_clock_ReadRefNsec();
+    *Counter = timebase_posix_clock_ReadCounter();
+
+    /* attribute the reference time to the middle of the counter interval */
+    *Counter = Before + ((*Counter - Before) / 2);
+
+    return Nsec;
+}
+
+/*
+ * ----------------------------------------------------------------------
+ * Scales a counter delta to nanoseconds
+ * ----------------------------------------------------------------------
+ */
+static inline uint64 timebase_posix_clock_ScaleDelta(uint64 Delta, uint64 NsecMult)
+{
+    return (uint64)(((PSP_TimebasePosixClock_Wide_t)Delta * NsecMult) >> 32);
+}
+
+/*
+ * ----------------------------------------------------------------------
+ * Re-synchronizes the counter scale to the reference clock
+ *
+ * Must only be called by the caller that claimed ResyncBusy, with the
+ * (even) value of ScaleSeq that OldScale was copied at.  The new scale is
+ * computed first, so ScaleSeq is only odd while it is being stored.
+ * Returns the current time in nanoseconds.
+ * ----------------------------------------------------------------------
+ */
+static uint64 timebase_posix_clock_Resync(uint32 Seq, const PSP_TimebasePosixClock_Scale_t *OldScale)
+{
+    PSP_TimebasePosixClock_Scale_t NewScale;
+    uint64                         Counter;
+    uint64                         RefNsec;
+    uint64                         RateMult;
+    int64                          Offset;
+    int64                          IntervalNsec;
+    int64                          SlewPpm;
+
+    RefNsec = timebase_posix_clock_SampleRef(&Counter);
+
+    NewScale.CounterBase = Counter;
+    NewScale.NsecBase    = OldScale->NsecBase + timebase_posix_clock_ScaleDelta(Counter - OldScale->CounterBase,
+                                                                                OldScale->NsecMult);
+    NewScale.NsecMult    = OldScale->NsecMult;
+
+    /* Measure the actual counter rate over the whole interval since the last re-sync */
+    IntervalNsec = (int64)(RefNsec - PSP_TimebasePosixClock_Global.RefNsec);
+    if (Counter > PSP_TimebasePosixClock_Global.RefCounter && IntervalNsec > 0)
+    {
+        RateMult = (uint64)(((PSP_TimebasePosixClock_Wide_t)IntervalNsec << 32) /
+                            (Counter - PSP_TimebasePosixClock_Global.RefCounter));
+
+        Offset = (int64)(RefNsec - NewScale.NsecBase);
+        if (Offset > CFE_PSP_TIMEBASE_MAX_SLEW_NSEC)
+        {
+            /* too far behind to catch up by slewing, so step forward */
+            NewScale.NsecBase = RefNsec;
+            SlewPpm           = 0;
+        }
+        else
+        {
+            /* correct the offset over the next interval, within the slew limit */
+            SlewPpm = (Offset * 1000000) / IntervalNsec;
+            if (SlewPpm > CFE_PSP_TIMEBASE_MAX_SLEW_PPM)
+            {
+                SlewPpm = CFE_PSP_TIMEBASE_MAX_SLEW_PPM;
+            }
+            else if (SlewPpm < -CFE_PSP_TIMEBASE_MAX_SLEW_PPM)
+            {
+                SlewPpm = -CFE_PSP_TIMEBASE_MAX_SLEW_PPM;
+            }
+        }
+
+        NewScale.NsecMult = RateMult + (uint64)(((int64)(RateMult / 1000000)) * SlewPpm);
+
+        PSP_TimebasePosixClock_Global.RefCounter = Counter;
+        PSP_TimebasePosixClock_Global.RefNsec    = RefNsec;
+    }
+
+    __atomic_store_n(&PSP_TimebasePosixClock_Global.ScaleSeq, Seq + 1, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    __atomic_store_n(&PSP_TimebasePosixClock_Global.Scale.CounterBase, NewScale.CounterBase, __ATOMIC_RELAXED);
+    __atomic_store_n(&PSP_TimebasePosixClock_Global.Scale.NsecBase, NewScale.NsecBase, __ATOMIC_RELAXED);
+    __atomic_store_n(&PSP_TimebasePosixClock_Global.Scale.NsecMult, NewScale.NsecMult, __ATOMIC_RELAXED);
+    __atomic_store_n(&PSP_TimebasePosixClock_Global.ScaleSeq, Seq + 2, __ATOMIC_RELEASE);
+
+    return NewScale.NsecBase;
+}
+
+/*
+ * ----------------------------------------------------------------------
+ * Computes the current time in nanoseconds from the CPU counter
+ * ----------------------------------------------------------------------
+ */
+static uint64 timebase_posix_clock_ReadCounterNsec(void)
+{
+    PSP_TimebasePosixClock_Scale_t Scale;
+    uint64                         Counter;
+    uint64                         Delta;
+    uint64                         Nsec;
+    uint32                         Seq;
+    uint32                         Retries;
+
+    Retries = 0;
+    do
+    {
+        /*
+         * Do not spin on a re-sync that was preempted while storing the scale,
+         * it may be a lower priority task on the same CPU
+         */
+        if (Retries == CFE_PSP_TIMEBASE_READ_RETRIES)
+        {
+            return timebase_posix_clock_ReadRefNsec();
+        }
+        ++Retries;
+
+        Seq               = __atomic_load_n(&PSP_TimebasePosixClock_Global.ScaleSeq, __ATOMIC_ACQUIRE);
+        Scale.CounterBase = __atomic_load_n(&PSP_TimebasePosixClock_Global.Scale.CounterBase, __ATOMIC_RELAXED);
+        Scale.NsecBase    = __atomic_load_n(&PSP_TimebasePosixClock_Global.Scale.NsecBase, __ATOMIC_RELAXED);
+        Scale.NsecMult    = __atomic_load_n(&PSP_TimebasePosixClock_Global.Scale.NsecMult, __ATOMIC_RELAXED);
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+    } while ((Seq & 1) != 0 || Seq != __atomic_load_n(&PSP_TimebasePosixClock_Global.ScaleSeq, __ATOMIC_RELAXED));
+
+    Counter = timebase_posix_clock_ReadCounter();
+
+    /* the counter may be read before the scale was updated by another CPU */
+    if (Counter > Scale.CounterBase)
+    {
+        Delta = Counter - Scale.CounterBase;
+    }
+    else
+    {
+        Delta = 0;
+    }
+
+    Nsec = Scale.NsecBase + timebase_posix_clock_ScaleDelta(Delta, Scale.NsecMult);
+
+    /*
+     * Once the re-sync interval has elapsed, the first reader to claim it does
+     * the re-sync.  Others continue to extrapolate from the current scale, which
+     * remains valid until the update is published.  If the scale was replaced
+     * since it was copied, the re-sync was already done by someone else.
+     */
+    if (Delta >= PSP_TimebasePosixClock_Global.ResyncCounts &&
+        !__atomic_exchange_n(&PSP_TimebasePosixClock_Global.ResyncBusy, true, __ATOMIC_ACQUIRE))
+    {
+        if (__atomic_load_n(&PSP_TimebasePosixClock_Global.ScaleSeq, __ATOMIC_RELAXED) == Seq)
+        {
+            Nsec = timebase_posix_clock_Resync(Seq, &Scale);
+        }
+
+        __atomic_store_n(&PSP_TimebasePosixClock_Global.ResyncBusy, false, __ATOMIC_RELEASE);
+    }
+
+    return Nsec;
+}
+
+/*
+ * ----------------------------------------------------------------------
+ * Calibrates the CPU counter against the reference clock
+ *
+ * Returns the counter frequency in Hz, or 0 if the counter is not usable
+ * ----------------------------------------------------------------------
+ */
+static uint64 timebase_posix_clock_CalibrateCounter(void)
+{
+    struct timespec delay;
+    uint64          StartCounter;
+    uint64          StartNsec;
+    uint64          Counter;
+    uint64          Nsec;
+    uint64          CounterHz;
+
+    if (!timebase_posix_clock_CounterIsInvariant())
+    {
+        return 0;
+    }
+
+    delay.tv_sec  = 0;
+    delay.tv_nsec = CFE_PSP_TIMEBASE_CALIBRATE_NSEC;
+
+    StartNsec = timebase_posix_clock_SampleRef(&StartCounter);
+    nanosleep(&delay, NULL);
+    Nsec = timebase_posix_clock_SampleRef(&Counter);
+
+    if (Counter <= StartCounter || Nsec <= StartNsec)
+    {
+        return 0;
+    }
+
+    CounterHz = (uint64)(((PSP_TimebasePosixClock_Wide_t)(Counter - StartCounter) * CFE_PSP_TIMEBASE_NSEC_PER_SEC) /
+                         (Nsec - StartNsec));
+
+    /* The counter must have at least the 1 usec resolution the PSP timebase requires */
+    if (CounterHz < 1000000)
+    {
+        return 0;
+    }
+
+    PSP_TimebasePosixClock_Global.Scale.CounterBase = Counter;
+    PSP_TimebasePosixClock_Global.Scale.NsecBase    = Nsec;
+    PSP_TimebasePosixClock_Global.Scale.NsecMult =
+        (uint64)(((PSP_TimebasePosixClock_Wide_t)(Nsec - StartNsec) << 32) / (Counter - StartCounter));
+    PSP_TimebasePosixClock_Global.RefCounter   = Counter;
+    PSP_TimebasePosixClock_Global.RefNsec      = Nsec;
+    PSP_TimebasePosixClock_Global.ResyncCounts = (CounterHz * CFE_PSP_TIMEBASE_RESYNC_MSEC) / 1000;
+
+    return CounterHz;
+}
+
+#endif /* CFE_PSP_TIMEBASE_HAVE_CPU_COUNTER */
+
+/*
+ * ----------------------------------------------------------------------
+ * Reads the current time in nanoseconds from the configured source
+ * ----------------------------------------------------------------------
+ */
+static uint64 timebase_posix_clock_ReadNsec(void)
+{
+#ifdef CFE_PSP_TIMEBASE_HAVE_CPU_COUNTER
+    if (PSP_TimebasePosixClock_Global.CounterEnabled)
+    {
+        return timebase_posix_clock_ReadCounterNsec();
+    }
+#endif
+
+    return timebase_posix_clock_ReadRefNsec();
+}
+
 void timebase_posix_clock_Init(uint32 PspModuleId)
 {
+    memset(&PSP_TimebasePosixClock_Global, 0, sizeof(PSP_TimebasePosixClock_Global));
+
+#ifdef CFE_PSP_TIMEBASE_HAVE_CPU_COUNTER
+    if (CFE_PSP_TIMEBASE_CPU_COUNTER)
+    {
+        uint64 CounterHz = timebase_posix_clock_CalibrateCounter();
+
+        if (CounterHz != 0)
+        {
+            PSP_TimebasePosixClock_Global.CounterEnabled = true;
+
+            /* Inform the user that this module is in use */
+            printf("CFE_PSP: Using CPU counter at %lu Hz synced to POSIX monotonic clock every %lu ms as CFE "
+                   "timebase\n",
+                   (unsigned long)CounterHz, (unsigned long)CFE_PSP_TIMEBASE_RESYNC_MSEC);
+            return;
+        }
+
+        printf("CFE_PSP: CPU counter is not usable as timebase\n");
+    }
+#endif
+
     /* Inform the user that this module is in use */
     printf("CFE_PSP: Using POSIX monotonic clock as CFE timebase\n");
 }
@@ -70,6 +507,7 @@ void timebase_posix_clock_Init(uint32 PspModuleId)
 /*
  * ----------------------------------------------------------------------
  * The CFE_PSP_Get_Timebase() is a wrapper around clock_gettime()
+ * (or the CPU counter, if enabled)
  *
  * Reads the value of the monotonic POSIX clock, and output the value with
  * the whole seconds in the upper 32 and nanoseconds in the lower 32.
@@ -80,22 +518,15 @@ void timebase_posix_clock_Init(uint32 PspModuleId)
  */
 void CFE_PSP_Get_Timebase(uint32 *Tbu, uint32 *Tbl)
 {
-    struct timespec now;
+    uint64 Nsec = timebase_posix_clock_ReadNsec();
 
-    if (clock_gettime(CFE_PSP_TIMEBASE_REF_CLOCK, &now) != 0)
-    {
-        /* unlikely - but avoids undefined behavior */
-        now.tv_sec  = 0;
-        now.tv_nsec = 0;
-    }
-
-    *Tbu = now.tv_sec & 0xFFFFFFFF;
-    *Tbl = now.tv_nsec;
+    *Tbu = (Nsec / CFE_PSP_TIMEBASE_NSEC_PER_SEC) & 0xFFFFFFFF;
+    *Tbl = Nsec % CFE_PSP_TIMEBASE_NSEC_PER_SEC;
 }
 
 /*
  * ----------------------------------------------------------------------
- * The CFE_PSP_GetTime() is also a wrapper around the same clock_gettime()
+ * The CFE_PSP_GetTime() is also a wrapper around the same time source
  *
  * Reads the value of the monotonic POSIX clock, and output the value
  * normalized to an OS_time_t format.
@@ -103,16 +534,10 @@ void CFE_PSP_Get_Timebase(uint32 *Tbu, uint32 *Tbl)
  */
 void CFE_PSP_GetTime(OS_time_t *LocalTime)
 {
-    struct timespec now;
-
-    if (clock_gettime(CFE_PSP_TIMEBASE_REF_CLOCK, &now) != 0)
-    {
-        /* unlikely - but avoids undefined behavior */
-        now.tv_sec  = 0;
-        now.tv_nsec = 0;
-    }
+    uint64 Nsec = timebase_posix_clock_ReadNsec();
 
-    *LocalTime = OS_TimeAssembleFromNanoseconds(now.tv_sec, now.tv_nsec);
+    *LocalTime = OS_TimeAssembleFromNanoseconds(Nsec / CFE_PSP_TIMEBASE_NSEC_PER_SEC,
+                                                Nsec % CFE_PSP_TIMEBASE_NSEC_PER_SEC);
 }
 
 /******************************************************************************
@@ -72,6 +72,21 @@
  */
 #define CFE_PSP_SOFT_TIMEBASE_PERIOD 10000
 
+/*
+ * Use the CPU counter (x86_64 invariant TSC or aarch64 CNTVCT) rather than
+ * clock_gettime() for CFE_PSP_Get_Timebase() and CFE_PSP_GetTime().
+ *
+ * The counter is calibrated against CLOCK_MONOTONIC at startup and re-synced
+ * to it every CFE_PSP_TIMEBASE_RESYNC_MSEC, slewing out any difference.  If
+ * the counter is not usable on the running CPU, clock_gettime() is used.
+ */
+#define CFE_PSP_TIMEBASE_CPU_COUNTER false
+
+/*
+ * Interval at which the CPU counter time source is re-synced, in milliseconds
+ */
+#define CFE_PSP_TIMEBASE_RESYNC_MSEC 1000
+
 /*
 ** Global variables
 */
@@ -0,0 +1,462 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/*
+ *  This program summarizes an ES shared data lock profile file, ranking
+ *  the call sites that acquire the cFE core locks by the time spent
+ *  waiting for them.
+ *
+ *  Inputs: The lock profile file name, optionally preceded by "-t" to
+ *          list tasks separately, "-s <key>" to select the ranking and
+ *          "-n <count>" to limit the number of call sites listed.
+ *
+ *  Outputs: Prints the summary.  Returns 0 if successful.
+ */
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <errno.h>
+
+/* This header is needed for CFE_FS_Header_t and the file sub type codes.
+ * This uses the OSAL definition of fixed-width types, even though this tool
+ * is not using OSAL itself.
+ */
+#include "common_types.h"
+#include "cfe_fs_extern_typedefs.h"
+
+/*
+ * Offsets of the fields of the lock profile metadata
+ * (CFE_ES_LockProfileMetaData_t), all 32 bit words
+ */
+#define LOCKPROF_META_BOM_OFFSET        0
+#define LOCKPROF_META_RECSIZE_OFFSET    4
+#define LOCKPROF_META_FUNCLEN_OFFSET    8
+#define LOCKPROF_META_TASKLEN_OFFSET    12
+#define LOCKPROF_META_TICKS_OFFSET      16
+#define LOCKPROF_META_NUMRECORDS_OFFSET 20
+#define LOCKPROF_META_DROPPED_OFFSET    24
+#define LOCKPROF_META_SIZE              32
+
+/*
+ * Offsets of the fields of each record (CFE_ES_LockProfileRecord_t).  The
+ * function and task names follow the fixed fields, their sizes are given
+ * in the metadata.
+ */
+#define LOCKPROF_REC_WAITTOTAL_OFFSET 0
+#define LOCKPROF_REC_HOLDTOTAL_OFFSET 8
+#define LOCKPROF_REC_TASKID_OFFSET    16
+#define LOCKPROF_REC_LOCKID_OFFSET    20
+#define LOCKPROF_REC_LINE_OFFSET      24
+#define LOCKPROF_REC_ACQUIRE_OFFSET   28
+#define LOCKPROF_REC_CONTENDED_OFFSET 32
+#define LOCKPROF_REC_WAITMAX_OFFSET   36
+#define LOCKPROF_REC_HOLDMAX_OFFSET   40
+#define LOCKPROF_REC_NAMES_OFFSET     44
+
+#define LOCKPROF_BYTE_ORDER_MARK     0x01020304
+#define LOCKPROF_FS_HDR_SUBTYPE      4
+#define LOCKPROF_MAX_NAME_LEN        256
+#define LOCKPROF_DEFAULT_LIST_LENGTH 20
+
+/* Names of the locks, indexed by CFE_ES_LockProfileLock_Enum_t */
+static const char *const LOCK_NAMES[] = {"ES", "SB", "TBL", "FS", "EVS"};
+
+#define LOCKPROF_NUM_LOCKS (sizeof(LOCK_NAMES) / sizeof(LOCK_NAMES[0]))
+
+typedef enum
+{
+    SORT_BY_WAIT,
+    SORT_BY_HOLD,
+    SORT_BY_CONTENDED,
+    SORT_BY_COUNT
+} SortKey_t;
+
+typedef struct
+{
+    char   FunctionName[LOCKPROF_MAX_NAME_LEN];
+    char   TaskName[LOCKPROF_MAX_NAME_LEN];
+    uint32 TaskId;
+    uint32 LockId;
+    uint32 LineNumber;
+    uint32 Tasks;
+    uint64 AcquireCount;
+    uint64 ContendedCount;
+    uint64 WaitTicksTotal;
+    uint64 HoldTicksTotal;
+    uint32 WaitTicksMax;
+    uint32 HoldTicksMax;
+} Site_t;
+
+static SortKey_t SortKey = SORT_BY_WAIT;
+
+static uint32 GetBE32(const uint8 *Ptr)
+{
+    return ((uint32)Ptr[0] << 24) | ((uint32)Ptr[1] << 16) | ((uint32)Ptr[2] << 8) | Ptr[3];
+}
+
+/* Reads a 32 bit word in the byte order of the target that wrote the file */
+static uint32 GetTarget32(const uint8 *Ptr, int BigEndian)
+{
+    if (BigEndian)
+    {
+        return GetBE32(Ptr);
+    }
+
+    return ((uint32)Ptr[3] << 24) | ((uint32)Ptr[2] << 16) | ((uint32)Ptr[1] << 8) | Ptr[0];
+}
+
+/* Reads a 64 bit word in the byte order of the target that wrote the file */
+static uint64 GetTarget64(const uint8 *Ptr, int BigEndian)
+{
+    if (BigEndian)
+    {
+        return ((uint64)GetTarget32(Ptr, 1) << 32) | GetTarget32(Ptr + 4, 1);
+    }
+
+    return ((uint64)GetTarget32(Ptr + 4, 0) << 32) | GetTarget32(Ptr, 0);
+}
+
+/* Copies a fixed size, possibly unterminated, name field */
+static void GetName(char *Dest, const uint8 *Src, uint32 Len)
+{
+    if (Len >= LOCKPROF_MAX_NAME_LEN)
+    {
+        Len = LOCKPROF_MAX_NAME_LEN - 1;
+    }
+
+    memcpy(Dest, Src, Len);
+    Dest[Len] = 0;
+}
+
+static uint8 *ReadFile(const char *FileName, size_t *Size)
+{
+    FILE * fp;
+    uint8 *Buf;
+    long   Len;
+
+    fp = fopen(FileName, "rb");
+    if (fp == NULL)
+    {
+        fprintf(stderr, "Cannot open %s: %s\n", FileName, strerror(errno));
+        return NULL;
+    }
+
+    Buf = NULL;
+    if (fseek(fp, 0, SEEK_END) == 0 && (Len = ftell(fp)) >= 0 && fseek(fp, 0, SEEK_SET) == 0)
+    {
+        Buf = malloc(Len + 1);
+        if (Buf != NULL && fread(Buf, 1, Len, fp) != (size_t)Len)
+        {
+            fprintf(stderr, "Error reading %s\n", FileName);
+            free(Buf);
+            Buf = NULL;
+        }
+        *Size = Len;
+    }
+
+    fclose(fp);
+    return Buf;
+}
+
+static uint64 SortValue(const Site_t *Site)
+{
+    switch (SortKey)
+    {
+        case SORT_BY_HOLD:
+            return Site->HoldTicksTotal;
+        case SORT_BY_CONTENDED:
+            return Site->ContendedCount;
+        case SORT_BY_COUNT:
+            return Site->AcquireCount;
+        default:
+            return Site->WaitTicksTotal;
+    }
+}
+
+static int CompareSites(const void *p1, const void *p2)
+{
+    uint64 v1 = SortValue((const Site_t *)p1);
+    uint64 v2 = SortValue((const Site_t *)p2);
+
+    /* largest first */
+    return (v1 < v2) - (v1 > v2);
+}
+
+static const char *LockName(uint32 LockId)
+{
+    if (LockId < LOCKPROF_NUM_LOCKS)
+    {
+        return LOCK_NAMES[LockId];
+    }
+
+    return "?";
+}
+
+static double TicksToUsec(uint64 Ticks, uint32 TicksPerSecond)
+{
+    return ((double)Ticks * 1000000.0) / TicksPerSecond;
+}
+
+int main(int argc, char **argv)
+{
+    uint8 *      Buf;
+    size_t       Size;
+    size_t       Pos;
+    uint32       RecordSize;
+    uint32       FunctionNameLen;
+    uint32       TaskNameLen;
+    uint32       TicksPerSecond;
+    uint32       NumRecords;
+    uint32       Dropped;
+    uint32       NumSites;
+    uint32       ListLength;
+    uint32       i;
+    uint32       j;
+    int          BigEndian;
+    int          PerTask;
+    int          ArgIdx;
+    const uint8 *Meta;
+    const uint8 *Rec;
+    Site_t       Record;
+    Site_t *     Sites;
+    Site_t       LockTotals[LOCKPROF_NUM_LOCKS];
+
+    PerTask    = 0;
+    ListLength = LOCKPROF_DEFAULT_LIST_LENGTH;
+    for (ArgIdx = 1; ArgIdx < argc - 1; ++ArgIdx)
+    {
+        if (strcmp(argv[ArgIdx], "-t") == 0)
+        {
+            PerTask = 1;
+        }
+        else if (strcmp(argv[ArgIdx], "-n") == 0 && ArgIdx < argc - 2)
+        {
+            ListLength = strtoul(argv[++ArgIdx], NULL, 0);
+        }
+        else if (strcmp(argv[ArgIdx], "-s") == 0 && ArgIdx < argc - 2)
+        {
+            ++ArgIdx;
+            if (strcmp(argv[ArgIdx], "wait") == 0)
+            {
+                SortKey = SORT_BY_WAIT;
+            }
+            else if (strcmp(argv[ArgIdx], "hold") == 0)
+            {
+                SortKey = SORT_BY_HOLD;
+            }
+            else if (strcmp(argv[ArgIdx], "contended") == 0)
+            {
+                SortKey = SORT_BY_CONTENDED;
+            }
+            else if (strcmp(argv[ArgIdx], "count") == 0)
+            {
+                SortKey = SORT_BY_COUNT;
+            }
+            else
+            {
+                break;
+            }
+        }
+        else
+        {
+            break;
+        }
+    }
+
+    if (ArgIdx != argc - 1)
+    {
+        fprintf(stderr, "usage: %s [-t] [-s wait|hold|contended|count] [-n <count>] <lock profile file>\n", argv[0]);
+        return 1;
+    }
+
+    Buf = ReadFile(argv[ArgIdx], &Size);
+    if (Buf == NULL)
+    {
+        return 1;
+    }
+
+    if (Size < sizeof(CFE_FS_Header_t) + LOCKPROF_META_SIZE || GetBE32(Buf) != CFE_FS_FILE_CONTENT_ID)
+    {
+        fprintf(stderr, "%s is not a cFE file\n", argv[ArgIdx]);
+        return 1;
+    }
+
+    if (GetBE32(&Buf[LOCKPROF_FS_HDR_SUBTYPE]) != CFE_FS_SubType_ES_LOCKPROFILE)
+    {
+        fprintf(stderr, "%s is not a lock profile file (sub type %lu)\n", argv[ArgIdx],
+                (unsigned long)GetBE32(&Buf[LOCKPROF_FS_HDR_SUBTYPE]));
+        return 1;
+    }
+
+    /* the byte order mark reads as 01 02 03 04 when written by a big endian target */
+    Meta      = &Buf[sizeof(CFE_FS_Header_t)];
+    BigEndian = (GetBE32(&Meta[LOCKPROF_META_BOM_OFFSET]) == LOCKPROF_BYTE_ORDER_MARK);
+    if (!BigEndian && GetTarget32(&Meta[LOCKPROF_META_BOM_OFFSET], 0) != LOCKPROF_BYTE_ORDER_MARK)
+    {
+        fprintf(stderr, "%s has an invalid byte order mark\n", argv[ArgIdx]);
+        return 1;
+    }
+
+    RecordSize      = GetTarget32(&Meta[LOCKPROF_META_RECSIZE_OFFSET], BigEndian);
+    FunctionNameLen = GetTarget32(&Meta[LOCKPROF_META_FUNCLEN_OFFSET], BigEndian);
+    TaskNameLen     = GetTarget32(&Meta[LOCKPROF_META_TASKLEN_OFFSET], BigEndian);
+    TicksPerSecond  = GetTarget32(&Meta[LOCKPROF_META_TICKS_OFFSET], BigEndian);
+    NumRecords      = GetTarget32(&Meta[LOCKPROF_META_NUMRECORDS_OFFSET], BigEndian);
+    Dropped         = GetTarget32(&Meta[LOCKPROF_META_DROPPED_OFFSET], BigEndian);
+
+    if (TicksPerSecond == 0 || RecordSize < LOCKPROF_REC_NAMES_OFFSET + FunctionNameLen + TaskNameLen)
+    {
+        fprintf(stderr, "%s has invalid lock profile metadata\n", argv[ArgIdx]);
+        return 1;
+    }
+
+    Pos = sizeof(CFE_FS_Header_t) + LOCKPROF_META_SIZE;
+    if ((Size - Pos) / RecordSize < NumRecords)
+    {
+        fprintf(stderr, "Warning: %s is truncated, holds %lu of %lu records\n", argv[ArgIdx],
+                (unsigned long)((Size - Pos) / RecordSize), (unsigned long)NumRecords);
+        NumRecords = (Size - Pos) / RecordSize;
+    }
+
+    Sites = calloc(NumRecords + 1, sizeof(Site_t));
+    if (Sites == NULL)
+    {
+        fprintf(stderr, "Out of memory\n");
+        return 1;
+    }
+
+    memset(LockTotals, 0, sizeof(LockTotals));
+    NumSites = 0;
+    for (i = 0; i < NumRecords; ++i)
+    {
+        Rec = &Buf[Pos + ((size_t)i * RecordSize)];
+
+        memset(&Record, 0, sizeof(Record));
+        Record.WaitTicksTotal = GetTarget64(&Rec[LOCKPROF_REC_WAITTOTAL_OFFSET], BigEndian);
+        Record.HoldTicksTotal = GetTarget64(&Rec[LOCKPROF_REC_HOLDTOTAL_OFFSET], BigEndian);
+        Record.TaskId         = GetTarget32(&Rec[LOCKPROF_REC_TASKID_OFFSET], BigEndian);
+        Record.LockId         = GetTarget32(&Rec[LOCKPROF_REC_LOCKID_OFFSET], BigEndian);
+        Record.LineNumber     = GetTarget32(&Rec[LOCKPROF_REC_LINE_OFFSET], BigEndian);
+        Record.AcquireCount   = GetTarget32(&Rec[LOCKPROF_REC_ACQUIRE_OFFSET], BigEndian);
+        Record.ContendedCount = GetTarget32(&Rec[LOCKPROF_REC_CONTENDED_OFFSET], BigEndian);
+        Record.WaitTicksMax   = GetTarget32(&Rec[LOCKPROF_REC_WAITMAX_OFFSET], BigEndian);
+        Record.HoldTicksMax   = GetTarget32(&Rec[LOCKPROF_REC_HOLDMAX_OFFSET], BigEndian);
+        Record.Tasks          = 1;
+        GetName(Record.FunctionName, &Rec[LOCKPROF_REC_NAMES_OFFSET], FunctionNameLen);
+        GetName(Record.TaskName, &Rec[LOCKPROF_REC_NAMES_OFFSET + FunctionNameLen], TaskNameLen);
+
+        if (Record.LockId < LOCKPROF_NUM_LOCKS)
+        {
+            LockTotals[Record.LockId].AcquireCount += Record.AcquireCount;
+            LockTotals[Record.LockId].ContendedCount += Record.ContendedCount;
+            LockTotals[Record.LockId].WaitTicksTotal += Record.WaitTicksTotal;
+            LockTotals[Record.LockId].HoldTicksTotal += Record.HoldTicksTotal;
+        }
+
+        /* unless listing tasks separately, the same call site in different tasks is combined */
+        j = NumSites;
+        if (!PerTask)
+        {
+            for (j = 0; j < NumSites; ++j)
+            {
+                if (Sites[j].LockId == Record.LockId && Sites[j].LineNumber == Record.LineNumber &&
+                    strcmp(Sites[j].FunctionName, Record.FunctionName) == 0)
+                {
+                    break;
+                }
+            }
+        }
+
+        if (j == NumSites)
+        {
+            Sites[NumSites] = Record;
+            ++NumSites;
+        }
+        else
+        {
+            Sites[j].AcquireCount += Record.AcquireCount;
+            Sites[j].ContendedCount += Record.ContendedCount;
+            Sites[j].WaitTicksTotal += Record.WaitTicksTotal;
+            Sites[j].HoldTicksTotal += Record.HoldTicksTotal;
+            if (Record.WaitTicksMax > Sites[j].WaitTicksMax)
+            {
+                Sites[j].WaitTicksMax = Record.WaitTicksMax;
+            }
+            if (Record.HoldTicksMax > Sites[j].HoldTicksMax)
+            {
+                Sites[j].HoldTicksMax = Record.HoldTicksMax;
+            }
+            ++Sites[j].Tasks;
+        }
+    }
+
+    printf("%s: %lu records, timebase %lu ticks/s, %lu acquisitions not accounted (call site tables full)\n\n",
+           argv[ArgIdx], (unsigned long)NumRecords, (unsigned long)TicksPerSecond, (unsigned long)Dropped);
+
+    printf("%-4s %12s %12s %7s %16s %16s\n", "Lock", "Acquires", "Contended", "%", "Wait total(us)",
+           "Hold total(us)");
+    for (i = 0; i < LOCKPROF_NUM_LOCKS; ++i)
+    {
+        printf("%-4s %12llu %12llu %6.2f%% %16.1f %16.1f\n", LOCK_NAMES[i],
+               (unsigned long long)LockTotals[i].AcquireCount, (unsigned long long)LockTotals[i].ContendedCount,
+               LockTotals[i].AcquireCount ? (100.0 * LockTotals[i].ContendedCount) / LockTotals[i].AcquireCount : 0.0,
+               TicksToUsec(LockTotals[i].WaitTicksTotal, TicksPerSecond),
+               TicksToUsec(LockTotals[i].HoldTicksTotal, TicksPerSecond));
+    }
+
+    qsort(Sites, NumSites, sizeof(Site_t), CompareSites);
+    if (ListLength == 0 || ListLength > NumSites)
+    {
+        ListLength = NumSites;
+    }
+
+    printf("\n%-4s %-4s %-40s %-20s %10s %10s %14s %12s %14s %12s\n", "Rank", "Lock", "Call site",
+           PerTask ? "Task" : "Tasks", "Acquires", "Contended", "Wait tot(us)", "Wait max", "Hold tot(us)",
+           "Hold max");
+    for (i = 0; i < ListLength; ++i)
+    {
+        char SiteName[LOCKPROF_MAX_NAME_LEN + 16];
+        char TaskName[LOCKPROF_MAX_NAME_LEN + 16];
+
+        snprintf(SiteName, sizeof(SiteName), "%s:%lu", Sites[i].FunctionName, (unsigned long)Sites[i].LineNumber);
+        if (!PerTask)
+        {
+            snprintf(TaskName, sizeof(TaskName), "%lu", (unsigned long)Sites[i].Tasks);
+        }
+        else if (Sites[i].TaskName[0] != 0)
+        {
+            snprintf(TaskName, sizeof(TaskName), "%s", Sites[i].TaskName);
+        }
+        else
+        {
+            snprintf(TaskName, sizeof(TaskName), "0x%08lx", (unsigned long)Sites[i].TaskId);
+        }
+
+        printf("%4lu %-4s %-40s %-20s %10llu %10llu %14.1f %12.1f %14.1f %12.1f\n", (unsigned long)(i + 1),
+               LockName(Sites[i].LockId), SiteName, TaskName, (unsigned long long)Sites[i].AcquireCount,
+               (unsigned long long)Sites[i].ContendedCount, TicksToUsec(Sites[i].WaitTicksTotal, TicksPerSecond),
+               TicksToUsec(Sites[i].WaitTicksMax, TicksPerSecond),
+               TicksToUsec(Sites[i].HoldTicksTotal, TicksPerSecond),
+               TicksToUsec(Sites[i].HoldTicksMax, TicksPerSecond));
+    }
+
+    free(Sites);
+    free(Buf);
+
+    return 0;
+}
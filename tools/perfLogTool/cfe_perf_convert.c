@@ -0,0 +1,312 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/*
+ *  This program converts an ES performance analyzer dump file written in
+ *  the compact (delta encoded) format into the standard format, where each
+ *  entry is a 32 bit data word followed by the upper and lower 32 bit timer
+ *  words.
+ *
+ *  Inputs: The input file name and the output file name, optionally
+ *          preceded by "-v" to print a summary.
+ *
+ *  Outputs: Writes the standard format file.  Returns 0 if successful.
+ */
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <errno.h>
+
+/* This header is needed for CFE_FS_Header_t and the file sub type codes.
+ * This uses the OSAL definition of fixed-width types, even though this tool
+ * is not using OSAL itself.
+ */
+#include "common_types.h"
+#include "cfe_fs_extern_typedefs.h"
+
+/*
+ * Offsets of the fields used by this tool within the perf metadata
+ * (CFE_ES_PerfMetaData_t), which is a sequence of 32 bit words after
+ * the leading version/endian bytes.  The metadata ends with two
+ * masks of FilterTriggerMaskSize words each.
+ */
+#define PERF_META_ENDIAN_OFFSET      1
+#define PERF_META_ROLLOVER_OFFSET    8
+#define PERF_META_DATACOUNT_OFFSET   32
+#define PERF_META_MASKSIZE_OFFSET    40
+#define PERF_META_FIXED_SIZE         44
+#define PERF_META_MAX_MASK_WORDS     1024
+#define PERF_ENTRY_SIZE              12
+#define PERF_FS_HDR_SUBTYPE_OFFSET   4
+
+static int HostIsBigEndian(void)
+{
+    uint32 Check = 0x01000000;
+
+    return *((uint8 *)&Check) == 0x01;
+}
+
+static uint32 GetBE32(const uint8 *Ptr)
+{
+    return ((uint32)Ptr[0] << 24) | ((uint32)Ptr[1] << 16) | ((uint32)Ptr[2] << 8) | Ptr[3];
+}
+
+/* Reads a 32 bit word in the byte order of the target that wrote the file */
+static uint32 GetTarget32(const uint8 *Ptr, int BigEndian)
+{
+    if (BigEndian)
+    {
+        return GetBE32(Ptr);
+    }
+
+    return ((uint32)Ptr[3] << 24) | ((uint32)Ptr[2] << 16) | ((uint32)Ptr[1] << 8) | Ptr[0];
+}
+
+/* Stores a 32 bit word in the byte order of the target that wrote the file */
+static void PutTarget32(uint8 *Ptr, uint32 Value, int BigEndian)
+{
+    int i;
+
+    for (i = 0; i < 4; ++i)
+    {
+        if (BigEndian)
+        {
+            Ptr[3 - i] = (uint8)(Value >> (8 * i));
+        }
+        else
+        {
+            Ptr[i] = (uint8)(Value >> (8 * i));
+        }
+    }
+}
+
+/* Decodes one unsigned LEB128 varint, returns the number of bytes consumed or 0 if truncated/invalid */
+static size_t GetVarint(const uint8 *Ptr, size_t Avail, uint64 *Value)
+{
+    size_t Len   = 0;
+    uint32 Shift = 0;
+
+    *Value = 0;
+    while (Len < Avail && Shift < 64)
+    {
+        *Value |= (uint64)(Ptr[Len] & 0x7F) << Shift;
+        if ((Ptr[Len] & 0x80) == 0)
+        {
+            return Len + 1;
+        }
+        Shift += 7;
+        ++Len;
+    }
+
+    return 0;
+}
+
+static uint8 *ReadFile(const char *FileName, size_t *Size)
+{
+    FILE * fp;
+    uint8 *Buf;
+    long   Len;
+
+    fp = fopen(FileName, "rb");
+    if (fp == NULL)
+    {
+        fprintf(stderr, "Cannot open %s: %s\n", FileName, strerror(errno));
+        return NULL;
+    }
+
+    Buf = NULL;
+    if (fseek(fp, 0, SEEK_END) == 0 && (Len = ftell(fp)) >= 0 && fseek(fp, 0, SEEK_SET) == 0)
+    {
+        Buf = malloc(Len + 1);
+        if (Buf != NULL && fread(Buf, 1, Len, fp) != (size_t)Len)
+        {
+            fprintf(stderr, "Error reading %s\n", FileName);
+            free(Buf);
+            Buf = NULL;
+        }
+        *Size = Len;
+    }
+
+    fclose(fp);
+    return Buf;
+}
+
+int main(int argc, char **argv)
+{
+    uint8 *      InBuf;
+    uint8 *      OutBuf;
+    size_t       InSize;
+    size_t       OutSize;
+    size_t       Pos;
+    size_t       MetaSize;
+    size_t       Len;
+    uint32       SubType;
+    uint32       MaskSize;
+    uint32       Rollover;
+    uint32       DataCount;
+    uint32       Count;
+    uint32       Data;
+    uint64       Delta;
+    uint64       Value;
+    uint64       Timestamp;
+    int          BigEndian;
+    int          Verbose;
+    int          ArgBase;
+    FILE *       fp;
+    const uint8 *Meta;
+
+    Verbose = 0;
+    ArgBase = 1;
+    if (argc > 1 && strcmp(argv[1], "-v") == 0)
+    {
+        Verbose = 1;
+        ArgBase = 2;
+    }
+
+    if (argc != ArgBase + 2)
+    {
+        fprintf(stderr, "usage: %s [-v] <compact perf file> <output file>\n", argv[0]);
+        return 1;
+    }
+
+    InBuf = ReadFile(argv[ArgBase], &InSize);
+    if (InBuf == NULL)
+    {
+        return 1;
+    }
+
+    if (InSize < sizeof(CFE_FS_Header_t) + PERF_META_FIXED_SIZE || GetBE32(InBuf) != CFE_FS_FILE_CONTENT_ID)
+    {
+        fprintf(stderr, "%s is not a cFE file\n", argv[ArgBase]);
+        return 1;
+    }
+
+    SubType = GetBE32(&InBuf[PERF_FS_HDR_SUBTYPE_OFFSET]);
+    if (SubType != CFE_FS_SubType_ES_PERFDATA && SubType != CFE_FS_SubType_ES_PERFDATA_COMPACT)
+    {
+        fprintf(stderr, "%s is not a performance data file (sub type %lu)\n", argv[ArgBase], (unsigned long)SubType);
+        return 1;
+    }
+
+    Meta      = &InBuf[sizeof(CFE_FS_Header_t)];
+    BigEndian = (Meta[PERF_META_ENDIAN_OFFSET] == 0x01);
+    Rollover  = GetTarget32(&Meta[PERF_META_ROLLOVER_OFFSET], BigEndian);
+    DataCount = GetTarget32(&Meta[PERF_META_DATACOUNT_OFFSET], BigEndian);
+    MaskSize  = GetTarget32(&Meta[PERF_META_MASKSIZE_OFFSET], BigEndian);
+    MetaSize  = PERF_META_FIXED_SIZE + (2 * 4 * (size_t)MaskSize);
+
+    if (MaskSize > PERF_META_MAX_MASK_WORDS || InSize < sizeof(CFE_FS_Header_t) + MetaSize)
+    {
+        fprintf(stderr, "%s has invalid performance metadata\n", argv[ArgBase]);
+        return 1;
+    }
+
+    if (SubType == CFE_FS_SubType_ES_PERFDATA)
+    {
+        /* already in the standard format, output is a plain copy */
+        OutBuf  = InBuf;
+        OutSize = InSize;
+        Count   = (InSize - sizeof(CFE_FS_Header_t) - MetaSize) / PERF_ENTRY_SIZE;
+    }
+    else
+    {
+        OutBuf = malloc(sizeof(CFE_FS_Header_t) + MetaSize + ((size_t)DataCount * PERF_ENTRY_SIZE));
+        if (OutBuf == NULL)
+        {
+            fprintf(stderr, "Out of memory\n");
+            return 1;
+        }
+
+        /* file header and metadata are stored unchanged, apart from the sub type */
+        memcpy(OutBuf, InBuf, sizeof(CFE_FS_Header_t) + MetaSize);
+        OutBuf[PERF_FS_HDR_SUBTYPE_OFFSET]     = 0;
+        OutBuf[PERF_FS_HDR_SUBTYPE_OFFSET + 1] = 0;
+        OutBuf[PERF_FS_HDR_SUBTYPE_OFFSET + 2] = 0;
+        OutBuf[PERF_FS_HDR_SUBTYPE_OFFSET + 3] = CFE_FS_SubType_ES_PERFDATA;
+
+        Pos       = sizeof(CFE_FS_Header_t) + MetaSize;
+        OutSize   = Pos;
+        Timestamp = 0;
+        Count     = 0;
+        while (Pos < InSize && Count < DataCount)
+        {
+            Len = GetVarint(&InBuf[Pos], InSize - Pos, &Delta);
+            if (Len == 0)
+            {
+                break;
+            }
+            Pos += Len;
+
+            Len = GetVarint(&InBuf[Pos], InSize - Pos, &Value);
+            if (Len == 0)
+            {
+                break;
+            }
+            Pos += Len;
+
+            /* undo the zigzag encoding of the signed delta and the rotation of the data word */
+            Timestamp += (Delta >> 1) ^ (~(Delta & 1) + 1);
+            Data = (uint32)((Value >> 1) | (Value << 31));
+
+            PutTarget32(&OutBuf[OutSize], Data, BigEndian);
+            if (Rollover != 0)
+            {
+                PutTarget32(&OutBuf[OutSize + 4], (uint32)(Timestamp / Rollover), BigEndian);
+                PutTarget32(&OutBuf[OutSize + 8], (uint32)(Timestamp % Rollover), BigEndian);
+            }
+            else
+            {
+                PutTarget32(&OutBuf[OutSize + 4], (uint32)(Timestamp >> 32), BigEndian);
+                PutTarget32(&OutBuf[OutSize + 8], (uint32)Timestamp, BigEndian);
+            }
+            OutSize += PERF_ENTRY_SIZE;
+            ++Count;
+        }
+
+        if (Pos != InSize || Count != DataCount)
+        {
+            fprintf(stderr, "Warning: %s is truncated or corrupt, decoded %lu of %lu entries\n", argv[ArgBase],
+                    (unsigned long)Count, (unsigned long)DataCount);
+        }
+    }
+
+    fp = fopen(argv[ArgBase + 1], "wb");
+    if (fp == NULL)
+    {
+        fprintf(stderr, "Cannot create %s: %s\n", argv[ArgBase + 1], strerror(errno));
+        return 1;
+    }
+
+    if (fwrite(OutBuf, 1, OutSize, fp) != OutSize)
+    {
+        fprintf(stderr, "Error writing %s\n", argv[ArgBase + 1]);
+        fclose(fp);
+        return 1;
+    }
+
+    fclose(fp);
+
+    if (Verbose)
+    {
+        printf("%s: %lu entries, %lu bytes -> %s: %lu bytes (%s host byte order)\n", argv[ArgBase],
+               (unsigned long)Count, (unsigned long)InSize, argv[ArgBase + 1], (unsigned long)OutSize,
+               (BigEndian == HostIsBigEndian()) ? "same as" : "opposite of");
+    }
+
+    return 0;
+}